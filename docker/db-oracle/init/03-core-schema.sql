@@ -145,6 +145,7 @@ CREATE INDEX idx_certificate_first_upload ON certificate(first_upload_id);
 CREATE INDEX idx_certificate_ldap_dn_v2 ON certificate(ldap_dn_v2);
 CREATE INDEX idx_certificate_source_type ON certificate(source_type);
 CREATE INDEX idx_certificate_extracted_from ON certificate(extracted_from);
+CREATE INDEX idx_certificate_created_id ON certificate(created_at DESC, id DESC);
 CREATE INDEX idx_certificate_signature_algorithm ON certificate(signature_algorithm);
 CREATE INDEX idx_certificate_public_key_algorithm ON certificate(public_key_algorithm);
 CREATE INDEX idx_certificate_public_key_size ON certificate(public_key_size);
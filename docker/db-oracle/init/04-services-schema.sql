@@ -234,7 +234,14 @@ CREATE TABLE revalidation_history (
     crl_revoked NUMBER(10) DEFAULT 0,
     crl_unavailable NUMBER(10) DEFAULT 0,
     crl_expired NUMBER(10) DEFAULT 0,
-    crl_errors NUMBER(10) DEFAULT 0
+    crl_errors NUMBER(10) DEFAULT 0,
+    -- FULL (every DSC) or INCREMENTAL (DSCs affected by journaled changes)
+    run_mode VARCHAR2(12) DEFAULT 'FULL' NOT NULL,
+    -- Per-step wall time and trust chain / CRL worker count
+    expiry_duration_ms NUMBER(10) DEFAULT 0,
+    tc_duration_ms NUMBER(10) DEFAULT 0,
+    crl_duration_ms NUMBER(10) DEFAULT 0,
+    workers NUMBER(5) DEFAULT 1
 );
 
 CREATE OR REPLACE TRIGGER trg_revalidation_history_id
@@ -248,6 +255,53 @@ END;
 
 CREATE INDEX idx_reval_history_executed ON revalidation_history(executed_at DESC);
 
+-- =============================================================================
+-- Revalidation Change Journal (CSCA / link certificate / CRL inserts)
+-- =============================================================================
+-- Filled by triggers (every insert path, every service); rows are deleted by
+-- the revalidation run that consumed them.
+
+CREATE SEQUENCE seq_reval_change_journal START WITH 1 INCREMENT BY 1 NOCACHE;
+
+CREATE TABLE revalidation_change_journal (
+    id NUMBER(19) PRIMARY KEY,
+    change_type VARCHAR2(10) NOT NULL,
+    country_code VARCHAR2(3),
+    subject_dn VARCHAR2(4000),             -- CSCA/LC subject DN (issuer DN of its DSCs), CRL issuer DN
+    subject_key_identifier VARCHAR2(128),  -- CSCA/LC SKI (authority key identifier of its DSCs)
+    created_at TIMESTAMP DEFAULT SYSTIMESTAMP,
+    CONSTRAINT chk_reval_change_type CHECK (change_type IN ('CSCA', 'LC', 'CRL'))
+);
+
+CREATE OR REPLACE TRIGGER trg_reval_change_journal_id
+BEFORE INSERT ON revalidation_change_journal
+FOR EACH ROW
+WHEN (NEW.id IS NULL)
+BEGIN
+    SELECT seq_reval_change_journal.NEXTVAL INTO :NEW.id FROM DUAL;
+END;
+/
+
+CREATE OR REPLACE TRIGGER trg_certificate_reval_journal
+AFTER INSERT ON certificate
+FOR EACH ROW
+WHEN (NEW.certificate_type = 'CSCA')
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn, subject_key_identifier)
+    VALUES (CASE WHEN NVL(:NEW.is_self_signed, 1) = 1 THEN 'CSCA' ELSE 'LC' END,
+            :NEW.country_code, :NEW.subject_dn, :NEW.subject_key_identifier);
+END;
+/
+
+CREATE OR REPLACE TRIGGER trg_crl_reval_journal
+AFTER INSERT ON crl
+FOR EACH ROW
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn)
+    VALUES ('CRL', :NEW.country_code, :NEW.issuer_dn);
+END;
+/
+
 -- =============================================================================
 -- Sync Configuration (daily sync settings)
 -- =============================================================================
@@ -0,0 +1,27 @@
+-- =============================================================================
+-- Database Migration: Certificate search indexes (keyset paging + trigram)
+-- =============================================================================
+-- Date: 2026-10-16
+-- Purpose: GET /api/certificates/search pages on (created_at DESC, id DESC)
+--          with a keyset cursor, and matches searchTerm with
+--          ILIKE '%term%' on subject_dn / serial_number / fingerprint_sha256.
+--          pg_trgm GIN indexes let the planner serve the substring match
+--          (terms of 3+ characters) without a sequential scan.
+-- Supports: PostgreSQL
+-- =============================================================================
+
+CREATE EXTENSION IF NOT EXISTS pg_trgm;
+
+-- Keyset pagination order
+CREATE INDEX IF NOT EXISTS idx_certificate_created_id
+    ON certificate(created_at DESC, id DESC);
+
+-- Substring search
+CREATE INDEX IF NOT EXISTS idx_certificate_subject_dn_trgm
+    ON certificate USING gin (subject_dn gin_trgm_ops);
+CREATE INDEX IF NOT EXISTS idx_certificate_serial_trgm
+    ON certificate USING gin (serial_number gin_trgm_ops);
+CREATE INDEX IF NOT EXISTS idx_certificate_fingerprint_trgm
+    ON certificate USING gin (fingerprint_sha256 gin_trgm_ops);
+
+ANALYZE certificate;
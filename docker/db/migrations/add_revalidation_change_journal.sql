@@ -0,0 +1,54 @@
+-- =============================================================================
+-- Database Migration: Incremental DSC revalidation (change journal)
+-- =============================================================================
+-- Date: 2026-10-16
+-- Purpose: The daily revalidation re-ran the trust chain and CRL check for
+--          every DSC. CSCA, link certificate and CRL inserts are now
+--          journaled by triggers, so a run only revisits DSCs whose issuer or
+--          country CRL changed. A full sweep still runs periodically
+--          (REVALIDATE_FULL_SWEEP_DAYS).
+-- Supports: PostgreSQL
+-- =============================================================================
+
+ALTER TABLE revalidation_history
+    ADD COLUMN IF NOT EXISTS run_mode VARCHAR(12) DEFAULT 'FULL' NOT NULL;
+
+CREATE TABLE IF NOT EXISTS revalidation_change_journal (
+    id BIGSERIAL PRIMARY KEY,
+    change_type VARCHAR(10) NOT NULL,
+    country_code VARCHAR(3),
+    subject_dn TEXT,
+    subject_key_identifier VARCHAR(128),
+    created_at TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+
+    CONSTRAINT chk_reval_change_type CHECK (change_type IN ('CSCA', 'LC', 'CRL'))
+);
+
+CREATE OR REPLACE FUNCTION journal_csca_insert() RETURNS trigger AS $$
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn, subject_key_identifier)
+    VALUES (CASE WHEN COALESCE(NEW.is_self_signed, TRUE) THEN 'CSCA' ELSE 'LC' END,
+            NEW.country_code, NEW.subject_dn, NEW.subject_key_identifier);
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE OR REPLACE FUNCTION journal_crl_insert() RETURNS trigger AS $$
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn)
+    VALUES ('CRL', NEW.country_code, NEW.issuer_dn);
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+DROP TRIGGER IF EXISTS trg_certificate_reval_journal ON certificate;
+CREATE TRIGGER trg_certificate_reval_journal
+    AFTER INSERT ON certificate
+    FOR EACH ROW WHEN (NEW.certificate_type = 'CSCA')
+    EXECUTE FUNCTION journal_csca_insert();
+
+DROP TRIGGER IF EXISTS trg_crl_reval_journal ON crl;
+CREATE TRIGGER trg_crl_reval_journal
+    AFTER INSERT ON crl
+    FOR EACH ROW
+    EXECUTE FUNCTION journal_crl_insert();
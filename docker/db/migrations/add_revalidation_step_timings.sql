@@ -0,0 +1,16 @@
+-- =============================================================================
+-- Database Migration: Parallel revalidation step timings
+-- =============================================================================
+-- Date: 2026-10-16
+-- Purpose: The trust chain and CRL steps of the daily revalidation now run on
+--          a worker pool (REVALIDATE_PARALLELISM). Each history row records
+--          the wall time of every step and the worker count, so throughput
+--          can be compared across runs.
+-- Supports: PostgreSQL
+-- =============================================================================
+
+ALTER TABLE revalidation_history
+    ADD COLUMN IF NOT EXISTS expiry_duration_ms INTEGER DEFAULT 0,
+    ADD COLUMN IF NOT EXISTS tc_duration_ms INTEGER DEFAULT 0,
+    ADD COLUMN IF NOT EXISTS crl_duration_ms INTEGER DEFAULT 0,
+    ADD COLUMN IF NOT EXISTS workers INTEGER DEFAULT 1;
@@ -0,0 +1,33 @@
+-- =============================================================================
+-- Migration: Certificate search indexes (keyset paging + Oracle Text)
+-- Date: 2026-10-16
+-- Description: Oracle counterpart of db/migrations/add_certificate_search_indexes.sql.
+--              pg_trgm has no Oracle equivalent; CONTEXT indexes with a
+--              substring wordlist serve CONTAINS(col, '%term%') instead.
+--              pkd-management uses them when CERT_SEARCH_ORACLE_TEXT=true
+--              (single-word search terms only; other terms keep UPPER() LIKE).
+-- Prerequisite (as SYS):
+--   GRANT CTXAPP TO pkd_user;
+--   GRANT EXECUTE ON CTXSYS.CTX_DDL TO pkd_user;
+-- Supports: Oracle
+-- =============================================================================
+
+-- Keyset pagination order
+CREATE INDEX idx_certificate_created_id ON certificate(created_at DESC, id DESC);
+
+-- Substring-capable wordlist
+BEGIN
+    CTX_DDL.CREATE_PREFERENCE('cert_search_wordlist', 'BASIC_WORDLIST');
+    CTX_DDL.SET_ATTRIBUTE('cert_search_wordlist', 'SUBSTRING_INDEX', 'TRUE');
+END;
+/
+
+CREATE INDEX idx_certificate_subject_dn_ctx ON certificate(subject_dn)
+    INDEXTYPE IS CTXSYS.CONTEXT
+    PARAMETERS ('WORDLIST cert_search_wordlist SYNC (ON COMMIT)');
+CREATE INDEX idx_certificate_serial_ctx ON certificate(serial_number)
+    INDEXTYPE IS CTXSYS.CONTEXT
+    PARAMETERS ('WORDLIST cert_search_wordlist SYNC (ON COMMIT)');
+CREATE INDEX idx_certificate_fingerprint_ctx ON certificate(fingerprint_sha256)
+    INDEXTYPE IS CTXSYS.CONTEXT
+    PARAMETERS ('WORDLIST cert_search_wordlist SYNC (ON COMMIT)');
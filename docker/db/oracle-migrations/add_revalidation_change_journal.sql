@@ -0,0 +1,52 @@
+-- =============================================================================
+-- Migration: Incremental DSC revalidation (change journal)
+-- Date: 2026-10-16
+-- Description: CSCA, link certificate and CRL inserts are journaled by
+--              triggers so the daily revalidation only revisits DSCs whose
+--              issuer or country CRL changed. A full sweep still runs
+--              periodically (REVALIDATE_FULL_SWEEP_DAYS).
+-- Supports: Oracle
+-- =============================================================================
+
+ALTER TABLE revalidation_history ADD (run_mode VARCHAR2(12) DEFAULT 'FULL' NOT NULL);
+
+CREATE SEQUENCE seq_reval_change_journal START WITH 1 INCREMENT BY 1 NOCACHE;
+
+CREATE TABLE revalidation_change_journal (
+    id NUMBER(19) PRIMARY KEY,
+    change_type VARCHAR2(10) NOT NULL,
+    country_code VARCHAR2(3),
+    subject_dn VARCHAR2(4000),
+    subject_key_identifier VARCHAR2(128),
+    created_at TIMESTAMP DEFAULT SYSTIMESTAMP,
+    CONSTRAINT chk_reval_change_type CHECK (change_type IN ('CSCA', 'LC', 'CRL'))
+);
+
+CREATE OR REPLACE TRIGGER trg_reval_change_journal_id
+BEFORE INSERT ON revalidation_change_journal
+FOR EACH ROW
+WHEN (NEW.id IS NULL)
+BEGIN
+    SELECT seq_reval_change_journal.NEXTVAL INTO :NEW.id FROM DUAL;
+END;
+/
+
+CREATE OR REPLACE TRIGGER trg_certificate_reval_journal
+AFTER INSERT ON certificate
+FOR EACH ROW
+WHEN (NEW.certificate_type = 'CSCA')
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn, subject_key_identifier)
+    VALUES (CASE WHEN NVL(:NEW.is_self_signed, 1) = 1 THEN 'CSCA' ELSE 'LC' END,
+            :NEW.country_code, :NEW.subject_dn, :NEW.subject_key_identifier);
+END;
+/
+
+CREATE OR REPLACE TRIGGER trg_crl_reval_journal
+AFTER INSERT ON crl
+FOR EACH ROW
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn)
+    VALUES ('CRL', :NEW.country_code, :NEW.issuer_dn);
+END;
+/
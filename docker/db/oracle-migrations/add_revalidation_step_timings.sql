@@ -0,0 +1,17 @@
+-- =============================================================================
+-- Migration: Parallel revalidation step timings
+-- Date: 2026-10-16
+-- Description: The trust chain and CRL steps of the daily revalidation now run
+--              on a worker pool (REVALIDATE_PARALLELISM). Each history row
+--              records the wall time of every step and the worker count.
+-- Supports: Oracle
+-- =============================================================================
+
+ALTER TABLE revalidation_history ADD (
+    expiry_duration_ms NUMBER(10) DEFAULT 0,
+    tc_duration_ms NUMBER(10) DEFAULT 0,
+    crl_duration_ms NUMBER(10) DEFAULT 0,
+    workers NUMBER(5) DEFAULT 1
+);
+
+COMMIT;
@@ -12,6 +12,7 @@
 -- Enable UUID extension
 -- =============================================================================
 CREATE EXTENSION IF NOT EXISTS "uuid-ossp";
+CREATE EXTENSION IF NOT EXISTS pg_trgm;  -- Certificate substring search
 
 -- =============================================================================
 -- File Upload Tables
@@ -165,6 +166,12 @@ CREATE INDEX idx_certificate_authority_key_identifier ON certificate(authority_k
 CREATE INDEX idx_certificate_stored_created ON certificate(stored_in_ldap, created_at ASC);
 CREATE INDEX idx_certificate_country_type ON certificate(country_code, certificate_type);
 CREATE INDEX idx_certificate_type_created ON certificate(certificate_type, created_at DESC);
+CREATE INDEX idx_certificate_created_id ON certificate(created_at DESC, id DESC);  -- Search keyset paging
+
+-- Substring search (ILIKE '%term%')
+CREATE INDEX idx_certificate_subject_dn_trgm ON certificate USING gin (subject_dn gin_trgm_ops);
+CREATE INDEX idx_certificate_serial_trgm ON certificate USING gin (serial_number gin_trgm_ops);
+CREATE INDEX idx_certificate_fingerprint_trgm ON certificate USING gin (fingerprint_sha256 gin_trgm_ops);
 
 -- =============================================================================
 -- CRL Tables
@@ -192,11 +192,61 @@ CREATE TABLE IF NOT EXISTS revalidation_history (
     crl_revoked INTEGER DEFAULT 0,
     crl_unavailable INTEGER DEFAULT 0,
     crl_expired INTEGER DEFAULT 0,
-    crl_errors INTEGER DEFAULT 0
+    crl_errors INTEGER DEFAULT 0,
+
+    -- FULL (every DSC) or INCREMENTAL (DSCs affected by journaled changes)
+    run_mode VARCHAR(12) DEFAULT 'FULL' NOT NULL,
+
+    -- Per-step wall time and trust chain / CRL worker count
+    expiry_duration_ms INTEGER DEFAULT 0,
+    tc_duration_ms INTEGER DEFAULT 0,
+    crl_duration_ms INTEGER DEFAULT 0,
+    workers INTEGER DEFAULT 1
 );
 
 CREATE INDEX idx_reval_history_executed ON revalidation_history(executed_at DESC);
 
+-- Revalidation change journal: CSCA / link certificate / CRL inserts not yet
+-- covered by a revalidation run. Filled by triggers (every insert path, every
+-- service); rows are deleted by the run that consumed them.
+CREATE TABLE IF NOT EXISTS revalidation_change_journal (
+    id BIGSERIAL PRIMARY KEY,
+    change_type VARCHAR(10) NOT NULL,
+    country_code VARCHAR(3),
+    subject_dn TEXT,                      -- CSCA/LC subject DN (issuer DN of its DSCs), CRL issuer DN
+    subject_key_identifier VARCHAR(128),  -- CSCA/LC SKI (authority key identifier of its DSCs)
+    created_at TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+
+    CONSTRAINT chk_reval_change_type CHECK (change_type IN ('CSCA', 'LC', 'CRL'))
+);
+
+CREATE OR REPLACE FUNCTION journal_csca_insert() RETURNS trigger AS $$
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn, subject_key_identifier)
+    VALUES (CASE WHEN COALESCE(NEW.is_self_signed, TRUE) THEN 'CSCA' ELSE 'LC' END,
+            NEW.country_code, NEW.subject_dn, NEW.subject_key_identifier);
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE OR REPLACE FUNCTION journal_crl_insert() RETURNS trigger AS $$
+BEGIN
+    INSERT INTO revalidation_change_journal (change_type, country_code, subject_dn)
+    VALUES ('CRL', NEW.country_code, NEW.issuer_dn);
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE TRIGGER trg_certificate_reval_journal
+    AFTER INSERT ON certificate
+    FOR EACH ROW WHEN (NEW.certificate_type = 'CSCA')
+    EXECUTE FUNCTION journal_csca_insert();
+
+CREATE TRIGGER trg_crl_reval_journal
+    AFTER INSERT ON crl
+    FOR EACH ROW
+    EXECUTE FUNCTION journal_crl_insert();
+
 -- CRL revocation log (CRL check audit trail)
 CREATE TABLE IF NOT EXISTS crl_revocation_log (
     id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
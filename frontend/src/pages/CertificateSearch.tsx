@@ -50,6 +50,11 @@ const CertificateSearch: React.FC = () => {
   // AbortController ref for cancelling stale search requests
   const searchAbortRef = useRef<AbortController | null>(null);
 
+  // Keyset paging: cursors[k] fetches page k of the current filter (page 0 needs none).
+  // Pages reached by cursor skip the total/stats, which the first page already returned.
+  const pageCursorsRef = useRef<{ filterKey: string; cursors: (string | undefined)[] }>({ filterKey: '', cursors: [] });
+  const [hasMore, setHasMore] = useState(false);
+
   const { sortedData: sortedCerts, sortConfig: certSortConfig, requestSort: requestCertSort } = useSortableTable<Certificate>(certificates);
 
   // UI state
@@ -100,13 +105,28 @@ const CertificateSearch: React.FC = () => {
       if (criteria.source) params.source = criteria.source;
       if (criteria.searchTerm) params.searchTerm = criteria.searchTerm;
 
+      const filterKey = [criteria.country, criteria.certType, criteria.validity, criteria.source, criteria.searchTerm, criteria.limit].join('|');
+      if (pageCursorsRef.current.filterKey !== filterKey) {
+        pageCursorsRef.current = { filterKey, cursors: [] };
+      }
+      const page = Math.floor(criteria.offset / criteria.limit);
+      const cursor = pageCursorsRef.current.cursors[page];
+      if (cursor) {
+        params.cursor = cursor;
+        params.includeTotal = 'false';
+      }
+
       const response = await pkdApi.get('/certificates/search', { params, signal: abortController.signal });
       const data = response.data as Record<string, unknown>;
 
       if (data.success) {
         const certs = data.certificates as Certificate[];
         setCertificates(certs);
-        setTotal(data.total as number);
+        if (typeof data.total === 'number') setTotal(data.total);
+        setHasMore(Boolean(data.hasMore));
+        if (data.nextCursor) {
+          pageCursorsRef.current.cursors[page + 1] = data.nextCursor as string;
+        }
         // Store statistics from backend (if available)
         if (data.stats) {
           setApiStats(data.stats as { total: number; valid: number; expired: number; notYetValid: number; unknown: number });
@@ -178,7 +198,7 @@ const CertificateSearch: React.FC = () => {
   };
 
   const handleNextPage = () => {
-    if (criteria.offset + criteria.limit < total) {
+    if (hasMore) {
       setCriteria({ ...criteria, offset: criteria.offset + criteria.limit });
     }
   };
@@ -491,7 +511,7 @@ const CertificateSearch: React.FC = () => {
             </span>
             <button
               onClick={handleNextPage}
-              disabled={criteria.offset + criteria.limit >= total}
+              disabled={!hasMore}
               className="p-1.5 rounded-lg border border-gray-200 dark:border-gray-600 hover:bg-gray-50 dark:hover:bg-gray-700 disabled:opacity-50 disabled:cursor-not-allowed transition-colors"
               aria-label={t('common:pagination.next')}
             >
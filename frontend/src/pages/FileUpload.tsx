@@ -16,7 +16,7 @@ import {
   FileSearch,
   Database,
 } from 'lucide-react';
-import { uploadApi, createProgressEventSource } from '@/services/api';
+import { uploadApi, createProgressEventSource, applyProgressDelta } from '@/services/api';
 import type { UploadProgress, UploadedFile, ValidationStatistics, CertificateMetadata, IcaoComplianceStatus, ProcessingError } from '@/types';
 import { cn } from '@/utils/cn';
 import { Stepper, type Step, type StepStatus } from '@/components/common/Stepper';
@@ -467,6 +467,8 @@ export function FileUpload() {
     sseRef.current = eventSource;
     let reconnectAttempts = 0;
     const maxReconnectAttempts = 3;
+    // Last full state: "progress-delta" events only carry changed fields
+    let lastProgress: UploadProgress | null = null;
 
     // Handle 'connected' event
     eventSource.addEventListener('connected', () => {
@@ -480,12 +482,33 @@ export function FileUpload() {
       try {
         const data = (event as MessageEvent).data;
         const progress: UploadProgress = JSON.parse(data);
+        lastProgress = progress;
         handleProgressUpdate(progress);
       } catch {
         // Ignore parse errors
       }
     });
 
+    // Handle 'progress-delta' events (changed fields since the previous event)
+    eventSource.addEventListener('progress-delta', (event) => {
+      if (!lastProgress) return;  // A full 'progress' event always comes first
+      try {
+        const delta = JSON.parse((event as MessageEvent).data);
+        lastProgress = applyProgressDelta(lastProgress, delta);
+        handleProgressUpdate(lastProgress);
+      } catch {
+        // Ignore parse errors
+      }
+    });
+
+    // Server ended the stream (finished, cleared or unknown upload): close
+    // without reconnecting; polling reports the final state
+    eventSource.addEventListener('progress-end', () => {
+      eventSource.close();
+      sseRef.current = null;
+      setSseConnected(false);
+    });
+
     // Fallback for unnamed events
     eventSource.onmessage = (event) => {
       try {
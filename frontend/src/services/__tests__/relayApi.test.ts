@@ -53,7 +53,7 @@ vi.mock('axios', () => ({
   },
 }));
 
-import { uploadApi, syncApi, createProgressEventSource, getProgressStatus } from '../relayApi';
+import { uploadApi, syncApi, createProgressEventSource, applyProgressDelta, getProgressStatus } from '../relayApi';
 
 beforeEach(() => {
   vi.clearAllMocks();
@@ -260,6 +260,48 @@ describe('createProgressEventSource', () => {
   });
 });
 
+// ---------------------------------------------------------------------------
+// applyProgressDelta
+// ---------------------------------------------------------------------------
+
+describe('applyProgressDelta', () => {
+  const base = {
+    stage: 'VALIDATION_IN_PROGRESS',
+    processedCount: 10,
+    currentCertificate: { subjectDn: 'CN=DS1,C=KR' },
+    statistics: { validCount: 8, invalidCount: 2, recentValidationLogs: [1, 2, 3] },
+  };
+
+  it('should merge nested objects and keep unchanged fields', () => {
+    const merged = applyProgressDelta(base, { processedCount: 11, statistics: { validCount: 9 } });
+
+    expect(merged.processedCount).toBe(11);
+    expect(merged.stage).toBe('VALIDATION_IN_PROGRESS');
+    expect(merged.statistics).toEqual({ validCount: 9, invalidCount: 2, recentValidationLogs: [1, 2, 3] });
+    expect(base.processedCount).toBe(10);
+  });
+
+  it('should remove keys whose delta value is null', () => {
+    const merged = applyProgressDelta(base, { currentCertificate: null });
+
+    expect('currentCertificate' in merged).toBe(false);
+  });
+
+  it('should append array entries and keep the last $size', () => {
+    const merged = applyProgressDelta(base, {
+      statistics: { recentValidationLogs: { $append: [4, 5], $size: 3 } },
+    });
+
+    expect(merged.statistics.recentValidationLogs).toEqual([3, 4, 5]);
+  });
+
+  it('should replace arrays sent whole', () => {
+    const merged = applyProgressDelta(base, { statistics: { recentValidationLogs: [9] } });
+
+    expect(merged.statistics.recentValidationLogs).toEqual([9]);
+  });
+});
+
 // ---------------------------------------------------------------------------
 // getProgressStatus
 // ---------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 import {
   uploadApi as relayUploadApi,
   createProgressEventSource,
+  applyProgressDelta,
   getProgressStatus,
   syncApi as syncServiceApi,
   type SyncConfigResponse,
@@ -65,6 +66,7 @@ export const uploadApi = {
 // Re-export other APIs
 export {
   createProgressEventSource,
+  applyProgressDelta,
   getProgressStatus,
   syncServiceApi,
   healthApi,
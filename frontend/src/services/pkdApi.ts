@@ -106,12 +106,16 @@ export interface CertificateSearchParams {
   source?: string;         // Certificate source: PA_EXTRACTED, ML_PARSED, FILE_UPLOAD, etc.
   text?: string;           // Search in subject DN or serial number
   limit?: number;
-  offset?: number;
+  offset?: number;         // Ignored when cursor is set
+  cursor?: string;         // nextCursor of the previous page (keyset paging)
+  includeTotal?: boolean;  // false: omit total/stats
 }
 
 export interface CertificateSearchResult {
   success: boolean;
-  total: number;
+  total?: number;          // Omitted when includeTotal=false
+  hasMore?: boolean;
+  nextCursor?: string;
   certificates: Array<{
     dn: string;
     certType: string;
@@ -195,6 +195,13 @@ export const uploadApi = {
  * - VITE_USE_RELAY_SSE=true  → /api/relay/progress/stream/{uploadId}
  * - VITE_USE_RELAY_SSE=false → /api/progress/stream/{uploadId} (default)
  *
+ * SSE events: "progress" carries the full state (on connect and after a
+ * resync), "progress-delta" only the fields changed since the previous event;
+ * merge deltas with applyProgressDelta(). "progress-end" ({uploadId, stage}
+ * or {uploadId, status}) means the server closed the stream for a finished,
+ * cleared or unknown upload: close() and do not reconnect. Idle streams get
+ * a ": heartbeat" comment every SSE_HEARTBEAT_SEC, which EventSource ignores.
+ *
  * SSE Event Flow:
  * 1. connected          → Connection established
  * 2. PARSING_STARTED    → Parsing begins (10%)
@@ -212,9 +219,12 @@ export const uploadApi = {
  * @example
  * const eventSource = createProgressEventSource(uploadId);
  *
+ * let progress: UploadProgress;
  * eventSource.addEventListener('progress', (event) => {
- *   const progress = JSON.parse(event.data);
- *   console.log(progress.stage, progress.percentage);
+ *   progress = JSON.parse(event.data);
+ * });
+ * eventSource.addEventListener('progress-delta', (event) => {
+ *   progress = applyProgressDelta(progress, JSON.parse(event.data));
  * });
  *
  * eventSource.onerror = () => {
@@ -235,6 +245,42 @@ export const createProgressEventSource = (uploadId: string): EventSource => {
   return new EventSource(url);
 };
 
+type JsonObject = Record<string, unknown>;
+
+const isPlainObject = (value: unknown): value is JsonObject =>
+  typeof value === 'object' && value !== null && !Array.isArray(value);
+
+/**
+ * Merge a "progress-delta" SSE event into the last known progress
+ *
+ * Delta format (see pkd-relay ProgressBus):
+ * - objects are merged recursively, a null member removes the key
+ * - {"$append": [...], "$size": n} appends to an array and keeps the last n entries
+ * - any other value replaces the previous one
+ *
+ * @param base - Last full progress state (not modified)
+ * @param delta - Parsed delta event payload
+ * @returns New merged state
+ */
+export const applyProgressDelta = <T extends object>(base: T, delta: JsonObject): T => {
+  const merged = { ...base } as unknown as JsonObject;
+  for (const [key, value] of Object.entries(delta)) {
+    const previous = merged[key];
+    if (value === null) {
+      delete merged[key];
+    } else if (isPlainObject(value) && Array.isArray(value.$append)) {
+      const items = [...(Array.isArray(previous) ? previous : []), ...value.$append];
+      const size = typeof value.$size === 'number' ? value.$size : items.length;
+      merged[key] = items.slice(Math.max(0, items.length - size));
+    } else if (isPlainObject(value) && isPlainObject(previous)) {
+      merged[key] = applyProgressDelta(previous, value);
+    } else {
+      merged[key] = value;
+    }
+  }
+  return merged as unknown as T;
+};
+
 /**
  * Get progress status via polling (alternative to SSE)
  * Used as backup when SSE connection fails
@@ -296,6 +342,14 @@ export interface RevalidationResult {
   crlUnavailable: number;
   crlExpired: number;
   crlErrors: number;
+  // FULL: every DSC; INCREMENTAL: DSCs affected by new CSCA/link cert/CRL
+  mode?: 'FULL' | 'INCREMENTAL';
+  journalEntries?: number;
+  // Per-step wall time; steps 2/3 run on `workers` threads
+  workers?: number;
+  expiryDurationMs?: number;
+  tcDurationMs?: number;
+  crlDurationMs?: number;
 }
 
 export interface RevalidationHistoryItem {
@@ -318,6 +372,14 @@ export interface RevalidationHistoryItem {
   crlUnavailable: number;
   crlExpired: number;
   crlErrors: number;
+  runMode?: 'FULL' | 'INCREMENTAL';
+  // Per-step wall time and throughput (DSCs per second)
+  workers?: number;
+  expiryDurationMs?: number;
+  tcDurationMs?: number;
+  crlDurationMs?: number;
+  tcPerSecond?: number;
+  crlPerSecond?: number;
 }
 
 /**
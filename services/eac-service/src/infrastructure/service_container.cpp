@@ -12,6 +12,7 @@
 
 #include "db_connection_pool_factory.h"
 #include "i_query_executor.h"
+#include "blocking_executor.h"
 #include <spdlog/spdlog.h>
 
 namespace eac::infrastructure {
@@ -27,12 +28,15 @@ struct ServiceContainer::Impl {
     // Phase 3: Services
     std::unique_ptr<services::CvcService> cvcService;
     std::unique_ptr<services::EacChainValidator> chainValidator;
+
+    // Phase 4: Executor for blocking handler work
+    std::unique_ptr<common::BlockingExecutor> blockingExecutor;
 };
 
 ServiceContainer::ServiceContainer() : impl_(std::make_unique<Impl>()) {}
 ServiceContainer::~ServiceContainer() = default;
 
-bool ServiceContainer::initialize(const AppConfig& /*config*/) {
+bool ServiceContainer::initialize(const AppConfig& config) {
     try {
         // Phase 1: Database pool + query executor (reads from environment variables)
         spdlog::info("ServiceContainer Phase 1: Database connection pool");
@@ -66,6 +70,13 @@ bool ServiceContainer::initialize(const AppConfig& /*config*/) {
         impl_->chainValidator = std::make_unique<services::EacChainValidator>(
             impl_->cvcCertRepo.get());
 
+        // Phase 4: Blocking-work executor (BLOCKING_EXECUTOR_* overrides)
+        spdlog::info("ServiceContainer Phase 4: Blocking-work executor");
+        common::BlockingExecutor::Config executorDefaults;
+        executorDefaults.workers = static_cast<size_t>(config.threadNum) * 4;
+        impl_->blockingExecutor = std::make_unique<common::BlockingExecutor>(
+            common::BlockingExecutor::Config::fromEnvironment(executorDefaults));
+
         spdlog::info("ServiceContainer initialization complete");
         return true;
 
@@ -77,6 +88,8 @@ bool ServiceContainer::initialize(const AppConfig& /*config*/) {
 
 void ServiceContainer::shutdown() {
     spdlog::info("ServiceContainer shutting down");
+    // Finish in-flight handler work while the services it calls still exist
+    if (impl_->blockingExecutor) impl_->blockingExecutor->shutdown();
     impl_->chainValidator.reset();
     impl_->cvcService.reset();
     impl_->cvcCertRepo.reset();
@@ -86,6 +99,7 @@ void ServiceContainer::shutdown() {
 
 common::IDbConnectionPool* ServiceContainer::dbPool() const { return impl_->dbPool.get(); }
 common::IQueryExecutor* ServiceContainer::queryExecutor() const { return impl_->queryExecutor.get(); }
+common::BlockingExecutor* ServiceContainer::blockingExecutor() const { return impl_->blockingExecutor.get(); }
 repositories::CvcCertificateRepository* ServiceContainer::cvcCertificateRepository() const { return impl_->cvcCertRepo.get(); }
 services::CvcService* ServiceContainer::cvcService() const { return impl_->cvcService.get(); }
 services::EacChainValidator* ServiceContainer::eacChainValidator() const { return impl_->chainValidator.get(); }
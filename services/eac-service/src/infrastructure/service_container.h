@@ -14,6 +14,7 @@ struct AppConfig;
 namespace common {
 class IDbConnectionPool;
 class IQueryExecutor;
+class BlockingExecutor;
 }
 
 namespace eac::repositories {
@@ -41,6 +42,7 @@ public:
     // Accessors
     common::IDbConnectionPool* dbPool() const;
     common::IQueryExecutor* queryExecutor() const;
+    common::BlockingExecutor* blockingExecutor() const;  ///< DB work off the event loops
 
     repositories::CvcCertificateRepository* cvcCertificateRepository() const;
 
@@ -18,6 +18,7 @@
 #include "handlers/eac_upload_handler.h"
 #include "handlers/eac_certificate_handler.h"
 #include "handlers/eac_statistics_handler.h"
+#include "blocking_offload.h"
 
 using namespace drogon;
 
@@ -54,7 +55,8 @@ static void registerRoutes(
     HttpAppFramework& app,
     eac::handlers::EacUploadHandler& uploadHandler,
     eac::handlers::EacCertificateHandler& certHandler,
-    eac::handlers::EacStatisticsHandler& statsHandler) {
+    eac::handlers::EacStatisticsHandler& statsHandler,
+    common::BlockingExecutor* executor) {
 
     // Health
     app.registerHandler(
@@ -67,67 +69,88 @@ static void registerRoutes(
         },
         {Get});
 
+    // Internal metrics (blocking executor queue/wait/rejections)
+    app.registerHandler(
+        "/internal/metrics",
+        [executor](const HttpRequestPtr&, std::function<void(const HttpResponsePtr&)>&& callback) {
+            Json::Value result;
+            result["service"] = "eac-service";
+            if (executor) {
+                result["blockingExecutor"] = common::handler::blockingExecutorMetrics(*executor);
+            }
+            callback(HttpResponse::newHttpJsonResponse(result));
+        },
+        {Get});
+
     // Upload
     app.registerHandler(
         "/api/eac/upload",
-        [&uploadHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
-            uploadHandler.handleUpload(req, std::move(cb));
+        [&uploadHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
+            common::handler::runBlocking(executor, "eac.upload", std::move(cb),
+                [&uploadHandler, req](common::handler::ResponseCallback done) { uploadHandler.handleUpload(req, std::move(done)); });
         },
         {Post});
 
     app.registerHandler(
         "/api/eac/upload/preview",
-        [&uploadHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
-            uploadHandler.handlePreview(req, std::move(cb));
+        [&uploadHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
+            common::handler::runBlocking(executor, "eac.upload", std::move(cb),
+                [&uploadHandler, req](common::handler::ResponseCallback done) { uploadHandler.handlePreview(req, std::move(done)); });
         },
         {Post});
 
     // Certificate search & detail
     app.registerHandler(
         "/api/eac/certificates",
-        [&certHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
-            certHandler.handleSearch(req, std::move(cb));
+        [&certHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
+            common::handler::runBlocking(executor, "eac.certificates", std::move(cb),
+                [&certHandler, req](common::handler::ResponseCallback done) { certHandler.handleSearch(req, std::move(done)); });
         },
         {Get});
 
     app.registerHandler(
         "/api/eac/certificates/{id}",
-        [&certHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb,
+        [&certHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb,
                         const std::string& id) {
-            certHandler.handleDetail(req, std::move(cb), id);
+            common::handler::runBlocking(executor, "eac.certificates", std::move(cb),
+                [&certHandler, req, id](common::handler::ResponseCallback done) { certHandler.handleDetail(req, std::move(done), id); });
         },
         {Get});
 
     // Delete
     app.registerHandler(
         "/api/eac/certificates/{id}",
-        [&certHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb,
+        [&certHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb,
                         const std::string& id) {
-            certHandler.handleDelete(req, std::move(cb), id);
+            common::handler::runBlocking(executor, "eac.certificates", std::move(cb),
+                [&certHandler, req, id](common::handler::ResponseCallback done) { certHandler.handleDelete(req, std::move(done), id); });
         },
         {Delete});
 
     // Trust chain
     app.registerHandler(
         "/api/eac/certificates/{id}/chain",
-        [&certHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb,
+        [&certHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb,
                         const std::string& id) {
-            certHandler.handleChain(req, std::move(cb), id);
+            common::handler::runBlocking(executor, "eac.chain", std::move(cb),
+                [&certHandler, req, id](common::handler::ResponseCallback done) { certHandler.handleChain(req, std::move(done), id); });
         },
         {Get});
 
     // Statistics & countries
     app.registerHandler(
         "/api/eac/statistics",
-        [&statsHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
-            statsHandler.handleStatistics(req, std::move(cb));
+        [&statsHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
+            common::handler::runBlocking(executor, "eac.statistics", std::move(cb),
+                [&statsHandler, req](common::handler::ResponseCallback done) { statsHandler.handleStatistics(req, std::move(done)); });
         },
         {Get});
 
     app.registerHandler(
         "/api/eac/countries",
-        [&statsHandler](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
-            statsHandler.handleCountries(req, std::move(cb));
+        [&statsHandler, executor](const HttpRequestPtr& req, std::function<void(const HttpResponsePtr&)>&& cb) {
+            common::handler::runBlocking(executor, "eac.statistics", std::move(cb),
+                [&statsHandler, req](common::handler::ResponseCallback done) { statsHandler.handleCountries(req, std::move(done)); });
         },
         {Get});
 }
@@ -157,7 +180,7 @@ int main() {
     eac::handlers::EacStatisticsHandler statsHandler(&services);
 
     // Register routes
-    registerRoutes(app(), uploadHandler, certHandler, statsHandler);
+    registerRoutes(app(), uploadHandler, certHandler, statsHandler, services.blockingExecutor());
 
     // CORS
     app().registerPostHandlingAdvice([](const HttpRequestPtr&, const HttpResponsePtr& resp) {
@@ -4,12 +4,14 @@
  */
 
 #include "ldap_crl_provider.h"
+#include "../services/trust_snapshot_service.h"
 #include <stdexcept>
 
 namespace adapters {
 
-LdapCrlProvider::LdapCrlProvider(repositories::LdapCrlRepository* crlRepo)
-    : crlRepo_(crlRepo)
+LdapCrlProvider::LdapCrlProvider(repositories::LdapCrlRepository* crlRepo,
+                                 services::TrustSnapshotService* trustSnapshots)
+    : crlRepo_(crlRepo), trustSnapshots_(trustSnapshots)
 {
     if (!crlRepo_) {
         throw std::invalid_argument("LdapCrlProvider: crlRepo cannot be nullptr");
@@ -17,6 +19,13 @@ LdapCrlProvider::LdapCrlProvider(repositories::LdapCrlRepository* crlRepo)
 }
 
 X509_CRL* LdapCrlProvider::findCrlByCountry(const std::string& countryCode) {
+    if (trustSnapshots_) {
+        if (auto snapshot = trustSnapshots_->current()) {
+            if (X509_CRL* crl = snapshot->copyCrl(countryCode)) {
+                return crl;
+            }
+        }
+    }
     return crlRepo_->findCrlByCountry(countryCode);
 }
 
@@ -2,7 +2,9 @@
  * @file ldap_crl_provider.h
  * @brief ICrlProvider adapter for LDAP-backed CRL lookup
  *
- * Bridges icao::validation::ICrlProvider to LdapCrlRepository.
+ * Bridges icao::validation::ICrlProvider to LdapCrlRepository. When a trust
+ * snapshot is available, CRLs are served from it and LDAP is only searched for
+ * countries the snapshot has no CRL for.
  */
 
 #pragma once
@@ -10,16 +12,26 @@
 #include <icao/validation/providers.h>
 #include "../repositories/ldap_crl_repository.h"
 
+namespace services {
+    class TrustSnapshotService;
+}
+
 namespace adapters {
 
 class LdapCrlProvider : public icao::validation::ICrlProvider {
 public:
-    explicit LdapCrlProvider(repositories::LdapCrlRepository* crlRepo);
+    /**
+     * @param crlRepo LDAP CRL repository
+     * @param trustSnapshots Optional in-memory snapshot (LDAP fallback on miss)
+     */
+    explicit LdapCrlProvider(repositories::LdapCrlRepository* crlRepo,
+                             services::TrustSnapshotService* trustSnapshots = nullptr);
 
     X509_CRL* findCrlByCountry(const std::string& countryCode) override;
 
 private:
     repositories::LdapCrlRepository* crlRepo_;
+    services::TrustSnapshotService* trustSnapshots_;
 };
 
 } // namespace adapters
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <icao/validation/providers.h>
+#include <icao/validation/csca_trust_store.h>
 #include "../repositories/ldap_certificate_repository.h"
 
 namespace adapters {
@@ -19,8 +20,28 @@ public:
     std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override;
     X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode) override;
 
+    /**
+     * @brief Pre-parsed CSCA snapshot, if one has been published
+     *
+     * nullptr until publishTrustStore() is called; TrustChainBuilder then falls
+     * back to the per-lookup LDAP search above.
+     */
+    std::shared_ptr<const icao::validation::CscaTrustStore> trustStore() override {
+        return store_.load();
+    }
+
+    /**
+     * @brief Serve trust chain lookups from an in-memory CSCA snapshot
+     * @param store Snapshot to publish (nullptr reverts to LDAP lookups)
+     */
+    void publishTrustStore(std::shared_ptr<const icao::validation::CscaTrustStore> store) {
+        store_.publish(std::move(store));
+    }
+
 private:
     repositories::LdapCertificateRepository* certRepo_;
+
+    icao::validation::CscaTrustStoreHolder store_;  ///< Published CSCA snapshot (optional)
 };
 
 } // namespace adapters
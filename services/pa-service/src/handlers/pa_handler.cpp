@@ -8,11 +8,13 @@
 #include <spdlog/spdlog.h>
 #include <json/json.h>
 #include "handler_utils.h"
+#include "blocking_offload.h"
 
 #include <openssl/bio.h>
 #include <openssl/evp.h>
 
 #include <algorithm>
+#include <memory>
 #include <regex>
 #include <sstream>
 
@@ -48,6 +50,146 @@ std::vector<uint8_t> PaHandler::base64Decode(const std::string& encoded) {
     return decoded;
 }
 
+bool PaHandler::parseVerifyRequest(
+    const Json::Value& body,
+    services::PaVerificationRequest& request,
+    std::string& error) {
+
+    // Get SOD data (Base64 encoded)
+    std::string sodBase64 = body.isMember("sod") ? body["sod"].asString() : "";
+    if (sodBase64.empty()) {
+        error = "SOD data is required";
+        return false;
+    }
+
+    // Decode SOD
+    request.sodData = base64Decode(sodBase64);
+    if (request.sodData.empty()) {
+        error = "Failed to decode SOD (invalid Base64)";
+        return false;
+    }
+
+    // Parse Data Groups (convert to map with string keys)
+    auto& dataGroups = request.dataGroups;
+    if (body.isMember("dataGroups")) {
+        if (body["dataGroups"].isArray()) {
+            // Array format: [{number: "DG1", data: "base64..."}, ...]
+            for (const auto& dg : body["dataGroups"]) {
+                if (!dg.isMember("number") || !dg.isMember("data")) {
+                    spdlog::warn("Skipping DG entry missing 'number' or 'data' field");
+                    continue;
+                }
+                std::string dgNumStr = dg["number"].asString();
+                std::string dgData = dg["data"].asString();
+                if (dgData.empty()) continue;
+                // Extract number from "DG1" -> "1"
+                std::string dgKey = dgNumStr.length() > 2 ? dgNumStr.substr(2) : dgNumStr;
+                auto decoded = base64Decode(dgData);
+                if (decoded.empty()) {
+                    spdlog::warn("Base64 decode failed for DG {}", dgKey);
+                    continue;
+                }
+                dataGroups[dgKey] = std::move(decoded);
+            }
+        } else if (body["dataGroups"].isObject()) {
+            // Object format: {"DG1": "base64...", "DG2": "base64..."} OR {"1": "base64...", "2": "base64..."}
+            for (const auto& key : body["dataGroups"].getMemberNames()) {
+                std::string dgKey;
+                // Support both "DG1" format and "1" format
+                if (key.length() > 2 && (key.substr(0, 2) == "DG" || key.substr(0, 2) == "dg")) {
+                    dgKey = key.substr(2);  // "DG1" -> "1"
+                } else {
+                    dgKey = key;  // "1" -> "1"
+                }
+                std::string dgData = body["dataGroups"][key].asString();
+                dataGroups[dgKey] = base64Decode(dgData);
+            }
+        }
+    }
+
+    // Get optional fields
+    std::string& countryCode = request.countryCode;
+    countryCode = body.get("issuingCountry", "").asString();
+    // Normalize alpha-3 country codes (e.g., KOR->KR) for LDAP compatibility
+    if (!countryCode.empty()) {
+        std::string normalized = common::normalizeCountryCodeToAlpha2(countryCode);
+        if (normalized != countryCode) {
+            spdlog::info("Country code normalized: {} -> {}", countryCode, normalized);
+        }
+        countryCode = normalized;
+    }
+    std::string& documentNumber = request.documentNumber;
+    documentNumber = body.get("documentNumber", "").asString();
+
+    // Extract documentNumber and countryCode from DG1 MRZ if not provided
+    if ((documentNumber.empty() || countryCode.empty()) && dataGroups.count("1") > 0) {
+        const auto& dg1Data = dataGroups["1"];
+        // Simple extraction: find MRZ in DG1 and extract document number + country
+        // This is a simplified version - full parsing is in icao::DgParser
+        size_t pos = 0;
+        while (pos + 3 < dg1Data.size()) {
+            if (dg1Data[pos] == 0x5F && dg1Data[pos + 1] == 0x1F) {
+                // Found MRZ tag 5F1F
+                pos += 2;
+                size_t mrzLen = dg1Data[pos++];
+                if (mrzLen > 127) {
+                    size_t numBytes = mrzLen & 0x7F;
+                    mrzLen = 0;
+                    for (size_t i = 0; i < numBytes && pos < dg1Data.size(); i++) {
+                        mrzLen = (mrzLen << 8) | dg1Data[pos++];
+                    }
+                }
+                if (pos + mrzLen <= dg1Data.size() && mrzLen >= 88) {
+                    std::string mrzData(dg1Data.begin() + pos, dg1Data.begin() + pos + mrzLen);
+                    // TD3 format (2 lines x 44 chars)
+                    if (mrzData.length() >= 88) {
+                        // Document number: line2[0:9]
+                        if (documentNumber.empty()) {
+                            std::string docNum = mrzData.substr(44, 9);
+                            docNum.erase(std::remove(docNum.begin(), docNum.end(), '<'), docNum.end());
+                            documentNumber = docNum;
+                            spdlog::debug("Extracted document number from DG1: {}", documentNumber);
+                        }
+                        // Issuing country: line1[2:5] (3-letter alpha-3)
+                        if (countryCode.empty()) {
+                            std::string mrzCountry = mrzData.substr(2, 3);
+                            mrzCountry.erase(std::remove(mrzCountry.begin(), mrzCountry.end(), '<'), mrzCountry.end());
+                            if (!mrzCountry.empty()) {
+                                countryCode = common::normalizeCountryCodeToAlpha2(mrzCountry);
+                                spdlog::info("Extracted country code from DG1 MRZ: {} -> {}", mrzCountry, countryCode);
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            pos++;
+        }
+    }
+
+    request.requestedBy = body.get("requestedBy", "").asString();
+    return true;
+}
+
+std::string PaHandler::clientIpOf(const drogon::HttpRequestPtr& req) {
+    // Prefer X-Real-IP from reverse proxy
+    std::string clientIp = req->getHeader("X-Real-IP");
+    if (clientIp.empty()) {
+        clientIp = req->getHeader("X-Forwarded-For");
+        if (!clientIp.empty()) {
+            // X-Forwarded-For may contain "client, proxy1, proxy2" — use first
+            auto commaPos = clientIp.find(',');
+            if (commaPos != std::string::npos) {
+                clientIp = clientIp.substr(0, commaPos);
+            }
+        }
+    }
+    if (clientIp.empty()) {
+        clientIp = req->getPeerAddr().toIp();
+    }
+    return clientIp;
+}
+
 // --- Constructor ---
 
 PaHandler::PaHandler(
@@ -57,22 +199,27 @@ PaHandler::PaHandler(
     icao::DgParser* dataGroupParserService,
     common::IQueryExecutor* queryExecutor,
     services::TrustMaterialService* trustMaterialService,
-    repositories::TrustMaterialRequestRepository* trustMaterialRequestRepo)
+    repositories::TrustMaterialRequestRepository* trustMaterialRequestRepo,
+    size_t batchMaxDocuments,
+    common::BlockingExecutor* executor)
     : paVerificationService_(paVerificationService),
       dataGroupRepository_(dataGroupRepository),
       sodParserService_(sodParserService),
       dataGroupParserService_(dataGroupParserService),
       queryExecutor_(queryExecutor),
       trustMaterialService_(trustMaterialService),
-      trustMaterialRequestRepo_(trustMaterialRequestRepo) {
+      trustMaterialRequestRepo_(trustMaterialRequestRepo),
+      batchMaxDocuments_(batchMaxDocuments),
+      executor_(executor) {
 
     if (!paVerificationService_ || !dataGroupRepository_ ||
         !sodParserService_ || !dataGroupParserService_) {
         throw std::invalid_argument("PaHandler: service/repository pointers cannot be nullptr");
     }
 
-    spdlog::info("[PaHandler] Initialized with Service Pattern (trustMaterials={})",
-        trustMaterialService_ ? "enabled" : "disabled");
+    spdlog::info("[PaHandler] Initialized with Service Pattern (trustMaterials={}, blockingExecutor={})",
+        trustMaterialService_ ? "enabled" : "disabled",
+        executor_ ? "enabled" : "disabled");
 }
 
 // --- Route Registration ---
@@ -83,7 +230,21 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/verify",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleVerify(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.verify", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleVerify(req, std::move(cb)); });
+        },
+        {drogon::Post}
+    );
+
+    // POST /api/pa/verify/batch
+    app.registerHandler(
+        "/api/pa/verify/batch",
+        [this](const drogon::HttpRequestPtr& req,
+               std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
+            // Body parsing (up to PA_BATCH_MAX_DOCUMENTS) runs on the executor;
+            // verification then continues on the PA worker pool
+            common::handler::runBlocking(executor_, "pa.verify-batch", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleVerifyBatch(req, std::move(cb)); });
         },
         {drogon::Post}
     );
@@ -93,7 +254,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/trust-materials",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleTrustMaterials(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.trust-materials", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleTrustMaterials(req, std::move(cb)); });
         },
         {drogon::Post}
     );
@@ -103,7 +265,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/trust-materials/result",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleTrustMaterialResult(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.trust-materials.result", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleTrustMaterialResult(req, std::move(cb)); });
         },
         {drogon::Post}
     );
@@ -113,7 +276,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/trust-materials/history",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleTrustMaterialHistory(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.trust-materials.history", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleTrustMaterialHistory(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -123,7 +287,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/combined-statistics",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleCombinedStatistics(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.statistics", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleCombinedStatistics(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -133,7 +298,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/history",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleHistory(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.history", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleHistory(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -144,7 +310,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handleDetail(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "pa.detail", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handleDetail(req, std::move(cb), id); });
         },
         {drogon::Get}
     );
@@ -154,7 +321,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/pa/statistics",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleStatistics(req, std::move(callback));
+            common::handler::runBlocking(executor_, "pa.statistics", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleStatistics(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -205,7 +373,8 @@ void PaHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handleDataGroups(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "pa.detail", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handleDataGroups(req, std::move(cb), id); });
         },
         {drogon::Get}
     );
@@ -244,162 +413,33 @@ void PaHandler::handleVerify(
             return;
         }
 
-        // Get SOD data (Base64 encoded)
-        if (!jsonBody->isMember("sod")) {
-            callback(common::handler::badRequest("SOD data is required"));
-            return;
-        }
-        std::string sodBase64 = (*jsonBody)["sod"].asString();
-        if (sodBase64.empty()) {
-            Json::Value error;
-            error["success"] = false;
-            error["error"] = "SOD data is required";
-            auto resp = drogon::HttpResponse::newHttpJsonResponse(error);
-            resp->setStatusCode(drogon::k400BadRequest);
-            callback(resp);
-            return;
-        }
-
-        // Decode SOD
-        std::vector<uint8_t> sodBytes = base64Decode(sodBase64);
-        if (sodBytes.empty()) {
-            Json::Value error;
-            error["success"] = false;
-            error["error"] = "Failed to decode SOD (invalid Base64)";
-            auto resp = drogon::HttpResponse::newHttpJsonResponse(error);
-            resp->setStatusCode(drogon::k400BadRequest);
-            callback(resp);
+        services::PaVerificationRequest request;
+        std::string parseError;
+        if (!parseVerifyRequest(*jsonBody, request, parseError)) {
+            callback(common::handler::badRequest(parseError));
             return;
         }
-
-        // Parse Data Groups (convert to map with string keys)
-        std::map<std::string, std::vector<uint8_t>> dataGroups;
-        if (jsonBody->isMember("dataGroups")) {
-            if ((*jsonBody)["dataGroups"].isArray()) {
-                // Array format: [{number: "DG1", data: "base64..."}, ...]
-                for (const auto& dg : (*jsonBody)["dataGroups"]) {
-                    if (!dg.isMember("number") || !dg.isMember("data")) {
-                        spdlog::warn("Skipping DG entry missing 'number' or 'data' field");
-                        continue;
-                    }
-                    std::string dgNumStr = dg["number"].asString();
-                    std::string dgData = dg["data"].asString();
-                    if (dgData.empty()) continue;
-                    // Extract number from "DG1" -> "1"
-                    std::string dgKey = dgNumStr.length() > 2 ? dgNumStr.substr(2) : dgNumStr;
-                    auto decoded = base64Decode(dgData);
-                    if (decoded.empty()) {
-                        spdlog::warn("Base64 decode failed for DG {}", dgKey);
-                        continue;
-                    }
-                    dataGroups[dgKey] = std::move(decoded);
-                }
-            } else if ((*jsonBody)["dataGroups"].isObject()) {
-                // Object format: {"DG1": "base64...", "DG2": "base64..."} OR {"1": "base64...", "2": "base64..."}
-                for (const auto& key : (*jsonBody)["dataGroups"].getMemberNames()) {
-                    std::string dgKey;
-                    // Support both "DG1" format and "1" format
-                    if (key.length() > 2 && (key.substr(0, 2) == "DG" || key.substr(0, 2) == "dg")) {
-                        dgKey = key.substr(2);  // "DG1" -> "1"
-                    } else {
-                        dgKey = key;  // "1" -> "1"
-                    }
-                    std::string dgData = (*jsonBody)["dataGroups"][key].asString();
-                    dataGroups[dgKey] = base64Decode(dgData);
-                }
-            }
-        }
-
-        // Get optional fields
-        std::string countryCode = (*jsonBody).get("issuingCountry", "").asString();
-        // Normalize alpha-3 country codes (e.g., KOR->KR) for LDAP compatibility
-        if (!countryCode.empty()) {
-            std::string normalized = common::normalizeCountryCodeToAlpha2(countryCode);
-            if (normalized != countryCode) {
-                spdlog::info("Country code normalized: {} -> {}", countryCode, normalized);
-            }
-            countryCode = normalized;
-        }
-        std::string documentNumber = (*jsonBody).get("documentNumber", "").asString();
-
-        // Extract documentNumber and countryCode from DG1 MRZ if not provided
-        if ((documentNumber.empty() || countryCode.empty()) && dataGroups.count("1") > 0) {
-            const auto& dg1Data = dataGroups["1"];
-            // Simple extraction: find MRZ in DG1 and extract document number + country
-            // This is a simplified version - full parsing is in icao::DgParser
-            size_t pos = 0;
-            while (pos + 3 < dg1Data.size()) {
-                if (dg1Data[pos] == 0x5F && dg1Data[pos + 1] == 0x1F) {
-                    // Found MRZ tag 5F1F
-                    pos += 2;
-                    size_t mrzLen = dg1Data[pos++];
-                    if (mrzLen > 127) {
-                        size_t numBytes = mrzLen & 0x7F;
-                        mrzLen = 0;
-                        for (size_t i = 0; i < numBytes && pos < dg1Data.size(); i++) {
-                            mrzLen = (mrzLen << 8) | dg1Data[pos++];
-                        }
-                    }
-                    if (pos + mrzLen <= dg1Data.size() && mrzLen >= 88) {
-                        std::string mrzData(dg1Data.begin() + pos, dg1Data.begin() + pos + mrzLen);
-                        // TD3 format (2 lines x 44 chars)
-                        if (mrzData.length() >= 88) {
-                            // Document number: line2[0:9]
-                            if (documentNumber.empty()) {
-                                std::string docNum = mrzData.substr(44, 9);
-                                docNum.erase(std::remove(docNum.begin(), docNum.end(), '<'), docNum.end());
-                                documentNumber = docNum;
-                                spdlog::debug("Extracted document number from DG1: {}", documentNumber);
-                            }
-                            // Issuing country: line1[2:5] (3-letter alpha-3)
-                            if (countryCode.empty()) {
-                                std::string mrzCountry = mrzData.substr(2, 3);
-                                mrzCountry.erase(std::remove(mrzCountry.begin(), mrzCountry.end(), '<'), mrzCountry.end());
-                                if (!mrzCountry.empty()) {
-                                    countryCode = common::normalizeCountryCodeToAlpha2(mrzCountry);
-                                    spdlog::info("Extracted country code from DG1 MRZ: {} -> {}", mrzCountry, countryCode);
-                                }
-                            }
-                        }
-                    }
-                    break;
-                }
-                pos++;
-            }
-        }
+        const std::string& countryCode = request.countryCode;
+        const std::string& documentNumber = request.documentNumber;
 
         spdlog::info("PA verification request: country={}, documentNumber={}, dataGroups={}",
                     countryCode.empty() ? "(unknown)" : countryCode,
                     documentNumber.empty() ? "(unknown)" : documentNumber,
-                    dataGroups.size());
+                    request.dataGroups.size());
 
-        // Extract client metadata for audit (prefer X-Real-IP from reverse proxy)
-        std::string clientIp = req->getHeader("X-Real-IP");
-        if (clientIp.empty()) {
-            clientIp = req->getHeader("X-Forwarded-For");
-            if (!clientIp.empty()) {
-                // X-Forwarded-For may contain "client, proxy1, proxy2" — use first
-                auto commaPos = clientIp.find(',');
-                if (commaPos != std::string::npos) {
-                    clientIp = clientIp.substr(0, commaPos);
-                }
-            }
-        }
-        if (clientIp.empty()) {
-            clientIp = req->getPeerAddr().toIp();
-        }
-        std::string userAgent = req->getHeader("User-Agent");
-        std::string requestedBy = (*jsonBody).get("requestedBy", "").asString();
+        // Extract client metadata for audit
+        request.clientIp = clientIpOf(req);
+        request.userAgent = req->getHeader("User-Agent");
 
         // Call service layer - this replaces ~400 lines of complex logic
         Json::Value result = paVerificationService_->verifyPassiveAuthentication(
-            sodBytes,
-            dataGroups,
-            documentNumber,
-            countryCode,
-            clientIp,
-            userAgent,
-            requestedBy
+            request.sodData,
+            request.dataGroups,
+            request.documentNumber,
+            request.countryCode,
+            request.clientIp,
+            request.userAgent,
+            request.requestedBy
         );
 
         // Return response
@@ -435,6 +475,154 @@ void PaHandler::handleVerify(
     }
 }
 
+void PaHandler::handleVerifyBatch(
+    const drogon::HttpRequestPtr& req,
+    std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
+
+    spdlog::info("POST /api/pa/verify/batch - Batch Passive Authentication verification");
+
+    try {
+        // Parse documents: JSON array, {"documents": [...]} or NDJSON (one document per line)
+        bool ndjson = req->getHeader("Content-Type").find("ndjson") != std::string::npos;
+        std::vector<Json::Value> documents;
+        if (ndjson) {
+            Json::CharReaderBuilder builder;
+            std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+            std::istringstream lines{std::string(req->body())};
+            std::string line;
+            while (std::getline(lines, line)) {
+                if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+                Json::Value doc;
+                std::string errs;
+                if (!reader->parse(line.data(), line.data() + line.size(), &doc, &errs)) {
+                    doc = Json::nullValue;  // Reported per document below
+                }
+                documents.push_back(std::move(doc));
+            }
+        } else {
+            auto jsonBody = req->getJsonObject();
+            const Json::Value* docs = nullptr;
+            if (jsonBody && jsonBody->isArray()) {
+                docs = jsonBody.get();
+            } else if (jsonBody && jsonBody->isObject() && (*jsonBody)["documents"].isArray()) {
+                docs = &(*jsonBody)["documents"];
+            }
+            if (!docs) {
+                callback(common::handler::badRequest("Request body must be a JSON array of documents or NDJSON"));
+                return;
+            }
+            for (const auto& doc : *docs) documents.push_back(doc);
+        }
+
+        if (documents.empty()) {
+            callback(common::handler::badRequest("At least one document is required"));
+            return;
+        }
+        if (documents.size() > batchMaxDocuments_) {
+            callback(common::handler::badRequest(
+                "Too many documents (max " + std::to_string(batchMaxDocuments_) + ")"));
+            return;
+        }
+
+        // Per-document parse errors become error results; the rest go to the service
+        std::string clientIp = clientIpOf(req);
+        std::string userAgent = req->getHeader("User-Agent");
+        auto results = std::make_shared<std::vector<Json::Value>>(documents.size());
+        std::vector<services::PaVerificationRequest> requests;
+        std::vector<size_t> requestIndex;
+        for (size_t i = 0; i < documents.size(); i++) {
+            const Json::Value& doc = documents[i];
+            std::string id = doc.isObject() ? doc.get("id", "").asString() : "";
+
+            services::PaVerificationRequest request;
+            std::string parseError = "Invalid JSON document";
+            if (!doc.isObject() || !parseVerifyRequest(doc, request, parseError)) {
+                Json::Value error;
+                error["success"] = false;
+                error["error"] = parseError;
+                (*results)[i] = error;
+            } else {
+                request.id = id;
+                request.clientIp = clientIp;
+                request.userAgent = userAgent;
+                requests.push_back(std::move(request));
+                requestIndex.push_back(i);
+            }
+            (*results)[i]["index"] = static_cast<Json::UInt64>(i);
+            if (!id.empty()) (*results)[i]["id"] = id;
+        }
+
+        spdlog::info("PA batch request: {} documents ({} rejected at parse)",
+                     documents.size(), documents.size() - requests.size());
+
+        auto auditEntry = icao::audit::createAuditEntryFromRequest(req, icao::audit::OperationType::PA_VERIFY);
+        auto respond = [this, results, ndjson, auditEntry, callback = std::move(callback)]() mutable {
+            int valid = 0;
+            int invalid = 0;
+            for (const auto& r : *results) {
+                if (r["success"].asBool() && r["data"]["status"].asString() == "VALID") valid++;
+                else invalid++;
+            }
+
+            drogon::HttpResponsePtr resp;
+            if (ndjson) {
+                Json::StreamWriterBuilder writer;
+                writer["indentation"] = "";
+                std::string body;
+                for (const auto& r : *results) {
+                    body += Json::writeString(writer, r);
+                    body += '\n';
+                }
+                resp = drogon::HttpResponse::newHttpResponse();
+                resp->setContentTypeString("application/x-ndjson");
+                resp->setBody(std::move(body));
+            } else {
+                Json::Value payload;
+                payload["success"] = true;
+                payload["count"] = static_cast<Json::UInt64>(results->size());
+                payload["results"] = Json::arrayValue;
+                for (auto& r : *results) payload["results"].append(std::move(r));
+                resp = drogon::HttpResponse::newHttpJsonResponse(payload);
+            }
+            callback(resp);
+
+            // Audit log (one entry per batch)
+            auditEntry.success = true;
+            auditEntry.resourceType = "PA_VERIFICATION_BATCH";
+            Json::Value auditMeta;
+            auditMeta["count"] = static_cast<Json::UInt64>(results->size());
+            auditMeta["valid"] = valid;
+            auditMeta["invalid"] = invalid;
+            auditEntry.metadata = auditMeta;
+            try { icao::audit::logOperation(queryExecutor_, auditEntry); } catch (const std::exception& ex) { spdlog::warn("Audit log failed: {}", ex.what()); }
+        };
+
+        if (requests.empty()) {
+            respond();
+            return;
+        }
+
+        // Verified on the PA worker pool; the completion runs on the last worker
+        paVerificationService_->verifyPassiveAuthenticationBatch(
+            std::move(requests),
+            [results, requestIndex = std::move(requestIndex), respond = std::move(respond)](
+                std::vector<Json::Value> verified) mutable {
+                for (size_t k = 0; k < verified.size(); k++) {
+                    Json::Value& slot = (*results)[requestIndex[k]];
+                    Json::Value index = slot["index"];
+                    Json::Value id = slot.get("id", Json::nullValue);
+                    slot = std::move(verified[k]);
+                    slot["index"] = index;
+                    if (!id.isNull()) slot["id"] = id;
+                }
+                respond();
+            });
+
+    } catch (const std::exception& e) {
+        callback(common::handler::internalError("PaHandler::handleVerifyBatch", e));
+    }
+}
+
 void PaHandler::handleHistory(
     const drogon::HttpRequestPtr& req,
     std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
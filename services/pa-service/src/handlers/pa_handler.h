@@ -9,9 +9,11 @@
 // Forward declarations
 namespace common {
     class IQueryExecutor;
+    class BlockingExecutor;
 }
 namespace services {
     class PaVerificationService;
+    struct PaVerificationRequest;
     class TrustMaterialService;
 }
 namespace repositories {
@@ -30,6 +32,7 @@ namespace handlers {
  *
  * Provides all PA-related API endpoints:
  * - POST /api/pa/verify - Full PA verification
+ * - POST /api/pa/verify/batch - PA verification of N documents (JSON array or NDJSON)
  * - GET /api/pa/history - Verification history (paginated)
  * - GET /api/pa/{id} - Verification detail by ID
  * - GET /api/pa/statistics - Verification statistics
@@ -40,6 +43,8 @@ namespace handlers {
  * - GET /api/pa/{id}/datagroups - Data groups for a verification
  *
  * Uses Service Pattern for business logic delegation.
+ * Endpoints that hit DB/LDAP run on the shared BlockingExecutor; parse-only
+ * endpoints stay on the event loop.
  */
 class PaHandler {
 public:
@@ -50,6 +55,8 @@ public:
      * @param dataGroupRepository Data group repository (non-owning pointer)
      * @param sodParserService SOD parser service (non-owning pointer)
      * @param dataGroupParserService DG parser service (non-owning pointer)
+     * @param batchMaxDocuments Maximum documents per /api/pa/verify/batch request
+     * @param executor Runs DB/LDAP-bound handlers off the event loop (nullptr = inline)
      */
     PaHandler(
         services::PaVerificationService* paVerificationService,
@@ -58,7 +65,9 @@ public:
         icao::DgParser* dataGroupParserService,
         common::IQueryExecutor* queryExecutor = nullptr,
         services::TrustMaterialService* trustMaterialService = nullptr,
-        repositories::TrustMaterialRequestRepository* trustMaterialRequestRepo = nullptr);
+        repositories::TrustMaterialRequestRepository* trustMaterialRequestRepo = nullptr,
+        size_t batchMaxDocuments = 100,
+        common::BlockingExecutor* executor = nullptr);
 
     /**
      * @brief Register PA routes
@@ -77,6 +86,8 @@ private:
     common::IQueryExecutor* queryExecutor_;
     services::TrustMaterialService* trustMaterialService_;
     repositories::TrustMaterialRequestRepository* trustMaterialRequestRepo_;
+    size_t batchMaxDocuments_;
+    common::BlockingExecutor* executor_;
 
     /** POST /api/pa/trust-materials — Fetch CSCA/CRL for client-side PA */
     void handleTrustMaterials(
@@ -115,6 +126,22 @@ private:
         const drogon::HttpRequestPtr& req,
         std::function<void(const drogon::HttpResponsePtr&)>&& callback);
 
+    /**
+     * @brief POST /api/pa/verify/batch
+     *
+     * Verify several documents concurrently on the PA worker pool.
+     *
+     * Request body: JSON array of /api/pa/verify bodies (or {"documents": [...]}),
+     * or NDJSON (Content-Type: application/x-ndjson), one body per line.
+     * Each document may carry an "id", echoed back in its result.
+     *
+     * Response: {"success", "count", "results": [...]} in request order,
+     * each result tagged with "index" (NDJSON requests get NDJSON results).
+     */
+    void handleVerifyBatch(
+        const drogon::HttpRequestPtr& req,
+        std::function<void(const drogon::HttpResponsePtr&)>&& callback);
+
     /**
      * @brief GET /api/pa/history
      *
@@ -225,6 +252,20 @@ private:
      */
     static std::vector<uint8_t> base64Decode(const std::string& encoded);
 
+    /**
+     * @brief Parse one /api/pa/verify body (SOD, data groups, country, document number)
+     * @param body Request JSON
+     * @param request Output (client metadata left unset)
+     * @param error Public error message when false is returned
+     * @return false if the SOD is missing or not valid Base64
+     */
+    static bool parseVerifyRequest(const Json::Value& body,
+                                   services::PaVerificationRequest& request,
+                                   std::string& error);
+
+    /** @brief Client IP (X-Real-IP, first X-Forwarded-For entry, then peer address) */
+    static std::string clientIpOf(const drogon::HttpRequestPtr& req);
+
     /// @}
 };
 
@@ -30,6 +30,20 @@ struct AppConfig {
     int threadNum = 4;
     int maxBodySizeMB = 50;  // HTTP upload body size limit (MB)
 
+    // PA verdict cache (repeated SOD + DG submissions); 0 = disabled
+    int paVerdictCacheSize = 0;
+    int paVerdictCacheTtlSeconds = 300;
+
+    // In-memory CSCA/CRL trust snapshot refresh interval; 0 = disabled (LDAP per request)
+    int trustSnapshotRefreshSeconds = 300;
+
+    // Max age of a parsed country CRL; snapshot publishes clear the cache earlier
+    int crlCacheTtlSeconds = 300;
+
+    // Batch PA verification (POST /api/pa/verify/batch); workers 0 = hardware concurrency
+    int paBatchMaxDocuments = 100;
+    int paBatchWorkers = 0;
+
     // Safe environment variable integer parser with range clamping
     static int envStoi(const char* val, int defaultVal, int minVal, int maxVal) {
         try {
@@ -62,6 +76,18 @@ struct AppConfig {
         // HTTP upload body size limit
         if (auto val = std::getenv("MAX_BODY_SIZE_MB")) config.maxBodySizeMB = envStoi(val, 50, 1, 500);
 
+        // PA verdict cache
+        if (auto val = std::getenv("PA_VERDICT_CACHE_SIZE")) config.paVerdictCacheSize = envStoi(val, 0, 0, 100000);
+        if (auto val = std::getenv("PA_VERDICT_CACHE_TTL_SECONDS")) config.paVerdictCacheTtlSeconds = envStoi(val, 300, 1, 86400);
+
+        // Trust snapshot
+        if (auto val = std::getenv("TRUST_SNAPSHOT_REFRESH_SECONDS")) config.trustSnapshotRefreshSeconds = envStoi(val, 300, 0, 86400);
+        if (auto val = std::getenv("CRL_CACHE_TTL_SECONDS")) config.crlCacheTtlSeconds = envStoi(val, 300, 0, 86400);
+
+        // Batch PA verification
+        if (auto val = std::getenv("PA_BATCH_MAX_DOCUMENTS")) config.paBatchMaxDocuments = envStoi(val, 100, 1, 1000);
+        if (auto val = std::getenv("PA_BATCH_WORKERS")) config.paBatchWorkers = envStoi(val, 0, 0, 64);
+
         return config;
     }
 
@@ -6,14 +6,18 @@
 #include "service_container.h"
 #include "app_config.h"
 #include "../auth/personal_info_crypto.h"
+#include "thread_pool.h"
 
 #include <spdlog/spdlog.h>
 #include <ldap.h>
+#include <algorithm>
 #include <thread>
 #include <chrono>
 
 // Infrastructure
 #include "db_connection_pool.h"
+#include "blocking_executor.h"
+#include <icao/audit/audit_sink.h>
 #include "db_connection_pool_factory.h"
 
 // Repositories
@@ -30,8 +34,11 @@
 // Services
 #include "../services/certificate_validation_service.h"
 #include "../services/dsc_auto_registration_service.h"
+#include "../services/pa_verdict_cache.h"
 #include "../services/pa_verification_service.h"
 #include "../services/trust_material_service.h"
+#include "../services/trust_snapshot_service.h"
+#include <icao/validation/crl_cache.h>
 
 namespace infrastructure {
 
@@ -40,6 +47,8 @@ struct ServiceContainer::Impl {
     std::shared_ptr<common::IDbConnectionPool> dbPool;
     std::unique_ptr<common::IQueryExecutor> queryExecutor;
     LDAP* ldapConn = nullptr;
+    std::unique_ptr<common::BlockingExecutor> blockingExecutor;
+    std::unique_ptr<icao::audit::AsyncAuditSink> auditSink;
 
     // Repositories
     std::unique_ptr<repositories::PaVerificationRepository> paVerificationRepo;
@@ -52,8 +61,11 @@ struct ServiceContainer::Impl {
     std::unique_ptr<icao::DgParser> dgParser;
 
     // Services
+    std::unique_ptr<services::TrustSnapshotService> trustSnapshotService;
     std::unique_ptr<services::CertificateValidationService> certificateValidationService;
     std::unique_ptr<services::DscAutoRegistrationService> dscAutoRegistrationService;
+    std::unique_ptr<services::PaVerdictCache> paVerdictCache;
+    std::unique_ptr<common::ThreadPool> paWorkerPool;  // Batch verification
     std::unique_ptr<services::PaVerificationService> paVerificationService;
 
     // Trust Material (client-side PA support)
@@ -152,6 +164,13 @@ bool ServiceContainer::initialize(const AppConfig& config) {
         }
         spdlog::info("Query Executor initialized (DB type: {})", impl_->queryExecutor->getDatabaseType());
 
+        // Audit rows are queued and written in batches (AUDIT_SINK_*)
+        auto auditConfig = icao::audit::AsyncAuditSink::Config::fromEnvironment({});
+        if (auditConfig.enabled) {
+            impl_->auditSink = std::make_unique<icao::audit::AsyncAuditSink>(impl_->queryExecutor.get(), auditConfig);
+            icao::audit::setAuditSink(impl_->auditSink.get());
+        }
+
         // Step 3: LDAP connection
         impl_->ldapConn = connectLdap(config);
         if (!impl_->ldapConn) {
@@ -177,20 +196,45 @@ bool ServiceContainer::initialize(const AppConfig& config) {
         impl_->dgParser = std::make_unique<icao::DgParser>();
 
         // Step 6: Services
+        if (config.trustSnapshotRefreshSeconds > 0) {
+            impl_->trustSnapshotService = std::make_unique<services::TrustSnapshotService>(
+                impl_->ldapCertificateRepo.get(),
+                impl_->ldapCrlRepo.get(),
+                std::chrono::seconds(config.trustSnapshotRefreshSeconds));
+        }
+
         impl_->certificateValidationService = std::make_unique<services::CertificateValidationService>(
             impl_->ldapCertificateRepo.get(),
-            impl_->ldapCrlRepo.get());
+            impl_->ldapCrlRepo.get(),
+            impl_->trustSnapshotService.get());
 
         impl_->dscAutoRegistrationService = std::make_unique<services::DscAutoRegistrationService>(
             impl_->queryExecutor.get());
 
+        icao::validation::CrlCache::instance().setTtl(std::chrono::seconds(config.crlCacheTtlSeconds));
+
+        if (config.paVerdictCacheSize > 0) {
+            impl_->paVerdictCache = std::make_unique<services::PaVerdictCache>(
+                static_cast<size_t>(config.paVerdictCacheSize),
+                std::chrono::seconds(config.paVerdictCacheTtlSeconds));
+            spdlog::info("PA verdict cache enabled (size={}, ttl={}s)",
+                config.paVerdictCacheSize, config.paVerdictCacheTtlSeconds);
+        }
+
+        size_t paWorkers = config.paBatchWorkers > 0
+            ? static_cast<size_t>(config.paBatchWorkers)
+            : std::max(2u, std::thread::hardware_concurrency());
+        impl_->paWorkerPool = std::make_unique<common::ThreadPool>(paWorkers);
+
         impl_->paVerificationService = std::make_unique<services::PaVerificationService>(
             impl_->paVerificationRepo.get(),
             impl_->dataGroupRepo.get(),
             impl_->sodParser.get(),
             impl_->certificateValidationService.get(),
             impl_->dgParser.get(),
-            impl_->dscAutoRegistrationService.get());
+            impl_->dscAutoRegistrationService.get(),
+            impl_->paVerdictCache.get(),
+            impl_->paWorkerPool.get());
 
         // Step 7: Trust Material Service (client-side PA support)
         impl_->trustMaterialRequestRepo = std::make_unique<repositories::TrustMaterialRequestRepository>(
@@ -198,7 +242,25 @@ bool ServiceContainer::initialize(const AppConfig& config) {
         impl_->trustMaterialService = std::make_unique<services::TrustMaterialService>(
             impl_->ldapCertificateRepo.get(),
             impl_->ldapCrlRepo.get(),
-            impl_->trustMaterialRequestRepo.get());
+            impl_->trustMaterialRequestRepo.get(),
+            impl_->trustSnapshotService.get());
+
+        // Step 8: Trust snapshot refresh (first load runs in the background; LDAP serves until then)
+        if (impl_->trustSnapshotService) {
+            Impl* impl = impl_.get();
+            impl_->trustSnapshotService->setOnPublish([impl](const auto&) {
+                // Parsed CRLs and cached verdicts may predate the new CSCA/CRL set
+                icao::validation::CrlCache::instance().clear();
+                if (impl->paVerdictCache) impl->paVerdictCache->clear();
+            });
+            impl_->trustSnapshotService->start();
+        }
+
+        // Step 9: Executor for blocking handler work (BLOCKING_EXECUTOR_* overrides)
+        common::BlockingExecutor::Config executorDefaults;
+        executorDefaults.workers = static_cast<size_t>(config.threadNum) * 4;
+        impl_->blockingExecutor = std::make_unique<common::BlockingExecutor>(
+            common::BlockingExecutor::Config::fromEnvironment(executorDefaults));
 
         spdlog::info("All PA Service dependencies initialized successfully");
         return true;
@@ -214,12 +276,37 @@ void ServiceContainer::shutdown() {
 
     spdlog::info("Shutting down PA Service dependencies...");
 
+    // Finish in-flight handler work while the services it calls still exist
+    if (impl_->blockingExecutor) {
+        impl_->blockingExecutor->shutdown();
+    }
+
+    // Stop background refresh before the repositories it uses go away
+    if (impl_->trustSnapshotService) {
+        impl_->trustSnapshotService->stop();
+    }
+
+    // Let in-flight batch verifications finish while their dependencies still exist
+    if (impl_->paWorkerPool) {
+        impl_->paWorkerPool->shutdown();
+    }
+
+    // Later audit events are written inline; queued ones are flushed now
+    if (impl_->auditSink) {
+        icao::audit::setAuditSink(nullptr);
+        impl_->auditSink->shutdown();
+        impl_->auditSink.reset();
+    }
+
     // Delete in reverse order of initialization
     impl_->trustMaterialService.reset();
     impl_->trustMaterialRequestRepo.reset();
     impl_->paVerificationService.reset();
+    impl_->paWorkerPool.reset();
+    impl_->paVerdictCache.reset();
     impl_->dscAutoRegistrationService.reset();
     impl_->certificateValidationService.reset();
+    impl_->trustSnapshotService.reset();
     impl_->dgParser.reset();
     impl_->sodParser.reset();
     impl_->ldapCrlRepo.reset();
@@ -257,5 +344,7 @@ services::DscAutoRegistrationService* ServiceContainer::dscAutoRegistrationServi
 services::PaVerificationService* ServiceContainer::paVerificationService() const { return impl_->paVerificationService.get(); }
 repositories::TrustMaterialRequestRepository* ServiceContainer::trustMaterialRequestRepository() const { return impl_->trustMaterialRequestRepo.get(); }
 services::TrustMaterialService* ServiceContainer::trustMaterialService() const { return impl_->trustMaterialService.get(); }
+services::TrustSnapshotService* ServiceContainer::trustSnapshotService() const { return impl_->trustSnapshotService.get(); }
+common::BlockingExecutor* ServiceContainer::blockingExecutor() const { return impl_->blockingExecutor.get(); }
 
 } // namespace infrastructure
@@ -16,6 +16,7 @@ struct AppConfig;
 namespace common {
     class IDbConnectionPool;
     class IQueryExecutor;
+    class BlockingExecutor;
 }
 
 // Forward declarations - Repositories
@@ -37,6 +38,7 @@ namespace services {
     class DscAutoRegistrationService;
     class PaVerificationService;
     class TrustMaterialService;
+    class TrustSnapshotService;
 }
 
 namespace infrastructure {
@@ -65,6 +67,7 @@ public:
     // --- Connection Pool Accessors ---
     common::IDbConnectionPool* dbPool() const;
     common::IQueryExecutor* queryExecutor() const;
+    common::BlockingExecutor* blockingExecutor() const;  ///< DB/LDAP work off the event loops
 
     // --- Repository Accessors ---
     repositories::PaVerificationRepository* paVerificationRepository() const;
@@ -80,6 +83,7 @@ public:
     services::PaVerificationService* paVerificationService() const;
     repositories::TrustMaterialRequestRepository* trustMaterialRequestRepository() const;
     services::TrustMaterialService* trustMaterialService() const;
+    services::TrustSnapshotService* trustSnapshotService() const;  ///< nullptr if disabled
 
 private:
     struct Impl;
@@ -24,10 +24,15 @@
 #include "infrastructure/app_config.h"
 #include "infrastructure/service_container.h"
 #include "i_query_executor.h"
+#include "oracle_sql_translator.h"
 #include "db_connection_interface.h"
 #include "handlers/health_handler.h"
 #include "handlers/pa_handler.h"
 #include "handlers/info_handler.h"
+#include "services/trust_snapshot_service.h"
+#include "blocking_offload.h"
+#include <icao/audit/audit_sink.h>
+#include <icao/validation/signature_cache.h>
 
 namespace {
 
@@ -179,7 +184,9 @@ void registerRoutes() {
         g_services->dgParser(),
         g_services->queryExecutor(),
         g_services->trustMaterialService(),
-        g_services->trustMaterialRequestRepository()
+        g_services->trustMaterialRequestRepository(),
+        static_cast<size_t>(appConfig.paBatchMaxDocuments),
+        g_services->blockingExecutor()
     );
     paHandler.registerRoutes(app);
 
@@ -200,10 +207,74 @@ void registerRoutes() {
                 result["dbPool"]["available"] = static_cast<Json::UInt>(stats.availableConnections);
                 result["dbPool"]["total"] = static_cast<Json::UInt>(stats.totalConnections);
                 result["dbPool"]["max"] = static_cast<Json::UInt>(stats.maxConnections);
+                result["dbPool"]["acquireCount"] = static_cast<Json::UInt64>(stats.acquireCount);
+                result["dbPool"]["acquireWaitTotalUs"] = static_cast<Json::UInt64>(stats.acquireWaitTotalUs);
+                result["dbPool"]["acquireWaitMaxUs"] = static_cast<Json::UInt64>(stats.acquireWaitMaxUs);
+                result["dbPool"]["healthCheckCount"] = static_cast<Json::UInt64>(stats.healthCheckCount);
+                result["dbPool"]["discardedConnections"] = static_cast<Json::UInt64>(stats.discardedConnections);
+                result["dbPool"]["statementPrepares"] = static_cast<Json::UInt64>(stats.statementPrepares);
+                result["dbPool"]["statementExecutes"] = static_cast<Json::UInt64>(stats.statementExecutes);
+            }
+            if (g_services && g_services->trustSnapshotService()) {
+                auto* snapshots = g_services->trustSnapshotService();
+                auto stats = snapshots->stats();
+                result["trustSnapshot"]["refreshes"] = static_cast<Json::UInt64>(stats.refreshes);
+                result["trustSnapshot"]["publications"] = static_cast<Json::UInt64>(stats.publications);
+                result["trustSnapshot"]["failures"] = static_cast<Json::UInt64>(stats.failures);
+                if (!stats.lastError.empty()) result["trustSnapshot"]["lastError"] = stats.lastError;
+                if (auto snapshot = snapshots->current()) {
+                    result["trustSnapshot"]["cscaCount"] = static_cast<Json::UInt>(snapshot->cscaCount());
+                    result["trustSnapshot"]["crlCount"] = static_cast<Json::UInt>(snapshot->crlCount());
+                    result["trustSnapshot"]["countryCount"] = static_cast<Json::UInt>(snapshot->countryCount());
+                    result["trustSnapshot"]["contentHash"] = snapshot->contentHash();
+                }
+            }
+            if (g_services && g_services->blockingExecutor()) {
+                result["blockingExecutor"] = common::handler::blockingExecutorMetrics(*g_services->blockingExecutor());
+            }
+            if (auto* sink = icao::audit::auditSink()) {
+                result["auditSink"] = icao::audit::auditSinkMetrics(*sink);
+            }
+            {
+                auto stats = icao::validation::SignatureVerificationCache::instance().stats();
+                result["signatureCache"]["hits"] = static_cast<Json::UInt64>(stats.hits);
+                result["signatureCache"]["misses"] = static_cast<Json::UInt64>(stats.misses);
+                result["signatureCache"]["entries"] = static_cast<Json::UInt64>(stats.entries);
+            }
+            if (g_services && g_services->queryExecutor() &&
+                g_services->queryExecutor()->getDatabaseType() == "oracle") {
+                result["oracleSqlTranslation"] = common::oracleSqlTranslationMetrics(common::OracleSqlTranslator::instance());
             }
             callback(drogon::HttpResponse::newHttpJsonResponse(result));
         }, {drogon::Get});
 
+    // --- Trust snapshot change signal (sent by pkd-management / pkd-relay after CSCA/CRL writes) ---
+    // Internal callers only: private-network peers, and not proxied by the gateway
+    app.registerHandler("/internal/trust-snapshot/refresh",
+        [](const drogon::HttpRequestPtr& req,
+           std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
+            Json::Value result;
+            if (!req->peerAddr().isIntranetIp() || !req->getHeader("X-Forwarded-For").empty()) {
+                result["success"] = false;
+                result["message"] = "Internal endpoint";
+                auto resp = drogon::HttpResponse::newHttpJsonResponse(result);
+                resp->setStatusCode(drogon::k403Forbidden);
+                callback(resp);
+                return;
+            }
+            auto* snapshots = g_services ? g_services->trustSnapshotService() : nullptr;
+            result["success"] = (snapshots != nullptr);
+            if (snapshots) {
+                snapshots->requestRefresh();
+                result["message"] = "Trust snapshot refresh requested";
+            } else {
+                result["message"] = "Trust snapshot disabled";
+            }
+            auto resp = drogon::HttpResponse::newHttpJsonResponse(result);
+            resp->setStatusCode(snapshots ? drogon::k202Accepted : drogon::k404NotFound);
+            callback(resp);
+        }, {drogon::Post});
+
     spdlog::info("PA Service API routes registered (17 endpoints via 3 handlers)");
 }
 
@@ -27,6 +27,93 @@ DataGroupRepository::DataGroupRepository(common::IQueryExecutor* executor)
         queryExecutor_->getDatabaseType());
 }
 
+namespace {
+
+const char* kInsertQuery = R"SQL(
+    INSERT INTO pa_data_group (
+        id, verification_id, dg_number, expected_hash, actual_hash,
+        hash_algorithm, hash_valid, dg_binary
+    ) VALUES (
+        $1, $2, $3, $4, $5, $6, $7, $8
+    )
+)SQL";
+
+/**
+ * @brief Bind parameters for kInsertQuery
+ */
+std::vector<std::string> insertParams(
+    const icao::models::DataGroup& dg,
+    const std::string& id,
+    const std::string& verificationId,
+    const std::string& dbType)
+{
+    // Extract DG number from string (supports "DG1" -> 1 or "1" -> 1)
+    int dgNumber = 0;
+    if (dg.dgNumber.find("DG") == 0) {
+        try { dgNumber = std::stoi(dg.dgNumber.substr(2)); } catch (const std::exception&) { /* use default 0 */ }
+    } else {
+        try { dgNumber = std::stoi(dg.dgNumber); } catch (...) { /* non-critical: use default */ }
+    }
+
+    // Database-aware boolean formatting
+    auto boolStr = [&dbType](bool val) -> std::string {
+        return common::db::boolLiteral(dbType, val);
+    };
+
+    // Prepare parameters
+    std::vector<std::string> params;
+    params.push_back(id);
+    params.push_back(verificationId);
+    params.push_back(std::to_string(dgNumber));
+    params.push_back(dg.expectedHash);
+    params.push_back(dg.actualHash);
+    params.push_back(dg.hashAlgorithm);
+    params.push_back(boolStr(dg.hashValid));
+
+    // Handle binary data (empty if not present)
+    // \\x prefix is required for both PostgreSQL (bytea hex) and Oracle (BLOB detection)
+    std::string binaryData;
+    if (dg.rawData.has_value() && !dg.rawData.value().empty()) {
+        const auto& data = dg.rawData.value();
+        std::ostringstream oss;
+        oss << "\\x";  // Hex prefix: PostgreSQL bytea format + Oracle BLOB detection trigger
+        for (uint8_t byte : data) {
+            oss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+        }
+        binaryData = oss.str();
+    }
+    params.push_back(binaryData);
+    return params;
+}
+
+/**
+ * @brief Generate count UUIDs in one round trip
+ */
+std::vector<std::string> generateIds(common::IQueryExecutor* executor, const std::string& dbType, size_t count) {
+    std::string uuidQuery;
+    if (dbType == "postgres") {
+        uuidQuery = "SELECT uuid_generate_v4()::text as id FROM generate_series(1, $1)";
+    } else {
+        // Oracle: Convert SYS_GUID() to UUID format
+        uuidQuery = "SELECT LOWER(REGEXP_REPLACE(RAWTOHEX(SYS_GUID()), "
+                   "'([A-F0-9]{8})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{12})', "
+                   "'\\1-\\2-\\3-\\4-\\5')) as id FROM DUAL CONNECT BY LEVEL <= $1";
+    }
+
+    Json::Value uuidResult = executor->executeQuery(uuidQuery, {std::to_string(count)});
+    if (uuidResult.size() != count) {
+        throw std::runtime_error("Failed to generate UUID");
+    }
+    std::vector<std::string> ids;
+    ids.reserve(count);
+    for (const auto& row : uuidResult) {
+        ids.push_back(row["id"].asString());
+    }
+    return ids;
+}
+
+} // anonymous namespace
+
 // --- Query Methods ---
 
 Json::Value DataGroupRepository::findByVerificationId(const std::string& verificationId) {
@@ -98,73 +185,13 @@ std::string DataGroupRepository::insert(
         dg.dgNumber, verificationId);
 
     try {
-        // Extract DG number from string (supports "DG1" -> 1 or "1" -> 1)
-        int dgNumber = 0;
-        if (dg.dgNumber.find("DG") == 0) {
-            try { dgNumber = std::stoi(dg.dgNumber.substr(2)); } catch (const std::exception&) { /* use default 0 */ }
-        } else {
-            try { dgNumber = std::stoi(dg.dgNumber); } catch (...) { /* non-critical: use default */ }
-        }
-
         // Step 1: Generate UUID using database-specific function
         std::string dbType = queryExecutor_->getDatabaseType();
-        std::string uuidQuery;
-
-        if (dbType == "postgres") {
-            uuidQuery = "SELECT uuid_generate_v4()::text as id";
-        } else {
-            // Oracle: Convert SYS_GUID() to UUID format
-            uuidQuery = "SELECT LOWER(REGEXP_REPLACE(RAWTOHEX(SYS_GUID()), "
-                       "'([A-F0-9]{8})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{12})', "
-                       "'\\1-\\2-\\3-\\4-\\5')) as id FROM DUAL";
-        }
-
-        Json::Value uuidResult = queryExecutor_->executeQuery(uuidQuery, {});
-        if (uuidResult.empty()) {
-            throw std::runtime_error("Failed to generate UUID");
-        }
-        std::string generatedId = uuidResult[0]["id"].asString();
+        std::string generatedId = generateIds(queryExecutor_, dbType, 1).front();
 
         // Step 2: Insert with generated UUID (no RETURNING clause needed)
-        const char* insertQuery = R"SQL(
-            INSERT INTO pa_data_group (
-                id, verification_id, dg_number, expected_hash, actual_hash,
-                hash_algorithm, hash_valid, dg_binary
-            ) VALUES (
-                $1, $2, $3, $4, $5, $6, $7, $8
-            )
-        )SQL";
-
-        // Database-aware boolean formatting
-        auto boolStr = [&dbType](bool val) -> std::string {
-            return common::db::boolLiteral(dbType, val);
-        };
-
-        // Prepare parameters
-        std::vector<std::string> params;
-        params.push_back(generatedId);
-        params.push_back(verificationId);
-        params.push_back(std::to_string(dgNumber));
-        params.push_back(dg.expectedHash);
-        params.push_back(dg.actualHash);
-        params.push_back(dg.hashAlgorithm);
-        params.push_back(boolStr(dg.hashValid));
-
-        // Handle binary data (empty if not present)
-        // \\x prefix is required for both PostgreSQL (bytea hex) and Oracle (BLOB detection)
-        std::string binaryData;
-        if (dg.rawData.has_value() && !dg.rawData.value().empty()) {
-            const auto& data = dg.rawData.value();
-            std::ostringstream oss;
-            oss << "\\x";  // Hex prefix: PostgreSQL bytea format + Oracle BLOB detection trigger
-            for (uint8_t byte : data) {
-                oss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
-            }
-            binaryData = oss.str();
-        }
-        params.push_back(binaryData);
-
-        int rowsAffected = queryExecutor_->executeCommand(insertQuery, params);
+        int rowsAffected = queryExecutor_->executeCommand(
+            kInsertQuery, insertParams(dg, generatedId, verificationId, dbType));
 
         // Oracle may return 0 for successful INSERTs without RETURNING clause
         if (rowsAffected == 0 && dbType == "postgres") {
@@ -180,6 +207,31 @@ std::string DataGroupRepository::insert(
     }
 }
 
+void DataGroupRepository::insertBatch(
+    const std::vector<std::pair<std::string, icao::models::DataGroup>>& rows)
+{
+    if (rows.empty()) return;
+    spdlog::debug("[DataGroupRepository] Inserting {} data groups", rows.size());
+
+    try {
+        std::string dbType = queryExecutor_->getDatabaseType();
+        std::vector<std::string> ids = generateIds(queryExecutor_, dbType, rows.size());
+
+        std::vector<std::vector<std::string>> paramRows;
+        paramRows.reserve(rows.size());
+        for (size_t i = 0; i < rows.size(); i++) {
+            paramRows.push_back(insertParams(rows[i].second, ids[i], rows[i].first, dbType));
+        }
+
+        queryExecutor_->executeBatch(kInsertQuery, paramRows);
+        spdlog::info("[DataGroupRepository] {} data groups inserted", rows.size());
+
+    } catch (const std::exception& e) {
+        spdlog::error("[DataGroupRepository] Batch insert failed: {}", e.what());
+        throw;
+    }
+}
+
 int DataGroupRepository::deleteByVerificationId(const std::string& verificationId) {
     spdlog::debug("[DataGroupRepository] Deleting data groups for verification: {}", verificationId);
 
@@ -77,6 +77,13 @@ public:
      */
     std::string insert(const icao::models::DataGroup& dg, const std::string& verificationId);
 
+    /**
+     * @brief Insert data groups of several verifications with one batched command
+     * @param rows (verification UUID, DataGroup) pairs
+     * @throws std::runtime_error on database error
+     */
+    void insertBatch(const std::vector<std::pair<std::string, icao::models::DataGroup>>& rows);
+
     /**
      * @brief Delete all data groups for a verification
      * @param verificationId PA verification UUID
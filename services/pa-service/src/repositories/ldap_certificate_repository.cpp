@@ -126,7 +126,7 @@ std::vector<X509*> LdapCertificateRepository::findAllCscasByCountry(const std::s
         allCerts.insert(allCerts.end(), lcCerts.begin(), lcCerts.end());
     }
 
-    spdlog::info("Found {} CSCAs for country {}", allCerts.size(), countryCode);
+    spdlog::debug("Found {} CSCAs for country {}", allCerts.size(), countryCode);
     return allCerts;
 }
 
@@ -218,6 +218,46 @@ X509* LdapCertificateRepository::findCscaByIssuerDn(
     return nullptr;
 }
 
+std::vector<std::string> LdapCertificateRepository::findCountryCodes() {
+    std::vector<std::string> countries;
+    std::string baseDn = "dc=data," + baseDn_;
+    char* attrs[] = {const_cast<char*>("c"), nullptr};
+
+    LDAPMessage* res = nullptr;
+    int rc = ldap_search_ext_s(
+        ldapConn_,
+        baseDn.c_str(),
+        LDAP_SCOPE_ONELEVEL,
+        "(c=*)",
+        attrs,
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        0,  // No size limit (one entry per country)
+        &res
+    );
+
+    if (rc != LDAP_SUCCESS) {
+        spdlog::warn("LDAP country list search failed: {} ({})", ldap_err2string(rc), baseDn);
+        if (res) ldap_msgfree(res);
+        return countries;
+    }
+
+    for (LDAPMessage* entry = ldap_first_entry(ldapConn_, res); entry;
+         entry = ldap_next_entry(ldapConn_, entry)) {
+        struct berval** values = ldap_get_values_len(ldapConn_, entry, "c");
+        if (values && values[0]) {
+            countries.emplace_back(values[0]->bv_val, values[0]->bv_len);
+        }
+        if (values) ldap_value_free_len(values);
+    }
+    ldap_msgfree(res);
+
+    spdlog::debug("Found {} countries under {}", countries.size(), baseDn);
+    return countries;
+}
+
 // --- DSC Certificate Operations ---
 
 X509* LdapCertificateRepository::findDscBySubjectDn(
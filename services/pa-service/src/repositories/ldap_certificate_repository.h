@@ -90,6 +90,12 @@ public:
      */
     X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode);
 
+    /**
+     * @brief List country codes present under dc=data (one-level search)
+     * @return Country codes as stored in the DIT (empty on LDAP error)
+     */
+    std::vector<std::string> findCountryCodes();
+
     /// @}
 
     /// @name DSC Certificate Operations
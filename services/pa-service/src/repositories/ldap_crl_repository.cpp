@@ -42,7 +42,7 @@ X509_CRL* LdapCrlRepository::findCrlByCountry(const std::string& countryCode) {
     ldap_msgfree(res);
 
     if (crl) {
-        spdlog::info("Found CRL for country: {}", countryCode);
+        spdlog::debug("Found CRL for country: {}", countryCode);
     }
 
     return crl;
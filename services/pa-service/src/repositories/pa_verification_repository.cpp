@@ -28,6 +28,125 @@ PaVerificationRepository::PaVerificationRepository(common::IQueryExecutor* execu
         queryExecutor_->getDatabaseType());
 }
 
+namespace {
+
+const char* kInsertQuery =
+    "INSERT INTO pa_verification ("
+    "id, "  // Add id column
+    "issuing_country, document_number, verification_status, sod_hash, sod_binary, "
+    "dsc_subject_dn, dsc_serial_number, dsc_issuer_dn, dsc_fingerprint, "
+    "csca_subject_dn, csca_fingerprint, "
+    "trust_chain_valid, trust_chain_message, "
+    "sod_signature_valid, sod_signature_message, "
+    "dg_hashes_valid, dg_hashes_message, "
+    "crl_status, crl_message, "
+    "verification_message, "
+    "client_ip, user_agent, requested_by, "
+    "dsc_non_conformant, pkd_conformance_code, pkd_conformance_text"
+    ") VALUES ("
+    "$1, "  // id value
+    "$2, $3, $4, $5, $6, "
+    "$7, $8, $9, $10, "
+    "$11, $12, "
+    "$13, $14, "
+    "$15, $16, "
+    "$17, $18, "
+    "$19, $20, "
+    "$21, "
+    "$22, $23, $24, "
+    "$25, $26, $27"
+    ")";
+
+/**
+ * @brief Bind parameters for kInsertQuery
+ */
+std::vector<std::string> insertParams(
+    const domain::models::PaVerification& verification,
+    const std::string& id,
+    const std::string& dbType)
+{
+    // Database-aware boolean formatting
+    auto boolStr = [&dbType](bool val) -> std::string {
+        return common::db::boolLiteral(dbType, val);
+    };
+
+    // Convert SOD binary to hex string for BYTEA storage
+    std::string sodBinaryHex;
+    if (!verification.sodBinary.empty()) {
+        std::ostringstream hexStream;
+        hexStream << common::db::hexPrefix(dbType);
+        for (auto b : verification.sodBinary) {
+            hexStream << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(b);
+        }
+        sodBinaryHex = hexStream.str();
+    }
+
+    // Encrypt PII fields (개인정보보호법 제29조 안전조치)
+    std::string encDocNum = auth::pii::encrypt(verification.documentNumber);
+    std::string encIp = auth::pii::encrypt(verification.ipAddress.value_or(""));
+    std::string encUa = auth::pii::encrypt(verification.userAgent.value_or(""));
+
+    return {
+        id,                                                              // $1: id
+        verification.countryCode,                                        // $2
+        encDocNum,                                                       // $3: document_number (encrypted)
+        verification.verificationStatus,                                 // $4
+        verification.sodHash,                                            // $5
+        sodBinaryHex,                                                    // $6: sod_binary
+        verification.dscSubject,                                         // $7
+        verification.dscSerialNumber,                                    // $8
+        verification.dscIssuer,                                          // $9
+        "",                                                              // $10: dsc_fingerprint (not available in domain model)
+        verification.cscaSubject,                                        // $11
+        "",                                                              // $12: csca_fingerprint (not available in domain model)
+        boolStr(verification.certificateChainValid),                     // $13
+        verification.validationErrors.value_or(""),                      // $14: trust_chain_message
+        boolStr(verification.sodSignatureValid),                         // $15
+        verification.sodSignatureValid ? "SOD signature valid" : "SOD signature invalid",  // $16: sod_signature_message
+        boolStr(verification.dataGroupsValid),                           // $17
+        verification.dataGroupsValid ? "All data group hashes valid" : "Data group hash mismatch",  // $18: dg_hashes_message
+        verification.crlStatus,                                          // $19
+        verification.crlMessage.value_or(""),                            // $20
+        verification.validationErrors.value_or(""),                      // $21
+        encIp,                                                           // $22: client_ip (encrypted)
+        encUa,                                                           // $23: user_agent (encrypted)
+        verification.requestedBy,                                        // $24
+        boolStr(verification.dscNonConformant),                          // $25
+        verification.pkdConformanceCode,                                 // $26
+        verification.pkdConformanceText                                  // $27
+    };
+}
+
+/**
+ * @brief Generate count UUIDs in one round trip
+ */
+std::vector<std::string> generateIds(common::IQueryExecutor* executor, const std::string& dbType, size_t count) {
+    // PostgreSQL: uuid_generate_v4()
+    // Oracle: LOWER(REGEXP_REPLACE(RAWTOHEX(SYS_GUID()), '([A-F0-9]{8})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{12})', '\1-\2-\3-\4-\5'))
+    std::string uuidQuery;
+    if (dbType == "postgres") {
+        uuidQuery = "SELECT uuid_generate_v4()::text as id FROM generate_series(1, $1)";
+    } else {
+        // Oracle: Convert SYS_GUID() to UUID format (lowercase with hyphens)
+        uuidQuery = "SELECT LOWER(REGEXP_REPLACE(RAWTOHEX(SYS_GUID()), "
+                   "'([A-F0-9]{8})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{12})', "
+                   "'\\1-\\2-\\3-\\4-\\5')) as id FROM DUAL CONNECT BY LEVEL <= $1";
+    }
+
+    Json::Value uuidResult = executor->executeQuery(uuidQuery, {std::to_string(count)});
+    if (uuidResult.size() != count) {
+        throw std::runtime_error("Failed to generate UUID");
+    }
+    std::vector<std::string> ids;
+    ids.reserve(count);
+    for (const auto& row : uuidResult) {
+        ids.push_back(row["id"].asString());
+    }
+    return ids;
+}
+
+} // anonymous namespace
+
 // --- CRUD Operations ---
 
 std::string PaVerificationRepository::insert(const domain::models::PaVerification& verification) {
@@ -35,106 +154,13 @@ std::string PaVerificationRepository::insert(const domain::models::PaVerificatio
 
     try {
         // Step 1: Generate UUID using database-specific function
-        // PostgreSQL: uuid_generate_v4()
-        // Oracle: LOWER(REGEXP_REPLACE(RAWTOHEX(SYS_GUID()), '([A-F0-9]{8})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{12})', '\1-\2-\3-\4-\5'))
         std::string dbType = queryExecutor_->getDatabaseType();
-        std::string uuidQuery;
-
-        if (dbType == "postgres") {
-            uuidQuery = "SELECT uuid_generate_v4()::text as id";
-        } else {
-            // Oracle: Convert SYS_GUID() to UUID format (lowercase with hyphens)
-            uuidQuery = "SELECT LOWER(REGEXP_REPLACE(RAWTOHEX(SYS_GUID()), "
-                       "'([A-F0-9]{8})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{4})([A-F0-9]{12})', "
-                       "'\\1-\\2-\\3-\\4-\\5')) as id FROM DUAL";
-        }
-
-        Json::Value uuidResult = queryExecutor_->executeQuery(uuidQuery, {});
-        if (uuidResult.empty()) {
-            throw std::runtime_error("Failed to generate UUID");
-        }
-        std::string generatedId = uuidResult[0]["id"].asString();
+        std::string generatedId = generateIds(queryExecutor_, dbType, 1).front();
 
         // Step 2: Insert with generated UUID (no RETURNING clause needed)
-        const char* insertQuery =
-            "INSERT INTO pa_verification ("
-            "id, "  // Add id column
-            "issuing_country, document_number, verification_status, sod_hash, sod_binary, "
-            "dsc_subject_dn, dsc_serial_number, dsc_issuer_dn, dsc_fingerprint, "
-            "csca_subject_dn, csca_fingerprint, "
-            "trust_chain_valid, trust_chain_message, "
-            "sod_signature_valid, sod_signature_message, "
-            "dg_hashes_valid, dg_hashes_message, "
-            "crl_status, crl_message, "
-            "verification_message, "
-            "client_ip, user_agent, requested_by, "
-            "dsc_non_conformant, pkd_conformance_code, pkd_conformance_text"
-            ") VALUES ("
-            "$1, "  // id value
-            "$2, $3, $4, $5, $6, "
-            "$7, $8, $9, $10, "
-            "$11, $12, "
-            "$13, $14, "
-            "$15, $16, "
-            "$17, $18, "
-            "$19, $20, "
-            "$21, "
-            "$22, $23, $24, "
-            "$25, $26, $27"
-            ")";
-
-        // Database-aware boolean formatting (reuse dbType from line 41)
-        auto boolStr = [&dbType](bool val) -> std::string {
-            return common::db::boolLiteral(dbType, val);
-        };
-
-        // Convert SOD binary to hex string for BYTEA storage
-        std::string sodBinaryHex;
-        if (!verification.sodBinary.empty()) {
-            std::ostringstream hexStream;
-            hexStream << common::db::hexPrefix(dbType);
-            for (auto b : verification.sodBinary) {
-                hexStream << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(b);
-            }
-            sodBinaryHex = hexStream.str();
-        }
+        std::vector<std::string> params = insertParams(verification, generatedId, dbType);
 
-        // Encrypt PII fields (개인정보보호법 제29조 안전조치)
-        std::string encDocNum = auth::pii::encrypt(verification.documentNumber);
-        std::string encIp = auth::pii::encrypt(verification.ipAddress.value_or(""));
-        std::string encUa = auth::pii::encrypt(verification.userAgent.value_or(""));
-
-        std::vector<std::string> params = {
-            generatedId,                                                     // $1: id
-            verification.countryCode,                                        // $2
-            encDocNum,                                                       // $3: document_number (encrypted)
-            verification.verificationStatus,                                 // $4
-            verification.sodHash,                                            // $5
-            sodBinaryHex,                                                    // $6: sod_binary
-            verification.dscSubject,                                         // $7
-            verification.dscSerialNumber,                                    // $8
-            verification.dscIssuer,                                          // $9
-            "",                                                              // $10: dsc_fingerprint (not available in domain model)
-            verification.cscaSubject,                                        // $11
-            "",                                                              // $12: csca_fingerprint (not available in domain model)
-            boolStr(verification.certificateChainValid),                     // $13
-            verification.validationErrors.value_or(""),                      // $14: trust_chain_message
-            boolStr(verification.sodSignatureValid),                         // $15
-            verification.sodSignatureValid ? "SOD signature valid" : "SOD signature invalid",  // $16: sod_signature_message
-            boolStr(verification.dataGroupsValid),                           // $17
-            verification.dataGroupsValid ? "All data group hashes valid" : "Data group hash mismatch",  // $18: dg_hashes_message
-            verification.crlStatus,                                          // $19
-            verification.crlMessage.value_or(""),                            // $20
-            verification.validationErrors.value_or(""),                      // $21
-            encIp,                                                           // $22: client_ip (encrypted)
-            encUa,                                                           // $23: user_agent (encrypted)
-            verification.requestedBy,                                        // $24
-            boolStr(verification.dscNonConformant),                          // $25
-            verification.pkdConformanceCode,                                 // $26
-            verification.pkdConformanceText                                  // $27
-        };
-
-        int rowsAffected = queryExecutor_->executeCommand(insertQuery, params);
+        int rowsAffected = queryExecutor_->executeCommand(kInsertQuery, params);
 
         if (rowsAffected == 0) {
             throw std::runtime_error("Insert failed: no rows affected");
@@ -149,6 +175,33 @@ std::string PaVerificationRepository::insert(const domain::models::PaVerificatio
     }
 }
 
+std::vector<std::string> PaVerificationRepository::insertBatch(
+    const std::vector<domain::models::PaVerification>& verifications)
+{
+    if (verifications.empty()) return {};
+    spdlog::debug("[PaVerificationRepository] Inserting {} PA verification records", verifications.size());
+
+    try {
+        std::string dbType = queryExecutor_->getDatabaseType();
+        std::vector<std::string> ids = generateIds(queryExecutor_, dbType, verifications.size());
+
+        std::vector<std::vector<std::string>> paramRows;
+        paramRows.reserve(verifications.size());
+        for (size_t i = 0; i < verifications.size(); i++) {
+            paramRows.push_back(insertParams(verifications[i], ids[i], dbType));
+        }
+
+        queryExecutor_->executeBatch(kInsertQuery, paramRows);
+
+        spdlog::info("[PaVerificationRepository] {} PA verifications inserted", ids.size());
+        return ids;
+
+    } catch (const std::exception& e) {
+        spdlog::error("[PaVerificationRepository] Batch insert failed: {}", e.what());
+        throw;
+    }
+}
+
 Json::Value PaVerificationRepository::findById(const std::string& id) {
     spdlog::debug("[PaVerificationRepository] Finding PA verification by ID: {}", id);
 
@@ -63,6 +63,14 @@ public:
      */
     std::string insert(const domain::models::PaVerification& verification);
 
+    /**
+     * @brief Insert several PA verification records with one batched command
+     * @param verifications PaVerification domain models
+     * @return UUIDs of the inserted records, in input order
+     * @throws std::runtime_error on database error (no record is inserted)
+     */
+    std::vector<std::string> insertBatch(const std::vector<domain::models::PaVerification>& verifications);
+
     /**
      * @brief Find PA verification by ID
      * @param id UUID
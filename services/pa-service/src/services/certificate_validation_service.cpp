@@ -3,7 +3,8 @@
  * @brief Implementation of CertificateValidationService
  *
  * Delegates pure validation to icao::validation library:
- *   - cert_ops: verifyCertificateSignature, isSelfSigned, getSubjectDn, etc.
+ *   - cert_ops: isSelfSigned, getSubjectDn, etc.
+ *   - signature_cache: memoized signature verification (shared with TrustChainBuilder)
  *   - extension_validator: validateExtensions
  *   - algorithm_compliance: validateAlgorithmCompliance
  *   - crl_checker: CRL revocation check
@@ -16,7 +17,9 @@
  */
 
 #include "certificate_validation_service.h"
+#include "trust_snapshot_service.h"
 #include <icao/validation/cert_ops.h>
+#include <icao/validation/signature_cache.h>
 #include <icao/validation/extension_validator.h>
 #include <icao/validation/algorithm_compliance.h>
 #include <spdlog/spdlog.h>
@@ -51,16 +54,18 @@ std::string serialNumberToString(ASN1_INTEGER* serial) {
 
 CertificateValidationService::CertificateValidationService(
     repositories::LdapCertificateRepository* certRepo,
-    repositories::LdapCrlRepository* crlRepo)
-    : certRepo_(certRepo), crlRepo_(crlRepo)
+    repositories::LdapCrlRepository* crlRepo,
+    TrustSnapshotService* trustSnapshots)
+    : certRepo_(certRepo), crlRepo_(crlRepo), trustSnapshots_(trustSnapshots)
 {
     if (!certRepo_ || !crlRepo_) {
         throw std::invalid_argument("Repository dependencies cannot be null");
     }
 
     // Initialize CRL checker via library
-    crlProvider_ = std::make_unique<adapters::LdapCrlProvider>(crlRepo_);
-    crlChecker_ = std::make_unique<icao::validation::CrlChecker>(crlProvider_.get());
+    crlProvider_ = std::make_unique<adapters::LdapCrlProvider>(crlRepo_, trustSnapshots_);
+    crlChecker_ = std::make_unique<icao::validation::CrlChecker>(
+        crlProvider_.get(), &icao::validation::CrlCache::instance());
 
     spdlog::debug("CertificateValidationService initialized with icao::validation library");
 }
@@ -137,7 +142,7 @@ domain::models::CertificateChainValidation CertificateValidationService::validat
         result.countryCode = effectiveCountry;
 
         // Find CSCA certificate (multi-CSCA key rollover support)
-        allCscas = certRepo_->findAllCscasByCountry(effectiveCountry);
+        allCscas = findCscasByCountry(effectiveCountry);
         if (allCscas.empty()) {
             result.valid = false;
             result.errorCode = "CSCA_NOT_FOUND";
@@ -147,13 +152,14 @@ domain::models::CertificateChainValidation CertificateValidationService::validat
         }
 
         std::string dscIssuerDn = result.dscIssuer;
+        auto& sigCache = icao::validation::SignatureVerificationCache::instance();
 
         // Try each CSCA: match by DN, then verify signature (using library)
         X509* cscaCert = nullptr;
         for (X509* candidate : allCscas) {
             std::string candidateSubject = icao::validation::getSubjectDn(candidate);
             if (strcasecmp(dscIssuerDn.c_str(), candidateSubject.c_str()) == 0) {
-                if (icao::validation::verifyCertificateSignature(dscCert, candidate)) {
+                if (sigCache.verify(dscCert, candidate)) {
                     cscaCert = candidate;
                     spdlog::debug("PA chain validation: Found signature-verified CSCA: {}",
                                   candidateSubject.substr(0, 50));
@@ -196,12 +202,12 @@ domain::models::CertificateChainValidation CertificateValidationService::validat
 
         result.cscaExpired = icao::validation::isCertificateExpired(cscaCert);
 
-        // Verify DSC → CSCA signature (using library)
-        result.signatureVerified = icao::validation::verifyCertificateSignature(dscCert, cscaCert);
+        // Verify DSC → CSCA signature (cache hit when selected by signature above)
+        result.signatureVerified = sigCache.verify(dscCert, cscaCert);
 
         // Verify self-signed CSCA self-signature (RFC 5280 Section 6.1)
         if (result.signatureVerified && icao::validation::isSelfSigned(cscaCert)) {
-            if (!icao::validation::verifyCertificateSignature(cscaCert, cscaCert)) {
+            if (!sigCache.verify(cscaCert, cscaCert)) {
                 spdlog::error("CSCA self-signature verification FAILED - root CSCA may be tampered");
                 result.signatureVerified = false;
                 result.valid = false;
@@ -359,7 +365,13 @@ std::vector<X509*> CertificateValidationService::buildTrustChain(
     chain.push_back(dscCert);
 
     std::string issuerDn = icao::validation::getIssuerDn(dscCert);
-    X509* cscaCert = certRepo_->findCscaByIssuerDn(issuerDn, countryCode);
+    X509* cscaCert = nullptr;
+    if (auto snapshot = trustSnapshots_ ? trustSnapshots_->current() : nullptr) {
+        cscaCert = snapshot->copyCscaBySubjectDn(issuerDn);
+    }
+    if (!cscaCert) {
+        cscaCert = certRepo_->findCscaByIssuerDn(issuerDn, countryCode);
+    }
 
     if (cscaCert) {
         chain.push_back(cscaCert);
@@ -368,4 +380,24 @@ std::vector<X509*> CertificateValidationService::buildTrustChain(
     return chain;
 }
 
+std::vector<X509*> CertificateValidationService::findCscasByCountry(const std::string& countryCode) {
+    if (auto snapshot = trustSnapshots_ ? trustSnapshots_->current() : nullptr) {
+        auto cscas = snapshot->copyCscasByCountry(countryCode);
+        if (!cscas.empty()) return cscas;
+        spdlog::debug("Trust snapshot has no CSCA for {}, falling back to LDAP", countryCode);
+    }
+    return certRepo_->findAllCscasByCountry(countryCode);
+}
+
+std::string CertificateValidationService::currentCrlFingerprint(const std::string& countryCode) {
+    if (countryCode.empty()) return "";
+    auto crl = icao::validation::CrlCache::instance().get(countryCode, *crlProvider_);
+    return crl ? crl->fingerprint() : "";
+}
+
+uint64_t CertificateValidationService::currentTrustStoreGeneration() const {
+    auto snapshot = trustSnapshots_ ? trustSnapshots_->current() : nullptr;
+    return snapshot ? snapshot->cscaStore().generation() : 0;
+}
+
 } // namespace services
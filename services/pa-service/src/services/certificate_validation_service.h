@@ -25,11 +25,14 @@
 
 namespace services {
 
+class TrustSnapshotService;
+
 /**
  * @brief Certificate chain validation service (DSC to CSCA trust chain)
  *
- * Validates DSC certificates against CSCA certificates retrieved from LDAP,
- * performs CRL revocation checking, and builds trust chains per ICAO 9303.
+ * Validates DSC certificates against CSCA certificates (from the in-memory
+ * trust snapshot when available, LDAP otherwise), performs CRL revocation
+ * checking, and builds trust chains per ICAO 9303.
  *
  * Pure validation operations (signature, extensions, algorithms) are delegated
  * to the icao::validation shared library.
@@ -38,6 +41,7 @@ class CertificateValidationService {
 private:
     repositories::LdapCertificateRepository* certRepo_;
     repositories::LdapCrlRepository* crlRepo_;
+    TrustSnapshotService* trustSnapshots_;
 
     // CRL checker (via library)
     std::unique_ptr<adapters::LdapCrlProvider> crlProvider_;
@@ -46,10 +50,12 @@ private:
 public:
     /**
      * @brief Constructor with repository dependencies
+     * @param trustSnapshots Optional CSCA/CRL snapshot (LDAP used on cold start or miss)
      */
     CertificateValidationService(
         repositories::LdapCertificateRepository* certRepo,
-        repositories::LdapCrlRepository* crlRepo
+        repositories::LdapCrlRepository* crlRepo,
+        TrustSnapshotService* trustSnapshots = nullptr
     );
 
     ~CertificateValidationService() = default;
@@ -67,6 +73,27 @@ public:
      * @brief Build trust chain from DSC to root CSCA
      */
     std::vector<X509*> buildTrustChain(X509* dscCert, const std::string& countryCode);
+
+    /**
+     * @brief Fingerprint of the country CRL that CRL checks currently see
+     *
+     * Served from the shared CrlCache, so it only reaches LDAP when the cached
+     * entry is stale.
+     *
+     * @return SHA-256 of the CRL (hex), or empty if the country has no CRL
+     */
+    std::string currentCrlFingerprint(const std::string& countryCode);
+
+    /**
+     * @brief Generation of the CSCA trust store chains are built against
+     * @return CscaTrustStore::generation() of the current trust snapshot, or 0
+     *         when CSCAs come from LDAP (no snapshot loaded or snapshots disabled)
+     */
+    uint64_t currentTrustStoreGeneration() const;
+
+private:
+    /// CSCAs + link certificates of a country (caller must X509_free each)
+    std::vector<X509*> findCscasByCountry(const std::string& countryCode);
 };
 
 } // namespace services
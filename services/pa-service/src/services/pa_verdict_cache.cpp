@@ -0,0 +1,127 @@
+/**
+ * @file pa_verdict_cache.cpp
+ * @brief PaVerdictCache implementation
+ */
+
+#include "pa_verdict_cache.h"
+#include <openssl/evp.h>
+#include <spdlog/spdlog.h>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace services {
+
+PaVerdictCache::PaVerdictCache(size_t capacity, std::chrono::seconds ttl)
+    : capacity_(capacity > 0 ? capacity : 1)
+    , ttl_(ttl)
+{
+}
+
+std::string PaVerdictCache::makeKey(const std::string& sodHash,
+                                    const std::map<std::string, std::vector<uint8_t>>& dataGroups,
+                                    const std::string& countryCode) {
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        throw std::runtime_error("Memory allocation failed for verdict cache key");
+    }
+    // Length-prefix every field so different splits never produce the same input
+    auto update = [ctx](const void* data, size_t len) {
+        uint64_t prefix = len;
+        EVP_DigestUpdate(ctx, &prefix, sizeof(prefix));
+        EVP_DigestUpdate(ctx, data, len);
+    };
+
+    EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+    update(countryCode.data(), countryCode.size());
+    update(sodHash.data(), sodHash.size());
+    for (const auto& [dgNum, dgData] : dataGroups) {
+        update(dgNum.data(), dgNum.size());
+        update(dgData.data(), dgData.size());
+    }
+
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLen = 0;
+    EVP_DigestFinal_ex(ctx, digest, &digestLen);
+    EVP_MD_CTX_free(ctx);
+
+    std::ostringstream key;
+    for (unsigned int i = 0; i < digestLen; i++) {
+        key << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
+    }
+    return key.str();
+}
+
+std::shared_ptr<const PaVerdict> PaVerdictCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return nullptr;
+
+    if (std::chrono::steady_clock::now() - it->second.storedAt > ttl_) {
+        eraseLocked(it);
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lruPos);
+    return it->second.verdict;
+}
+
+std::shared_ptr<const PaVerdict> PaVerdictCache::findCurrent(
+    const std::string& key,
+    uint64_t trustStoreGeneration,
+    const std::function<std::string(const std::string& countryCode)>& crlFingerprintOf) {
+    auto verdict = find(key);
+    if (!verdict) return nullptr;
+
+    if (verdict->trustStoreGeneration != trustStoreGeneration) {
+        spdlog::info("[PA] CSCA trust store changed since cached verdict, re-verifying");
+    } else if (crlFingerprintOf(verdict->crlCountry) != verdict->crlFingerprint) {
+        spdlog::info("[PA] CRL for {} changed since cached verdict, re-verifying", verdict->crlCountry);
+    } else {
+        return verdict;
+    }
+    erase(key);
+    return nullptr;
+}
+
+void PaVerdictCache::store(const std::string& key, std::shared_ptr<const PaVerdict> verdict) {
+    if (!verdict) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        it->second.verdict = std::move(verdict);
+        it->second.storedAt = std::chrono::steady_clock::now();
+        lru_.splice(lru_.begin(), lru_, it->second.lruPos);
+        return;
+    }
+
+    if (entries_.size() >= capacity_) {
+        eraseLocked(entries_.find(lru_.back()));
+    }
+    lru_.push_front(key);
+    entries_.emplace(key, Entry{std::move(verdict), std::chrono::steady_clock::now(), lru_.begin()});
+}
+
+void PaVerdictCache::erase(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) eraseLocked(it);
+}
+
+void PaVerdictCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+}
+
+size_t PaVerdictCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void PaVerdictCache::eraseLocked(std::unordered_map<std::string, Entry>::iterator it) {
+    lru_.erase(it->second.lruPos);
+    entries_.erase(it);
+}
+
+} // namespace services
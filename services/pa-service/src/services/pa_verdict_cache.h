@@ -0,0 +1,126 @@
+/**
+ * @file pa_verdict_cache.h
+ * @brief Bounded LRU/TTL cache of PA trust verdicts
+ *
+ * Border-control clients resend the same SOD and data groups several times
+ * within minutes (retries, multi-lane kiosks). A cached verdict lets
+ * PaVerificationService skip the CMS parse, CSCA lookup, chain and SOD
+ * signature verification, CRL check and DG hashing for those repeats; each
+ * request is still recorded as its own verification row.
+ *
+ * Key: SHA-256 over the requested country, the SOD hash and every provided
+ * data group (number + content). A verdict also remembers the fingerprint of
+ * the country CRL it was checked against and the CSCA trust store generation
+ * its chain was built from; findCurrent() drops the entry when either changes.
+ * Entries expire after the TTL, which bounds staleness for CSCAs served from
+ * LDAP (no snapshot) and time-dependent results (expiry status).
+ *
+ * Thread-safe (handler threads share one instance).
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <openssl/x509.h>
+#include "../domain/models/certificate_chain_validation.h"
+
+namespace services {
+
+/**
+ * @brief Expected vs. computed hash of one submitted data group
+ */
+struct DataGroupHashCheck {
+    std::string expectedHash;  ///< From the SOD (empty if the SOD has no hash for this DG)
+    std::string actualHash;    ///< Computed with the SOD hash algorithm
+    bool valid() const { return actualHash == expectedHash; }
+};
+
+/**
+ * @brief Trust-relevant result of one PA verification (immutable once cached)
+ */
+struct PaVerdict {
+    domain::models::CertificateChainValidation certValidation;
+    bool sodSignatureValid = false;
+    std::string signatureAlgorithm;
+    std::string hashAlgorithm;
+    std::map<std::string, DataGroupHashCheck> dataGroups;  ///< DG number → hash check
+    std::shared_ptr<X509> dscCertificate;                  ///< For DSC auto-registration
+
+    std::string crlCountry;      ///< Country whose CRL was checked
+    std::string crlFingerprint;  ///< SHA-256 of that CRL (empty if none)
+    uint64_t trustStoreGeneration = 0;  ///< CSCA trust store the chain was built from (0 = LDAP)
+};
+
+class PaVerdictCache {
+public:
+    /**
+     * @param capacity Maximum cached verdicts (least recently used evicted)
+     * @param ttl Maximum age of a verdict
+     */
+    PaVerdictCache(size_t capacity, std::chrono::seconds ttl);
+
+    PaVerdictCache(const PaVerdictCache&) = delete;
+    PaVerdictCache& operator=(const PaVerdictCache&) = delete;
+
+    /**
+     * @brief Cache key for a verification request
+     * @param sodHash SHA-256 (hex) of the SOD bytes
+     * @param dataGroups Submitted data groups
+     * @param countryCode Requested issuing country (may be empty)
+     */
+    static std::string makeKey(const std::string& sodHash,
+                               const std::map<std::string, std::vector<uint8_t>>& dataGroups,
+                               const std::string& countryCode);
+
+    /// Verdict for key, or nullptr if absent or older than the TTL
+    std::shared_ptr<const PaVerdict> find(const std::string& key);
+
+    /**
+     * @brief Verdict for key if it still reflects the current trust state
+     *
+     * Like find(), but also drops the entry (and returns nullptr) when the
+     * CSCA trust store generation or the fingerprint of the verdict's CRL
+     * country differs from the current one.
+     *
+     * @param trustStoreGeneration Current CSCA trust store generation
+     * @param crlFingerprintOf Current CRL fingerprint for a country
+     */
+    std::shared_ptr<const PaVerdict> findCurrent(
+        const std::string& key,
+        uint64_t trustStoreGeneration,
+        const std::function<std::string(const std::string& countryCode)>& crlFingerprintOf);
+
+    void store(const std::string& key, std::shared_ptr<const PaVerdict> verdict);
+    void erase(const std::string& key);
+    void clear();
+
+    size_t size() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<const PaVerdict> verdict;
+        std::chrono::steady_clock::time_point storedAt;
+        std::list<std::string>::iterator lruPos;
+    };
+
+    void eraseLocked(std::unordered_map<std::string, Entry>::iterator it);
+
+    size_t capacity_;
+    std::chrono::seconds ttl_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> lru_;  ///< Most recently used first
+};
+
+} // namespace services
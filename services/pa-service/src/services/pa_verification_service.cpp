@@ -4,35 +4,132 @@
  */
 
 #include "pa_verification_service.h"
+#include "thread_pool.h"
 #include <data_group.h>
 #include <spdlog/spdlog.h>
 #include <openssl/evp.h>
 #include <stdexcept>
+#include <atomic>
 #include <chrono>
 #include <iomanip>
+#include <optional>
 #include <sstream>
 
 namespace services {
 
+namespace {
+
+std::string sha256Hex(const std::vector<uint8_t>& data) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLen = 0;
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        spdlog::error("EVP_MD_CTX_new() allocation failed in PA verification");
+        throw std::runtime_error("Memory allocation failed for hash computation");
+    }
+    EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+    EVP_DigestUpdate(ctx, data.data(), data.size());
+    EVP_DigestFinal_ex(ctx, digest, &digestLen);
+    EVP_MD_CTX_free(ctx);
+    std::ostringstream hashStream;
+    for (unsigned int i = 0; i < digestLen; i++) {
+        hashStream << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
+    }
+    return hashStream.str();
+}
+
+std::string certFingerprint(X509* cert) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLen = 0;
+    if (X509_digest(cert, EVP_sha256(), digest, &digestLen) != 1) return "";
+    std::ostringstream hex;
+    for (unsigned int i = 0; i < digestLen; i++) {
+        hex << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
+    }
+    return hex.str();
+}
+
+} // anonymous namespace
+
 PaVerificationService::PaVerificationService(
     repositories::PaVerificationRepository* paRepo,
     repositories::DataGroupRepository* dgRepo,
     icao::SodParser* sodParser,
     CertificateValidationService* certValidator,
     icao::DgParser* dgParser,
-    DscAutoRegistrationService* dscAutoRegService)
+    DscAutoRegistrationService* dscAutoRegService,
+    PaVerdictCache* verdictCache,
+    common::ThreadPool* workerPool)
     : paRepo_(paRepo),
       dgRepo_(dgRepo),
       sodParser_(sodParser),
       certValidator_(certValidator),
       dgParser_(dgParser),
-      dscAutoRegService_(dscAutoRegService)
+      dscAutoRegService_(dscAutoRegService),
+      verdictCache_(verdictCache),
+      workerPool_(workerPool)
 {
     if (!paRepo_ || !sodParser_ || !certValidator_ || !dgParser_) {
         throw std::invalid_argument("Service dependencies cannot be null");
     }
-    spdlog::debug("PaVerificationService initialized (dgRepo={}, dscAutoReg={})",
-        dgRepo_ ? "yes" : "no", dscAutoRegService_ ? "yes" : "no");
+    spdlog::debug("PaVerificationService initialized (dgRepo={}, dscAutoReg={}, verdictCache={})",
+        dgRepo_ ? "yes" : "no", dscAutoRegService_ ? "yes" : "no", verdictCache_ ? "yes" : "no");
+}
+
+std::shared_ptr<PaVerdict> PaVerificationService::computeVerdict(
+    const std::vector<uint8_t>& sodData,
+    const std::map<std::string, std::vector<uint8_t>>& dataGroups,
+    const std::string& countryCode,
+    std::string& error)
+{
+    // Step 1: Parse SOD (decoded once, shared with signature verification in Step 3)
+    std::optional<icao::ParsedSod> parsedSod;
+    try {
+        parsedSod.emplace(sodData);
+    } catch (const std::exception& e) {
+        error = std::string("SOD parsing failed: ") + e.what();
+        return nullptr;
+    }
+    icao::models::SodData sod = sodParser_->parseSod(*parsedSod);
+    if (!sod.parsingSuccess || !sod.dscCertificate) {
+        error = "SOD parsing failed: " + sod.parsingErrors.value_or("Unknown error");
+        return nullptr;
+    }
+
+    auto verdict = std::make_shared<PaVerdict>();
+    verdict->signatureAlgorithm = sod.signatureAlgorithm;
+    verdict->hashAlgorithm = sod.hashAlgorithm;
+
+    // Step 2: Validate certificate chain (with point-in-time validation if signing time available).
+    // Generation taken first: a snapshot published mid-validation makes the verdict stale, not current
+    verdict->trustStoreGeneration = certValidator_->currentTrustStoreGeneration();
+    verdict->certValidation = certValidator_->validateCertificateChain(
+        sod.dscCertificate,
+        countryCode,
+        sod.signingTime  // Pass SOD signing time for ICAO 9303 Part 12 point-in-time validation
+    );
+
+    // Step 3: Verify SOD signature
+    verdict->sodSignatureValid = sodParser_->verifySodSignature(*parsedSod, sod.dscCertificate);
+
+    // Step 4: Hash every submitted data group once (results are also what gets saved)
+    for (const auto& [dgNum, dgData] : dataGroups) {
+        DataGroupHashCheck check;
+        check.expectedHash = sod.getDataGroupHash(dgNum);
+        check.actualHash = dgParser_->computeHash(dgData, sod.hashAlgorithm);
+        verdict->dataGroups[dgNum] = std::move(check);
+    }
+
+    // Take ownership of the DSC for auto-registration
+    verdict->dscCertificate.reset(sod.dscCertificate, X509_free);
+    sod.dscCertificate = nullptr;
+
+    // CRL the chain was checked against (cache entries are dropped when it changes)
+    verdict->crlCountry = verdict->certValidation.countryCode;
+    if (verdictCache_) {
+        verdict->crlFingerprint = certValidator_->currentCrlFingerprint(verdict->crlCountry);
+    }
+    return verdict;
 }
 
 Json::Value PaVerificationService::verifyPassiveAuthentication(
@@ -44,62 +141,118 @@ Json::Value PaVerificationService::verifyPassiveAuthentication(
     const std::string& userAgent,
     const std::string& requestedBy)
 {
-    spdlog::info("Starting PA verification for document: {}, country: {}", documentNumber, countryCode);
+    PaVerificationRequest request;
+    request.sodData = sodData;
+    request.dataGroups = dataGroups;
+    request.documentNumber = documentNumber;
+    request.countryCode = countryCode;
+    request.clientIp = clientIp;
+    request.userAgent = userAgent;
+    request.requestedBy = requestedBy;
+
+    PreparedVerification prepared = prepareVerification(request);
+    if (!prepared.errorResponse.isNull()) {
+        return prepared.errorResponse;
+    }
 
-    auto startTime = std::chrono::steady_clock::now();
     Json::Value response;
-
     try {
-        // Step 1: Parse SOD
-        icao::models::SodData sod = sodParser_->parseSod(sodData);
-        if (!sod.parsingSuccess || !sod.dscCertificate) {
-            response["success"] = false;
-            response["error"] = "SOD parsing failed: " + sod.parsingErrors.value_or("Unknown error");
-            return response;
+        // Save to database
+        std::string verificationId = paRepo_->insert(prepared.verification);
+
+        // Step 5.5: Auto-register DSC in local PKD if not already present
+        DscRegistrationResult dscRegResult;
+        if (dscAutoRegService_ && prepared.verdict->dscCertificate) {
+            try {
+                dscRegResult = dscAutoRegService_->registerDscFromSod(
+                    prepared.verdict->dscCertificate.get(),
+                    prepared.verification.countryCode,
+                    verificationId,
+                    prepared.verification.verificationStatus
+                );
+            } catch (const std::exception& e) {
+                spdlog::error("[PA] DSC auto-registration failed (non-fatal): {}", e.what());
+            }
         }
 
-        // Step 2: Validate certificate chain (with point-in-time validation if signing time available)
-        auto certValidation = certValidator_->validateCertificateChain(
-            sod.dscCertificate,
-            countryCode,
-            sod.signingTime  // Pass SOD signing time for ICAO 9303 Part 12 point-in-time validation
-        );
+        // Save data groups to database for later retrieval
+        if (dgRepo_) {
+            for (const auto& dg : dataGroupRows(prepared, request)) {
+                dgRepo_->insert(dg, verificationId);
+            }
+            spdlog::info("Saved {} data groups for verification {}", dataGroups.size(), verificationId);
+        }
 
-        // Step 3: Verify SOD signature
-        bool sodSignatureValid = sodParser_->verifySodSignature(sodData, sod.dscCertificate);
+        response = buildResponse(prepared, request, verificationId, dscRegResult);
+        spdlog::info("PA verification completed: {}", prepared.verification.verificationStatus);
 
-        // Step 4: Verify data group hashes
-        int totalDgs = dataGroups.size();
-        int validDgs = 0;
-        Json::Value dgResults = Json::objectValue;  // Changed to object
+    } catch (const std::exception& e) {
+        spdlog::error("PA verification failed: {}", e.what());
+        response = Json::Value();
+        response["success"] = false;
+        response["error"] = e.what();
+    }
 
-        for (const auto& [dgNum, dgData] : dataGroups) {
-            std::string expectedHash = sod.getDataGroupHash(dgNum);
-            if (expectedHash.empty()) continue;
+    return response;
+}
 
-            // Compute actual hash
-            std::string computedHash = dgParser_->computeHash(dgData, sod.hashAlgorithm);
-            bool hashValid = (computedHash == expectedHash);
-            if (hashValid) validDgs++;
+PaVerificationService::PreparedVerification PaVerificationService::prepareVerification(
+    const PaVerificationRequest& request)
+{
+    spdlog::info("Starting PA verification for document: {}, country: {}",
+                 request.documentNumber, request.countryCode);
 
-            // Create DG key in format "DG1", "DG2", etc.
-            std::string dgKey = "DG" + dgNum;
+    PreparedVerification prepared;
+    prepared.startTime = std::chrono::steady_clock::now();
 
-            Json::Value dgResult;
-            dgResult["valid"] = hashValid;
-            dgResult["expectedHash"] = expectedHash;
-            dgResult["actualHash"] = computedHash;  // Frontend expects "actualHash"
-            dgResults[dgKey] = dgResult;  // Use key-based assignment
+    try {
+        std::string sodHash = sha256Hex(request.sodData);
+
+        // Steps 1-4: reuse a cached verdict for a repeated SOD + DGs, unless the
+        // CSCA trust store or the country CRL changed
+        std::string cacheKey;
+        std::shared_ptr<const PaVerdict> verdict;
+        if (verdictCache_) {
+            cacheKey = PaVerdictCache::makeKey(sodHash, request.dataGroups, request.countryCode);
+            verdict = verdictCache_->findCurrent(cacheKey, certValidator_->currentTrustStoreGeneration(),
+                [this](const std::string& country) { return certValidator_->currentCrlFingerprint(country); });
         }
+        prepared.verdictCached = (verdict != nullptr);
+
+        if (!verdict) {
+            std::string error;
+            auto computed = computeVerdict(request.sodData, request.dataGroups, request.countryCode, error);
+            if (!computed) {
+                prepared.errorResponse["success"] = false;
+                prepared.errorResponse["error"] = error;
+                return prepared;
+            }
+            // Only positive trust results: a failed chain may come from a transient LDAP error
+            if (verdictCache_ && computed->certValidation.valid && computed->sodSignatureValid) {
+                verdictCache_->store(cacheKey, computed);
+            }
+            verdict = std::move(computed);
+        } else {
+            spdlog::info("[PA] Using cached verdict for SOD {}", sodHash.substr(0, 16));
+        }
+
+        const auto& certValidation = verdict->certValidation;
+        bool sodSignatureValid = verdict->sodSignatureValid;
 
+        // Data groups are valid if every submitted DG the SOD has a hash for matches
+        int totalDgs = request.dataGroups.size();
+        int validDgs = 0;
+        for (const auto& [dgNum, check] : verdict->dataGroups) {
+            if (!check.expectedHash.empty() && check.valid()) validDgs++;
+        }
         bool dataGroupsValid = (validDgs == totalDgs);
 
-        // Step 5: Create PA verification record
-        domain::models::PaVerification verification;
-        verification.documentNumber = documentNumber;
+        // Step 5: Create PA verification record (every request is recorded, cached or not)
+        domain::models::PaVerification& verification = prepared.verification;
+        verification.documentNumber = request.documentNumber;
         // Use country code extracted from DSC issuer if not provided in request
         // Fallback to "XX" if neither source provides a country code (e.g., test certificates without C= field)
-        std::string effectiveCountry = countryCode.empty() ? certValidation.countryCode : countryCode;
+        std::string effectiveCountry = request.countryCode.empty() ? certValidation.countryCode : request.countryCode;
         verification.countryCode = effectiveCountry.empty() ? "XX" : effectiveCountry;
         verification.verificationStatus = (certValidation.valid && sodSignatureValid && dataGroupsValid) ? "VALID" : "INVALID";
 
@@ -121,130 +274,251 @@ Json::Value PaVerificationService::verifyPassiveAuthentication(
 
         verification.expirationStatus = certValidation.expirationStatus;
 
-        // Set SOD binary and compute hash
-        verification.sodBinary = sodData;
-        {
-            unsigned char digest[EVP_MAX_MD_SIZE];
-            unsigned int digestLen = 0;
-            EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-            if (!ctx) {
-                spdlog::error("EVP_MD_CTX_new() allocation failed in PA verification");
-                throw std::runtime_error("Memory allocation failed for hash computation");
-            }
-            EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
-            EVP_DigestUpdate(ctx, sodData.data(), sodData.size());
-            EVP_DigestFinal_ex(ctx, digest, &digestLen);
-            EVP_MD_CTX_free(ctx);
-            std::ostringstream hashStream;
-            for (unsigned int i = 0; i < digestLen; i++) {
-                hashStream << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
-            }
-            verification.sodHash = hashStream.str();
-        }
+        // Set SOD binary and hash
+        verification.sodBinary = request.sodData;
+        verification.sodHash = sodHash;
 
         // Client metadata (from handler)
-        verification.ipAddress = clientIp;
-        verification.userAgent = userAgent;
-        verification.requestedBy = requestedBy;
+        verification.ipAddress = request.clientIp;
+        verification.userAgent = request.userAgent;
+        verification.requestedBy = request.requestedBy;
 
         // DSC conformance data (from certificate validation)
         verification.dscNonConformant = certValidation.dscNonConformant;
         verification.pkdConformanceCode = certValidation.pkdConformanceCode;
         verification.pkdConformanceText = certValidation.pkdConformanceText;
 
-        // Save to database
-        std::string verificationId = paRepo_->insert(verification);
+        prepared.verdict = std::move(verdict);
 
-        // Step 5.5: Auto-register DSC in local PKD if not already present
-        DscRegistrationResult dscRegResult;
-        if (dscAutoRegService_ && sod.dscCertificate) {
-            try {
-                dscRegResult = dscAutoRegService_->registerDscFromSod(
-                    sod.dscCertificate,
-                    verification.countryCode,
-                    verificationId,
-                    verification.verificationStatus
-                );
-            } catch (const std::exception& e) {
-                spdlog::error("[PA] DSC auto-registration failed (non-fatal): {}", e.what());
+    } catch (const std::exception& e) {
+        spdlog::error("PA verification failed: {}", e.what());
+        prepared.errorResponse = Json::Value();
+        prepared.errorResponse["success"] = false;
+        prepared.errorResponse["error"] = e.what();
+    }
+
+    return prepared;
+}
+
+std::vector<icao::models::DataGroup> PaVerificationService::dataGroupRows(
+    const PreparedVerification& prepared, const PaVerificationRequest& request) const
+{
+    std::vector<icao::models::DataGroup> rows;
+    rows.reserve(request.dataGroups.size());
+    for (const auto& [dgNum, dgData] : request.dataGroups) {
+        const auto& check = prepared.verdict->dataGroups.at(dgNum);
+        icao::models::DataGroup dg;
+        dg.dgNumber = dgNum;
+        dg.expectedHash = check.expectedHash;
+        dg.actualHash = check.actualHash;
+        dg.hashValid = check.valid();
+        dg.hashAlgorithm = prepared.verdict->hashAlgorithm;
+        dg.rawData = dgData;
+        dg.dataSize = dgData.size();
+        rows.push_back(std::move(dg));
+    }
+    return rows;
+}
+
+Json::Value PaVerificationService::buildResponse(
+    const PreparedVerification& prepared,
+    const PaVerificationRequest& request,
+    const std::string& verificationId,
+    const DscRegistrationResult& dscRegResult) const
+{
+    const PaVerdict& verdict = *prepared.verdict;
+    const auto& certValidation = verdict.certValidation;
+
+    // Data group results (only DGs the SOD has a hash for)
+    int totalDgs = request.dataGroups.size();
+    int validDgs = 0;
+    Json::Value dgResults = Json::objectValue;  // Changed to object
+    for (const auto& [dgNum, check] : verdict.dataGroups) {
+        if (check.expectedHash.empty()) continue;
+        bool hashValid = check.valid();
+        if (hashValid) validDgs++;
+
+        // Create DG key in format "DG1", "DG2", etc.
+        std::string dgKey = "DG" + dgNum;
+
+        Json::Value dgResult;
+        dgResult["valid"] = hashValid;
+        dgResult["expectedHash"] = check.expectedHash;
+        dgResult["actualHash"] = check.actualHash;  // Frontend expects "actualHash"
+        dgResults[dgKey] = dgResult;  // Use key-based assignment
+    }
+
+    // Calculate processing time
+    auto endTime = std::chrono::steady_clock::now();
+    auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - prepared.startTime).count();
+
+    // Generate ISO 8601 timestamp
+    auto now = std::chrono::system_clock::now();
+    auto time_t = std::chrono::system_clock::to_time_t(now);
+    std::ostringstream tsStream;
+    std::tm tm_buf{};
+    localtime_r(&time_t, &tm_buf);
+    tsStream << std::put_time(&tm_buf, "%Y-%m-%dT%H:%M:%S");
+
+    // Build response data
+    Json::Value data;
+    data["verificationId"] = verificationId;
+    data["status"] = prepared.verification.verificationStatus;
+    data["verificationTimestamp"] = tsStream.str();
+    data["processingDurationMs"] = static_cast<Json::Int64>(durationMs);
+    data["issuingCountry"] = prepared.verification.countryCode;
+    data["documentNumber"] = request.documentNumber;
+    data["certificateChainValidation"] = certValidation.toJson();
+    data["sodSignatureValidation"] = Json::Value();
+    data["sodSignatureValidation"]["valid"] = verdict.sodSignatureValid;
+    data["sodSignatureValidation"]["algorithm"] = verdict.signatureAlgorithm;
+    data["sodSignatureValidation"]["hashAlgorithm"] = verdict.hashAlgorithm;
+    data["sodSignatureValidation"]["signatureAlgorithm"] = verdict.signatureAlgorithm;
+    data["dataGroupValidation"] = Json::Value();
+    data["dataGroupValidation"]["details"] = dgResults;
+    data["dataGroupValidation"]["totalGroups"] = totalDgs;
+    data["dataGroupValidation"]["validGroups"] = validDgs;
+    data["dataGroupValidation"]["invalidGroups"] = totalDgs - validDgs;
+    if (prepared.verdictCached) {
+        data["cachedVerdict"] = true;
+    }
+
+    // DSC pending registration result
+    if (dscRegResult.success) {
+        Json::Value dscAutoReg;
+        dscAutoReg["registered"] = dscRegResult.alreadyRegistered;
+        dscAutoReg["newlyRegistered"] = dscRegResult.newlyRegistered;
+        dscAutoReg["pendingApproval"] = dscRegResult.pendingApproval;
+        dscAutoReg["alreadyRegistered"] = dscRegResult.alreadyRegistered;
+        dscAutoReg["pendingId"] = dscRegResult.pendingId;
+        dscAutoReg["certificateId"] = dscRegResult.certificateId;
+        dscAutoReg["fingerprint"] = dscRegResult.fingerprint;
+        dscAutoReg["countryCode"] = dscRegResult.countryCode;
+        data["dscAutoRegistration"] = dscAutoReg;
+    }
+
+    // Wrap in ApiResponse format
+    Json::Value response;
+    response["success"] = true;
+    response["data"] = data;
+    return response;
+}
+
+// --- Batch verification ---
+
+struct PaVerificationService::BatchState {
+    std::vector<PaVerificationRequest> requests;
+    std::vector<PreparedVerification> prepared;
+    std::atomic<size_t> remaining{0};
+    BatchCallback done;
+};
+
+void PaVerificationService::verifyPassiveAuthenticationBatch(
+    std::vector<PaVerificationRequest> requests,
+    BatchCallback done)
+{
+    if (requests.empty()) {
+        done({});
+        return;
+    }
+
+    auto state = std::make_shared<BatchState>();
+    state->requests = std::move(requests);
+    state->prepared.resize(state->requests.size());
+    state->remaining = state->requests.size();
+    state->done = std::move(done);
+
+    spdlog::info("[PA] Batch verification of {} documents ({} workers)",
+                 state->requests.size(), workerPool_ ? workerPool_->workerCount() : 1);
+
+    for (size_t i = 0; i < state->requests.size(); i++) {
+        auto task = [this, state, i]() {
+            state->prepared[i] = prepareVerification(state->requests[i]);
+            // The last document to finish persists the whole batch
+            if (state->remaining.fetch_sub(1) == 1) {
+                finishBatch(*state);
             }
+        };
+        if (!workerPool_ || !workerPool_->submit(task)) {
+            task();
         }
+    }
+}
+
+void PaVerificationService::finishBatch(BatchState& state) {
+    const size_t count = state.requests.size();
+    std::vector<Json::Value> results(count);
+
+    std::vector<size_t> verified;
+    std::vector<domain::models::PaVerification> rows;
+    for (size_t i = 0; i < count; i++) {
+        if (!state.prepared[i].errorResponse.isNull()) {
+            results[i] = state.prepared[i].errorResponse;
+        } else {
+            verified.push_back(i);
+            rows.push_back(state.prepared[i].verification);
+        }
+    }
+
+    try {
+        // One batched insert for all verification records, then one for all data groups
+        std::vector<std::string> ids = rows.empty() ? std::vector<std::string>{} : paRepo_->insertBatch(rows);
 
-        // Save data groups to database for later retrieval
         if (dgRepo_) {
-            for (const auto& [dgNum, dgData] : dataGroups) {
-                icao::models::DataGroup dg;
-                dg.dgNumber = dgNum;
-                dg.expectedHash = sod.getDataGroupHash(dgNum);
-                dg.actualHash = dgParser_->computeHash(dgData, sod.hashAlgorithm);
-                dg.hashValid = (dg.actualHash == dg.expectedHash);
-                dg.hashAlgorithm = sod.hashAlgorithm;
-                dg.rawData = dgData;
-                dg.dataSize = dgData.size();
-                dgRepo_->insert(dg, verificationId);
+            std::vector<std::pair<std::string, icao::models::DataGroup>> dgRows;
+            for (size_t k = 0; k < verified.size(); k++) {
+                size_t i = verified[k];
+                for (auto& dg : dataGroupRows(state.prepared[i], state.requests[i])) {
+                    dgRows.emplace_back(ids[k], std::move(dg));
+                }
             }
-            spdlog::info("Saved {} data groups for verification {}", dataGroups.size(), verificationId);
+            if (!dgRows.empty()) dgRepo_->insertBatch(dgRows);
         }
 
-        // Calculate processing time
-        auto endTime = std::chrono::steady_clock::now();
-        auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
-
-        // Generate ISO 8601 timestamp
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        std::ostringstream tsStream;
-        std::tm tm_buf{};
-        localtime_r(&time_t, &tm_buf);
-        tsStream << std::put_time(&tm_buf, "%Y-%m-%dT%H:%M:%S");
-
-        // Build response data
-        Json::Value data;
-        data["verificationId"] = verificationId;
-        data["status"] = verification.verificationStatus;
-        data["verificationTimestamp"] = tsStream.str();
-        data["processingDurationMs"] = static_cast<Json::Int64>(durationMs);
-        data["issuingCountry"] = verification.countryCode;
-        data["documentNumber"] = documentNumber;
-        data["certificateChainValidation"] = certValidation.toJson();
-        data["sodSignatureValidation"] = Json::Value();
-        data["sodSignatureValidation"]["valid"] = sodSignatureValid;
-        data["sodSignatureValidation"]["algorithm"] = sod.signatureAlgorithm;
-        data["sodSignatureValidation"]["hashAlgorithm"] = sod.hashAlgorithm;
-        data["sodSignatureValidation"]["signatureAlgorithm"] = sod.signatureAlgorithm;
-        data["dataGroupValidation"] = Json::Value();
-        data["dataGroupValidation"]["details"] = dgResults;
-        data["dataGroupValidation"]["totalGroups"] = totalDgs;
-        data["dataGroupValidation"]["validGroups"] = validDgs;
-        data["dataGroupValidation"]["invalidGroups"] = totalDgs - validDgs;
-
-        // DSC pending registration result
-        if (dscRegResult.success) {
-            Json::Value dscAutoReg;
-            dscAutoReg["registered"] = dscRegResult.alreadyRegistered;
-            dscAutoReg["newlyRegistered"] = dscRegResult.newlyRegistered;
-            dscAutoReg["pendingApproval"] = dscRegResult.pendingApproval;
-            dscAutoReg["alreadyRegistered"] = dscRegResult.alreadyRegistered;
-            dscAutoReg["pendingId"] = dscRegResult.pendingId;
-            dscAutoReg["certificateId"] = dscRegResult.certificateId;
-            dscAutoReg["fingerprint"] = dscRegResult.fingerprint;
-            dscAutoReg["countryCode"] = dscRegResult.countryCode;
-            data["dscAutoRegistration"] = dscAutoReg;
-        }
+        // DSC registration once per distinct DSC in the batch
+        std::map<std::string, DscRegistrationResult> dscResults;
+        for (size_t k = 0; k < verified.size(); k++) {
+            size_t i = verified[k];
+            const auto& prepared = state.prepared[i];
+
+            DscRegistrationResult dscRegResult;
+            X509* dsc = prepared.verdict->dscCertificate.get();
+            if (dscAutoRegService_ && dsc) {
+                std::string fingerprint = certFingerprint(dsc);
+                auto it = dscResults.find(fingerprint);
+                if (it != dscResults.end()) {
+                    dscRegResult = it->second;
+                    dscRegResult.newlyRegistered = false;
+                } else {
+                    try {
+                        dscRegResult = dscAutoRegService_->registerDscFromSod(
+                            dsc,
+                            prepared.verification.countryCode,
+                            ids[k],
+                            prepared.verification.verificationStatus
+                        );
+                    } catch (const std::exception& e) {
+                        spdlog::error("[PA] DSC auto-registration failed (non-fatal): {}", e.what());
+                    }
+                    dscResults.emplace(fingerprint, dscRegResult);
+                }
+            }
 
-        // Wrap in ApiResponse format
-        response["success"] = true;
-        response["data"] = data;
+            results[i] = buildResponse(prepared, state.requests[i], ids[k], dscRegResult);
+        }
 
-        spdlog::info("PA verification completed: {}", verification.verificationStatus);
+        spdlog::info("[PA] Batch verification completed: {} documents, {} persisted", count, verified.size());
 
     } catch (const std::exception& e) {
-        spdlog::error("PA verification failed: {}", e.what());
-        response["success"] = false;
-        response["error"] = e.what();
+        spdlog::error("[PA] Batch persistence failed: {}", e.what());
+        for (size_t i : verified) {
+            results[i] = Json::Value();
+            results[i]["success"] = false;
+            results[i]["error"] = e.what();
+        }
     }
 
-    return response;
+    state.done(std::move(results));
 }
 
 Json::Value PaVerificationService::getVerificationHistory(
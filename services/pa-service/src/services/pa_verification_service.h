@@ -11,6 +11,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <functional>
+#include <chrono>
 #include <json/json.h>
 #include "../domain/models/pa_verification.h"
 #include "../repositories/pa_verification_repository.h"
@@ -18,10 +20,30 @@
 #include <sod_parser.h>
 #include "certificate_validation_service.h"
 #include "dsc_auto_registration_service.h"
+#include "pa_verdict_cache.h"
 #include <dg_parser.h>
+#include <data_group.h>
+
+namespace common {
+    class ThreadPool;
+}
 
 namespace services {
 
+/**
+ * @brief One document to verify (single or batch request)
+ */
+struct PaVerificationRequest {
+    std::string id;                                          ///< Caller correlation id (batch only, echoed back)
+    std::vector<uint8_t> sodData;
+    std::map<std::string, std::vector<uint8_t>> dataGroups;  ///< DG number ("1") → raw bytes
+    std::string documentNumber;
+    std::string countryCode;
+    std::string clientIp;
+    std::string userAgent;
+    std::string requestedBy;
+};
+
 /**
  * @brief ICAO 9303 Passive Authentication verification orchestrator
  *
@@ -36,6 +58,47 @@ private:
     CertificateValidationService* certValidator_;
     icao::DgParser* dgParser_;
     DscAutoRegistrationService* dscAutoRegService_;
+    PaVerdictCache* verdictCache_;
+    common::ThreadPool* workerPool_;
+
+    /**
+     * @brief Verification outcome before anything is written to the database
+     */
+    struct PreparedVerification {
+        Json::Value errorResponse;  ///< Set (success=false) if verification could not run
+        std::shared_ptr<const PaVerdict> verdict;
+        bool verdictCached = false;
+        domain::models::PaVerification verification;
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    /// Steps 1-5 without persistence (thread-safe; used by single and batch paths)
+    PreparedVerification prepareVerification(const PaVerificationRequest& request);
+
+    /// pa_data_group rows for a prepared verification
+    std::vector<icao::models::DataGroup> dataGroupRows(
+        const PreparedVerification& prepared, const PaVerificationRequest& request) const;
+
+    /// Final API response for a persisted verification
+    Json::Value buildResponse(
+        const PreparedVerification& prepared,
+        const PaVerificationRequest& request,
+        const std::string& verificationId,
+        const DscRegistrationResult& dscRegResult) const;
+
+    struct BatchState;
+    void finishBatch(BatchState& state);
+
+    /**
+     * @brief Steps 1-4: parse SOD, validate chain, verify SOD signature, hash DGs
+     * @param error Set when the SOD cannot be parsed
+     * @return Verdict, or nullptr on SOD parse failure
+     */
+    std::shared_ptr<PaVerdict> computeVerdict(
+        const std::vector<uint8_t>& sodData,
+        const std::map<std::string, std::vector<uint8_t>>& dataGroups,
+        const std::string& countryCode,
+        std::string& error);
 
 public:
     /**
@@ -46,6 +109,8 @@ public:
      * @param certValidator Certificate chain validation service
      * @param dgParser Data group parser
      * @param dscAutoRegService Optional DSC auto-registration service
+     * @param verdictCache Optional cache of trust verdicts for repeated SOD + DGs
+     * @param workerPool Optional CPU pool for batch verification (caller thread if nullptr)
      * @throws std::invalid_argument if required dependencies are nullptr
      */
     PaVerificationService(
@@ -54,7 +119,9 @@ public:
         icao::SodParser* sodParser,
         CertificateValidationService* certValidator,
         icao::DgParser* dgParser,
-        DscAutoRegistrationService* dscAutoRegService = nullptr
+        DscAutoRegistrationService* dscAutoRegService = nullptr,
+        PaVerdictCache* verdictCache = nullptr,
+        common::ThreadPool* workerPool = nullptr
     );
 
     /** @brief Destructor */
@@ -78,6 +145,25 @@ public:
         const std::string& requestedBy = ""
     );
 
+    using BatchCallback = std::function<void(std::vector<Json::Value> results)>;
+
+    /**
+     * @brief Verify several documents concurrently and persist them together
+     *
+     * Documents are verified on the worker pool; once all are done, their
+     * pa_verification and pa_data_group rows are written with one batched
+     * insert each, DSC registration runs once per distinct DSC, and done is
+     * invoked (on the last worker thread) with one response per request, in
+     * request order, each shaped like verifyPassiveAuthentication().
+     *
+     * @param requests Documents to verify
+     * @param done Completion callback
+     */
+    void verifyPassiveAuthenticationBatch(
+        std::vector<PaVerificationRequest> requests,
+        BatchCallback done
+    );
+
     /**
      * @brief Get paginated PA verification history
      * @param limit Maximum results to return
@@ -1,4 +1,5 @@
 #include "trust_material_service.h"
+#include "trust_snapshot_service.h"
 #include "../repositories/ldap_certificate_repository.h"
 #include "../repositories/ldap_crl_repository.h"
 #include "../repositories/trust_material_request_repository.h"
@@ -17,8 +18,9 @@ namespace services {
 TrustMaterialService::TrustMaterialService(
     repositories::LdapCertificateRepository* certRepo,
     repositories::LdapCrlRepository* crlRepo,
-    repositories::TrustMaterialRequestRepository* requestRepo)
-    : certRepo_(certRepo), crlRepo_(crlRepo), requestRepo_(requestRepo)
+    repositories::TrustMaterialRequestRepository* requestRepo,
+    TrustSnapshotService* trustSnapshots)
+    : certRepo_(certRepo), crlRepo_(crlRepo), requestRepo_(requestRepo), trustSnapshots_(trustSnapshots)
 {
     if (!certRepo_ || !crlRepo_ || !requestRepo_) {
         throw std::invalid_argument("TrustMaterialService: repository pointers cannot be nullptr");
@@ -115,14 +117,19 @@ TrustMaterialService::TrustMaterialResponse TrustMaterialService::fetchTrustMate
 
     std::string countryCode = request.countryCode.substr(0, 2); // Normalize to alpha-2
 
-    // Fetch CSCAs from LDAP
+    // Serve from the in-memory trust snapshot; LDAP only on cold start or miss
+    auto snapshot = trustSnapshots_ ? trustSnapshots_->current() : nullptr;
+
+    // Fetch CSCAs
     Json::Value cscaArray(Json::arrayValue);
     Json::Value linkCertArray(Json::arrayValue);
     int cscaCount = 0;
     int linkCertCount = 0;
 
     try {
-        auto cscaCerts = certRepo_->findAllCscasByCountry(countryCode);
+        std::vector<X509*> cscaCerts;
+        if (snapshot) cscaCerts = snapshot->copyCscasByCountry(countryCode);
+        if (cscaCerts.empty()) cscaCerts = certRepo_->findAllCscasByCountry(countryCode);
         spdlog::info("[TrustMaterialService] Found {} CSCA/LC certs for country {}", cscaCerts.size(), countryCode);
 
         for (X509* cert : cscaCerts) {
@@ -193,12 +200,13 @@ TrustMaterialService::TrustMaterialResponse TrustMaterialService::fetchTrustMate
         response.errorMessage = "CSCA lookup failed: " + std::string(e.what());
     }
 
-    // Fetch CRL from LDAP
+    // Fetch CRL
     Json::Value crlArray(Json::arrayValue);
     int crlCount = 0;
 
     try {
-        X509_CRL* crl = crlRepo_->findCrlByCountry(countryCode);
+        X509_CRL* crl = snapshot ? snapshot->copyCrl(countryCode) : nullptr;
+        if (!crl) crl = crlRepo_->findCrlByCountry(countryCode);
         if (crl) {
             int crlDerLen = i2d_X509_CRL(crl, nullptr);
             if (crlDerLen > 0) {
@@ -11,12 +11,15 @@ namespace repositories {
 
 namespace services {
 
+class TrustSnapshotService;
+
 class TrustMaterialService {
 public:
     TrustMaterialService(
         repositories::LdapCertificateRepository* certRepo,
         repositories::LdapCrlRepository* crlRepo,
-        repositories::TrustMaterialRequestRepository* requestRepo);
+        repositories::TrustMaterialRequestRepository* requestRepo,
+        TrustSnapshotService* trustSnapshots = nullptr);
 
     ~TrustMaterialService() = default;
 
@@ -64,6 +67,7 @@ private:
     repositories::LdapCertificateRepository* certRepo_;
     repositories::LdapCrlRepository* crlRepo_;
     repositories::TrustMaterialRequestRepository* requestRepo_;
+    TrustSnapshotService* trustSnapshots_;  // Optional; LDAP used on cold start or miss
 
     struct MrzFields {
         std::string nationality;
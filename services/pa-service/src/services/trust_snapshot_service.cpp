@@ -0,0 +1,272 @@
+/**
+ * @file trust_snapshot_service.cpp
+ * @brief TrustSnapshot / TrustSnapshotService implementation
+ */
+
+#include "trust_snapshot_service.h"
+#include "../repositories/ldap_certificate_repository.h"
+#include "../repositories/ldap_crl_repository.h"
+#include <openssl/evp.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace services {
+
+namespace {
+
+std::string toUpper(std::string s) {
+    for (char& c : s) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return s;
+}
+
+template <typename T, int (*I2D)(const T*, unsigned char**)>
+void digestDer(EVP_MD_CTX* ctx, const T* obj) {
+    int len = I2D(obj, nullptr);
+    if (len <= 0) return;
+    std::vector<unsigned char> der(static_cast<size_t>(len));
+    unsigned char* p = der.data();
+    I2D(obj, &p);
+    EVP_DigestUpdate(ctx, der.data(), der.size());
+}
+
+TrustSnapshotService::Source ldapSource(repositories::LdapCertificateRepository* certRepo,
+                                        repositories::LdapCrlRepository* crlRepo) {
+    if (!certRepo || !crlRepo) {
+        throw std::invalid_argument("TrustSnapshotService: repository pointers cannot be nullptr");
+    }
+    return {
+        [certRepo]() { return certRepo->findCountryCodes(); },
+        [certRepo](const std::string& country) { return certRepo->findAllCscasByCountry(country); },
+        [crlRepo](const std::string& country) { return crlRepo->findCrlByCountry(country); },
+    };
+}
+
+} // anonymous namespace
+
+// --- TrustSnapshot ---
+
+std::shared_ptr<const TrustSnapshot> TrustSnapshot::create(
+    std::map<std::string, std::vector<X509*>> cscasByCountry,
+    std::map<std::string, X509_CRL*> crlsByCountry)
+{
+    std::shared_ptr<TrustSnapshot> snapshot(new TrustSnapshot());
+    snapshot->loadedAt_ = std::chrono::system_clock::now();
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (ctx) EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+
+    std::vector<X509*> all;
+    for (const auto& [country, certs] : cscasByCountry) {
+        for (X509* cert : certs) {
+            if (!cert) continue;
+            all.push_back(cert);
+            if (ctx) digestDer<X509, i2d_X509>(ctx, cert);
+        }
+    }
+    snapshot->cscaStore_ = icao::validation::CscaTrustStore::create(all);
+
+    // Country index over the store's anchors (the store up-refs, so pointers are shared)
+    for (const auto& [country, certs] : cscasByCountry) {
+        auto& anchors = snapshot->cscasByCountry_[toUpper(country)];
+        for (X509* cert : certs) {
+            if (const auto* anchor = snapshot->cscaStore_->find(cert)) {
+                anchors.push_back(anchor);
+            }
+        }
+    }
+    for (X509* cert : all) X509_free(cert);  // Store holds its own reference
+
+    for (const auto& [country, crl] : crlsByCountry) {
+        if (!crl) continue;
+        if (ctx) digestDer<X509_CRL, i2d_X509_CRL>(ctx, crl);
+        snapshot->crls_.emplace(toUpper(country), crl);
+    }
+
+    if (ctx) {
+        unsigned char digest[EVP_MAX_MD_SIZE];
+        unsigned int digestLen = 0;
+        EVP_DigestFinal_ex(ctx, digest, &digestLen);
+        EVP_MD_CTX_free(ctx);
+        std::ostringstream hex;
+        for (unsigned int i = 0; i < digestLen; i++) {
+            hex << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
+        }
+        snapshot->contentHash_ = hex.str();
+    }
+    return snapshot;
+}
+
+TrustSnapshot::~TrustSnapshot() {
+    for (auto& [country, crl] : crls_) {
+        X509_CRL_free(crl);
+    }
+}
+
+std::vector<X509*> TrustSnapshot::copyCscasByCountry(const std::string& countryCode) const {
+    std::vector<X509*> result;
+    auto it = cscasByCountry_.find(toUpper(countryCode));
+    if (it == cscasByCountry_.end()) return result;
+
+    result.reserve(it->second.size());
+    for (const auto* anchor : it->second) {
+        X509_up_ref(anchor->cert);
+        result.push_back(anchor->cert);
+    }
+    return result;
+}
+
+X509* TrustSnapshot::copyCscaBySubjectDn(const std::string& subjectDn) const {
+    const auto& anchors = cscaStore_->findBySubjectDn(subjectDn);
+    if (anchors.empty()) return nullptr;
+    X509_up_ref(anchors.front()->cert);
+    return anchors.front()->cert;
+}
+
+X509_CRL* TrustSnapshot::copyCrl(const std::string& countryCode) const {
+    auto it = crls_.find(toUpper(countryCode));
+    if (it == crls_.end()) return nullptr;
+    X509_CRL_up_ref(it->second);
+    return it->second;
+}
+
+// --- TrustSnapshotService ---
+
+TrustSnapshotService::TrustSnapshotService(
+    repositories::LdapCertificateRepository* certRepo,
+    repositories::LdapCrlRepository* crlRepo,
+    std::chrono::seconds refreshInterval)
+    : TrustSnapshotService(ldapSource(certRepo, crlRepo), refreshInterval)
+{
+}
+
+TrustSnapshotService::TrustSnapshotService(Source source, std::chrono::seconds refreshInterval)
+    : source_(std::move(source))
+    , refreshInterval_(refreshInterval.count() > 0 ? refreshInterval : std::chrono::seconds(300))
+{
+    if (!source_.countryCodes || !source_.cscasByCountry || !source_.crlByCountry) {
+        throw std::invalid_argument("TrustSnapshotService: source functions cannot be empty");
+    }
+}
+
+TrustSnapshotService::~TrustSnapshotService() {
+    stop();
+}
+
+bool TrustSnapshotService::refresh() {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::map<std::string, std::vector<X509*>> cscas;
+    std::map<std::string, X509_CRL*> crls;
+    size_t cscaTotal = 0;
+    try {
+        for (const auto& country : source_.countryCodes()) {
+            auto certs = source_.cscasByCountry(country);
+            cscaTotal += certs.size();
+            if (!certs.empty()) cscas.emplace(country, std::move(certs));
+
+            if (X509_CRL* crl = source_.crlByCountry(country)) {
+                crls.emplace(country, crl);
+            }
+        }
+    } catch (const std::exception& e) {
+        for (auto& [c, certs] : cscas) for (X509* cert : certs) X509_free(cert);
+        for (auto& [c, crl] : crls) X509_CRL_free(crl);
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        stats_.failures++;
+        stats_.lastError = e.what();
+        throw;
+    }
+
+    // An empty result is far more likely an LDAP outage than an empty PKD
+    if (cscaTotal == 0) {
+        for (auto& [c, crl] : crls) X509_CRL_free(crl);
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        stats_.failures++;
+        stats_.lastError = "LDAP returned no CSCAs";
+        spdlog::warn("[TrustSnapshot] LDAP returned no CSCAs, keeping current snapshot");
+        return false;
+    }
+
+    auto snapshot = TrustSnapshot::create(std::move(cscas), std::move(crls));
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+
+    auto previous = current();
+    bool changed = !previous || previous->contentHash() != snapshot->contentHash();
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        stats_.refreshes++;
+        if (changed) stats_.publications++;
+        stats_.lastError.clear();
+    }
+    if (!changed) {
+        spdlog::debug("[TrustSnapshot] Unchanged ({} CSCAs, {} CRLs, {}ms)",
+                      snapshot->cscaCount(), snapshot->crlCount(), elapsedMs);
+        return false;
+    }
+
+    current_.store(snapshot, std::memory_order_release);
+    spdlog::info("[TrustSnapshot] Published: {} CSCAs, {} CRLs, {} countries ({}ms)",
+                 snapshot->cscaCount(), snapshot->crlCount(), snapshot->countryCount(), elapsedMs);
+
+    if (onPublish_) {
+        onPublish_(snapshot);
+    }
+    return true;
+}
+
+void TrustSnapshotService::start() {
+    if (running_.exchange(true)) return;
+
+    thread_ = std::thread([this]() {
+        spdlog::info("[TrustSnapshot] Refresh thread started (interval {}s)", refreshInterval_.count());
+        run();
+        spdlog::info("[TrustSnapshot] Refresh thread stopped");
+    });
+}
+
+void TrustSnapshotService::stop() {
+    if (!running_.exchange(false)) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        refreshRequested_ = true;
+    }
+    wakeCv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+}
+
+void TrustSnapshotService::requestRefresh() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        refreshRequested_ = true;
+    }
+    wakeCv_.notify_all();
+}
+
+TrustSnapshotService::Stats TrustSnapshotService::stats() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+}
+
+void TrustSnapshotService::run() {
+    while (running_) {
+        try {
+            refresh();
+        } catch (const std::exception& e) {
+            spdlog::error("[TrustSnapshot] Refresh failed, keeping current snapshot: {}", e.what());
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        wakeCv_.wait_for(lock, refreshInterval_, [this]() { return refreshRequested_; });
+        refreshRequested_ = false;
+    }
+}
+
+} // namespace services
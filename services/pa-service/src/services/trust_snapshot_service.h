@@ -0,0 +1,197 @@
+/**
+ * @file trust_snapshot_service.h
+ * @brief Background-refreshed in-memory CSCA/CRL snapshot for PA verification
+ *
+ * PA verification and trust material requests used to search LDAP for the
+ * country's CSCAs and CRL on every request and decode every returned entry.
+ * The CSCA/CRL set is small and read-mostly, so TrustSnapshotService loads it
+ * once, keeps it parsed and indexed (country, subject DN, SKI) and swaps in a
+ * new snapshot atomically when LDAP content changes.
+ *
+ * Refresh: periodically, and on demand via requestRefresh()
+ * (POST /internal/trust-snapshot/refresh, which pkd-management and pkd-relay
+ * call after writing CSCAs/CRLs; see icao/trust/trust_snapshot_notify.h).
+ * A reload whose content hash equals the current snapshot is discarded, so
+ * downstream caches are only reset on real changes.
+ *
+ * Readers call current() and fall back to LDAP when it is nullptr (cold start)
+ * or has nothing for the requested country.
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <openssl/x509.h>
+#include <icao/validation/csca_trust_store.h>
+
+namespace repositories {
+    class LdapCertificateRepository;
+    class LdapCrlRepository;
+}
+
+namespace services {
+
+/**
+ * @brief Immutable, parsed CSCA/CRL set (shared by all request threads)
+ */
+class TrustSnapshot {
+public:
+    /**
+     * @brief Build a snapshot
+     * @param cscasByCountry Country code → CSCA/link certificates (ownership taken)
+     * @param crlsByCountry Country code → CRL (ownership taken)
+     */
+    static std::shared_ptr<const TrustSnapshot> create(
+        std::map<std::string, std::vector<X509*>> cscasByCountry,
+        std::map<std::string, X509_CRL*> crlsByCountry);
+
+    ~TrustSnapshot();
+
+    TrustSnapshot(const TrustSnapshot&) = delete;
+    TrustSnapshot& operator=(const TrustSnapshot&) = delete;
+
+    /**
+     * @brief CSCAs and link certificates of a country
+     * @return Up-ref'd certificates (caller must X509_free each), empty if none
+     */
+    std::vector<X509*> copyCscasByCountry(const std::string& countryCode) const;
+
+    /**
+     * @brief First CSCA whose subject matches a DN (any format)
+     * @return Up-ref'd certificate (caller must X509_free) or nullptr
+     */
+    X509* copyCscaBySubjectDn(const std::string& subjectDn) const;
+
+    /**
+     * @brief CRL of a country
+     * @return Up-ref'd CRL (caller must X509_CRL_free) or nullptr
+     */
+    X509_CRL* copyCrl(const std::string& countryCode) const;
+
+    /// DN/SKI index over all CSCAs in the snapshot
+    const icao::validation::CscaTrustStore& cscaStore() const { return *cscaStore_; }
+
+    /// SHA-256 (hex) over every certificate and CRL, ordered by country
+    const std::string& contentHash() const { return contentHash_; }
+
+    size_t cscaCount() const { return cscaStore_->size(); }
+    size_t crlCount() const { return crls_.size(); }
+    size_t countryCount() const { return cscasByCountry_.size(); }
+    std::chrono::system_clock::time_point loadedAt() const { return loadedAt_; }
+
+private:
+    TrustSnapshot() = default;
+
+    std::shared_ptr<const icao::validation::CscaTrustStore> cscaStore_;
+    std::unordered_map<std::string, std::vector<const icao::validation::TrustAnchor*>> cscasByCountry_;
+    std::unordered_map<std::string, X509_CRL*> crls_;
+    std::string contentHash_;
+    std::chrono::system_clock::time_point loadedAt_;
+};
+
+/**
+ * @brief Loads TrustSnapshots from LDAP and publishes them (RCU-style)
+ *
+ * current() is lock-free and safe from any thread; a loaded snapshot stays
+ * valid for as long as the caller holds it.
+ */
+class TrustSnapshotService {
+public:
+    /// Invoked on the refresh thread after a changed snapshot has been published
+    using PublishFn = std::function<void(const std::shared_ptr<const TrustSnapshot>&)>;
+
+    struct Stats {
+        uint64_t refreshes = 0;      ///< Completed LDAP loads
+        uint64_t publications = 0;   ///< Loads that changed the snapshot
+        uint64_t failures = 0;
+        std::string lastError;
+    };
+
+    /// Where refresh() reads the trust material from (LDAP in production)
+    struct Source {
+        std::function<std::vector<std::string>()> countryCodes;
+        std::function<std::vector<X509*>(const std::string&)> cscasByCountry;  ///< Ownership passed to the caller
+        std::function<X509_CRL*(const std::string&)> crlByCountry;             ///< Ownership passed; nullptr if none
+    };
+
+    /**
+     * @param certRepo LDAP CSCA repository
+     * @param crlRepo LDAP CRL repository
+     * @param refreshInterval Time between periodic reloads
+     * @throws std::invalid_argument if a repository is nullptr
+     */
+    TrustSnapshotService(repositories::LdapCertificateRepository* certRepo,
+                         repositories::LdapCrlRepository* crlRepo,
+                         std::chrono::seconds refreshInterval);
+
+    /**
+     * @param source Trust material loader (all three functions required)
+     * @param refreshInterval Time between periodic reloads
+     * @throws std::invalid_argument if a loader function is empty
+     */
+    TrustSnapshotService(Source source, std::chrono::seconds refreshInterval);
+
+    ~TrustSnapshotService();
+
+    TrustSnapshotService(const TrustSnapshotService&) = delete;
+    TrustSnapshotService& operator=(const TrustSnapshotService&) = delete;
+
+    /// Current snapshot, or nullptr before the first successful load
+    std::shared_ptr<const TrustSnapshot> current() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    /** @brief Set the publication callback (call before start()) */
+    void setOnPublish(PublishFn fn) { onPublish_ = std::move(fn); }
+
+    /**
+     * @brief Load from LDAP now and publish if the content changed
+     * @return true if a new snapshot was published
+     */
+    bool refresh();
+
+    /** @brief Start the refresh thread (first load runs immediately, in the background) */
+    void start();
+
+    /** @brief Stop and join the refresh thread */
+    void stop();
+
+    /** @brief Wake the refresh thread for an immediate reload */
+    void requestRefresh();
+
+    Stats stats() const;
+
+private:
+    void run();
+
+    Source source_;
+    std::chrono::seconds refreshInterval_;
+    PublishFn onPublish_;
+
+    std::atomic<std::shared_ptr<const TrustSnapshot>> current_;
+
+    std::mutex refreshMutex_;  ///< Serializes LDAP loads
+    mutable std::mutex statsMutex_;
+    Stats stats_;
+
+    // Refresh thread
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    bool refreshRequested_ = false;
+};
+
+} // namespace services
@@ -0,0 +1,151 @@
+/**
+ * @file pa_verdict_cache_test.cpp
+ * @brief Unit tests for PaVerdictCache
+ *
+ * Tests LRU eviction, TTL expiry, cache key derivation and the drop of
+ * verdicts built against an older trust store or CRL.
+ * No database or LDAP connection required.
+ *
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "services/pa_verdict_cache.h"
+
+using services::PaVerdict;
+using services::PaVerdictCache;
+
+namespace {
+
+std::shared_ptr<const PaVerdict> makeVerdict(uint64_t generation = 1,
+                                             const std::string& crlCountry = "KR",
+                                             const std::string& crlFingerprint = "crl-1") {
+    auto verdict = std::make_shared<PaVerdict>();
+    verdict->trustStoreGeneration = generation;
+    verdict->crlCountry = crlCountry;
+    verdict->crlFingerprint = crlFingerprint;
+    return verdict;
+}
+
+std::map<std::string, std::vector<uint8_t>> sampleDataGroups() {
+    return {{"1", {0x61, 0x5b, 0x01}}, {"2", {0x75, 0x82, 0x02}}};
+}
+
+}  // namespace
+
+// --- LRU / TTL ---
+
+TEST(PaVerdictCacheTest, StoreAtCapacityEvictsLeastRecentlyUsed) {
+    PaVerdictCache cache(2, std::chrono::seconds(60));
+    cache.store("a", makeVerdict());
+    cache.store("b", makeVerdict());
+    ASSERT_NE(cache.find("a"), nullptr);  // "b" is now least recently used
+
+    cache.store("c", makeVerdict());
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_NE(cache.find("a"), nullptr);
+    EXPECT_EQ(cache.find("b"), nullptr);
+    EXPECT_NE(cache.find("c"), nullptr);
+}
+
+TEST(PaVerdictCacheTest, StoreExistingKeyReplacesWithoutEviction) {
+    PaVerdictCache cache(2, std::chrono::seconds(60));
+    cache.store("a", makeVerdict(1));
+    cache.store("b", makeVerdict());
+    cache.store("a", makeVerdict(2));
+
+    EXPECT_EQ(cache.size(), 2u);
+    ASSERT_NE(cache.find("a"), nullptr);
+    EXPECT_EQ(cache.find("a")->trustStoreGeneration, 2u);
+    EXPECT_NE(cache.find("b"), nullptr);
+}
+
+TEST(PaVerdictCacheTest, FindAfterTtlReturnsNullAndDropsEntry) {
+    PaVerdictCache cache(4, std::chrono::seconds(0));
+    cache.store("a", makeVerdict());
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    EXPECT_EQ(cache.find("a"), nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(PaVerdictCacheTest, FindWithinTtlReturnsVerdict) {
+    PaVerdictCache cache(4, std::chrono::seconds(60));
+    auto verdict = makeVerdict();
+    cache.store("a", verdict);
+
+    EXPECT_EQ(cache.find("a"), verdict);
+}
+
+// --- Key ---
+
+TEST(PaVerdictCacheTest, MakeKeySameInputSameKey) {
+    EXPECT_EQ(PaVerdictCache::makeKey("sod", sampleDataGroups(), "KR"),
+              PaVerdictCache::makeKey("sod", sampleDataGroups(), "KR"));
+}
+
+TEST(PaVerdictCacheTest, MakeKeyChangesWhenAnyDataGroupChanges) {
+    std::string base = PaVerdictCache::makeKey("sod", sampleDataGroups(), "KR");
+
+    auto dg1Changed = sampleDataGroups();
+    dg1Changed["1"].back() ^= 0x01;
+    auto dg2Changed = sampleDataGroups();
+    dg2Changed["2"].push_back(0x00);
+    auto dgAdded = sampleDataGroups();
+    dgAdded["14"] = {0x6e};
+
+    EXPECT_NE(PaVerdictCache::makeKey("sod", dg1Changed, "KR"), base);
+    EXPECT_NE(PaVerdictCache::makeKey("sod", dg2Changed, "KR"), base);
+    EXPECT_NE(PaVerdictCache::makeKey("sod", dgAdded, "KR"), base);
+    EXPECT_NE(PaVerdictCache::makeKey("sod2", sampleDataGroups(), "KR"), base);
+    EXPECT_NE(PaVerdictCache::makeKey("sod", sampleDataGroups(), "JP"), base);
+}
+
+TEST(PaVerdictCacheTest, MakeKeyFieldBoundariesDoNotCollide) {
+    // Same concatenated bytes, split differently between DG number and content
+    std::map<std::string, std::vector<uint8_t>> a = {{"1", {'2', 'x'}}};
+    std::map<std::string, std::vector<uint8_t>> b = {{"12", {'x'}}};
+    EXPECT_NE(PaVerdictCache::makeKey("sod", a, "KR"), PaVerdictCache::makeKey("sod", b, "KR"));
+}
+
+// --- Staleness ---
+
+TEST(PaVerdictCacheTest, FindCurrentSameGenerationAndCrlReturnsVerdict) {
+    PaVerdictCache cache(4, std::chrono::seconds(60));
+    auto verdict = makeVerdict(7, "KR", "crl-1");
+    cache.store("a", verdict);
+
+    auto found = cache.findCurrent("a", 7, [](const std::string&) { return std::string("crl-1"); });
+    EXPECT_EQ(found, verdict);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(PaVerdictCacheTest, FindCurrentTrustStoreGenerationChangedDropsEntry) {
+    PaVerdictCache cache(4, std::chrono::seconds(60));
+    cache.store("a", makeVerdict(7, "KR", "crl-1"));
+
+    auto found = cache.findCurrent("a", 8, [](const std::string&) { return std::string("crl-1"); });
+    EXPECT_EQ(found, nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(PaVerdictCacheTest, FindCurrentCrlChangedDropsEntry) {
+    PaVerdictCache cache(4, std::chrono::seconds(60));
+    cache.store("a", makeVerdict(7, "KR", "crl-1"));
+
+    std::string askedCountry;
+    auto found = cache.findCurrent("a", 7, [&askedCountry](const std::string& country) {
+        askedCountry = country;
+        return std::string("crl-2");
+    });
+    EXPECT_EQ(found, nullptr);
+    EXPECT_EQ(askedCountry, "KR");
+    EXPECT_EQ(cache.size(), 0u);
+}
@@ -0,0 +1,234 @@
+/**
+ * @file trust_snapshot_service_test.cpp
+ * @brief Unit tests for TrustSnapshotService / TrustSnapshot
+ *
+ * Tests publication on content change only, keeping the previous snapshot
+ * when a load is empty or fails, and per-country lookups.
+ * No LDAP connection required: an in-memory Source stands in for LDAP and
+ * hands out freshly generated self-signed CSCAs and CRLs.
+ *
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include "services/trust_snapshot_service.h"
+
+using services::TrustSnapshot;
+using services::TrustSnapshotService;
+
+namespace {
+
+using KeyPtr = std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)>;
+using CertPtr = std::unique_ptr<X509, decltype(&X509_free)>;
+using CrlPtr = std::unique_ptr<X509_CRL, decltype(&X509_CRL_free)>;
+
+KeyPtr makeKey() {
+    return KeyPtr(EVP_PKEY_Q_keygen(nullptr, nullptr, "EC", "P-256"), EVP_PKEY_free);
+}
+
+X509_NAME* makeName(const std::string& country, const std::string& cn) {
+    X509_NAME* name = X509_NAME_new();
+    X509_NAME_add_entry_by_txt(name, "C", MBSTRING_ASC,
+                               reinterpret_cast<const unsigned char*>(country.c_str()), -1, -1, 0);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                               reinterpret_cast<const unsigned char*>(cn.c_str()), -1, -1, 0);
+    return name;
+}
+
+CertPtr makeCsca(const std::string& country, const std::string& cn, long serial) {
+    KeyPtr key = makeKey();
+    CertPtr cert(X509_new(), X509_free);
+    X509_set_version(cert.get(), 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(cert.get()), serial);
+    X509_gmtime_adj(X509_getm_notBefore(cert.get()), 0);
+    X509_gmtime_adj(X509_getm_notAfter(cert.get()), 3600L * 24 * 365);
+    X509_NAME* name = makeName(country, cn);
+    X509_set_subject_name(cert.get(), name);
+    X509_set_issuer_name(cert.get(), name);
+    X509_NAME_free(name);
+    X509_set_pubkey(cert.get(), key.get());
+    X509_sign(cert.get(), key.get(), EVP_sha256());
+    return cert;
+}
+
+CrlPtr makeCrl(const std::string& country) {
+    KeyPtr key = makeKey();
+    CrlPtr crl(X509_CRL_new(), X509_CRL_free);
+    X509_CRL_set_version(crl.get(), 1);
+    X509_NAME* name = makeName(country, "CSCA " + country);
+    X509_CRL_set_issuer_name(crl.get(), name);
+    X509_NAME_free(name);
+    ASN1_TIME* now = X509_gmtime_adj(nullptr, 0);
+    X509_CRL_set1_lastUpdate(crl.get(), now);
+    ASN1_TIME_free(now);
+    X509_CRL_sign(crl.get(), key.get(), EVP_sha256());
+    return crl;
+}
+
+/**
+ * @brief In-memory trust material; every load hands out new references
+ */
+class FakeLdap {
+public:
+    std::map<std::string, std::vector<CertPtr>> cscas;
+    std::map<std::string, CrlPtr> crls;
+    bool failLoad = false;
+    int loads = 0;
+
+    TrustSnapshotService::Source source() {
+        return {
+            [this]() {
+                loads++;
+                if (failLoad) throw std::runtime_error("LDAP server down");
+                std::vector<std::string> countries;
+                for (const auto& [country, certs] : cscas) countries.push_back(country);
+                return countries;
+            },
+            [this](const std::string& country) {
+                std::vector<X509*> result;
+                for (const auto& cert : cscas[country]) {
+                    X509_up_ref(cert.get());
+                    result.push_back(cert.get());
+                }
+                return result;
+            },
+            [this](const std::string& country) -> X509_CRL* {
+                auto it = crls.find(country);
+                if (it == crls.end()) return nullptr;
+                X509_CRL_up_ref(it->second.get());
+                return it->second.get();
+            },
+        };
+    }
+};
+
+}  // namespace
+
+class TrustSnapshotServiceTest : public ::testing::Test {
+protected:
+    FakeLdap ldap_;
+    int published_ = 0;
+    std::unique_ptr<TrustSnapshotService> service_;
+
+    void SetUp() override {
+        ldap_.cscas["KR"].push_back(makeCsca("KR", "CSCA KR", 1));
+        ldap_.cscas["DE"].push_back(makeCsca("DE", "CSCA DE", 2));
+        ldap_.crls.emplace("KR", makeCrl("KR"));
+
+        service_ = std::make_unique<TrustSnapshotService>(ldap_.source(), std::chrono::seconds(300));
+        service_->setOnPublish([this](const std::shared_ptr<const TrustSnapshot>&) { published_++; });
+    }
+};
+
+// --- Publication ---
+
+TEST_F(TrustSnapshotServiceTest, FirstRefreshPublishes) {
+    EXPECT_EQ(service_->current(), nullptr);
+
+    EXPECT_TRUE(service_->refresh());
+
+    ASSERT_NE(service_->current(), nullptr);
+    EXPECT_EQ(service_->current()->cscaCount(), 2u);
+    EXPECT_EQ(service_->current()->crlCount(), 1u);
+    EXPECT_EQ(published_, 1);
+}
+
+TEST_F(TrustSnapshotServiceTest, UnchangedReloadDoesNotRepublish) {
+    ASSERT_TRUE(service_->refresh());
+    auto first = service_->current();
+
+    EXPECT_FALSE(service_->refresh());
+
+    EXPECT_EQ(service_->current(), first);
+    EXPECT_EQ(published_, 1);
+    EXPECT_EQ(service_->stats().refreshes, 2u);
+    EXPECT_EQ(service_->stats().publications, 1u);
+}
+
+TEST_F(TrustSnapshotServiceTest, ChangedContentRepublishes) {
+    ASSERT_TRUE(service_->refresh());
+    std::string firstHash = service_->current()->contentHash();
+
+    ldap_.crls.emplace("DE", makeCrl("DE"));
+    EXPECT_TRUE(service_->refresh());
+
+    EXPECT_NE(service_->current()->contentHash(), firstHash);
+    EXPECT_EQ(published_, 2);
+}
+
+// --- Failed / empty loads ---
+
+TEST_F(TrustSnapshotServiceTest, EmptyLoadKeepsPreviousSnapshot) {
+    ASSERT_TRUE(service_->refresh());
+    auto previous = service_->current();
+
+    ldap_.cscas.clear();
+    EXPECT_FALSE(service_->refresh());
+
+    EXPECT_EQ(service_->current(), previous);
+    EXPECT_EQ(published_, 1);
+    EXPECT_EQ(service_->stats().failures, 1u);
+    EXPECT_EQ(service_->stats().lastError, "LDAP returned no CSCAs");
+}
+
+TEST_F(TrustSnapshotServiceTest, FailedLoadKeepsPreviousSnapshot) {
+    ASSERT_TRUE(service_->refresh());
+    auto previous = service_->current();
+
+    ldap_.failLoad = true;
+    EXPECT_THROW(service_->refresh(), std::runtime_error);
+
+    EXPECT_EQ(service_->current(), previous);
+    EXPECT_EQ(published_, 1);
+    EXPECT_EQ(service_->stats().failures, 1u);
+    EXPECT_EQ(service_->stats().lastError, "LDAP server down");
+}
+
+TEST_F(TrustSnapshotServiceTest, FailedColdLoadLeavesNoSnapshot) {
+    ldap_.failLoad = true;
+    EXPECT_THROW(service_->refresh(), std::runtime_error);
+    EXPECT_EQ(service_->current(), nullptr);
+}
+
+// --- Lookups ---
+
+TEST_F(TrustSnapshotServiceTest, CopyCrlByCountry) {
+    ASSERT_TRUE(service_->refresh());
+    auto snapshot = service_->current();
+
+    X509_CRL* kr = snapshot->copyCrl("KR");
+    ASSERT_NE(kr, nullptr);
+    EXPECT_EQ(X509_CRL_cmp(kr, ldap_.crls.at("KR").get()), 0);
+    X509_CRL_free(kr);
+
+    X509_CRL* lower = snapshot->copyCrl("kr");  // Country codes are case-insensitive
+    EXPECT_NE(lower, nullptr);
+    X509_CRL_free(lower);
+
+    EXPECT_EQ(snapshot->copyCrl("DE"), nullptr);
+}
+
+TEST_F(TrustSnapshotServiceTest, CopyCscasByCountry) {
+    ASSERT_TRUE(service_->refresh());
+    auto snapshot = service_->current();
+
+    auto de = snapshot->copyCscasByCountry("DE");
+    ASSERT_EQ(de.size(), 1u);
+    EXPECT_EQ(X509_cmp(de[0], ldap_.cscas.at("DE")[0].get()), 0);
+    for (X509* cert : de) X509_free(cert);
+
+    EXPECT_TRUE(snapshot->copyCscasByCountry("FR").empty());
+}
+
+TEST(TrustSnapshotServiceCtorTest, EmptySourceThrows) {
+    EXPECT_THROW(TrustSnapshotService(TrustSnapshotService::Source{}, std::chrono::seconds(60)),
+                 std::invalid_argument);
+}
@@ -3,17 +3,18 @@
  * @brief ICscaProvider adapter for database-backed CSCA lookup
  *
  * Bridges icao::validation::ICscaProvider to CertificateRepository.
- * Supports in-memory CSCA cache for LDIF bulk processing performance.
+ * Supports an in-memory CscaTrustStore for LDIF bulk processing performance:
+ * CSCAs are parsed once per load and borrowed by TrustChainBuilder.
  */
 
 #pragma once
 
 #include <icao/validation/providers.h>
+#include <icao/validation/csca_trust_store.h>
 #include "../repositories/certificate_repository.h"
-#include <unordered_map>
+#include <memory>
 #include <vector>
 #include <string>
-#include <cstdint>
 
 namespace adapters {
 
@@ -24,6 +25,11 @@ public:
     std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override;
     X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode) override;
 
+    /**
+     * @brief Loaded trust store (triggers lazy reload after invalidateCache())
+     */
+    std::shared_ptr<const icao::validation::CscaTrustStore> trustStore() override;
+
     /**
      * @brief Preload all CSCA certificates into memory cache
      *
@@ -44,9 +50,8 @@ public:
 private:
     repositories::CertificateRepository* certRepo_;
 
-    // In-memory cache: normalizedDn → vector of DER-encoded certificate bytes
-    std::unordered_map<std::string, std::vector<std::vector<uint8_t>>> cscaCache_;
-    bool cacheLoaded_ = false;
+    // Parsed once per (re)load; replaced wholesale, never mutated in place
+    icao::validation::CscaTrustStoreHolder store_;
 };
 
 } // namespace adapters
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <icao/validation/providers.h>
+#include <icao/validation/csca_trust_store.h>
 #include <ldap_connection_pool.h>
 #include <string>
 
@@ -28,6 +29,24 @@ public:
     std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override;
     X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode) override;
 
+    /**
+     * @brief Pre-parsed CSCA snapshot, if one has been published
+     *
+     * nullptr until publishTrustStore() is called; TrustChainBuilder then falls
+     * back to the per-lookup LDAP search above.
+     */
+    std::shared_ptr<const icao::validation::CscaTrustStore> trustStore() override {
+        return store_.load();
+    }
+
+    /**
+     * @brief Serve trust chain lookups from an in-memory CSCA snapshot
+     * @param store Snapshot to publish (nullptr reverts to LDAP lookups)
+     */
+    void publishTrustStore(std::shared_ptr<const icao::validation::CscaTrustStore> store) {
+        store_.publish(std::move(store));
+    }
+
 private:
     common::LdapConnectionPool* ldapPool_;
     std::string baseDn_;
@@ -45,6 +64,8 @@ private:
      * @brief Extract country code from DN string
      */
     std::string extractCountryFromDn(const std::string& dn);
+
+    icao::validation::CscaTrustStoreHolder store_;  ///< Published CSCA snapshot (optional)
 };
 
 } // namespace adapters
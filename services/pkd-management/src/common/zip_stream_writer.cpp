@@ -0,0 +1,236 @@
+/**
+ * @file zip_stream_writer.cpp
+ * @brief ZipStreamWriter implementation (PKWARE APPNOTE 6.3, ZIP64 where needed)
+ */
+
+#include "zip_stream_writer.h"
+#include <zlib.h>
+#include <algorithm>
+#include <ctime>
+#include <stdexcept>
+
+namespace common {
+
+namespace {
+
+constexpr uint32_t kLocalHeaderSig = 0x04034b50;
+constexpr uint32_t kCentralHeaderSig = 0x02014b50;
+constexpr uint32_t kZip64EndSig = 0x06064b50;
+constexpr uint32_t kZip64LocatorSig = 0x07064b50;
+constexpr uint32_t kEndSig = 0x06054b50;
+
+constexpr uint16_t kVersionDefault = 20;  // 2.0: deflate
+constexpr uint16_t kVersionZip64 = 45;    // 4.5: ZIP64
+constexpr uint16_t kFlagUtf8 = 0x0800;    // Bit 11: name is UTF-8
+constexpr uint16_t kMethodStore = 0;
+constexpr uint16_t kMethodDeflate = 8;
+constexpr uint16_t kZip64ExtraId = 0x0001;
+
+constexpr uint32_t kMax32 = 0xFFFFFFFF;
+constexpr uint16_t kMax16 = 0xFFFF;
+
+void put16(std::string& out, uint16_t v) {
+    out.push_back(static_cast<char>(v & 0xFF));
+    out.push_back(static_cast<char>((v >> 8) & 0xFF));
+}
+
+void put32(std::string& out, uint32_t v) {
+    put16(out, static_cast<uint16_t>(v & 0xFFFF));
+    put16(out, static_cast<uint16_t>(v >> 16));
+}
+
+void put64(std::string& out, uint64_t v) {
+    put32(out, static_cast<uint32_t>(v & kMax32));
+    put32(out, static_cast<uint32_t>(v >> 32));
+}
+
+} // anonymous namespace
+
+ZipStreamWriter::ZipStreamWriter(Sink sink, Method method, size_t chunkSize)
+    : sink_(std::move(sink))
+    , method_(method)
+    , chunkSize_(chunkSize > 0 ? chunkSize : 64 * 1024)
+{
+    if (!sink_) {
+        throw std::invalid_argument("ZipStreamWriter: sink cannot be empty");
+    }
+    buffer_.reserve(chunkSize_);
+
+    // All entries share the archive creation time (MS-DOS format, local time)
+    std::time_t now = std::time(nullptr);
+    std::tm tm{};
+    localtime_r(&now, &tm);
+    int year = tm.tm_year + 1900;
+    if (year < 1980) year = 1980;
+    dosTime_ = static_cast<uint16_t>((tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec / 2));
+    dosDate_ = static_cast<uint16_t>(((year - 1980) << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday);
+
+    if (method_ == Method::Deflate) {
+        deflater_ = new z_stream{};
+        if (deflateInit2(deflater_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                         Z_DEFAULT_STRATEGY) != Z_OK) {
+            delete deflater_;
+            throw std::runtime_error("ZipStreamWriter: deflateInit2 failed");
+        }
+    }
+}
+
+ZipStreamWriter::~ZipStreamWriter() {
+    if (deflater_) {
+        deflateEnd(deflater_);
+        delete deflater_;
+    }
+}
+
+bool ZipStreamWriter::addFile(const std::string& name, const uint8_t* data, size_t size) {
+    if (finished_) {
+        throw std::runtime_error("ZipStreamWriter: archive already finished");
+    }
+    if (name.empty() || name.size() > kMax16) {
+        throw std::invalid_argument("ZipStreamWriter: invalid entry name length");
+    }
+    if (size >= kMax32) {
+        throw std::invalid_argument("ZipStreamWriter: entry too large: " + name);
+    }
+    if (!names_.insert(name).second) {
+        return false;
+    }
+
+    uint32_t crc = static_cast<uint32_t>(crc32(0L, Z_NULL, 0));
+    if (size > 0) crc = static_cast<uint32_t>(crc32(crc, data, static_cast<uInt>(size)));
+
+    // Deflate into scratch; keep it only if it actually saves space
+    uint16_t method = kMethodStore;
+    const uint8_t* payload = data;
+    size_t payloadSize = size;
+    if (deflater_ && size > 0) {
+        deflateReset(deflater_);
+        compressed_.resize(deflateBound(deflater_, static_cast<uLong>(size)));
+        deflater_->next_in = const_cast<Bytef*>(data);
+        deflater_->avail_in = static_cast<uInt>(size);
+        deflater_->next_out = compressed_.data();
+        deflater_->avail_out = static_cast<uInt>(compressed_.size());
+        if (deflate(deflater_, Z_FINISH) != Z_STREAM_END) {
+            throw std::runtime_error("ZipStreamWriter: deflate failed for " + name);
+        }
+        if (deflater_->total_out < size) {
+            method = kMethodDeflate;
+            payload = compressed_.data();
+            payloadSize = deflater_->total_out;
+        }
+    }
+
+    Entry entry{name, crc, payloadSize, size, offset_, method};
+
+    std::string header;
+    header.reserve(30 + name.size());
+    put32(header, kLocalHeaderSig);
+    put16(header, kVersionDefault);
+    put16(header, kFlagUtf8);
+    put16(header, method);
+    put16(header, dosTime_);
+    put16(header, dosDate_);
+    put32(header, crc);
+    put32(header, static_cast<uint32_t>(payloadSize));
+    put32(header, static_cast<uint32_t>(size));
+    put16(header, static_cast<uint16_t>(name.size()));
+    put16(header, 0);  // Extra field length
+    header += name;
+
+    write(header.data(), header.size());
+    write(payload, payloadSize);
+    entries_.push_back(std::move(entry));
+    return true;
+}
+
+void ZipStreamWriter::finish() {
+    if (finished_) return;
+    finished_ = true;
+
+    const uint64_t centralOffset = offset_;
+    std::string record;
+    for (const auto& e : entries_) {
+        bool offset64 = e.localHeaderOffset >= kMax32;
+        record.clear();
+        put32(record, kCentralHeaderSig);
+        put16(record, kVersionZip64);  // Made by (MS-DOS attributes)
+        put16(record, offset64 ? kVersionZip64 : kVersionDefault);
+        put16(record, kFlagUtf8);
+        put16(record, e.method);
+        put16(record, dosTime_);
+        put16(record, dosDate_);
+        put32(record, e.crc);
+        put32(record, static_cast<uint32_t>(e.compressedSize));
+        put32(record, static_cast<uint32_t>(e.uncompressedSize));
+        put16(record, static_cast<uint16_t>(e.name.size()));
+        put16(record, offset64 ? 12 : 0);  // Extra field length
+        put16(record, 0);  // Comment length
+        put16(record, 0);  // Disk number start
+        put16(record, 0);  // Internal attributes
+        put32(record, 0);  // External attributes
+        put32(record, offset64 ? kMax32 : static_cast<uint32_t>(e.localHeaderOffset));
+        record += e.name;
+        if (offset64) {
+            put16(record, kZip64ExtraId);
+            put16(record, 8);
+            put64(record, e.localHeaderOffset);
+        }
+        write(record.data(), record.size());
+    }
+    const uint64_t centralSize = offset_ - centralOffset;
+    const uint64_t count = entries_.size();
+
+    record.clear();
+    bool zip64 = count >= kMax16 || centralOffset >= kMax32 || centralSize >= kMax32;
+    if (zip64) {
+        const uint64_t zip64EndOffset = offset_;
+        put32(record, kZip64EndSig);
+        put64(record, 44);  // Size of the remaining record
+        put16(record, kVersionZip64);
+        put16(record, kVersionZip64);
+        put32(record, 0);  // This disk
+        put32(record, 0);  // Central directory disk
+        put64(record, count);
+        put64(record, count);
+        put64(record, centralSize);
+        put64(record, centralOffset);
+
+        put32(record, kZip64LocatorSig);
+        put32(record, 0);  // Disk with the ZIP64 end record
+        put64(record, zip64EndOffset);
+        put32(record, 1);  // Total disks
+    }
+    put32(record, kEndSig);
+    put16(record, 0);  // This disk
+    put16(record, 0);  // Central directory disk
+    put16(record, static_cast<uint16_t>(zip64 ? kMax16 : count));
+    put16(record, static_cast<uint16_t>(zip64 ? kMax16 : count));
+    put32(record, zip64 ? kMax32 : static_cast<uint32_t>(centralSize));
+    put32(record, zip64 ? kMax32 : static_cast<uint32_t>(centralOffset));
+    put16(record, 0);  // Comment length
+    write(record.data(), record.size());
+
+    flush();
+}
+
+void ZipStreamWriter::write(const void* data, size_t len) {
+    const char* p = static_cast<const char*>(data);
+    while (len > 0) {
+        size_t n = std::min(len, chunkSize_ - buffer_.size());
+        buffer_.append(p, n);
+        p += n;
+        len -= n;
+        offset_ += n;
+        if (buffer_.size() >= chunkSize_) flush();
+    }
+}
+
+void ZipStreamWriter::flush() {
+    if (buffer_.empty()) return;
+    if (!sink_(buffer_.data(), buffer_.size())) {
+        throw std::runtime_error("ZipStreamWriter: output aborted");
+    }
+    buffer_.clear();
+}
+
+} // namespace common
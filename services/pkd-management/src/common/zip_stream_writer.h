@@ -0,0 +1,103 @@
+/**
+ * @file zip_stream_writer.h
+ * @brief Forward-only ZIP archive writer for streamed downloads
+ *
+ * libzip needs a seekable destination, so exports used to build the whole
+ * archive in a temp file before the first byte was sent. ZipStreamWriter
+ * writes each entry (local header + data) as soon as it is added and the
+ * central directory at finish(), passing output to a sink in fixed-size
+ * chunks. Only the central directory records (name, CRC, sizes, offset per
+ * entry) are kept in memory.
+ *
+ * Entries are compressed in memory (they are single certificates/CRLs), so
+ * sizes and CRC are known up front and no data descriptors are needed.
+ * ZIP64 records are added automatically past 65535 entries or 4 GiB.
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+struct z_stream_s;
+
+namespace common {
+
+class ZipStreamWriter {
+public:
+    /// Receives archive bytes in order; return false to abort (e.g. client gone)
+    using Sink = std::function<bool(const char* data, size_t len)>;
+
+    enum class Method {
+        Store,    ///< No compression (fastest)
+        Deflate   ///< Raw deflate, zlib default level
+    };
+
+    /**
+     * @param sink Output callback
+     * @param method Compression for all entries
+     * @param chunkSize Bytes buffered before each sink call
+     */
+    explicit ZipStreamWriter(Sink sink, Method method = Method::Deflate, size_t chunkSize = 64 * 1024);
+    ~ZipStreamWriter();
+
+    ZipStreamWriter(const ZipStreamWriter&) = delete;
+    ZipStreamWriter& operator=(const ZipStreamWriter&) = delete;
+
+    /**
+     * @brief Add one file
+     * @param name Path inside the archive (UTF-8, '/' separated)
+     * @return false if the name was already added (entry skipped)
+     * @throws std::runtime_error if compression fails, the sink aborted or finish() was called
+     */
+    bool addFile(const std::string& name, const uint8_t* data, size_t size);
+
+    bool addFile(const std::string& name, const std::vector<uint8_t>& data) {
+        return addFile(name, data.data(), data.size());
+    }
+
+    /**
+     * @brief Write the central directory and flush
+     * @throws std::runtime_error if the sink aborted
+     */
+    void finish();
+
+    size_t entryCount() const { return entries_.size(); }
+
+    /// Archive bytes produced so far (including buffered bytes)
+    uint64_t bytesWritten() const { return offset_; }
+
+private:
+    struct Entry {
+        std::string name;
+        uint32_t crc;
+        uint64_t compressedSize;
+        uint64_t uncompressedSize;
+        uint64_t localHeaderOffset;
+        uint16_t method;
+    };
+
+    void write(const void* data, size_t len);
+    void flush();
+
+    Sink sink_;
+    Method method_;
+    size_t chunkSize_;
+    std::string buffer_;
+    uint64_t offset_ = 0;
+    uint16_t dosTime_ = 0;
+    uint16_t dosDate_ = 0;
+    bool finished_ = false;
+    std::vector<Entry> entries_;
+    std::unordered_set<std::string> names_;
+    z_stream_s* deflater_ = nullptr;   ///< Reused across entries (deflateReset)
+    std::vector<uint8_t> compressed_;  ///< Scratch output for one entry
+};
+
+} // namespace common
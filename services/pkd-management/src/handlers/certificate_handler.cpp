@@ -25,6 +25,8 @@
 #include <tuple>
 #include <chrono>
 #include <ctime>
+#include <condition_variable>
+#include <mutex>
 
 // Services
 #include "../services/certificate_service.h"
@@ -49,6 +51,8 @@
 #include <icao/audit/audit_log.h>
 // Query helpers (boolLiteral, etc.)
 #include "query_helpers.h"
+// DB/LDAP work off the event loops
+#include "blocking_offload.h"
 
 // Bring in audit types for cleaner code
 using icao::audit::AuditLogEntry;
@@ -71,7 +75,8 @@ CertificateHandler::CertificateHandler(
     common::IQueryExecutor* queryExecutor,
     common::LdapConnectionPool* ldapPool,
     repositories::PendingDscRepository* pendingDscRepository,
-    services::LdapStorageService* ldapStorageService)
+    services::LdapStorageService* ldapStorageService,
+    common::BlockingExecutor* executor)
     : certificateService_(certificateService)
     , validationService_(validationService)
     , certificateRepository_(certificateRepository)
@@ -80,6 +85,7 @@ CertificateHandler::CertificateHandler(
     , ldapPool_(ldapPool)
     , pendingDscRepository_(pendingDscRepository)
     , ldapStorageService_(ldapStorageService)
+    , executor_(executor)
 {
 }
 
@@ -93,7 +99,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/search",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleSearch(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.search", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleSearch(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -103,7 +110,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/detail",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleDetail(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.detail", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleDetail(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -113,7 +121,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/validation",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleValidation(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.validation", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleValidation(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -123,7 +132,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/pa-lookup",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handlePaLookup(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.pa-lookup", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handlePaLookup(req, std::move(cb)); });
         },
         {drogon::Post}
     );
@@ -133,7 +143,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/export/file",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleExportFile(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.export-file", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleExportFile(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -143,7 +154,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/export/country",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleExportCountry(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.export-country", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleExportCountry(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -153,7 +165,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/export/all",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleExportAll(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.export-all", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleExportAll(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -163,7 +176,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/countries",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleCountries(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.countries", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleCountries(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -173,7 +187,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/dsc-nc/report",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleDscNcReport(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.dsc-nc-report", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleDscNcReport(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -183,7 +198,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/validate/link-cert",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleValidateLinkCert(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.validate-link-cert", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleValidateLinkCert(req, std::move(cb)); });
         },
         {drogon::Post}
     );
@@ -193,7 +209,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/link-certs/search",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleLinkCertsSearch(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.link-certs-search", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleLinkCertsSearch(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -204,7 +221,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handleLinkCertDetail(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "cert.link-cert-detail", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handleLinkCertDetail(req, std::move(cb), id); });
         },
         {drogon::Get}
     );
@@ -214,7 +232,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/crl/report",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleCrlReport(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.crl-report", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleCrlReport(req, std::move(cb)); });
         },
         {drogon::Get});
 
@@ -224,7 +243,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handleCrlDetail(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "cert.crl-detail", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handleCrlDetail(req, std::move(cb), id); });
         },
         {drogon::Get});
 
@@ -234,7 +254,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handleCrlDownload(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "cert.crl-download", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handleCrlDownload(req, std::move(cb), id); });
         },
         {drogon::Get});
 
@@ -243,7 +264,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/quality/report",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleQualityReport(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.quality-report", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleQualityReport(req, std::move(cb)); });
         },
         {drogon::Get});
 
@@ -252,7 +274,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/doc9303-checklist",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleDoc9303Checklist(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.doc9303-checklist", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleDoc9303Checklist(req, std::move(cb)); });
         },
         {drogon::Get});
 
@@ -263,7 +286,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/pending-dsc",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handlePendingDscList(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.pending-dsc-list", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handlePendingDscList(req, std::move(cb)); });
         },
         {drogon::Get});
 
@@ -272,7 +296,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/certificates/pending-dsc/stats",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handlePendingDscStats(req, std::move(callback));
+            common::handler::runBlocking(executor_, "cert.pending-dsc-stats", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handlePendingDscStats(req, std::move(cb)); });
         },
         {drogon::Get});
 
@@ -282,7 +307,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handlePendingDscApprove(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "cert.pending-dsc-approve", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handlePendingDscApprove(req, std::move(cb), id); });
         },
         {drogon::Post});
 
@@ -292,7 +318,8 @@ void CertificateHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& id) {
-            handlePendingDscReject(req, std::move(callback), id);
+            common::handler::runBlocking(executor_, "cert.pending-dsc-reject", std::move(callback),
+                [this, req, id](common::handler::ResponseCallback cb) { handlePendingDscReject(req, std::move(cb), id); });
         },
         {drogon::Post});
 
@@ -315,6 +342,8 @@ void CertificateHandler::handleSearch(
         std::string sourceFilter = req->getOptionalParameter<std::string>("source").value_or("");
         int limit = req->getOptionalParameter<int>("limit").value_or(50);
         int offset = req->getOptionalParameter<int>("offset").value_or(0);
+        std::string cursor = req->getOptionalParameter<std::string>("cursor").value_or("");
+        bool includeTotal = req->getOptionalParameter<std::string>("includeTotal").value_or("true") != "false";
 
         // Validate limit (max 200)
         if (limit > 200) limit = 200;
@@ -332,11 +361,16 @@ void CertificateHandler::handleSearch(
             if (!sourceFilter.empty()) filter.sourceType = sourceFilter;
             if (validityStr != "all") filter.validityStatus = validityStr;
             if (!searchTerm.empty()) filter.searchTerm = searchTerm;
+            if (!cursor.empty()) filter.cursor = cursor;
+            filter.includeTotal = includeTotal;
             filter.limit = limit;
             filter.offset = offset;
 
             Json::Value dbResult = certificateRepository_->search(filter);
             auto resp = drogon::HttpResponse::newHttpJsonResponse(dbResult);
+            if (!dbResult.get("success", false).asBool() && dbResult.get("error", "").asString() == "Invalid cursor") {
+                resp->setStatusCode(drogon::k400BadRequest);
+            }
             callback(resp);
         }
 
@@ -661,6 +695,165 @@ void CertificateHandler::handleExportFile(
     }
 }
 
+// =============================================================================
+// Streamed ZIP responses (export/country, export/all)
+// =============================================================================
+
+namespace {
+
+constexpr size_t kZipStreamChunkBytes = 64 * 1024;
+
+/// Chunks handed to the event loop but not yet written to the connection
+constexpr size_t kZipStreamInFlightBytes = 4 * kZipStreamChunkBytes;
+
+/**
+ * @brief Hands the async stream from Drogon's event loop to an export producer
+ *
+ * Drogon passes the ResponseStream to the loop once headers are out; the
+ * producer (blocking executor thread) waits for it, then posts each chunk to
+ * that loop, so the event loop never waits for the DB cursor.
+ *
+ * Backpressure: a chunk counts against kZipStreamInFlightBytes from the moment
+ * it is posted until the loop has handed it to the connection. The producer
+ * waits while the budget is exhausted, so a slow client holds back the DB
+ * cursor instead of the archive piling up in queued loop tasks.
+ */
+class ZipStreamSink : public std::enable_shared_from_this<ZipStreamSink> {
+public:
+    /// Loop side; stream for the response body
+    void attach(drogon::ResponseStreamPtr stream) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stream_ = std::move(stream);
+        loop_ = trantor::EventLoop::getEventLoopOfCurrentThread();
+        cv_.notify_all();
+    }
+
+    /// Loop side; Drogon dropped the response before handing over a stream
+    void cancel() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+        cv_.notify_all();
+    }
+
+    /// Producer side; false once the client has gone away
+    bool send(const char* data, size_t len) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // A chunk larger than the budget still goes out once nothing else is in flight
+        cv_.wait(lock, [this, len]() {
+            return ended_ || (cancelled_ && !stream_) ||
+                   (stream_ && (inFlight_ == 0 || inFlight_ + len <= kZipStreamInFlightBytes));
+        });
+        if (ended_ || !stream_) return false;
+        if (!loop_) return stream_->send(std::string(data, len));
+
+        inFlight_ += len;
+        loop_->queueInLoop([self = shared_from_this(), chunk = std::string(data, len)]() {
+            std::lock_guard<std::mutex> lock(self->mutex_);
+            if (!self->stream_ || !self->stream_->send(chunk)) self->ended_ = true;  // Client gone
+            self->inFlight_ -= chunk.size();
+            self->cv_.notify_all();
+        });
+        return true;
+    }
+
+    /// Producer side; end of stream (runs after the chunks already posted)
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ended_ = true;
+        if (!stream_) return;
+        if (!loop_) {
+            stream_->close();
+            stream_.reset();
+            return;
+        }
+        loop_->queueInLoop([self = shared_from_this()]() {
+            std::lock_guard<std::mutex> lock(self->mutex_);
+            if (self->stream_) {
+                self->stream_->close();
+                self->stream_.reset();
+            }
+        });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    drogon::ResponseStreamPtr stream_;
+    trantor::EventLoop* loop_ = nullptr;  ///< Loop that owns the connection
+    size_t inFlight_ = 0;                 ///< Bytes posted to loop_ and not yet sent
+    bool cancelled_ = false;              ///< Drogon dropped the stream callback
+    bool ended_ = false;                  ///< Client gone or stream closed
+};
+
+/// Cancels the sink when Drogon drops the stream callback (unblocks the producer if it never ran)
+struct ZipSinkReleaseGuard {
+    std::shared_ptr<ZipStreamSink> sink;
+    ~ZipSinkReleaseGuard() { sink->cancel(); }
+};
+
+struct ZipStreamOutcome {
+    bool responded = false;  ///< Stream response was handed to Drogon
+    bool completed = false;  ///< Central directory written (archive is valid)
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Produce a ZIP archive into a chunked stream response
+ *
+ * produce() runs on the calling thread and returns the number of entries
+ * added. The response is handed to Drogon with the first chunk, so failures
+ * (or an empty result) before that leave the callback unused and are
+ * reported to the caller. A failure after that truncates the archive (no
+ * central directory), which every unzip tool rejects.
+ *
+ * @throws std::exception from produce() if nothing was sent yet
+ */
+ZipStreamOutcome streamZipResponse(
+    const std::function<void(const drogon::HttpResponsePtr&)>& callback,
+    const std::string& filename,
+    common::ZipStreamWriter::Method method,
+    const std::function<size_t(common::ZipStreamWriter&)>& produce)
+{
+    auto sink = std::make_shared<ZipStreamSink>();
+    ZipStreamOutcome outcome;
+
+    common::ZipStreamWriter zip([&](const char* data, size_t len) {
+        if (!outcome.responded) {
+            auto guard = std::make_shared<ZipSinkReleaseGuard>(ZipSinkReleaseGuard{sink});
+            auto resp = drogon::HttpResponse::newAsyncStreamResponse(
+                [sink, guard](drogon::ResponseStreamPtr stream) { sink->attach(std::move(stream)); });
+            resp->setContentTypeCode(drogon::CT_APPLICATION_ZIP);
+            resp->addHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
+            callback(resp);
+            outcome.responded = true;
+        }
+        return sink->send(data, len);
+    }, method, kZipStreamChunkBytes);
+
+    try {
+        if (produce(zip) == 0 && zip.bytesWritten() == 0) {
+            return outcome;  // Nothing to export; caller responds
+        }
+        zip.finish();
+        outcome.completed = true;
+    } catch (const std::exception& e) {
+        if (!outcome.responded) throw;
+        spdlog::error("ZIP stream {} aborted after {} bytes: {}", filename, zip.bytesWritten(), e.what());
+    }
+    outcome.bytes = zip.bytesWritten();
+    sink->close();
+    return outcome;
+}
+
+/// ?compression=store|deflate (default deflate)
+common::ZipStreamWriter::Method zipMethodFromRequest(const drogon::HttpRequestPtr& req) {
+    std::string compression = req->getOptionalParameter<std::string>("compression").value_or("deflate");
+    return compression == "store" ? common::ZipStreamWriter::Method::Store
+                                  : common::ZipStreamWriter::Method::Deflate;
+}
+
+} // anonymous namespace
+
 // =============================================================================
 // Handler 6: GET /api/certificates/export/country
 // =============================================================================
@@ -684,31 +877,27 @@ void CertificateHandler::handleExportCountry(
 
         spdlog::info("Certificate export country: country={}, format={}", country, format);
 
-        // Export all certificates for country
         services::ExportFormat exportFormat = (format == "der") ?
             services::ExportFormat::DER : services::ExportFormat::PEM;
+        std::string filename = country + "_certificates.zip";
 
-        auto result = certificateService_->exportCountryCertificates(country, exportFormat);
+        auto outcome = streamZipResponse(callback, filename, zipMethodFromRequest(req),
+            [&](common::ZipStreamWriter& zip) {
+                return services::streamCountryCertificatesFromDb(
+                    certificateRepository_, crlRepository_, country, exportFormat, zip).total();
+            });
 
-        if (!result.success) {
+        if (!outcome.responded) {
             Json::Value error;
             error["success"] = false;
-            error["error"] = result.errorMessage;
+            error["error"] = "No certificates found for country: " + country;
             auto resp = drogon::HttpResponse::newHttpJsonResponse(error);
             resp->setStatusCode(drogon::k500InternalServerError);
             callback(resp);
             return;
         }
 
-        // Return ZIP file
-        auto resp = drogon::HttpResponse::newHttpResponse();
-        resp->setBody(std::string(result.data.begin(), result.data.end()));
-        resp->setContentTypeCode(drogon::CT_NONE);
-        resp->addHeader("Content-Type", result.contentType);
-        resp->addHeader("Content-Disposition", "attachment; filename=\"" + result.filename + "\"");
-        callback(resp);
-
-        // Audit logging - CERT_EXPORT success (country ZIP)
+        // Audit logging - CERT_EXPORT (country ZIP)
         {
             AuditLogEntry auditEntry;
             auto [userId, username] = extractUserFromRequest(req);
@@ -722,12 +911,12 @@ void CertificateHandler::handleExportCountry(
             auditEntry.userAgent = req->getHeader("User-Agent");
             auditEntry.requestMethod = "GET";
             auditEntry.requestPath = "/api/certificates/export/country";
-            auditEntry.success = true;
+            auditEntry.success = outcome.completed;
             Json::Value metadata;
             metadata["country"] = country;
             metadata["format"] = format;
-            metadata["fileName"] = result.filename;
-            metadata["fileSize"] = static_cast<Json::Int64>(result.data.size());
+            metadata["fileName"] = filename;
+            metadata["fileSize"] = static_cast<Json::Int64>(outcome.bytes);
             auditEntry.metadata = metadata;
             logOperation(queryExecutor_, auditEntry);
         }
@@ -752,34 +941,26 @@ void CertificateHandler::handleExportAll(
         services::ExportFormat exportFormat = (format == "der") ?
             services::ExportFormat::DER : services::ExportFormat::PEM;
 
-        auto exportResult = services::exportAllCertificatesFromDb(
-            certificateRepository_,
-            crlRepository_,
-            queryExecutor_,
-            exportFormat,
-            ldapPool_
-        );
+        std::string filename = services::fullExportFilename();
 
-        if (!exportResult.success) {
+        auto outcome = streamZipResponse(callback, filename, zipMethodFromRequest(req),
+            [&](common::ZipStreamWriter& zip) {
+                return services::streamAllCertificatesFromDb(
+                    certificateRepository_, crlRepository_, exportFormat, ldapPool_, zip).total();
+            });
+
+        if (!outcome.responded) {
             Json::Value error;
             error["success"] = false;
-            error["error"] = exportResult.errorMessage;
+            error["error"] = "No data found for export";
             auto resp = drogon::HttpResponse::newHttpJsonResponse(error);
             resp->setStatusCode(drogon::k500InternalServerError);
             callback(resp);
             return;
         }
 
-        // Return ZIP binary
-        auto resp = drogon::HttpResponse::newHttpResponse();
-        resp->setStatusCode(drogon::k200OK);
-        resp->setContentTypeString("application/zip");
-        resp->addHeader("Content-Disposition",
-            "attachment; filename=\"" + exportResult.filename + "\"");
-        resp->setBody(std::string(
-            reinterpret_cast<const char*>(exportResult.data.data()),
-            exportResult.data.size()));
-        callback(resp);
+        spdlog::info("Full PKD export {}: {} bytes streamed",
+                     outcome.completed ? "completed" : "aborted", outcome.bytes);
 
         // Audit log
         {
@@ -794,11 +975,11 @@ void CertificateHandler::handleExportAll(
             auditEntry.userAgent = req->getHeader("User-Agent");
             auditEntry.requestMethod = "GET";
             auditEntry.requestPath = "/api/certificates/export/all";
-            auditEntry.success = true;
+            auditEntry.success = outcome.completed;
             Json::Value metadata;
             metadata["format"] = format;
-            metadata["fileName"] = exportResult.filename;
-            metadata["fileSize"] = static_cast<Json::Int64>(exportResult.data.size());
+            metadata["fileName"] = filename;
+            metadata["fileSize"] = static_cast<Json::Int64>(outcome.bytes);
             auditEntry.metadata = metadata;
             logOperation(queryExecutor_, auditEntry);
         }
@@ -2430,6 +2611,8 @@ void CertificateHandler::handlePendingDscApprove(
             }
         }
 
+        certificateRepository_->invalidateSearchSummaryCache();
+
         // 4. Mark pending entry as APPROVED
         if (!pendingDscRepository_->updateStatus(id, "APPROVED", reviewedBy, reviewComment)) {
             spdlog::warn("[PendingDsc] Failed to update status to APPROVED for id={} — entry may have been concurrently processed", id);
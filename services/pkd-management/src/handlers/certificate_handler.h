@@ -48,6 +48,7 @@ namespace services {
 namespace common {
     class IQueryExecutor;
     class LdapConnectionPool;
+    class BlockingExecutor;
 }
 
 namespace handlers {
@@ -72,6 +73,7 @@ public:
      * @param crlRepository CRL repository (non-owning pointer)
      * @param queryExecutor Query executor for DB operations (non-owning pointer)
      * @param ldapPool LDAP connection pool (non-owning pointer)
+     * @param executor Blocking-work executor for DB/LDAP handlers (nullptr = run on the event loop)
      */
     CertificateHandler(
         services::CertificateService* certificateService,
@@ -81,7 +83,8 @@ public:
         common::IQueryExecutor* queryExecutor,
         common::LdapConnectionPool* ldapPool,
         repositories::PendingDscRepository* pendingDscRepository = nullptr,
-        services::LdapStorageService* ldapStorageService = nullptr);
+        services::LdapStorageService* ldapStorageService = nullptr,
+        common::BlockingExecutor* executor = nullptr);
 
     /**
      * @brief Register certificate routes
@@ -102,6 +105,7 @@ private:
     common::LdapConnectionPool* ldapPool_;
     repositories::PendingDscRepository* pendingDscRepository_;
     services::LdapStorageService* ldapStorageService_;
+    common::BlockingExecutor* executor_;
 
     // --- Handler methods ---
 
@@ -63,6 +63,19 @@ struct AppConfig {
     int threadNum = 4;
     int maxBodySizeMB = 100;  // HTTP upload body size limit (MB)
 
+    // API client authentication: key lookup cache and write-behind usage recording
+    int apiClientCacheTtlSec = 60;       // 0 disables the key cache
+    int apiUsageFlushIntervalSec = 5;    // Max delay before usage reaches the DB
+    int apiUsageFlushBatch = 500;        // Pending usage rows that trigger an early flush
+    int apiUsageMaxPending = 10000;      // Usage rows kept while the DB is unavailable
+
+    // Certificate search: cached totals/stats and Oracle Text substring search
+    int certSearchCountCacheTtlSec = 300;  // 0 disables the cache; uploads clear it
+    bool certSearchOracleText = false;     // Requires the CONTEXT indexes (Oracle only)
+
+    // Max age of a parsed country CRL; uploads and journaled CRL inserts invalidate earlier
+    int crlCacheTtlSeconds = 300;
+
     // Safe environment variable integer parser with range clamping
     static int envStoi(const char* val, int defaultVal, int minVal, int maxVal) {
         try {
@@ -136,6 +149,19 @@ struct AppConfig {
         // HTTP upload body size limit
         if (auto val = std::getenv("MAX_BODY_SIZE_MB")) config.maxBodySizeMB = envStoi(val, 100, 1, 500);
 
+        // API client key cache / usage recording
+        if (auto val = std::getenv("API_CLIENT_CACHE_TTL_SEC")) config.apiClientCacheTtlSec = envStoi(val, 60, 0, 3600);
+        if (auto val = std::getenv("API_USAGE_FLUSH_INTERVAL_SEC")) config.apiUsageFlushIntervalSec = envStoi(val, 5, 1, 300);
+        if (auto val = std::getenv("API_USAGE_FLUSH_BATCH")) config.apiUsageFlushBatch = envStoi(val, 500, 1, 10000);
+        if (auto val = std::getenv("API_USAGE_MAX_PENDING")) config.apiUsageMaxPending = envStoi(val, 10000, 100, 1000000);
+
+        // Certificate search
+        if (auto val = std::getenv("CERT_SEARCH_COUNT_CACHE_TTL_SEC")) config.certSearchCountCacheTtlSec = envStoi(val, 300, 0, 86400);
+        if (auto val = std::getenv("CERT_SEARCH_ORACLE_TEXT")) config.certSearchOracleText = (std::string(val) == "true");
+
+        // Parsed CRL cache
+        if (auto val = std::getenv("CRL_CACHE_TTL_SECONDS")) config.crlCacheTtlSeconds = envStoi(val, 300, 0, 86400);
+
         // ICAO Scheduler Configuration
         if (auto val = std::getenv("ICAO_CHECK_SCHEDULE_HOUR")) {
             config.icaoCheckScheduleHour = envStoi(val, 9, 0, 23);
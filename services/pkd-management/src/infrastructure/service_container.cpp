@@ -16,6 +16,9 @@
 #include "db_connection_pool_factory.h"
 #include "i_query_executor.h"
 #include <ldap_connection_pool.h>
+#include "blocking_executor.h"
+#include <icao/audit/audit_sink.h>
+#include <icao/validation/crl_cache.h>
 
 // Repositories
 #include "../repositories/upload_repository.h"
@@ -39,6 +42,7 @@
 #include "../services/certificate_service.h"
 #include "../services/ldap_storage_service.h"
 #include "../services/csr_service.h"
+#include "../services/api_usage_recorder.h"
 
 // LDAP Provider Adapters (for real-time PA Lookup validation)
 #include "../adapters/ldap_csca_provider.h"
@@ -72,6 +76,7 @@
 #include "../sync/infrastructure/sync_scheduler.h"
 
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 namespace infrastructure {
 
@@ -80,6 +85,8 @@ struct ServiceContainer::Impl {
     std::shared_ptr<common::IDbConnectionPool> dbPool;
     std::unique_ptr<common::IQueryExecutor> queryExecutor;
     std::shared_ptr<common::LdapConnectionPool> ldapPool;
+    std::unique_ptr<common::BlockingExecutor> blockingExecutor;
+    std::unique_ptr<icao::audit::AsyncAuditSink> auditSink;
 
     // Repositories
     std::shared_ptr<repositories::UploadRepository> uploadRepository;
@@ -107,6 +114,7 @@ struct ServiceContainer::Impl {
     std::shared_ptr<services::CertificateService> certificateService;
     std::shared_ptr<services::LdapStorageService> ldapStorageService;
     std::shared_ptr<services::CsrService> csrService;
+    std::unique_ptr<services::ApiUsageRecorder> apiUsageRecorder;
 
     // Handlers
     std::shared_ptr<handlers::AuthHandler> authHandler;
@@ -139,6 +147,24 @@ ServiceContainer::~ServiceContainer() {
 void ServiceContainer::shutdown() {
     if (!impl_) return;
 
+    // Finish in-flight handler work while the services it calls still exist
+    if (impl_->blockingExecutor) {
+        impl_->blockingExecutor->shutdown();
+    }
+
+    // Later audit events are written inline; queued ones are flushed now
+    if (impl_->auditSink) {
+        icao::audit::setAuditSink(nullptr);
+        impl_->auditSink->shutdown();
+        impl_->auditSink.reset();
+    }
+
+    // Write buffered API usage while the repository still exists
+    if (impl_->apiUsageRecorder) {
+        impl_->apiUsageRecorder->stop();
+        impl_->apiUsageRecorder.reset();
+    }
+
     // Release in reverse order
     impl_->csrHandler.reset();
     impl_->apiClientRequestHandler.reset();
@@ -207,7 +233,7 @@ bool ServiceContainer::initialize(const AppConfig& config) {
 
         // Read LDAP pool sizes from environment (default: min=2, max=10, timeout=5)
         int ldapPoolMin = 2, ldapPoolMax = 10, ldapPoolTimeout = 5;
-        int ldapNetworkTimeout = 5, ldapHealthCheckTimeout = 2;
+        int ldapNetworkTimeout = 5, ldapHealthCheckTimeout = 2, ldapIdleValidation = 0;
         auto safeStoi = [](const char* v, int defaultVal) {
             try { return std::stoi(v); } catch (...) { spdlog::warn("Invalid env value '{}', using default {}", v, defaultVal); return defaultVal; }
         };
@@ -216,6 +242,7 @@ bool ServiceContainer::initialize(const AppConfig& config) {
         if (auto* v = std::getenv("LDAP_POOL_TIMEOUT")) ldapPoolTimeout = safeStoi(v, ldapPoolTimeout);
         if (auto* v = std::getenv("LDAP_NETWORK_TIMEOUT")) ldapNetworkTimeout = safeStoi(v, ldapNetworkTimeout);
         if (auto* v = std::getenv("LDAP_HEALTH_CHECK_TIMEOUT")) ldapHealthCheckTimeout = safeStoi(v, ldapHealthCheckTimeout);
+        if (auto* v = std::getenv("LDAP_POOL_IDLE_VALIDATION_SEC")) ldapIdleValidation = safeStoi(v, ldapIdleValidation);
 
         impl_->ldapPool = std::make_shared<common::LdapConnectionPool>(
             ldapWriteUri,
@@ -225,7 +252,8 @@ bool ServiceContainer::initialize(const AppConfig& config) {
             ldapPoolMax,
             ldapPoolTimeout,
             ldapNetworkTimeout,
-            ldapHealthCheckTimeout
+            ldapHealthCheckTimeout,
+            ldapIdleValidation
         );
 
         spdlog::info("LDAP connection pool initialized (min={}, max={}, networkTimeout={}s, healthCheckTimeout={}s, host={})",
@@ -266,6 +294,13 @@ bool ServiceContainer::initialize(const AppConfig& config) {
 
         impl_->queryExecutor = common::createQueryExecutor(impl_->dbPool.get());
         spdlog::info("Query Executor initialized (DB type: {})", impl_->queryExecutor->getDatabaseType());
+
+        // Audit rows (operation_audit_log, auth_audit_log) are queued and written in batches
+        auto auditConfig = icao::audit::AsyncAuditSink::Config::fromEnvironment({});
+        if (auditConfig.enabled) {
+            impl_->auditSink = std::make_unique<icao::audit::AsyncAuditSink>(impl_->queryExecutor.get(), auditConfig);
+            icao::audit::setAuditSink(impl_->auditSink.get());
+        }
     } catch (const std::exception& e) {
         spdlog::critical("Failed to initialize database connection pool: {}", e.what());
         return false;
@@ -274,6 +309,9 @@ bool ServiceContainer::initialize(const AppConfig& config) {
     // --- Phase 4: Repositories ---
     impl_->uploadRepository = std::make_shared<repositories::UploadRepository>(impl_->queryExecutor.get());
     impl_->certificateRepository = std::make_shared<repositories::CertificateRepository>(impl_->queryExecutor.get());
+    impl_->certificateRepository->setSearchSummaryCacheTtl(std::chrono::seconds(config.certSearchCountCacheTtlSec));
+    impl_->certificateRepository->setOracleTextSearch(config.certSearchOracleText);
+    icao::validation::CrlCache::instance().setTtl(std::chrono::seconds(config.crlCacheTtlSeconds));
     impl_->validationRepository = std::make_shared<repositories::ValidationRepository>(
         impl_->queryExecutor.get(), impl_->ldapPool, config.ldapBaseDn);
     impl_->auditRepository = std::make_shared<repositories::AuditRepository>(impl_->queryExecutor.get());
@@ -327,7 +365,23 @@ bool ServiceContainer::initialize(const AppConfig& config) {
     );
     spdlog::info("Services initialized (Upload, Validation, Audit, LdifStructure, Csr)");
 
+    // API key lookups are cached; usage counters/log rows are written behind in batches
+    impl_->apiClientRepository->setKeyCacheTtl(std::chrono::seconds(config.apiClientCacheTtlSec));
+    services::ApiUsageRecorder::Config usageConfig;
+    usageConfig.flushInterval = std::chrono::seconds(config.apiUsageFlushIntervalSec);
+    usageConfig.flushBatch = static_cast<size_t>(config.apiUsageFlushBatch);
+    usageConfig.maxPending = static_cast<size_t>(config.apiUsageMaxPending);
+    impl_->apiUsageRecorder = std::make_unique<services::ApiUsageRecorder>(
+        impl_->apiClientRepository.get(), usageConfig);
+    impl_->apiUsageRecorder->start();
+
     // --- Phase 7: Handlers ---
+    // Executor for blocking handler work (BLOCKING_EXECUTOR_* overrides)
+    common::BlockingExecutor::Config executorDefaults;
+    executorDefaults.workers = static_cast<size_t>(config.threadNum) * 4;
+    impl_->blockingExecutor = std::make_unique<common::BlockingExecutor>(
+        common::BlockingExecutor::Config::fromEnvironment(executorDefaults));
+
     impl_->authHandler = std::make_shared<handlers::AuthHandler>(
         impl_->userRepository.get(),
         impl_->authAuditRepository.get(),
@@ -349,7 +403,8 @@ bool ServiceContainer::initialize(const AppConfig& config) {
         impl_->queryExecutor.get(),
         impl_->ldapPool.get(),
         impl_->pendingDscRepository.get(),
-        impl_->ldapStorageService.get()
+        impl_->ldapStorageService.get(),
+        impl_->blockingExecutor.get()
     );
     spdlog::info("Certificate handler initialized (20 endpoints)");
 
@@ -390,12 +445,14 @@ bool ServiceContainer::initialize(const AppConfig& config) {
         impl_->syncConfig->ldapDataContainer = config.ldapDataContainer;
         impl_->syncConfig->ldapNcDataContainer = config.ldapNcDataContainer;
         // Load sync-specific settings from env
-        if (auto e = std::getenv("AUTO_RECONCILE")) impl_->syncConfig->autoReconcile = (std::string(e) == "true");
-        if (auto e = std::getenv("MAX_RECONCILE_BATCH_SIZE")) impl_->syncConfig->maxReconcileBatchSize = std::stoi(e);
+        impl_->syncConfig->loadSyncSettingsFromEnv();
         if (auto e = std::getenv("DAILY_SYNC_ENABLED")) impl_->syncConfig->dailySyncEnabled = (std::string(e) == "true");
         if (auto e = std::getenv("DAILY_SYNC_HOUR")) impl_->syncConfig->dailySyncHour = std::stoi(e);
         if (auto e = std::getenv("DAILY_SYNC_MINUTE")) impl_->syncConfig->dailySyncMinute = std::stoi(e);
         if (auto e = std::getenv("REVALIDATE_CERTS_ON_SYNC")) impl_->syncConfig->revalidateCertsOnSync = (std::string(e) == "true");
+        if (auto e = std::getenv("REVALIDATE_INCREMENTAL")) impl_->syncConfig->revalidateIncremental = (std::string(e) == "true");
+        if (auto e = std::getenv("REVALIDATE_FULL_SWEEP_DAYS")) impl_->syncConfig->revalidateFullSweepDays = std::max(1, std::stoi(e));
+        if (auto e = std::getenv("REVALIDATE_PARALLELISM")) impl_->syncConfig->revalidateParallelism = std::max(1, std::stoi(e));
 
         // Sync repositories (use same queryExecutor as main service)
         impl_->syncStatusRepo = std::make_shared<icao::relay::repositories::SyncStatusRepository>(
@@ -416,12 +473,17 @@ bool ServiceContainer::initialize(const AppConfig& config) {
             impl_->syncReconciliationRepo, impl_->syncCertificateRepo, impl_->syncCrlRepo);
         impl_->syncValidationService = std::make_shared<icao::relay::services::ValidationService>(
             impl_->syncValidationRepo.get(), impl_->syncCertificateRepo.get(), impl_->syncCrlRepo.get());
+        impl_->syncValidationService->setFullSweepIntervalHours(impl_->syncConfig->revalidateFullSweepDays * 24);
+        impl_->syncValidationService->setParallelism(impl_->syncConfig->revalidateParallelism);
 
         // Sync scheduler
         impl_->syncScheduler = std::make_unique<infrastructure::SyncScheduler>();
 
-        spdlog::info("Sync module initialized (autoReconcile={}, dailySync={})",
-                     impl_->syncConfig->autoReconcile, impl_->syncConfig->dailySyncEnabled);
+        spdlog::info("Sync module initialized (autoReconcile={}, reconcileLdapWindow={}, "
+                     "ldapStatsPageSize={}, ldapStatsIncremental={}, dailySync={})",
+                     impl_->syncConfig->autoReconcile, impl_->syncConfig->reconcileLdapWindow,
+                     impl_->syncConfig->ldapStatsPageSize, impl_->syncConfig->ldapStatsIncremental,
+                     impl_->syncConfig->dailySyncEnabled);
     } catch (const std::exception& e) {
         spdlog::warn("Sync module initialization failed: {} (non-fatal)", e.what());
     }
@@ -437,6 +499,7 @@ bool ServiceContainer::initialize(const AppConfig& config) {
 common::IQueryExecutor* ServiceContainer::queryExecutor() const { return impl_->queryExecutor.get(); }
 common::LdapConnectionPool* ServiceContainer::ldapPool() const { return impl_->ldapPool.get(); }
 common::IDbConnectionPool* ServiceContainer::dbPool() const { return impl_->dbPool.get(); }
+common::BlockingExecutor* ServiceContainer::blockingExecutor() const { return impl_->blockingExecutor.get(); }
 
 // --- Repository Accessors ---
 repositories::UploadRepository* ServiceContainer::uploadRepository() const { return impl_->uploadRepository.get(); }
@@ -456,6 +519,7 @@ repositories::CsrRepository* ServiceContainer::csrRepository() const { return im
 services::UploadService* ServiceContainer::uploadService() const { return impl_->uploadService.get(); }
 services::ValidationService* ServiceContainer::validationService() const { return impl_->validationService.get(); }
 services::AuditService* ServiceContainer::auditService() const { return impl_->auditService.get(); }
+services::ApiUsageRecorder* ServiceContainer::apiUsageRecorder() const { return impl_->apiUsageRecorder.get(); }
 services::CertificateService* ServiceContainer::certificateService() const { return impl_->certificateService.get(); }
 services::LdapStorageService* ServiceContainer::ldapStorageService() const { return impl_->ldapStorageService.get(); }
 services::CsrService* ServiceContainer::csrService() const { return impl_->csrService.get(); }
@@ -21,6 +21,7 @@ namespace common {
     class IDbConnectionPool;
     class IQueryExecutor;
     class LdapConnectionPool;
+    class BlockingExecutor;
 }
 
 // Forward declarations - Sync module (moved from pkd-relay)
@@ -62,6 +63,7 @@ namespace services {
     class CertificateService;
     class LdapStorageService;
     class CsrService;
+    class ApiUsageRecorder;
 }
 
 // Forward declarations - Handlers
@@ -125,6 +127,7 @@ public:
     common::IQueryExecutor* queryExecutor() const;
     common::LdapConnectionPool* ldapPool() const;
     common::IDbConnectionPool* dbPool() const;
+    common::BlockingExecutor* blockingExecutor() const;  ///< DB/LDAP work off the event loops
 
     // --- Repository Accessors ---
     repositories::UploadRepository* uploadRepository() const;
@@ -147,6 +150,7 @@ public:
     services::CertificateService* certificateService() const;
     services::LdapStorageService* ldapStorageService() const;
     services::CsrService* csrService() const;
+    services::ApiUsageRecorder* apiUsageRecorder() const;  ///< Write-behind API client usage
 
     // --- Handler Accessors ---
     handlers::AuthHandler* authHandler() const;
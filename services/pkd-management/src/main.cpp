@@ -29,9 +29,11 @@
 // Pool stats for /internal/metrics
 #include "db_connection_interface.h"
 #include "ldap_connection_pool.h"
+#include "blocking_offload.h"
 
 // Project headers
 #include <icao/audit/audit_log.h>
+#include <icao/validation/signature_cache.h>
 // progress_manager removed — moved to pkd-relay (v2.41.0)
 
 // Infrastructure
@@ -50,6 +52,7 @@
 
 // Sync module (moved from pkd-relay)
 #include "i_query_executor.h"
+#include "oracle_sql_translator.h"
 #include "sync/handlers/sync_handler.h"
 #include "sync/handlers/reconciliation_handler.h"
 #include "sync/handlers/notification_handler.h"
@@ -374,16 +377,69 @@ void registerRoutes() {
                 result["dbPool"]["available"] = static_cast<Json::UInt>(stats.availableConnections);
                 result["dbPool"]["total"] = static_cast<Json::UInt>(stats.totalConnections);
                 result["dbPool"]["max"] = static_cast<Json::UInt>(stats.maxConnections);
+                result["dbPool"]["acquireCount"] = static_cast<Json::UInt64>(stats.acquireCount);
+                result["dbPool"]["acquireWaitTotalUs"] = static_cast<Json::UInt64>(stats.acquireWaitTotalUs);
+                result["dbPool"]["acquireWaitMaxUs"] = static_cast<Json::UInt64>(stats.acquireWaitMaxUs);
+                result["dbPool"]["healthCheckCount"] = static_cast<Json::UInt64>(stats.healthCheckCount);
+                result["dbPool"]["discardedConnections"] = static_cast<Json::UInt64>(stats.discardedConnections);
+                result["dbPool"]["statementPrepares"] = static_cast<Json::UInt64>(stats.statementPrepares);
+                result["dbPool"]["statementExecutes"] = static_cast<Json::UInt64>(stats.statementExecutes);
             }
             if (g_services && g_services->ldapPool()) {
                 auto stats = g_services->ldapPool()->getStats();
                 result["ldapPool"]["available"] = static_cast<Json::UInt>(stats.availableConnections);
                 result["ldapPool"]["total"] = static_cast<Json::UInt>(stats.totalConnections);
                 result["ldapPool"]["max"] = static_cast<Json::UInt>(stats.maxConnections);
+                result["ldapPool"]["acquireCount"] = static_cast<Json::UInt64>(stats.acquireCount);
+                result["ldapPool"]["acquireWaitTotalUs"] = static_cast<Json::UInt64>(stats.acquireWaitTotalUs);
+                result["ldapPool"]["acquireWaitMaxUs"] = static_cast<Json::UInt64>(stats.acquireWaitMaxUs);
+                result["ldapPool"]["healthCheckCount"] = static_cast<Json::UInt64>(stats.healthCheckCount);
+                result["ldapPool"]["discardedConnections"] = static_cast<Json::UInt64>(stats.discardedConnections);
+            }
+            if (g_services && g_services->blockingExecutor()) {
+                result["blockingExecutor"] = common::handler::blockingExecutorMetrics(*g_services->blockingExecutor());
+            }
+            if (auto* sink = icao::audit::auditSink()) {
+                result["auditSink"] = icao::audit::auditSinkMetrics(*sink);
+            }
+            {
+                auto stats = icao::validation::SignatureVerificationCache::instance().stats();
+                result["signatureCache"]["hits"] = static_cast<Json::UInt64>(stats.hits);
+                result["signatureCache"]["misses"] = static_cast<Json::UInt64>(stats.misses);
+                result["signatureCache"]["entries"] = static_cast<Json::UInt64>(stats.entries);
+            }
+            if (g_services && g_services->queryExecutor() &&
+                g_services->queryExecutor()->getDatabaseType() == "oracle") {
+                result["oracleSqlTranslation"] = common::oracleSqlTranslationMetrics(common::OracleSqlTranslator::instance());
             }
             callback(drogon::HttpResponse::newHttpJsonResponse(result));
         }, {drogon::Get});
 
+    // --- Certificate search totals change signal (sent by pkd-relay after certificate writes/deletes) ---
+    // Internal callers only: private-network peers, and not proxied by the gateway
+    app.registerHandler("/internal/search-summary/invalidate",
+        [](const drogon::HttpRequestPtr& req,
+           std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
+            Json::Value result;
+            if (!req->peerAddr().isIntranetIp() || !req->getHeader("X-Forwarded-For").empty()) {
+                result["success"] = false;
+                result["message"] = "Internal endpoint";
+                auto resp = drogon::HttpResponse::newHttpJsonResponse(result);
+                resp->setStatusCode(drogon::k403Forbidden);
+                callback(resp);
+                return;
+            }
+            auto* certRepo = g_services ? g_services->certificateRepository() : nullptr;
+            if (certRepo) {
+                certRepo->invalidateSearchSummaryCache();
+            }
+            result["success"] = (certRepo != nullptr);
+            result["message"] = certRepo ? "Search summary cache cleared" : "Service not initialized";
+            auto resp = drogon::HttpResponse::newHttpJsonResponse(result);
+            resp->setStatusCode(certRepo ? drogon::k202Accepted : drogon::k503ServiceUnavailable);
+            callback(resp);
+        }, {drogon::Post});
+
     spdlog::info("API routes registered");
 }
 
@@ -452,18 +508,32 @@ int main(int argc, char* argv[]) {
             app.registerPreHandlingAdvice([authMiddleware](const drogon::HttpRequestPtr& req,
                                                            drogon::AdviceCallback&& callback,
                                                            drogon::AdviceChainCallback&& chainCallback) {
-                // AuthMiddleware will validate JWT and set session for non-public endpoints
-                authMiddleware->doFilter(
-                    req,
-                    [callback = std::move(callback)](const drogon::HttpResponsePtr& resp) mutable {
-                        // Authentication failed - return error response
-                        callback(resp);
-                    },
-                    [chainCallback = std::move(chainCallback)]() mutable {
-                        // Authentication succeeded or public endpoint - continue to handler
-                        chainCallback();
-                    }
-                );
+                // JWT validation is CPU-only; API keys are looked up in the DB,
+                // so that path runs on the blocking executor and resumes on this loop
+                common::BlockingExecutor* executor = g_services ? g_services->blockingExecutor() : nullptr;
+                if (req->getHeader("X-API-Key").empty()) executor = nullptr;
+
+                trantor::EventLoop* loop = trantor::EventLoop::getEventLoopOfCurrentThread();
+                auto chain = std::make_shared<drogon::AdviceChainCallback>(std::move(chainCallback));
+                common::handler::runBlocking(executor, "auth.api-key", std::move(callback),
+                    [authMiddleware, req, loop, chain](common::handler::ResponseCallback cb) {
+                        // AuthMiddleware will validate JWT/API key and set session for non-public endpoints
+                        authMiddleware->doFilter(
+                            req,
+                            [cb = std::move(cb)](const drogon::HttpResponsePtr& resp) mutable {
+                                // Authentication failed - return error response
+                                cb(resp);
+                            },
+                            [loop, chain]() {
+                                // Authentication succeeded or public endpoint - continue to handler
+                                if (loop && !loop->isInLoopThread()) {
+                                    loop->queueInLoop([chain]() { (*chain)(); });
+                                } else {
+                                    (*chain)();
+                                }
+                            }
+                        );
+                    });
             });
 
             spdlog::info("AuthMiddleware registered globally - JWT authentication enabled");
@@ -524,7 +594,10 @@ int main(int argc, char* argv[]) {
             });
 
             g_services->syncScheduler()->setRevalidateFn([&]() {
-                g_services->syncValidationService()->revalidateAll();
+                g_services->syncValidationService()->revalidateAll(
+                    g_services->syncConfig().revalidateIncremental
+                        ? icao::relay::services::RevalidationMode::Auto
+                        : icao::relay::services::RevalidationMode::Full);
             });
 
             g_services->syncScheduler()->start();
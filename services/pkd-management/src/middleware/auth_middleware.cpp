@@ -7,6 +7,7 @@
 #include "../repositories/api_client_repository.h"
 #include "../auth/api_key_generator.h"
 #include "../infrastructure/service_container.h"
+#include "../services/api_usage_recorder.h"
 #include <spdlog/spdlog.h>
 #include <cstdlib>
 #include <regex>
@@ -20,11 +21,31 @@ extern infrastructure::ServiceContainer* g_services;
 
 namespace middleware {
 
+namespace {
+
+/// Buffer one API key request for the write-behind recorder (direct DB write if it is not running)
+void recordApiUsage(const domain::models::ApiClient& client,
+                    const std::string& endpoint, const std::string& method,
+                    const std::string& ipAddress, const std::string& userAgent) {
+    if (auto* recorder = g_services->apiUsageRecorder()) {
+        recorder->record(client.id, client.clientName, endpoint, method,
+                         200, 0, ipAddress, userAgent);
+        return;
+    }
+    g_services->apiClientRepository()->updateUsage(client.id);
+    g_services->apiClientRepository()->insertUsageLog(
+        client.id, client.clientName, endpoint, method,
+        200, 0, ipAddress, userAgent);
+}
+
+} // anonymous namespace
+
 // Static members initialization
 std::set<std::string> AuthMiddleware::publicEndpoints_ = {
     // --- System & Authentication ---
     "^/api/health.*",              // Health check endpoints
     "^/internal/metrics$",         // Internal metrics for monitoring service
+    "^/internal/search-summary/invalidate$",  // pkd-relay change signal (handler checks peer)
     "^/api/auth/login$",           // Login endpoint
     "^/api/auth/register$",        // Registration endpoint (future)
     "^/api/auth/logout$",          // Logout endpoint (handler validates JWT)
@@ -204,13 +225,8 @@ void AuthMiddleware::doFilter(
                 attrs->insert("auth_type", std::string("api_key"));
 
                 // Track usage
-                g_services->apiClientRepository()->updateUsage(client->id);
-                g_services->apiClientRepository()->insertUsageLog(
-                    client->id, client->clientName,
-                    path, req->methodString(),
-                    200, 0,
-                    req->peerAddr().toIp(),
-                    req->getHeader("User-Agent"));
+                recordApiUsage(*client, path, req->methodString(),
+                               req->peerAddr().toIp(), req->getHeader("User-Agent"));
             }
         }
         // For public endpoints, still try to extract user info from JWT if present
@@ -282,15 +298,10 @@ void AuthMiddleware::doFilter(
                 }
             }
 
-            // Update usage + insert detailed log (fire-and-forget)
+            // Update usage + insert detailed log (buffered, written behind)
             if (g_services && g_services->apiClientRepository()) {
-                g_services->apiClientRepository()->updateUsage(client->id);
-                g_services->apiClientRepository()->insertUsageLog(
-                    client->id, client->clientName,
-                    path, req->methodString(),
-                    200, 0,
-                    req->peerAddr().toIp(),
-                    req->getHeader("User-Agent"));
+                recordApiUsage(*client, path, req->methodString(),
+                               req->peerAddr().toIp(), req->getHeader("User-Agent"));
             }
 
             spdlog::debug("[AuthMiddleware] API Key authenticated: {} ({})",
@@ -487,7 +498,7 @@ std::optional<domain::models::ApiClient> AuthMiddleware::validateApiKey(
 
     // Hash the key and look up
     std::string keyHash = auth::hashApiKey(apiKey);
-    auto client = g_services->apiClientRepository()->findByKeyHash(keyHash);
+    auto client = g_services->apiClientRepository()->findByKeyHashCached(keyHash);
 
     if (!client) {
         spdlog::debug("[AuthMiddleware] API key not found");
@@ -709,12 +720,7 @@ void AuthMiddleware::handleInternalAuthCheck(
     }
 
     // Log usage with original endpoint info
-    g_services->apiClientRepository()->updateUsage(client->id);
-    g_services->apiClientRepository()->insertUsageLog(
-        client->id, client->clientName,
-        originalUri, originalMethod,
-        200, 0,
-        clientIp, userAgent);
+    recordApiUsage(*client, originalUri, originalMethod, clientIp, userAgent);
 
     spdlog::debug("[AuthMiddleware] Internal auth check OK: {} → {} ({})",
                   client->clientName, originalUri, clientIp);
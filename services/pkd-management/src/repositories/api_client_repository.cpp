@@ -22,42 +22,96 @@ ApiClientRepository::~ApiClientRepository() {}
 
 std::optional<domain::models::ApiClient> ApiClientRepository::findByKeyHash(const std::string& keyHash) {
     try {
-        std::string dbType = executor_->getDatabaseType();
-        std::string query;
-
-        if (dbType == "oracle") {
-            query =
-                "SELECT id, client_name, api_key_hash, api_key_prefix, description, "
-                "  TO_CHAR(permissions) AS permissions, TO_CHAR(allowed_endpoints) AS allowed_endpoints, "
-                "  TO_CHAR(allowed_ips) AS allowed_ips, "
-                "  rate_limit_per_minute, rate_limit_per_hour, rate_limit_per_day, "
-                "  is_active, expires_at, last_used_at, total_requests, "
-                "  created_by, created_at, updated_at "
-                "FROM api_clients WHERE api_key_hash = $1";
-        } else {
-            query =
-                "SELECT id, client_name, api_key_hash, api_key_prefix, description, "
-                "  permissions, allowed_endpoints, allowed_ips, "
-                "  rate_limit_per_minute, rate_limit_per_hour, rate_limit_per_day, "
-                "  is_active, expires_at, last_used_at, total_requests, "
-                "  created_by, created_at, updated_at "
-                "FROM api_clients WHERE api_key_hash = $1";
-        }
-
-        std::vector<std::string> params = { keyHash };
-        Json::Value result = executor_->executeQuery(query, params);
+        return queryByKeyHash(keyHash);
+    } catch (const std::exception& e) {
+        spdlog::error("[ApiClientRepository] findByKeyHash failed: {}", e.what());
+        return std::nullopt;
+    }
+}
 
-        if (result.isArray() && result.size() > 0) {
-            return jsonToModel(result[0]);
+std::optional<domain::models::ApiClient> ApiClientRepository::findByKeyHashCached(const std::string& keyHash) {
+    uint64_t generation;
+    std::chrono::seconds ttl;
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(keyCacheMutex_);
+        auto it = keyCache_.find(keyHash);
+        if (it != keyCache_.end() && it->second.expiresAt > now) {
+            return it->second.client;
         }
-        return std::nullopt;
+        generation = keyCacheGeneration_;
+        ttl = keyCacheTtl_;
+    }
 
+    std::optional<domain::models::ApiClient> client;
+    try {
+        client = queryByKeyHash(keyHash);
     } catch (const std::exception& e) {
         spdlog::error("[ApiClientRepository] findByKeyHash failed: {}", e.what());
         return std::nullopt;
     }
+    if (ttl.count() <= 0) return client;
+
+    std::lock_guard<std::mutex> lock(keyCacheMutex_);
+    if (generation != keyCacheGeneration_) return client;  // Invalidated while querying
+
+    if (keyCache_.size() >= MAX_KEY_CACHE_SIZE) {
+        for (auto it = keyCache_.begin(); it != keyCache_.end();) {
+            it = (it->second.expiresAt <= now) ? keyCache_.erase(it) : std::next(it);
+        }
+        if (keyCache_.size() >= MAX_KEY_CACHE_SIZE) keyCache_.clear();
+    }
+    auto entryTtl = client ? ttl : std::min(ttl, NEGATIVE_KEY_CACHE_TTL);
+    keyCache_[keyHash] = KeyCacheEntry{client, now + entryTtl};
+    return client;
+}
+
+void ApiClientRepository::setKeyCacheTtl(std::chrono::seconds ttl) {
+    std::lock_guard<std::mutex> lock(keyCacheMutex_);
+    keyCacheTtl_ = ttl;
+    keyCache_.clear();
+    keyCacheGeneration_++;
 }
 
+void ApiClientRepository::invalidateKeyCache() {
+    std::lock_guard<std::mutex> lock(keyCacheMutex_);
+    keyCache_.clear();
+    keyCacheGeneration_++;
+}
+
+std::optional<domain::models::ApiClient> ApiClientRepository::queryByKeyHash(const std::string& keyHash) {
+    std::string dbType = executor_->getDatabaseType();
+    std::string query;
+
+    if (dbType == "oracle") {
+        query =
+            "SELECT id, client_name, api_key_hash, api_key_prefix, description, "
+            "  TO_CHAR(permissions) AS permissions, TO_CHAR(allowed_endpoints) AS allowed_endpoints, "
+            "  TO_CHAR(allowed_ips) AS allowed_ips, "
+            "  rate_limit_per_minute, rate_limit_per_hour, rate_limit_per_day, "
+            "  is_active, expires_at, last_used_at, total_requests, "
+            "  created_by, created_at, updated_at "
+            "FROM api_clients WHERE api_key_hash = $1";
+    } else {
+        query =
+            "SELECT id, client_name, api_key_hash, api_key_prefix, description, "
+            "  permissions, allowed_endpoints, allowed_ips, "
+            "  rate_limit_per_minute, rate_limit_per_hour, rate_limit_per_day, "
+            "  is_active, expires_at, last_used_at, total_requests, "
+            "  created_by, created_at, updated_at "
+            "FROM api_clients WHERE api_key_hash = $1";
+    }
+
+    std::vector<std::string> params = { keyHash };
+    Json::Value result = executor_->executeQuery(query, params);
+
+    if (result.isArray() && result.size() > 0) {
+        return jsonToModel(result[0]);
+    }
+    return std::nullopt;
+}
+
+
 std::optional<domain::models::ApiClient> ApiClientRepository::findById(const std::string& id) {
     try {
         std::string dbType = executor_->getDatabaseType();
@@ -250,6 +304,7 @@ std::string ApiClientRepository::insert(const domain::models::ApiClient& client)
 
         if (dbType == "oracle") {
             executor_->executeCommand(query, params);
+            invalidateKeyCache();  // Key may have been cached as unknown
             // Retrieve the generated ID
             Json::Value idResult = executor_->executeQuery(
                 "SELECT id FROM api_clients WHERE api_key_hash = $1",
@@ -260,6 +315,7 @@ std::string ApiClientRepository::insert(const domain::models::ApiClient& client)
             return "";
         } else {
             Json::Value result = executor_->executeQuery(query, params);
+            invalidateKeyCache();  // Key may have been cached as unknown
             if (result.isArray() && result.size() > 0) {
                 std::string id = result[0].get("id", "").asString();
                 spdlog::info("[ApiClientRepository] Inserted client: {} (prefix: {})",
@@ -319,6 +375,7 @@ bool ApiClientRepository::update(const domain::models::ApiClient& client) {
         };
 
         int rowsAffected = executor_->executeCommand(query, params);
+        invalidateKeyCache();
         if (rowsAffected > 0) {
             spdlog::info("[ApiClientRepository] Updated client: {}", client.id);
             return true;
@@ -344,6 +401,7 @@ bool ApiClientRepository::updateKeyHash(const std::string& id,
 
         std::vector<std::string> params = { keyHash, keyPrefix, id };
         int rowsAffected = executor_->executeCommand(query, params);
+        invalidateKeyCache();
 
         if (rowsAffected > 0) {
             spdlog::info("[ApiClientRepository] Updated key hash for client: {}", id);
@@ -369,6 +427,7 @@ bool ApiClientRepository::deactivate(const std::string& id) {
 
         std::vector<std::string> params = { id };
         int rowsAffected = executor_->executeCommand(query, params);
+        invalidateKeyCache();
 
         if (rowsAffected > 0) {
             spdlog::info("[ApiClientRepository] Deactivated client: {}", id);
@@ -429,6 +488,49 @@ bool ApiClientRepository::insertUsageLog(
     }
 }
 
+void ApiClientRepository::addUsageCounts(const std::unordered_map<std::string, int64_t>& countsByClientId) {
+    if (countsByClientId.empty()) return;
+
+    std::string dbType = executor_->getDatabaseType();
+    std::string tsFunc = (dbType == "oracle") ? "SYSTIMESTAMP" : "NOW()";
+    std::string query =
+        "UPDATE api_clients SET last_used_at = " + tsFunc + ", "
+        "  total_requests = total_requests + $1 WHERE id = $2";
+
+    std::vector<std::vector<std::string>> paramRows;
+    paramRows.reserve(countsByClientId.size());
+    for (const auto& [clientId, count] : countsByClientId) {
+        paramRows.push_back({ std::to_string(count), clientId });
+    }
+    // One call: executeBatch() outside batch mode is a single transaction
+    executor_->executeBatch(query, paramRows);
+}
+
+void ApiClientRepository::insertUsageLogs(const std::vector<ApiUsageLogEntry>& entries) {
+    if (entries.empty()) return;
+
+    // created_at is the request time in UTC (rows are written up to one flush interval later)
+    std::string createdAt = (executor_->getDatabaseType() == "oracle")
+        ? "CAST(FROM_TZ(TO_TIMESTAMP($9, 'YYYY-MM-DD HH24:MI:SS'), 'UTC') AT LOCAL AS TIMESTAMP)"
+        : "($9::timestamp AT TIME ZONE 'UTC')";
+    std::string query =
+        "INSERT INTO api_client_usage_log "
+        "  (client_id, client_name, endpoint, method, status_code, "
+        "   response_time_ms, ip_address, user_agent, created_at) "
+        "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, " + createdAt + ")";
+
+    std::vector<std::vector<std::string>> paramRows;
+    paramRows.reserve(entries.size());
+    for (const auto& e : entries) {
+        paramRows.push_back({
+            e.clientId, e.clientName, e.endpoint, e.method,
+            std::to_string(e.statusCode), std::to_string(e.responseTimeMs),
+            e.ipAddress, e.userAgent, e.createdAt
+        });
+    }
+    executor_->executeBatch(query, paramRows);
+}
+
 Json::Value ApiClientRepository::getUsageStats(const std::string& clientId, int days) {
     try {
         // Bounds check: 1~365 days (prevents unreasonable queries)
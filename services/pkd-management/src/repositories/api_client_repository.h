@@ -7,7 +7,11 @@
  * Uses IQueryExecutor for database-agnostic operation (PostgreSQL + Oracle).
  */
 
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <optional>
 #include <json/json.h>
@@ -16,6 +20,21 @@
 
 namespace repositories {
 
+/**
+ * @brief One buffered api_client_usage_log row (see services::ApiUsageRecorder)
+ */
+struct ApiUsageLogEntry {
+    std::string clientId;
+    std::string clientName;
+    std::string endpoint;
+    std::string method;
+    int statusCode = 200;
+    int responseTimeMs = 0;
+    std::string ipAddress;
+    std::string userAgent;
+    std::string createdAt;  ///< UTC "YYYY-MM-DD HH:MM:SS" (request time, not flush time)
+};
+
 class ApiClientRepository {
 public:
     explicit ApiClientRepository(common::IQueryExecutor* executor);
@@ -24,6 +43,22 @@ public:
     /** Find client by API key hash (for authentication) */
     std::optional<domain::models::ApiClient> findByKeyHash(const std::string& keyHash);
 
+    /**
+     * @brief findByKeyHash() through an in-memory TTL cache (per-request authentication)
+     *
+     * Unknown keys are cached too, for at most 10 seconds. insert(), update(),
+     * updateKeyHash() and deactivate() clear the cache, so edits and revocations
+     * made through this instance apply to the next request; the TTL bounds
+     * staleness for changes made elsewhere. DB errors are not cached.
+     */
+    std::optional<domain::models::ApiClient> findByKeyHashCached(const std::string& keyHash);
+
+    /** Set the key cache TTL (0 disables caching) */
+    void setKeyCacheTtl(std::chrono::seconds ttl);
+
+    /** Drop all cached key lookups */
+    void invalidateKeyCache();
+
     /** Find client by ID */
     std::optional<domain::models::ApiClient> findById(const std::string& id);
 
@@ -56,12 +91,44 @@ public:
                         int statusCode, int responseTimeMs,
                         const std::string& ipAddress, const std::string& userAgent);
 
+    /**
+     * @brief Add buffered request counts (one UPDATE per client, last_used_at = now)
+     *
+     * All or nothing: the UPDATEs go through one executeBatch() call, which
+     * applies no row when it throws, so the caller can safely re-add every count.
+     *
+     * @param countsByClientId Client ID → requests since the last flush
+     * @throws std::runtime_error on failure (no count applied; caller keeps them)
+     */
+    void addUsageCounts(const std::unordered_map<std::string, int64_t>& countsByClientId);
+
+    /**
+     * @brief Insert buffered usage log rows in one batch (IQueryExecutor::executeBatch)
+     * @throws std::runtime_error on failure (caller keeps the rows)
+     */
+    void insertUsageLogs(const std::vector<ApiUsageLogEntry>& entries);
+
     /** Get usage statistics for a client */
     Json::Value getUsageStats(const std::string& clientId, int days = 7);
 
 private:
     common::IQueryExecutor* executor_;
 
+    // Key hash → client lookup cache (nullopt = unknown key)
+    struct KeyCacheEntry {
+        std::optional<domain::models::ApiClient> client;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+    std::unordered_map<std::string, KeyCacheEntry> keyCache_;
+    std::mutex keyCacheMutex_;
+    std::chrono::seconds keyCacheTtl_{60};
+    uint64_t keyCacheGeneration_ = 0;  ///< Bumped by invalidation; stale lookups are not stored
+    static constexpr size_t MAX_KEY_CACHE_SIZE = 10000;
+    static constexpr std::chrono::seconds NEGATIVE_KEY_CACHE_TTL{10};
+
+    /** findByKeyHash() without error handling */
+    std::optional<domain::models::ApiClient> queryByKeyHash(const std::string& keyHash);
+
     domain::models::ApiClient jsonToModel(const Json::Value& row);
     std::vector<std::string> parseJsonArray(const Json::Value& val);
     bool parseBool(const Json::Value& val);
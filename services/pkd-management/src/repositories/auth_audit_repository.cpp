@@ -4,6 +4,7 @@
 
 #include "auth_audit_repository.h"
 #include "query_helpers.h"
+#include <icao/audit/audit_sink.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <sstream>
@@ -57,6 +58,11 @@ bool AuthAuditRepository::insert(
             errorMessage.value_or("")
         };
 
+        // Async sink: queue the row, the login/logout request does not wait for the INSERT
+        if (auto* sink = icao::audit::auditSink()) {
+            return sink->submit(query, std::move(params));
+        }
+
         int rowsAffected = queryExecutor_->executeCommand(query, params);
 
         if (rowsAffected == 0) {
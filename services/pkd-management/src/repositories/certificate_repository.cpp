@@ -8,12 +8,14 @@
 #include <stdexcept>
 #include <sstream>
 #include <algorithm>
+#include <cctype>
 #include <cstring>
 #include <iomanip>
 #include <random>
 #include <openssl/x509.h>
 #include <openssl/err.h>
 #include <unordered_map>
+#include <unordered_set>
 #include "query_helpers.h"
 
 namespace repositories {
@@ -41,6 +43,38 @@ static std::string generateUuid() {
     return ss.str();
 }
 
+/**
+ * @brief Whether a search term can go to Oracle Text CONTAINS as-is
+ *
+ * Only a single alphanumeric word, and not an Oracle Text operator keyword
+ * (AND, NEAR, WITHIN, ...) or a default English stopword: those would be
+ * parsed as query syntax or match nothing, so they take the LIKE path.
+ */
+static bool isOracleTextSearchable(const std::string& term) {
+    if (term.empty() || !std::all_of(term.begin(), term.end(),
+            [](unsigned char c) { return std::isalnum(c); })) {
+        return false;
+    }
+    static const std::unordered_set<std::string> kExcluded = {
+        // Operator keywords
+        "ABOUT", "ACCUM", "AND", "BT", "BTG", "BTI", "BTP", "EQUIV", "FUZZY", "HASPATH",
+        "INPATH", "MDATA", "MINUS", "NDATA", "NEAR", "NOT", "NT", "NTG", "NTI", "NTP",
+        "OR", "PT", "RT", "SDATA", "SQE", "SYN", "TR", "TRSYN", "TT", "WITHIN",
+        // Default English stoplist (CTXSYS.DEFAULT_STOPLIST)
+        "A", "AFTER", "ALL", "ALSO", "AN", "ANY", "ARE", "AS", "AT", "BE", "BECAUSE",
+        "BEEN", "BUT", "BY", "CAN", "CO", "CORP", "COULD", "FOR", "FROM", "HAD", "HAS",
+        "HAVE", "HE", "HER", "HIS", "IF", "IN", "INC", "INTO", "IS", "IT", "ITS", "LAST",
+        "MORE", "MOST", "MR", "MRS", "MS", "MZ", "NO", "OF", "ON", "ONE", "ONLY", "OTHER",
+        "OUT", "OVER", "S", "SAYS", "SHE", "SO", "SOME", "SUCH", "THAN", "THAT", "THE",
+        "THEIR", "THERE", "THEY", "THIS", "TO", "UP", "WAS", "WE", "WERE", "WHAT", "WHEN",
+        "WHICH", "WHO", "WILL", "WITH", "WOULD",
+    };
+    std::string upper = term;
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+        [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return kExcluded.count(upper) == 0;
+}
+
 /**
  * @brief Convert certificate date to Oracle-safe ISO 8601 format (no timezone suffix)
  *
@@ -144,40 +178,81 @@ Json::Value CertificateRepository::search(const CertificateSearchFilter& filter)
         if (filter.searchTerm.has_value() && !filter.searchTerm->empty()) {
             std::string term = "%" + *filter.searchTerm + "%";
             std::string p = "$" + std::to_string(paramIdx);
-            where << " AND (" << common::db::ilikeCond(dbType, "subject_dn", p)
-                   << " OR " << common::db::ilikeCond(dbType, "serial_number", p)
-                   << " OR " << common::db::ilikeCond(dbType, "fingerprint_sha256", p) << ")";
+            // PostgreSQL: ILIKE '%term%' is served by the pg_trgm GIN indexes.
+            // Oracle: CONTEXT indexes (substring wordlist) when enabled, for plain single-word terms.
+            if (dbType == "oracle" && oracleTextSearch_ && isOracleTextSearchable(*filter.searchTerm)) {
+                where << " AND (CONTAINS(subject_dn, " << p << ") > 0"
+                       << " OR CONTAINS(serial_number, " << p << ") > 0"
+                       << " OR CONTAINS(fingerprint_sha256, " << p << ") > 0)";
+            } else {
+                where << " AND (" << common::db::ilikeCond(dbType, "subject_dn", p)
+                       << " OR " << common::db::ilikeCond(dbType, "serial_number", p)
+                       << " OR " << common::db::ilikeCond(dbType, "fingerprint_sha256", p) << ")";
+            }
             paramIdx++;
             params.push_back(term);
         }
 
         std::string whereStr = where.str();
 
-        // Count query
-        std::string countSql = "SELECT COUNT(*) FROM certificate WHERE 1=1" + whereStr;
-        Json::Value countResult = queryExecutor_->executeScalar(countSql, params);
-        int total = common::db::scalarToInt(countResult);
+        // Keyset predicate (data query only; count/stats cover the whole filter)
+        std::string keysetStr;
+        std::vector<std::string> dataParams = params;
+        bool keyset = false;
+        if (filter.cursor.has_value() && !filter.cursor->empty()) {
+            auto decoded = decodeSearchCursor(*filter.cursor);
+            if (!decoded) {
+                Json::Value error;
+                error["success"] = false;
+                error["error"] = "Invalid cursor";
+                return error;
+            }
+            std::string ts = "$" + std::to_string(paramIdx++);
+            std::string id = "$" + std::to_string(paramIdx++);
+            if (dbType == "oracle") {
+                std::string tsExpr = "TO_TIMESTAMP(" + ts + ", 'YYYY-MM-DD\"T\"HH24:MI:SS.FF6')";
+                keysetStr = " AND (created_at < " + tsExpr +
+                            " OR (created_at = " + tsExpr + " AND id < " + id + "))";
+            } else {
+                keysetStr = " AND (created_at, id) < ((" + ts + "::timestamp AT TIME ZONE 'UTC'), " + id + "::uuid)";
+            }
+            dataParams.push_back(decoded->first);
+            dataParams.push_back(decoded->second);
+            keyset = true;
+        }
 
-        // Data query
+        // Data query: one extra row tells whether another page exists
+        std::string cursorTsExpr = (dbType == "oracle")
+            ? "TO_CHAR(created_at, 'YYYY-MM-DD\"T\"HH24:MI:SS.FF6')"
+            : "to_char(created_at AT TIME ZONE 'UTC', 'YYYY-MM-DD\"T\"HH24:MI:SS.US')";
         std::ostringstream dataSql;
         dataSql << "SELECT id, certificate_type, country_code, subject_dn, issuer_dn, "
                 << "serial_number, fingerprint_sha256, not_before, not_after, "
                 << "validation_status, source_type, stored_in_ldap, "
                 << "is_self_signed, version, signature_algorithm, "
-                << "public_key_algorithm, public_key_size "
-                << "FROM certificate WHERE 1=1" << whereStr
-                << " ORDER BY created_at DESC";
+                << "public_key_algorithm, public_key_size, "
+                << cursorTsExpr << " AS cursor_ts "
+                << "FROM certificate WHERE 1=1" << whereStr << keysetStr
+                << " ORDER BY created_at DESC, id DESC";
+
+        dataSql << common::db::paginationClause(dbType, filter.limit + 1, keyset ? 0 : filter.offset);
 
-        dataSql << common::db::paginationClause(dbType, filter.limit, filter.offset);
+        Json::Value rows = queryExecutor_->executeQuery(dataSql.str(), dataParams);
 
-        Json::Value rows = queryExecutor_->executeQuery(dataSql.str(), params);
+        bool hasMore = rows.isArray() && rows.size() > static_cast<Json::ArrayIndex>(filter.limit);
+        if (hasMore) rows.resize(static_cast<Json::ArrayIndex>(filter.limit));
 
         // Build response
         Json::Value response;
         response["success"] = true;
-        response["total"] = total;
         response["limit"] = filter.limit;
         response["offset"] = filter.offset;
+        response["hasMore"] = hasMore;
+        if (hasMore && rows.size() > 0) {
+            const auto& last = rows[rows.size() - 1];
+            response["nextCursor"] = encodeSearchCursor(last.get("cursor_ts", "").asString(),
+                                                        last.get("id", "").asString());
+        }
 
         Json::Value certificates(Json::arrayValue);
         for (const auto& row : rows) {
@@ -286,31 +361,67 @@ Json::Value CertificateRepository::search(const CertificateSearchFilter& filter)
         }
         response["certificates"] = certificates;
 
-        // Validity statistics based on certificate dates (not validation_status)
-        std::string now = (dbType == "oracle") ? "SYSTIMESTAMP" : "NOW()";
-        std::string statsSql =
-            "SELECT "
-            "SUM(CASE WHEN not_before <= " + now + " AND not_after >= " + now + " THEN 1 ELSE 0 END) as valid_cnt, "
-            "SUM(CASE WHEN not_after < " + now + " THEN 1 ELSE 0 END) as expired_cnt, "
-            "SUM(CASE WHEN not_before > " + now + " THEN 1 ELSE 0 END) as not_yet_valid_cnt "
-            "FROM certificate WHERE 1=1" + whereStr;
-        Json::Value statsRow = queryExecutor_->executeQuery(statsSql, params);
-
-        int valid = 0, expired = 0, notYetValid = 0;
-        if (statsRow.isArray() && statsRow.size() > 0) {
-            valid = common::db::getInt(statsRow[0], "valid_cnt");
-            expired = common::db::getInt(statsRow[0], "expired_cnt");
-            notYetValid = common::db::getInt(statsRow[0], "not_yet_valid_cnt");
+        if (!filter.includeTotal) {
+            spdlog::info("[CertificateRepository] DB search returned {} results (total skipped)", rows.size());
+            return response;
+        }
+
+        // Total + validity statistics (certificate dates, not validation_status), cached per filter
+        std::string signature = dbType;
+        for (const auto* field : {&filter.countryCode, &filter.certificateType, &filter.sourceType,
+                                  &filter.validityStatus, &filter.searchTerm}) {
+            signature += '\x1f';
+            signature += field->value_or("");
+        }
+
+        std::optional<SearchSummary> summary;
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(searchSummaryMutex_);
+            auto it = searchSummaryCache_.find(signature);
+            if (it != searchSummaryCache_.end() && it->second.expiresAt > std::chrono::steady_clock::now()) {
+                summary = it->second;
+            }
+            generation = searchSummaryGeneration_;
+        }
+
+        if (!summary) {
+            std::string now = (dbType == "oracle") ? "SYSTIMESTAMP" : "NOW()";
+            std::string statsSql =
+                "SELECT COUNT(*) as total_cnt, "
+                "SUM(CASE WHEN not_before <= " + now + " AND not_after >= " + now + " THEN 1 ELSE 0 END) as valid_cnt, "
+                "SUM(CASE WHEN not_after < " + now + " THEN 1 ELSE 0 END) as expired_cnt, "
+                "SUM(CASE WHEN not_before > " + now + " THEN 1 ELSE 0 END) as not_yet_valid_cnt "
+                "FROM certificate WHERE 1=1" + whereStr;
+            Json::Value statsRow = queryExecutor_->executeQuery(statsSql, params);
+
+            SearchSummary fresh;
+            if (statsRow.isArray() && statsRow.size() > 0) {
+                fresh.total = common::db::getInt(statsRow[0], "total_cnt");
+                fresh.valid = common::db::getInt(statsRow[0], "valid_cnt");
+                fresh.expired = common::db::getInt(statsRow[0], "expired_cnt");
+                fresh.notYetValid = common::db::getInt(statsRow[0], "not_yet_valid_cnt");
+            }
+
+            std::lock_guard<std::mutex> lock(searchSummaryMutex_);
+            if (searchSummaryTtl_.count() > 0 && generation == searchSummaryGeneration_) {
+                if (searchSummaryCache_.size() >= MAX_SEARCH_SUMMARY_ENTRIES) searchSummaryCache_.clear();
+                fresh.expiresAt = std::chrono::steady_clock::now() + searchSummaryTtl_;
+                searchSummaryCache_[signature] = fresh;
+            }
+            summary = fresh;
         }
 
-        int unknown = total - valid - expired - notYetValid;
+        int total = summary->total;
+        int unknown = total - summary->valid - summary->expired - summary->notYetValid;
         if (unknown < 0) unknown = 0;
 
+        response["total"] = total;
         Json::Value stats;
         stats["total"] = total;
-        stats["valid"] = valid;
-        stats["expired"] = expired;
-        stats["notYetValid"] = notYetValid;
+        stats["valid"] = summary->valid;
+        stats["expired"] = summary->expired;
+        stats["notYetValid"] = summary->notYetValid;
         stats["unknown"] = unknown;
         response["stats"] = stats;
 
@@ -327,6 +438,51 @@ Json::Value CertificateRepository::search(const CertificateSearchFilter& filter)
     }
 }
 
+void CertificateRepository::invalidateSearchSummaryCache()
+{
+    std::lock_guard<std::mutex> lock(searchSummaryMutex_);
+    searchSummaryCache_.clear();
+    searchSummaryGeneration_++;
+}
+
+void CertificateRepository::setSearchSummaryCacheTtl(std::chrono::seconds ttl)
+{
+    std::lock_guard<std::mutex> lock(searchSummaryMutex_);
+    searchSummaryTtl_ = ttl;
+    searchSummaryCache_.clear();
+    searchSummaryGeneration_++;
+}
+
+void CertificateRepository::setOracleTextSearch(bool enabled)
+{
+    oracleTextSearch_ = enabled;
+}
+
+std::string CertificateRepository::encodeSearchCursor(const std::string& createdAt, const std::string& id)
+{
+    return createdAt + "~" + id;
+}
+
+std::optional<std::pair<std::string, std::string>>
+CertificateRepository::decodeSearchCursor(const std::string& cursor)
+{
+    // "YYYY-MM-DDTHH:MI:SS.ffffff~<id>"
+    static constexpr std::string_view pattern = "dddd-dd-ddTdd:dd:dd.dddddd";
+    auto sep = cursor.find('~');
+    if (sep != pattern.size()) return std::nullopt;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        bool ok = (pattern[i] == 'd') ? std::isdigit(static_cast<unsigned char>(cursor[i]))
+                                      : cursor[i] == pattern[i];
+        if (!ok) return std::nullopt;
+    }
+    std::string id = cursor.substr(sep + 1);
+    if (id.empty() || id.size() > 64) return std::nullopt;
+    for (unsigned char c : id) {
+        if (!std::isalnum(c) && c != '-') return std::nullopt;
+    }
+    return std::make_pair(cursor.substr(0, sep), id);
+}
+
 Json::Value CertificateRepository::findByFingerprint(const std::string& fingerprint)
 {
     spdlog::debug("[CertificateRepository] Finding by fingerprint: {}...",
@@ -587,45 +743,27 @@ std::vector<std::pair<std::string, std::vector<uint8_t>>> CertificateRepository:
     std::vector<std::pair<std::string, std::vector<uint8_t>>> result;
 
     try {
+        // Binary row cursor: DER bytes arrive as stored (no JSON rows, no hex round-trip)
         std::string query = "SELECT subject_dn, certificate_data FROM certificate "
                            "WHERE certificate_type = 'CSCA'";
 
-        Json::Value rows = queryExecutor_->executeQuery(query, {});
-
-        // Helper: decode hex string (with \x prefix) to bytes
-        auto decodeHex = [](const std::string& hex, size_t start) -> std::vector<uint8_t> {
-            std::vector<uint8_t> bytes;
-            bytes.reserve((hex.size() - start) / 2);
-            for (size_t i = start; i + 1 < hex.size(); i += 2) {
-                char h[3] = {hex[i], hex[i + 1], 0};
-                bytes.push_back(static_cast<uint8_t>(strtol(h, nullptr, 16)));
-            }
-            return bytes;
-        };
-
-        for (Json::ArrayIndex i = 0; i < rows.size(); i++) {
-            std::string subjectDn = rows[i].get("subject_dn", "").asString();
-            std::string certDataHex = rows[i].get("certificate_data", "").asString();
+        queryExecutor_->executeQueryRows(query, {}, [&](common::RowCursor& rows) {
+            int dnCol = rows.columnIndex("subject_dn");
+            int dataCol = rows.columnIndex("certificate_data");
 
-            if (subjectDn.empty() || certDataHex.empty()) continue;
+            while (rows.next()) {
+                std::string_view subjectDn = rows.getStringView(dnCol);
+                common::ByteSpan der = rows.getBytes(dataCol);
+                if (subjectDn.empty() || der.empty()) continue;
 
-            // Parse hex to DER bytes (same logic as parseCertificateDataFromHex)
-            std::vector<uint8_t> derBytes;
-            if (certDataHex.size() > 2 && certDataHex[0] == '\\' && certDataHex[1] == 'x') {
-                derBytes = decodeHex(certDataHex, 2);
                 // Handle double-encoded BYTEA
-                if (derBytes.size() > 2 && derBytes[0] == 0x5C && derBytes[1] == 0x78) {
-                    std::string innerHex(derBytes.begin(), derBytes.end());
-                    derBytes = decodeHex(innerHex, 2);
+                std::vector<uint8_t> derBytes = common::unwrapDoubleEncodedBytea(der);
+                if (derBytes.empty()) {
+                    derBytes.assign(der.begin(), der.end());
                 }
-            } else if (!certDataHex.empty() && static_cast<unsigned char>(certDataHex[0]) == 0x30) {
-                derBytes.assign(certDataHex.begin(), certDataHex.end());
+                result.emplace_back(std::string(subjectDn), std::move(derBytes));
             }
-
-            if (!derBytes.empty()) {
-                result.emplace_back(subjectDn, std::move(derBytes));
-            }
-        }
+        });
 
         spdlog::info("[CertificateRepository] Loaded {} CSCA certificates", result.size());
         return result;
@@ -1648,17 +1786,52 @@ Json::Value CertificateRepository::findLinkCertificateById(const std::string& id
 
 // --- Bulk Export (All LDAP-stored certificates) ---
 
-Json::Value CertificateRepository::findAllForExport() {
+size_t CertificateRepository::findAllForExport(const std::function<void(const CertificateExportRow&)>& onRow,
+                                               const std::string& countryCode) {
     std::string dbType = queryExecutor_->getDatabaseType();
     std::string storedFlag = common::db::boolLiteral(dbType, true);
 
     std::string query =
         "SELECT certificate_type, country_code, subject_dn, serial_number, "
         "fingerprint_sha256, certificate_data, is_self_signed "
-        "FROM certificate WHERE stored_in_ldap = " + storedFlag + " "
-        "ORDER BY country_code, certificate_type";
+        "FROM certificate WHERE stored_in_ldap = " + storedFlag + " ";
+    std::vector<std::string> params;
+    if (!countryCode.empty()) {
+        query += "AND country_code = $1 ";
+        params.push_back(countryCode);
+    }
+    query += "ORDER BY country_code, certificate_type";
+
+    size_t count = 0;
+    queryExecutor_->executeQueryStream(query, params, [&](common::RowCursor& rows) {
+        int typeCol = rows.columnIndex("certificate_type");
+        int countryCol = rows.columnIndex("country_code");
+        int subjectCol = rows.columnIndex("subject_dn");
+        int serialCol = rows.columnIndex("serial_number");
+        int fingerprintCol = rows.columnIndex("fingerprint_sha256");
+        int dataCol = rows.columnIndex("certificate_data");
+        int selfSignedCol = rows.columnIndex("is_self_signed");
+
+        while (rows.next()) {
+            CertificateExportRow row;
+            row.certificateType = rows.getStringView(typeCol);
+            row.countryCode = rows.getStringView(countryCol);
+            row.subjectDn = rows.getStringView(subjectCol);
+            row.serialNumber = rows.getStringView(serialCol);
+            row.fingerprint = rows.getStringView(fingerprintCol);
+            row.isSelfSigned = rows.getBool(selfSignedCol, true);
+
+            row.certificateDer = rows.getBytes(dataCol);
+            std::vector<uint8_t> unwrapped = common::unwrapDoubleEncodedBytea(row.certificateDer);
+            if (!unwrapped.empty()) {
+                row.certificateDer = common::ByteSpan{unwrapped.data(), unwrapped.size()};
+            }
 
-    return queryExecutor_->executeQuery(query);
+            onRow(row);
+            count++;
+        }
+    });
+    return count;
 }
 
 // --- Fingerprint Pre-Cache (v2.26.0) ---
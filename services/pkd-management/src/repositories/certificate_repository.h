@@ -1,10 +1,14 @@
 #pragma once
 
+#include <chrono>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <set>
 #include <optional>
 #include <unordered_map>
+#include <functional>
+#include <string_view>
 #include <json/json.h>
 #include "i_query_executor.h"
 #include <openssl/x509.h>
@@ -31,6 +35,21 @@ struct CachedFingerprintInfo {
     std::string firstUploadId;
 };
 
+/**
+ * @brief Certificate row streamed by CertificateRepository::findAllForExport()
+ *
+ * Views point into the query result and are only valid inside the callback.
+ */
+struct CertificateExportRow {
+    std::string_view certificateType;
+    std::string_view countryCode;
+    std::string_view subjectDn;
+    std::string_view serialNumber;
+    std::string_view fingerprint;
+    common::ByteSpan certificateDer;  ///< Raw DER (double-encoded bytea already unwrapped)
+    bool isSelfSigned = true;
+};
+
 /**
  * @brief Certificate Search Filter
  */
@@ -43,6 +62,8 @@ struct CertificateSearchFilter {
     std::optional<std::string> sourceType;        // "PA_EXTRACTED", "ML_PARSED", etc.
     std::optional<std::string> validityStatus;    // "VALID", "EXPIRED", "NOT_YET_VALID"
     std::optional<std::string> searchTerm;        // Search in subject_dn, serial_number, fingerprint_sha256
+    std::optional<std::string> cursor;            // Keyset cursor (nextCursor of the previous page); offset is ignored
+    bool includeTotal = true;                     // false: skip total/stats (already known to the caller)
     int limit = 100;
     int offset = 0;
 };
@@ -68,11 +89,46 @@ public:
 
     /**
      * @brief Search certificates with filters
+     *
+     * Rows are ordered by (created_at DESC, id DESC). Every page carries a
+     * nextCursor; passing it back as filter.cursor fetches the next page with
+     * a keyset predicate instead of OFFSET, so deep pages cost the same as the
+     * first one. total/stats come from a per-filter cache (see
+     * invalidateSearchSummaryCache()) and are omitted when includeTotal is false.
+     *
      * @param filter Search filter
-     * @return JSON array of certificates
+     * @return JSON object {success, total, limit, offset, certificates, stats, nextCursor, hasMore}
      */
     Json::Value search(const CertificateSearchFilter& filter);
 
+    /**
+     * @brief Drop cached search totals/stats
+     *
+     * Called when an upload completes or a certificate is registered; the TTL
+     * bounds staleness for changes made by other processes (e.g. relay sync).
+     */
+    void invalidateSearchSummaryCache();
+
+    /** Set the search total/stats cache TTL (0 disables caching) */
+    void setSearchSummaryCacheTtl(std::chrono::seconds ttl);
+
+    /**
+     * @brief Use Oracle Text CONTAINS for searchTerm on Oracle
+     *
+     * Requires the CONTEXT indexes from docker/db/oracle-migrations/add_certificate_search_indexes.sql.
+     * Only single-word alphanumeric terms take this path; anything else keeps UPPER() LIKE.
+     */
+    void setOracleTextSearch(bool enabled);
+
+    /** @brief Encode a keyset cursor from a row's created_at (canonical text) and id */
+    static std::string encodeSearchCursor(const std::string& createdAt, const std::string& id);
+
+    /**
+     * @brief Decode a keyset cursor
+     * @return {createdAt, id}, or nullopt if the cursor is malformed
+     */
+    static std::optional<std::pair<std::string, std::string>> decodeSearchCursor(const std::string& cursor);
+
     /**
      * @brief Find certificate by fingerprint (SHA-256)
      * @param fingerprint 64-character hex string
@@ -357,15 +413,19 @@ public:
     Json::Value getDistinctCountries();
 
     /**
-     * @brief Find all certificates stored in LDAP for bulk export
+     * @brief Stream all certificates stored in LDAP for bulk export
      *
-     * Returns certificate_type, country_code, subject_dn, serial_number,
-     * fingerprint_sha256, and certificate_data (hex-encoded) for all
-     * certificates with stored_in_ldap = TRUE.
+     * Rows are read through a streaming binary row cursor (server-side cursor
+     * on PostgreSQL) and handed to onRow one at a time, so neither the full
+     * certificate set nor the full query result is held in memory.
      *
-     * @return JSON array of certificate rows
+     * @param onRow Called for each certificate with stored_in_ldap = TRUE
+     * @param countryCode Restrict to one country (empty = all countries)
+     * @return Number of rows visited
+     * @throws std::runtime_error on query failure
      */
-    Json::Value findAllForExport();
+    size_t findAllForExport(const std::function<void(const CertificateExportRow&)>& onRow,
+                            const std::string& countryCode = "");
 
     /// @}
 
@@ -448,6 +508,22 @@ private:
     std::unordered_map<std::string, CachedFingerprintInfo> fingerprintCache_;
     bool fingerprintCacheLoaded_ = false;
 
+    // Search total/stats cache: filter signature → counts
+    struct SearchSummary {
+        int total = 0;
+        int valid = 0;
+        int expired = 0;
+        int notYetValid = 0;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+    std::unordered_map<std::string, SearchSummary> searchSummaryCache_;
+    std::mutex searchSummaryMutex_;
+    std::chrono::seconds searchSummaryTtl_{300};
+    uint64_t searchSummaryGeneration_ = 0;  ///< Bumped by invalidation; stale counts are not stored
+    bool oracleTextSearch_ = false;
+
+    static constexpr size_t MAX_SEARCH_SUMMARY_ENTRIES = 1000;
+
     // DN normalization helpers (for CSCA lookup)
     std::string extractDnAttribute(const std::string& dn, const std::string& attr);
     std::string normalizeDnForComparison(const std::string& dn);
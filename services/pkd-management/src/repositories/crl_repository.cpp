@@ -244,22 +244,46 @@ Json::Value CrlRepository::findByCountryCode(const std::string& countryCode) {
 
 // --- Bulk Export (All LDAP-stored CRLs) ---
 
-Json::Value CrlRepository::findAllForExport() {
+size_t CrlRepository::findAllForExport(const std::function<void(const CrlExportRow&)>& onRow,
+                                       const std::string& countryCode) {
     std::string dbType = queryExecutor_->getDatabaseType();
     std::string storedFlag = common::db::boolLiteral(dbType, true);
 
-    // Oracle: DBMS_LOB.SUBSTR + RAWTOHEX bypasses LOB locator (truncated BLOB reads)
-    // Oracle: TO_CHAR(issuer_dn) converts CLOB to VARCHAR2 (avoids LOB/non-LOB mixing in OCI fetch)
-    std::string crlBinExpr = (dbType == "oracle")
-        ? "RAWTOHEX(DBMS_LOB.SUBSTR(crl_binary, DBMS_LOB.GETLENGTH(crl_binary), 1)) as crl_binary"
-        : "crl_binary";
-    std::string issuerDnExpr = (dbType == "oracle") ? "TO_CHAR(issuer_dn) as issuer_dn" : "issuer_dn";
+    // crl_binary/issuer_dn are read as BLOB/CLOB by the row cursor on Oracle (no RAWTOHEX/TO_CHAR)
     std::string query =
-        "SELECT country_code, " + issuerDnExpr + ", " + crlBinExpr + ", fingerprint_sha256 "
-        "FROM crl WHERE stored_in_ldap = " + storedFlag + " "
-        "ORDER BY country_code";
+        "SELECT country_code, issuer_dn, crl_binary, fingerprint_sha256 "
+        "FROM crl WHERE stored_in_ldap = " + storedFlag + " ";
+    std::vector<std::string> params;
+    if (!countryCode.empty()) {
+        query += "AND country_code = $1 ";
+        params.push_back(countryCode);
+    }
+    query += "ORDER BY country_code";
+
+    size_t count = 0;
+    queryExecutor_->executeQueryStream(query, params, [&](common::RowCursor& rows) {
+        int countryCol = rows.columnIndex("country_code");
+        int issuerCol = rows.columnIndex("issuer_dn");
+        int dataCol = rows.columnIndex("crl_binary");
+        int fingerprintCol = rows.columnIndex("fingerprint_sha256");
+
+        while (rows.next()) {
+            CrlExportRow row;
+            row.countryCode = rows.getStringView(countryCol);
+            row.issuerDn = rows.getStringView(issuerCol);
+            row.fingerprint = rows.getStringView(fingerprintCol);
+
+            row.crlDer = rows.getBytes(dataCol);
+            std::vector<uint8_t> unwrapped = common::unwrapDoubleEncodedBytea(row.crlDer);
+            if (!unwrapped.empty()) {
+                row.crlDer = common::ByteSpan{unwrapped.data(), unwrapped.size()};
+            }
 
-    return queryExecutor_->executeQuery(query);
+            onRow(row);
+            count++;
+        }
+    });
+    return count;
 }
 
 
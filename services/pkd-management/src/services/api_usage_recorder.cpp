@@ -0,0 +1,145 @@
+/**
+ * @file api_usage_recorder.cpp
+ * @brief ApiUsageRecorder implementation
+ */
+
+#include "api_usage_recorder.h"
+#include <spdlog/spdlog.h>
+#include <ctime>
+#include <stdexcept>
+
+namespace services {
+
+namespace {
+
+std::string utcNow() {
+    std::time_t now = std::time(nullptr);
+    std::tm tmBuf{};
+    gmtime_r(&now, &tmBuf);
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tmBuf);
+    return buf;
+}
+
+} // anonymous namespace
+
+ApiUsageRecorder::ApiUsageRecorder(repositories::ApiClientRepository* repository, Config config)
+    : repository_(repository)
+    , config_(config)
+{
+    if (!repository_) {
+        throw std::invalid_argument("ApiUsageRecorder: repository cannot be nullptr");
+    }
+    if (config_.flushInterval.count() <= 0) config_.flushInterval = std::chrono::seconds(5);
+    if (config_.flushBatch == 0) config_.flushBatch = 1;
+    if (config_.maxPending < config_.flushBatch) config_.maxPending = config_.flushBatch;
+}
+
+ApiUsageRecorder::~ApiUsageRecorder() {
+    stop();
+}
+
+void ApiUsageRecorder::record(const std::string& clientId, const std::string& clientName,
+                              const std::string& endpoint, const std::string& method,
+                              int statusCode, int responseTimeMs,
+                              const std::string& ipAddress, const std::string& userAgent) {
+    repositories::ApiUsageLogEntry entry{
+        clientId, clientName, endpoint, method, statusCode, responseTimeMs,
+        ipAddress, userAgent, utcNow()
+    };
+
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.recorded++;
+        counts_[clientId]++;
+        if (logs_.size() < config_.maxPending) {
+            logs_.push_back(std::move(entry));
+        } else {
+            stats_.droppedRows++;
+        }
+        wake = logs_.size() == config_.flushBatch;
+    }
+    if (wake) wakeCv_.notify_one();
+}
+
+bool ApiUsageRecorder::flush() {
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+
+    std::unordered_map<std::string, int64_t> counts;
+    std::vector<repositories::ApiUsageLogEntry> logs;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        counts.swap(counts_);
+        logs.swap(logs_);
+    }
+    if (counts.empty() && logs.empty()) return true;
+
+    try {
+        // Counts are applied atomically: either all were written (cleared, never
+        // re-added) or none were (all re-added below)
+        repository_->addUsageCounts(counts);
+        counts.clear();
+        repository_->insertUsageLogs(logs);
+    } catch (const std::exception& e) {
+        // Put back what was not written; newer rows recorded meanwhile go after the older ones
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.flushFailures++;
+        for (const auto& [clientId, count] : counts) counts_[clientId] += count;
+
+        size_t room = config_.maxPending > logs_.size() ? config_.maxPending - logs_.size() : 0;
+        size_t keep = std::min(room, logs.size());
+        stats_.droppedRows += logs.size() - keep;
+        logs.erase(logs.begin(), logs.end() - static_cast<std::ptrdiff_t>(keep));
+        logs.insert(logs.end(), std::make_move_iterator(logs_.begin()), std::make_move_iterator(logs_.end()));
+        logs_.swap(logs);
+
+        spdlog::warn("[ApiUsageRecorder] Flush failed, {} rows kept for retry: {}", logs_.size(), e.what());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.flushedRows += logs.size();
+    spdlog::debug("[ApiUsageRecorder] Flushed {} usage rows", logs.size());
+    return true;
+}
+
+void ApiUsageRecorder::start() {
+    if (running_.exchange(true)) return;
+    thread_ = std::thread([this]() { run(); });
+    spdlog::info("[ApiUsageRecorder] Started (flush every {}s or {} rows, max {} pending)",
+                 config_.flushInterval.count(), config_.flushBatch, config_.maxPending);
+}
+
+void ApiUsageRecorder::stop() {
+    if (running_.exchange(false)) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);  // Pairs with the wait predicate
+        }
+        wakeCv_.notify_all();
+        if (thread_.joinable()) thread_.join();
+    }
+    flush();
+}
+
+ApiUsageRecorder::Stats ApiUsageRecorder::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats result = stats_;
+    result.pendingRows = logs_.size();
+    return result;
+}
+
+void ApiUsageRecorder::run() {
+    while (running_) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeCv_.wait_for(lock, config_.flushInterval, [this]() {
+                return !running_ || logs_.size() >= config_.flushBatch;
+            });
+        }
+        if (!running_) break;
+        flush();
+    }
+}
+
+} // namespace services
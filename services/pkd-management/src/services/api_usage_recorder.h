@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../repositories/api_client_repository.h"
+
+/**
+ * @file api_usage_recorder.h
+ * @brief Write-behind buffer for API client usage (total_requests + usage log)
+ *
+ * Every X-API-Key request used to run an UPDATE of api_clients.total_requests
+ * and an INSERT into api_client_usage_log before the request was handled.
+ * ApiUsageRecorder keeps both in memory and a background thread flushes them
+ * every flushInterval, or as soon as flushBatch log rows are pending:
+ * one UPDATE per active client and one batched INSERT for the log rows.
+ *
+ * Loss bound: a crash loses at most one flush interval (or flushBatch rows)
+ * of usage data; stop() flushes what is left on a clean shutdown. If the DB
+ * is unavailable, counts are kept and retried, and log rows are kept up to
+ * maxPending (the oldest rows beyond that are dropped and counted).
+ *
+ * @date 2026-10-16
+ */
+
+namespace services {
+
+class ApiUsageRecorder {
+public:
+    struct Config {
+        std::chrono::seconds flushInterval{5};
+        size_t flushBatch = 500;     ///< Pending log rows that trigger an early flush
+        size_t maxPending = 10000;   ///< Log rows kept while the DB is unavailable
+    };
+
+    struct Stats {
+        uint64_t recorded = 0;
+        uint64_t flushedRows = 0;
+        uint64_t droppedRows = 0;
+        uint64_t flushFailures = 0;
+        size_t pendingRows = 0;
+    };
+
+    /**
+     * @param repository API client repository (non-owning)
+     * @throws std::invalid_argument if repository is nullptr
+     */
+    ApiUsageRecorder(repositories::ApiClientRepository* repository, Config config);
+    ~ApiUsageRecorder();
+
+    ApiUsageRecorder(const ApiUsageRecorder&) = delete;
+    ApiUsageRecorder& operator=(const ApiUsageRecorder&) = delete;
+
+    /** @brief Buffer one request (never touches the DB) */
+    void record(const std::string& clientId, const std::string& clientName,
+                const std::string& endpoint, const std::string& method,
+                int statusCode, int responseTimeMs,
+                const std::string& ipAddress, const std::string& userAgent);
+
+    /**
+     * @brief Write pending counts and log rows now
+     * @return false if the DB write failed (data stays buffered)
+     */
+    bool flush();
+
+    /** @brief Start the flush thread */
+    void start();
+
+    /** @brief Stop the flush thread and flush what is left */
+    void stop();
+
+    Stats stats() const;
+
+private:
+    void run();
+
+    repositories::ApiClientRepository* repository_;
+    Config config_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, int64_t> counts_;
+    std::vector<repositories::ApiUsageLogEntry> logs_;
+    Stats stats_;
+
+    std::mutex flushMutex_;  ///< Serializes flushes (timer, batch trigger, stop)
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+    std::condition_variable wakeCv_;
+};
+
+} // namespace services
@@ -9,28 +9,14 @@
 #include <openssl/pem.h>
 #include <openssl/x509.h>
 #include <ldap.h>
-#include <zip.h>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
-#include <unistd.h>
+#include <memory>
+#include <optional>
 
 namespace services {
 
-/**
- * @brief RAII guard for temporary files
- *
- * Ensures temporary files are cleaned up from /tmp even when exceptions
- * are thrown during ZIP creation or file operations.
- */
-struct TempFileGuard {
-    std::string path;
-    bool released = false;
-    explicit TempFileGuard(const std::string& p) : path(p) {}
-    ~TempFileGuard() { if (!released) unlink(path.c_str()); }
-    void release() { released = true; }
-};
-
 // --- Constructor ---
 
 CertificateService::CertificateService(
@@ -111,46 +97,6 @@ ExportResult CertificateService::exportCertificateFile(
     return result;
 }
 
-ExportResult CertificateService::exportCountryCertificates(
-    const std::string& country,
-    ExportFormat format
-) {
-    spdlog::info("Exporting country certificates - Country: {}, Format: {}",
-                 country, format == ExportFormat::PEM ? "PEM" : "DER");
-
-    ExportResult result;
-    result.success = false;
-
-    try {
-        // Get all DNs for the country
-        std::vector<std::string> dns = repository_->getDnsByCountryAndType(
-            country,
-            std::nullopt  // All types
-        );
-
-        if (dns.empty()) {
-            result.errorMessage = "No certificates found for country: " + country;
-            spdlog::warn(result.errorMessage);
-            return result;
-        }
-
-        spdlog::info("Found {} certificates for country {}", dns.size(), country);
-
-        // Create ZIP archive
-        result.data = createZipArchive(dns, format);
-        result.filename = country + "_certificates.zip";
-        result.contentType = getContentType(format, true);
-        result.success = true;
-
-        spdlog::info("Country export completed - ZIP size: {} bytes", result.data.size());
-    } catch (const std::exception& e) {
-        result.errorMessage = e.what();
-        spdlog::error("Failed to export country certificates: {}", e.what());
-    }
-
-    return result;
-}
-
 // --- Private Helper Methods ---
 
 std::vector<uint8_t> CertificateService::convertDerToPem(
@@ -238,116 +184,6 @@ std::string CertificateService::generateFilenameFromDn(
     }
 }
 
-std::vector<uint8_t> CertificateService::createZipArchive(
-    const std::vector<std::string>& dns,
-    ExportFormat format
-) {
-    // Use temporary file for ZIP creation (more reliable than buffer source)
-    char tmpFilename[] = "/tmp/icao-export-XXXXXX";
-    int tmpFd = mkstemp(tmpFilename);
-    if (tmpFd == -1) {
-        throw std::runtime_error("Failed to create temporary file");
-    }
-    close(tmpFd);  // libzip will reopen it
-    TempFileGuard tmpGuard(tmpFilename);
-
-    // Create ZIP archive in temporary file
-    int error = 0;
-    zip_t* archive = zip_open(tmpFilename, ZIP_CREATE | ZIP_TRUNCATE, &error);
-    if (!archive) {
-        throw std::runtime_error("Failed to create ZIP archive: " + std::to_string(error));
-    }
-
-    // Add each certificate to ZIP
-    int addedCount = 0;
-    for (const auto& dn : dns) {
-        try {
-            std::vector<uint8_t> certData = repository_->getCertificateBinary(dn);
-
-            // Convert to PEM if requested
-            if (format == ExportFormat::PEM) {
-                domain::models::Certificate cert = repository_->getByDn(dn);
-                certData = convertDerToPem(certData, cert.getCertType());
-            }
-
-            // Generate filename
-            std::string filename = generateFilenameFromDn(dn, format);
-
-            // Copy data to heap (ZIP will own and free it)
-            void* bufferCopy = malloc(certData.size());
-            if (!bufferCopy) {
-                spdlog::warn("Failed to allocate memory for: {}", filename);
-                continue;
-            }
-            memcpy(bufferCopy, certData.data(), certData.size());
-
-            // Add to ZIP with ownership transfer
-            zip_source_t* fileSrc = zip_source_buffer(
-                archive,
-                bufferCopy,
-                certData.size(),
-                1  // Free buffer when done
-            );
-
-            if (fileSrc) {
-                zip_int64_t index = zip_file_add(
-                    archive,
-                    filename.c_str(),
-                    fileSrc,
-                    ZIP_FL_OVERWRITE | ZIP_FL_ENC_UTF_8
-                );
-
-                if (index >= 0) {
-                    addedCount++;
-                } else {
-                    zip_source_free(fileSrc);
-                    spdlog::warn("Failed to add file to ZIP: {}", filename);
-                }
-            } else {
-                free(bufferCopy);  // Free if source creation failed
-            }
-        } catch (const std::exception& e) {
-            spdlog::warn("Skipping certificate due to error: {} - {}", dn, e.what());
-        }
-    }
-
-    if (addedCount == 0) {
-        zip_discard(archive);
-        throw std::runtime_error("No certificates added to ZIP archive");
-    }
-
-    // Close archive to finalize ZIP data
-    if (zip_close(archive) != 0) {
-        zip_discard(archive);
-        throw std::runtime_error("Failed to close ZIP archive");
-    }
-
-    // Read ZIP file into memory
-    FILE* f = fopen(tmpFilename, "rb");
-    if (!f) {
-        throw std::runtime_error("Failed to open temporary ZIP file");
-    }
-
-    // Get file size
-    fseek(f, 0, SEEK_END);
-    long fileSize = ftell(f);
-    fseek(f, 0, SEEK_SET);
-
-    // Read entire file
-    std::vector<uint8_t> zipData(fileSize);
-    size_t bytesRead = fread(zipData.data(), 1, fileSize, f);
-    fclose(f);
-
-    // Temp file auto-cleaned by TempFileGuard destructor
-
-    if (bytesRead != static_cast<size_t>(fileSize)) {
-        throw std::runtime_error("Failed to read complete ZIP data");
-    }
-
-    spdlog::info("ZIP archive created - {} certificates added, {} bytes", addedCount, zipData.size());
-    return zipData;
-}
-
 std::string CertificateService::getContentType(ExportFormat format, bool isZip) {
     if (isZip) {
         return "application/zip";
@@ -385,7 +221,8 @@ std::string CertificateService::getFileExtension(
     }
 }
 
-// --- Free Function: Export All LDAP-Stored Data as DIT ZIP ---
+
+// --- Free Functions: Streamed ZIP Exports (DB cursor → ZipStreamWriter) ---
 
 namespace {
 
@@ -405,6 +242,18 @@ std::string sanitizeForFilename(const std::string& input) {
     return result;
 }
 
+// Validate country code (ISO 3166-1 alpha-2/3, defense-in-depth against path traversal)
+std::string sanitizeCountry(std::string_view country) {
+    std::string safeCountry;
+    for (char c : country) {
+        if (std::isalpha(static_cast<unsigned char>(c))) {
+            safeCountry += c;
+        }
+    }
+    if (safeCountry.empty() || safeCountry.size() > 3) safeCountry = "XX";
+    return safeCountry;
+}
+
 // Extract CN from subject DN (supports both /C=xx/CN=name and CN=name,C=xx formats)
 std::string extractCnFromDn(const std::string& dn) {
     // Try /CN= format first
@@ -424,408 +273,264 @@ std::string extractCnFromDn(const std::string& dn) {
     return "";
 }
 
-// Decode hex string to bytes
-std::vector<uint8_t> decodeHexString(const std::string& hexStr) {
-    std::vector<uint8_t> bytes;
-    bytes.reserve(hexStr.size() / 2);
-    for (size_t i = 0; i + 1 < hexStr.size(); i += 2) {
-        char h[3] = {hexStr[i], hexStr[i + 1], 0};
-        bytes.push_back(static_cast<uint8_t>(strtol(h, nullptr, 16)));
-    }
-    return bytes;
-}
-
-// Parse hex-encoded bytea to DER binary
-// Handles double-encoded data: BYTEA contains text "\\x3082..." stored as bytes
-// PostgreSQL returns: \x5c7833303832... (hex of the text bytes)
-std::vector<uint8_t> hexToBytes(const std::string& hex) {
-    std::string cleanHex = hex;
-
-    // Strip \x prefix from PostgreSQL hex format
-    if (cleanHex.size() >= 2 && cleanHex[0] == '\\' && cleanHex[1] == 'x') {
-        cleanHex = cleanHex.substr(2);
-    }
-
-    // First decode: hex string → bytes
-    std::vector<uint8_t> firstPass = decodeHexString(cleanHex);
-
-    // Check if result is still hex-encoded text (starts with \x or 0x30)
-    if (firstPass.size() >= 2 && firstPass[0] == '\\' && firstPass[1] == 'x') {
-        // Double-encoded: the bytes are ASCII text "\\x3082..."
-        // Convert bytes back to string, strip \\x prefix, decode again
-        std::string innerHex(firstPass.begin() + 2, firstPass.end());
-        return decodeHexString(innerHex);
-    }
-
-    // Check if first byte is a valid ASN.1 tag (0x30 = SEQUENCE)
-    if (!firstPass.empty() && firstPass[0] == 0x30) {
-        return firstPass; // Already proper DER binary
-    }
-
-    return firstPass;
+// Copy a memory BIO's contents
+std::vector<uint8_t> bioToBytes(BIO* bio) {
+    BUF_MEM* mem = nullptr;
+    BIO_get_mem_ptr(bio, &mem);
+    return std::vector<uint8_t>(
+        reinterpret_cast<const uint8_t*>(mem->data),
+        reinterpret_cast<const uint8_t*>(mem->data) + mem->length
+    );
 }
 
-// Convert DER cert to PEM
-std::vector<uint8_t> derCertToPem(const std::vector<uint8_t>& derData) {
-    const unsigned char* data = derData.data();
-    X509* x509 = d2i_X509(nullptr, &data, derData.size());
-    if (!x509) return derData; // Fallback: return DER as-is
+// Convert DER cert to PEM (empty if the DER does not parse)
+std::vector<uint8_t> derCertToPem(common::ByteSpan der) {
+    const unsigned char* data = der.data();
+    X509* x509 = d2i_X509(nullptr, &data, static_cast<long>(der.size()));
+    if (!x509) return {};
 
     BIO* bio = BIO_new(BIO_s_mem());
-    if (!bio) { X509_free(x509); return derData; }
+    if (!bio) { X509_free(x509); return {}; }
     PEM_write_bio_X509(bio, x509);
     X509_free(x509);
 
-    BUF_MEM* mem = nullptr;
-    BIO_get_mem_ptr(bio, &mem);
-    std::vector<uint8_t> pem(
-        reinterpret_cast<const uint8_t*>(mem->data),
-        reinterpret_cast<const uint8_t*>(mem->data) + mem->length
-    );
+    std::vector<uint8_t> pem = bioToBytes(bio);
     BIO_free(bio);
     return pem;
 }
 
-// Convert DER CRL to PEM
-std::vector<uint8_t> derCrlToPem(const std::vector<uint8_t>& derData) {
-    const unsigned char* data = derData.data();
-    X509_CRL* crl = d2i_X509_CRL(nullptr, &data, derData.size());
-    if (!crl) return derData;
+// Convert DER CRL to PEM (empty if the DER does not parse)
+std::vector<uint8_t> derCrlToPem(common::ByteSpan der) {
+    const unsigned char* data = der.data();
+    X509_CRL* crl = d2i_X509_CRL(nullptr, &data, static_cast<long>(der.size()));
+    if (!crl) return {};
 
     BIO* bio = BIO_new(BIO_s_mem());
-    if (!bio) { X509_CRL_free(crl); return derData; }
+    if (!bio) { X509_CRL_free(crl); return {}; }
     PEM_write_bio_X509_CRL(bio, crl);
     X509_CRL_free(crl);
 
-    BUF_MEM* mem = nullptr;
-    BIO_get_mem_ptr(bio, &mem);
-    std::vector<uint8_t> pem(
-        reinterpret_cast<const uint8_t*>(mem->data),
-        reinterpret_cast<const uint8_t*>(mem->data) + mem->length
-    );
+    std::vector<uint8_t> pem = bioToBytes(bio);
     BIO_free(bio);
     return pem;
 }
 
-// Add binary data to ZIP archive
-bool addToZip(zip_t* archive, const std::string& path, const std::vector<uint8_t>& data) {
-    void* buf = malloc(data.size());
-    if (!buf) return false;
-    memcpy(buf, data.data(), data.size());
-
-    zip_source_t* src = zip_source_buffer(archive, buf, data.size(), 1);
-    if (!src) {
-        free(buf);
-        return false;
-    }
-
-    zip_int64_t idx = zip_file_add(archive, path.c_str(), src, ZIP_FL_OVERWRITE | ZIP_FL_ENC_UTF_8);
-    if (idx < 0) {
-        zip_source_free(src);
-        return false;
+// Add a certificate/CRL entry, converting to PEM if requested (falls back to DER as-is)
+bool addDerEntry(common::ZipStreamWriter& zip, const std::string& path,
+                 common::ByteSpan der, ExportFormat format, bool isCrl) {
+    if (format == ExportFormat::PEM) {
+        std::vector<uint8_t> pem = isCrl ? derCrlToPem(der) : derCertToPem(der);
+        if (!pem.empty()) return zip.addFile(path, pem);
     }
-    return true;
+    return zip.addFile(path, der.data(), der.size());
 }
 
-} // anonymous namespace
-
-ExportResult exportAllCertificatesFromDb(
-    repositories::CertificateRepository* certRepo,
-    repositories::CrlRepository* crlRepo,
-    common::IQueryExecutor* queryExecutor,
-    ExportFormat format,
-    common::LdapConnectionPool* ldapPool
-) {
-    ExportResult result;
-    result.success = false;
+std::string fingerprintPrefix(std::string_view fingerprint, size_t len) {
+    return std::string(fingerprint.substr(0, std::min(fingerprint.size(), len)));
+}
 
-    if (!certRepo || !crlRepo || !queryExecutor) {
-        result.errorMessage = "Missing repository dependencies";
-        return result;
+// Master Lists live only in LDAP (master_list DB table is empty)
+// DN pattern: cn={fingerprint},o=ml,c={CC},dc=data,...
+// LDAP failures only skip the Master Lists; ZIP/sink errors propagate to the caller.
+size_t addMasterListsFromLdap(common::LdapConnectionPool* ldapPool, common::ZipStreamWriter& zip) {
+    std::optional<common::LdapConnection> conn;
+    try {
+        conn.emplace(ldapPool->acquire());
+    } catch (const std::exception& e) {
+        spdlog::warn("Export: ML LDAP retrieval failed: {}", e.what());
+        return 0;
+    }
+    if (!conn->isValid()) {
+        spdlog::warn("Export: Failed to acquire LDAP connection for ML retrieval");
+        return 0;
     }
 
-    spdlog::info("Starting full PKD export (format={})", format == ExportFormat::PEM ? "PEM" : "DER");
+    std::string baseDn = "dc=data,dc=download,dc=pkd,dc=ldap,dc=smartcoreinc,dc=com";
+    std::string filter = "(objectClass=pkdMasterList)";
+    const char* attrs[] = {"pkdMasterListContent", nullptr};
+
+    LDAPMessage* rawResult = nullptr;
+    int rc = ldap_search_ext_s(
+        conn->get(),
+        baseDn.c_str(),
+        LDAP_SCOPE_SUBTREE,
+        filter.c_str(),
+        const_cast<char**>(attrs),
+        0, nullptr, nullptr, nullptr, 0,
+        &rawResult
+    );
+    std::unique_ptr<LDAPMessage, decltype(&ldap_msgfree)> result(rawResult, ldap_msgfree);
 
-    try {
-        // Create temporary ZIP file
-        char tmpFilename[] = "/tmp/icao-pkd-export-XXXXXX";
-        int tmpFd = mkstemp(tmpFilename);
-        if (tmpFd == -1) {
-            result.errorMessage = "Failed to create temporary file";
-            return result;
-        }
-        close(tmpFd);
-        TempFileGuard tmpGuard(tmpFilename);
-
-        int error = 0;
-        zip_t* archive = zip_open(tmpFilename, ZIP_CREATE | ZIP_TRUNCATE, &error);
-        if (!archive) {
-            result.errorMessage = "Failed to create ZIP archive";
-            return result;
-        }
+    if (rc != LDAP_SUCCESS || !result) {
+        spdlog::warn("Export: LDAP ML search failed: {}",
+                     rc != LDAP_SUCCESS ? ldap_err2string(rc) : "no result");
+        return 0;
+    }
 
-        int addedCount = 0;
-
-        // 1. Certificates (CSCA, DSC, MLSC, DSC_NC)
-        Json::Value certs = certRepo->findAllForExport();
-        spdlog::info("Export: {} certificates to process", certs.size());
-
-        for (const auto& row : certs) {
-            try {
-                std::string certType = row.get("certificate_type", "").asString();
-                std::string country = row.get("country_code", "").asString();
-                std::string subjectDn = row.get("subject_dn", "").asString();
-                std::string fingerprint = row.get("fingerprint_sha256", "").asString();
-                std::string certDataHex = row.get("certificate_data", "").asString();
-
-                if (certDataHex.empty() || country.empty()) continue;
-
-                // Parse hex to binary
-                std::vector<uint8_t> derData = hexToBytes(certDataHex);
-                if (derData.empty()) continue;
-
-                // Determine folder path based on cert type
-                // CSCA with is_self_signed=false → link certificate (o=lc in LDAP)
-                bool isSelfSigned = true;
-                if (row["is_self_signed"].isString()) {
-                    // Oracle returns NUMBER(1) as string "1"/"0"
-                    isSelfSigned = (row["is_self_signed"].asString() == "1" ||
-                                    row["is_self_signed"].asString() == "true" ||
-                                    row["is_self_signed"].asString() == "TRUE");
-                } else {
-                    isSelfSigned = row.get("is_self_signed", true).asBool();
-                }
-                // Validate country code (ISO 3166-1 alpha-2/3, defense-in-depth against path traversal)
-                std::string safeCountry;
-                for (char c : country) {
-                    if (std::isalpha(static_cast<unsigned char>(c))) {
-                        safeCountry += c;
-                    }
-                }
-                if (safeCountry.empty() || safeCountry.size() > 3) safeCountry = "XX";
-
-                std::string folder;
-                if (certType == "DSC_NC") {
-                    folder = "nc-data/" + safeCountry + "/dsc/";
-                } else {
-                    std::string typeFolder = "csca";
-                    if (certType == "DSC") typeFolder = "dsc";
-                    else if (certType == "MLSC") typeFolder = "mlsc";
-                    else if (certType == "CSCA" && !isSelfSigned) typeFolder = "lc";
-                    else if (certType == "CSCA") typeFolder = "csca";
-                    folder = "data/" + safeCountry + "/" + typeFolder + "/";
-                }
-
-                // Generate filename: CN_fingerprint8.ext
-                std::string cn = extractCnFromDn(subjectDn);
-                std::string safeName = cn.empty() ? certType : sanitizeForFilename(cn);
-                // Ensure no path traversal in sanitized name
-                if (safeName.find("..") != std::string::npos) safeName = certType;
-                std::string fp8 = fingerprint.substr(0, std::min(fingerprint.size(), size_t(8)));
-                std::string ext = (format == ExportFormat::PEM) ? ".pem" : ".der";
-                std::string filePath = folder + safeName + "_" + fp8 + ext;
-
-                // Convert to PEM if requested
-                std::vector<uint8_t> fileData = (format == ExportFormat::PEM) ? derCertToPem(derData) : derData;
-
-                if (addToZip(archive, filePath, fileData)) {
-                    addedCount++;
-                }
-            } catch (const std::exception& e) {
-                spdlog::warn("Export: skipping cert: {}", e.what());
-            }
+    spdlog::info("Export: {} Master Lists found in LDAP", ldap_count_entries(conn->get(), result.get()));
+
+    size_t mlCount = 0;
+    for (LDAPMessage* entry = ldap_first_entry(conn->get(), result.get());
+         entry != nullptr;
+         entry = ldap_next_entry(conn->get(), entry))
+    {
+        // Extract DN to get country and fingerprint
+        char* dnRaw = ldap_get_dn(conn->get(), entry);
+        if (!dnRaw) continue;
+        std::string dn(dnRaw);
+        ldap_memfree(dnRaw);
+
+        // Parse country from DN: ...c=XX,...
+        auto cPos = dn.find("c=");
+        if (cPos == std::string::npos) continue;
+        auto cEnd = dn.find(',', cPos);
+        std::string country = sanitizeCountry(dn.substr(cPos + 2, cEnd - cPos - 2));
+
+        // Parse fingerprint from DN: cn=XXXX,...
+        std::string fingerprint;
+        if (dn.substr(0, 3) == "cn=") {
+            auto cnEnd = dn.find(',');
+            fingerprint = sanitizeForFilename(dn.substr(3, cnEnd - 3));
         }
 
-        spdlog::info("Export: {} certificates added to ZIP", addedCount);
-
-        // 2. CRLs
-        Json::Value crls = crlRepo->findAllForExport();
-        int crlCount = 0;
-        spdlog::info("Export: {} CRLs to process", crls.size());
-
-        for (const auto& row : crls) {
-            try {
-                std::string country = row.get("country_code", "").asString();
-                std::string crlDataHex = row.get("crl_binary", "").asString();
-                std::string fingerprint = row.get("fingerprint_sha256", "").asString();
-
-                if (crlDataHex.empty() || country.empty()) continue;
+        std::unique_ptr<struct berval*, decltype(&ldap_value_free_len)> values(
+            ldap_get_values_len(conn->get(), entry, "pkdMasterListContent"), ldap_value_free_len);
+        if (!values || !values.get()[0] || values.get()[0]->bv_len == 0) continue;
 
-                std::vector<uint8_t> derData = hexToBytes(crlDataHex);
-                if (derData.empty()) continue;
+        // Master Lists are CMS SignedData - always original binary
+        std::string filePath = "data/" + country + "/ml/" + country + "_ml_" +
+                               fingerprintPrefix(fingerprint, 8) + ".cms";
+        const berval* value = values.get()[0];
+        if (zip.addFile(filePath, reinterpret_cast<const uint8_t*>(value->bv_val), value->bv_len)) {
+            mlCount++;
+        }
+    }
+    return mlCount;
+}
 
-                std::string fp8 = fingerprint.substr(0, 8);
-                std::string ext = (format == ExportFormat::PEM) ? ".pem" : ".crl";
-                std::string filePath = "data/" + country + "/crl/" + country + "_crl_" + fp8 + ext;
+} // anonymous namespace
 
-                std::vector<uint8_t> fileData = (format == ExportFormat::PEM) ? derCrlToPem(derData) : derData;
+std::string fullExportFilename() {
+    auto now = std::time(nullptr);
+    std::tm tm_buf{};
+    localtime_r(&now, &tm_buf);
+    std::ostringstream ts;
+    ts << std::put_time(&tm_buf, "%Y%m%d-%H%M%S");
+    return "ICAO-PKD-Export-" + ts.str() + ".zip";
+}
 
-                if (addToZip(archive, filePath, fileData)) {
-                    crlCount++;
-                    addedCount++;
-                }
-            } catch (const std::exception& e) {
-                spdlog::warn("Export: skipping CRL: {}", e.what());
-            }
-        }
+StreamExportStats streamAllCertificatesFromDb(
+    repositories::CertificateRepository* certRepo,
+    repositories::CrlRepository* crlRepo,
+    ExportFormat format,
+    common::LdapConnectionPool* ldapPool,
+    common::ZipStreamWriter& zip
+) {
+    if (!certRepo || !crlRepo) {
+        throw std::invalid_argument("Missing repository dependencies");
+    }
 
-        spdlog::info("Export: {} CRLs added to ZIP", crlCount);
-
-        // 3. Master Lists (from LDAP directly)
-        // master_list DB table is empty; ML data lives only in LDAP
-        // DN pattern: cn={fingerprint},o=ml,c={CC},dc=data,...
-        int mlCount = 0;
-
-        if (ldapPool) {
-            try {
-                auto conn = ldapPool->acquire();
-                if (conn.isValid()) {
-                    std::string baseDn = "dc=data,dc=download,dc=pkd,dc=ldap,dc=smartcoreinc,dc=com";
-                    std::string filter = "(objectClass=pkdMasterList)";
-                    const char* attrs[] = {"pkdMasterListContent", nullptr};
-
-                    LDAPMessage* result = nullptr;
-                    int rc = ldap_search_ext_s(
-                        conn.get(),
-                        baseDn.c_str(),
-                        LDAP_SCOPE_SUBTREE,
-                        filter.c_str(),
-                        const_cast<char**>(attrs),
-                        0, nullptr, nullptr, nullptr, 0,
-                        &result
-                    );
-
-                    if (rc == LDAP_SUCCESS && result) {
-                        int mlTotal = ldap_count_entries(conn.get(), result);
-                        spdlog::info("Export: {} Master Lists found in LDAP", mlTotal);
-
-                        for (LDAPMessage* entry = ldap_first_entry(conn.get(), result);
-                             entry != nullptr;
-                             entry = ldap_next_entry(conn.get(), entry))
-                        {
-                            try {
-                                // Extract DN to get country and fingerprint
-                                char* dnRaw = ldap_get_dn(conn.get(), entry);
-                                if (!dnRaw) continue;
-                                std::string dn(dnRaw);
-                                ldap_memfree(dnRaw);
-
-                                // Parse country from DN: ...c=XX,...
-                                std::string country;
-                                auto cPos = dn.find("c=");
-                                if (cPos != std::string::npos) {
-                                    auto cEnd = dn.find(',', cPos);
-                                    country = dn.substr(cPos + 2, cEnd - cPos - 2);
-                                }
-                                if (country.empty()) continue;
-
-                                // Parse fingerprint from DN: cn=XXXX,...
-                                std::string fingerprint;
-                                if (dn.substr(0, 3) == "cn=") {
-                                    auto cnEnd = dn.find(',');
-                                    fingerprint = dn.substr(3, cnEnd - 3);
-                                }
-                                std::string fp8 = fingerprint.length() >= 8 ? fingerprint.substr(0, 8) : fingerprint;
-
-                                // Extract binary ML content
-                                struct berval** values = ldap_get_values_len(
-                                    conn.get(), entry, "pkdMasterListContent");
-                                if (!values || !values[0]) {
-                                    if (values) ldap_value_free_len(values);
-                                    continue;
-                                }
-
-                                std::vector<uint8_t> binaryData(
-                                    reinterpret_cast<const uint8_t*>(values[0]->bv_val),
-                                    reinterpret_cast<const uint8_t*>(values[0]->bv_val) + values[0]->bv_len
-                                );
-                                ldap_value_free_len(values);
-
-                                if (binaryData.empty()) continue;
-
-                                // Master Lists are CMS SignedData - always original binary
-                                std::string filePath = "data/" + country + "/ml/" + country + "_ml_" + fp8 + ".cms";
-
-                                if (addToZip(archive, filePath, binaryData)) {
-                                    mlCount++;
-                                    addedCount++;
-                                }
-                            } catch (const std::exception& e) {
-                                spdlog::warn("Export: skipping ML entry: {}", e.what());
-                            }
-                        }
-                        ldap_msgfree(result);
-                    } else {
-                        spdlog::warn("Export: LDAP ML search failed: {}",
-                                     rc != LDAP_SUCCESS ? ldap_err2string(rc) : "no result");
-                        if (result) ldap_msgfree(result);
-                    }
-                } else {
-                    spdlog::warn("Export: Failed to acquire LDAP connection for ML retrieval");
-                }
-            } catch (const std::exception& e) {
-                spdlog::warn("Export: ML LDAP retrieval failed: {}", e.what());
-            }
+    spdlog::info("Starting full PKD export (format={})", format == ExportFormat::PEM ? "PEM" : "DER");
+    StreamExportStats stats;
+
+    // 1. Certificates (CSCA, DSC, MLSC, DSC_NC) — streamed from the DB cursor as raw DER
+    size_t certTotal = certRepo->findAllForExport([&](const repositories::CertificateExportRow& row) {
+        if (row.certificateDer.empty() || row.countryCode.empty()) return;
+        std::string certType(row.certificateType);
+        std::string safeCountry = sanitizeCountry(row.countryCode);
+
+        // CSCA with is_self_signed=false → link certificate (o=lc in LDAP)
+        std::string folder;
+        if (certType == "DSC_NC") {
+            folder = "nc-data/" + safeCountry + "/dsc/";
         } else {
-            spdlog::info("Export: No LDAP pool provided, skipping Master Lists");
+            std::string typeFolder = "csca";
+            if (certType == "DSC") typeFolder = "dsc";
+            else if (certType == "MLSC") typeFolder = "mlsc";
+            else if (certType == "CSCA" && !row.isSelfSigned) typeFolder = "lc";
+            folder = "data/" + safeCountry + "/" + typeFolder + "/";
         }
 
-        spdlog::info("Export: {} Master Lists added to ZIP", mlCount);
+        // Generate filename: CN_fingerprint8.ext
+        std::string cn = extractCnFromDn(std::string(row.subjectDn));
+        std::string safeName = cn.empty() ? certType : sanitizeForFilename(cn);
+        // Ensure no path traversal in sanitized name
+        if (safeName.find("..") != std::string::npos) safeName = certType;
+        std::string ext = (format == ExportFormat::PEM) ? ".pem" : ".der";
+        std::string filePath = folder + safeName + "_" + fingerprintPrefix(row.fingerprint, 8) + ext;
 
-        // Finalize ZIP
-        if (addedCount == 0) {
-            zip_discard(archive);
-            result.errorMessage = "No data found for export";
-            return result;
+        if (addDerEntry(zip, filePath, row.certificateDer, format, false)) {
+            stats.certificates++;
         }
-
-        if (zip_close(archive) != 0) {
-            zip_discard(archive);
-            result.errorMessage = "Failed to finalize ZIP archive";
-            return result;
+    });
+    spdlog::info("Export: {} of {} certificates added to ZIP", stats.certificates, certTotal);
+
+    // 2. CRLs
+    size_t crlTotal = crlRepo->findAllForExport([&](const repositories::CrlExportRow& row) {
+        if (row.crlDer.empty() || row.countryCode.empty()) return;
+        std::string country = sanitizeCountry(row.countryCode);
+        std::string ext = (format == ExportFormat::PEM) ? ".pem" : ".crl";
+        std::string filePath = "data/" + country + "/crl/" + country + "_crl_" +
+                               fingerprintPrefix(row.fingerprint, 8) + ext;
+
+        if (addDerEntry(zip, filePath, row.crlDer, format, true)) {
+            stats.crls++;
         }
+    });
+    spdlog::info("Export: {} of {} CRLs added to ZIP", stats.crls, crlTotal);
 
-        // Read ZIP into memory
-        FILE* f = fopen(tmpFilename, "rb");
-        if (!f) {
-            result.errorMessage = "Failed to read ZIP file";
-            return result;
-        }
+    // 3. Master Lists (from LDAP directly)
+    if (ldapPool) {
+        stats.masterLists = addMasterListsFromLdap(ldapPool, zip);
+        spdlog::info("Export: {} Master Lists added to ZIP", stats.masterLists);
+    } else {
+        spdlog::info("Export: No LDAP pool provided, skipping Master Lists");
+    }
 
-        fseek(f, 0, SEEK_END);
-        long fileSize = ftell(f);
-        fseek(f, 0, SEEK_SET);
+    return stats;
+}
 
-        result.data.resize(fileSize);
-        size_t bytesRead = fread(result.data.data(), 1, fileSize, f);
-        fclose(f);
-        // Temp file auto-cleaned by TempFileGuard destructor
+StreamExportStats streamCountryCertificatesFromDb(
+    repositories::CertificateRepository* certRepo,
+    repositories::CrlRepository* crlRepo,
+    const std::string& country,
+    ExportFormat format,
+    common::ZipStreamWriter& zip
+) {
+    if (!certRepo || !crlRepo) {
+        throw std::invalid_argument("Missing repository dependencies");
+    }
 
-        if (bytesRead != static_cast<size_t>(fileSize)) {
-            result.errorMessage = "Failed to read complete ZIP data";
-            return result;
+    spdlog::info("Exporting country certificates - Country: {}, Format: {}",
+                 country, format == ExportFormat::PEM ? "PEM" : "DER");
+    StreamExportStats stats;
+    std::string safeCountry = sanitizeCountry(country);
+
+    // Format: {COUNTRY}_{TYPE}_{SERIAL16}.{ext}; fingerprint appended if two serials collide
+    certRepo->findAllForExport([&](const repositories::CertificateExportRow& row) {
+        if (row.certificateDer.empty()) return;
+        std::string base = safeCountry + "_" + sanitizeForFilename(std::string(row.certificateType)) + "_" +
+                           sanitizeForFilename(std::string(row.serialNumber.substr(0, 16)));
+        std::string ext = (format == ExportFormat::PEM) ? ".pem" : ".crt";
+
+        if (addDerEntry(zip, base + ext, row.certificateDer, format, false) ||
+            addDerEntry(zip, base + "_" + fingerprintPrefix(row.fingerprint, 8) + ext,
+                        row.certificateDer, format, false)) {
+            stats.certificates++;
         }
+    }, country);
+
+    crlRepo->findAllForExport([&](const repositories::CrlExportRow& row) {
+        if (row.crlDer.empty()) return;
+        std::string ext = (format == ExportFormat::PEM) ? ".pem" : ".crl";
+        std::string filePath = safeCountry + "_CRL_" + fingerprintPrefix(row.fingerprint, 16) + ext;
+        if (addDerEntry(zip, filePath, row.crlDer, format, true)) {
+            stats.crls++;
+        }
+    }, country);
 
-        // Generate filename with timestamp
-        auto now = std::time(nullptr);
-        std::tm tm_buf{};
-        localtime_r(&now, &tm_buf);
-        std::ostringstream ts;
-        ts << std::put_time(&tm_buf, "%Y%m%d-%H%M%S");
-
-        result.filename = "ICAO-PKD-Export-" + ts.str() + ".zip";
-        result.contentType = "application/zip";
-        result.success = true;
-
-        spdlog::info("Full PKD export completed: {} files ({} certs, {} CRLs, {} MLs), ZIP size: {} bytes",
-                     addedCount, addedCount - crlCount - mlCount, crlCount, mlCount, result.data.size());
-
-    } catch (const std::exception& e) {
-        result.errorMessage = e.what();
-        spdlog::error("Full PKD export failed: {}", e.what());
-    }
-
-    return result;
+    spdlog::info("Country export: {} certificates, {} CRLs for {}", stats.certificates, stats.crls, country);
+    return stats;
 }
 
 } // namespace services
@@ -13,6 +13,7 @@
 #include "../repositories/certificate_repository.h"
 #include "../repositories/crl_repository.h"
 #include "i_query_executor.h"
+#include "../common/zip_stream_writer.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -83,17 +84,6 @@ public:
         ExportFormat format
     );
 
-    /**
-     * @brief Export all certificates for a country as ZIP archive
-     * @param country ISO 3166-1 alpha-2 code
-     * @param format Certificate format in ZIP (DER or PEM)
-     * @return Export result with ZIP binary data
-     */
-    ExportResult exportCountryCertificates(
-        const std::string& country,
-        ExportFormat format
-    );
-
 private:
     std::shared_ptr<repositories::ICertificateRepository> repository_;
 
@@ -130,17 +120,6 @@ private:
         ExportFormat format
     );
 
-    /**
-     * @brief Create ZIP archive from multiple certificates
-     * @param dns List of Distinguished Names
-     * @param format Certificate format in ZIP
-     * @return ZIP binary data
-     */
-    std::vector<uint8_t> createZipArchive(
-        const std::vector<std::string>& dns,
-        ExportFormat format
-    );
-
     /**
      * @brief Get content type for HTTP response
      * @param format Export format
@@ -162,27 +141,66 @@ private:
 };
 
 /**
- * @brief Export all LDAP-stored data as DIT-structured ZIP archive
+ * @brief Entry counts of a streamed ZIP export
+ */
+struct StreamExportStats {
+    size_t certificates = 0;
+    size_t crls = 0;
+    size_t masterLists = 0;
+
+    size_t total() const { return certificates + crls + masterLists; }
+};
+
+/**
+ * @brief Timestamped archive name for the full export ("ICAO-PKD-Export-YYYYMMDD-HHMMSS.zip")
+ */
+std::string fullExportFilename();
+
+/**
+ * @brief Stream all LDAP-stored data into a DIT-structured ZIP archive
  *
- * Queries DB for all stored_in_ldap=TRUE certificates and CRLs.
- * Queries LDAP directly for Master Lists (o=ml entries).
- * Creates ZIP with LDAP DIT folder structure:
+ * Reads stored_in_ldap=TRUE certificates and CRLs through the repositories'
+ * streaming cursors and adds each one to the archive as it arrives, so only
+ * one row is in memory at a time. Master Lists are read from LDAP directly
+ * (o=ml entries). Folder structure mirrors the LDAP DIT:
  *   data/{country}/{csca|lc|dsc|mlsc|crl|ml}/
  *   nc-data/{country}/dsc/
  *
+ * The caller owns the writer and calls finish() (or abandons it on error).
+ *
  * @param certRepo Certificate repository (DB)
  * @param crlRepo CRL repository (DB)
- * @param queryExecutor Query executor (unused, kept for compatibility)
  * @param format PEM or DER
- * @param ldapPool LDAP connection pool for ML retrieval (optional, nullptr to skip MLs)
- * @return ExportResult with ZIP binary
+ * @param ldapPool LDAP connection pool for ML retrieval (nullptr to skip MLs)
+ * @param zip Destination archive
+ * @return Number of entries added per kind
+ * @throws std::invalid_argument if a repository is nullptr
+ * @throws std::runtime_error on query failure or if the writer's sink aborted
+ */
+StreamExportStats streamAllCertificatesFromDb(
+    repositories::CertificateRepository* certRepo,
+    repositories::CrlRepository* crlRepo,
+    ExportFormat format,
+    common::LdapConnectionPool* ldapPool,
+    common::ZipStreamWriter& zip
+);
+
+/**
+ * @brief Stream one country's LDAP-stored certificates and CRLs into a flat ZIP archive
+ *
+ * File names: {COUNTRY}_{TYPE}_{SERIAL16}.{pem|crt} and {COUNTRY}_CRL_{FP16}.{pem|crl}.
+ *
+ * @param country ISO 3166-1 alpha-2 code
+ * @return Number of entries added per kind
+ * @throws std::invalid_argument if a repository is nullptr
+ * @throws std::runtime_error on query failure or if the writer's sink aborted
  */
-ExportResult exportAllCertificatesFromDb(
+StreamExportStats streamCountryCertificatesFromDb(
     repositories::CertificateRepository* certRepo,
     repositories::CrlRepository* crlRepo,
-    common::IQueryExecutor* queryExecutor,
+    const std::string& country,
     ExportFormat format,
-    common::LdapConnectionPool* ldapPool = nullptr
+    common::ZipStreamWriter& zip
 );
 
 } // namespace services
@@ -25,6 +25,8 @@
 #include "der_parser.h"
 #include "cert_type_detector.h"
 #include <icao/x509/certificate_parser.h>
+#include <icao/validation/crl_cache.h>
+#include <icao/trust/trust_snapshot_notify.h>
 #include <dl_parser.h>
 
 // Doc 9303 compliance checklist
@@ -220,6 +222,10 @@ UploadService::CertificateUploadResult UploadService::uploadCertificate(
         uploadRepo_->updateStatistics(result.uploadId, result.cscaCount, result.dscCount,
                                        result.dscNcCount, result.crlCount, result.mlscCount, 0);
         uploadRepo_->updateStatus(result.uploadId, "COMPLETED", "");
+        certRepo_->invalidateSearchSummaryCache();
+        if (result.cscaCount > 0 || result.mlscCount > 0 || result.crlCount > 0) {
+            icao::trust::notifyTrustSnapshotChanged("certificate upload " + result.uploadId);
+        }
 
         result.success = true;
         result.status = "COMPLETED";
@@ -744,6 +750,8 @@ void UploadService::processCrlFile(CertificateUploadResult& result,
 
     if (!crlId.empty()) {
         result.crlCount++;
+        // New CRL for this country — drop the parsed copy so checks see it
+        icao::validation::CrlCache::instance().invalidate(countryCode);
 
         // Save revoked certificates
         STACK_OF(X509_REVOKED)* revokedStack = X509_CRL_get_REVOKED(crl);
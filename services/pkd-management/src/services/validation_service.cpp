@@ -43,7 +43,8 @@ ValidationService::ValidationService(
 
     if (crlRepo_) {
         crlProvider_ = std::make_unique<adapters::DbCrlProvider>(crlRepo_);
-        crlChecker_ = std::make_unique<icao::validation::CrlChecker>(crlProvider_.get());
+        crlChecker_ = std::make_unique<icao::validation::CrlChecker>(
+            crlProvider_.get(), &icao::validation::CrlCache::instance());
     }
 
     // Initialize LDAP-based validation components (for real-time PA Lookup)
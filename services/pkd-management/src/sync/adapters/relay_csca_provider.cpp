@@ -2,12 +2,12 @@
  * @file relay_csca_provider.cpp
  * @brief ICscaProvider adapter for PKD Relay Service
  *
- * In-memory CSCA cache: preloadAllCscas() loads all ~845 CSCAs once,
- * eliminating per-DSC DB queries during bulk re-validation.
+ * In-memory CSCA cache: preloadAllCscas() loads and parses all ~845 CSCAs
+ * once, eliminating per-DSC DB queries and d2i_X509 calls during bulk
+ * re-validation.
  */
 
 #include "relay_csca_provider.h"
-#include <icao/validation/cert_ops.h>
 #include <spdlog/spdlog.h>
 #include <openssl/x509.h>
 #include <stdexcept>
@@ -24,37 +24,31 @@ RelayCscaProvider::RelayCscaProvider(repositories::CertificateRepository* certRe
 
 void RelayCscaProvider::preloadAllCscas() {
     auto allCscas = certRepo_->findAllCscas();
-    cscaCache_.clear();
 
+    std::vector<std::vector<uint8_t>> derCerts;
+    derCerts.reserve(allCscas.size());
     for (auto& [subjectDn, derBytes] : allCscas) {
-        std::string normalizedDn = icao::validation::normalizeDnForComparison(subjectDn);
-        cscaCache_[normalizedDn].push_back(std::move(derBytes));
+        derCerts.push_back(std::move(derBytes));
     }
+    auto store = icao::validation::CscaTrustStore::fromDer(derCerts);
 
-    cacheLoaded_ = true;
-    spdlog::info("[RelayCscaProvider] Preloaded {} CSCA entries ({} unique DNs)",
-                 allCscas.size(), cscaCache_.size());
+    spdlog::info("[RelayCscaProvider] Preloaded {} CSCA entries ({} parsed, generation {})",
+                 allCscas.size(), store->size(), store->generation());
+    store_.publish(std::move(store));
 }
 
-std::vector<X509*> RelayCscaProvider::findAllCscasByIssuerDn(const std::string& issuerDn) {
-    if (!cacheLoaded_) {
+std::shared_ptr<const icao::validation::CscaTrustStore> RelayCscaProvider::trustStore() {
+    auto store = store_.load();
+    if (!store) {
         preloadAllCscas();
+        store = store_.load();
     }
+    return store;
+}
 
-    std::string normalizedDn = icao::validation::normalizeDnForComparison(issuerDn);
-    auto it = cscaCache_.find(normalizedDn);
-    if (it != cscaCache_.end()) {
-        std::vector<X509*> result;
-        for (const auto& derBytes : it->second) {
-            const unsigned char* p = derBytes.data();
-            X509* cert = d2i_X509(nullptr, &p, static_cast<long>(derBytes.size()));
-            if (cert) {
-                result.push_back(cert);
-            }
-        }
-        return result;
-    }
-    return {};
+std::vector<X509*> RelayCscaProvider::findAllCscasByIssuerDn(const std::string& issuerDn) {
+    auto store = trustStore();
+    return store ? store->copyBySubjectDn(issuerDn) : std::vector<X509*>{};
 }
 
 X509* RelayCscaProvider::findCscaByIssuerDn(
@@ -3,17 +3,17 @@
  * @brief ICscaProvider adapter for PKD Relay Service
  *
  * Bridges icao::validation::ICscaProvider to relay CertificateRepository.
- * In-memory CSCA cache for bulk DSC re-validation performance.
+ * In-memory CscaTrustStore for bulk DSC re-validation performance.
  */
 
 #pragma once
 
 #include <icao/validation/providers.h>
+#include <icao/validation/csca_trust_store.h>
 #include "../repositories/certificate_repository.h"
-#include <unordered_map>
+#include <memory>
 #include <vector>
 #include <string>
-#include <cstdint>
 
 namespace icao::relay::adapters {
 
@@ -23,6 +23,7 @@ public:
 
     std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override;
     X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode) override;
+    std::shared_ptr<const icao::validation::CscaTrustStore> trustStore() override;
 
     /**
      * @brief Preload all CSCA certificates into memory cache
@@ -35,9 +36,8 @@ public:
 private:
     repositories::CertificateRepository* certRepo_;
 
-    // In-memory cache: normalizedDn -> vector of DER-encoded certificate bytes
-    std::unordered_map<std::string, std::vector<std::vector<uint8_t>>> cscaCache_;
-    bool cacheLoaded_ = false;
+    // Pre-parsed CSCAs, borrowed by TrustChainBuilder (nullptr until first load)
+    icao::validation::CscaTrustStoreHolder store_;
 };
 
 } // namespace icao::relay::adapters
@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <cstdlib>
 #include <stdexcept>
@@ -48,6 +49,10 @@ struct Config {
     /// @{
     bool autoReconcile = true;
     int maxReconcileBatchSize = 100;
+    int reconcileLdapWindow = 64;  // Async LDAP searches/adds kept in flight per connection
+    int ldapStatsPageSize = 1000;  // Simple Paged Results page size for LDAP statistics
+    bool ldapStatsIncremental = false;    // Count only entries created since the last full scan
+    int ldapStatsFullRescanMinutes = 1440; // Max snapshot age before a full rescan (catches deletions)
     /// @}
 
     /// @name Daily scheduler settings
@@ -56,6 +61,9 @@ struct Config {
     int dailySyncHour = 0;      // 00:00 (midnight)
     int dailySyncMinute = 0;
     bool revalidateCertsOnSync = true;
+    bool revalidateIncremental = true;   // Daily run visits only DSCs affected by journaled CSCA/CRL changes
+    int revalidateFullSweepDays = 7;     // Max days between full revalidation sweeps
+    int revalidateParallelism = 4;       // Worker threads for trust chain / CRL steps (1 = sequential)
     /// @}
 
     /// @name ICAO PKD LDAP Sync (simulation / production)
@@ -90,12 +98,14 @@ struct Config {
         if (auto e = std::getenv("LDAP_BASE_DN")) ldapBaseDn = e;
         if (auto e = std::getenv("LDAP_DATA_CONTAINER")) ldapDataContainer = e;
         if (auto e = std::getenv("LDAP_NC_DATA_CONTAINER")) ldapNcDataContainer = e;
-        if (auto e = std::getenv("AUTO_RECONCILE")) autoReconcile = (std::string(e) == "true");
-        if (auto e = std::getenv("MAX_RECONCILE_BATCH_SIZE")) maxReconcileBatchSize = std::stoi(e);
+        loadSyncSettingsFromEnv();
         if (auto e = std::getenv("DAILY_SYNC_ENABLED")) dailySyncEnabled = (std::string(e) == "true");
         if (auto e = std::getenv("DAILY_SYNC_HOUR")) dailySyncHour = std::stoi(e);
         if (auto e = std::getenv("DAILY_SYNC_MINUTE")) dailySyncMinute = std::stoi(e);
         if (auto e = std::getenv("REVALIDATE_CERTS_ON_SYNC")) revalidateCertsOnSync = (std::string(e) == "true");
+        if (auto e = std::getenv("REVALIDATE_INCREMENTAL")) revalidateIncremental = (std::string(e) == "true");
+        if (auto e = std::getenv("REVALIDATE_FULL_SWEEP_DAYS")) revalidateFullSweepDays = std::stoi(e);
+        if (auto e = std::getenv("REVALIDATE_PARALLELISM")) revalidateParallelism = std::stoi(e);
         // ICAO PKD LDAP Sync
         if (auto e = std::getenv("ICAO_LDAP_SYNC_ENABLED")) icaoLdapSyncEnabled = (std::string(e) == "true");
         if (auto e = std::getenv("ICAO_LDAP_HOST")) icaoLdapHost = e;
@@ -111,6 +121,21 @@ struct Config {
         if (auto e = std::getenv("ICAO_LDAP_TLS_CA_CERT_FILE")) icaoLdapTlsCaCertFile = e;
     }
 
+    /**
+     * @brief Load the "Sync settings" group from environment variables
+     *
+     * Called by loadFromEnv() and by pkd-management's ServiceContainer, which
+     * fills the rest of its sync Config from AppConfig and never calls loadFromEnv().
+     */
+    void loadSyncSettingsFromEnv() {
+        if (auto e = std::getenv("AUTO_RECONCILE")) autoReconcile = (std::string(e) == "true");
+        if (auto e = std::getenv("MAX_RECONCILE_BATCH_SIZE")) maxReconcileBatchSize = std::stoi(e);
+        if (auto e = std::getenv("RECONCILE_LDAP_WINDOW")) reconcileLdapWindow = std::max(1, std::stoi(e));
+        if (auto e = std::getenv("LDAP_STATS_PAGE_SIZE")) ldapStatsPageSize = std::max(1, std::stoi(e));
+        if (auto e = std::getenv("LDAP_STATS_INCREMENTAL")) ldapStatsIncremental = (std::string(e) == "true");
+        if (auto e = std::getenv("LDAP_STATS_FULL_RESCAN_MINUTES")) ldapStatsFullRescanMinutes = std::max(0, std::stoi(e));
+    }
+
     /** @brief Validate that required credentials are set */
     void validateRequiredCredentials() const {
         if (dbPassword.empty()) {
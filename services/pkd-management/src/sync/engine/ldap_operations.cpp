@@ -7,6 +7,9 @@
 #include <openssl/x509.h>
 #include <openssl/pem.h>
 #include <openssl/bio.h>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
 
 namespace icao {
 namespace relay {
@@ -94,60 +97,7 @@ bool LdapOperations::addCertificate(LDAP* ld,
         return false;
     }
 
-    // v2.0.2: Use same LDAP schema as PKD Management for compatibility
-    // objectClass: top, person, organizationalPerson, inetOrgPerson, pkdDownload
-    // Required attributes: cn (Subject DN), sn (Serial Number), description
-
-    // Build LDAP attributes (compatible with PKD Management)
-    LDAPMod modObjectClass;
-    modObjectClass.mod_op = LDAP_MOD_ADD;
-    modObjectClass.mod_type = const_cast<char*>("objectClass");
-    char* ocVals[] = {
-        const_cast<char*>("top"),
-        const_cast<char*>("person"),
-        const_cast<char*>("organizationalPerson"),
-        const_cast<char*>("inetOrgPerson"),
-        const_cast<char*>("pkdDownload"),
-        nullptr
-    };
-    modObjectClass.mod_values = ocVals;
-
-    // cn (Subject DN)
-    LDAPMod modCn;
-    modCn.mod_op = LDAP_MOD_ADD;
-    modCn.mod_type = const_cast<char*>("cn");
-    char* cnVals[] = {const_cast<char*>(cert.subject.c_str()), nullptr};
-    modCn.mod_values = cnVals;
-
-    // sn (required by person) - use certificate ID as serial
-    std::string snValue = cert.id;
-    LDAPMod modSn;
-    modSn.mod_op = LDAP_MOD_ADD;
-    modSn.mod_type = const_cast<char*>("sn");
-    char* snVals[] = {const_cast<char*>(snValue.c_str()), nullptr};
-    modSn.mod_values = snVals;
-
-    // description
-    std::string descriptionValue = "Reconciled: " + cert.certType + " | Subject: " + cert.subject + " | ID: " + cert.id;
-    LDAPMod modDescription;
-    modDescription.mod_op = LDAP_MOD_ADD;
-    modDescription.mod_type = const_cast<char*>("description");
-    char* descVals[] = {const_cast<char*>(descriptionValue.c_str()), nullptr};
-    modDescription.mod_values = descVals;
-
-    // userCertificate;binary (binary certificate data)
-    LDAPMod modCert;
-    modCert.mod_op = LDAP_MOD_ADD | LDAP_MOD_BVALUES;
-    modCert.mod_type = const_cast<char*>("userCertificate;binary");
-    berval certBv;
-    certBv.bv_val = reinterpret_cast<char*>(const_cast<uint8_t*>(cert.certData.data()));
-    certBv.bv_len = cert.certData.size();
-    berval* certBvVals[] = {&certBv, nullptr};
-    modCert.mod_bvalues = certBvVals;
-
-    LDAPMod* mods[] = {&modObjectClass, &modCn, &modSn, &modDescription, &modCert, nullptr};
-
-    int rc = ldap_add_ext_s(ld, dn.c_str(), mods, nullptr, nullptr);
+    int rc = sendCertificateAdd(ld, dn, cert, nullptr);
 
     if (rc == LDAP_ALREADY_EXISTS) {
         // Entry already exists - this is OK during reconciliation
@@ -326,6 +276,88 @@ bool LdapOperations::addCrl(LDAP* ld,
         return false;
     }
 
+    int rc = sendCrlAdd(ld, dn, crl, nullptr);
+
+    if (rc == LDAP_ALREADY_EXISTS) {
+        // Entry already exists - this is OK during reconciliation
+        spdlog::debug("CRL already exists in LDAP: {}", dn);
+        return true;
+    }
+
+    if (rc != LDAP_SUCCESS) {
+        errorMsg = "LDAP add CRL failed: " + std::string(ldap_err2string(rc));
+        return false;
+    }
+
+    spdlog::debug("Added CRL to LDAP: {}", dn);
+    return true;
+}
+
+/** @brief Build certificate entry attributes and send the add request */
+int LdapOperations::sendCertificateAdd(LDAP* ld, const std::string& dn,
+                                       const CertificateInfo& cert, int* msgid) const {
+    // v2.0.2: Use same LDAP schema as PKD Management for compatibility
+    // objectClass: top, person, organizationalPerson, inetOrgPerson, pkdDownload
+    // Required attributes: cn (Subject DN), sn (Serial Number), description
+
+    // Build LDAP attributes (compatible with PKD Management)
+    LDAPMod modObjectClass;
+    modObjectClass.mod_op = LDAP_MOD_ADD;
+    modObjectClass.mod_type = const_cast<char*>("objectClass");
+    char* ocVals[] = {
+        const_cast<char*>("top"),
+        const_cast<char*>("person"),
+        const_cast<char*>("organizationalPerson"),
+        const_cast<char*>("inetOrgPerson"),
+        const_cast<char*>("pkdDownload"),
+        nullptr
+    };
+    modObjectClass.mod_values = ocVals;
+
+    // cn (Subject DN)
+    LDAPMod modCn;
+    modCn.mod_op = LDAP_MOD_ADD;
+    modCn.mod_type = const_cast<char*>("cn");
+    char* cnVals[] = {const_cast<char*>(cert.subject.c_str()), nullptr};
+    modCn.mod_values = cnVals;
+
+    // sn (required by person) - use certificate ID as serial
+    std::string snValue = cert.id;
+    LDAPMod modSn;
+    modSn.mod_op = LDAP_MOD_ADD;
+    modSn.mod_type = const_cast<char*>("sn");
+    char* snVals[] = {const_cast<char*>(snValue.c_str()), nullptr};
+    modSn.mod_values = snVals;
+
+    // description
+    std::string descriptionValue = "Reconciled: " + cert.certType + " | Subject: " + cert.subject + " | ID: " + cert.id;
+    LDAPMod modDescription;
+    modDescription.mod_op = LDAP_MOD_ADD;
+    modDescription.mod_type = const_cast<char*>("description");
+    char* descVals[] = {const_cast<char*>(descriptionValue.c_str()), nullptr};
+    modDescription.mod_values = descVals;
+
+    // userCertificate;binary (binary certificate data)
+    LDAPMod modCert;
+    modCert.mod_op = LDAP_MOD_ADD | LDAP_MOD_BVALUES;
+    modCert.mod_type = const_cast<char*>("userCertificate;binary");
+    berval certBv;
+    certBv.bv_val = reinterpret_cast<char*>(const_cast<uint8_t*>(cert.certData.data()));
+    certBv.bv_len = cert.certData.size();
+    berval* certBvVals[] = {&certBv, nullptr};
+    modCert.mod_bvalues = certBvVals;
+
+    LDAPMod* mods[] = {&modObjectClass, &modCn, &modSn, &modDescription, &modCert, nullptr};
+
+    if (msgid) {
+        return ldap_add_ext(ld, dn.c_str(), mods, nullptr, nullptr, msgid);
+    }
+    return ldap_add_ext_s(ld, dn.c_str(), mods, nullptr, nullptr);
+}
+
+/** @brief Build CRL entry attributes and send the add request */
+int LdapOperations::sendCrlAdd(LDAP* ld, const std::string& dn,
+                               const CrlInfo& crl, int* msgid) const {
     // Build LDAP attributes (compatible with PKD Management)
     // objectClass: top, cRLDistributionPoint, pkdDownload
     LDAPMod modObjectClass;
@@ -359,21 +391,184 @@ bool LdapOperations::addCrl(LDAP* ld,
 
     LDAPMod* mods[] = {&modObjectClass, &modCn, &modCrl, nullptr};
 
-    int rc = ldap_add_ext_s(ld, dn.c_str(), mods, nullptr, nullptr);
+    if (msgid) {
+        return ldap_add_ext(ld, dn.c_str(), mods, nullptr, nullptr, msgid);
+    }
+    return ldap_add_ext_s(ld, dn.c_str(), mods, nullptr, nullptr);
+}
 
-    if (rc == LDAP_ALREADY_EXISTS) {
-        // Entry already exists - this is OK during reconciliation
-        spdlog::debug("CRL already exists in LDAP: {}", dn);
-        return true;
+// --- Pipelined batch operations ---
+
+std::vector<int> LdapOperations::runPipelined(
+    LDAP* ld, size_t count, int window,
+    const std::function<int(size_t, int&)>& start,
+    std::vector<int>* durationsMs) const {
+
+    std::vector<int> rcs(count, LDAP_OTHER);
+    std::vector<std::chrono::steady_clock::time_point> started(count);
+    if (durationsMs) durationsMs->assign(count, 0);
+
+    const size_t maxInFlight = static_cast<size_t>(std::max(1, window));
+    std::unordered_map<int, size_t> inFlight;  // msgid → operation index
+    size_t next = 0;
+
+    while (next < count || !inFlight.empty()) {
+        while (next < count && inFlight.size() < maxInFlight) {
+            int msgid = -1;
+            int rc = start(next, msgid);
+            if (rc == LDAP_SUCCESS) {
+                inFlight.emplace(msgid, next);
+                started[next] = std::chrono::steady_clock::now();
+            } else {
+                rcs[next] = rc;
+            }
+            next++;
+        }
+        if (inFlight.empty()) continue;
+
+        LDAPMessage* msg = nullptr;
+        struct timeval timeout = {5, 0};
+        int type = ldap_result(ld, LDAP_RES_ANY, LDAP_MSG_ALL, &timeout, &msg);
+
+        if (type <= 0) {
+            // Timeout: abandon what is outstanding and carry on with the rest.
+            // Connection error: nothing else can succeed on this handle.
+            int rc = (type == 0) ? LDAP_TIMEOUT : LDAP_SERVER_DOWN;
+            spdlog::warn("LDAP pipeline: {} with {} operations outstanding",
+                         ldap_err2string(rc), inFlight.size());
+            for (const auto& [msgid, index] : inFlight) {
+                if (type == 0) ldap_abandon_ext(ld, msgid, nullptr, nullptr);
+                rcs[index] = rc;
+            }
+            inFlight.clear();
+            if (msg) ldap_msgfree(msg);
+            if (type < 0) {
+                for (; next < count; ++next) rcs[next] = rc;
+            }
+            continue;
+        }
+
+        auto it = inFlight.find(ldap_msgid(msg));
+        if (it != inFlight.end()) {
+            size_t index = it->second;
+            int err = LDAP_OTHER;
+            // Search responses arrive as an entry chain; ldap_parse_result finds the final result
+            if (ldap_parse_result(ld, msg, &err, nullptr, nullptr, nullptr, nullptr, 0) != LDAP_SUCCESS) {
+                err = LDAP_OTHER;
+            }
+            rcs[index] = err;
+            if (durationsMs) {
+                (*durationsMs)[index] = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - started[index]).count());
+            }
+            inFlight.erase(it);
+        }
+        ldap_msgfree(msg);
     }
 
-    if (rc != LDAP_SUCCESS) {
-        errorMsg = "LDAP add CRL failed: " + std::string(ldap_err2string(rc));
-        return false;
+    return rcs;
+}
+
+std::vector<int> LdapOperations::checkEntriesExist(
+    LDAP* ld,
+    const std::vector<std::string>& dns,
+    int window) const {
+
+    const char* attrs[] = {"1.1", nullptr};  // No attributes: existence only
+    struct timeval timeout = {5, 0};
+
+    return runPipelined(ld, dns.size(), window, [&](size_t i, int& msgid) {
+        return ldap_search_ext(ld, dns[i].c_str(), LDAP_SCOPE_BASE,
+                               "(objectClass=*)", const_cast<char**>(attrs), 0,
+                               nullptr, nullptr, &timeout, 0, &msgid);
+    });
+}
+
+std::vector<LdapOpResult> LdapOperations::addCertificates(
+    LDAP* ld,
+    const std::vector<CertificateInfo>& certs,
+    int window) const {
+
+    std::vector<LdapOpResult> results(certs.size());
+    std::vector<std::string> dns(certs.size());
+    std::map<std::string, std::string> parentErrors;  // "type/country" → error ("" = exists)
+
+    for (size_t i = 0; i < certs.size(); ++i) {
+        const auto& cert = certs[i];
+        std::string key = cert.certType + "/" + cert.countryCode;
+        auto parent = parentErrors.find(key);
+        if (parent == parentErrors.end()) {
+            std::string errorMsg;
+            ensureParentDnExists(ld, cert.certType, cert.countryCode, errorMsg);
+            parent = parentErrors.emplace(key, errorMsg).first;
+        }
+        results[i].error = parent->second;
+
+        dns[i] = cert.ldapDn.empty() ?
+                 buildDn(cert.certType, cert.countryCode, cert.fingerprint) :
+                 cert.ldapDn;
+        if (results[i].error.empty() && dns[i].empty()) {
+            results[i].error = "Failed to build LDAP DN";
+        }
     }
 
-    spdlog::debug("Added CRL to LDAP: {}", dn);
-    return true;
+    std::vector<int> durations;
+    std::vector<int> rcs = runPipelined(ld, certs.size(), window, [&](size_t i, int& msgid) {
+        if (!results[i].error.empty()) return LDAP_OTHER;  // Parent/DN failure: not sent
+        return sendCertificateAdd(ld, dns[i], certs[i], &msgid);
+    }, &durations);
+
+    for (size_t i = 0; i < certs.size(); ++i) {
+        results[i].durationMs = durations[i];
+        if (!results[i].error.empty()) continue;
+        if (rcs[i] == LDAP_SUCCESS || rcs[i] == LDAP_ALREADY_EXISTS) {
+            results[i].success = true;
+            spdlog::debug("Added certificate to LDAP: {} ({})", dns[i], certs[i].subject);
+        } else {
+            results[i].error = "LDAP add failed: " + std::string(ldap_err2string(rcs[i]));
+        }
+    }
+    return results;
+}
+
+std::vector<LdapOpResult> LdapOperations::addCrls(
+    LDAP* ld,
+    const std::vector<CrlInfo>& crls,
+    int window) const {
+
+    std::vector<LdapOpResult> results(crls.size());
+    std::vector<std::string> dns(crls.size());
+    std::map<std::string, std::string> parentErrors;  // country → error ("" = exists)
+
+    for (size_t i = 0; i < crls.size(); ++i) {
+        const auto& crl = crls[i];
+        auto parent = parentErrors.find(crl.countryCode);
+        if (parent == parentErrors.end()) {
+            std::string errorMsg;
+            ensureParentDnExists(ld, "CRL", crl.countryCode, errorMsg);
+            parent = parentErrors.emplace(crl.countryCode, errorMsg).first;
+        }
+        results[i].error = parent->second;
+        dns[i] = crl.ldapDn.empty() ? buildCrlDn(crl.countryCode, crl.fingerprint) : crl.ldapDn;
+    }
+
+    std::vector<int> durations;
+    std::vector<int> rcs = runPipelined(ld, crls.size(), window, [&](size_t i, int& msgid) {
+        if (!results[i].error.empty()) return LDAP_OTHER;
+        return sendCrlAdd(ld, dns[i], crls[i], &msgid);
+    }, &durations);
+
+    for (size_t i = 0; i < crls.size(); ++i) {
+        results[i].durationMs = durations[i];
+        if (!results[i].error.empty()) continue;
+        if (rcs[i] == LDAP_SUCCESS || rcs[i] == LDAP_ALREADY_EXISTS) {
+            results[i].success = true;
+            spdlog::debug("Added CRL to LDAP: {}", dns[i]);
+        } else {
+            results[i].error = "LDAP add CRL failed: " + std::string(ldap_err2string(rcs[i]));
+        }
+    }
+    return results;
 }
 
 } // namespace relay
@@ -8,12 +8,20 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <functional>
 #include "sync/common/types.h"
 #include "sync/common/config.h"
 
 namespace icao {
 namespace relay {
 
+/** @brief Outcome of one operation in a pipelined batch */
+struct LdapOpResult {
+    bool success = false;
+    std::string error;
+    int durationMs = 0;     ///< Request sent → response received
+};
+
 /**
  * @brief LDAP operations for certificate and CRL management
  *
@@ -98,9 +106,64 @@ public:
                const CrlInfo& crl,
                std::string& errorMsg) const;
 
+    /// @name Pipelined batch operations
+    /// Keep up to `window` asynchronous requests (ldap_search_ext / ldap_add_ext)
+    /// outstanding on one connection instead of one blocking round trip each.
+    /// @{
+
+    /**
+     * @brief Base-scope existence check for many DNs
+     * @param ld LDAP connection handle
+     * @param dns Entries to check
+     * @param window Maximum outstanding searches
+     * @return Per-DN result code (LDAP_SUCCESS = exists, LDAP_NO_SUCH_OBJECT = missing)
+     */
+    std::vector<int> checkEntriesExist(LDAP* ld,
+                                       const std::vector<std::string>& dns,
+                                       int window) const;
+
+    /**
+     * @brief Add many certificates (LDAP_ALREADY_EXISTS counts as success)
+     *
+     * Parent containers are ensured once per (type, country) instead of per
+     * certificate.
+     *
+     * @return Per-certificate outcome, same order as certs
+     */
+    std::vector<LdapOpResult> addCertificates(LDAP* ld,
+                                              const std::vector<CertificateInfo>& certs,
+                                              int window) const;
+
+    /**
+     * @brief Add many CRLs (LDAP_ALREADY_EXISTS counts as success)
+     * @return Per-CRL outcome, same order as crls
+     */
+    std::vector<LdapOpResult> addCrls(LDAP* ld,
+                                      const std::vector<CrlInfo>& crls,
+                                      int window) const;
+    /// @}
+
 private:
     const Config& config_;
 
+    /**
+     * @brief Drive `count` asynchronous operations with at most `window` in flight
+     * @param start Sends operation i and stores its message id; returns the send result code
+     * @param durationsMs Per-operation latency (optional)
+     * @return Per-operation LDAP result code
+     */
+    std::vector<int> runPipelined(LDAP* ld, size_t count, int window,
+                                  const std::function<int(size_t, int&)>& start,
+                                  std::vector<int>* durationsMs = nullptr) const;
+
+    /// Send a certificate add; blocking when msgid is nullptr
+    int sendCertificateAdd(LDAP* ld, const std::string& dn,
+                           const CertificateInfo& cert, int* msgid) const;
+
+    /// Send a CRL add; blocking when msgid is nullptr
+    int sendCrlAdd(LDAP* ld, const std::string& dn,
+                   const CrlInfo& crl, int* msgid) const;
+
     /**
      * @brief Create LDAP entry if it does not already exist
      * @param ld LDAP connection handle
@@ -4,11 +4,23 @@
  */
 #include "reconciliation_engine.h"
 #include "query_helpers.h"
+#include "bulk_writer.h"
+#include <icao/trust/trust_snapshot_notify.h>
 #include <spdlog/spdlog.h>
 #include <chrono>
 
 using common::db::getInt;
 
+namespace {
+
+constexpr const char* kReconciliationLogInsert =
+    "INSERT INTO reconciliation_log "
+    "(summary_id, operation, certificate_type, fingerprint_sha256, "
+    "country_code, subject_dn, status, error_message, duration_ms) "
+    "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9)";
+
+} // anonymous namespace
+
 namespace icao {
 namespace relay {
 
@@ -80,10 +92,41 @@ std::vector<CertificateInfo> ReconciliationEngine::findMissingInLdap(
             "ORDER BY id" +
             common::db::limitClause(dbType_, limit);
 
-        std::vector<std::string> params = {certType};
-        Json::Value rows = queryExecutor_->executeQuery(query, params);
+        // Binary row cursor: certificate_data arrives as DER (no JSON rows, no hex parsing)
+        std::vector<CertificateInfo> candidates;
+        queryExecutor_->executeQueryRows(query, {certType}, [&](common::RowCursor& rows) {
+            int idCol = rows.columnIndex("id");
+            int typeCol = rows.columnIndex("certificate_type");
+            int countryCol = rows.columnIndex("country_code");
+            int subjectCol = rows.columnIndex("subject_dn");
+            int issuerCol = rows.columnIndex("issuer_dn");
+            int fingerprintCol = rows.columnIndex("fingerprint_sha256");
+            int dataCol = rows.columnIndex("certificate_data");
+            int selfSignedCol = rows.columnIndex("is_self_signed");
+
+            while (rows.next()) {
+                CertificateInfo cert;
+                cert.id = rows.getString(idCol);
+                cert.certType = rows.getString(typeCol);
+                cert.countryCode = rows.getString(countryCol);
+                cert.subject = rows.getString(subjectCol);
+                cert.issuer = rows.getString(issuerCol);
+                cert.fingerprint = rows.getString(fingerprintCol);
+
+                // v2.2.2 FIX: Detect link certificates using DB is_self_signed field
+                // (set by X509_NAME_cmp which is case-insensitive per RFC 5280)
+                if (cert.certType == "CSCA" && !rows.getBool(selfSignedCol, true)) {
+                    cert.certType = "LC";
+                    spdlog::debug("Detected link certificate: {} (is_self_signed=false)", cert.id);
+                }
 
-        if (rows.empty()) {
+                common::ByteSpan der = rows.getBytes(dataCol);
+                cert.certData.assign(der.begin(), der.end());
+                candidates.push_back(std::move(cert));
+            }
+        });
+
+        if (candidates.empty()) {
             spdlog::info("Found 0 {} certificates missing in LDAP", certType);
             return result;
         }
@@ -96,51 +139,22 @@ std::vector<CertificateInfo> ReconciliationEngine::findMissingInLdap(
         }
         LDAP* ldRead = ldapConn.get();
 
-        for (const auto& row : rows) {
-            CertificateInfo cert;
-            cert.id = row["id"].asString();
-            cert.certType = row["certificate_type"].asString();
-            cert.countryCode = row["country_code"].asString();
-            cert.subject = row["subject_dn"].asString();
-            cert.issuer = row["issuer_dn"].asString();
-            cert.fingerprint = row["fingerprint_sha256"].asString();
-
-            // v2.2.2 FIX: Detect link certificates using DB is_self_signed field
-            // (set by X509_NAME_cmp which is case-insensitive per RFC 5280)
-            if (cert.certType == "CSCA") {
-                bool isSelfSigned = row.get("is_self_signed", true).asBool();
-                // Oracle returns "1"/"0" as string
-                if (row["is_self_signed"].isString()) {
-                    isSelfSigned = (row["is_self_signed"].asString() == "1" ||
-                                    row["is_self_signed"].asString() == "true" ||
-                                    row["is_self_signed"].asString() == "TRUE");
-                }
-                if (!isSelfSigned) {
-                    cert.certType = "LC";
-                    spdlog::debug("Detected link certificate: {} (is_self_signed=false)", cert.id);
-                }
-            }
-
-            // Build DN with fingerprint
+        // Build DNs with fingerprint, then check them with pipelined base searches
+        std::vector<std::string> dns;
+        dns.reserve(candidates.size());
+        for (auto& cert : candidates) {
             cert.ldapDn = ldapOps_->buildDn(cert.certType, cert.countryCode, cert.fingerprint);
+            dns.push_back(cert.ldapDn);
+        }
+        std::vector<int> rcs = ldapOps_->checkEntriesExist(ldRead, dns, config_.reconcileLdapWindow);
 
-            // Check if entry exists in LDAP
-            LDAPMessage* searchRes = nullptr;
-            const char* attrs[] = {"dn", nullptr};
-            struct timeval timeout = {5, 0};
-
-            int rc = ldap_search_ext_s(ldRead, cert.ldapDn.c_str(), LDAP_SCOPE_BASE,
-                                  "(objectClass=*)", const_cast<char**>(attrs), 0,
-                                  nullptr, nullptr, &timeout, 0, &searchRes);
-            // Free immediately — we only need the return code for existence check
-            if (searchRes) ldap_msgfree(searchRes);
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            auto& cert = candidates[i];
+            int rc = rcs[i];
 
             if (rc == LDAP_NO_SUCH_OBJECT) {
-                // Entry does not exist in LDAP - parse binary certificate data
-                std::string certHex = row["certificate_data"].asString();
-                cert.certData = parseHexBinary(certHex);
-
-                result.push_back(cert);
+                // Entry does not exist in LDAP
+                result.push_back(std::move(cert));
 
                 if (result.size() >= static_cast<size_t>(limit)) {
                     break;
@@ -163,21 +177,29 @@ std::vector<CertificateInfo> ReconciliationEngine::findMissingInLdap(
     return result;
 }
 
-void ReconciliationEngine::markAsStoredInLdap(const std::string& certId) const {
+void ReconciliationEngine::markAsStoredInLdap(const std::vector<std::string>& certIds) const {
+    if (certIds.empty()) return;
     try {
         std::string query = "UPDATE certificate SET stored_in_ldap = " + boolLiteral(true) + " WHERE id = $1";
-        queryExecutor_->executeCommand(query, {certId});
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(certIds.size());
+        for (const auto& id : certIds) rows.push_back({id});
+        queryExecutor_->executeBatch(query, rows);
     } catch (const std::exception& e) {
-        spdlog::error("Failed to mark certificate {} as stored in LDAP: {}", certId, e.what());
+        spdlog::error("Failed to mark {} certificates as stored in LDAP: {}", certIds.size(), e.what());
     }
 }
 
-void ReconciliationEngine::markCrlAsStoredInLdap(const std::string& crlId) const {
+void ReconciliationEngine::markCrlAsStoredInLdap(const std::vector<std::string>& crlIds) const {
+    if (crlIds.empty()) return;
     try {
         std::string query = "UPDATE crl SET stored_in_ldap = " + boolLiteral(true) + " WHERE id = $1";
-        queryExecutor_->executeCommand(query, {crlId});
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(crlIds.size());
+        for (const auto& id : crlIds) rows.push_back({id});
+        queryExecutor_->executeBatch(query, rows);
     } catch (const std::exception& e) {
-        spdlog::error("Failed to mark CRL {} as stored in LDAP: {}", crlId, e.what());
+        spdlog::error("Failed to mark {} CRLs as stored in LDAP: {}", crlIds.size(), e.what());
     }
 }
 
@@ -192,35 +214,38 @@ void ReconciliationEngine::processCertificateType(
 
     auto missingCerts = findMissingInLdap(certType, config_.maxReconcileBatchSize);
 
-    for (const auto& cert : missingCerts) {
-        result.totalProcessed++;
-
-        auto opStartTime = std::chrono::steady_clock::now();
-        std::string errorMsg;
-        bool success = false;
-
-        if (dryRun) {
+    // Adds are pipelined; DB bookkeeping is written in batches afterwards
+    std::vector<LdapOpResult> outcomes;
+    if (dryRun) {
+        outcomes.resize(missingCerts.size());
+        for (size_t i = 0; i < missingCerts.size(); ++i) {
             spdlog::info("[DRY-RUN] Would add {} to LDAP: {} ({})",
-                       certType, cert.subject, cert.ldapDn);
-            success = true;
-        } else {
-            success = ldapOps_->addCertificate(ld, cert, errorMsg);
-            if (success) {
-                markAsStoredInLdap(cert.id);
-            }
+                       certType, missingCerts[i].subject, missingCerts[i].ldapDn);
+            outcomes[i].success = true;
         }
+    } else {
+        outcomes = ldapOps_->addCertificates(ld, missingCerts, config_.reconcileLdapWindow);
+    }
+
+    common::BulkWriter opLog(queryExecutor_, kReconciliationLogInsert);
+    std::vector<std::string> storedIds;
 
-        auto opEndTime = std::chrono::steady_clock::now();
-        int opDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
-            opEndTime - opStartTime).count();
+    for (size_t i = 0; i < missingCerts.size(); ++i) {
+        const auto& cert = missingCerts[i];
+        const auto& outcome = outcomes[i];
+        result.totalProcessed++;
+
+        if (outcome.success && !dryRun) {
+            storedIds.push_back(cert.id);
+        }
 
         if (!reconciliationId.empty()) {
-            logReconciliationOperation(
+            logReconciliationOperation(opLog,
                 reconciliationId, "ADD", certType, cert,
-                success ? "SUCCESS" : "FAILED", errorMsg, opDurationMs);
+                outcome.success ? "SUCCESS" : "FAILED", outcome.error, outcome.durationMs);
         }
 
-        if (success) {
+        if (outcome.success) {
             result.successCount++;
             if (certType == "CSCA") result.cscaAdded++;
             else if (certType == "DSC") result.dscAdded++;
@@ -234,13 +259,16 @@ void ReconciliationEngine::processCertificateType(
             failure.operation = "ADD";
             failure.countryCode = cert.countryCode;
             failure.subject = cert.subject;
-            failure.error = errorMsg;
+            failure.error = outcome.error;
             result.failures.push_back(failure);
 
             spdlog::error("Failed to add {} to LDAP: {} - {}",
-                        certType, cert.subject, errorMsg);
+                        certType, cert.subject, outcome.error);
         }
     }
+
+    markAsStoredInLdap(storedIds);
+    opLog.flush();
 }
 
 ReconciliationResult ReconciliationEngine::performReconciliation(
@@ -303,6 +331,10 @@ ReconciliationResult ReconciliationEngine::performReconciliation(
         updateReconciliationSummary(reconciliationId, result);
     }
 
+    if (!dryRun && (result.cscaAdded > 0 || result.crlAdded > 0)) {
+        icao::trust::notifyTrustSnapshotChanged("reconciliation");
+    }
+
     spdlog::info("Reconciliation completed: {} processed, {} succeeded, {} failed ({}ms)",
                 result.totalProcessed, result.successCount, result.failedCount,
                 result.durationMs);
@@ -410,6 +442,7 @@ void ReconciliationEngine::updateReconciliationSummary(
 }
 
 void ReconciliationEngine::logReconciliationOperation(
+    common::BulkWriter& opLog,
     const std::string& reconciliationId,
     const std::string& operation,
     const std::string& certType,
@@ -418,31 +451,18 @@ void ReconciliationEngine::logReconciliationOperation(
     const std::string& errorMsg,
     int durationMs) const {
 
-    try {
-        // v2.0.5: Use cert_fingerprint instead of cert_id (UUID type incompatibility fix)
-        std::string query =
-            "INSERT INTO reconciliation_log "
-            "(summary_id, operation, certificate_type, fingerprint_sha256, "
-            "country_code, subject_dn, status, error_message, duration_ms) "
-            "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9)";
-
-        std::vector<std::string> params = {
-            reconciliationId,
-            operation,
-            certType,
-            cert.fingerprint,
-            cert.countryCode,
-            cert.subject,
-            status,
-            errorMsg,
-            std::to_string(durationMs)
-        };
-
-        queryExecutor_->executeCommand(query, params);
-
-    } catch (const std::exception& e) {
-        spdlog::warn("Failed to log reconciliation operation: {}", e.what());
-    }
+    // v2.0.5: Use cert_fingerprint instead of cert_id (UUID type incompatibility fix)
+    opLog.add({
+        reconciliationId,
+        operation,
+        certType,
+        cert.fingerprint,
+        cert.countryCode,
+        cert.subject,
+        status,
+        errorMsg,
+        std::to_string(durationMs)
+    });
 }
 
 /** @brief Find CRLs in DB that are missing from LDAP */
@@ -476,6 +496,10 @@ std::vector<CrlInfo> ReconciliationEngine::findMissingCrlsInLdap(
         }
         LDAP* ldRead = ldapConn.get();
 
+        std::vector<CrlInfo> candidates;
+        std::vector<std::string> dns;
+        candidates.reserve(rows.size());
+        dns.reserve(rows.size());
         for (const auto& row : rows) {
             CrlInfo crl;
             crl.id = row["id"].asString();
@@ -489,20 +513,19 @@ std::vector<CrlInfo> ReconciliationEngine::findMissingCrlsInLdap(
 
             // Build DN for LDAP existence check
             crl.ldapDn = ldapOps_->buildCrlDn(crl.countryCode, crl.fingerprint);
+            dns.push_back(crl.ldapDn);
+            candidates.push_back(std::move(crl));
+        }
 
-            // Check if CRL already exists in LDAP
-            LDAPMessage* searchRes = nullptr;
-            const char* attrs[] = {"dn", nullptr};
-            struct timeval timeout = {5, 0};
+        // Check if CRLs already exist in LDAP (pipelined base searches)
+        std::vector<int> rcs = ldapOps_->checkEntriesExist(ldRead, dns, config_.reconcileLdapWindow);
 
-            int rc = ldap_search_ext_s(ldRead, crl.ldapDn.c_str(), LDAP_SCOPE_BASE,
-                                  "(objectClass=*)", const_cast<char**>(attrs), 0,
-                                  nullptr, nullptr, &timeout, 0, &searchRes);
-            // Free immediately — we only need the return code for existence check
-            if (searchRes) ldap_msgfree(searchRes);
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            auto& crl = candidates[i];
+            int rc = rcs[i];
 
             if (rc == LDAP_NO_SUCH_OBJECT) {
-                result.push_back(crl);
+                result.push_back(std::move(crl));
 
                 if (result.size() >= static_cast<size_t>(limit)) {
                     break;
@@ -536,27 +559,29 @@ void ReconciliationEngine::processCrls(
 
     auto missingCrls = findMissingCrlsInLdap(config_.maxReconcileBatchSize);
 
-    for (const auto& crl : missingCrls) {
-        result.totalProcessed++;
-
-        auto opStartTime = std::chrono::steady_clock::now();
-        std::string errorMsg;
-        bool success = false;
-
-        if (dryRun) {
+    std::vector<LdapOpResult> outcomes;
+    if (dryRun) {
+        outcomes.resize(missingCrls.size());
+        for (size_t i = 0; i < missingCrls.size(); ++i) {
             spdlog::info("[DRY-RUN] Would add CRL to LDAP: {} ({})",
-                       crl.issuerDn, crl.ldapDn);
-            success = true;
-        } else {
-            success = ldapOps_->addCrl(ld, crl, errorMsg);
-            if (success) {
-                markCrlAsStoredInLdap(crl.id);
-            }
+                       missingCrls[i].issuerDn, missingCrls[i].ldapDn);
+            outcomes[i].success = true;
         }
+    } else {
+        outcomes = ldapOps_->addCrls(ld, missingCrls, config_.reconcileLdapWindow);
+    }
+
+    common::BulkWriter opLog(queryExecutor_, kReconciliationLogInsert);
+    std::vector<std::string> storedIds;
+
+    for (size_t i = 0; i < missingCrls.size(); ++i) {
+        const auto& crl = missingCrls[i];
+        const auto& outcome = outcomes[i];
+        result.totalProcessed++;
 
-        auto opEndTime = std::chrono::steady_clock::now();
-        int opDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
-            opEndTime - opStartTime).count();
+        if (outcome.success && !dryRun) {
+            storedIds.push_back(crl.id);
+        }
 
         // Log CRL reconciliation operation
         CertificateInfo crlAsInfo;
@@ -565,11 +590,11 @@ void ReconciliationEngine::processCrls(
         crlAsInfo.subject = crl.issuerDn;
         crlAsInfo.issuer = crl.issuerDn;
         crlAsInfo.fingerprint = crl.fingerprint;
-        logReconciliationOperation(
+        logReconciliationOperation(opLog,
             reconciliationId, "ADD", "CRL", crlAsInfo,
-            success ? "SUCCESS" : "FAILED", errorMsg, opDurationMs);
+            outcome.success ? "SUCCESS" : "FAILED", outcome.error, outcome.durationMs);
 
-        if (success) {
+        if (outcome.success) {
             result.successCount++;
             result.crlAdded++;
         } else {
@@ -581,13 +606,16 @@ void ReconciliationEngine::processCrls(
             failure.operation = "ADD";
             failure.countryCode = crl.countryCode;
             failure.subject = crl.issuerDn;
-            failure.error = errorMsg;
+            failure.error = outcome.error;
             result.failures.push_back(failure);
 
             spdlog::error("Failed to add CRL to LDAP: {} - {}",
-                        crl.issuerDn, errorMsg);
+                        crl.issuerDn, outcome.error);
         }
     }
+
+    markCrlAsStoredInLdap(storedIds);
+    opLog.flush();
 }
 
 } // namespace relay
@@ -12,6 +12,8 @@
 #include "sync/common/config.h"
 #include "ldap_operations.h"
 
+namespace common { class BulkWriter; }
+
 namespace icao {
 namespace relay {
 
@@ -51,6 +53,10 @@ public:
 private:
     /**
      * @brief Find certificates in DB that are missing in LDAP
+     *
+     * Existence is checked with pipelined asynchronous base searches
+     * (Config::reconcileLdapWindow in flight) on one pooled connection.
+     *
      * @param certType Certificate type filter
      * @param limit Maximum results
      * @return Vector of certificate information
@@ -67,11 +73,11 @@ private:
     std::vector<CrlInfo> findMissingCrlsInLdap(
         int limit) const;
 
-    /** @brief Mark certificate as stored in LDAP */
-    void markAsStoredInLdap(const std::string& certId) const;
+    /** @brief Mark certificates as stored in LDAP (one batched UPDATE) */
+    void markAsStoredInLdap(const std::vector<std::string>& certIds) const;
 
-    /** @brief Mark CRL as stored in LDAP */
-    void markCrlAsStoredInLdap(const std::string& crlId) const;
+    /** @brief Mark CRLs as stored in LDAP (one batched UPDATE) */
+    void markCrlAsStoredInLdap(const std::vector<std::string>& crlIds) const;
 
     /**
      * @brief Process certificates for a specific type
@@ -112,7 +118,9 @@ private:
         const std::string& reconciliationId,
         const ReconciliationResult& result) const;
 
+    /** @brief Stage a reconciliation_log row in opLog (flushed per certificate type) */
     void logReconciliationOperation(
+        common::BulkWriter& opLog,
         const std::string& reconciliationId,
         const std::string& operation,
         const std::string& certType,
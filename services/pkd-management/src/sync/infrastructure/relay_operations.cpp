@@ -18,10 +18,16 @@
 
 #include <spdlog/spdlog.h>
 #include <ldap.h>
+#include <algorithm>
 #include <cmath>
 #include <chrono>
+#include <ctime>
+#include <functional>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
+#include <string_view>
+#include <unordered_set>
 
 #include "../repositories/sync_status_repository.h"
 #include "../domain/models/sync_status.h"
@@ -119,92 +125,247 @@ icao::relay::DbStats getDbStats(common::IQueryExecutor* executor) {
 }
 
 // --- LDAP Statistics ---
-icao::relay::LdapStats getLdapStats(common::LdapConnectionPool* ldapPool,
-                                     const icao::relay::Config& config) {
+namespace {
+
+/// Clock skew tolerated between this host and the LDAP server for createTimestamp filters
+constexpr auto kCreateTimestampSkew = std::chrono::minutes(5);
+
+/**
+ * @brief Last full LDAP scan, reused by incremental sync checks
+ *
+ * takenAt is the scan start minus kCreateTimestampSkew. Entries created after
+ * takenAt that the full scan already counted are kept in countedSinceTakenAt
+ * so the incremental pass does not count them twice.
+ */
+struct LdapStatsSnapshot {
+    bool valid = false;
     icao::relay::LdapStats stats;
+    std::chrono::system_clock::time_point takenAt;
+    std::unordered_set<std::string> countedSinceTakenAt;
+};
+
+std::mutex g_ldapStatsMutex;  // Serializes scans and guards the snapshot
+LdapStatsSnapshot g_ldapStatsSnapshot;
+
+std::string toGeneralizedTime(std::chrono::system_clock::time_point tp) {
+    std::time_t t = std::chrono::system_clock::to_time_t(tp);
+    std::tm tm{};
+    gmtime_r(&t, &tm);
+    char buf[20];
+    std::strftime(buf, sizeof(buf), "%Y%m%d%H%M%SZ", &tm);
+    return buf;
+}
 
-    auto conn = ldapPool->acquire();
-    if (!conn.isValid()) {
-        spdlog::error("Failed to acquire LDAP connection from pool");
-        return stats;
+/**
+ * @brief Count one pkdDownload entry by its DN
+ *
+ * Walks the RDNs once: the first o= component gives the type, the first c=
+ * component the country. Link certificates (o=lc) count as CSCA; only CSCA,
+ * MLSC and DSC are broken down by country. Entries under nc-data are DSC_NC.
+ */
+void countLdapEntry(icao::relay::LdapStats& stats, std::string_view dn, bool ncData) {
+    if (ncData) {
+        stats.dscNcCount++;
+        return;
     }
 
-    LDAP* ld = conn.get();
-    spdlog::debug("Acquired LDAP connection from pool for statistics gathering");
+    std::string_view type;
+    std::string_view country;
+    size_t start = 0;
+    while (start < dn.size() && (type.empty() || country.empty())) {
+        size_t end = start;
+        while (end < dn.size() && dn[end] != ',') {
+            end += (dn[end] == '\\') ? 2 : 1;  // Skip escaped characters such as "\,"
+        }
+        std::string_view rdn = dn.substr(start, std::min(end, dn.size()) - start);
+        if (type.empty() && rdn.size() > 2 && rdn.substr(0, 2) == "o=") {
+            type = rdn.substr(2);
+        } else if (country.empty() && rdn.size() > 2 && rdn.substr(0, 2) == "c=") {
+            country = rdn.substr(2);
+        }
+        start = end + 1;
+    }
+
+    const char* countryKey = nullptr;
+    if (type == "csca") { stats.cscaCount++; countryKey = "csca"; }
+    else if (type == "mlsc") { stats.mlscCount++; countryKey = "mlsc"; }
+    else if (type == "lc") { stats.cscaCount++; }
+    else if (type == "dsc") { stats.dscCount++; countryKey = "dsc"; }
+    else if (type == "crl") { stats.crlCount++; }
+
+    if (countryKey && !country.empty()) {
+        stats.countryStats[std::string(country)][countryKey]++;
+    }
+}
 
-    int rc;
-    LDAPMessage* result = nullptr;
-    const char* attrs[] = {"dn", nullptr};
+/**
+ * @brief Run a subtree search page by page, handing each entry to onEntry
+ *
+ * Uses the RFC 2696 Simple Paged Results control (non-critical, so servers
+ * without paging return everything in one page) and reads results one message
+ * at a time, so at most one entry is held in memory.
+ *
+ * @return LDAP result code of the last page
+ */
+int pagedSearch(LDAP* ld, const std::string& base, const std::string& filter,
+                const char* const* attrs, int pageSize,
+                const std::function<void(LDAPMessage*)>& onEntry) {
     struct timeval timeout = {60, 0};
+    struct berval cookie = {0, nullptr};
+    int rc = LDAP_SUCCESS;
+
+    do {
+        LDAPControl* pageControl = nullptr;
+        rc = ldap_create_page_control(ld, pageSize, cookie.bv_val ? &cookie : nullptr, 0, &pageControl);
+        if (cookie.bv_val) {
+            ber_memfree(cookie.bv_val);
+            cookie = {0, nullptr};
+        }
+        if (rc != LDAP_SUCCESS) break;
+
+        LDAPControl* serverControls[] = {pageControl, nullptr};
+        int msgid = 0;
+        rc = ldap_search_ext(ld, base.c_str(), LDAP_SCOPE_SUBTREE, filter.c_str(),
+                             const_cast<char**>(attrs), 0, serverControls, nullptr,
+                             &timeout, LDAP_NO_LIMIT, &msgid);
+        ldap_control_free(pageControl);
+        if (rc != LDAP_SUCCESS) break;
+
+        bool pageDone = false;
+        while (!pageDone) {
+            LDAPMessage* msg = nullptr;
+            int type = ldap_result(ld, msgid, LDAP_MSG_ONE, &timeout, &msg);
+            if (type <= 0) {
+                rc = (type == 0) ? LDAP_TIMEOUT : LDAP_SERVER_DOWN;
+                if (type == 0) ldap_abandon_ext(ld, msgid, nullptr, nullptr);
+                if (msg) ldap_msgfree(msg);
+                return rc;
+            }
 
-    // Search under data container for certificates
-    std::string dataBase = config.ldapDataContainer + "," + config.ldapBaseDn;
-    spdlog::info("LDAP search base DN: {}", dataBase);
-    rc = ldap_search_ext_s(ld, dataBase.c_str(), LDAP_SCOPE_SUBTREE,
-                           "(objectClass=pkdDownload)", const_cast<char**>(attrs), 0,
-                           nullptr, nullptr, &timeout, 0, &result);
-
-    if (rc == LDAP_SUCCESS) {
-        int entryCount = result ? ldap_count_entries(ld, result) : 0;
-        spdlog::info("LDAP search successful, found {} entries", entryCount);
-        LDAPMessage* entry = ldap_first_entry(ld, result);
-        while (entry) {
-            char* dn = ldap_get_dn(ld, entry);
-            if (dn) {
-                std::string dnStr(dn);
-                // Count by OU type in DN
-                if (dnStr.find("o=csca,") != std::string::npos) {
-                    stats.cscaCount++;
-                } else if (dnStr.find("o=mlsc,") != std::string::npos) {
-                    stats.mlscCount++;
-                } else if (dnStr.find("o=lc,") != std::string::npos) {
-                    // Count Link Certificates as CSCA
-                    stats.cscaCount++;
-                } else if (dnStr.find("o=dsc,") != std::string::npos) {
-                    stats.dscCount++;
-                } else if (dnStr.find("o=crl,") != std::string::npos) {
-                    stats.crlCount++;
+            if (type == LDAP_RES_SEARCH_ENTRY) {
+                onEntry(msg);
+            } else if (type == LDAP_RES_SEARCH_RESULT) {
+                LDAPControl** responseControls = nullptr;
+                int parseRc = ldap_parse_result(ld, msg, &rc, nullptr, nullptr, nullptr, &responseControls, 0);
+                if (parseRc != LDAP_SUCCESS) rc = parseRc;
+                if (responseControls) {
+                    LDAPControl* pageResponse = ldap_control_find(LDAP_CONTROL_PAGEDRESULTS, responseControls, nullptr);
+                    ber_int_t estimate = 0;
+                    if (pageResponse) {
+                        ldap_parse_pageresponse_control(ld, pageResponse, &estimate, &cookie);
+                    }
+                    ldap_controls_free(responseControls);
                 }
+                pageDone = true;
+            }
+            ldap_msgfree(msg);
+        }
+    } while (rc == LDAP_SUCCESS && cookie.bv_val && cookie.bv_len > 0);
 
-                // Extract country from DN
-                size_t cPos = dnStr.find("c=");
-                if (cPos != std::string::npos) {
-                    size_t endPos = dnStr.find(",", cPos);
-                    std::string country = dnStr.substr(cPos + 2, endPos - cPos - 2);
-                    if (!country.empty()) {
-                        if (dnStr.find("o=csca,") != std::string::npos) {
-                            stats.countryStats[country]["csca"]++;
-                        } else if (dnStr.find("o=mlsc,") != std::string::npos) {
-                            stats.countryStats[country]["mlsc"]++;
-                        } else if (dnStr.find("o=dsc,") != std::string::npos) {
-                            stats.countryStats[country]["dsc"]++;
-                        }
+    if (cookie.bv_val) ber_memfree(cookie.bv_val);
+    return rc;
+}
+
+/**
+ * @brief Stream pkdDownload entries of one container into stats
+ * @param since GeneralizedTime of the snapshot (empty when not incremental)
+ * @param skip Incremental pass: DNs the snapshot already counted; only entries
+ *             with createTimestamp >= since are searched
+ * @param createdSince Full pass: collects DNs with createTimestamp >= since
+ * @return true if the search completed
+ */
+bool scanContainer(LDAP* ld, const std::string& base, bool ncData, int pageSize,
+                   const std::string& since,
+                   const std::unordered_set<std::string>* skip,
+                   std::unordered_set<std::string>* createdSince,
+                   icao::relay::LdapStats& stats) {
+    std::string filter = skip
+        ? "(&(objectClass=pkdDownload)(createTimestamp>=" + since + "))"
+        : "(objectClass=pkdDownload)";
+    // "1.1" = no attributes; the full pass of an incremental setup needs createTimestamp
+    const char* dnOnly[] = {"1.1", nullptr};
+    const char* withCreate[] = {"createTimestamp", nullptr};
+
+    int entries = 0;
+    int rc = pagedSearch(ld, base, filter, createdSince ? withCreate : dnOnly, pageSize,
+        [&](LDAPMessage* entry) {
+            char* dn = ldap_get_dn(ld, entry);
+            if (!dn) return;
+            std::string_view dnView(dn);
+            if (!skip || skip->find(std::string(dnView)) == skip->end()) {
+                countLdapEntry(stats, dnView, ncData);
+                entries++;
+                if (createdSince) {
+                    struct berval** values = ldap_get_values_len(ld, entry, "createTimestamp");
+                    // YYYYMMDDHHMMSS prefixes compare lexicographically (ignores fractions and zone)
+                    if (values && values[0] && values[0]->bv_len >= 14 &&
+                        std::string_view(values[0]->bv_val, 14) >= std::string_view(since).substr(0, 14)) {
+                        createdSince->emplace(dnView);
                     }
+                    if (values) ldap_value_free_len(values);
                 }
-
-                ldap_memfree(dn);
             }
-            entry = ldap_next_entry(ld, entry);
-        }
-    } else {
-        spdlog::error("LDAP search failed for dataBase: {}, error: {}", dataBase, ldap_err2string(rc));
+            ldap_memfree(dn);
+        });
+
+    if (rc != LDAP_SUCCESS) {
+        spdlog::error("LDAP search failed for {}: {}", base, ldap_err2string(rc));
+        return false;
     }
-    if (result) ldap_msgfree(result);
+    spdlog::info("LDAP search of {} counted {} entries", base, entries);
+    return true;
+}
+
+} // anonymous namespace
 
-    // Search under nc-data container for DSC_NC
+icao::relay::LdapStats getLdapStats(common::LdapConnectionPool* ldapPool,
+                                     const icao::relay::Config& config) {
+    icao::relay::LdapStats stats;
+
+    auto conn = ldapPool->acquire();
+    if (!conn.isValid()) {
+        spdlog::error("Failed to acquire LDAP connection from pool");
+        return stats;
+    }
+
+    LDAP* ld = conn.get();
+    spdlog::debug("Acquired LDAP connection from pool for statistics gathering");
+
+    std::string dataBase = config.ldapDataContainer + "," + config.ldapBaseDn;
     std::string ncDataBase = config.ldapNcDataContainer + "," + config.ldapBaseDn;
-    spdlog::info("LDAP search nc-data base DN: {}", ncDataBase);
-    rc = ldap_search_ext_s(ld, ncDataBase.c_str(), LDAP_SCOPE_SUBTREE,
-                           "(objectClass=pkdDownload)", const_cast<char**>(attrs), 0,
-                           nullptr, nullptr, &timeout, 0, &result);
-
-    if (rc == LDAP_SUCCESS) {
-        stats.dscNcCount = ldap_count_entries(ld, result);
-        spdlog::info("LDAP nc-data search successful, found {} entries", stats.dscNcCount);
+    int pageSize = config.ldapStatsPageSize > 0 ? config.ldapStatsPageSize : 1000;
+
+    std::lock_guard<std::mutex> lock(g_ldapStatsMutex);
+    auto now = std::chrono::system_clock::now();
+
+    if (!config.ldapStatsIncremental) {
+        g_ldapStatsSnapshot = LdapStatsSnapshot{};
+        spdlog::info("LDAP full scan (page size {}): {}, {}", pageSize, dataBase, ncDataBase);
+        scanContainer(ld, dataBase, false, pageSize, "", nullptr, nullptr, stats);
+        scanContainer(ld, ncDataBase, true, pageSize, "", nullptr, nullptr, stats);
+    } else if (g_ldapStatsSnapshot.valid &&
+               now - g_ldapStatsSnapshot.takenAt < std::chrono::minutes(config.ldapStatsFullRescanMinutes)) {
+        // Snapshot counts plus entries created since it was taken (deletions wait for the next full scan)
+        std::string since = toGeneralizedTime(g_ldapStatsSnapshot.takenAt);
+        spdlog::info("LDAP incremental scan: entries created since {}", since);
+        stats = g_ldapStatsSnapshot.stats;
+        const auto* skip = &g_ldapStatsSnapshot.countedSinceTakenAt;
+        bool ok = scanContainer(ld, dataBase, false, pageSize, since, skip, nullptr, stats) &&
+                  scanContainer(ld, ncDataBase, true, pageSize, since, skip, nullptr, stats);
+        if (!ok) g_ldapStatsSnapshot.valid = false;  // Next check rescans fully
     } else {
-        spdlog::error("LDAP search failed for ncDataBase: {}, error: {}", ncDataBase, ldap_err2string(rc));
+        LdapStatsSnapshot snapshot;
+        snapshot.takenAt = now - kCreateTimestampSkew;
+        std::string since = toGeneralizedTime(snapshot.takenAt);
+        spdlog::info("LDAP full scan for incremental snapshot (page size {})", pageSize);
+        bool ok = scanContainer(ld, dataBase, false, pageSize, since, nullptr, &snapshot.countedSinceTakenAt, stats) &&
+                  scanContainer(ld, ncDataBase, true, pageSize, since, nullptr, &snapshot.countedSinceTakenAt, stats);
+        if (ok) {
+            snapshot.valid = true;
+            snapshot.stats = stats;
+            g_ldapStatsSnapshot = std::move(snapshot);
+        }
     }
-    if (result) ldap_msgfree(result);
 
     stats.totalEntries = stats.cscaCount + stats.mlscCount + stats.dscCount +
                          stats.dscNcCount + stats.crlCount;
@@ -351,7 +512,8 @@ Json::Value getRevalidationHistory(common::IQueryExecutor* executor, int limit)
         std::string query = "SELECT id, executed_at, total_processed, newly_expired, newly_valid, "
             "unchanged, errors, duration_ms, "
             "tc_processed, tc_newly_valid, tc_still_pending, tc_errors, "
-            "crl_checked, crl_revoked, crl_unavailable, crl_expired, crl_errors "
+            "crl_checked, crl_revoked, crl_unavailable, crl_expired, crl_errors, run_mode, "
+            "expiry_duration_ms, tc_duration_ms, crl_duration_ms, workers "
             "FROM revalidation_history "
             "ORDER BY executed_at DESC " +
             common::db::limitClause(dbType, limit);
@@ -388,6 +550,17 @@ Json::Value getRevalidationHistory(common::IQueryExecutor* executor, int limit)
             item["crlUnavailable"] = getInt(row["crl_unavailable"]);
             item["crlExpired"] = getInt(row["crl_expired"]);
             item["crlErrors"] = getInt(row["crl_errors"]);
+            item["runMode"] = row.get("run_mode", "FULL").asString();
+
+            // Per-step wall time and throughput (DSCs per second)
+            int tcMs = getInt(row["tc_duration_ms"]);
+            int crlMs = getInt(row["crl_duration_ms"]);
+            item["workers"] = getInt(row["workers"], 1);
+            item["expiryDurationMs"] = getInt(row["expiry_duration_ms"]);
+            item["tcDurationMs"] = tcMs;
+            item["crlDurationMs"] = crlMs;
+            item["tcPerSecond"] = tcMs > 0 ? item["tcProcessed"].asInt() * 1000.0 / tcMs : 0.0;
+            item["crlPerSecond"] = crlMs > 0 ? item["crlChecked"].asInt() * 1000.0 / crlMs : 0.0;
 
             result.append(item);
         }
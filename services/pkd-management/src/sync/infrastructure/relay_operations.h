@@ -31,8 +31,15 @@ icao::relay::DbStats getDbStats(common::IQueryExecutor* executor);
 
 /**
  * @brief Get LDAP directory certificate/CRL statistics
+ *
+ * Streams the data and nc-data containers with paged searches (page size
+ * config.ldapStatsPageSize) and counts entries by DN. With
+ * config.ldapStatsIncremental, later checks reuse the last full scan and only
+ * search entries created since then, until the snapshot is older than
+ * config.ldapStatsFullRescanMinutes.
+ *
  * @param ldapPool LDAP connection pool
- * @param config Service configuration (for base DNs)
+ * @param config Service configuration (for base DNs and scan settings)
  * @return LDAP statistics (counts by type, country breakdown)
  */
 icao::relay::LdapStats getLdapStats(common::LdapConnectionPool* ldapPool,
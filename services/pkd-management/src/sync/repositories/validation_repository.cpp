@@ -6,10 +6,50 @@
 #include "query_helpers.h"
 #include <spdlog/spdlog.h>
 #include <json/json.h>
+#include <algorithm>
 #include <stdexcept>
 
 namespace icao::relay::repositories {
 
+namespace {
+
+/// "column IN ($k, $k+1, ...)" with the values appended to params
+std::string inList(const std::string& column, const std::set<std::string>& values,
+                   std::vector<std::string>& params) {
+    std::string clause = column + " IN (";
+    bool first = true;
+    for (const auto& value : values) {
+        params.push_back(value);
+        clause += (first ? "$" : ", $") + std::to_string(params.size());
+        first = false;
+    }
+    return clause + ")";
+}
+
+/// "($k, ..., $k+cols-1), (...)" for rows × cols placeholders starting at $1
+std::string valuesRows(size_t rows, size_t cols) {
+    std::string out;
+    size_t n = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        out += (r > 0 ? ", (" : "(");
+        for (size_t c = 0; c < cols; ++c) {
+            out += (c > 0 ? ", $" : "$") + std::to_string(++n);
+        }
+        out += ")";
+    }
+    return out;
+}
+
+int64_t toInt64(const Json::Value& value) {
+    if (value.isIntegral()) return value.asInt64();
+    if (value.isString()) {
+        try { return std::stoll(value.asString()); } catch (...) { return 0; }
+    }
+    return 0;
+}
+
+} // anonymous namespace
+
 ValidationRepository::ValidationRepository(common::IQueryExecutor* queryExecutor)
     : queryExecutor_(queryExecutor) {
     if (!queryExecutor_) {
@@ -198,14 +238,17 @@ bool ValidationRepository::saveRevalidationHistoryExtended(
     int totalProcessed, int newlyExpired, int newlyValid,
     int unchanged, int errors, int durationMs,
     int tcProcessed, int tcNewlyValid, int tcStillPending, int tcErrors,
-    int crlChecked, int crlRevoked, int crlUnavailable, int crlExpired, int crlErrors
+    int crlChecked, int crlRevoked, int crlUnavailable, int crlExpired, int crlErrors,
+    const std::string& runMode, const RevalidationTimings& timings
 ) {
     const char* query = R"(
         INSERT INTO revalidation_history
         (total_processed, newly_expired, newly_valid, unchanged, errors, duration_ms,
          tc_processed, tc_newly_valid, tc_still_pending, tc_errors,
-         crl_checked, crl_revoked, crl_unavailable, crl_expired, crl_errors)
-        VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15)
+         crl_checked, crl_revoked, crl_unavailable, crl_expired, crl_errors, run_mode,
+         expiry_duration_ms, tc_duration_ms, crl_duration_ms, workers)
+        VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16,
+                $17, $18, $19, $20)
     )";
 
     try {
@@ -217,15 +260,22 @@ bool ValidationRepository::saveRevalidationHistoryExtended(
             std::to_string(tcStillPending), std::to_string(tcErrors),
             std::to_string(crlChecked), std::to_string(crlRevoked),
             std::to_string(crlUnavailable), std::to_string(crlExpired),
-            std::to_string(crlErrors)
+            std::to_string(crlErrors), runMode,
+            std::to_string(timings.expiryMs), std::to_string(timings.trustChainMs),
+            std::to_string(timings.crlMs), std::to_string(timings.workers)
         };
 
+        auto perSecond = [](int count, int ms) { return ms > 0 ? count * 1000.0 / ms : 0.0; };
+
         int rowsAffected = queryExecutor_->executeCommand(query, params);
         if (rowsAffected > 0) {
-            spdlog::info("[ValidationRepository] Saved extended revalidation history: "
-                        "{} processed, TC({}/{}/{}), CRL({}/{}/{}/{})",
-                        totalProcessed, tcProcessed, tcNewlyValid, tcStillPending,
-                        crlChecked, crlRevoked, crlUnavailable, crlExpired);
+            spdlog::info("[ValidationRepository] Saved extended revalidation history ({}, {} workers): "
+                        "{} processed in {}ms, TC({}/{}/{}) in {}ms ({:.0f}/s), CRL({}/{}/{}/{}) in {}ms ({:.0f}/s)",
+                        runMode, timings.workers, totalProcessed, timings.expiryMs,
+                        tcProcessed, tcNewlyValid, tcStillPending, timings.trustChainMs,
+                        perSecond(tcProcessed, timings.trustChainMs),
+                        crlChecked, crlRevoked, crlUnavailable, crlExpired, timings.crlMs,
+                        perSecond(crlChecked, timings.crlMs));
             return true;
         }
         return false;
@@ -235,56 +285,180 @@ bool ValidationRepository::saveRevalidationHistoryExtended(
     }
 }
 
-Json::Value ValidationRepository::findDscsForTrustChainRevalidation() {
+bool ValidationRepository::hasFullRevalidationWithin(int hours) {
     try {
         std::string dbType = queryExecutor_->getDatabaseType();
-        std::string falseVal = common::db::boolLiteral(dbType, false);
+        std::string query =
+            "SELECT COUNT(*) FROM revalidation_history "
+            "WHERE run_mode = 'FULL' AND executed_at > " +
+            common::db::currentTimestamp(dbType) + " - " + common::db::intervalHours(dbType, hours);
+        return common::db::scalarToInt(queryExecutor_->executeScalar(query, {})) > 0;
+    } catch (const std::exception& e) {
+        spdlog::warn("[ValidationRepository] hasFullRevalidationWithin failed: {}", e.what());
+        return false;
+    }
+}
+
+std::optional<RevalidationChanges> ValidationRepository::findRevalidationChanges() {
+    try {
+        Json::Value rows = queryExecutor_->executeQuery(
+            "SELECT id, change_type, country_code, subject_dn, subject_key_identifier "
+            "FROM revalidation_change_journal ORDER BY id", {});
+
+        RevalidationChanges changes;
+        for (const auto& row : rows) {
+            changes.entries++;
+            changes.journalIds.push_back(toInt64(row["id"]));
+
+            std::string changeType = row.get("change_type", "").asString();
+            std::string countryCode = row.get("country_code", "").asString();
+            if (changeType == "CRL") {
+                if (!countryCode.empty()) changes.crlCountries.insert(countryCode);
+                continue;
+            }
+            // CSCA or LC
+            std::string subjectDn = row.get("subject_dn", "").asString();
+            std::string ski = row.get("subject_key_identifier", "").asString();
+            if (!countryCode.empty()) changes.issuerCountries.insert(countryCode);
+            if (!subjectDn.empty()) changes.issuerDns.insert(subjectDn);
+            if (!ski.empty()) changes.issuerSkis.insert(ski);
+        }
+        return changes;
+    } catch (const std::exception& e) {
+        spdlog::warn("[ValidationRepository] Revalidation change journal unavailable: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+int ValidationRepository::deleteRevalidationChanges(const std::vector<int64_t>& journalIds) {
+    try {
+        int deleted = 0;
+        size_t first = 0;
+        for (size_t count : common::db::bucketedChunkSizes(journalIds.size(), kStatusUpdateChunk)) {
+            std::vector<std::string> params;
+            params.reserve(count);
+            std::string query = "DELETE FROM revalidation_change_journal WHERE id IN (";
+            for (size_t i = first; i < first + count; ++i) {
+                params.push_back(std::to_string(journalIds[i]));
+                query += (i > first ? ", $" : "$") + std::to_string(params.size());
+            }
+            deleted += queryExecutor_->executeCommand(query + ")", params);
+            first += count;
+        }
+        return deleted;
+    } catch (const std::exception& e) {
+        spdlog::error("[ValidationRepository] deleteRevalidationChanges failed: {}", e.what());
+        return -1;
+    }
+}
+
+std::vector<DscRevalidationRow> ValidationRepository::findDscsForTrustChainRevalidation() {
+    return queryDscRevalidationRows("", {});
+}
+
+std::vector<DscRevalidationRow> ValidationRepository::findDscsForTrustChainRevalidation(
+    const RevalidationChanges& changes
+) {
+    if (!changes.hasIssuerChanges()) return {};
+
+    // Country covers chains through existing link certificates; DN and AKI
+    // catch DSCs filed under a different country code than their issuer
+    std::vector<std::string> params;
+    std::vector<std::string> terms;
+    if (!changes.issuerCountries.empty()) terms.push_back(inList("vr.country_code", changes.issuerCountries, params));
+    if (!changes.issuerDns.empty()) terms.push_back(inList("c.issuer_dn", changes.issuerDns, params));
+    if (!changes.issuerSkis.empty()) terms.push_back(inList("c.authority_key_identifier", changes.issuerSkis, params));
+
+    std::string filter = "AND (";
+    for (size_t i = 0; i < terms.size(); ++i) {
+        filter += (i > 0 ? " OR " : "") + terms[i];
+    }
+    filter += ")";
+    return queryDscRevalidationRows(filter, params);
+}
 
-        // Oracle: RAWTOHEX+DBMS_LOB for BLOB, TO_CHAR for issuer_dn CLOB
-        std::string certDataExpr = (dbType == "oracle")
-            ? "RAWTOHEX(DBMS_LOB.SUBSTR(c.certificate_data, DBMS_LOB.GETLENGTH(c.certificate_data), 1)) as certificate_data"
-            : "c.certificate_data";
-        std::string issuerDnExpr = (dbType == "oracle")
-            ? "TO_CHAR(c.issuer_dn) as issuer_dn"
-            : "c.issuer_dn";
+std::vector<DscRevalidationRow> ValidationRepository::queryDscRevalidationRows(
+    const std::string& scopeFilter, const std::vector<std::string>& params
+) {
+    try {
+        std::string dbType = queryExecutor_->getDatabaseType();
+        std::string falseVal = common::db::boolLiteral(dbType, false);
 
         std::string query =
-            "SELECT vr.id, vr.certificate_id, vr.country_code, " + certDataExpr + ", " + issuerDnExpr + " "
+            "SELECT vr.id, vr.certificate_id, vr.country_code, c.certificate_data, c.issuer_dn "
             "FROM validation_result vr "
             "JOIN certificate c ON vr.certificate_id = c.id "
             "WHERE c.certificate_type = 'DSC' "
             "AND vr.csca_found = " + falseVal + " "
-            "AND vr.validation_status IN ('PENDING', 'INVALID')";
+            "AND vr.validation_status IN ('PENDING', 'INVALID') " + scopeFilter;
 
-        return queryExecutor_->executeQuery(query, {});
+        return readDscRows(query, params);
     } catch (const std::exception& e) {
         spdlog::error("[ValidationRepository] findDscsForTrustChainRevalidation failed: {}", e.what());
-        return Json::Value(Json::arrayValue);
+        throw;
     }
 }
 
-Json::Value ValidationRepository::findDscsForCrlRecheck() {
-    try {
-        std::string dbType = queryExecutor_->getDatabaseType();
+std::vector<DscRevalidationRow> ValidationRepository::findDscsForCrlRecheck() {
+    return queryDscsForCrlRecheck("", {});
+}
 
-        std::string certDataExpr = (dbType == "oracle")
-            ? "RAWTOHEX(DBMS_LOB.SUBSTR(c.certificate_data, DBMS_LOB.GETLENGTH(c.certificate_data), 1)) as certificate_data"
-            : "c.certificate_data";
+std::vector<DscRevalidationRow> ValidationRepository::findDscsForCrlRecheck(
+    const std::set<std::string>& countryCodes
+) {
+    if (countryCodes.empty()) return {};
+    std::vector<std::string> params;
+    std::string filter = "AND " + inList("vr.country_code", countryCodes, params);
+    return queryDscsForCrlRecheck(filter, params);
+}
 
+std::vector<DscRevalidationRow> ValidationRepository::queryDscsForCrlRecheck(
+    const std::string& scopeFilter, const std::vector<std::string>& params
+) {
+    try {
         std::string query =
-            "SELECT vr.id, vr.certificate_id, vr.country_code, " + certDataExpr + " "
+            "SELECT vr.id, vr.certificate_id, vr.country_code, c.certificate_data "
             "FROM validation_result vr "
             "JOIN certificate c ON vr.certificate_id = c.id "
             "WHERE c.certificate_type = 'DSC' "
-            "AND vr.validation_status IN ('VALID', 'EXPIRED_VALID')";
+            "AND vr.validation_status IN ('VALID', 'EXPIRED_VALID') " + scopeFilter;
 
-        return queryExecutor_->executeQuery(query, {});
+        return readDscRows(query, params);
     } catch (const std::exception& e) {
         spdlog::error("[ValidationRepository] findDscsForCrlRecheck failed: {}", e.what());
-        return Json::Value(Json::arrayValue);
+        throw;
     }
 }
 
+std::vector<DscRevalidationRow> ValidationRepository::readDscRows(
+    const std::string& query, const std::vector<std::string>& params
+) {
+    std::vector<DscRevalidationRow> result;
+    queryExecutor_->executeQueryRows(query, params, [&](common::RowCursor& rows) {
+        int idCol = rows.columnIndex("id");
+        int certIdCol = rows.columnIndex("certificate_id");
+        int countryCol = rows.columnIndex("country_code");
+        int dataCol = rows.columnIndex("certificate_data");
+        int issuerCol = rows.columnIndex("issuer_dn");  // -1 (empty) when not selected
+
+        while (rows.next()) {
+            DscRevalidationRow row;
+            row.id = rows.getString(idCol);
+            row.certificateId = rows.getString(certIdCol);
+            row.countryCode = rows.getString(countryCol);
+            row.issuerDn = rows.getString(issuerCol);
+
+            common::ByteSpan der = rows.getBytes(dataCol);
+            row.certificateDer = common::unwrapDoubleEncodedBytea(der);
+            if (row.certificateDer.empty()) {
+                row.certificateDer.assign(der.begin(), der.end());
+            }
+            result.push_back(std::move(row));
+        }
+    });
+    return result;
+}
+
 bool ValidationRepository::updateTrustChainStatus(
     const std::string& id, const std::string& newStatus,
     bool cscaFound, const std::string& trustChainMessage
@@ -327,4 +501,91 @@ bool ValidationRepository::updateCrlStatus(
     }
 }
 
+int ValidationRepository::updateTrustChainStatusBatch(const std::vector<TrustChainStatusUpdate>& updates) {
+    if (updates.empty()) return 0;
+
+    std::string dbType = queryExecutor_->getDatabaseType();
+    int updated = 0;
+    size_t first = 0;
+    for (size_t count : common::db::bucketedChunkSizes(updates.size(), kStatusUpdateChunk)) {
+        try {
+            if (dbType == "oracle") {
+                std::vector<std::vector<std::string>> rows;
+                rows.reserve(count);
+                for (size_t i = first; i < first + count; ++i) {
+                    const auto& u = updates[i];
+                    rows.push_back({u.status, common::db::boolLiteral(dbType, u.cscaFound), u.message, u.id});
+                }
+                updated += queryExecutor_->executeBatch(
+                    "UPDATE validation_result "
+                    "SET validation_status = $1, csca_found = $2, trust_chain_message = $3 "
+                    "WHERE id = $4", rows);
+            } else {
+                std::vector<std::string> params;
+                params.reserve(count * 4);
+                for (size_t i = first; i < first + count; ++i) {
+                    const auto& u = updates[i];
+                    params.push_back(u.id);
+                    params.push_back(u.status);
+                    params.push_back(common::db::boolLiteral(dbType, u.cscaFound));
+                    params.push_back(u.message);
+                }
+                updated += queryExecutor_->executeCommand(
+                    "UPDATE validation_result vr "
+                    "SET validation_status = v.status, csca_found = v.csca_found::boolean, "
+                    "trust_chain_message = v.message "
+                    "FROM (VALUES " + valuesRows(count, 4) + ") AS v(id, status, csca_found, message) "
+                    "WHERE vr.id = v.id::uuid", params);
+            }
+        } catch (const std::exception& e) {
+            spdlog::error("[ValidationRepository] updateTrustChainStatusBatch failed for {} rows: {}", count, e.what());
+        }
+        first += count;
+    }
+    return updated;
+}
+
+int ValidationRepository::updateCrlStatusBatch(const std::vector<CrlStatusUpdate>& updates) {
+    if (updates.empty()) return 0;
+
+    std::string dbType = queryExecutor_->getDatabaseType();
+    int updated = 0;
+    size_t first = 0;
+    for (size_t count : common::db::bucketedChunkSizes(updates.size(), kStatusUpdateChunk)) {
+        try {
+            if (dbType == "oracle") {
+                std::vector<std::vector<std::string>> rows;
+                rows.reserve(count);
+                for (size_t i = first; i < first + count; ++i) {
+                    const auto& u = updates[i];
+                    rows.push_back({u.status, u.message, u.id});
+                }
+                updated += queryExecutor_->executeBatch(
+                    "UPDATE validation_result "
+                    "SET validation_status = $1, trust_chain_message = COALESCE(trust_chain_message, '') || ' | CRL: ' || $2 "
+                    "WHERE id = $3", rows);
+            } else {
+                std::vector<std::string> params;
+                params.reserve(count * 3);
+                for (size_t i = first; i < first + count; ++i) {
+                    const auto& u = updates[i];
+                    params.push_back(u.id);
+                    params.push_back(u.status);
+                    params.push_back(u.message);
+                }
+                updated += queryExecutor_->executeCommand(
+                    "UPDATE validation_result vr "
+                    "SET validation_status = v.status, "
+                    "trust_chain_message = COALESCE(vr.trust_chain_message, '') || ' | CRL: ' || v.message "
+                    "FROM (VALUES " + valuesRows(count, 3) + ") AS v(id, status, message) "
+                    "WHERE vr.id = v.id::uuid", params);
+            }
+        } catch (const std::exception& e) {
+            spdlog::error("[ValidationRepository] updateCrlStatusBatch failed for {} rows: {}", count, e.what());
+        }
+        first += count;
+    }
+    return updated;
+}
+
 } // namespace icao::relay::repositories
@@ -6,12 +6,74 @@
 
 #include "../domain/models/validation_result.h"
 #include "i_query_executor.h"
+#include <cstdint>
 #include <memory>
+#include <set>
 #include <vector>
 #include <optional>
 
 namespace icao::relay::repositories {
 
+/**
+ * @brief DSC row for trust chain re-validation / CRL re-check (raw DER, no JSON/hex)
+ */
+struct DscRevalidationRow {
+    std::string id;             ///< validation_result.id
+    std::string certificateId;
+    std::string countryCode;
+    std::string issuerDn;       ///< Empty for CRL re-check rows
+    std::vector<uint8_t> certificateDer;
+};
+
+/**
+ * @brief CSCA / link certificate / CRL inserts not yet covered by a revalidation run
+ *
+ * Read from revalidation_change_journal (filled by insert triggers). A DSC is
+ * affected by an issuer change if its country, issuer DN or AKI matches a new
+ * CSCA/link certificate; by a CRL change if its country has a new CRL.
+ */
+struct RevalidationChanges {
+    std::vector<int64_t> journalIds;        ///< Ids of the journal rows read
+    int entries = 0;                        ///< Journal rows read
+    std::set<std::string> issuerCountries;  ///< Countries with new CSCAs/link certificates
+    std::set<std::string> issuerDns;        ///< Subject DNs of new CSCAs/link certificates
+    std::set<std::string> issuerSkis;       ///< Subject Key Identifiers of new CSCAs/link certificates
+    std::set<std::string> crlCountries;     ///< Countries with new CRLs
+
+    bool hasIssuerChanges() const {
+        return !issuerCountries.empty() || !issuerDns.empty() || !issuerSkis.empty();
+    }
+};
+
+/**
+ * @brief Trust chain status change collected by revalidation workers
+ */
+struct TrustChainStatusUpdate {
+    std::string id;             ///< validation_result.id
+    std::string status;         ///< VALID / EXPIRED_VALID
+    bool cscaFound = true;
+    std::string message;        ///< trust_chain_message
+};
+
+/**
+ * @brief CRL status change collected by revalidation workers
+ */
+struct CrlStatusUpdate {
+    std::string id;             ///< validation_result.id
+    std::string status;         ///< INVALID (revoked)
+    std::string message;        ///< Appended to trust_chain_message as " | CRL: <message>"
+};
+
+/**
+ * @brief Per-step wall time of a revalidation run (revalidation_history)
+ */
+struct RevalidationTimings {
+    int expiryMs = 0;           ///< Step 1
+    int trustChainMs = 0;       ///< Step 2
+    int crlMs = 0;              ///< Step 3
+    int workers = 1;            ///< Worker threads used by steps 2 and 3
+};
+
 /**
  * @brief Repository for certificate validation operations
  *
@@ -75,27 +137,69 @@ public:
 
     /**
      * @brief Save extended revalidation history with trust chain and CRL results
+     * @param runMode "FULL" or "INCREMENTAL"
+     * @param timings Per-step wall time and worker count (throughput is logged)
      */
     bool saveRevalidationHistoryExtended(
         int totalProcessed, int newlyExpired, int newlyValid,
         int unchanged, int errors, int durationMs,
         int tcProcessed, int tcNewlyValid, int tcStillPending, int tcErrors,
-        int crlChecked, int crlRevoked, int crlUnavailable, int crlExpired, int crlErrors
+        int crlChecked, int crlRevoked, int crlUnavailable, int crlExpired, int crlErrors,
+        const std::string& runMode = "FULL",
+        const RevalidationTimings& timings = {}
     );
 
+    /**
+     * @brief True if a FULL revalidation run was recorded within the last @p hours
+     * @return False on query failure (caller runs a full sweep)
+     */
+    bool hasFullRevalidationWithin(int hours);
+
+    /**
+     * @brief Read all pending entries of revalidation_change_journal
+     * @return std::nullopt if the journal cannot be read (e.g. table missing)
+     */
+    std::optional<RevalidationChanges> findRevalidationChanges();
+
+    /**
+     * @brief Delete the journal entries consumed by a run (exactly journalIds)
+     *
+     * Rows not seen by findRevalidationChanges(), including ones with a lower
+     * id that committed after the read, stay for the next run.
+     * @return Number of rows deleted (-1 on failure)
+     */
+    int deleteRevalidationChanges(const std::vector<int64_t>& journalIds);
+
     /**
      * @brief Find DSCs for trust chain re-validation
      * Returns DSC validation_result rows where csca_found = FALSE (PENDING/INVALID)
-     * @return JSON array with id, certificate_id, country_code, certificate_data
+     * Read through the binary row cursor; certificate_data is returned as DER.
+     * @return Rows with id, certificate_id, country_code, issuer_dn, certificate DER
+     * @throws std::exception if the query fails
+     */
+    std::vector<DscRevalidationRow> findDscsForTrustChainRevalidation();
+
+    /**
+     * @brief Trust chain re-validation candidates affected by issuer changes
+     *
+     * Same rows as findDscsForTrustChainRevalidation(), limited to DSCs whose
+     * country, issuer DN or AKI matches a changed CSCA/link certificate.
      */
-    Json::Value findDscsForTrustChainRevalidation();
+    std::vector<DscRevalidationRow> findDscsForTrustChainRevalidation(const RevalidationChanges& changes);
 
     /**
      * @brief Find DSCs for CRL re-check
-     * Returns VALID/EXPIRED_VALID DSC validation_result rows
-     * @return JSON array with id, certificate_id, country_code, certificate_data
+     * Returns VALID/EXPIRED_VALID DSC validation_result rows, read through the
+     * binary row cursor like findDscsForTrustChainRevalidation().
+     * @return Rows with id, certificate_id, country_code, certificate DER
+     * @throws std::exception if the query fails
      */
-    Json::Value findDscsForCrlRecheck();
+    std::vector<DscRevalidationRow> findDscsForCrlRecheck();
+
+    /**
+     * @brief CRL re-check candidates limited to the given countries
+     */
+    std::vector<DscRevalidationRow> findDscsForCrlRecheck(const std::set<std::string>& countryCodes);
 
     /**
      * @brief Update trust chain status after re-validation
@@ -109,8 +213,35 @@ public:
     bool updateCrlStatus(const std::string& id, const std::string& newStatus,
                           const std::string& crlMessage);
 
+    /**
+     * @brief Apply trust chain status changes in bulk
+     *
+     * PostgreSQL: UPDATE ... FROM (VALUES ...) per chunk of kStatusUpdateChunk rows;
+     * the remainder is split by bucketedChunkSizes() to keep statement shapes few.
+     * Oracle: the single-row UPDATE sent as OCI array DML (one execute per chunk).
+     * A failing chunk is logged and the remaining chunks are still applied.
+     * @return Number of rows updated
+     */
+    int updateTrustChainStatusBatch(const std::vector<TrustChainStatusUpdate>& updates);
+
+    /**
+     * @brief Apply CRL status changes in bulk (same strategy as updateTrustChainStatusBatch)
+     * @return Number of rows updated
+     */
+    int updateCrlStatusBatch(const std::vector<CrlStatusUpdate>& updates);
+
+    /// Rows per bulk status UPDATE statement
+    static constexpr size_t kStatusUpdateChunk = 500;
+
 private:
     common::IQueryExecutor* queryExecutor_;
+
+    std::vector<DscRevalidationRow> queryDscRevalidationRows(const std::string& scopeFilter,
+                                                             const std::vector<std::string>& params);
+    std::vector<DscRevalidationRow> queryDscsForCrlRecheck(const std::string& scopeFilter,
+                                                           const std::vector<std::string>& params);
+    std::vector<DscRevalidationRow> readDscRows(const std::string& query,
+                                                const std::vector<std::string>& params);
 };
 
 } // namespace icao::relay::repositories
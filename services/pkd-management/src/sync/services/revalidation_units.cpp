@@ -0,0 +1,63 @@
+/**
+ * @file revalidation_units.cpp
+ * @brief Work partitioning for the parallel revalidation steps
+ */
+#include "revalidation_units.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <system_error>
+#include <thread>
+
+namespace icao::relay::services {
+
+std::vector<std::vector<size_t>> partitionByCountry(
+    size_t count, const std::function<std::string(size_t)>& countryOf, int workers)
+{
+    std::map<std::string, std::vector<size_t>> byCountry;
+    for (size_t i = 0; i < count; ++i) {
+        byCountry[countryOf(i)].push_back(i);
+    }
+
+    size_t workerCount = static_cast<size_t>(std::max(workers, 1));
+    size_t maxUnit = std::max(kMinUnitRows, count / (workerCount * 4) + 1);
+    std::vector<std::vector<size_t>> units;
+    for (auto& [country, rows] : byCountry) {
+        for (size_t first = 0; first < rows.size(); first += maxUnit) {
+            size_t last = std::min(rows.size(), first + maxUnit);
+            units.emplace_back(rows.begin() + first, rows.begin() + last);
+        }
+    }
+    std::stable_sort(units.begin(), units.end(),
+                     [](const auto& a, const auto& b) { return a.size() > b.size(); });
+    return units;
+}
+
+void forEachUnit(size_t units, int workers, const std::function<void(size_t)>& fn) {
+    std::atomic<size_t> next{0};
+    auto drain = [&]() {
+        for (size_t u = next.fetch_add(1); u < units; u = next.fetch_add(1)) {
+            fn(u);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    size_t extra = std::min(units, static_cast<size_t>(std::max(workers, 1)));
+    extra = extra > 0 ? extra - 1 : 0;
+    for (size_t t = 0; t < extra; ++t) {
+        try {
+            threads.emplace_back(drain);
+        } catch (const std::system_error& e) {
+            spdlog::warn("[ValidationService] Could not start revalidation worker: {}", e.what());
+            break;
+        }
+    }
+    drain();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace icao::relay::services
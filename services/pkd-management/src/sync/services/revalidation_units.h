@@ -0,0 +1,39 @@
+/**
+ * @file revalidation_units.h
+ * @brief Work partitioning for the parallel revalidation steps (trust chain, CRL)
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace icao::relay::services {
+
+/// Smallest work unit a large country is split into
+constexpr size_t kMinUnitRows = 64;
+
+/**
+ * @brief Group row indexes by country into work units, largest first
+ *
+ * Keeping a country together lets one worker reuse its CRL and issuer CSCAs;
+ * countries larger than max(kMinUnitRows, count / (workers * 4) + 1) rows are
+ * split so a single country cannot leave the other workers idle.
+ *
+ * @param count Number of rows
+ * @param countryOf Country code of row i
+ * @param workers Worker count the units are sized for (>= 1)
+ */
+std::vector<std::vector<size_t>> partitionByCountry(
+    size_t count, const std::function<std::string(size_t)>& countryOf, int workers);
+
+/**
+ * @brief Run fn(unit) for every unit on up to @p workers threads
+ *
+ * The calling thread is one of the workers, so workers == 1 (or a failed
+ * thread start) still processes every unit. fn must not throw.
+ */
+void forEachUnit(size_t units, int workers, const std::function<void(size_t)>& fn);
+
+} // namespace icao::relay::services
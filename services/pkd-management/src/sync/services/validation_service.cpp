@@ -7,6 +7,7 @@
  * Step 3: CRL re-check for VALID/EXPIRED_VALID DSCs
  */
 #include "validation_service.h"
+#include "revalidation_units.h"
 #include "../adapters/relay_csca_provider.h"
 #include "../adapters/relay_crl_provider.h"
 
@@ -17,11 +18,22 @@
 
 #include <spdlog/spdlog.h>
 #include <openssl/x509.h>
+#include <algorithm>
 #include <chrono>
+#include <optional>
 #include <stdexcept>
 
 namespace icao::relay::services {
 
+namespace {
+
+int elapsedMs(std::chrono::steady_clock::time_point since) {
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - since).count());
+}
+
+} // anonymous namespace
+
 ValidationService::ValidationService(
     repositories::ValidationRepository* validationRepo,
     repositories::CertificateRepository* certRepo,
@@ -46,7 +58,6 @@ ValidationService::ValidationService(
     auto crlProv = std::make_unique<adapters::RelayCrlProvider>(crlRepo_);
 
     trustChainBuilder_ = std::make_unique<icao::validation::TrustChainBuilder>(cscaProv.get());
-    crlChecker_ = std::make_unique<icao::validation::CrlChecker>(crlProv.get());
 
     // Transfer ownership
     cscaProvider_ = std::move(cscaProv);
@@ -67,164 +78,240 @@ std::string ValidationService::determineValidationStatus(bool isExpired, const s
     return "PENDING";
 }
 
-std::vector<uint8_t> ValidationService::decodeHexToDer(const std::string& hexData) {
-    std::vector<uint8_t> derBytes;
-    size_t hexStart = 0;
-
-    if (hexData.size() > 2 && hexData[0] == '\\' && hexData[1] == 'x') {
-        hexStart = 2;
-    }
-
-    derBytes.reserve((hexData.size() - hexStart) / 2);
-    for (size_t i = hexStart; i + 1 < hexData.size(); i += 2) {
-        char h[3] = {hexData[i], hexData[i + 1], 0};
-        derBytes.push_back(static_cast<uint8_t>(strtol(h, nullptr, 16)));
-    }
-
-    // Handle double-encoded BYTEA
-    if (derBytes.size() > 2 && derBytes[0] == 0x5C && derBytes[1] == 0x78) {
-        std::vector<uint8_t> innerBytes;
-        innerBytes.reserve((derBytes.size() - 2) / 2);
-        for (size_t i = 2; i + 1 < derBytes.size(); i += 2) {
-            char h[3] = {static_cast<char>(derBytes[i]), static_cast<char>(derBytes[i + 1]), 0};
-            innerBytes.push_back(static_cast<uint8_t>(strtol(h, nullptr, 16)));
-        }
-        derBytes = std::move(innerBytes);
-    }
-
-    return derBytes;
-}
-
-Json::Value ValidationService::revalidateTrustChains() {
+Json::Value ValidationService::revalidateTrustChains(
+    const repositories::RevalidationChanges* changes,
+    std::set<std::string>* newlyValidCountries
+) {
     Json::Value result;
-    int tcProcessed = 0, tcNewlyValid = 0, tcStillPending = 0, tcErrors = 0;
+    int tcProcessed = 0, tcNewlyValid = 0, tcStillPending = 0, tcErrors = 0, tcTransientErrors = 0;
 
     try {
+        if (changes && !changes->hasIssuerChanges()) {
+            spdlog::info("[ValidationService] Step 2: no CSCA/link certificate changes — skipped");
+            result["tcProcessed"] = 0;
+            result["tcNewlyValid"] = 0;
+            result["tcStillPending"] = 0;
+            result["tcErrors"] = 0;
+            result["tcTransientErrors"] = 0;
+            return result;
+        }
+
         // Preload CSCA cache
         auto* cscaProv = dynamic_cast<adapters::RelayCscaProvider*>(cscaProvider_.get());
         if (cscaProv) {
             cscaProv->preloadAllCscas();
         }
 
-        Json::Value dscs = validationRepo_->findDscsForTrustChainRevalidation();
-        spdlog::info("[ValidationService] Step 2: Trust Chain re-validation — {} DSCs to process", dscs.size());
-
-        for (const auto& dsc : dscs) {
-            try {
-                std::string id = dsc["id"].asString();
-                std::string certDataHex = dsc.get("certificate_data", "").asString();
-
-                if (certDataHex.empty()) {
-                    tcErrors++;
-                    continue;
-                }
-
-                std::vector<uint8_t> derBytes = decodeHexToDer(certDataHex);
-                if (derBytes.empty()) {
-                    tcErrors++;
-                    continue;
-                }
+        auto dscs = changes ? validationRepo_->findDscsForTrustChainRevalidation(*changes)
+                            : validationRepo_->findDscsForTrustChainRevalidation();
+        auto units = partitionByCountry(dscs.size(),
+                                        [&dscs](size_t i) { return dscs[i].countryCode; }, parallelism_);
+        spdlog::info("[ValidationService] Step 2: Trust Chain re-validation — {} DSCs to process "
+                     "({} units, {} workers)", dscs.size(), units.size(), parallelism_);
+
+        // Each unit is handled by exactly one worker and only touches its own tally.
+        // transient counts the errors a retry can fix (a lookup that threw), as
+        // opposed to DSCs that will never parse.
+        struct Tally {
+            int processed = 0, newlyValid = 0, stillPending = 0, errors = 0, transient = 0;
+            std::vector<repositories::TrustChainStatusUpdate> updates;
+        };
+        std::vector<Tally> tallies(units.size());
+
+        forEachUnit(units.size(), parallelism_, [&](size_t u) {
+            Tally& tally = tallies[u];
+            for (size_t index : units[u]) {
+                const auto& dsc = dscs[index];
+                try {
+                    if (dsc.certificateDer.empty()) {
+                        tally.errors++;
+                        continue;
+                    }
 
-                const unsigned char* p = derBytes.data();
-                X509* cert = d2i_X509(nullptr, &p, static_cast<long>(derBytes.size()));
-                if (!cert) {
-                    tcErrors++;
-                    continue;
-                }
+                    const unsigned char* p = dsc.certificateDer.data();
+                    X509* cert = d2i_X509(nullptr, &p, static_cast<long>(dsc.certificateDer.size()));
+                    if (!cert) {
+                        tally.errors++;
+                        continue;
+                    }
 
-                tcProcessed++;
+                    tally.processed++;
 
-                icao::validation::TrustChainResult tc = trustChainBuilder_->build(cert);
-                X509_free(cert);
+                    icao::validation::TrustChainResult tc = trustChainBuilder_->build(cert);
+                    X509_free(cert);
 
-                if (tc.valid) {
-                    std::string newStatus = tc.dscExpired ? "EXPIRED_VALID" : "VALID";
-                    validationRepo_->updateTrustChainStatus(id, newStatus, true, tc.message);
-                    tcNewlyValid++;
-                } else {
-                    tcStillPending++;
+                    if (tc.valid) {
+                        tally.updates.push_back({dsc.id, tc.dscExpired ? "EXPIRED_VALID" : "VALID", true, tc.message});
+                        tally.newlyValid++;
+                    } else {
+                        tally.stillPending++;
+                    }
+                } catch (const std::exception& e) {
+                    tally.errors++;
+                    tally.transient++;
+                    spdlog::warn("[ValidationService] Trust chain error for DSC: {}", e.what());
                 }
-            } catch (const std::exception& e) {
-                tcErrors++;
-                spdlog::warn("[ValidationService] Trust chain error for DSC: {}", e.what());
             }
+        });
+
+        std::vector<repositories::TrustChainStatusUpdate> updates;
+        for (size_t u = 0; u < units.size(); ++u) {
+            const Tally& tally = tallies[u];
+            tcProcessed += tally.processed;
+            tcNewlyValid += tally.newlyValid;
+            tcStillPending += tally.stillPending;
+            tcErrors += tally.errors;
+            tcTransientErrors += tally.transient;
+            if (newlyValidCountries && !tally.updates.empty()) {
+                newlyValidCountries->insert(dscs[units[u].front()].countryCode);
+            }
+            updates.insert(updates.end(), std::make_move_iterator(tally.updates.begin()),
+                           std::make_move_iterator(tally.updates.end()));
+        }
+        if (newlyValidCountries) newlyValidCountries->erase("");
+
+        int updated = validationRepo_->updateTrustChainStatusBatch(updates);
+        if (updated < static_cast<int>(updates.size())) {
+            spdlog::warn("[ValidationService] Step 2: {} of {} trust chain status updates applied",
+                         updated, updates.size());
+            int missed = static_cast<int>(updates.size()) - std::max(updated, 0);
+            tcErrors += missed;
+            tcTransientErrors += missed;
         }
 
     } catch (const std::exception& e) {
         spdlog::error("[ValidationService] Trust chain re-validation failed: {}", e.what());
         tcErrors++;
+        tcTransientErrors++;
     }
 
     result["tcProcessed"] = tcProcessed;
     result["tcNewlyValid"] = tcNewlyValid;
     result["tcStillPending"] = tcStillPending;
     result["tcErrors"] = tcErrors;
+    result["tcTransientErrors"] = tcTransientErrors;
     return result;
 }
 
-Json::Value ValidationService::recheckCrls() {
+Json::Value ValidationService::recheckCrls(const std::set<std::string>* countryCodes) {
     Json::Value result;
     int crlChecked = 0, crlRevoked = 0, crlUnavailable = 0, crlExpired = 0, crlErrors = 0;
+    int crlTransientErrors = 0;
 
     try {
-        Json::Value dscs = validationRepo_->findDscsForCrlRecheck();
-        spdlog::info("[ValidationService] Step 3: CRL re-check — {} DSCs to process", dscs.size());
-
-        for (const auto& dsc : dscs) {
+        if (countryCodes && countryCodes->empty()) {
+            spdlog::info("[ValidationService] Step 3: no CRL changes — skipped");
+            result["crlChecked"] = 0;
+            result["crlRevoked"] = 0;
+            result["crlUnavailable"] = 0;
+            result["crlExpired"] = 0;
+            result["crlErrors"] = 0;
+            result["crlTransientErrors"] = 0;
+            return result;
+        }
+        auto dscs = countryCodes ? validationRepo_->findDscsForCrlRecheck(*countryCodes)
+                                 : validationRepo_->findDscsForCrlRecheck();
+        auto countryOf = [&dscs](size_t i) { return dscs[i].countryCode; };
+        auto units = partitionByCountry(dscs.size(), countryOf, parallelism_);
+        spdlog::info("[ValidationService] Step 3: CRL re-check — {} DSCs to process ({} units, {} workers)",
+                     dscs.size(), units.size(), parallelism_);
+
+        // Per-run CRL snapshot: every country's CRL is fetched and indexed once
+        // up front, so workers only read it
+        icao::validation::CrlCache crlSnapshot(kCrlSnapshotTtl);
+        std::set<std::string> countries;
+        for (const auto& unit : units) {
+            countries.insert(countryOf(unit.front()));
+        }
+        for (const auto& country : countries) {
+            if (country.empty()) continue;
             try {
-                std::string id = dsc["id"].asString();
-                std::string countryCode = dsc.get("country_code", "").asString();
-                std::string certDataHex = dsc.get("certificate_data", "").asString();
-
-                if (certDataHex.empty() || countryCode.empty()) {
-                    crlErrors++;
-                    continue;
-                }
-
-                std::vector<uint8_t> derBytes = decodeHexToDer(certDataHex);
-                if (derBytes.empty()) {
-                    crlErrors++;
-                    continue;
-                }
+                crlSnapshot.get(country, *crlProvider_);
+            } catch (const std::exception& e) {
+                spdlog::warn("[ValidationService] CRL prefetch failed for {}: {}", country, e.what());
+            }
+        }
+        icao::validation::CrlChecker crlChecker(crlProvider_.get(), &crlSnapshot);
+
+        // Each unit is handled by exactly one worker and only touches its own tally
+        // (transient: see revalidateTrustChains)
+        struct Tally {
+            int checked = 0, revoked = 0, unavailable = 0, expired = 0, errors = 0, transient = 0;
+            std::vector<repositories::CrlStatusUpdate> updates;
+        };
+        std::vector<Tally> tallies(units.size());
+
+        forEachUnit(units.size(), parallelism_, [&](size_t u) {
+            Tally& tally = tallies[u];
+            for (size_t index : units[u]) {
+                const auto& dsc = dscs[index];
+                try {
+                    if (dsc.certificateDer.empty() || dsc.countryCode.empty()) {
+                        tally.errors++;
+                        continue;
+                    }
 
-                const unsigned char* p = derBytes.data();
-                X509* cert = d2i_X509(nullptr, &p, static_cast<long>(derBytes.size()));
-                if (!cert) {
-                    crlErrors++;
-                    continue;
-                }
+                    const unsigned char* p = dsc.certificateDer.data();
+                    X509* cert = d2i_X509(nullptr, &p, static_cast<long>(dsc.certificateDer.size()));
+                    if (!cert) {
+                        tally.errors++;
+                        continue;
+                    }
 
-                crlChecked++;
-
-                icao::validation::CrlCheckResult crl = crlChecker_->check(cert, countryCode);
-                X509_free(cert);
-
-                switch (crl.status) {
-                    case icao::validation::CrlCheckStatus::REVOKED:
-                        crlRevoked++;
-                        validationRepo_->updateCrlStatus(id, "INVALID",
-                            "Revoked (" + crl.revocationReason + ")");
-                        break;
-                    case icao::validation::CrlCheckStatus::CRL_UNAVAILABLE:
-                        crlUnavailable++;
-                        break;
-                    case icao::validation::CrlCheckStatus::CRL_EXPIRED:
-                        crlExpired++;
-                        break;
-                    case icao::validation::CrlCheckStatus::VALID:
-                    case icao::validation::CrlCheckStatus::NOT_CHECKED:
-                    case icao::validation::CrlCheckStatus::CRL_INVALID:
-                        break;
+                    tally.checked++;
+
+                    icao::validation::CrlCheckResult crl = crlChecker.check(cert, dsc.countryCode);
+                    X509_free(cert);
+
+                    switch (crl.status) {
+                        case icao::validation::CrlCheckStatus::REVOKED:
+                            tally.revoked++;
+                            tally.updates.push_back({dsc.id, "INVALID", "Revoked (" + crl.revocationReason + ")"});
+                            break;
+                        case icao::validation::CrlCheckStatus::CRL_UNAVAILABLE:
+                            tally.unavailable++;
+                            break;
+                        case icao::validation::CrlCheckStatus::CRL_EXPIRED:
+                            tally.expired++;
+                            break;
+                        case icao::validation::CrlCheckStatus::VALID:
+                        case icao::validation::CrlCheckStatus::NOT_CHECKED:
+                        case icao::validation::CrlCheckStatus::CRL_INVALID:
+                            break;
+                    }
+                } catch (const std::exception& e) {
+                    tally.errors++;
+                    tally.transient++;
+                    spdlog::warn("[ValidationService] CRL check error: {}", e.what());
                 }
-            } catch (const std::exception& e) {
-                crlErrors++;
-                spdlog::warn("[ValidationService] CRL check error: {}", e.what());
             }
+        });
+
+        std::vector<repositories::CrlStatusUpdate> updates;
+        for (auto& tally : tallies) {
+            crlChecked += tally.checked;
+            crlRevoked += tally.revoked;
+            crlUnavailable += tally.unavailable;
+            crlExpired += tally.expired;
+            crlErrors += tally.errors;
+            crlTransientErrors += tally.transient;
+            updates.insert(updates.end(), std::make_move_iterator(tally.updates.begin()),
+                           std::make_move_iterator(tally.updates.end()));
+        }
+
+        int updated = validationRepo_->updateCrlStatusBatch(updates);
+        if (updated < static_cast<int>(updates.size())) {
+            spdlog::warn("[ValidationService] Step 3: {} of {} CRL status updates applied",
+                         updated, updates.size());
+            int missed = static_cast<int>(updates.size()) - std::max(updated, 0);
+            crlErrors += missed;
+            crlTransientErrors += missed;
         }
 
     } catch (const std::exception& e) {
         spdlog::error("[ValidationService] CRL re-check failed: {}", e.what());
         crlErrors++;
+        crlTransientErrors++;
     }
 
     result["crlChecked"] = crlChecked;
@@ -232,21 +319,52 @@ Json::Value ValidationService::recheckCrls() {
     result["crlUnavailable"] = crlUnavailable;
     result["crlExpired"] = crlExpired;
     result["crlErrors"] = crlErrors;
+    result["crlTransientErrors"] = crlTransientErrors;
     return result;
 }
 
-Json::Value ValidationService::revalidateAll() {
+Json::Value ValidationService::revalidateAll(RevalidationMode mode) {
     auto startTime = std::chrono::steady_clock::now();
 
     Json::Value response;
     response["success"] = false;
 
     try {
-        spdlog::info("[ValidationService] Starting 3-step certificate revalidation");
+        // Journal is read in every mode so a full run also consumes it
+        std::optional<repositories::RevalidationChanges> changes = validationRepo_->findRevalidationChanges();
+
+        // CRLs journaled here may have been stored by another process (relay upload/sync);
+        // drop them from this process's parsed-CRL cache before the TTL would
+        if (changes) {
+            for (const auto& countryCode : changes->crlCountries) {
+                icao::validation::CrlCache::instance().invalidate(countryCode);
+            }
+        }
+
+        bool incremental = false;
+        if (mode != RevalidationMode::Full && changes) {
+            incremental = (mode == RevalidationMode::Incremental) ||
+                          validationRepo_->hasFullRevalidationWithin(fullSweepIntervalHours_);
+            size_t issuerKeys = changes->issuerCountries.size() + changes->issuerDns.size() +
+                                changes->issuerSkis.size();
+            if (incremental && (issuerKeys > kMaxIncrementalKeys || changes->crlCountries.size() > kMaxIncrementalKeys)) {
+                spdlog::info("[ValidationService] {} journaled changes exceed incremental limit, running full sweep",
+                             changes->entries);
+                incremental = false;
+            }
+        }
+        const char* runMode = incremental ? "INCREMENTAL" : "FULL";
+
+        spdlog::info("[ValidationService] Starting 3-step certificate revalidation ({}, {} journaled changes)",
+                     runMode, changes ? changes->entries : 0);
+
+        repositories::RevalidationTimings timings;
+        timings.workers = parallelism_;
 
         // =============================================
         // Step 1: Expiration check (existing logic)
         // =============================================
+        auto stepStart = std::chrono::steady_clock::now();
         std::vector<domain::ValidationResult> validations = validationRepo_->findAllWithExpirationInfo();
 
         int totalProcessed = 0;
@@ -288,6 +406,7 @@ Json::Value ValidationService::revalidateAll() {
         }
 
         validationRepo_->updateAllUploadExpiredCounts();
+        timings.expiryMs = elapsedMs(stepStart);
 
         spdlog::info("[ValidationService] Step 1 complete: {} processed, {} expired, {} valid, {} unchanged",
                     totalProcessed, newlyExpired, newlyValid, unchanged);
@@ -295,15 +414,41 @@ Json::Value ValidationService::revalidateAll() {
         // =============================================
         // Step 2: Trust Chain re-validation
         // =============================================
-        Json::Value tcResult = revalidateTrustChains();
+        stepStart = std::chrono::steady_clock::now();
+        std::set<std::string> crlCountries;
+        Json::Value tcResult = incremental
+            ? revalidateTrustChains(&*changes, &crlCountries)
+            : revalidateTrustChains();
+        timings.trustChainMs = elapsedMs(stepStart);
 
         // =============================================
         // Step 3: CRL re-check
         // =============================================
-        Json::Value crlResult = recheckCrls();
+        stepStart = std::chrono::steady_clock::now();
+        Json::Value crlResult;
+        if (incremental) {
+            // Countries with a new CRL, plus DSCs that step 2 just made valid
+            crlCountries.insert(changes->crlCountries.begin(), changes->crlCountries.end());
+            crlResult = recheckCrls(&crlCountries);
+        } else {
+            crlResult = recheckCrls();
+        }
+        timings.crlMs = elapsedMs(stepStart);
+
+        // Keep the journal only when steps 2 and 3 hit a failure a retry can fix
+        // (a lookup that threw, status updates that did not apply). DSCs that
+        // never parse would otherwise pin it forever.
+        if (changes && !changes->journalIds.empty()) {
+            int transientErrors = tcResult["tcTransientErrors"].asInt() + crlResult["crlTransientErrors"].asInt();
+            if (transientErrors == 0) {
+                validationRepo_->deleteRevalidationChanges(changes->journalIds);
+            } else {
+                spdlog::warn("[ValidationService] {} transient trust chain/CRL errors, keeping {} journaled changes for the next run",
+                             transientErrors, changes->journalIds.size());
+            }
+        }
 
-        auto endTime = std::chrono::steady_clock::now();
-        int durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+        int durationMs = elapsedMs(startTime);
 
         // Save extended history
         validationRepo_->saveRevalidationHistoryExtended(
@@ -312,17 +457,23 @@ Json::Value ValidationService::revalidateAll() {
             tcResult["tcStillPending"].asInt(), tcResult["tcErrors"].asInt(),
             crlResult["crlChecked"].asInt(), crlResult["crlRevoked"].asInt(),
             crlResult["crlUnavailable"].asInt(), crlResult["crlExpired"].asInt(),
-            crlResult["crlErrors"].asInt()
+            crlResult["crlErrors"].asInt(), runMode, timings
         );
 
         // Build response
         response["success"] = true;
+        response["mode"] = runMode;
+        response["journalEntries"] = changes ? changes->entries : 0;
         response["totalProcessed"] = totalProcessed;
         response["newlyExpired"] = newlyExpired;
         response["newlyValid"] = newlyValid;
         response["unchanged"] = unchanged;
         response["errors"] = errors;
         response["durationMs"] = durationMs;
+        response["workers"] = timings.workers;
+        response["expiryDurationMs"] = timings.expiryMs;
+        response["tcDurationMs"] = timings.trustChainMs;
+        response["crlDurationMs"] = timings.crlMs;
 
         // Step 2 results
         response["tcProcessed"] = tcResult["tcProcessed"];
@@ -337,9 +488,9 @@ Json::Value ValidationService::revalidateAll() {
         response["crlExpired"] = crlResult["crlExpired"];
         response["crlErrors"] = crlResult["crlErrors"];
 
-        spdlog::info("[ValidationService] 3-step revalidation complete in {}ms: "
+        spdlog::info("[ValidationService] 3-step revalidation ({}) complete in {}ms: "
                     "Step1({} processed), Step2(TC {}/{}/{}), Step3(CRL {}/{}/{})",
-                    durationMs, totalProcessed,
+                    runMode, durationMs, totalProcessed,
                     tcResult["tcProcessed"].asInt(), tcResult["tcNewlyValid"].asInt(), tcResult["tcStillPending"].asInt(),
                     crlResult["crlChecked"].asInt(), crlResult["crlRevoked"].asInt(), crlResult["crlUnavailable"].asInt());
 
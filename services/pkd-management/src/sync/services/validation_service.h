@@ -8,7 +8,10 @@
 #include "../repositories/certificate_repository.h"
 #include "../repositories/crl_repository.h"
 #include "../domain/models/validation_result.h"
+#include <chrono>
 #include <memory>
+#include <set>
+#include <string>
 #include <json/json.h>
 
 // Forward declarations for validation library types
@@ -16,11 +19,19 @@ namespace icao::validation {
     class ICscaProvider;
     class ICrlProvider;
     class TrustChainBuilder;
-    class CrlChecker;
 }
 
 namespace icao::relay::services {
 
+/**
+ * @brief Which DSCs steps 2 and 3 of a revalidation run visit
+ */
+enum class RevalidationMode {
+    Full,         ///< Every candidate DSC
+    Incremental,  ///< Only DSCs affected by journaled CSCA/link certificate/CRL inserts
+    Auto          ///< Incremental, unless no full run happened within the full sweep interval
+};
+
 /**
  * @brief Service for certificate validation and revalidation operations
  *
@@ -28,9 +39,22 @@ namespace icao::relay::services {
  * 1. Expiration check (all certificates)
  * 2. Trust Chain re-validation (PENDING/INVALID DSCs with csca_found=FALSE)
  * 3. CRL re-check (VALID/EXPIRED_VALID DSCs)
+ *
+ * Incremental runs read revalidation_change_journal: step 2 only visits DSCs
+ * whose country, issuer DN or AKI matches a new CSCA/link certificate, step 3
+ * only DSCs of countries with a new CRL (plus DSCs that step 2 just made
+ * valid). Every run consumes the journal entries it read.
+ *
+ * Steps 2 and 3 partition their DSCs by country across a pool of worker
+ * threads (setParallelism). Workers share the preloaded CSCA trust store and
+ * a per-run CRL snapshot, and only collect status changes; those are written
+ * afterwards in bulk (ValidationRepository::update*StatusBatch).
  */
 class ValidationService {
 public:
+    /// Journaled issuer keys above which an incremental run falls back to full
+    static constexpr size_t kMaxIncrementalKeys = 500;
+
     /**
      * @brief Constructor with full dependency injection
      * @param validationRepo Validation repository for data access
@@ -52,9 +76,20 @@ public:
      * Step 2: Re-validate trust chains for PENDING DSCs
      * Step 3: Re-check CRL revocation for VALID DSCs
      *
+     * @param mode Full (manual trigger), Incremental, or Auto (daily scheduler)
      * @return JSON response with 3-step results
      */
-    Json::Value revalidateAll();
+    Json::Value revalidateAll(RevalidationMode mode = RevalidationMode::Full);
+
+    /**
+     * @brief Maximum time between full sweeps in Auto mode (default 7 days)
+     */
+    void setFullSweepIntervalHours(int hours) { fullSweepIntervalHours_ = hours; }
+
+    /**
+     * @brief Worker threads for steps 2 and 3 (1 = run on the calling thread)
+     */
+    void setParallelism(int workers) { parallelism_ = workers > 0 ? workers : 1; }
 
 private:
     repositories::ValidationRepository* validationRepo_;
@@ -65,26 +100,32 @@ private:
     std::unique_ptr<icao::validation::ICscaProvider> cscaProvider_;
     std::unique_ptr<icao::validation::ICrlProvider> crlProvider_;
     std::unique_ptr<icao::validation::TrustChainBuilder> trustChainBuilder_;
-    std::unique_ptr<icao::validation::CrlChecker> crlChecker_;
+
+    int fullSweepIntervalHours_ = 7 * 24;
+    int parallelism_ = 1;
+
+    /// Validity of the per-run CRL snapshot shared by step 3 workers
+    static constexpr std::chrono::hours kCrlSnapshotTtl{24};
 
     std::string determineValidationStatus(bool isExpired, const std::string& currentStatus);
 
     /**
      * @brief Step 2: Trust Chain re-validation for PENDING DSCs
-     * @return JSON object with tcProcessed, tcNewlyValid, tcStillPending, tcErrors
+     * @param changes Limit to DSCs affected by these changes (nullptr = all)
+     * @param newlyValidCountries Receives countries of DSCs that became valid (optional)
+     * @return JSON object with tcProcessed, tcNewlyValid, tcStillPending, tcErrors,
+     *         tcTransientErrors (the subset of tcErrors a retry can fix)
      */
-    Json::Value revalidateTrustChains();
+    Json::Value revalidateTrustChains(const repositories::RevalidationChanges* changes = nullptr,
+                                      std::set<std::string>* newlyValidCountries = nullptr);
 
     /**
      * @brief Step 3: CRL re-check for VALID DSCs
-     * @return JSON object with crlChecked, crlRevoked, crlUnavailable, crlExpired, crlErrors
-     */
-    Json::Value recheckCrls();
-
-    /**
-     * @brief Decode hex-encoded certificate data to DER bytes
+     * @param countryCodes Limit to these countries (nullptr = all)
+     * @return JSON object with crlChecked, crlRevoked, crlUnavailable, crlExpired, crlErrors,
+     *         crlTransientErrors (the subset of crlErrors a retry can fix)
      */
-    std::vector<uint8_t> decodeHexToDer(const std::string& hexData);
+    Json::Value recheckCrls(const std::set<std::string>* countryCodes = nullptr);
 };
 
 } // namespace icao::relay::services
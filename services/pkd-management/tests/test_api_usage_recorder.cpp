@@ -0,0 +1,314 @@
+/**
+ * @file test_api_usage_recorder.cpp
+ * @brief Unit tests for the API key lookup cache (ApiClientRepository) and
+ *        write-behind usage recording (services::ApiUsageRecorder)
+ *
+ * A fake IQueryExecutor counts key lookups and captures batched writes;
+ * no database connection is required.
+ */
+
+#include <gtest/gtest.h>
+#include "../src/repositories/api_client_repository.h"
+#include "../src/services/api_usage_recorder.h"
+#include "i_query_executor.h"
+
+#include <json/json.h>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using repositories::ApiClientRepository;
+using services::ApiUsageRecorder;
+
+namespace {
+
+class FakeQueryExecutor : public common::IQueryExecutor {
+public:
+    struct Batch {
+        std::string query;
+        std::vector<std::vector<std::string>> rows;
+    };
+
+    Json::Value executeQuery(const std::string& query,
+                             const std::vector<std::string>& params) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (query.find("WHERE api_key_hash = $1") != std::string::npos) {
+            keyLookups++;
+            if (failQueries) throw std::runtime_error("connection lost");
+            Json::Value result(Json::arrayValue);
+            if (!params.empty() && params[0] == knownKeyHash) {
+                Json::Value row;
+                row["id"] = "client-1";
+                row["client_name"] = clientName;
+                row["api_key_hash"] = knownKeyHash;
+                row["is_active"] = true;
+                result.append(row);
+            }
+            return result;
+        }
+        return Json::Value(Json::arrayValue);
+    }
+
+    int executeCommand(const std::string&, const std::vector<std::string>&) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        commands++;
+        return 1;
+    }
+
+    Json::Value executeScalar(const std::string&, const std::vector<std::string>&) override {
+        return Json::Value(0);
+    }
+
+    int executeBatch(const std::string& query,
+                     const std::vector<std::vector<std::string>>& paramRows) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (failBatches) throw std::runtime_error("connection lost");
+        if (failLogBatches && query.find("api_client_usage_log") != std::string::npos) {
+            throw std::runtime_error("connection lost");
+        }
+        batches.push_back({query, paramRows});
+        return static_cast<int>(paramRows.size());
+    }
+
+    std::string getDatabaseType() const override { return "postgres"; }
+
+    size_t loggedRows() {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t n = 0;
+        for (const auto& b : batches) {
+            if (b.query.find("api_client_usage_log") != std::string::npos) n += b.rows.size();
+        }
+        return n;
+    }
+
+    std::mutex mutex;
+    std::string knownKeyHash = "hash-known";
+    std::string clientName = "agent-a";
+    int keyLookups = 0;
+    int commands = 0;
+    bool failQueries = false;
+    bool failBatches = false;
+    bool failLogBatches = false;
+    std::vector<Batch> batches;
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// API key cache
+// =============================================================================
+
+TEST(ApiKeyCache, Hit_AvoidsSecondQuery) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+
+    auto first = repo.findByKeyHashCached("hash-known");
+    auto second = repo.findByKeyHashCached("hash-known");
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->id, "client-1");
+    EXPECT_EQ(db.keyLookups, 1);
+}
+
+TEST(ApiKeyCache, UnknownKey_CachedNegatively) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+
+    EXPECT_FALSE(repo.findByKeyHashCached("hash-unknown").has_value());
+    EXPECT_FALSE(repo.findByKeyHashCached("hash-unknown").has_value());
+    EXPECT_EQ(db.keyLookups, 1);
+}
+
+TEST(ApiKeyCache, DbError_NotCached) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+
+    db.failQueries = true;
+    EXPECT_FALSE(repo.findByKeyHashCached("hash-known").has_value());
+    db.failQueries = false;
+    EXPECT_TRUE(repo.findByKeyHashCached("hash-known").has_value());
+    EXPECT_EQ(db.keyLookups, 2);
+}
+
+TEST(ApiKeyCache, Writes_InvalidateCache) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+
+    repo.findByKeyHashCached("hash-known");
+    db.clientName = "agent-renamed";
+    domain::models::ApiClient client;
+    client.id = "client-1";
+    client.clientName = "agent-renamed";
+    repo.update(client);
+
+    auto after = repo.findByKeyHashCached("hash-known");
+    ASSERT_TRUE(after.has_value());
+    EXPECT_EQ(after->clientName, "agent-renamed");
+    EXPECT_EQ(db.keyLookups, 2);
+
+    repo.deactivate("client-1");
+    repo.findByKeyHashCached("hash-known");
+    EXPECT_EQ(db.keyLookups, 3);
+}
+
+TEST(ApiKeyCache, ZeroTtl_DisablesCache) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    repo.setKeyCacheTtl(std::chrono::seconds(0));
+
+    repo.findByKeyHashCached("hash-known");
+    repo.findByKeyHashCached("hash-known");
+    EXPECT_EQ(db.keyLookups, 2);
+}
+
+TEST(ApiKeyCache, Uncached_AlwaysQueries) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+
+    repo.findByKeyHashCached("hash-known");
+    repo.findByKeyHash("hash-known");
+    EXPECT_EQ(db.keyLookups, 2);
+}
+
+// =============================================================================
+// Write-behind usage
+// =============================================================================
+
+namespace {
+
+void recordN(ApiUsageRecorder& recorder, const std::string& clientId, int n) {
+    for (int i = 0; i < n; ++i) {
+        recorder.record(clientId, "agent", "/api/certificates/search", "GET",
+                        200, 0, "10.0.0.1", "test-agent");
+    }
+}
+
+} // anonymous namespace
+
+TEST(ApiUsageRecorder, Record_DoesNotTouchDb) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder recorder(&repo, {});
+
+    recordN(recorder, "client-1", 10);
+    EXPECT_TRUE(db.batches.empty());
+    EXPECT_EQ(db.commands, 0);
+    EXPECT_EQ(recorder.stats().pendingRows, 10u);
+}
+
+TEST(ApiUsageRecorder, Flush_AggregatesCountsAndBatchesLogRows) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder recorder(&repo, {});
+
+    recordN(recorder, "client-1", 3);
+    recordN(recorder, "client-2", 2);
+    ASSERT_TRUE(recorder.flush());
+
+    ASSERT_EQ(db.batches.size(), 2u);
+    const auto& counts = db.batches[0];
+    EXPECT_NE(counts.query.find("total_requests = total_requests + $1"), std::string::npos);
+    ASSERT_EQ(counts.rows.size(), 2u);
+    for (const auto& row : counts.rows) {
+        EXPECT_EQ(row[0], row[1] == "client-1" ? "3" : "2");
+    }
+
+    const auto& logs = db.batches[1];
+    EXPECT_NE(logs.query.find("api_client_usage_log"), std::string::npos);
+    ASSERT_EQ(logs.rows.size(), 5u);
+    EXPECT_EQ(logs.rows[0].size(), 9u);
+    EXPECT_EQ(logs.rows[0][8].size(), 19u);  // "YYYY-MM-DD HH:MM:SS"
+
+    auto stats = recorder.stats();
+    EXPECT_EQ(stats.flushedRows, 5u);
+    EXPECT_EQ(stats.pendingRows, 0u);
+}
+
+TEST(ApiUsageRecorder, Flush_FailureKeepsDataForRetry) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder recorder(&repo, {});
+
+    recordN(recorder, "client-1", 4);
+    db.failBatches = true;
+    EXPECT_FALSE(recorder.flush());
+    EXPECT_EQ(recorder.stats().pendingRows, 4u);
+    EXPECT_EQ(recorder.stats().flushFailures, 1u);
+
+    recordN(recorder, "client-1", 1);
+    db.failBatches = false;
+    ASSERT_TRUE(recorder.flush());
+    EXPECT_EQ(db.batches[0].rows[0][0], "5");
+    EXPECT_EQ(db.loggedRows(), 5u);
+}
+
+TEST(ApiUsageRecorder, Flush_LogFailureAfterCounts_CountsNotReapplied) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder recorder(&repo, {});
+
+    recordN(recorder, "client-1", 4);
+    db.failLogBatches = true;
+    EXPECT_FALSE(recorder.flush());
+    ASSERT_EQ(db.batches.size(), 1u);           // Counts applied
+    EXPECT_EQ(db.batches[0].rows[0][0], "4");
+
+    recordN(recorder, "client-1", 1);
+    db.failLogBatches = false;
+    ASSERT_TRUE(recorder.flush());
+    ASSERT_EQ(db.batches.size(), 3u);
+    EXPECT_EQ(db.batches[1].rows[0][0], "1");   // Only the request recorded since
+    EXPECT_EQ(db.loggedRows(), 5u);
+}
+
+TEST(ApiUsageRecorder, MaxPending_DropsLogRowsButKeepsCounts) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder::Config config;
+    config.flushBatch = 5;
+    config.maxPending = 5;
+    ApiUsageRecorder recorder(&repo, config);
+
+    recordN(recorder, "client-1", 8);
+    EXPECT_EQ(recorder.stats().droppedRows, 3u);
+    ASSERT_TRUE(recorder.flush());
+    EXPECT_EQ(db.batches[0].rows[0][0], "8");
+    EXPECT_EQ(db.loggedRows(), 5u);
+}
+
+TEST(ApiUsageRecorder, BatchThreshold_TriggersBackgroundFlush) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder::Config config;
+    config.flushInterval = std::chrono::seconds(60);
+    config.flushBatch = 10;
+    ApiUsageRecorder recorder(&repo, config);
+    recorder.start();
+
+    recordN(recorder, "client-1", 10);
+    for (int i = 0; i < 200 && db.loggedRows() < 10; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(db.loggedRows(), 10u);
+    recorder.stop();
+}
+
+TEST(ApiUsageRecorder, Stop_FlushesRemainder) {
+    FakeQueryExecutor db;
+    ApiClientRepository repo(&db);
+    ApiUsageRecorder::Config config;
+    config.flushInterval = std::chrono::seconds(60);
+    ApiUsageRecorder recorder(&repo, config);
+    recorder.start();
+
+    recordN(recorder, "client-1", 3);
+    recorder.stop();
+    EXPECT_EQ(db.loggedRows(), 3u);
+}
+
+TEST(ApiUsageRecorder, NullRepository_Throws) {
+    EXPECT_THROW(ApiUsageRecorder(nullptr, {}), std::invalid_argument);
+}
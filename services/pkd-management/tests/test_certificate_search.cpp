@@ -0,0 +1,247 @@
+/**
+ * @file test_certificate_search.cpp
+ * @brief Unit tests for CertificateRepository::search() keyset paging and
+ *        the cached total/stats
+ *
+ * A fake IQueryExecutor records the SQL it receives and returns canned rows;
+ * no database connection is required.
+ */
+
+#include <gtest/gtest.h>
+#include "../src/repositories/certificate_repository.h"
+#include "i_query_executor.h"
+
+#include <json/json.h>
+#include <string>
+#include <vector>
+
+using repositories::CertificateRepository;
+using repositories::CertificateSearchFilter;
+
+namespace {
+
+class FakeQueryExecutor : public common::IQueryExecutor {
+public:
+    Json::Value executeQuery(const std::string& query,
+                             const std::vector<std::string>& params) override {
+        if (query.find("total_cnt") != std::string::npos) {
+            statsQueries++;
+            Json::Value row;
+            row["total_cnt"] = "120";
+            row["valid_cnt"] = "100";
+            row["expired_cnt"] = "15";
+            row["not_yet_valid_cnt"] = "3";
+            Json::Value result(Json::arrayValue);
+            result.append(row);
+            return result;
+        }
+        dataQueries.push_back(query);
+        dataParams.push_back(params);
+        Json::Value result(Json::arrayValue);
+        for (int i = 0; i < dataRows; ++i) {
+            Json::Value row;
+            row["id"] = "00000000-0000-4000-8000-00000000000" + std::to_string(i);
+            row["certificate_type"] = "DSC";
+            row["subject_dn"] = "CN=Test " + std::to_string(i) + ",C=KR";
+            row["not_before"] = "2024-01-01 00:00:00";
+            row["not_after"] = "2034-01-01 00:00:00";
+            row["cursor_ts"] = "2026-10-0" + std::to_string(9 - i) + "T12:00:00.000000";
+            result.append(row);
+        }
+        return result;
+    }
+
+    int executeCommand(const std::string&, const std::vector<std::string>&) override { return 0; }
+    Json::Value executeScalar(const std::string&, const std::vector<std::string>&) override { return Json::Value(0); }
+    std::string getDatabaseType() const override { return dbType; }
+
+    std::string dbType = "postgres";
+    int dataRows = 3;
+    int statsQueries = 0;
+    std::vector<std::string> dataQueries;
+    std::vector<std::vector<std::string>> dataParams;
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// Cursor encoding
+// =============================================================================
+
+TEST(SearchCursor, RoundTrip) {
+    std::string cursor = CertificateRepository::encodeSearchCursor(
+        "2026-10-16T08:30:00.123456", "3f2b0c1e-9d4a-4e7b-8c11-2a5d6e7f8091");
+    auto decoded = CertificateRepository::decodeSearchCursor(cursor);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->first, "2026-10-16T08:30:00.123456");
+    EXPECT_EQ(decoded->second, "3f2b0c1e-9d4a-4e7b-8c11-2a5d6e7f8091");
+}
+
+TEST(SearchCursor, Malformed_Rejected) {
+    EXPECT_FALSE(CertificateRepository::decodeSearchCursor("").has_value());
+    EXPECT_FALSE(CertificateRepository::decodeSearchCursor("garbage").has_value());
+    EXPECT_FALSE(CertificateRepository::decodeSearchCursor("2026-10-16T08:30:00~abc").has_value());
+    EXPECT_FALSE(CertificateRepository::decodeSearchCursor("2026-10-16T08:30:00.123456~").has_value());
+    EXPECT_FALSE(CertificateRepository::decodeSearchCursor("2026-10-16T08:30:00.123456~a'; DROP").has_value());
+}
+
+// =============================================================================
+// Keyset paging
+// =============================================================================
+
+TEST(CertificateSearch, FirstPage_ReturnsNextCursorWhenMoreRows) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.limit = 2;
+
+    auto result = repo.search(filter);
+    ASSERT_TRUE(result["success"].asBool());
+    EXPECT_EQ(result["certificates"].size(), 2u);
+    EXPECT_TRUE(result["hasMore"].asBool());
+    EXPECT_EQ(result["nextCursor"].asString(),
+              "2026-10-08T12:00:00.000000~00000000-0000-4000-8000-000000000001");
+    EXPECT_NE(db.dataQueries[0].find("ORDER BY created_at DESC, id DESC LIMIT 3 OFFSET 0"), std::string::npos);
+}
+
+TEST(CertificateSearch, LastPage_NoNextCursor) {
+    FakeQueryExecutor db;
+    db.dataRows = 2;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.limit = 2;
+
+    auto result = repo.search(filter);
+    EXPECT_FALSE(result["hasMore"].asBool());
+    EXPECT_FALSE(result.isMember("nextCursor"));
+}
+
+TEST(CertificateSearch, Cursor_UsesKeysetPredicateInsteadOfOffset) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.countryCode = "KR";
+    filter.limit = 2;
+    filter.offset = 400;
+    filter.cursor = "2026-10-08T12:00:00.000000~00000000-0000-4000-8000-000000000001";
+
+    repo.search(filter);
+    const auto& sql = db.dataQueries[0];
+    EXPECT_NE(sql.find("(created_at, id) < (($2::timestamp AT TIME ZONE 'UTC'), $3::uuid)"), std::string::npos);
+    EXPECT_NE(sql.find("OFFSET 0"), std::string::npos);
+    ASSERT_EQ(db.dataParams[0].size(), 3u);
+    EXPECT_EQ(db.dataParams[0][1], "2026-10-08T12:00:00.000000");
+}
+
+TEST(CertificateSearch, CursorOnOracle_ExpandsRowComparison) {
+    FakeQueryExecutor db;
+    db.dbType = "oracle";
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.cursor = "2026-10-08T12:00:00.000000~ABCDEF0123";
+
+    repo.search(filter);
+    const auto& sql = db.dataQueries[0];
+    EXPECT_NE(sql.find("created_at < TO_TIMESTAMP($1"), std::string::npos);
+    EXPECT_NE(sql.find("AND id < $2"), std::string::npos);
+}
+
+TEST(CertificateSearch, InvalidCursor_Error) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.cursor = "not-a-cursor";
+
+    auto result = repo.search(filter);
+    EXPECT_FALSE(result["success"].asBool());
+    EXPECT_TRUE(db.dataQueries.empty());
+}
+
+// =============================================================================
+// Cached total / stats
+// =============================================================================
+
+TEST(CertificateSearch, Summary_CachedPerFilter) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.countryCode = "KR";
+
+    auto first = repo.search(filter);
+    auto second = repo.search(filter);
+    EXPECT_EQ(first["total"].asInt(), 120);
+    EXPECT_EQ(second["stats"]["unknown"].asInt(), 2);
+    EXPECT_EQ(db.statsQueries, 1);
+
+    filter.countryCode = "DE";
+    repo.search(filter);
+    EXPECT_EQ(db.statsQueries, 2);
+}
+
+TEST(CertificateSearch, Invalidate_RecountsOnNextSearch) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+
+    repo.search(filter);
+    repo.invalidateSearchSummaryCache();
+    repo.search(filter);
+    EXPECT_EQ(db.statsQueries, 2);
+}
+
+TEST(CertificateSearch, IncludeTotalFalse_SkipsSummary) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    CertificateSearchFilter filter;
+    filter.includeTotal = false;
+
+    auto result = repo.search(filter);
+    EXPECT_TRUE(result["success"].asBool());
+    EXPECT_FALSE(result.isMember("total"));
+    EXPECT_FALSE(result.isMember("stats"));
+    EXPECT_EQ(db.statsQueries, 0);
+}
+
+TEST(CertificateSearch, ZeroTtl_DisablesCache) {
+    FakeQueryExecutor db;
+    CertificateRepository repo(&db);
+    repo.setSearchSummaryCacheTtl(std::chrono::seconds(0));
+    CertificateSearchFilter filter;
+
+    repo.search(filter);
+    repo.search(filter);
+    EXPECT_EQ(db.statsQueries, 2);
+}
+
+TEST(CertificateSearch, OracleText_SingleWordOnly) {
+    FakeQueryExecutor db;
+    db.dbType = "oracle";
+    CertificateRepository repo(&db);
+    repo.setOracleTextSearch(true);
+    CertificateSearchFilter filter;
+
+    filter.searchTerm = "A1B2C3";
+    repo.search(filter);
+    EXPECT_NE(db.dataQueries[0].find("CONTAINS(subject_dn, $1) > 0"), std::string::npos);
+
+    filter.searchTerm = "Test Name";
+    repo.search(filter);
+    EXPECT_EQ(db.dataQueries[1].find("CONTAINS"), std::string::npos);
+    EXPECT_NE(db.dataQueries[1].find("UPPER(subject_dn) LIKE UPPER($1)"), std::string::npos);
+}
+
+TEST(CertificateSearch, OracleText_ReservedWordOrStopword_UsesLike) {
+    FakeQueryExecutor db;
+    db.dbType = "oracle";
+    CertificateRepository repo(&db);
+    repo.setOracleTextSearch(true);
+    CertificateSearchFilter filter;
+
+    for (const char* term : {"near", "WITHIN", "And", "the"}) {
+        filter.searchTerm = term;
+        repo.search(filter);
+        const std::string& sql = db.dataQueries.back();
+        EXPECT_EQ(sql.find("CONTAINS"), std::string::npos) << term;
+        EXPECT_NE(sql.find("UPPER(subject_dn) LIKE UPPER($1)"), std::string::npos) << term;
+    }
+}
@@ -0,0 +1,291 @@
+/**
+ * @file test_revalidation_changes.cpp
+ * @brief Unit tests for the incremental revalidation queries of the sync
+ *        ValidationRepository (change journal, scoped DSC lookups)
+ *
+ * A fake IQueryExecutor records the SQL it receives and returns canned rows;
+ * no database connection is required.
+ */
+
+#include <gtest/gtest.h>
+#include "../src/sync/repositories/validation_repository.h"
+#include "i_query_executor.h"
+
+#include <json/json.h>
+#include <string>
+#include <vector>
+
+using icao::relay::repositories::CrlStatusUpdate;
+using icao::relay::repositories::RevalidationChanges;
+using icao::relay::repositories::TrustChainStatusUpdate;
+using icao::relay::repositories::ValidationRepository;
+
+namespace {
+
+class FakeQueryExecutor : public common::IQueryExecutor {
+public:
+    Json::Value executeQuery(const std::string& query,
+                             const std::vector<std::string>& params) override {
+        queries.push_back(query);
+        lastParams = params;
+        if (failJournal && query.find("revalidation_change_journal") != std::string::npos) {
+            throw std::runtime_error("relation \"revalidation_change_journal\" does not exist");
+        }
+        if (query.find("FROM revalidation_change_journal") != std::string::npos) {
+            return journalRows;
+        }
+        if (query.find("FROM validation_result vr") != std::string::npos) {
+            return dscRows;
+        }
+        return Json::Value(Json::arrayValue);
+    }
+
+    int executeCommand(const std::string& query, const std::vector<std::string>& params) override {
+        queries.push_back(query);
+        lastParams = params;
+        return 3;
+    }
+
+    Json::Value executeScalar(const std::string& query, const std::vector<std::string>&) override {
+        queries.push_back(query);
+        return Json::Value(scalar);
+    }
+
+    int executeBatch(const std::string& query,
+                     const std::vector<std::vector<std::string>>& paramRows) override {
+        queries.push_back(query);
+        batchRows.push_back(paramRows);
+        return static_cast<int>(paramRows.size());
+    }
+
+    std::string getDatabaseType() const override { return dbType; }
+
+    void addJournal(int id, const std::string& type, const std::string& country,
+                    const std::string& dn, const std::string& ski) {
+        Json::Value row;
+        row["id"] = std::to_string(id);
+        row["change_type"] = type;
+        row["country_code"] = country;
+        row["subject_dn"] = dn;
+        row["subject_key_identifier"] = ski.empty() ? Json::Value(Json::nullValue) : Json::Value(ski);
+        journalRows.append(row);
+    }
+
+    std::string dbType = "postgres";
+    Json::Value journalRows = Json::Value(Json::arrayValue);
+    Json::Value dscRows = Json::Value(Json::arrayValue);
+    bool failJournal = false;
+    int scalar = 0;
+    std::vector<std::string> queries;
+    std::vector<std::string> lastParams;
+    std::vector<std::vector<std::vector<std::string>>> batchRows;
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// Change journal
+// =============================================================================
+
+TEST(RevalidationChanges, Journal_GroupsIssuerAndCrlChanges) {
+    FakeQueryExecutor db;
+    db.addJournal(7, "CSCA", "KR", "CN=CSCA-KOREA,O=Government,C=KR", "a1b2");
+    db.addJournal(9, "LC", "KR", "CN=CSCA-KOREA-2,O=Government,C=KR", "");
+    db.addJournal(12, "CRL", "DE", "CN=csca-germany,O=bsi,C=DE", "");
+    ValidationRepository repo(&db);
+
+    auto changes = repo.findRevalidationChanges();
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_EQ(changes->entries, 3);
+    EXPECT_EQ(changes->journalIds, (std::vector<int64_t>{7, 9, 12}));
+    EXPECT_EQ(changes->issuerCountries, (std::set<std::string>{"KR"}));
+    EXPECT_EQ(changes->issuerDns.size(), 2u);
+    EXPECT_EQ(changes->issuerSkis, (std::set<std::string>{"a1b2"}));
+    EXPECT_EQ(changes->crlCountries, (std::set<std::string>{"DE"}));
+    EXPECT_TRUE(changes->hasIssuerChanges());
+}
+
+TEST(RevalidationChanges, Journal_Unavailable_ReturnsNullopt) {
+    FakeQueryExecutor db;
+    db.failJournal = true;
+    ValidationRepository repo(&db);
+    EXPECT_FALSE(repo.findRevalidationChanges().has_value());
+}
+
+TEST(RevalidationChanges, Delete_ConsumesExactlyReadIds) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    EXPECT_EQ(repo.deleteRevalidationChanges({7, 9, 12, 42}), 3);
+    ASSERT_EQ(db.queries.size(), 1u);
+    EXPECT_NE(db.queries.back().find("DELETE FROM revalidation_change_journal WHERE id IN ($1, $2, $3, $4)"),
+              std::string::npos);
+    EXPECT_EQ(db.lastParams, (std::vector<std::string>{"7", "9", "12", "42"}));
+}
+
+TEST(RevalidationChanges, Delete_LargeIdList_Chunked) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    std::vector<int64_t> ids;
+    for (int64_t i = 1; i <= 600; ++i) ids.push_back(i);
+    repo.deleteRevalidationChanges(ids);
+    EXPECT_EQ(db.queries.size(), 4u);  // 500 + 64 + 32 + 4 (bucketedChunkSizes)
+    EXPECT_EQ(db.lastParams.back(), "600");
+}
+
+TEST(RevalidationChanges, Delete_NoIds_NoQuery) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    EXPECT_EQ(repo.deleteRevalidationChanges({}), 0);
+    EXPECT_TRUE(db.queries.empty());
+}
+
+// =============================================================================
+// Scoped DSC lookups
+// =============================================================================
+
+TEST(RevalidationChanges, TrustChainScope_MatchesCountryDnAndAki) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    RevalidationChanges changes;
+    changes.issuerCountries = {"KR"};
+    changes.issuerDns = {"CN=CSCA-KOREA,O=Government,C=KR"};
+    changes.issuerSkis = {"a1b2", "c3d4"};
+
+    repo.findDscsForTrustChainRevalidation(changes);
+    const auto& sql = db.queries.back();
+    EXPECT_NE(sql.find("AND (vr.country_code IN ($1) OR c.issuer_dn IN ($2) "
+                       "OR c.authority_key_identifier IN ($3, $4))"), std::string::npos);
+    EXPECT_EQ(db.lastParams, (std::vector<std::string>{"KR", "CN=CSCA-KOREA,O=Government,C=KR", "a1b2", "c3d4"}));
+}
+
+TEST(RevalidationChanges, TrustChainScope_NoIssuerChanges_NoQuery) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    RevalidationChanges changes;
+    changes.crlCountries = {"DE"};
+
+    EXPECT_TRUE(repo.findDscsForTrustChainRevalidation(changes).empty());
+    EXPECT_TRUE(db.queries.empty());
+}
+
+TEST(RevalidationChanges, CrlScope_FiltersByCountry) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+
+    repo.findDscsForCrlRecheck(std::set<std::string>{"DE", "FR"});
+    EXPECT_NE(db.queries.back().find("AND vr.country_code IN ($1, $2)"), std::string::npos);
+
+    size_t before = db.queries.size();
+    EXPECT_EQ(repo.findDscsForCrlRecheck(std::set<std::string>{}).size(), 0u);
+    EXPECT_EQ(db.queries.size(), before);
+}
+
+TEST(RevalidationChanges, FullScope_Unfiltered) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    repo.findDscsForCrlRecheck();
+    EXPECT_EQ(db.queries.back().find("IN ($"), std::string::npos);
+}
+
+TEST(RevalidationChanges, CrlScope_ReturnsDerRows) {
+    FakeQueryExecutor db;
+    db.dbType = "oracle";
+    Json::Value row;
+    row["id"] = "v1";
+    row["certificate_id"] = "c1";
+    row["country_code"] = "DE";
+    row["certificate_data"] = "\\x3082";
+    db.dscRows.append(row);
+    ValidationRepository repo(&db);
+
+    auto dscs = repo.findDscsForCrlRecheck(std::set<std::string>{"DE"});
+    EXPECT_EQ(db.queries.back().find("RAWTOHEX"), std::string::npos);
+    ASSERT_EQ(dscs.size(), 1u);
+    EXPECT_EQ(dscs[0].id, "v1");
+    EXPECT_EQ(dscs[0].countryCode, "DE");
+    EXPECT_TRUE(dscs[0].issuerDn.empty());
+    EXPECT_EQ(dscs[0].certificateDer, (std::vector<uint8_t>{0x30, 0x82}));
+}
+
+// =============================================================================
+// Full sweep schedule
+// =============================================================================
+
+TEST(RevalidationChanges, FullSweepWindow_UsesDialectInterval) {
+    FakeQueryExecutor db;
+    db.scalar = 1;
+    ValidationRepository repo(&db);
+    EXPECT_TRUE(repo.hasFullRevalidationWithin(168));
+    EXPECT_NE(db.queries.back().find("run_mode = 'FULL' AND executed_at > NOW() - INTERVAL '168 hours'"),
+              std::string::npos);
+
+    db.dbType = "oracle";
+    db.scalar = 0;
+    EXPECT_FALSE(repo.hasFullRevalidationWithin(168));
+    EXPECT_NE(db.queries.back().find("SYSTIMESTAMP - INTERVAL '168' HOUR"), std::string::npos);
+}
+
+// =============================================================================
+// Bulk status updates
+// =============================================================================
+
+TEST(RevalidationChanges, TrustChainBatch_PostgresUpdateFromValues) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    std::vector<TrustChainStatusUpdate> updates = {
+        {"id-1", "VALID", true, "ok"},
+        {"id-2", "EXPIRED_VALID", true, "expired"},
+    };
+
+    repo.updateTrustChainStatusBatch(updates);
+    ASSERT_EQ(db.queries.size(), 1u);
+    EXPECT_NE(db.queries[0].find("FROM (VALUES ($1, $2, $3, $4), ($5, $6, $7, $8)) "
+                                 "AS v(id, status, csca_found, message) WHERE vr.id = v.id::uuid"),
+              std::string::npos);
+    EXPECT_EQ(db.lastParams, (std::vector<std::string>{
+        "id-1", "VALID", "TRUE", "ok", "id-2", "EXPIRED_VALID", "TRUE", "expired"}));
+}
+
+TEST(RevalidationChanges, TrustChainBatch_ChunksLargeInput) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    std::vector<TrustChainStatusUpdate> updates(ValidationRepository::kStatusUpdateChunk + 1,
+                                                {"id", "VALID", true, ""});
+    repo.updateTrustChainStatusBatch(updates);
+    ASSERT_EQ(db.queries.size(), 2u);
+    EXPECT_EQ(db.lastParams.size(), 4u);
+}
+
+TEST(RevalidationChanges, CrlBatch_RemainderSplitIntoFixedSizes) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    std::vector<CrlStatusUpdate> updates(ValidationRepository::kStatusUpdateChunk + 3,
+                                         {"id", "INVALID", "Revoked"});
+    repo.updateCrlStatusBatch(updates);
+    ASSERT_EQ(db.queries.size(), 3u);  // 500, 2, 1
+    EXPECT_NE(db.queries[1].find("(VALUES ($1, $2, $3), ($4, $5, $6)) "), std::string::npos);
+    EXPECT_EQ(db.lastParams.size(), 3u);
+}
+
+TEST(RevalidationChanges, CrlBatch_OracleUsesArrayDml) {
+    FakeQueryExecutor db;
+    db.dbType = "oracle";
+    ValidationRepository repo(&db);
+    std::vector<CrlStatusUpdate> updates = {
+        {"id-1", "INVALID", "Revoked (keyCompromise)"},
+        {"id-2", "INVALID", "Revoked (unspecified)"},
+    };
+
+    EXPECT_EQ(repo.updateCrlStatusBatch(updates), 2);
+    ASSERT_EQ(db.batchRows.size(), 1u);
+    EXPECT_EQ(db.batchRows[0][1], (std::vector<std::string>{"INVALID", "Revoked (unspecified)", "id-2"}));
+    EXPECT_NE(db.queries.back().find("WHERE id = $3"), std::string::npos);
+}
+
+TEST(RevalidationChanges, Batch_EmptyInput_NoQuery) {
+    FakeQueryExecutor db;
+    ValidationRepository repo(&db);
+    EXPECT_EQ(repo.updateTrustChainStatusBatch({}), 0);
+    EXPECT_EQ(repo.updateCrlStatusBatch({}), 0);
+    EXPECT_TRUE(db.queries.empty());
+}
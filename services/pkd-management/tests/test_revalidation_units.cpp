@@ -0,0 +1,134 @@
+/**
+ * @file test_revalidation_units.cpp
+ * @brief Unit tests for the revalidation work partitioning
+ *        (partitionByCountry, forEachUnit)
+ *
+ * Pure functions over row indexes; no database connection is required.
+ */
+
+#include <gtest/gtest.h>
+#include "../src/sync/services/revalidation_units.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using icao::relay::services::forEachUnit;
+using icao::relay::services::kMinUnitRows;
+using icao::relay::services::partitionByCountry;
+
+namespace {
+
+/// Row i belongs to countries[i]
+std::vector<std::string> rowsOf(const std::vector<std::pair<std::string, size_t>>& counts) {
+    std::vector<std::string> countries;
+    for (const auto& [country, n] : counts) {
+        countries.insert(countries.end(), n, country);
+    }
+    return countries;
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// partitionByCountry
+// =============================================================================
+
+TEST(RevalidationUnits, Partition_SmallCountriesStayWhole) {
+    auto countries = rowsOf({{"KR", 10}, {"DE", 30}, {"FR", 20}});
+    auto units = partitionByCountry(countries.size(),
+                                    [&](size_t i) { return countries[i]; }, 4);
+
+    ASSERT_EQ(units.size(), 3u);
+    for (const auto& unit : units) {
+        std::set<std::string> inUnit;
+        for (size_t i : unit) inUnit.insert(countries[i]);
+        EXPECT_EQ(inUnit.size(), 1u);
+    }
+}
+
+TEST(RevalidationUnits, Partition_LargeCountrySplitAtThreshold) {
+    // 1000 rows, 4 workers: maxUnit = max(64, 1000 / 16 + 1) = 63 -> 64
+    auto countries = rowsOf({{"US", 990}, {"KR", 10}});
+    auto units = partitionByCountry(countries.size(),
+                                    [&](size_t i) { return countries[i]; }, 4);
+
+    size_t usUnits = 0;
+    size_t covered = 0;
+    for (const auto& unit : units) {
+        EXPECT_LE(unit.size(), kMinUnitRows);
+        if (countries[unit.front()] == "US") usUnits++;
+        covered += unit.size();
+    }
+    EXPECT_EQ(usUnits, 16u);  // ceil(990 / 64)
+    EXPECT_EQ(covered, countries.size());
+}
+
+TEST(RevalidationUnits, Partition_ThresholdGrowsWithRowCount) {
+    // 10000 rows, 2 workers: maxUnit = 10000 / 8 + 1 = 1251
+    auto countries = rowsOf({{"US", 10000}});
+    auto units = partitionByCountry(countries.size(),
+                                    [&](size_t i) { return countries[i]; }, 2);
+
+    ASSERT_EQ(units.size(), 8u);
+    EXPECT_EQ(units.front().size(), 1251u);
+    EXPECT_EQ(units.back().size(), 10000u - 7 * 1251u);
+}
+
+TEST(RevalidationUnits, Partition_LargestUnitFirst) {
+    auto countries = rowsOf({{"AA", 5}, {"BB", 40}, {"CC", 12}, {"DD", 40}});
+    auto units = partitionByCountry(countries.size(),
+                                    [&](size_t i) { return countries[i]; }, 4);
+
+    ASSERT_EQ(units.size(), 4u);
+    EXPECT_TRUE(std::is_sorted(units.begin(), units.end(),
+                               [](const auto& a, const auto& b) { return a.size() > b.size(); }));
+    // Equal sizes keep country order (stable sort)
+    EXPECT_EQ(countries[units[0].front()], "BB");
+    EXPECT_EQ(countries[units[1].front()], "DD");
+    EXPECT_EQ(countries[units[3].front()], "AA");
+}
+
+TEST(RevalidationUnits, Partition_Empty_NoUnits) {
+    EXPECT_TRUE(partitionByCountry(0, [](size_t) { return std::string("KR"); }, 4).empty());
+}
+
+// =============================================================================
+// forEachUnit
+// =============================================================================
+
+TEST(RevalidationUnits, ForEach_SingleWorker_RunsEveryUnitOnCaller) {
+    std::vector<int> runs(10, 0);
+    std::set<std::thread::id> threads;
+    forEachUnit(runs.size(), 1, [&](size_t u) {
+        runs[u]++;
+        threads.insert(std::this_thread::get_id());
+    });
+
+    EXPECT_EQ(runs, std::vector<int>(10, 1));
+    EXPECT_EQ(threads, (std::set<std::thread::id>{std::this_thread::get_id()}));
+}
+
+TEST(RevalidationUnits, ForEach_ManyWorkers_RunsEveryUnitOnce) {
+    std::vector<std::atomic<int>> runs(200);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    forEachUnit(runs.size(), 4, [&](size_t u) {
+        runs[u]++;
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    for (const auto& count : runs) EXPECT_EQ(count.load(), 1);
+    EXPECT_LE(threads.size(), 4u);
+}
+
+TEST(RevalidationUnits, ForEach_NoUnits_NoCalls) {
+    int calls = 0;
+    forEachUnit(0, 4, [&](size_t) { calls++; });
+    EXPECT_EQ(calls, 0);
+}
@@ -0,0 +1,241 @@
+/**
+ * @file test_zip_stream_writer.cpp
+ * @brief Unit tests for common::ZipStreamWriter
+ *
+ * Archives are written to memory and read back by walking the ZIP records
+ * directly (local headers, central directory, end records) and inflating
+ * deflated entries with zlib.
+ */
+
+#include <gtest/gtest.h>
+#include "../src/common/zip_stream_writer.h"
+
+#include <zlib.h>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using common::ZipStreamWriter;
+
+namespace {
+
+uint16_t read16(const std::string& s, size_t pos) {
+    return static_cast<uint16_t>(static_cast<unsigned char>(s[pos]) |
+                                 (static_cast<unsigned char>(s[pos + 1]) << 8));
+}
+
+uint32_t read32(const std::string& s, size_t pos) {
+    return read16(s, pos) | (static_cast<uint32_t>(read16(s, pos + 2)) << 16);
+}
+
+uint64_t read64(const std::string& s, size_t pos) {
+    return read32(s, pos) | (static_cast<uint64_t>(read32(s, pos + 4)) << 32);
+}
+
+struct LocalEntry {
+    std::string name;
+    uint16_t method;
+    uint32_t crc;
+    std::string content;  // Decompressed
+};
+
+/// Parse the local entry at offset and return its decompressed content
+LocalEntry readLocalEntry(const std::string& zip, size_t offset) {
+    EXPECT_EQ(read32(zip, offset), 0x04034b50u);
+    LocalEntry e;
+    e.method = read16(zip, offset + 8);
+    e.crc = read32(zip, offset + 14);
+    uint32_t compressed = read32(zip, offset + 18);
+    uint32_t uncompressed = read32(zip, offset + 22);
+    uint16_t nameLen = read16(zip, offset + 26);
+    uint16_t extraLen = read16(zip, offset + 28);
+    e.name = zip.substr(offset + 30, nameLen);
+    std::string payload = zip.substr(offset + 30 + nameLen + extraLen, compressed);
+
+    if (e.method == 0) {
+        e.content = payload;
+    } else {
+        e.content.resize(uncompressed);
+        z_stream zs{};
+        inflateInit2(&zs, -MAX_WBITS);
+        zs.next_in = reinterpret_cast<Bytef*>(payload.data());
+        zs.avail_in = static_cast<uInt>(payload.size());
+        zs.next_out = reinterpret_cast<Bytef*>(e.content.data());
+        zs.avail_out = static_cast<uInt>(e.content.size());
+        EXPECT_EQ(inflate(&zs, Z_FINISH), Z_STREAM_END);
+        inflateEnd(&zs);
+    }
+    return e;
+}
+
+uint32_t crcOf(const std::string& data) {
+    return static_cast<uint32_t>(crc32(0L, reinterpret_cast<const Bytef*>(data.data()),
+                                       static_cast<uInt>(data.size())));
+}
+
+std::vector<uint8_t> bytes(const std::string& s) {
+    return std::vector<uint8_t>(s.begin(), s.end());
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// Entries
+// =============================================================================
+
+TEST(ZipStreamWriter, Store_WritesEntryVerbatim) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; },
+                           ZipStreamWriter::Method::Store);
+    std::string body = "-----BEGIN CERTIFICATE-----\nMIIB\n-----END CERTIFICATE-----\n";
+    ASSERT_TRUE(writer.addFile("data/KR/csca/test.pem", bytes(body)));
+    writer.finish();
+
+    auto entry = readLocalEntry(zip, 0);
+    EXPECT_EQ(entry.name, "data/KR/csca/test.pem");
+    EXPECT_EQ(entry.method, 0);
+    EXPECT_EQ(entry.content, body);
+    EXPECT_EQ(entry.crc, crcOf(body));
+    EXPECT_EQ(writer.bytesWritten(), zip.size());
+}
+
+TEST(ZipStreamWriter, Deflate_CompressibleEntryRoundTrips) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; });
+    std::string body(4096, 'A');
+    ASSERT_TRUE(writer.addFile("a.txt", bytes(body)));
+    writer.finish();
+
+    auto entry = readLocalEntry(zip, 0);
+    EXPECT_EQ(entry.method, 8);
+    EXPECT_EQ(entry.content, body);
+    EXPECT_EQ(entry.crc, crcOf(body));
+    EXPECT_LT(zip.size(), body.size());
+}
+
+TEST(ZipStreamWriter, Deflate_IncompressibleEntryIsStored) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; });
+    std::mt19937 rng(42);
+    std::string body(2048, '\0');
+    for (auto& c : body) c = static_cast<char>(rng() & 0xFF);
+    ASSERT_TRUE(writer.addFile("random.der", bytes(body)));
+    writer.finish();
+
+    auto entry = readLocalEntry(zip, 0);
+    EXPECT_EQ(entry.method, 0);
+    EXPECT_EQ(entry.content, body);
+}
+
+TEST(ZipStreamWriter, DuplicateName_Skipped) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; });
+    EXPECT_TRUE(writer.addFile("x.pem", bytes("one")));
+    EXPECT_FALSE(writer.addFile("x.pem", bytes("two")));
+    EXPECT_EQ(writer.entryCount(), 1u);
+}
+
+TEST(ZipStreamWriter, EmptyEntry_Allowed) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; });
+    EXPECT_TRUE(writer.addFile("empty", nullptr, 0));
+    writer.finish();
+    auto entry = readLocalEntry(zip, 0);
+    EXPECT_EQ(entry.content, "");
+    EXPECT_EQ(entry.crc, 0u);
+}
+
+TEST(ZipStreamWriter, AddAfterFinish_Throws) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; });
+    writer.finish();
+    EXPECT_THROW(writer.addFile("late", bytes("x")), std::runtime_error);
+}
+
+// =============================================================================
+// Central directory / end records
+// =============================================================================
+
+TEST(ZipStreamWriter, CentralDirectory_ListsEveryEntry) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; });
+    std::vector<std::string> names = {"data/KR/csca/a.pem", "data/KR/dsc/b.pem", "nc-data/JP/dsc/c.pem"};
+    for (const auto& name : names) {
+        writer.addFile(name, bytes("content of " + name));
+    }
+    writer.finish();
+
+    ASSERT_GE(zip.size(), 22u);
+    size_t eocd = zip.size() - 22;
+    ASSERT_EQ(read32(zip, eocd), 0x06054b50u);
+    EXPECT_EQ(read16(zip, eocd + 10), names.size());
+    uint32_t cdSize = read32(zip, eocd + 12);
+    uint32_t cdOffset = read32(zip, eocd + 16);
+    EXPECT_EQ(cdOffset + cdSize, eocd);
+
+    size_t pos = cdOffset;
+    for (const auto& name : names) {
+        ASSERT_EQ(read32(zip, pos), 0x02014b50u);
+        uint16_t nameLen = read16(zip, pos + 28);
+        uint16_t extraLen = read16(zip, pos + 30);
+        uint32_t localOffset = read32(zip, pos + 42);
+        EXPECT_EQ(zip.substr(pos + 46, nameLen), name);
+
+        auto entry = readLocalEntry(zip, localOffset);
+        EXPECT_EQ(entry.name, name);
+        EXPECT_EQ(entry.content, "content of " + name);
+        EXPECT_EQ(read32(zip, pos + 16), entry.crc);
+        pos += 46 + nameLen + extraLen;
+    }
+}
+
+TEST(ZipStreamWriter, ManyEntries_WritesZip64EndRecords) {
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) { zip.append(d, n); return true; },
+                           ZipStreamWriter::Method::Store);
+    const size_t count = 70000;
+    for (size_t i = 0; i < count; ++i) {
+        writer.addFile("e" + std::to_string(i), bytes("x"));
+    }
+    writer.finish();
+
+    size_t eocd = zip.size() - 22;
+    ASSERT_EQ(read32(zip, eocd), 0x06054b50u);
+    EXPECT_EQ(read16(zip, eocd + 10), 0xFFFF);
+
+    size_t locator = eocd - 20;
+    ASSERT_EQ(read32(zip, locator), 0x07064b50u);
+    uint64_t zip64End = read64(zip, locator + 8);
+    ASSERT_EQ(read32(zip, zip64End), 0x06064b50u);
+    EXPECT_EQ(read64(zip, zip64End + 32), count);
+}
+
+// =============================================================================
+// Sink behaviour
+// =============================================================================
+
+TEST(ZipStreamWriter, Sink_ReceivesBoundedChunks) {
+    std::vector<size_t> chunks;
+    std::string zip;
+    ZipStreamWriter writer([&](const char* d, size_t n) {
+        chunks.push_back(n);
+        zip.append(d, n);
+        return true;
+    }, ZipStreamWriter::Method::Store, 1024);
+
+    for (int i = 0; i < 20; ++i) {
+        writer.addFile("f" + std::to_string(i), bytes(std::string(500, 'x')));
+    }
+    EXPECT_FALSE(chunks.empty());  // Output starts before finish()
+    writer.finish();
+
+    for (size_t n : chunks) EXPECT_LE(n, 1024u);
+    EXPECT_EQ(writer.bytesWritten(), zip.size());
+}
+
+TEST(ZipStreamWriter, SinkAbort_Throws) {
+    ZipStreamWriter writer([](const char*, size_t) { return false; }, ZipStreamWriter::Method::Store, 64);
+    EXPECT_THROW(writer.addFile("big", bytes(std::string(1000, 'x'))), std::runtime_error);
+}
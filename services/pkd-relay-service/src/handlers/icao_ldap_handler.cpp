@@ -5,7 +5,7 @@
 #include "icao_ldap_handler.h"
 #include "../relay/icao-ldap/icao_ldap_sync_service.h"
 #include "upload/upload_services.h"
-#include "upload/common/thread_pool.h"
+#include "thread_pool.h"
 #include <spdlog/spdlog.h>
 
 namespace icao {
@@ -14,6 +14,9 @@
 #include "db_connection_pool.h"
 #include "db_connection_pool_factory.h"
 #include <ldap_connection_pool.h>
+#include "blocking_executor.h"
+#include <icao/audit/audit_sink.h>
+#include <icao/validation/crl_cache.h>
 
 // Shared repositories (ICAO LDAP sync + upload module)
 #include "../repositories/certificate_repository.h"
@@ -28,6 +31,8 @@ struct ServiceContainer::Impl {
     std::shared_ptr<common::IDbConnectionPool> dbPool;
     std::unique_ptr<common::IQueryExecutor> queryExecutor;
     std::shared_ptr<common::LdapConnectionPool> ldapPool;
+    std::unique_ptr<common::BlockingExecutor> blockingExecutor;
+    std::unique_ptr<icao::audit::AsyncAuditSink> auditSink;
 
     // Shared repositories
     std::shared_ptr<icao::relay::repositories::CertificateRepository> certificateRepo;
@@ -61,9 +66,16 @@ bool ServiceContainer::initialize(icao::relay::Config& config) {
         }
         spdlog::info("{} Query Executor created", dbType == "postgres" ? "PostgreSQL" : "Oracle");
 
+        // Audit rows are queued and written in batches (AUDIT_SINK_*)
+        auto auditConfig = icao::audit::AsyncAuditSink::Config::fromEnvironment({});
+        if (auditConfig.enabled) {
+            impl_->auditSink = std::make_unique<icao::audit::AsyncAuditSink>(impl_->queryExecutor.get(), auditConfig);
+            icao::audit::setAuditSink(impl_->auditSink.get());
+        }
+
         // Step 3: LDAP Connection Pool
         int ldapPoolMin = 2, ldapPoolMax = 10, ldapPoolTimeout = 5;
-        int ldapNetworkTimeout = 5, ldapHealthCheckTimeout = 2;
+        int ldapNetworkTimeout = 5, ldapHealthCheckTimeout = 2, ldapIdleValidation = 0;
         auto safeStoi = [](const char* v, int defaultVal) {
             try { return std::stoi(v); } catch (...) { return defaultVal; }
         };
@@ -72,17 +84,24 @@ bool ServiceContainer::initialize(icao::relay::Config& config) {
         if (auto* v = std::getenv("LDAP_POOL_TIMEOUT")) ldapPoolTimeout = safeStoi(v, ldapPoolTimeout);
         if (auto* v = std::getenv("LDAP_NETWORK_TIMEOUT")) ldapNetworkTimeout = safeStoi(v, ldapNetworkTimeout);
         if (auto* v = std::getenv("LDAP_HEALTH_CHECK_TIMEOUT")) ldapHealthCheckTimeout = safeStoi(v, ldapHealthCheckTimeout);
+        if (auto* v = std::getenv("LDAP_POOL_IDLE_VALIDATION_SEC")) ldapIdleValidation = safeStoi(v, ldapIdleValidation);
 
         std::string ldapUri = "ldap://" + config.ldapWriteHost + ":" + std::to_string(config.ldapWritePort);
         impl_->ldapPool = std::make_shared<common::LdapConnectionPool>(
             ldapUri, config.ldapBindDn, config.ldapBindPassword,
-            ldapPoolMin, ldapPoolMax, ldapPoolTimeout, ldapNetworkTimeout, ldapHealthCheckTimeout);
+            ldapPoolMin, ldapPoolMax, ldapPoolTimeout, ldapNetworkTimeout, ldapHealthCheckTimeout, ldapIdleValidation);
         if (!impl_->ldapPool->initialize()) {
             spdlog::critical("Failed to initialize LDAP connection pool");
             return false;
         }
         spdlog::info("LDAP connection pool initialized ({})", ldapUri);
 
+        // Parsed CRL cache; uploads and ICAO LDAP sync invalidate on CRL insert
+        if (auto* v = std::getenv("CRL_CACHE_TTL_SECONDS")) {
+            icao::validation::CrlCache::instance().setTtl(
+                std::chrono::seconds(std::max(0, safeStoi(v, 300))));
+        }
+
         // Step 4: Shared repositories
         impl_->certificateRepo = std::make_shared<icao::relay::repositories::CertificateRepository>(impl_->queryExecutor.get());
         impl_->crlRepo = std::make_shared<icao::relay::repositories::CrlRepository>(impl_->queryExecutor.get());
@@ -97,6 +116,10 @@ bool ServiceContainer::initialize(icao::relay::Config& config) {
             spdlog::info("ICAO LDAP Sync disabled (ICAO_LDAP_SYNC_ENABLED=false)");
         }
 
+        // Step 6: Executor for blocking handler work (BLOCKING_EXECUTOR_* overrides)
+        impl_->blockingExecutor = std::make_unique<common::BlockingExecutor>(
+            common::BlockingExecutor::Config::fromEnvironment(common::BlockingExecutor::Config{}));
+
         spdlog::info("PKD Relay Service dependencies initialized");
         return true;
     } catch (const std::exception& e) {
@@ -107,6 +130,14 @@ bool ServiceContainer::initialize(icao::relay::Config& config) {
 
 void ServiceContainer::shutdown() {
     if (!impl_) return;
+    // Finish in-flight handler work while the repositories it calls still exist
+    if (impl_->blockingExecutor) impl_->blockingExecutor->shutdown();
+    // Later audit events are written inline; queued ones are flushed now
+    if (impl_->auditSink) {
+        icao::audit::setAuditSink(nullptr);
+        impl_->auditSink->shutdown();
+        impl_->auditSink.reset();
+    }
     impl_->icaoLdapSyncService.reset();
     impl_->validationRepo.reset();
     impl_->crlRepo.reset();
@@ -121,6 +152,7 @@ void ServiceContainer::shutdown() {
 common::IDbConnectionPool* ServiceContainer::dbPool() const { return impl_->dbPool.get(); }
 common::IQueryExecutor* ServiceContainer::queryExecutor() const { return impl_->queryExecutor.get(); }
 common::LdapConnectionPool* ServiceContainer::ldapPool() const { return impl_->ldapPool.get(); }
+common::BlockingExecutor* ServiceContainer::blockingExecutor() const { return impl_->blockingExecutor.get(); }
 icao::relay::repositories::CertificateRepository* ServiceContainer::certificateRepository() const { return impl_->certificateRepo.get(); }
 icao::relay::repositories::CrlRepository* ServiceContainer::crlRepository() const { return impl_->crlRepo.get(); }
 icao::relay::repositories::ValidationRepository* ServiceContainer::validationRepository() const { return impl_->validationRepo.get(); }
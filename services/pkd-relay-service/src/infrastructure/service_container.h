@@ -17,6 +17,7 @@ namespace common {
     class IDbConnectionPool;
     class IQueryExecutor;
     class LdapConnectionPool;
+    class BlockingExecutor;
 }
 
 // Shared repositories (used by ICAO LDAP sync + upload module)
@@ -45,6 +46,7 @@ public:
     common::IDbConnectionPool* dbPool() const;
     common::IQueryExecutor* queryExecutor() const;
     common::LdapConnectionPool* ldapPool() const;
+    common::BlockingExecutor* blockingExecutor() const;  ///< DB/LDAP work off the event loops
 
     // --- Shared Repository Accessors (ICAO LDAP sync + upload module) ---
     icao::relay::repositories::CertificateRepository* certificateRepository() const;
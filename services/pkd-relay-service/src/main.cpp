@@ -28,6 +28,10 @@
 #include "infrastructure/service_container.h"
 #include "db_connection_interface.h"
 #include "ldap_connection_pool.h"
+#include "blocking_offload.h"
+#include "oracle_sql_translator.h"
+#include <icao/audit/audit_sink.h>
+#include <icao/validation/signature_cache.h>
 
 // Handlers
 #include "handlers/health_handler.h"
@@ -303,13 +307,42 @@ paths:
                 result["dbPool"]["available"] = static_cast<Json::UInt>(stats.availableConnections);
                 result["dbPool"]["total"] = static_cast<Json::UInt>(stats.totalConnections);
                 result["dbPool"]["max"] = static_cast<Json::UInt>(stats.maxConnections);
+                result["dbPool"]["acquireCount"] = static_cast<Json::UInt64>(stats.acquireCount);
+                result["dbPool"]["acquireWaitTotalUs"] = static_cast<Json::UInt64>(stats.acquireWaitTotalUs);
+                result["dbPool"]["acquireWaitMaxUs"] = static_cast<Json::UInt64>(stats.acquireWaitMaxUs);
+                result["dbPool"]["healthCheckCount"] = static_cast<Json::UInt64>(stats.healthCheckCount);
+                result["dbPool"]["discardedConnections"] = static_cast<Json::UInt64>(stats.discardedConnections);
+                result["dbPool"]["statementPrepares"] = static_cast<Json::UInt64>(stats.statementPrepares);
+                result["dbPool"]["statementExecutes"] = static_cast<Json::UInt64>(stats.statementExecutes);
             }
             if (g_services && g_services->ldapPool()) {
                 auto stats = g_services->ldapPool()->getStats();
                 result["ldapPool"]["available"] = static_cast<Json::UInt>(stats.availableConnections);
                 result["ldapPool"]["total"] = static_cast<Json::UInt>(stats.totalConnections);
                 result["ldapPool"]["max"] = static_cast<Json::UInt>(stats.maxConnections);
+                result["ldapPool"]["acquireCount"] = static_cast<Json::UInt64>(stats.acquireCount);
+                result["ldapPool"]["acquireWaitTotalUs"] = static_cast<Json::UInt64>(stats.acquireWaitTotalUs);
+                result["ldapPool"]["acquireWaitMaxUs"] = static_cast<Json::UInt64>(stats.acquireWaitMaxUs);
+                result["ldapPool"]["healthCheckCount"] = static_cast<Json::UInt64>(stats.healthCheckCount);
+                result["ldapPool"]["discardedConnections"] = static_cast<Json::UInt64>(stats.discardedConnections);
             }
+            if (g_services && g_services->blockingExecutor()) {
+                result["blockingExecutor"] = common::handler::blockingExecutorMetrics(*g_services->blockingExecutor());
+            }
+            if (auto* sink = icao::audit::auditSink()) {
+                result["auditSink"] = icao::audit::auditSinkMetrics(*sink);
+            }
+            {
+                auto stats = icao::validation::SignatureVerificationCache::instance().stats();
+                result["signatureCache"]["hits"] = static_cast<Json::UInt64>(stats.hits);
+                result["signatureCache"]["misses"] = static_cast<Json::UInt64>(stats.misses);
+                result["signatureCache"]["entries"] = static_cast<Json::UInt64>(stats.entries);
+            }
+            if (g_services && g_services->queryExecutor() &&
+                g_services->queryExecutor()->getDatabaseType() == "oracle") {
+                result["oracleSqlTranslation"] = common::oracleSqlTranslationMetrics(common::OracleSqlTranslator::instance());
+            }
+            result["progressBus"] = common::progressBusMetrics(common::ProgressManager::getInstance().bus());
             callback(HttpResponse::newHttpJsonResponse(result));
         }, {Get});
 
@@ -411,7 +444,9 @@ int main() {
                 g_uploadSC->uploadRepository(),
                 g_uploadSC->certificateRepository(),
                 g_uploadSC->validationRepository(),
-                g_uploadSC->queryExecutor());
+                g_uploadSC->queryExecutor(),
+                100,  // asn1MaxLines (handler default)
+                g_services->blockingExecutor());
 
             // Wire upload handler back to UploadServiceContainer (for processLdifAsync delegation)
             g_uploadSC->setUploadHandler(g_uploadHandler.get());
@@ -10,6 +10,9 @@
 #include <openssl/pem.h>
 #include <openssl/cms.h>
 #include <icao/validation/icao_compliance.h>
+#include <icao/validation/crl_cache.h>
+#include <icao/trust/trust_snapshot_notify.h>
+#include <icao/search/search_summary_notify.h>
 #include <iomanip>
 #include <sstream>
 #include <chrono>
@@ -79,6 +82,7 @@ CertInfo readCertInfo(const std::string& pemPath) {
 
 #include "i_query_executor.h"
 #include "query_helpers.h"
+#include "bulk_writer.h"
 #include <ldap_connection_pool.h>
 #include "../../common/notification_manager.h"
 
@@ -121,7 +125,8 @@ void IcaoLdapSyncService::initValidation() {
     cscaProvider_ = std::make_unique<adapters::RelayCscaProvider>(certRepo_);
     crlProvider_ = std::make_unique<adapters::RelayCrlProvider>(crlRepo_);
     trustChainBuilder_ = std::make_unique<icao::validation::TrustChainBuilder>(cscaProvider_.get());
-    crlChecker_ = std::make_unique<icao::validation::CrlChecker>(crlProvider_.get());
+    crlChecker_ = std::make_unique<icao::validation::CrlChecker>(
+        crlProvider_.get(), &icao::validation::CrlCache::instance());
 
     spdlog::info("[IcaoLdapSync] Validation components initialized (TrustChainBuilder + CrlChecker)");
 }
@@ -403,6 +408,10 @@ IcaoLdapSyncResult IcaoLdapSyncService::performFullSync(const std::string& trigg
 
         spdlog::info("[IcaoLdapSync] Sync completed: new={}, skipped={}, failed={}, duration={}ms",
                     result.newCertificates, result.existingSkipped, result.failedCount, result.durationMs);
+        if (result.newCertificates > 0) {
+            icao::trust::notifyTrustSnapshotChanged("ICAO LDAP sync");
+            icao::search::notifySearchSummaryChanged("ICAO LDAP sync");
+        }
 
         // Broadcast final progress COMPLETED (must come BEFORE the notification bell event)
         currentProgress_.phase = "COMPLETED";
@@ -494,11 +503,11 @@ IcaoLdapSyncService::EntryResult IcaoLdapSyncService::processEntry(const IcaoLda
     return saved ? EntryResult::NEW : EntryResult::FAILED;
 }
 
-void IcaoLdapSyncService::validateAndSaveResult(const IcaoLdapCertEntry& entry,
-                                                const std::string& fingerprint,
-                                                X509* cert) {
-    if (!validationRepo_ || !cert) {
-        if (!validationRepo_) spdlog::warn("[IcaoLdapSync] validateAndSaveResult skipped: validationRepo is null (first call only)");
+void IcaoLdapSyncService::validateAndStageResult(const IcaoLdapCertEntry& entry,
+                                                 const std::string& fingerprint,
+                                                 X509* cert) {
+    if (!validationRepo_ || !cert || !validationResults_ || !validationStatusUpdates_) {
+        if (!validationRepo_) spdlog::warn("[IcaoLdapSync] validateAndStageResult skipped: validationRepo is null (first call only)");
         return;
     }
 
@@ -506,7 +515,7 @@ void IcaoLdapSyncService::validateAndSaveResult(const IcaoLdapCertEntry& entry,
         // Lazy-init validation components
         initValidation();
         if (!trustChainBuilder_ || !crlChecker_) {
-            spdlog::warn("[IcaoLdapSync] validateAndSaveResult skipped: validation components not initialized");
+            spdlog::warn("[IcaoLdapSync] validateAndStageResult skipped: validation components not initialized");
             return;
         }
 
@@ -647,54 +656,9 @@ void IcaoLdapSyncService::validateAndSaveResult(const IcaoLdapCertEntry& entry,
         // Violations string
         std::string violationsStr = icao.violationsString();
 
-        // Save to validation_result — full schema
-        std::string sql;
-        if (dbType == "oracle") {
-            sql = "INSERT INTO validation_result (id, certificate_id, upload_id, "
-                  "certificate_type, country_code, subject_dn, issuer_dn, serial_number, "
-                  "validation_status, trust_chain_valid, trust_chain_message, csca_found, "
-                  "csca_subject_dn, "
-                  "signature_valid, signature_algorithm, "
-                  "validity_period_valid, not_before, not_after, "
-                  "revocation_status, crl_checked, "
-                  "icao_compliant, icao_compliance_level, icao_violations, "
-                  "icao_key_usage_compliant, icao_algorithm_compliant, "
-                  "icao_key_size_compliant, icao_validity_period_compliant, "
-                  "icao_extensions_compliant, "
-                  "validation_timestamp) "
-                  "VALUES (SYS_GUID(), $1, $2, $3, $4, $5, $6, $7, $8, "
-                  + common::db::boolLiteral(dbType, trustChainValid2) + ", $9, "
-                  + common::db::boolLiteral(dbType, cscaFound) + ", $10, "
-                  + common::db::boolLiteral(dbType, signatureValid) + ", $11, "
-                  + common::db::boolLiteral(dbType, validityPeriodValid) + ", $12, $13, "
-                  "$14, " + common::db::boolLiteral(dbType, crlChecked) + ", "
-                  + common::db::boolLiteral(dbType, icao.isCompliant) + ", $15, $16, "
-                  + common::db::boolLiteral(dbType, icao.keyUsageCompliant) + ", "
-                  + common::db::boolLiteral(dbType, icao.algorithmCompliant) + ", "
-                  + common::db::boolLiteral(dbType, icao.keySizeCompliant) + ", "
-                  + common::db::boolLiteral(dbType, icao.validityPeriodCompliant) + ", "
-                  + common::db::boolLiteral(dbType, icao.extensionsCompliant) + ", "
-                  + common::db::currentTimestamp(dbType) + ")";
-        } else {
-            sql = "INSERT INTO validation_result (id, certificate_id, upload_id, "
-                  "certificate_type, country_code, subject_dn, issuer_dn, serial_number, "
-                  "validation_status, trust_chain_valid, trust_chain_message, csca_found, "
-                  "csca_subject_dn, "
-                  "signature_valid, signature_algorithm, "
-                  "validity_period_valid, not_before, not_after, "
-                  "revocation_status, crl_checked, "
-                  "icao_compliant, icao_compliance_level, icao_violations, "
-                  "icao_key_usage_compliant, icao_algorithm_compliant, "
-                  "icao_key_size_compliant, icao_validity_period_compliant, "
-                  "icao_extensions_compliant, "
-                  "validation_timestamp) "
-                  "VALUES (gen_random_uuid(), $1, $2, $3, $4, $5, $6, $7, $8, "
-                  "$9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, "
-                  "$20, $21, $22, $23, $24, $25, $26, $27, NOW()) "
-                  "ON CONFLICT (certificate_id, upload_id) DO NOTHING";
-        }
-
-        std::vector<std::string> params = {
+        // Stage validation_result row (SQL in validationResultInsertSql) and status update
+        auto boolStr = [&dbType](bool val) { return common::db::boolLiteral(dbType, val); };
+        validationResults_->add({
             fingerprint,                              // $1 certificate_id
             std::string("ICAO_PKD_SYNC"),            // $2 upload_id
             entry.certType,                           // $3 certificate_type
@@ -703,49 +667,32 @@ void IcaoLdapSyncService::validateAndSaveResult(const IcaoLdapCertEntry& entry,
             std::string(vrIssuer),                    // $6 issuer_dn
             serialNumber,                             // $7 serial_number
             validationStatus,                         // $8 validation_status
-        };
-
-        if (dbType == "oracle") {
-            // Oracle: booleans are boolLiterals in SQL, only string params here
-            params.push_back(validationMessage);      // $9 trust_chain_message
-            params.push_back(cscaSubjectDn);          // $10 csca_subject_dn
-            params.push_back(sigAlgName);             // $11 signature_algorithm
-            params.push_back(notBeforeStr);           // $12 not_before
-            params.push_back(notAfterStr);            // $13 not_after
-            params.push_back(revocationStatus);       // $14 revocation_status
-            params.push_back(icao.complianceLevel);   // $15 icao_compliance_level
-            params.push_back(violationsStr);          // $16 icao_violations
-        } else {
-            // PostgreSQL: all params including booleans
-            params.push_back(trustChainValid2 ? "true" : "false"); // $9
-            params.push_back(validationMessage);      // $10
-            params.push_back(cscaFound ? "true" : "false"); // $11
-            params.push_back(cscaSubjectDn);          // $12
-            params.push_back(signatureValid ? "true" : "false"); // $13
-            params.push_back(sigAlgName);             // $14
-            params.push_back(validityPeriodValid ? "true" : "false"); // $15
-            params.push_back(notBeforeStr);           // $16
-            params.push_back(notAfterStr);            // $17
-            params.push_back(revocationStatus);       // $18
-            params.push_back(crlChecked ? "true" : "false"); // $19
-            params.push_back(icao.isCompliant ? "true" : "false"); // $20
-            params.push_back(icao.complianceLevel);   // $21
-            params.push_back(violationsStr);          // $22
-            params.push_back(icao.keyUsageCompliant ? "true" : "false"); // $23
-            params.push_back(icao.algorithmCompliant ? "true" : "false"); // $24
-            params.push_back(icao.keySizeCompliant ? "true" : "false"); // $25
-            params.push_back(icao.validityPeriodCompliant ? "true" : "false"); // $26
-            params.push_back(icao.extensionsCompliant ? "true" : "false"); // $27
-        }
-        queryExecutor_->executeQuery(sql, params);
+            boolStr(trustChainValid2),                // $9 trust_chain_valid
+            validationMessage,                        // $10 trust_chain_message
+            boolStr(cscaFound),                       // $11 csca_found
+            cscaSubjectDn,                            // $12 csca_subject_dn
+            boolStr(signatureValid),                  // $13 signature_valid
+            sigAlgName,                               // $14 signature_algorithm
+            boolStr(validityPeriodValid),             // $15 validity_period_valid
+            notBeforeStr,                             // $16 not_before
+            notAfterStr,                              // $17 not_after
+            revocationStatus,                         // $18 revocation_status
+            boolStr(crlChecked),                      // $19 crl_checked
+            boolStr(icao.isCompliant),                // $20 icao_compliant
+            icao.complianceLevel,                     // $21 icao_compliance_level
+            violationsStr,                            // $22 icao_violations
+            boolStr(icao.keyUsageCompliant),          // $23
+            boolStr(icao.algorithmCompliant),         // $24
+            boolStr(icao.keySizeCompliant),           // $25
+            boolStr(icao.validityPeriodCompliant),    // $26
+            boolStr(icao.extensionsCompliant)         // $27
+        });
 
         // Update certificate validation_status
-        queryExecutor_->executeQuery(
-            "UPDATE certificate SET validation_status = $1 WHERE fingerprint_sha256 = $2",
-            {validationStatus, fingerprint});
+        validationStatusUpdates_->add({validationStatus, fingerprint});
 
     } catch (const std::exception& e) {
-        spdlog::warn("[IcaoLdapSync] validateAndSaveResult failed for {}: {}", fingerprint, e.what());
+        spdlog::warn("[IcaoLdapSync] validateAndStageResult failed for {}: {}", fingerprint, e.what());
     }
 }
 
@@ -830,23 +777,25 @@ void IcaoLdapSyncService::flushDuplicateBatch() {
 
     try {
         std::string dbType = queryExecutor_->getDatabaseType();
+        std::string sql;
+        if (dbType == "oracle") {
+            sql = "INSERT INTO certificate_duplicates "
+                  "(id, certificate_id, upload_id, source_type, source_country, detected_at) "
+                  "VALUES (SEQ_CERT_DUPLICATES.NEXTVAL, $1, $2, $3, $4, "
+                  + common::db::currentTimestamp(dbType) + ")";
+        } else {
+            sql = "INSERT INTO certificate_duplicates "
+                  "(certificate_id, upload_id, source_type, source_country, detected_at) "
+                  "VALUES ($1, $2, $3, $4, NOW()) "
+                  "ON CONFLICT DO NOTHING";
+        }
+
+        // One multi-row INSERT / array execute; rejected rows are retried one by one
+        common::BulkWriter writer(queryExecutor_, sql, duplicateBatch_.size());
         for (const auto& dup : duplicateBatch_) {
-            std::string sql;
-            if (dbType == "oracle") {
-                sql = "INSERT INTO certificate_duplicates "
-                      "(id, certificate_id, upload_id, source_type, source_country, detected_at) "
-                      "VALUES (SEQ_CERT_DUPLICATES.NEXTVAL, $1, $2, $3, $4, "
-                      + common::db::currentTimestamp(dbType) + ")";
-            } else {
-                sql = "INSERT INTO certificate_duplicates "
-                      "(certificate_id, upload_id, source_type, source_country, detected_at) "
-                      "VALUES ($1, $2, $3, $4, NOW()) "
-                      "ON CONFLICT DO NOTHING";
-            }
-            queryExecutor_->executeQuery(sql, {
-                dup.certId, dup.uploadId, dup.sourceType, dup.countryCode
-            });
+            writer.add({dup.certId, dup.uploadId, dup.sourceType, dup.countryCode});
         }
+        writer.flush();
     } catch (const std::exception& e) {
         spdlog::warn("[IcaoLdapSync] flushDuplicateBatch failed: {}", e.what());
     }
@@ -857,18 +806,61 @@ void IcaoLdapSyncService::flushDuplicateBatch() {
 // P3: Batch validation result flush
 // =============================================================================
 
+namespace {
+
+/// validation_result INSERT shared by all staged rows (27 params, booleans bound as literals)
+std::string validationResultInsertSql(const std::string& dbType) {
+    std::string sql =
+        "INSERT INTO validation_result (id, certificate_id, upload_id, "
+        "certificate_type, country_code, subject_dn, issuer_dn, serial_number, "
+        "validation_status, trust_chain_valid, trust_chain_message, csca_found, "
+        "csca_subject_dn, "
+        "signature_valid, signature_algorithm, "
+        "validity_period_valid, not_before, not_after, "
+        "revocation_status, crl_checked, "
+        "icao_compliant, icao_compliance_level, icao_violations, "
+        "icao_key_usage_compliant, icao_algorithm_compliant, "
+        "icao_key_size_compliant, icao_validity_period_compliant, "
+        "icao_extensions_compliant, "
+        "validation_timestamp) VALUES (";
+    sql += (dbType == "oracle") ? "SYS_GUID(), " : "gen_random_uuid(), ";
+    sql += "$1, $2, $3, $4, $5, $6, $7, $8, "
+           "$9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, "
+           "$20, $21, $22, $23, $24, $25, $26, $27, "
+           + common::db::currentTimestamp(dbType) + ")";
+    if (dbType != "oracle") {
+        sql += " ON CONFLICT (certificate_id, upload_id) DO NOTHING";
+    }
+    return sql;
+}
+
+} // anonymous namespace
+
 void IcaoLdapSyncService::flushValidationBatch() {
     if (validationBatch_.empty()) return;
 
+    if (!validationResults_ && queryExecutor_) {
+        std::string dbType = queryExecutor_->getDatabaseType();
+        validationResults_ = std::make_unique<common::BulkWriter>(
+            queryExecutor_, validationResultInsertSql(dbType));
+        validationStatusUpdates_ = std::make_unique<common::BulkWriter>(
+            queryExecutor_, "UPDATE certificate SET validation_status = $1 WHERE fingerprint_sha256 = $2");
+    }
+
     for (auto& ve : validationBatch_) {
         const uint8_t* p = ve.derData.data();
         X509* cert = d2i_X509(nullptr, &p, static_cast<long>(ve.derData.size()));
         if (cert) {
-            validateAndSaveResult(ve.entry, ve.fingerprint, cert);
+            validateAndStageResult(ve.entry, ve.fingerprint, cert);
             X509_free(cert);
         }
     }
     validationBatch_.clear();
+
+    if (validationResults_) {
+        validationResults_->flush();
+        validationStatusUpdates_->flush();
+    }
 }
 
 std::string IcaoLdapSyncService::computeFingerprint(const std::vector<uint8_t>& derData) const {
@@ -1213,6 +1205,7 @@ bool IcaoLdapSyncService::saveCrlToDb(const IcaoLdapCertEntry& entry,
             thisUpdate, nextUpdate, crlNumber, hexData,
             std::string("ICAO_PKD_SYNC")
         });
+        icao::validation::CrlCache::instance().invalidate(entry.countryCode);
         return true;
 
     } catch (const std::exception& e) {
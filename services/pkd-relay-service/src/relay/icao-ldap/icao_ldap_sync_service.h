@@ -28,6 +28,7 @@ typedef struct x509_st X509;
 // Forward declarations (shared libs use 'common' namespace)
 namespace common { class IQueryExecutor; }
 namespace common { class LdapConnectionPool; }
+namespace common { class BulkWriter; }
 
 // Forward declarations - validation
 namespace icao::validation {
@@ -96,9 +97,9 @@ private:
     /// Extract full X.509 metadata (22 fields) and save to local DB
     bool saveCertificateToDb(const IcaoLdapCertEntry& entry, const std::string& fingerprint);
 
-    /// Perform Trust Chain validation and save result to validation_result table
-    void validateAndSaveResult(const IcaoLdapCertEntry& entry, const std::string& fingerprint,
-                              X509* cert);
+    /// Perform Trust Chain validation and stage the validation_result row + status update
+    void validateAndStageResult(const IcaoLdapCertEntry& entry, const std::string& fingerprint,
+                                X509* cert);
 
     /// Save certificate to local LDAP
     bool saveCertificateToLocalLdap(const IcaoLdapCertEntry& entry, const std::string& fingerprint);
@@ -164,6 +165,8 @@ private:
         std::vector<uint8_t> derData;
     };
     std::vector<ValidationEntry> validationBatch_;
+    std::unique_ptr<common::BulkWriter> validationResults_;        // validation_result rows
+    std::unique_ptr<common::BulkWriter> validationStatusUpdates_;  // certificate.validation_status
     void flushValidationBatch();
 
     std::atomic<bool> syncRunning_{false};
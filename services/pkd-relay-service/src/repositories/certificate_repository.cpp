@@ -174,51 +174,27 @@ std::vector<std::pair<std::string, std::vector<uint8_t>>> CertificateRepository:
     std::vector<std::pair<std::string, std::vector<uint8_t>>> result;
 
     try {
-        std::string dbType = queryExecutor_->getDatabaseType();
-
-        // Oracle: RAWTOHEX+DBMS_LOB to avoid LOB truncation
-        std::string certDataExpr = (dbType == "oracle")
-            ? "RAWTOHEX(DBMS_LOB.SUBSTR(certificate_data, DBMS_LOB.GETLENGTH(certificate_data), 1)) as certificate_data"
-            : "certificate_data";
-
-        std::string query = "SELECT subject_dn, " + certDataExpr +
-                           " FROM certificate WHERE certificate_type = 'CSCA'";
+        // Binary row cursor: DER bytes arrive as stored (no JSON rows, no hex round-trip)
+        std::string query = "SELECT subject_dn, certificate_data FROM certificate "
+                           "WHERE certificate_type = 'CSCA'";
 
-        Json::Value rows = queryExecutor_->executeQuery(query, {});
-
-        auto decodeHex = [](const std::string& hex, size_t start) -> std::vector<uint8_t> {
-            std::vector<uint8_t> bytes;
-            bytes.reserve((hex.size() - start) / 2);
-            for (size_t i = start; i + 1 < hex.size(); i += 2) {
-                char h[3] = {hex[i], hex[i + 1], 0};
-                bytes.push_back(static_cast<uint8_t>(strtol(h, nullptr, 16)));
-            }
-            return bytes;
-        };
+        queryExecutor_->executeQueryRows(query, {}, [&](common::RowCursor& rows) {
+            int dnCol = rows.columnIndex("subject_dn");
+            int dataCol = rows.columnIndex("certificate_data");
 
-        for (Json::ArrayIndex i = 0; i < rows.size(); i++) {
-            std::string subjectDn = rows[i].get("subject_dn", "").asString();
-            std::string certDataHex = rows[i].get("certificate_data", "").asString();
+            while (rows.next()) {
+                std::string_view subjectDn = rows.getStringView(dnCol);
+                common::ByteSpan der = rows.getBytes(dataCol);
+                if (subjectDn.empty() || der.empty()) continue;
 
-            if (subjectDn.empty() || certDataHex.empty()) continue;
-
-            std::vector<uint8_t> derBytes;
-            if (certDataHex.size() > 2 && certDataHex[0] == '\\' && certDataHex[1] == 'x') {
-                derBytes = decodeHex(certDataHex, 2);
                 // Handle double-encoded BYTEA
-                if (derBytes.size() > 2 && derBytes[0] == 0x5C && derBytes[1] == 0x78) {
-                    std::string innerHex(derBytes.begin(), derBytes.end());
-                    derBytes = decodeHex(innerHex, 2);
+                std::vector<uint8_t> derBytes = common::unwrapDoubleEncodedBytea(der);
+                if (derBytes.empty()) {
+                    derBytes.assign(der.begin(), der.end());
                 }
-            } else if (!certDataHex.empty()) {
-                // Oracle returns plain hex from RAWTOHEX (no \x prefix)
-                derBytes = decodeHex(certDataHex, 0);
-            }
-
-            if (!derBytes.empty()) {
-                result.emplace_back(subjectDn, std::move(derBytes));
+                result.emplace_back(std::string(subjectDn), std::move(derBytes));
             }
-        }
+        });
 
         spdlog::info("[CertificateRepository] Loaded {} CSCA certificates", result.size());
         return result;
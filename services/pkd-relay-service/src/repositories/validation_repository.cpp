@@ -235,32 +235,47 @@ bool ValidationRepository::saveRevalidationHistoryExtended(
     }
 }
 
-Json::Value ValidationRepository::findDscsForTrustChainRevalidation() {
+std::vector<DscRevalidationRow> ValidationRepository::findDscsForTrustChainRevalidation() {
+    std::vector<DscRevalidationRow> result;
     try {
         std::string dbType = queryExecutor_->getDatabaseType();
         std::string falseVal = common::db::boolLiteral(dbType, false);
 
-        // Oracle: RAWTOHEX+DBMS_LOB for BLOB, TO_CHAR for issuer_dn CLOB
-        std::string certDataExpr = (dbType == "oracle")
-            ? "RAWTOHEX(DBMS_LOB.SUBSTR(c.certificate_data, DBMS_LOB.GETLENGTH(c.certificate_data), 1)) as certificate_data"
-            : "c.certificate_data";
-        std::string issuerDnExpr = (dbType == "oracle")
-            ? "TO_CHAR(c.issuer_dn) as issuer_dn"
-            : "c.issuer_dn";
-
         std::string query =
-            "SELECT vr.id, vr.certificate_id, vr.country_code, " + certDataExpr + ", " + issuerDnExpr + " "
+            "SELECT vr.id, vr.certificate_id, vr.country_code, c.certificate_data, c.issuer_dn "
             "FROM validation_result vr "
             "JOIN certificate c ON vr.certificate_id = c.id "
             "WHERE c.certificate_type = 'DSC' "
             "AND vr.csca_found = " + falseVal + " "
             "AND vr.validation_status IN ('PENDING', 'INVALID')";
 
-        return queryExecutor_->executeQuery(query, {});
+        queryExecutor_->executeQueryRows(query, {}, [&](common::RowCursor& rows) {
+            int idCol = rows.columnIndex("id");
+            int certIdCol = rows.columnIndex("certificate_id");
+            int countryCol = rows.columnIndex("country_code");
+            int dataCol = rows.columnIndex("certificate_data");
+            int issuerCol = rows.columnIndex("issuer_dn");
+
+            while (rows.next()) {
+                DscRevalidationRow row;
+                row.id = rows.getString(idCol);
+                row.certificateId = rows.getString(certIdCol);
+                row.countryCode = rows.getString(countryCol);
+                row.issuerDn = rows.getString(issuerCol);
+
+                common::ByteSpan der = rows.getBytes(dataCol);
+                row.certificateDer = common::unwrapDoubleEncodedBytea(der);
+                if (row.certificateDer.empty()) {
+                    row.certificateDer.assign(der.begin(), der.end());
+                }
+                result.push_back(std::move(row));
+            }
+        });
     } catch (const std::exception& e) {
         spdlog::error("[ValidationRepository] findDscsForTrustChainRevalidation failed: {}", e.what());
-        return Json::Value(Json::arrayValue);
+        result.clear();
     }
+    return result;
 }
 
 Json::Value ValidationRepository::findDscsForCrlRecheck() {
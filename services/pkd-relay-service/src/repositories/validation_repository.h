@@ -12,6 +12,17 @@
 
 namespace icao::relay::repositories {
 
+/**
+ * @brief DSC row for trust chain re-validation (raw DER, no JSON/hex)
+ */
+struct DscRevalidationRow {
+    std::string id;             ///< validation_result.id
+    std::string certificateId;
+    std::string countryCode;
+    std::string issuerDn;
+    std::vector<uint8_t> certificateDer;
+};
+
 /**
  * @brief Repository for certificate validation operations
  *
@@ -86,9 +97,10 @@ public:
     /**
      * @brief Find DSCs for trust chain re-validation
      * Returns DSC validation_result rows where csca_found = FALSE (PENDING/INVALID)
-     * @return JSON array with id, certificate_id, country_code, certificate_data
+     * Read through the binary row cursor; certificate_data is returned as DER.
+     * @return Rows with id, certificate_id, country_code, issuer_dn, certificate DER
      */
-    Json::Value findDscsForTrustChainRevalidation();
+    std::vector<DscRevalidationRow> findDscsForTrustChainRevalidation();
 
     /**
      * @brief Find DSCs for CRL re-check
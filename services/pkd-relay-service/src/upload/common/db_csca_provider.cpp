@@ -2,12 +2,12 @@
  * @file db_csca_provider.cpp
  * @brief ICscaProvider adapter implementation for database-backed CSCA lookup
  *
- * Supports in-memory CSCA cache: preloadAllCscas() loads all ~845 CSCAs once,
- * eliminating ~30K per-DSC DB queries during LDIF bulk processing.
+ * Supports in-memory CSCA cache: preloadAllCscas() loads and parses all ~845
+ * CSCAs once, eliminating ~30K per-DSC DB queries and d2i_X509 calls during
+ * LDIF bulk processing.
  */
 
 #include "db_csca_provider.h"
-#include <icao/validation/cert_ops.h>
 #include <spdlog/spdlog.h>
 #include <openssl/x509.h>
 #include <stdexcept>
@@ -24,45 +24,37 @@ DbCscaProvider::DbCscaProvider(repositories::CertificateRepository* certRepo)
 
 void DbCscaProvider::preloadAllCscas() {
     auto allCscas = certRepo_->findAllCscas();
-    cscaCache_.clear();
 
+    std::vector<std::vector<uint8_t>> derCerts;
+    derCerts.reserve(allCscas.size());
     for (auto& [subjectDn, derBytes] : allCscas) {
-        std::string normalizedDn = icao::validation::normalizeDnForComparison(subjectDn);
-        cscaCache_[normalizedDn].push_back(std::move(derBytes));
+        derCerts.push_back(std::move(derBytes));
     }
+    auto store = icao::validation::CscaTrustStore::fromDer(derCerts);
 
-    cacheLoaded_ = true;
-    spdlog::info("[DbCscaProvider] Preloaded {} CSCA entries ({} unique DNs)",
-                 allCscas.size(), cscaCache_.size());
+    spdlog::info("[DbCscaProvider] Preloaded {} CSCA entries ({} parsed, generation {})",
+                 allCscas.size(), store->size(), store->generation());
+    store_.publish(std::move(store));
 }
 
 void DbCscaProvider::invalidateCache() {
-    cscaCache_.clear();
-    cacheLoaded_ = false;
+    store_.reset();
     spdlog::debug("[DbCscaProvider] Cache invalidated (will reload on next access)");
 }
 
-std::vector<X509*> DbCscaProvider::findAllCscasByIssuerDn(const std::string& issuerDn) {
+DbCscaProvider::CscaSnapshot DbCscaProvider::trustStore() {
     // Lazy reload: if cache was invalidated (new CSCA added), reload automatically
-    if (!cacheLoaded_) {
+    auto store = store_.load();
+    if (!store) {
         preloadAllCscas();
+        store = store_.load();
     }
+    return store;
+}
 
-    if (cacheLoaded_) {
-        std::string normalizedDn = icao::validation::normalizeDnForComparison(issuerDn);
-        auto it = cscaCache_.find(normalizedDn);
-        if (it != cscaCache_.end()) {
-            std::vector<X509*> result;
-            for (const auto& derBytes : it->second) {
-                const unsigned char* p = derBytes.data();
-                X509* cert = d2i_X509(nullptr, &p, static_cast<long>(derBytes.size()));
-                if (cert) {
-                    result.push_back(cert);
-                }
-            }
-            return result;
-        }
-        return {};  // Not found in cache = no matching CSCA
+std::vector<X509*> DbCscaProvider::findAllCscasByIssuerDn(const std::string& issuerDn) {
+    if (auto store = trustStore()) {
+        return store->copyBySubjectDn(issuerDn);
     }
 
     // Fallback: direct DB query (should not happen after preload)
@@ -84,4 +76,24 @@ X509* DbCscaProvider::findCscaByIssuerDn(
     return nullptr;
 }
 
+// --- CscaSnapshotProvider ---
+
+std::vector<X509*> CscaSnapshotProvider::findAllCscasByIssuerDn(const std::string& issuerDn) {
+    if (!snapshot_) return {};
+    return snapshot_->copyBySubjectDn(issuerDn);
+}
+
+X509* CscaSnapshotProvider::findCscaByIssuerDn(
+    const std::string& issuerDn, const std::string& /*countryCode*/)
+{
+    auto cscas = findAllCscasByIssuerDn(issuerDn);
+    if (!cscas.empty()) {
+        for (size_t i = 1; i < cscas.size(); i++) {
+            X509_free(cscas[i]);
+        }
+        return cscas[0];
+    }
+    return nullptr;
+}
+
 } // namespace adapters
@@ -3,27 +3,36 @@
  * @brief ICscaProvider adapter for database-backed CSCA lookup
  *
  * Bridges icao::validation::ICscaProvider to CertificateRepository.
- * Supports in-memory CSCA cache for LDIF bulk processing performance.
+ * Supports an in-memory CscaTrustStore for LDIF bulk processing performance:
+ * CSCAs are parsed once per load and borrowed by TrustChainBuilder.
  */
 
 #pragma once
 
 #include <icao/validation/providers.h>
+#include <icao/validation/csca_trust_store.h>
 #include "upload/repositories/certificate_repository.h"
-#include <unordered_map>
+#include <memory>
 #include <vector>
 #include <string>
-#include <cstdint>
 
 namespace adapters {
 
 class DbCscaProvider : public icao::validation::ICscaProvider {
 public:
+    /// Pre-parsed CSCAs (immutable, shareable across validation workers)
+    using CscaSnapshot = std::shared_ptr<const icao::validation::CscaTrustStore>;
+
     explicit DbCscaProvider(repositories::CertificateRepository* certRepo);
 
     std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override;
     X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode) override;
 
+    /**
+     * @brief Loaded trust store (triggers lazy reload after invalidateCache())
+     */
+    CscaSnapshot trustStore() override;
+
     /**
      * @brief Preload all CSCA certificates into memory cache
      *
@@ -41,12 +50,41 @@ public:
      */
     void invalidateCache();
 
+    /**
+     * @brief Current cache contents as an immutable snapshot
+     *
+     * The snapshot is never modified; invalidateCache()/preloadAllCscas() swap in
+     * a new one. Holders may read it from any thread.
+     *
+     * @return nullptr if the cache is not loaded (invalidated, lazy reload pending)
+     */
+    CscaSnapshot snapshot() const { return store_.load(); }
+
 private:
     repositories::CertificateRepository* certRepo_;
 
-    // In-memory cache: normalizedDn → vector of DER-encoded certificate bytes
-    std::unordered_map<std::string, std::vector<std::vector<uint8_t>>> cscaCache_;
-    bool cacheLoaded_ = false;
+    // Parsed once per (re)load; replaced wholesale, never mutated in place
+    icao::validation::CscaTrustStoreHolder store_;
+};
+
+/**
+ * @brief Read-only ICscaProvider over a DbCscaProvider snapshot
+ *
+ * Used by LDIF validation workers: each worker builds trust chains against the
+ * snapshot captured when its entry was dispatched, without touching the DB or
+ * the owning provider.
+ */
+class CscaSnapshotProvider : public icao::validation::ICscaProvider {
+public:
+    explicit CscaSnapshotProvider(DbCscaProvider::CscaSnapshot snapshot)
+        : snapshot_(std::move(snapshot)) {}
+
+    std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override;
+    X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string& countryCode) override;
+    DbCscaProvider::CscaSnapshot trustStore() override { return snapshot_; }
+
+private:
+    DbCscaProvider::CscaSnapshot snapshot_;
 };
 
 } // namespace adapters
@@ -0,0 +1,274 @@
+/**
+ * @file ldif_stream_reader.cpp
+ * @brief Streaming LDIF reader implementation (mmap + string_view)
+ */
+
+#include "ldif_stream_reader.h"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+/// Release resident pages once this many consumed bytes have accumulated
+constexpr size_t kReleaseChunkBytes = 8 * 1024 * 1024;
+
+size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/**
+ * @brief Normalized attribute name of an LDIF line, without allocating
+ *
+ * Returns the name as LdifProcessor would store it minus the ";binary" suffix,
+ * and whether the stored name carries ";binary" (explicit or via "::").
+ */
+std::string_view attributeBaseName(std::string_view line, bool& binary) {
+    size_t colonPos = line.find(':');
+    if (colonPos == std::string_view::npos) {
+        binary = false;
+        return {};
+    }
+    std::string_view name = line.substr(0, colonPos);
+    binary = (colonPos + 1 < line.size() && line[colonPos + 1] == ':');
+    size_t suffix = name.find(";binary");
+    if (suffix != std::string_view::npos) {
+        binary = true;
+        name = name.substr(0, suffix);
+    }
+    return name;
+}
+
+} // anonymous namespace
+
+// --- LdifEntryView ---
+
+bool LdifEntryView::hasAttribute(std::string_view name) const {
+    for (const auto& [attrName, value] : attributes) {
+        if (attrName == name) return true;
+    }
+    return false;
+}
+
+std::string_view LdifEntryView::getFirstAttribute(std::string_view name) const {
+    for (const auto& [attrName, value] : attributes) {
+        if (attrName == name) return value;
+    }
+    return {};
+}
+
+LdifEntry LdifEntryView::toEntry() const {
+    LdifEntry entry;
+    entry.dn = std::string(dn);
+    for (const auto& [attrName, value] : attributes) {
+        entry.attributes[std::string(attrName)].emplace_back(value);
+    }
+    return entry;
+}
+
+// --- LdifStreamReader ---
+
+LdifStreamReader::LdifStreamReader(const std::string& filePath) {
+    int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open LDIF file: " + filePath + " (" + std::strerror(errno) + ")");
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::runtime_error("Failed to stat LDIF file: " + filePath + " (" + std::strerror(err) + ")");
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            int err = errno;
+            ::close(fd);
+            throw std::runtime_error("Failed to mmap LDIF file: " + filePath + " (" + std::strerror(err) + ")");
+        }
+        data_ = static_cast<const char*>(addr);
+        mapped_ = true;
+        ::madvise(addr, size_, MADV_SEQUENTIAL);
+    }
+    ::close(fd);  // Mapping stays valid after close
+}
+
+LdifStreamReader::LdifStreamReader(std::string_view content)
+    : data_(content.data()), size_(content.size()) {}
+
+LdifStreamReader::~LdifStreamReader() {
+    if (mapped_ && data_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+bool LdifStreamReader::readLine(std::string_view& line) {
+    if (pos_ >= size_) return false;
+
+    const char* start = data_ + pos_;
+    const void* nl = std::memchr(start, '\n', size_ - pos_);
+    size_t len = nl ? static_cast<size_t>(static_cast<const char*>(nl) - start) : size_ - pos_;
+    pos_ += nl ? len + 1 : len;
+
+    if (len > 0 && start[len - 1] == '\r') {
+        len--;
+    }
+    line = std::string_view(start, len);
+    return true;
+}
+
+void LdifStreamReader::releaseConsumedPages() {
+    if (!mapped_ || pos_ < releasedUpTo_ + kReleaseChunkBytes) return;
+
+    size_t end = (pos_ / pageSize()) * pageSize();
+    if (end > releasedUpTo_) {
+        ::madvise(const_cast<char*>(data_) + releasedUpTo_, end - releasedUpTo_, MADV_DONTNEED);
+        releasedUpTo_ = end;
+    }
+}
+
+bool LdifStreamReader::next(LdifEntryView& entry) {
+    // Views handed out by the previous call end here
+    entry.clear();
+    unfolded_.clear();
+    releaseConsumedPages();
+
+    std::string_view attrName;
+    std::string_view attrValue;
+    std::string* folded = nullptr;  // Set once a value spans continuation lines
+    bool inContinuation = false;
+
+    auto finalizeAttribute = [&]() {
+        if (attrName.empty()) return;
+        std::string_view value = folded ? std::string_view(*folded) : attrValue;
+        if (attrName == "dn") {
+            // entry.dn is unfolded; the "dn" attribute keeps only the first line,
+            // as parseLdifContent() always stored it
+            entry.dn = value;
+            value = attrValue;
+        }
+        entry.attributes.emplace_back(attrName, value);
+        attrName = {};
+        attrValue = {};
+        folded = nullptr;
+    };
+
+    std::string_view line;
+    while (readLine(line)) {
+        if (line.empty()) {
+            finalizeAttribute();
+            inContinuation = false;
+            if (!entry.dn.empty()) return true;
+            // Separator before any DN (e.g. "version: 1" header) — start over
+            entry.clear();
+            continue;
+        }
+
+        if (line[0] == '#') continue;
+
+        if (line[0] == ' ') {
+            // LDIF continuation line - append to current value
+            if (inContinuation && !attrName.empty()) {
+                if (!folded) {
+                    folded = &unfolded_.emplace_back(attrValue);
+                }
+                folded->append(line.substr(1));
+            }
+            continue;
+        }
+
+        finalizeAttribute();
+        inContinuation = false;
+
+        size_t colonPos = line.find(':');
+        if (colonPos == std::string_view::npos) continue;
+
+        attrName = line.substr(0, colonPos);
+        size_t valueStart;
+        if (colonPos + 1 < line.size() && line[colonPos + 1] == ':') {
+            // Base64 encoded value (double colon ::) — store under "<name>;binary"
+            if (attrName.find(";binary") == std::string_view::npos) {
+                std::string& name = unfolded_.emplace_back(attrName);
+                name += ";binary";
+                attrName = name;
+            }
+            valueStart = colonPos + 2;
+        } else {
+            valueStart = colonPos + 1;
+        }
+        while (valueStart < line.size() && line[valueStart] == ' ') valueStart++;
+        attrValue = line.substr(valueStart);
+        inContinuation = true;
+    }
+
+    finalizeAttribute();
+    return !entry.dn.empty();
+}
+
+LdifStreamReader::ScanSummary LdifStreamReader::preScan() const {
+    ScanSummary summary;
+    bool hasDn = false, hasCert = false, hasCrl = false, hasMl = false;
+
+    auto finalizeEntry = [&]() {
+        if (hasDn) {
+            summary.totalEntries++;
+            if (hasCert) summary.totalCerts++;
+            if (hasCrl) summary.totalCrl++;
+            if (hasMl) summary.totalMl++;
+        }
+        hasDn = hasCert = hasCrl = hasMl = false;
+    };
+
+    size_t pos = 0;
+    while (pos < size_) {
+        const char* start = data_ + pos;
+        const void* nl = std::memchr(start, '\n', size_ - pos);
+        size_t len = nl ? static_cast<size_t>(static_cast<const char*>(nl) - start) : size_ - pos;
+        pos += nl ? len + 1 : len;
+        if (len > 0 && start[len - 1] == '\r') len--;
+
+        std::string_view line(start, len);
+        if (line.empty()) {
+            finalizeEntry();
+            continue;
+        }
+        if (line[0] == '#' || line[0] == ' ') continue;
+
+        bool binary = false;
+        std::string_view name = attributeBaseName(line, binary);
+        if (name == "dn" && !binary) {
+            // A DN that only has continuation lines still counts
+            hasDn = hasDn || line.size() > 3 || (nl && pos < size_ && data_[pos] == ' ');
+        } else if (binary && (name == "userCertificate" || name == "cACertificate")) {
+            hasCert = true;
+        } else if (binary && name == "certificateRevocationList") {
+            hasCrl = true;
+        } else if (name == "pkdMasterListContent") {
+            hasMl = true;
+        }
+    }
+    finalizeEntry();
+
+    // The scan faulted in the whole file; give back pages the cursor has not reached yet
+    if (mapped_) {
+        size_t from = ((pos_ + pageSize() - 1) / pageSize()) * pageSize();
+        if (from < size_) {
+            ::madvise(const_cast<char*>(data_) + from, size_ - from, MADV_DONTNEED);
+        }
+    }
+    return summary;
+}
+
+void LdifStreamReader::rewind() {
+    pos_ = 0;
+    releasedUpTo_ = 0;
+    unfolded_.clear();
+}
@@ -0,0 +1,131 @@
+/**
+ * @file ldif_stream_reader.h
+ * @brief Streaming, bounded-memory LDIF reader over a memory-mapped file
+ *
+ * LdifProcessor::parseLdifContent() needs the whole upload in one std::string
+ * and materializes every entry before processing starts (~80 MB file → several
+ * hundred MB peak RSS). This reader maps the temp file read-only and yields one
+ * entry at a time as string_views into the mapping; pages behind the cursor are
+ * released with MADV_DONTNEED so resident memory stays bounded by the current
+ * window instead of the file size.
+ *
+ * Parsing rules are identical to LdifProcessor::parseLdifContent():
+ * - "attr:: value" (base64) is stored under "attr;binary"
+ * - continuation lines (leading space) are unfolded
+ * - comment lines (#) are skipped, entries without a DN are dropped
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include "upload/common/ldif_types.h"
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Non-owning view of one LDIF entry
+ *
+ * All views point into the reader's mapping (or its unfold scratch buffer)
+ * and stay valid only until the next LdifStreamReader::next() call.
+ */
+struct LdifEntryView {
+    std::string_view dn;
+    std::vector<std::pair<std::string_view, std::string_view>> attributes;
+
+    bool hasAttribute(std::string_view name) const;
+    std::string_view getFirstAttribute(std::string_view name) const;
+
+    /**
+     * @brief Copy into an owning LdifEntry (for the existing entry processors)
+     */
+    LdifEntry toEntry() const;
+
+    void clear() {
+        dn = {};
+        attributes.clear();
+    }
+};
+
+/**
+ * @brief Streaming LDIF reader
+ *
+ * Usage:
+ * @code
+ * LdifStreamReader reader("/app/uploads/<id>.ldif");
+ * auto summary = reader.preScan();      // optional: totals for progress display
+ * LdifEntryView view;
+ * while (reader.next(view)) {
+ *     LdifEntry entry = view.toEntry();
+ *     // process entry
+ * }
+ * @endcode
+ */
+class LdifStreamReader {
+public:
+    /**
+     * @brief Entry totals from a cheap line-prefix scan (no unfolding, no copies)
+     */
+    struct ScanSummary {
+        int totalEntries = 0;
+        int totalCerts = 0;   ///< Entries with userCertificate;binary or cACertificate;binary
+        int totalCrl = 0;     ///< Entries with certificateRevocationList;binary
+        int totalMl = 0;      ///< Entries with pkdMasterListContent
+    };
+
+    /**
+     * @brief Map the file read-only
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit LdifStreamReader(const std::string& filePath);
+
+    /**
+     * @brief Read from an in-memory buffer (caller keeps it alive)
+     */
+    explicit LdifStreamReader(std::string_view content);
+
+    ~LdifStreamReader();
+
+    LdifStreamReader(const LdifStreamReader&) = delete;
+    LdifStreamReader& operator=(const LdifStreamReader&) = delete;
+
+    /**
+     * @brief Advance to the next entry with a DN
+     * @param entry Output view (previous views are invalidated)
+     * @return false at end of input
+     */
+    bool next(LdifEntryView& entry);
+
+    /**
+     * @brief Count entries by type without materializing them
+     *
+     * Does not move the read cursor.
+     */
+    ScanSummary preScan() const;
+
+    /**
+     * @brief Restart from the beginning of the input
+     */
+    void rewind();
+
+    size_t size() const { return size_; }
+    size_t position() const { return pos_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t pos_ = 0;
+    bool mapped_ = false;
+    size_t releasedUpTo_ = 0;           ///< Mapping bytes already returned to the kernel
+    std::deque<std::string> unfolded_;  ///< Scratch storage for values spanning continuation lines
+
+    /// Read one line (without trailing CR/LF); false at EOF
+    bool readLine(std::string_view& line);
+
+    /// Drop resident pages that precede the cursor (mapped mode only)
+    void releaseConsumedPages();
+};
@@ -12,6 +12,7 @@
 #include "upload/upload_services.h"
 #include "upload/services/ldap_storage_service.h"
 #include "upload/domain/models/validation_result.h"
+#include "upload/repositories/certificate_repository.h"
 #include "upload/repositories/validation_repository.h"
 #include <spdlog/spdlog.h>
 
@@ -268,7 +269,7 @@ bool parseMasterListEntryV2(
                 }
 
                 // Track source
-                certificate_utils::trackCertificateDuplicate(
+                g_uploadServices->certificateRepository()->stageCertificateDuplicate(
                     certId, uploadId, "LDIF_002",
                     certCountryCode, entry.dn, ""
                 );
@@ -350,7 +351,7 @@ bool parseMasterListEntryV2(
                             }
                         }
 
-                        g_uploadServices->validationRepository()->save(valRecord);
+                        g_uploadServices->validationRepository()->stage(valRecord);
                     } catch (const std::exception& e) {
                         spdlog::warn("[ML-LDIF] MLSC {}/{} - Failed to save validation_result: {}", i + 1, numSigners, e.what());
                     }
@@ -487,7 +488,7 @@ bool parseMasterListEntryV2(
                 continue;
             }
 
-            certificate_utils::trackCertificateDuplicate(
+            g_uploadServices->certificateRepository()->stageCertificateDuplicate(
                 certId, uploadId, "LDIF_002",
                 certCountryCode, entry.dn, ""
             );
@@ -637,7 +638,7 @@ bool parseMasterListEntryV2(
                             }
                         }
 
-                        g_uploadServices->validationRepository()->save(valRecord);
+                        g_uploadServices->validationRepository()->stage(valRecord);
                     } catch (const std::exception& e) {
                         spdlog::warn("[ML-LDIF] CSCA/LC {} - Failed to save validation_result: {}", totalCerts, e.what());
                     }
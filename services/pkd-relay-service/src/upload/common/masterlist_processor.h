@@ -53,6 +53,8 @@ struct MasterListStats {
  * @param stats Statistics counters (updated by reference)
  * @return bool Success status
  * @note Uses global certificateRepository for database operations
+ * @note certificate_duplicates and validation_result rows are staged; the LDIF
+ *       pipeline writes them with CertificateRepository/ValidationRepository::flushStaged()
  *
  * Logging Format:
  * [ML] CSCA 1/12 - NEW - fingerprint: abc123..., subject: C=KR,O=MOFA,CN=CSCA-KOREA
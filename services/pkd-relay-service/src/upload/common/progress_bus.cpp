@@ -0,0 +1,398 @@
+/**
+ * @file progress_bus.cpp
+ * @brief ProgressBus implementation
+ */
+
+#include "progress_bus.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace common {
+
+namespace {
+
+/// Non-negative integer from an environment variable, or fallback
+size_t envSize(const char* name, size_t fallback) {
+    const char* val = std::getenv(name);
+    if (!val || !*val) return fallback;
+    try {
+        long long v = std::stoll(val);
+        if (v >= 0) return static_cast<size_t>(v);
+    } catch (...) {}
+    spdlog::warn("[ProgressBus] Invalid {}='{}', using {}", name, val, fallback);
+    return fallback;
+}
+
+/// Single-line JSON for SSE "data:" lines
+std::string writeCompact(const Json::Value& value) {
+    Json::StreamWriterBuilder writer;
+    writer["indentation"] = "";
+    return Json::writeString(writer, value);
+}
+
+/**
+ * @brief Delta for an array: {"$append", "$size"} if @p after only gained
+ *        entries at the end (possibly dropping some at the front), else @p after
+ */
+Json::Value diffArray(const Json::Value& before, const Json::Value& after) {
+    Json::Value append(Json::arrayValue);
+    if (before.empty()) {
+        append = after;
+    } else {
+        // Locate the previous last entry in the new array (searching from the end:
+        // new entries are appended, old ones fall off the front of the window)
+        const Json::Value& last = before[before.size() - 1];
+        Json::ArrayIndex j = after.size();
+        while (j > 0 && !(after[j - 1] == last)) --j;
+        // Not found, nothing appended, or unknown entries in front of the old ones
+        if (j == 0 || j == after.size() || j > before.size()) return after;
+
+        // The entries before it must match the tail of the previous array
+        for (Json::ArrayIndex k = 1; k < j; ++k) {
+            if (!(after[j - 1 - k] == before[before.size() - 1 - k])) return after;
+        }
+
+        for (Json::ArrayIndex k = j; k < after.size(); ++k) append.append(after[k]);
+    }
+
+    Json::Value delta;
+    delta["$append"] = append;
+    delta["$size"] = after.size();
+    return delta;
+}
+
+} // anonymous namespace
+
+// --- Config ---
+
+ProgressBus::Config ProgressBus::Config::fromEnvironment(Config defaults) {
+    Config config = std::move(defaults);
+    config.interval = std::chrono::milliseconds(std::clamp<size_t>(
+        envSize("SSE_PROGRESS_INTERVAL_MS", static_cast<size_t>(config.interval.count())), 10, 10000));
+    config.maxQueuedFrames = std::max<size_t>(1, envSize("SSE_PROGRESS_QUEUE_FRAMES", config.maxQueuedFrames));
+    config.maxBufferedBytes = std::max<size_t>(
+        4096, envSize("SSE_PROGRESS_MAX_BUFFERED_BYTES", config.maxBufferedBytes));
+    config.heartbeatInterval = std::chrono::seconds(std::min<size_t>(
+        envSize("SSE_HEARTBEAT_SEC", static_cast<size_t>(config.heartbeatInterval.count())), 3600));
+    return config;
+}
+
+// --- ProgressBus ---
+
+ProgressBus::ProgressBus(Config config)
+    : config_(std::move(config))
+{
+    config_.maxQueuedFrames = std::max<size_t>(1, config_.maxQueuedFrames);
+    if (config_.startFlusher) {
+        flusher_ = std::thread(&ProgressBus::flusherLoop, this);
+    }
+}
+
+ProgressBus::~ProgressBus() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (flusher_.joinable()) flusher_.join();
+}
+
+void ProgressBus::publish(const std::string& topic, Renderer render, bool urgent) {
+    std::vector<SubscriberPtr> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        counters_.published++;
+        Topic& t = topics_[topic];
+        t.pending = std::move(render);
+        if (urgent) ready = flushTopicLocked(t);
+    }
+    for (const auto& sub : ready) deliver(topic, sub);
+}
+
+ProgressBus::SubscriptionId ProgressBus::subscribe(const std::string& topic, Sink sink, Backlog backlog) {
+    auto sub = std::make_shared<Subscriber>();
+    sub->sink = std::move(sink);
+    sub->backlog = std::move(backlog);
+    std::vector<SubscriberPtr> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sub->id = nextId_++;
+        Topic& t = topics_[topic];
+        // Bring the baseline up to date first so the new subscriber's snapshot
+        // and the existing subscribers' deltas start from the same state
+        ready = flushTopicLocked(t, true);
+        if (t.hasState) sub->queue.push_back(snapshotLocked(t));
+        t.subscribers[sub->id] = sub;
+    }
+    for (const auto& other : ready) deliver(topic, other);
+    deliver(topic, sub);
+    return sub->id;
+}
+
+void ProgressBus::unsubscribe(const std::string& topic, SubscriptionId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = topics_.find(topic);
+    if (it == topics_.end()) return;
+    auto subIt = it->second.subscribers.find(id);
+    if (subIt == it->second.subscribers.end()) return;
+    SubscriberPtr sub = subIt->second;
+    sub->closed = true;
+    sub->queue.clear();
+    detachLocked(topic, sub);
+}
+
+void ProgressBus::removeTopic(const std::string& topic, const Json::Value& endData) {
+    std::vector<SubscriberPtr> ending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = topics_.find(topic);
+        if (it == topics_.end()) return;
+        auto end = std::make_shared<const std::string>(endFrame(endData));
+        for (auto& [id, sub] : it->second.subscribers) {
+            sub->queue.clear();
+            sub->queue.push_back(end);
+            sub->ending = true;
+            ending.push_back(sub);
+        }
+        topics_.erase(it);
+    }
+    // No longer reachable through topics_: after the end frame they get nothing more
+    for (const auto& sub : ending) deliver(topic, sub);
+}
+
+void ProgressBus::flush() {
+    std::vector<std::pair<std::string, SubscriberPtr>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [name, t] : topics_) {
+            flushTopicLocked(t);
+            // New frames, and frames held back while the connection buffer was full
+            for (auto& [id, sub] : t.subscribers) {
+                if (!sub->queue.empty() && !sub->delivering) ready.emplace_back(name, sub);
+            }
+        }
+    }
+    for (const auto& [name, sub] : ready) deliver(name, sub);
+}
+
+void ProgressBus::heartbeat() {
+    // SSE comment line: ignored by EventSource, but a write to a dead peer fails
+    static const Frame kHeartbeat = std::make_shared<const std::string>(": heartbeat\n\n");
+    std::vector<std::pair<std::string, SubscriberPtr>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [name, t] : topics_) {
+            for (auto& [id, sub] : t.subscribers) {
+                if (!sub->queue.empty() || sub->delivering) continue;
+                sub->queue.push_back(kHeartbeat);
+                counters_.heartbeats++;
+                ready.emplace_back(name, sub);
+            }
+        }
+    }
+    for (const auto& [name, sub] : ready) deliver(name, sub);
+}
+
+std::string ProgressBus::endFrame(const Json::Value& data) {
+    return "event: progress-end\ndata: " + writeCompact(data) + "\n\n";
+}
+
+bool ProgressBus::isEndFrame(const std::string& frame) {
+    return frame.rfind("event: progress-end\n", 0) == 0;
+}
+
+ProgressBus::Stats ProgressBus::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats s = counters_;
+    s.topics = topics_.size();
+    s.subscribers = 0;
+    for (const auto& [name, t] : topics_) s.subscribers += t.subscribers.size();
+    return s;
+}
+
+Json::Value ProgressBus::diff(const Json::Value& before, const Json::Value& after) {
+    if (!before.isObject() || !after.isObject()) return after;
+
+    Json::Value delta(Json::objectValue);
+    for (const auto& name : before.getMemberNames()) {
+        if (!after.isMember(name)) delta[name] = Json::Value(Json::nullValue);
+    }
+    for (const auto& name : after.getMemberNames()) {
+        const Json::Value& next = after[name];
+        if (!before.isMember(name)) {
+            delta[name] = next;
+            continue;
+        }
+        const Json::Value& prev = before[name];
+        if (prev == next) continue;
+        if (prev.isObject() && next.isObject()) {
+            delta[name] = diff(prev, next);
+        } else if (prev.isArray() && next.isArray()) {
+            delta[name] = diffArray(prev, next);
+        } else {
+            delta[name] = next;
+        }
+    }
+    return delta;
+}
+
+// --- Internals (mutex_ held) ---
+
+std::vector<ProgressBus::SubscriberPtr> ProgressBus::flushTopicLocked(Topic& topic, bool force) {
+    if (!topic.pending) return {};
+    // Nobody is listening: keep the renderer, the next subscriber renders it
+    if (topic.subscribers.empty() && !force) return {};
+
+    Renderer render = std::move(topic.pending);
+    topic.pending = nullptr;
+    Json::Value next;
+    try {
+        next = render();
+    } catch (const std::exception& e) {
+        spdlog::warn("[ProgressBus] Render failed: {}", e.what());
+        return {};
+    }
+    counters_.rendered++;
+
+    Frame frame;
+    if (!topic.hasState) {
+        topic.state = std::move(next);
+        topic.hasState = true;
+        topic.snapshot.reset();
+        if (!topic.subscribers.empty()) frame = snapshotLocked(topic);
+    } else {
+        Json::Value delta = diff(topic.state, next);
+        topic.state = std::move(next);
+        topic.snapshot.reset();
+        if (delta.empty() || topic.subscribers.empty()) return {};
+        frame = std::make_shared<const std::string>(
+            "event: progress-delta\ndata: " + writeCompact(delta) + "\n\n");
+        counters_.deltaFrames++;
+    }
+    if (!frame) return {};
+
+    std::vector<SubscriberPtr> ready;
+    ready.reserve(topic.subscribers.size());
+    for (auto& [id, sub] : topic.subscribers) {
+        enqueueLocked(*sub, frame, topic);
+        ready.push_back(sub);
+    }
+    return ready;
+}
+
+ProgressBus::Frame ProgressBus::snapshotLocked(Topic& topic) {
+    if (!topic.snapshot) {
+        topic.snapshot = std::make_shared<const std::string>(
+            "event: progress\ndata: " + writeCompact(topic.state) + "\n\n");
+        counters_.snapshotFrames++;
+    }
+    return topic.snapshot;
+}
+
+void ProgressBus::enqueueLocked(Subscriber& subscriber, const Frame& frame, Topic& topic) {
+    if (subscriber.queue.size() < config_.maxQueuedFrames) {
+        subscriber.queue.push_back(frame);
+        return;
+    }
+    // Slow consumer: the queued deltas are superseded by one snapshot of the current state
+    counters_.framesDropped += subscriber.queue.size();
+    counters_.resyncs++;
+    subscriber.queue.clear();
+    subscriber.queue.push_back(snapshotLocked(topic));
+}
+
+void ProgressBus::detachLocked(const std::string& topic, const SubscriberPtr& subscriber) {
+    auto it = topics_.find(topic);
+    if (it == topics_.end()) return;
+    Topic& t = it->second;
+    auto subIt = t.subscribers.find(subscriber->id);
+    if (subIt != t.subscribers.end() && subIt->second == subscriber) {
+        t.subscribers.erase(subIt);
+    }
+    // Topic created by a subscribe that never saw a publish
+    if (t.subscribers.empty() && !t.hasState && !t.pending) {
+        topics_.erase(it);
+    }
+}
+
+// --- Delivery ---
+
+void ProgressBus::deliver(const std::string& topic, const SubscriberPtr& subscriber) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (subscriber->delivering || subscriber->closed) return;
+    subscriber->delivering = true;
+
+    while (!subscriber->queue.empty() && !subscriber->closed) {
+        // Connection still draining earlier frames: keep the rest queued (bounded
+        // by maxQueuedFrames) until a later flush
+        if (subscriber->backlog && !subscriber->ending &&
+            subscriber->backlog() > config_.maxBufferedBytes) {
+            counters_.deferred++;
+            break;
+        }
+        Frame frame = subscriber->queue.front();
+        subscriber->queue.pop_front();
+        lock.unlock();
+
+        bool ok = false;
+        try {
+            ok = subscriber->sink(*frame);
+        } catch (const std::exception& e) {
+            spdlog::warn("[ProgressBus] Sink failed for {}: {}", topic.substr(0, 8), e.what());
+        } catch (...) {
+            spdlog::warn("[ProgressBus] Sink failed for {} (unknown error)", topic.substr(0, 8));
+        }
+
+        lock.lock();
+        if (!ok) {
+            subscriber->closed = true;
+            subscriber->queue.clear();
+            detachLocked(topic, subscriber);
+            spdlog::debug("[ProgressBus] Subscriber {} of {} disconnected", subscriber->id, topic.substr(0, 8));
+            break;
+        }
+        counters_.framesSent++;
+    }
+    subscriber->delivering = false;
+}
+
+void ProgressBus::flusherLoop() {
+    auto nextHeartbeat = std::chrono::steady_clock::now() + config_.heartbeatInterval;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        cv_.wait_for(lock, config_.interval, [this]() { return stopping_; });
+        if (stopping_) break;
+        lock.unlock();
+        flush();
+        auto now = std::chrono::steady_clock::now();
+        if (config_.heartbeatInterval.count() > 0 && now >= nextHeartbeat) {
+            heartbeat();
+            nextHeartbeat = now + config_.heartbeatInterval;
+        }
+        lock.lock();
+    }
+}
+
+// --- Metrics ---
+
+Json::Value progressBusMetrics(const ProgressBus& bus) {
+    auto stats = bus.stats();
+    Json::Value result;
+    result["topics"] = static_cast<Json::UInt>(stats.topics);
+    result["subscribers"] = static_cast<Json::UInt>(stats.subscribers);
+    result["published"] = static_cast<Json::UInt64>(stats.published);
+    result["rendered"] = static_cast<Json::UInt64>(stats.rendered);
+    result["snapshotFrames"] = static_cast<Json::UInt64>(stats.snapshotFrames);
+    result["deltaFrames"] = static_cast<Json::UInt64>(stats.deltaFrames);
+    result["framesSent"] = static_cast<Json::UInt64>(stats.framesSent);
+    result["framesDropped"] = static_cast<Json::UInt64>(stats.framesDropped);
+    result["resyncs"] = static_cast<Json::UInt64>(stats.resyncs);
+    result["deferred"] = static_cast<Json::UInt64>(stats.deferred);
+    result["heartbeats"] = static_cast<Json::UInt64>(stats.heartbeats);
+    result["coalesceRatio"] = stats.published > 0
+        ? static_cast<double>(stats.rendered) / static_cast<double>(stats.published) : 0.0;
+    return result;
+}
+
+} // namespace common
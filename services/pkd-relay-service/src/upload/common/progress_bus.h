@@ -0,0 +1,204 @@
+/**
+ * @file progress_bus.h
+ * @brief Multi-subscriber, coalescing SSE publish/subscribe bus for upload progress
+ *
+ * ProgressManager used to keep a single callback per upload (a second browser
+ * tab replaced the first) and serialized the full progress, statistics maps
+ * and log deques included, for every event. ProgressBus instead:
+ *
+ * - keeps any number of subscribers per topic (upload id)
+ * - renders the latest published state at most once per interval per topic
+ *   (urgent publishes, e.g. stage changes, flush immediately)
+ * - sends a full snapshot ("event: progress") when a subscriber joins and
+ *   only the changed fields afterwards ("event: progress-delta")
+ * - serializes each frame once and shares it between all subscribers
+ * - gives every subscriber a bounded frame queue; on overflow the queued
+ *   deltas are dropped and replaced by one fresh snapshot. Frames stay queued
+ *   while the subscriber's connection still holds more than maxBufferedBytes
+ *   unsent, so a slow client collapses to snapshots instead of growing the
+ *   connection's write buffer
+ * - sends an SSE comment (": heartbeat") to idle subscribers so streams whose
+ *   client vanished fail a write and are dropped
+ * - ends a removed topic's streams with "event: progress-end"
+ *
+ * Delta format (applied by the client to its last state):
+ *   - objects are merged recursively, a null member removes the key
+ *   - arrays that only gained entries at the end (sliding log windows) are
+ *     sent as {"$append": [new entries], "$size": resulting length}; the
+ *     client appends and keeps the last $size entries
+ *   - any other changed value is sent as is
+ *
+ * Sinks are called outside the bus lock and must not block for long (drogon
+ * ResponseStream::send only queues on the connection). A sink returning false
+ * unsubscribes itself.
+ *
+ * Thread-safe.
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <json/json.h>
+
+namespace common {
+
+class ProgressBus {
+public:
+    struct Config {
+        std::chrono::milliseconds interval{250};  ///< Max one frame per subscriber per interval
+        size_t maxQueuedFrames = 16;              ///< Per-subscriber queue; overflow → resync snapshot
+        size_t maxBufferedBytes = 256 * 1024;     ///< Hold frames while the connection has more unsent
+        std::chrono::seconds heartbeatInterval{15}; ///< Idle-subscriber heartbeat (0 = off; flusher only)
+        bool startFlusher = true;                 ///< Background thread flushing every interval
+
+        /**
+         * @brief Read SSE_PROGRESS_INTERVAL_MS, SSE_PROGRESS_QUEUE_FRAMES,
+         *        SSE_PROGRESS_MAX_BUFFERED_BYTES and SSE_HEARTBEAT_SEC
+         *
+         * Invalid values keep the defaults.
+         */
+        static Config fromEnvironment(Config defaults);
+    };
+
+    struct Stats {
+        size_t topics = 0;
+        size_t subscribers = 0;
+        uint64_t published = 0;      ///< publish() calls
+        uint64_t rendered = 0;       ///< States rendered and diffed (≤ published)
+        uint64_t snapshotFrames = 0; ///< Snapshot frames serialized
+        uint64_t deltaFrames = 0;    ///< Delta frames serialized
+        uint64_t framesSent = 0;     ///< Frames handed to sinks
+        uint64_t framesDropped = 0;  ///< Queued frames discarded for slow subscribers
+        uint64_t resyncs = 0;        ///< Queue overflows answered with a snapshot
+        uint64_t deferred = 0;       ///< Deliveries held back for a full connection buffer
+        uint64_t heartbeats = 0;     ///< Heartbeat frames queued
+    };
+
+    /// Produces the current state as JSON; called under the bus lock at most once per flush
+    using Renderer = std::function<Json::Value()>;
+    /// Receives SSE frames; return false once the subscriber is gone
+    using Sink = std::function<bool(const std::string& frame)>;
+    /// Bytes handed to the subscriber's connection and not yet written to the
+    /// socket. Called under the bus lock before each send: must be cheap and
+    /// must not call into the bus.
+    using Backlog = std::function<size_t()>;
+    using SubscriptionId = uint64_t;
+
+    explicit ProgressBus(Config config);
+    ~ProgressBus();
+
+    ProgressBus(const ProgressBus&) = delete;
+    ProgressBus& operator=(const ProgressBus&) = delete;
+
+    /**
+     * @brief Record the latest state of a topic
+     *
+     * Rendering is deferred to the next flush; publishes in between replace
+     * each other. Urgent publishes flush the topic on the calling thread.
+     */
+    void publish(const std::string& topic, Renderer render, bool urgent = false);
+
+    /**
+     * @brief Subscribe to a topic
+     *
+     * The current state, if the topic has been flushed before, is sent to
+     * the sink as a snapshot before this call returns.
+     *
+     * @param backlog Optional; without it frames are handed over as they come
+     */
+    SubscriptionId subscribe(const std::string& topic, Sink sink, Backlog backlog = nullptr);
+
+    /// Remove a subscription; a topic left with no subscribers and no state is dropped
+    void unsubscribe(const std::string& topic, SubscriptionId id);
+
+    /**
+     * @brief Drop a topic with its state and subscribers
+     *
+     * Each subscriber is sent endFrame(endData) first (regardless of its
+     * backlog), then receives nothing more.
+     */
+    void removeTopic(const std::string& topic,
+                     const Json::Value& endData = Json::Value(Json::objectValue));
+
+    /// Render, diff and deliver every topic with unflushed changes; retry held-back frames
+    void flush();
+
+    /// Queue a heartbeat comment for every subscriber with nothing queued and deliver it
+    void heartbeat();
+
+    /// "event: progress-end" frame; the stream should be closed after sending it
+    static std::string endFrame(const Json::Value& data);
+    static bool isEndFrame(const std::string& frame);
+
+    Stats stats() const;
+
+    /// Changed members of @p after relative to @p before (see delta format)
+    static Json::Value diff(const Json::Value& before, const Json::Value& after);
+
+private:
+    using Frame = std::shared_ptr<const std::string>;
+
+    struct Subscriber {
+        SubscriptionId id = 0;
+        Sink sink;
+        Backlog backlog;
+        std::deque<Frame> queue;
+        bool ending = false;                      ///< End frame queued: skip the backlog check
+        bool delivering = false;
+        bool closed = false;
+    };
+    using SubscriberPtr = std::shared_ptr<Subscriber>;
+
+    struct Topic {
+        Renderer pending;                         ///< Latest unflushed state
+        Json::Value state;                        ///< Last rendered state (delta baseline)
+        bool hasState = false;
+        Frame snapshot;                           ///< Serialized state, built on demand
+        std::map<SubscriptionId, SubscriberPtr> subscribers;
+    };
+
+    /**
+     * @brief Render and enqueue one topic's pending state (lock held)
+     *
+     * Topics without subscribers stay pending unless @p force is set.
+     * @return Subscribers with queued frames
+     */
+    std::vector<SubscriberPtr> flushTopicLocked(Topic& topic, bool force = false);
+    Frame snapshotLocked(Topic& topic);
+    void enqueueLocked(Subscriber& subscriber, const Frame& frame, Topic& topic);
+    /// Drop a subscriber from its topic, and the topic if nothing is left in it
+    void detachLocked(const std::string& topic, const SubscriberPtr& subscriber);
+    /// Drain a subscriber's queue outside the lock (no-op if another thread is delivering)
+    void deliver(const std::string& topic, const SubscriberPtr& subscriber);
+    void flusherLoop();
+
+    Config config_;
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Topic> topics_;
+    SubscriptionId nextId_ = 1;
+    Stats counters_;
+
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::thread flusher_;
+};
+
+/**
+ * @brief ProgressBus counters for /internal/metrics
+ */
+Json::Value progressBusMetrics(const ProgressBus& bus);
+
+} // namespace common
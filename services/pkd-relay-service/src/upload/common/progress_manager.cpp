@@ -406,7 +406,7 @@ Json::Value ValidationStatistics::toJson() const {
 
 // --- ProcessingProgress Implementation ---
 
-std::string ProcessingProgress::toJson() const {
+Json::Value ProcessingProgress::toJsonValue() const {
     Json::Value json;
 
     // Basic progress
@@ -441,10 +441,14 @@ std::string ProcessingProgress::toJson() const {
         json["statistics"] = statistics->toJson();
     }
 
+    return json;
+}
+
+std::string ProcessingProgress::toJson() const {
     // Single-line JSON for SSE compatibility
     Json::StreamWriterBuilder writer;
     writer["indentation"] = "";
-    return Json::writeString(writer, json);
+    return Json::writeString(writer, toJsonValue());
 }
 
 ProcessingProgress ProcessingProgress::create(
@@ -508,6 +512,11 @@ ProcessingProgress ProcessingProgress::createWithMetadata(
 
 // --- ProgressManager Implementation ---
 
+ProgressManager::ProgressManager()
+    : bus_(ProgressBus::Config::fromEnvironment({}))
+{
+}
+
 ProgressManager& ProgressManager::getInstance() {
     static ProgressManager instance;
     return instance;
@@ -526,22 +535,28 @@ void ProgressManager::cleanupStaleEntries(int maxAgeMinutes) {
     }
 
     for (const auto& id : staleIds) {
+        Json::Value end;
+        end["uploadId"] = id;
+        end["stage"] = stageToString(progressCache_[id].stage);
         progressCache_.erase(id);
-        sseCallbacks_.erase(id);
+        bus_.removeTopic(id, end);
         spdlog::info("[ProgressManager] Cleaned up stale entry: {}", id.substr(0, 8));
     }
 
     if (!staleIds.empty()) {
-        spdlog::info("[ProgressManager] Cleaned up {} stale entries (cache size: {}, callbacks: {})",
-            staleIds.size(), progressCache_.size(), sseCallbacks_.size());
+        spdlog::info("[ProgressManager] Cleaned up {} stale entries (cache size: {})",
+            staleIds.size(), progressCache_.size());
     }
 }
 
 void ProgressManager::sendProgress(const ProcessingProgress& progress) {
-    std::function<void(const std::string&)> callbackCopy;
-    std::string uploadIdShort = progress.uploadId.substr(0, 8);
+    // Rendered by the bus at most once per interval, from an immutable copy
+    auto snapshot = std::make_shared<const ProcessingProgress>(progress);
+    bool urgent = progress.stage == ProcessingStage::COMPLETED || progress.stage == ProcessingStage::FAILED;
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        auto it = progressCache_.find(progress.uploadId);
+        if (it == progressCache_.end() || it->second.stage != progress.stage) urgent = true;
         progressCache_[progress.uploadId] = progress;
 
         // Periodic stale entry cleanup (every 100 calls)
@@ -549,70 +564,23 @@ void ProgressManager::sendProgress(const ProcessingProgress& progress) {
             sendProgressCallCount_ = 0;
             cleanupStaleEntries();
         }
-
-        // Copy callback reference while holding lock
-        auto it = sseCallbacks_.find(progress.uploadId);
-        if (it != sseCallbacks_.end()) {
-            callbackCopy = it->second;
-        }
-    }
-    // Call callback OUTSIDE lock scope to prevent deadlock
-    if (callbackCopy) {
-        try {
-            std::string sseData = "event: progress\ndata: " + progress.toJson() + "\n\n";
-            callbackCopy(sseData);
-            spdlog::info("[SSE] Sent event: {} - {} ({}%) processed={}/{}",
-                uploadIdShort, stageToString(progress.stage),
-                progress.percentage, progress.processedCount, progress.totalCount);
-        } catch (const std::exception& e) {
-            spdlog::warn("[SSE] Callback failed for {}: {}", uploadIdShort, e.what());
-            std::lock_guard<std::mutex> lock(mutex_);
-            sseCallbacks_.erase(progress.uploadId);
-        } catch (...) {
-            spdlog::warn("[SSE] Callback failed for {} (unknown error)", uploadIdShort);
-            std::lock_guard<std::mutex> lock(mutex_);
-            sseCallbacks_.erase(progress.uploadId);
-        }
-    } else {
-        spdlog::debug("[SSE] No callback registered for {} - {} ({}%)",
-            uploadIdShort, stageToString(progress.stage), progress.percentage);
     }
+    // Publish OUTSIDE lock scope: urgent publishes deliver on this thread
+    bus_.publish(progress.uploadId, [snapshot]() { return snapshot->toJsonValue(); }, urgent);
 
-    spdlog::debug("Progress: {} - {} ({}%)", progress.uploadId, stageToString(progress.stage), progress.percentage);
+    spdlog::debug("Progress: {} - {} ({}%) processed={}/{}", progress.uploadId.substr(0, 8),
+        stageToString(progress.stage), progress.percentage, progress.processedCount, progress.totalCount);
 }
 
-void ProgressManager::registerSseCallback(const std::string& uploadId, std::function<void(const std::string&)> callback) {
-    std::string cachedSseData;
-    std::string cachedStage;
-    int cachedPercentage = 0;
-    bool hasCached = false;
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        sseCallbacks_[uploadId] = callback;
-        spdlog::info("[SSE] Callback registered for upload: {}", uploadId.substr(0, 8));
-
-        // Prepare cached progress data while holding lock
-        auto it = progressCache_.find(uploadId);
-        if (it != progressCache_.end()) {
-            cachedSseData = "event: progress\ndata: " + it->second.toJson() + "\n\n";
-            cachedStage = stageToString(it->second.stage);
-            cachedPercentage = it->second.percentage;
-            hasCached = true;
-        }
-    }
-    // Send cached progress OUTSIDE lock scope to prevent deadlock
-    if (hasCached) {
-        callback(cachedSseData);
-        spdlog::info("[SSE] Sent cached progress: {} - {} ({}%)",
-            uploadId.substr(0, 8), cachedStage, cachedPercentage);
-    } else {
-        spdlog::info("[SSE] No cached progress for {}", uploadId.substr(0, 8));
-    }
+ProgressBus::SubscriptionId ProgressManager::subscribe(const std::string& uploadId, ProgressBus::Sink sink,
+                                                      ProgressBus::Backlog backlog) {
+    auto id = bus_.subscribe(uploadId, std::move(sink), std::move(backlog));
+    spdlog::info("[SSE] Subscriber {} registered for upload: {}", id, uploadId.substr(0, 8));
+    return id;
 }
 
-void ProgressManager::unregisterSseCallback(const std::string& uploadId) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    sseCallbacks_.erase(uploadId);
+void ProgressManager::unsubscribe(const std::string& uploadId, ProgressBus::SubscriptionId id) {
+    bus_.unsubscribe(uploadId, id);
 }
 
 std::optional<ProcessingProgress> ProgressManager::getProgress(const std::string& uploadId) {
@@ -625,9 +593,18 @@ std::optional<ProcessingProgress> ProgressManager::getProgress(const std::string
 }
 
 void ProgressManager::clearProgress(const std::string& uploadId) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    progressCache_.erase(uploadId);
-    sseCallbacks_.erase(uploadId);
+    Json::Value end;
+    end["uploadId"] = uploadId;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = progressCache_.find(uploadId);
+        if (it != progressCache_.end()) {
+            end["stage"] = stageToString(it->second.stage);
+            progressCache_.erase(it);
+        }
+    }
+    // Subscribers get "progress-end" and their streams close
+    bus_.removeTopic(uploadId, end);
 }
 
 // --- ICAO 9303 Compliance Checker Implementation ---
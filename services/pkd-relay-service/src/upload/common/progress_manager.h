@@ -9,6 +9,7 @@
 #include <optional>
 #include <chrono>
 #include <json/json.h>
+#include "progress_bus.h"
 
 // Forward declaration for X509 certificate (OpenSSL)
 typedef struct x509_st X509;
@@ -351,6 +352,11 @@ struct ProcessingProgress {
     std::optional<IcaoComplianceStatus> currentCompliance;  // Current cert compliance status
     std::optional<ValidationStatistics> statistics;         // Aggregated statistics
 
+    /**
+     * @brief Convert progress to JSON
+     */
+    Json::Value toJsonValue() const;
+
     /**
      * @brief Convert progress to JSON string
      * @return JSON string representation (single-line for SSE compatibility)
@@ -411,6 +417,8 @@ struct ProcessingProgress {
  *
  * Singleton class that manages progress updates for multiple concurrent file uploads.
  * Enhanced with certificate metadata tracking and ICAO compliance monitoring.
+ * SSE delivery goes through a ProgressBus (one topic per upload): any number of
+ * subscribers, coalesced renders and delta frames after the initial snapshot.
  *
  * Thread-safe for use in async processing contexts.
  */
@@ -418,11 +426,11 @@ class ProgressManager {
 private:
     std::mutex mutex_;
     std::map<std::string, ProcessingProgress> progressCache_;
-    std::map<std::string, std::function<void(const std::string&)>> sseCallbacks_;
+    ProgressBus bus_;
     int sendProgressCallCount_ = 0;  // Auto-cleanup trigger counter
 
     // Private constructor for singleton
-    ProgressManager() = default;
+    ProgressManager();
     ProgressManager(const ProgressManager&) = delete;
     ProgressManager& operator=(const ProgressManager&) = delete;
 
@@ -436,7 +444,9 @@ public:
     /**
      * @brief Send progress update
      *
-     * Updates the progress cache and notifies registered SSE callbacks.
+     * Updates the progress cache and publishes to the upload's bus topic.
+     * Stage changes and terminal stages are flushed to subscribers at once,
+     * other updates are coalesced to one frame per bus interval.
      * Thread-safe.
      *
      * @param progress ProcessingProgress instance
@@ -444,22 +454,30 @@ public:
     void sendProgress(const ProcessingProgress& progress);
 
     /**
-     * @brief Register SSE callback for progress updates
+     * @brief Subscribe an SSE stream to progress updates
      *
-     * Registers a callback function that will be called whenever progress
-     * is updated for the specified uploadId.
+     * The cached progress, if any, is sent as a snapshot before returning;
+     * later updates arrive as "progress-delta" events and clearProgress()
+     * ends the stream with "progress-end". A sink returning false is
+     * unsubscribed.
      *
      * @param uploadId Upload UUID
-     * @param callback Function to call with SSE-formatted data
+     * @param sink Receives SSE-formatted frames
+     * @param backlog Unsent bytes on the subscriber's connection (optional)
+     * @return Subscription id for unsubscribe()
      */
-    void registerSseCallback(const std::string& uploadId, std::function<void(const std::string&)> callback);
+    ProgressBus::SubscriptionId subscribe(const std::string& uploadId, ProgressBus::Sink sink,
+                                          ProgressBus::Backlog backlog = nullptr);
 
     /**
-     * @brief Unregister SSE callback
-     *
-     * @param uploadId Upload UUID
+     * @brief Remove an SSE subscription
+     */
+    void unsubscribe(const std::string& uploadId, ProgressBus::SubscriptionId id);
+
+    /**
+     * @brief Underlying bus (metrics)
      */
-    void unregisterSseCallback(const std::string& uploadId);
+    const ProgressBus& bus() const { return bus_; }
 
     /**
      * @brief Get current progress for an upload
@@ -472,7 +490,8 @@ public:
     /**
      * @brief Clear progress data for an upload
      *
-     * Removes both cached progress and SSE callback.
+     * Removes both cached progress and the bus topic; its subscribers are
+     * sent "progress-end" with the last stage.
      *
      * @param uploadId Upload UUID
      */
@@ -481,7 +500,7 @@ public:
     /**
      * @brief Remove stale entries from progress cache
      *
-     * Evicts entries older than maxAge from both progressCache_ and sseCallbacks_.
+     * Evicts entries older than maxAge from both progressCache_ and the bus.
      * Called automatically by sendProgress() every 100 calls.
      *
      * @param maxAgeMinutes Maximum age in minutes before eviction (default: 30)
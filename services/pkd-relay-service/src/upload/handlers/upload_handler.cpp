@@ -48,6 +48,9 @@
 // ICAO Validation Library (shared)
 #include <icao/validation/cert_ops.h>
 
+// Cross-service change signals
+#include <icao/search/search_summary_notify.h>
+
 // Repositories
 #include "upload/repositories/upload_repository.h"
 #include "upload/repositories/certificate_repository.h"
@@ -62,6 +65,7 @@
 
 // Common utilities
 #include "upload/common/ldif_types.h"
+#include "upload/common/ldif_stream_reader.h"
 #include "upload/common/main_utils.h"
 #include "upload/common/progress_manager.h"
 #include "upload/common/certificate_utils.h"
@@ -75,7 +79,7 @@
 // Handler utilities (sanitized error responses)
 #include "handler_utils.h"
 #include "upload/common/openssl_raii.h"
-#include "upload/common/thread_pool.h"
+#include "thread_pool.h"
 
 // Bring in audit types for cleaner code
 using icao::audit::AuditLogEntry;
@@ -402,21 +406,14 @@ void UploadHandler::processLdifFileAsync(const std::string& uploadId, const std:
                 ProcessingProgress::create(uploadId, ProcessingStage::PARSING_IN_PROGRESS,
                     0, 100, parseMsg));
 
-            // Read LDIF content from temp file (saved by uploadLdif() → saveToTempFile())
-            std::ifstream inFile(tempFilePath, std::ios::binary);
-            if (!inFile.is_open()) {
-                throw std::runtime_error("Failed to open temp file: " + tempFilePath);
-            }
-            std::string contentStr((std::istreambuf_iterator<char>(inFile)),
-                                    std::istreambuf_iterator<char>());
-            inFile.close();
-            spdlog::info("Read {} bytes from temp file for upload {}", contentStr.size(), uploadId);
-
-            // Parse LDIF content using LdifProcessor
-            std::vector<LdifEntry> entries = LdifProcessor::parseLdifContent(contentStr);
-            int totalEntries = static_cast<int>(entries.size());
+            // Stream LDIF from temp file (saved by uploadLdif() → saveToTempFile()).
+            // The file is memory-mapped and parsed entry by entry; the pre-scan only
+            // counts entries so the whole upload is never held in memory at once.
+            LdifStreamReader reader(tempFilePath);
+            auto summary = reader.preScan();
+            int totalEntries = summary.totalEntries;
 
-            spdlog::info("Parsed {} LDIF entries for upload {}", totalEntries, uploadId);
+            spdlog::info("Scanned {} LDIF entries ({} bytes) for upload {}", totalEntries, reader.size(), uploadId);
 
             // Update DB record: status = PROCESSING, total_entries populated
             if (g_uploadServices && g_uploadServices->uploadRepository()) {
@@ -430,7 +427,7 @@ void UploadHandler::processLdifFileAsync(const std::string& uploadId, const std:
             // Process all entries (AUTO mode: parse → validate → save to DB + LDAP)
             // In resume mode, fingerprint pre-cache will skip already-processed certificates
             AutoProcessingStrategy strategy;
-            strategy.processLdifEntries(uploadId, entries, ld);
+            strategy.processLdifFile(uploadId, reader, summary, ld);
 
             // Send parsing completed progress
             ProgressManager::getInstance().sendProgress(
@@ -1370,6 +1367,9 @@ void UploadHandler::cleanupPartialData(const std::string& uploadId) {
 
         spdlog::info("Partial data cleanup completed for upload {}: {} validations, {} duplicates, {} certs, {} CRLs, {} MLs deleted",
                      uploadId, valDeleted, dupDeleted, certsDeleted, crlsDeleted, mlsDeleted);
+        if (certsDeleted > 0) {
+            icao::search::notifySearchSummaryChanged("partial data cleanup " + uploadId);
+        }
     } catch (const std::exception& e) {
         spdlog::error("Failed to cleanup partial data for upload {}: {}", uploadId, e.what());
     }
@@ -1491,6 +1491,8 @@ void UploadHandler::handleDelete(
             return;
         }
 
+        icao::search::notifySearchSummaryChanged("upload delete " + uploadId);
+
         Json::Value result;
         result["success"] = true;
         result["message"] = "Upload deleted successfully";
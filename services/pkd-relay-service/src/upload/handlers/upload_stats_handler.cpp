@@ -10,10 +10,13 @@
 
 #include "upload_stats_handler.h"
 #include "handler_utils.h"
+#include "blocking_offload.h"
 
 #include <drogon/drogon.h>
 #include <spdlog/spdlog.h>
 #include <json/json.h>
+#include <trantor/net/TcpConnection.h>
+#include <atomic>
 #include <cstdlib>
 
 // Repositories
@@ -37,6 +40,43 @@ using common::stageToKorean;
 
 namespace handlers {
 
+namespace {
+
+/**
+ * @brief Bytes handed to an SSE stream that the socket has not sent yet
+ *
+ * ResponseStream::send() only queues into the connection's write buffer, so
+ * a stalled client shows up as a growing gap between what we handed over
+ * (frame plus chunked-encoding overhead) and TcpConnection::bytesSent().
+ */
+class SseBacklog {
+public:
+    explicit SseBacklog(std::weak_ptr<trantor::TcpConnection> conn) : conn_(std::move(conn)) {
+        if (auto c = conn_.lock()) baseline_ = c->bytesSent();
+    }
+
+    void handed(size_t frameBytes) {
+        size_t hexDigits = 1;
+        for (size_t n = frameBytes; n >= 16; n /= 16) hexDigits++;
+        handed_ += frameBytes + hexDigits + 4;  // "<hex>\r\n" + data + "\r\n"
+    }
+
+    size_t pending() const {
+        auto conn = conn_.lock();
+        if (!conn || !conn->connected()) return 0;
+        size_t sent = conn->bytesSent() - baseline_;
+        size_t handed = handed_.load();
+        return handed > sent ? handed - sent : 0;
+    }
+
+private:
+    std::weak_ptr<trantor::TcpConnection> conn_;
+    size_t baseline_ = 0;
+    std::atomic<size_t> handed_{0};
+};
+
+}  // namespace
+
 // =============================================================================
 // Constructor
 // =============================================================================
@@ -47,13 +87,15 @@ UploadStatsHandler::UploadStatsHandler(
     repositories::CertificateRepository* certificateRepository,
     repositories::ValidationRepository* validationRepository,
     common::IQueryExecutor* queryExecutor,
-    int asn1MaxLines)
+    int asn1MaxLines,
+    common::BlockingExecutor* executor)
     : uploadService_(uploadService),
       uploadRepository_(uploadRepository),
       certificateRepository_(certificateRepository),
       validationRepository_(validationRepository),
       queryExecutor_(queryExecutor),
-      asn1MaxLines_(asn1MaxLines)
+      asn1MaxLines_(asn1MaxLines),
+      executor_(executor)
 {
     if (!uploadService_) {
         throw std::invalid_argument("UploadStatsHandler: uploadService cannot be nullptr");
@@ -71,7 +113,8 @@ UploadStatsHandler::UploadStatsHandler(
         throw std::invalid_argument("UploadStatsHandler: queryExecutor cannot be nullptr");
     }
 
-    spdlog::info("[UploadStatsHandler] Initialized with Repository Pattern (asn1MaxLines={})", asn1MaxLines_);
+    spdlog::info("[UploadStatsHandler] Initialized with Repository Pattern (asn1MaxLines={}, blockingExecutor={})",
+                 asn1MaxLines_, executor_ ? "enabled" : "disabled");
 }
 
 // =============================================================================
@@ -84,7 +127,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/statistics",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetStatistics(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.statistics", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetStatistics(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -94,7 +138,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/statistics/validation-reasons",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetValidationReasons(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.statistics", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetValidationReasons(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -104,7 +149,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/statistics/icao-noncompliant",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetIcaoNonCompliant(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.statistics", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetIcaoNonCompliant(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -114,7 +160,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/history",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetHistory(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.history", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetHistory(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -125,7 +172,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& uploadId) {
-            handleGetDetail(req, std::move(callback), uploadId);
+            common::handler::runBlocking(executor_, "upload.detail", std::move(callback),
+                [this, req, uploadId](common::handler::ResponseCallback cb) { handleGetDetail(req, std::move(cb), uploadId); });
         },
         {drogon::Get}
     );
@@ -136,7 +184,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& uploadId) {
-            handleGetIssues(req, std::move(callback), uploadId);
+            common::handler::runBlocking(executor_, "upload.detail", std::move(callback),
+                [this, req, uploadId](common::handler::ResponseCallback cb) { handleGetIssues(req, std::move(cb), uploadId); });
         },
         {drogon::Get}
     );
@@ -147,7 +196,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& uploadId) {
-            handleGetMasterListStructure(req, std::move(callback), uploadId);
+            common::handler::runBlocking(executor_, "upload.masterlist-structure", std::move(callback),
+                [this, req, uploadId](common::handler::ResponseCallback cb) { handleGetMasterListStructure(req, std::move(cb), uploadId); });
         },
         {drogon::Get}
     );
@@ -157,7 +207,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/changes",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetChanges(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.changes", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetChanges(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -167,7 +218,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/countries",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetCountries(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.countries", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetCountries(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -177,7 +229,8 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         "/api/upload/countries/detailed",
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
-            handleGetCountriesDetailed(req, std::move(callback));
+            common::handler::runBlocking(executor_, "upload.countries", std::move(callback),
+                [this, req](common::handler::ResponseCallback cb) { handleGetCountriesDetailed(req, std::move(cb)); });
         },
         {drogon::Get}
     );
@@ -188,7 +241,9 @@ void UploadStatsHandler::registerRoutes(drogon::HttpAppFramework& app) {
         [this](const drogon::HttpRequestPtr& req,
                std::function<void(const drogon::HttpResponsePtr&)>&& callback,
                const std::string& uploadId) {
-            handleProgressStream(req, std::move(callback), uploadId);
+            // Offloaded: an id without cached progress is looked up in the DB
+            common::handler::runBlocking(executor_, "progress.stream", std::move(callback),
+                [this, req, uploadId](common::handler::ResponseCallback cb) { handleProgressStream(req, std::move(cb), uploadId); });
         },
         {drogon::Get}
     );
@@ -642,16 +697,31 @@ void UploadStatsHandler::handleGetCountriesDetailed(
 // -----------------------------------------------------------------------------
 
 void UploadStatsHandler::handleProgressStream(
-    const drogon::HttpRequestPtr& /* req */,
+    const drogon::HttpRequestPtr& req,
     std::function<void(const drogon::HttpResponsePtr&)>&& callback,
     const std::string& uploadId) {
 
     spdlog::info("GET /api/progress/stream/{} - SSE progress stream", uploadId);
 
+    // Without cached progress the upload is either finished/cleared, unknown,
+    // or queued and not yet reporting. Only the last case may subscribe; the
+    // others get "progress-end" at once instead of an idle topic.
+    Json::Value endData;
+    if (!ProgressManager::getInstance().getProgress(uploadId)) {
+        auto upload = uploadRepository_->findById(uploadId);
+        if (!upload) {
+            endData["uploadId"] = uploadId;
+            endData["status"] = "NOT_FOUND";
+        } else if (upload->status == "COMPLETED" || upload->status == "FAILED") {
+            endData["uploadId"] = uploadId;
+            endData["status"] = upload->status;
+        }
+    }
+
     // Create SSE response with chunked encoding
     // Use shared_ptr wrapper since ResponseStreamPtr is unique_ptr (non-copyable)
     auto resp = drogon::HttpResponse::newAsyncStreamResponse(
-        [uploadIdCopy = uploadId](drogon::ResponseStreamPtr streamPtr) {
+        [uploadIdCopy = uploadId, endData, conn = req->getConnectionPtr()](drogon::ResponseStreamPtr streamPtr) {
             // Convert unique_ptr to shared_ptr for lambda capture
             auto stream = std::shared_ptr<drogon::ResponseStream>(streamPtr.release());
 
@@ -659,22 +729,26 @@ void UploadStatsHandler::handleProgressStream(
             std::string connectedEvent = "event: connected\ndata: {\"message\":\"SSE connection established for " + uploadIdCopy + "\"}\n\n";
             stream->send(connectedEvent);
 
-            // Register callback for progress updates
-            ProgressManager::getInstance().registerSseCallback(uploadIdCopy,
-                [stream, uploadIdCopy](const std::string& data) {
-                    try {
-                        stream->send(data);
-                    } catch (...) {
-                        ProgressManager::getInstance().unregisterSseCallback(uploadIdCopy);
-                    }
-                });
-
-            // Send cached progress if available
-            auto progress = ProgressManager::getInstance().getProgress(uploadIdCopy);
-            if (progress) {
-                std::string sseData = "event: progress\ndata: " + progress->toJson() + "\n\n";
-                stream->send(sseData);
+            if (!endData.isNull()) {
+                stream->send(common::ProgressBus::endFrame(endData));
+                stream->close();
+                return;
             }
+
+            // Subscribe to progress updates: the cached progress arrives as a
+            // "progress" snapshot, later updates as "progress-delta" events,
+            // idle periods as heartbeat comments. send() returns false once
+            // the client is gone, which unsubscribes; frames are held while
+            // the socket has more than SSE_PROGRESS_MAX_BUFFERED_BYTES unsent.
+            auto backlog = std::make_shared<SseBacklog>(conn);
+            ProgressManager::getInstance().subscribe(uploadIdCopy,
+                [stream, backlog](const std::string& frame) {
+                    if (!stream->send(frame)) return false;
+                    backlog->handed(frame.size());
+                    if (common::ProgressBus::isEndFrame(frame)) stream->close();
+                    return true;
+                },
+                [backlog]() { return backlog->pending(); });
         });
 
     // Use setContentTypeString to properly set SSE content type
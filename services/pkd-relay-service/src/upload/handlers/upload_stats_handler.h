@@ -40,6 +40,7 @@ namespace services {
 // Forward declaration - query executor
 namespace common {
     class IQueryExecutor;
+    class BlockingExecutor;
 }
 
 namespace handlers {
@@ -63,6 +64,7 @@ public:
      * @param validationRepository Validation repository (non-owning pointer)
      * @param queryExecutor Query executor for direct DB queries (non-owning pointer)
      * @param asn1MaxLines Default max lines for ASN.1 structure parsing
+     * @param executor Blocking-work executor for DB handlers (nullptr = run on the event loop)
      */
     UploadStatsHandler(
         services::UploadService* uploadService,
@@ -70,7 +72,8 @@ public:
         repositories::CertificateRepository* certificateRepository,
         repositories::ValidationRepository* validationRepository,
         common::IQueryExecutor* queryExecutor,
-        int asn1MaxLines = 100);
+        int asn1MaxLines = 100,
+        common::BlockingExecutor* executor = nullptr);
 
     /**
      * @brief Register upload statistics routes
@@ -89,6 +92,7 @@ private:
     repositories::ValidationRepository* validationRepository_;
     common::IQueryExecutor* queryExecutor_;
     int asn1MaxLines_;
+    common::BlockingExecutor* executor_;
 
     // --- Handler methods ---
 
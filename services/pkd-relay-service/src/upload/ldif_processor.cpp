@@ -2,9 +2,9 @@
  * @file ldif_processor.cpp
  * @brief LDIF file processor implementation
  *
- * Contains parseCertificateEntry() and parseCrlEntry() which are called
- * from LdifProcessor::processEntries(). These were moved from main.cpp
- * to reduce its size.
+ * Contains the certificate validation/commit stages and parseCrlEntry() which
+ * are called from LdifProcessor::processEntries(). These were moved from
+ * main.cpp to reduce its size.
  */
 
 #include "ldif_processor.h"
@@ -20,9 +20,12 @@
 #include "repositories/crl_repository.h"
 #include "upload/common/db_csca_provider.h"
 #include "upload/common/db_crl_provider.h"
+#include "thread_pool.h"
 #include <icao/validation/cert_ops.h>
 #include <icao/validation/trust_chain_builder.h>
+#include <icao/validation/signature_cache.h>
 #include <icao/validation/crl_checker.h>
+#include <icao/validation/crl_cache.h>
 #include <spdlog/spdlog.h>
 #include <ldap.h>
 #include <openssl/x509.h>
@@ -34,7 +37,12 @@
 #include <openssl/asn1.h>
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
 #include <optional>
+#include <unordered_set>
 
 // Progress manager (includes sendProgressWithMetadata, sendDbSavingProgress)
 #include "common/progress_manager.h"
@@ -126,7 +134,7 @@ CscaValidationResult validateCscaCertificate(X509* cert) {
 }
 
 DscValidationResult validateDscCertificate(X509* dscCert, const std::string& issuerDn,
-                                            adapters::DbCscaProvider* sharedProvider = nullptr) {
+                                            icao::validation::ICscaProvider* sharedProvider = nullptr) {
     DscValidationResult result = {false, false, false, false, false, false, false, "", "", ""};
     if (!dscCert) { result.errorMessage = "DSC certificate is null"; return result; }
 
@@ -141,7 +149,7 @@ DscValidationResult validateDscCertificate(X509* dscCert, const std::string& iss
     // Build and validate trust chain via icao::validation library
     // Use shared provider (with cache) if available, otherwise create local one
     std::unique_ptr<adapters::DbCscaProvider> localProvider;
-    adapters::DbCscaProvider* provider = sharedProvider;
+    icao::validation::ICscaProvider* provider = sharedProvider;
     if (!provider) {
         localProvider = std::make_unique<adapters::DbCscaProvider>(g_uploadServices->certificateRepository());
         provider = localProvider.get();
@@ -167,111 +175,157 @@ DscValidationResult validateDscCertificate(X509* dscCert, const std::string& iss
 } // anonymous namespace
 
 // --- Certificate and CRL parsing (moved from main.cpp) ---
+//
+// Certificate processing is split in two stages so LDIF imports can fan the
+// CPU-bound part out over the validation pool:
+//   1. decodeCertificate() + validateCertificate(): base64/DER parsing, metadata,
+//      CSCA/DSC trust chain, ICAO compliance. No DB, LDAP or shared statistics.
+//   2. commitCertificate(): duplicate check, CRL check, statistics, DB + LDAP save.
+//      Always runs on the processing thread, in LDIF order.
+
+namespace {
 
 /**
- * @brief Parse and save certificate from LDIF entry (DB + LDAP)
+ * @brief Outcome of the trust chain / compliance stage for one certificate
  */
-bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
-                           const LdifEntry& entry, const std::string& attrName,
-                           int& cscaCount, int& dscCount, int& dscNcCount, int& ldapStoredCount,
-                           ValidationStats& validationStats,
-                           common::ValidationStatistics& enhancedStats,
-                           adapters::DbCscaProvider* sharedCscaProvider = nullptr,
-                           icao::validation::CrlChecker* sharedCrlChecker = nullptr,
-                           std::set<std::string>* newCscaCountries = nullptr) {
+struct CertificateValidation {
+    std::string certType;
+    std::string validationStatus = "PENDING";
+    std::string validationMessage;
+    domain::models::ValidationResult valRecord;
+    ValidationStats statsDelta;  // Applied to the upload's ValidationStats on commit
+    common::CertificateMetadata certMetadata;
+    common::IcaoComplianceStatus icaoCompliance;
+    x509::CertificateMetadata x509meta;
+    bool usedCscaLookup = false;  // Trust chain built against the CSCA cache (DSC, DSC_NC, LC)
+    std::chrono::high_resolution_clock::duration elapsed{};  // Validation stage time
+};
+
+/**
+ * @brief Certificate entry carried between the validation and commit stages
+ */
+struct PreparedCertificate {
+    bool decoded = false;
+    std::string errorCode;     // BASE64_DECODE_FAILED / CERT_PARSE_FAILED
+    std::string errorMessage;
+    std::vector<uint8_t> derBytes;
+    std::unique_ptr<X509, decltype(&X509_free)> cert{nullptr, X509_free};
+    std::string subjectDn;
+    std::string issuerDn;
+    std::string serialNumber;
+    std::string notBefore;
+    std::string notAfter;
+    std::string fingerprint;
+    std::string countryCode;
+
+    bool validated = false;
+    CertificateValidation validation;
+    adapters::DbCscaProvider::CscaSnapshot cscaSnapshot;  // CSCA cache the trust chain was built against
+};
+
+/**
+ * @brief LDIF attribute holding the entry's certificate, or nullptr
+ */
+const char* certificateAttribute(const LdifEntry& entry) {
+    if (entry.hasAttribute("userCertificate;binary")) return "userCertificate;binary";
+    if (entry.hasAttribute("cACertificate;binary")) return "cACertificate;binary";
+    return nullptr;
+}
+
+/**
+ * @brief Base64-decode and parse the certificate, extract identity fields
+ */
+void decodeCertificate(PreparedCertificate& p, const LdifEntry& entry, const std::string& attrName) {
+    p.decoded = true;
+
     std::string base64Value = entry.getFirstAttribute(attrName);
-    if (base64Value.empty()) return false;
+    if (base64Value.empty()) return;
 
     spdlog::debug("parseCertificateEntry: base64Value len={}, first20chars={}",
                  base64Value.size(), base64Value.substr(0, 20));
 
-    std::vector<uint8_t> derBytes = base64Decode(base64Value);
-    if (derBytes.empty()) {
-        common::addProcessingError(enhancedStats, "BASE64_DECODE_FAILED",
-            entry.dn, "", "", "", "Base64 decode returned empty for attribute: " + attrName);
-        return false;
+    p.derBytes = base64Decode(base64Value);
+    if (p.derBytes.empty()) {
+        p.errorCode = "BASE64_DECODE_FAILED";
+        p.errorMessage = "Base64 decode returned empty for attribute: " + attrName;
+        return;
     }
 
     spdlog::debug("parseCertificateEntry: derBytes size={}, first4bytes=0x{:02x}{:02x}{:02x}{:02x}",
-                 derBytes.size(),
-                 derBytes.size() > 0 ? derBytes[0] : 0,
-                 derBytes.size() > 1 ? derBytes[1] : 0,
-                 derBytes.size() > 2 ? derBytes[2] : 0,
-                 derBytes.size() > 3 ? derBytes[3] : 0);
-
-    const uint8_t* data = derBytes.data();
-    X509* cert = d2i_X509(nullptr, &data, static_cast<long>(derBytes.size()));
-    if (!cert) {
+                 p.derBytes.size(),
+                 p.derBytes.size() > 0 ? p.derBytes[0] : 0,
+                 p.derBytes.size() > 1 ? p.derBytes[1] : 0,
+                 p.derBytes.size() > 2 ? p.derBytes[2] : 0,
+                 p.derBytes.size() > 3 ? p.derBytes[3] : 0);
+
+    const uint8_t* data = p.derBytes.data();
+    p.cert.reset(d2i_X509(nullptr, &data, static_cast<long>(p.derBytes.size())));
+    if (!p.cert) {
         spdlog::warn("Failed to parse certificate from entry: {}", entry.dn);
-        common::addProcessingError(enhancedStats, "CERT_PARSE_FAILED",
-            entry.dn, "", "", "", "Failed to parse X.509 certificate (d2i_X509 returned NULL)");
-        return false;
+        p.errorCode = "CERT_PARSE_FAILED";
+        p.errorMessage = "Failed to parse X.509 certificate (d2i_X509 returned NULL)";
+        return;
     }
 
-    std::string subjectDn = x509NameToString(X509_get_subject_name(cert));
-    std::string issuerDn = x509NameToString(X509_get_issuer_name(cert));
-    std::string serialNumber = asn1IntegerToHex(X509_get_serialNumber(cert));
-    std::string notBefore = asn1TimeToIso8601(X509_get0_notBefore(cert));
-    std::string notAfter = asn1TimeToIso8601(X509_get0_notAfter(cert));
-    std::string fingerprint = computeFileHash(derBytes);
-    std::string countryCode = extractCountryCode(subjectDn);
-    if (countryCode == "XX") {
-        countryCode = extractCountryCode(issuerDn);
+    X509* cert = p.cert.get();
+    p.subjectDn = x509NameToString(X509_get_subject_name(cert));
+    p.issuerDn = x509NameToString(X509_get_issuer_name(cert));
+    p.serialNumber = asn1IntegerToHex(X509_get_serialNumber(cert));
+    p.notBefore = asn1TimeToIso8601(X509_get0_notBefore(cert));
+    p.notAfter = asn1TimeToIso8601(X509_get0_notAfter(cert));
+    p.fingerprint = computeFileHash(p.derBytes);
+    p.countryCode = extractCountryCode(p.subjectDn);
+    if (p.countryCode == "XX") {
+        p.countryCode = extractCountryCode(p.issuerDn);
     }
+}
 
-    // Early fingerprint cache check: skip entire processing for already-processed certificates.
-    // During resume mode (FAILED retry), most certificates are already in DB.
-    // Without this check, each duplicate still triggers X.509 validation + LDAP write (~10ms/cert).
-    // With this check, duplicates are skipped in ~0.001ms (hash lookup only).
-    if (g_uploadServices->certificateRepository()->isFingerprintCached(fingerprint)) {
-        auto cachedInfo = g_uploadServices->certificateRepository()->getCachedFingerprintInfo(fingerprint);
-        X509_free(cert);
-        enhancedStats.totalCertificates++;
-        enhancedStats.duplicateCount++;
-
-        // Copy existing validation_result for this upload_id so that
-        // per-certificate ICAO violation details can be queried by upload_id
-        g_uploadServices->validationRepository()->copyForUpload(fingerprint, uploadId);
-
-        // Track duplicate in certificate_duplicates table for UI display
-        if (cachedInfo) {
-            certificate_utils::trackCertificateDuplicate(
-                cachedInfo->id, uploadId, "LDIF_PARSED", countryCode, entry.dn, "");
-        }
+/**
+ * @brief Determine certificate type, validate trust chain and ICAO compliance
+ *
+ * Thread-safe as long as cscaProvider is (CscaSnapshotProvider on workers).
+ * Replaces any previous result in p.validation.
+ */
+void validateCertificate(PreparedCertificate& p, const LdifEntry& entry,
+                         icao::validation::ICscaProvider* cscaProvider) {
+    p.validation = CertificateValidation{};
+    p.validated = true;
 
-        return true;  // Already processed — skip validation, DB save, and LDAP write
-    }
+    CertificateValidation& v = p.validation;
+    X509* cert = p.cert.get();
+    const std::string& subjectDn = p.subjectDn;
+    const std::string& issuerDn = p.issuerDn;
+    const std::string& countryCode = p.countryCode;
 
     // Extract comprehensive certificate metadata for progress tracking
     // Note: This extraction is done early (before validation) so metadata is available
     // for enhanced progress updates. ICAO compliance will be checked after cert type is determined.
-    common::CertificateMetadata certMetadata = common::extractCertificateMetadataForProgress(cert, false);
+    v.certMetadata = common::extractCertificateMetadataForProgress(cert, false);
     spdlog::debug("Extracted metadata for cert: type={}, sigAlg={}, keySize={}",
-                  certMetadata.certificateType, certMetadata.signatureAlgorithm, certMetadata.keySize);
+                  v.certMetadata.certificateType, v.certMetadata.signatureAlgorithm, v.certMetadata.keySize);
 
     // Determine certificate type and perform validation
-    std::string certType;
-    std::string validationStatus = "PENDING";
-    std::string validationMessage = "";
+    std::string& certType = v.certType;
+    std::string& validationStatus = v.validationStatus;
+    std::string& validationMessage = v.validationMessage;
+    ValidationStats& validationStats = v.statsDelta;
 
     // Prepare validation result record
-    domain::models::ValidationResult valRecord;
-    valRecord.uploadId = uploadId;
-    valRecord.fingerprint = fingerprint;
+    domain::models::ValidationResult& valRecord = v.valRecord;
+    valRecord.fingerprint = p.fingerprint;
     valRecord.countryCode = countryCode;
     valRecord.subjectDn = subjectDn;
     valRecord.issuerDn = issuerDn;
-    valRecord.serialNumber = serialNumber;
-    valRecord.notBefore = notBefore;
-    valRecord.notAfter = notAfter;
-    valRecord.signatureAlgorithm = certMetadata.signatureAlgorithm;
+    valRecord.serialNumber = p.serialNumber;
+    valRecord.notBefore = p.notBefore;
+    valRecord.notAfter = p.notAfter;
+    valRecord.signatureAlgorithm = v.certMetadata.signatureAlgorithm;
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
     if (subjectDn == issuerDn) {
         // CSCA - self-signed certificate
         certType = "CSCA";
-        cscaCount++;
         valRecord.certificateType = "CSCA";
         valRecord.isSelfSigned = true;
 
@@ -312,12 +366,12 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
     } else if (containsIgnoreCase(entry.dn, "dc=nc-data")) {
         // Non-Conformant DSC - detected by dc=nc-data in LDIF DN path (case-insensitive)
         certType = "DSC_NC";
-        dscNcCount++;
         valRecord.certificateType = "DSC_NC";
         spdlog::info("Detected DSC_NC certificate from nc-data path: dn={}", entry.dn);
 
         // DSC_NC - perform trust chain validation (ICAO hybrid model)
-        auto dscValidation = validateDscCertificate(cert, issuerDn, sharedCscaProvider);
+        v.usedCscaLookup = true;
+        auto dscValidation = validateDscCertificate(cert, issuerDn, cscaProvider);
         valRecord.cscaFound = dscValidation.cscaFound;
         valRecord.cscaSubjectDn = dscValidation.cscaSubjectDn;
         valRecord.signatureVerified = dscValidation.signatureValid;
@@ -378,7 +432,6 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
         if (isLinkCertificate) {
             // Link Certificate - Cross-signed CSCA (subject != issuer)
             certType = "CSCA";  // Store as CSCA in DB for querying
-            cscaCount++;
             valRecord.certificateType = "CSCA";
             valRecord.isSelfSigned = false;  // Link cert is not self-signed
             valRecord.isCa = cscaValidation.isCa;
@@ -387,7 +440,8 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
             valRecord.keyUsageValid = cscaValidation.hasKeyCertSign;
 
             // Link certificates need parent CSCA validation (ICAO hybrid model)
-            auto lcValidation = validateDscCertificate(cert, issuerDn, sharedCscaProvider);
+            v.usedCscaLookup = true;
+            auto lcValidation = validateDscCertificate(cert, issuerDn, cscaProvider);
             valRecord.cscaFound = lcValidation.cscaFound;
             valRecord.cscaSubjectDn = lcValidation.cscaSubjectDn;
             valRecord.trustChainPath = lcValidation.trustChainPath;
@@ -439,12 +493,12 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
         } else {
             // Regular DSC
             certType = "DSC";
-            dscCount++;
             valRecord.certificateType = "DSC";
 
         // DSC - perform trust chain validation
         // ICAO Doc 9303 Part 12 hybrid chain model: expiration is informational
-        auto dscValidation = validateDscCertificate(cert, issuerDn, sharedCscaProvider);
+        v.usedCscaLookup = true;
+        auto dscValidation = validateDscCertificate(cert, issuerDn, cscaProvider);
         valRecord.cscaFound = dscValidation.cscaFound;
         valRecord.cscaSubjectDn = dscValidation.cscaSubjectDn;
         valRecord.signatureVerified = dscValidation.signatureValid;
@@ -500,7 +554,160 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
         }  // End of else block for regular DSC
     }
 
+    // Check ICAO 9303 compliance after certificate type is determined
+    v.icaoCompliance = common::checkIcaoCompliance(cert, certType);
+    const common::IcaoComplianceStatus& icaoCompliance = v.icaoCompliance;
+    spdlog::debug("ICAO compliance for {} cert: isCompliant={}, level={}",
+                  certType, icaoCompliance.isCompliant, icaoCompliance.complianceLevel);
+
+    // Persist ICAO compliance details to validation record (saved to DB)
+    valRecord.icaoCompliant = icaoCompliance.isCompliant;
+    valRecord.icaoComplianceLevel = icaoCompliance.complianceLevel;
+    valRecord.icaoKeyUsageCompliant = icaoCompliance.keyUsageCompliant;
+    valRecord.icaoAlgorithmCompliant = icaoCompliance.algorithmCompliant;
+    valRecord.icaoKeySizeCompliant = icaoCompliance.keySizeCompliant;
+    valRecord.icaoValidityPeriodCompliant = icaoCompliance.validityPeriodCompliant;
+    valRecord.icaoExtensionsCompliant = icaoCompliance.extensionsCompliant;
+    {
+        std::string violations;
+        for (const auto& violation : icaoCompliance.violations) {
+            if (!violations.empty()) violations += "|";
+            violations += violation;
+        }
+        // DSC_NC: append LDIF conformance code/text to violations for richer detail
+        if (certType == "DSC_NC") {
+            std::string ncCode = entry.getFirstAttribute("pkdConformanceCode");
+            std::string ncText = entry.getFirstAttribute("pkdConformanceText");
+            if (!ncCode.empty()) {
+                if (!violations.empty()) violations += "|";
+                violations += "NC Code: " + ncCode;
+            }
+            if (!ncText.empty()) {
+                if (!violations.empty()) violations += "|";
+                violations += "NC Description: " + ncText;
+            }
+        }
+        valRecord.icaoViolations = violations;
+    }
+
+    // Extract full X.509 metadata while the cert is parsed (avoids re-parsing in repository)
+    v.x509meta = x509::extractMetadata(cert);
+
+    v.elapsed = std::chrono::high_resolution_clock::now() - startTime;
+}
+
+/**
+ * @brief Validation stage entry point for pool workers
+ *
+ * Skips trust chain work for certificates already in the DB when processing
+ * started (commit stage takes the duplicate path) and when no CSCA snapshot
+ * is available (commit stage validates against the live provider).
+ */
+void prepareCertificate(PreparedCertificate& p, const LdifEntry& entry, const std::string& attrName,
+                        const adapters::DbCscaProvider::CscaSnapshot& cscaSnapshot,
+                        const std::unordered_set<std::string>& knownFingerprints) {
+    decodeCertificate(p, entry, attrName);
+    if (!p.cert) return;
+    if (knownFingerprints.count(p.fingerprint) > 0) return;
+    if (!cscaSnapshot) return;
+
+    adapters::CscaSnapshotProvider provider(cscaSnapshot);
+    validateCertificate(p, entry, &provider);
+    p.cscaSnapshot = cscaSnapshot;
+}
+
+/**
+ * @brief Commit stage: duplicate check, CRL check, statistics, DB + LDAP save
+ *
+ * Must run on the processing thread in LDIF order. Anything the validation
+ * stage skipped or computed against a CSCA snapshot that has since been
+ * replaced is (re)done here, so results match purely sequential processing.
+ */
+bool commitCertificate(LDAP* ld, const std::string& uploadId,
+                       const LdifEntry& entry, const std::string& attrName,
+                       PreparedCertificate& p,
+                       int& cscaCount, int& dscCount, int& dscNcCount, int& ldapStoredCount,
+                       ValidationStats& validationStats,
+                       common::ValidationStatistics& enhancedStats,
+                       adapters::DbCscaProvider* sharedCscaProvider,
+                       icao::validation::CrlChecker* sharedCrlChecker,
+                       std::set<std::string>* newCscaCountries) {
+    if (!p.decoded) {
+        decodeCertificate(p, entry, attrName);
+    }
+    if (!p.cert) {
+        if (!p.errorCode.empty()) {
+            common::addProcessingError(enhancedStats, p.errorCode,
+                entry.dn, "", "", "", p.errorMessage);
+        }
+        return false;
+    }
+
+    const std::string& subjectDn = p.subjectDn;
+    const std::string& issuerDn = p.issuerDn;
+    const std::string& fingerprint = p.fingerprint;
+    const std::string& countryCode = p.countryCode;
+
+    // Early fingerprint cache check: skip entire processing for already-processed certificates.
+    // During resume mode (FAILED retry), most certificates are already in DB.
+    // Without this check, each duplicate still triggers X.509 validation + LDAP write (~10ms/cert).
+    // With this check, duplicates are skipped in ~0.001ms (hash lookup only).
+    if (g_uploadServices->certificateRepository()->isFingerprintCached(fingerprint)) {
+        auto cachedInfo = g_uploadServices->certificateRepository()->getCachedFingerprintInfo(fingerprint);
+        enhancedStats.totalCertificates++;
+        enhancedStats.duplicateCount++;
+
+        // Copy existing validation_result for this upload_id so that
+        // per-certificate ICAO violation details can be queried by upload_id
+        g_uploadServices->validationRepository()->copyForUpload(fingerprint, uploadId);
+
+        // Track duplicate in certificate_duplicates table for UI display
+        if (cachedInfo) {
+            g_uploadServices->certificateRepository()->stageCertificateDuplicate(
+                cachedInfo->id, uploadId, "LDIF_PARSED", countryCode, entry.dn, "");
+        }
+
+        return true;  // Already processed — skip validation, DB save, and LDAP write
+    }
+
+    // Validate here if the worker did not, or if a CSCA saved since dispatch
+    // replaced the snapshot its trust chain was built against
+    bool staleSnapshot = p.validated && p.validation.usedCscaLookup && sharedCscaProvider &&
+                         p.cscaSnapshot != sharedCscaProvider->snapshot();
+    if (!p.validated || staleSnapshot) {
+        validateCertificate(p, entry, sharedCscaProvider);
+    }
+
+    X509* cert = p.cert.get();
+    CertificateValidation& v = p.validation;
+    const std::string& certType = v.certType;
+    std::string& validationStatus = v.validationStatus;
+    const std::string& validationMessage = v.validationMessage;
+    domain::models::ValidationResult& valRecord = v.valRecord;
+    const common::CertificateMetadata& certMetadata = v.certMetadata;
+    const common::IcaoComplianceStatus& icaoCompliance = v.icaoCompliance;
+    valRecord.uploadId = uploadId;
+    auto commitStartTime = std::chrono::high_resolution_clock::now();
+
+    if (certType == "CSCA") {
+        cscaCount++;
+    } else if (certType == "DSC_NC") {
+        dscNcCount++;
+    } else {
+        dscCount++;
+    }
+    validationStats.validCount += v.statsDelta.validCount;
+    validationStats.invalidCount += v.statsDelta.invalidCount;
+    validationStats.pendingCount += v.statsDelta.pendingCount;
+    validationStats.errorCount += v.statsDelta.errorCount;
+    validationStats.trustChainValidCount += v.statsDelta.trustChainValidCount;
+    validationStats.trustChainInvalidCount += v.statsDelta.trustChainInvalidCount;
+    validationStats.cscaNotFoundCount += v.statsDelta.cscaNotFoundCount;
+    validationStats.expiredCount += v.statsDelta.expiredCount;
+    validationStats.revokedCount += v.statsDelta.revokedCount;
+
     // CRL revocation check for DSC/DSC_NC with valid trust chain (ICAO Doc 9303 Part 11)
+    // Runs in the commit stage: CRLs saved earlier in this batch must be visible
     if (sharedCrlChecker && (certType == "DSC" || certType == "DSC_NC") && valRecord.trustChainValid) {
         try {
             icao::validation::CrlCheckResult crlResult = sharedCrlChecker->check(cert, countryCode);
@@ -534,41 +741,6 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
         }
     }
 
-    // Check ICAO 9303 compliance after certificate type is determined
-    common::IcaoComplianceStatus icaoCompliance = common::checkIcaoCompliance(cert, certType);
-    spdlog::debug("ICAO compliance for {} cert: isCompliant={}, level={}",
-                  certType, icaoCompliance.isCompliant, icaoCompliance.complianceLevel);
-
-    // Persist ICAO compliance details to validation record (saved to DB)
-    valRecord.icaoCompliant = icaoCompliance.isCompliant;
-    valRecord.icaoComplianceLevel = icaoCompliance.complianceLevel;
-    valRecord.icaoKeyUsageCompliant = icaoCompliance.keyUsageCompliant;
-    valRecord.icaoAlgorithmCompliant = icaoCompliance.algorithmCompliant;
-    valRecord.icaoKeySizeCompliant = icaoCompliance.keySizeCompliant;
-    valRecord.icaoValidityPeriodCompliant = icaoCompliance.validityPeriodCompliant;
-    valRecord.icaoExtensionsCompliant = icaoCompliance.extensionsCompliant;
-    {
-        std::string violations;
-        for (const auto& v : icaoCompliance.violations) {
-            if (!violations.empty()) violations += "|";
-            violations += v;
-        }
-        // DSC_NC: append LDIF conformance code/text to violations for richer detail
-        if (certType == "DSC_NC") {
-            std::string ncCode = entry.getFirstAttribute("pkdConformanceCode");
-            std::string ncText = entry.getFirstAttribute("pkdConformanceText");
-            if (!ncCode.empty()) {
-                if (!violations.empty()) violations += "|";
-                violations += "NC Code: " + ncCode;
-            }
-            if (!ncText.empty()) {
-                if (!violations.empty()) violations += "|";
-                violations += "NC Description: " + ncText;
-            }
-        }
-        valRecord.icaoViolations = violations;
-    }
-
     // Update enhanced statistics (ValidationStatistics)
     enhancedStats.totalCertificates++;
     enhancedStats.certificateTypes[certType]++;
@@ -640,27 +812,34 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
     // Statistics will be updated once the parameter is added to function signature
 
     auto endTime = std::chrono::high_resolution_clock::now();
-    valRecord.validationDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
-
-    // Extract full X.509 metadata before freeing cert (avoids re-parsing in repository)
-    x509::CertificateMetadata x509meta = x509::extractMetadata(cert);
+    valRecord.validationDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        v.elapsed + (endTime - commitStartTime)).count();
 
-    X509_free(cert);
+    p.cert.reset();
 
     // 1. Save to DB with validation status (pass pre-extracted metadata to skip d2i_X509 in repository)
-    auto [certId, isDuplicate] = certificate_utils::saveCertificateWithDuplicateCheck(
-        uploadId, certType, countryCode,
-        subjectDn, issuerDn, serialNumber, fingerprint,
-        notBefore, notAfter, derBytes,
-        validationStatus, validationMessage, &x509meta,
-        "LDIF_PARSED"
-    );
+    // CSCAs are written immediately: the CSCA cache reload below reads them back.
+    // Everything else is staged and written in bulk at the next batch boundary.
+    auto* certRepo = g_uploadServices->certificateRepository();
+    auto [certId, isDuplicate] = (certType == "CSCA")
+        ? certRepo->saveCertificateWithDuplicateCheck(
+              uploadId, certType, countryCode,
+              subjectDn, issuerDn, p.serialNumber, fingerprint,
+              p.notBefore, p.notAfter, p.derBytes,
+              validationStatus, validationMessage, &v.x509meta,
+              "LDIF_PARSED")
+        : certRepo->stageCertificateWithDuplicateCheck(
+              uploadId, certType, countryCode,
+              subjectDn, issuerDn, p.serialNumber, fingerprint,
+              p.notBefore, p.notAfter, p.derBytes,
+              validationStatus, validationMessage, &v.x509meta,
+              "LDIF_PARSED");
 
     if (isDuplicate) {
         enhancedStats.duplicateCount++;
         // Track duplicate in certificate_duplicates table for UI display
         if (!certId.empty()) {
-            certificate_utils::trackCertificateDuplicate(
+            certRepo->stageCertificateDuplicate(
                 certId, uploadId, "LDIF_PARSED", countryCode, entry.dn, "");
         }
     }
@@ -681,7 +860,7 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
 
         // 3. Save validation result via ValidationRepository
         valRecord.certificateId = certId;
-        g_uploadServices->validationRepository()->save(valRecord);
+        g_uploadServices->validationRepository()->stage(valRecord);
 
         // 4. Save to LDAP
         if (ld) {
@@ -699,12 +878,12 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
             }
 
             std::string ldapDn = g_uploadServices->ldapStorageService()->saveCertificateToLdap(ld, ldapCertType, countryCode,
-                                                        subjectDn, issuerDn, serialNumber,
-                                                        fingerprint, derBytes,
+                                                        subjectDn, issuerDn, p.serialNumber,
+                                                        fingerprint, p.derBytes,
                                                         pkdConformanceCode, pkdConformanceText, pkdVersion);
             if (!ldapDn.empty()) {
-                // Use Repository method instead of standalone function
-                g_uploadServices->certificateRepository()->updateCertificateLdapStatus(certId, ldapDn);
+                // Use Repository method instead of standalone function (patches staged rows in place)
+                certRepo->updateCertificateLdapStatus(certId, ldapDn);
                 ldapStoredCount++;
                 spdlog::debug("Saved certificate to LDAP: {}", ldapDn);
             } else {
@@ -722,6 +901,8 @@ bool parseCertificateEntry(LDAP* ld, const std::string& uploadId,
     return !certId.empty();
 }
 
+} // anonymous namespace
+
 /**
  * @brief Parse and save CRL from LDIF entry (DB + LDAP)
  */
@@ -771,6 +952,8 @@ bool parseCrlEntry(LDAP* ld, const std::string& uploadId,
 
     if (!crlId.empty()) {
         crlCount++;
+        // New CRL for this country — drop the parsed copy so checks see it
+        icao::validation::CrlCache::instance().invalidate(countryCode);
 
         // Save revoked certificates to DB
         STACK_OF(X509_REVOKED)* revokedStack = X509_CRL_get_REVOKED(crl);
@@ -925,10 +1108,26 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
     ValidationStats& stats,
     common::ValidationStatistics& enhancedStats,
     const TotalCounts* totalCounts
+) {
+    size_t index = 0;
+    EntrySource source = [&entries, &index]() -> const LdifEntry* {
+        return index < entries.size() ? &entries[index++] : nullptr;
+    };
+    return processEntryStream(uploadId, source, static_cast<int>(entries.size()),
+                              ld, stats, enhancedStats, totalCounts);
+}
+
+LdifProcessor::ProcessingCounts LdifProcessor::processEntryStream(
+    const std::string& uploadId,
+    const EntrySource& nextEntry,
+    int totalEntries,
+    LDAP* ld,
+    ValidationStats& stats,
+    common::ValidationStatistics& enhancedStats,
+    const TotalCounts* totalCounts
 ) {
     ProcessingCounts counts;
     int processedEntries = 0;
-    int totalEntries = static_cast<int>(entries.size());
 
     spdlog::info("Processing {} LDIF entries for upload {}", totalEntries, uploadId);
 
@@ -947,7 +1146,8 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
     std::unique_ptr<icao::validation::CrlChecker> crlChecker;
     if (g_uploadServices->crlRepository()) {
         crlProvider = std::make_unique<adapters::DbCrlProvider>(g_uploadServices->crlRepository());
-        crlChecker = std::make_unique<icao::validation::CrlChecker>(crlProvider.get());
+        crlChecker = std::make_unique<icao::validation::CrlChecker>(
+            crlProvider.get(), &icao::validation::CrlCache::instance());
         spdlog::info("CRL checker initialized for upload-time revocation check");
     }
 
@@ -960,27 +1160,32 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
     auto* queryExecutor = g_uploadServices->queryExecutor();
     queryExecutor->beginBatch();
 
-    // Process each entry
-    for (const auto& entry : entries) {
+    // Staged certificate, duplicate and validation rows are written once per batch,
+    // outside any entry savepoint. Certificates first: the other rows reference them.
+    auto flushStagedWrites = [&]() {
+        repositories::CertificateRepository::CertificateIdRemap reassigned;
+        g_uploadServices->certificateRepository()->flushStaged(&reassigned);
+        g_uploadServices->validationRepository()->flushStaged(reassigned);
+    };
+
+    // Commit stage for one entry: DB/LDAP writes, statistics and progress.
+    // Always runs on this thread, in LDIF order.
+    auto commitEntry = [&](const LdifEntry& entry, PreparedCertificate& prepared) {
         // Create SAVEPOINT before each entry for PostgreSQL error recovery.
         // PostgreSQL transactions abort on any query failure — SAVEPOINT allows
         // rolling back just the failed entry without losing the entire batch.
         queryExecutor->savepoint("sp_entry");
+        // Staged rows are not covered by the savepoint; undo them alongside it
+        auto certificateMark = g_uploadServices->certificateRepository()->stageMark();
+        size_t validationMark = g_uploadServices->validationRepository()->stagedCount();
 
         try {
-            // Check for userCertificate;binary
-            if (entry.hasAttribute("userCertificate;binary")) {
-                parseCertificateEntry(ld, uploadId, entry, "userCertificate;binary",
-                                    counts.cscaCount, counts.dscCount, counts.dscNcCount,
-                                    counts.ldapCertStoredCount, stats, enhancedStats,
-                                    &sharedCscaProvider, crlChecker.get(), &counts.newCscaCountries);
-            }
-            // Check for cACertificate;binary
-            else if (entry.hasAttribute("cACertificate;binary")) {
-                parseCertificateEntry(ld, uploadId, entry, "cACertificate;binary",
-                                    counts.cscaCount, counts.dscCount, counts.dscNcCount,
-                                    counts.ldapCertStoredCount, stats, enhancedStats,
-                                    &sharedCscaProvider, crlChecker.get(), &counts.newCscaCountries);
+            // Check for userCertificate;binary, then cACertificate;binary
+            if (const char* certAttr = certificateAttribute(entry)) {
+                commitCertificate(ld, uploadId, entry, certAttr, prepared,
+                                  counts.cscaCount, counts.dscCount, counts.dscNcCount,
+                                  counts.ldapCertStoredCount, stats, enhancedStats,
+                                  &sharedCscaProvider, crlChecker.get(), &counts.newCscaCountries);
             }
 
             // Check for CRL
@@ -1008,6 +1213,8 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
             // Without this, all subsequent queries in the batch would fail with
             // "current transaction is aborted, commands ignored until end of transaction block"
             queryExecutor->rollbackToSavepoint("sp_entry");
+            g_uploadServices->certificateRepository()->rollbackStaged(certificateMark);
+            g_uploadServices->validationRepository()->rollbackStaged(validationMark);
 
             spdlog::warn("Error processing entry {}: {}", entry.dn, e.what());
             common::addProcessingError(enhancedStats, "ENTRY_PROCESSING_EXCEPTION",
@@ -1015,11 +1222,15 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
         }
 
         processedEntries++;
+        // Streaming sources report an estimate; never let progress run past 100%
+        int reportedTotal = std::max(totalEntries, processedEntries);
 
         // Update DB progress every 500 entries (for upload history/detail page)
         if (g_uploadServices->uploadRepository() && (processedEntries % 500 == 0 || processedEntries == totalEntries)) {
+            flushStagedWrites();
+
             // Update progress BEFORE endBatch so it's committed in the same batch
-            g_uploadServices->uploadRepository()->updateProgress(uploadId, totalEntries, processedEntries);
+            g_uploadServices->uploadRepository()->updateProgress(uploadId, reportedTotal, processedEntries);
             g_uploadServices->uploadRepository()->updateStatistics(uploadId,
                 counts.cscaCount, counts.dscCount, counts.dscNcCount, counts.crlCount,
                 counts.mlscCount, counts.mlCount);
@@ -1094,7 +1305,7 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
                 uploadId,
                 common::ProcessingStage::VALIDATION_IN_PROGRESS,
                 processedEntries,
-                totalEntries,
+                reportedTotal,
                 progressMsg,
                 std::nullopt,  // No current certificate metadata (batch update)
                 std::nullopt,  // No current compliance status (batch update)
@@ -1102,18 +1313,94 @@ LdifProcessor::ProcessingCounts LdifProcessor::processEntries(
             );
 
             spdlog::info("Processing progress: {}/{} entries, {} certs ({} LDAP), {} CRLs ({} LDAP), {} MLs ({} LDAP)",
-                        processedEntries, totalEntries,
+                        processedEntries, reportedTotal,
                         counts.cscaCount + counts.dscCount, counts.ldapCertStoredCount,
                         counts.crlCount, counts.ldapCrlStoredCount,
                         counts.mlCount, counts.ldapMlStoredCount);
         }
+    };
+
+    common::ThreadPool* validationPool = g_uploadServices->validationPool();
+    size_t workerCount = validationPool ? validationPool->workerCount() : 0;
+
+    if (workerCount == 0) {
+        // Sequential: validate and commit each entry as it arrives from the source
+        while (const LdifEntry* current = nextEntry()) {
+            PreparedCertificate prepared;
+            commitEntry(*current, prepared);
+        }
+    } else {
+        // Pipelined: certificate parsing + trust chain validation fan out over the
+        // validation pool; commits stay in LDIF order on this thread. The window
+        // bounds how many entries are copied and in flight at once.
+        const size_t window = workerCount * 4;
+        auto knownFingerprints = std::make_shared<const std::unordered_set<std::string>>(
+            g_uploadServices->certificateRepository()->cachedFingerprints());
+        spdlog::info("Parallel validation enabled: {} workers, window {} entries", workerCount, window);
+
+        struct EntryJob {
+            LdifEntry entry;
+            PreparedCertificate prepared;
+            std::promise<void> done;
+        };
+        std::deque<std::pair<std::shared_ptr<EntryJob>, std::future<void>>> inFlight;
+        bool sourceDrained = false;
+
+        while (true) {
+            while (!sourceDrained && inFlight.size() < window) {
+                const LdifEntry* current = nextEntry();
+                if (!current) {
+                    sourceDrained = true;
+                    break;
+                }
+
+                auto job = std::make_shared<EntryJob>();
+                job->entry = *current;
+                std::future<void> ready = job->done.get_future();
+
+                bool submitted = false;
+                if (const char* certAttr = certificateAttribute(job->entry)) {
+                    // nullptr while the CSCA cache is invalidated — commit stage validates instead
+                    auto cscaSnapshot = sharedCscaProvider.snapshot();
+                    submitted = validationPool->submit([job, certAttr, cscaSnapshot, knownFingerprints]() {
+                        try {
+                            prepareCertificate(job->prepared, job->entry, certAttr,
+                                               cscaSnapshot, *knownFingerprints);
+                        } catch (...) {
+                            // Commit stage redoes the work and records any error in order
+                            job->prepared = PreparedCertificate{};
+                        }
+                        job->done.set_value();
+                    });
+                }
+                if (!submitted) {
+                    job->done.set_value();
+                }
+                inFlight.emplace_back(std::move(job), std::move(ready));
+            }
+
+            if (inFlight.empty()) break;
+
+            auto [job, ready] = std::move(inFlight.front());
+            inFlight.pop_front();
+            ready.wait();
+            commitEntry(job->entry, job->prepared);
+        }
     }
 
+    // Pre-scan may have over-counted (e.g. entries that fail to parse) — report what was processed
+    totalEntries = processedEntries;
+    counts.processedEntries = processedEntries;
+
     // End batch mode — final commit + release resources
+    flushStagedWrites();
     queryExecutor->endBatch();
 
     spdlog::info("LDIF processing completed: {} CSCA, {} DSC, {} DSC_NC, {} CRLs, {} MLs",
                 counts.cscaCount, counts.dscCount, counts.dscNcCount, counts.crlCount, counts.mlCount);
+    auto sigStats = icao::validation::SignatureVerificationCache::instance().stats();
+    spdlog::info("Signature verification cache: {} hits, {} misses, {} entries",
+                 sigStats.hits, sigStats.misses, sigStats.entries);
 
     // Send final progress with complete validation statistics
     enhancedStats.processedCount = counts.cscaCount + counts.dscCount + counts.dscNcCount;
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <functional>
 #include <ldap.h>
 #include "upload/common/ldif_types.h"
 #include "common/progress_manager.h"
@@ -50,6 +51,7 @@ public:
         int ldapCertStoredCount = 0;
         int ldapCrlStoredCount = 0;
         int ldapMlStoredCount = 0;
+        int processedEntries = 0;  // Entries actually read from the source
         std::set<std::string> newCscaCountries;  // Country codes with newly added CSCAs
     };
 
@@ -68,6 +70,36 @@ public:
         const TotalCounts* totalCounts = nullptr  // Optional: for "X/Total" progress display
     );
 
+    /**
+     * @brief Pull-based entry source: returns the next entry, or nullptr at end
+     *
+     * The returned pointer only needs to stay valid until the next call, so a
+     * streaming reader can hand out one materialized entry at a time.
+     */
+    using EntrySource = std::function<const LdifEntry*()>;
+
+    /**
+     * @brief Process entries as they arrive from a streaming source (v2.42.0)
+     *
+     * Same semantics as processEntries() (batch commits every 500 entries,
+     * SSE progress every 50). Certificate parsing and trust chain validation
+     * run on the validation pool when available (UPLOAD_VALIDATION_WORKERS);
+     * DB/LDAP writes stay on the calling thread in entry order, so results
+     * match sequential processing. At most a small window of entries is held
+     * in memory.
+     *
+     * @param totalEntries Expected entry count for progress (pre-scan or estimate)
+     */
+    static ProcessingCounts processEntryStream(
+        const std::string& uploadId,
+        const EntrySource& nextEntry,
+        int totalEntries,
+        LDAP* ld,
+        ValidationStats& stats,
+        common::ValidationStatistics& enhancedStats,
+        const TotalCounts* totalCounts = nullptr
+    );
+
     /**
      * @brief Upload certificates from DB to LDAP
      * @param uploadId Upload record UUID
@@ -22,6 +22,8 @@
 #include "query_helpers.h"
 #include "repositories/validation_repository.h"
 #include "i_query_executor.h"
+#include <icao/trust/trust_snapshot_notify.h>
+#include <icao/search/search_summary_notify.h>
 #include <drogon/HttpTypes.h>
 #include <json/json.h>
 #include <spdlog/spdlog.h>
@@ -73,6 +75,55 @@ void AutoProcessingStrategy::processLdifEntries(
     // Process all entries (save to DB, validate, upload to LDAP) with total counts for progress display
     auto counts = LdifProcessor::processEntries(uploadId, entries, ld, stats, enhancedStats, &totalCounts);
 
+    completeLdifProcessing(uploadId, counts, stats, enhancedStats, static_cast<int>(entries.size()));
+}
+
+void AutoProcessingStrategy::processLdifFile(
+    const std::string& uploadId,
+    LdifStreamReader& reader,
+    const LdifStreamReader::ScanSummary& summary,
+    LDAP* ld
+) {
+    if (!g_uploadServices) {
+        spdlog::error("ServiceContainer not initialized — cannot process LDIF entries");
+        throw std::runtime_error("ServiceContainer not initialized");
+    }
+
+    ValidationStats stats;  // Existing validation statistics (legacy)
+    common::ValidationStatistics enhancedStats{};  // Enhanced statistics with metadata tracking
+
+    // Totals from the reader's line-prefix pre-scan for "X/Total" progress display
+    LdifProcessor::TotalCounts totalCounts;
+    totalCounts.totalCerts = summary.totalCerts;
+    totalCounts.totalCrl = summary.totalCrl;
+    totalCounts.totalMl = summary.totalMl;
+    spdlog::info("AUTO mode: Streaming {} LDIF entries ({} bytes) for upload {} - {} certs, {} CRLs, {} MLs",
+                summary.totalEntries, reader.size(), uploadId,
+                totalCounts.totalCerts, totalCounts.totalCrl, totalCounts.totalMl);
+
+    // One entry materialized at a time; previous entry is released on each pull
+    LdifEntryView view;
+    LdifEntry current;
+    LdifProcessor::EntrySource source = [&reader, &view, &current]() -> const LdifEntry* {
+        if (!reader.next(view)) return nullptr;
+        current = view.toEntry();
+        return &current;
+    };
+
+    auto counts = LdifProcessor::processEntryStream(uploadId, source, summary.totalEntries,
+                                                    ld, stats, enhancedStats, &totalCounts);
+
+    // The pre-scan count is an estimate; record what the stream actually yielded
+    completeLdifProcessing(uploadId, counts, stats, enhancedStats, counts.processedEntries);
+}
+
+void AutoProcessingStrategy::completeLdifProcessing(
+    const std::string& uploadId,
+    LdifProcessor::ProcessingCounts& counts,
+    ValidationStats& stats,
+    common::ValidationStatistics& enhancedStats,
+    int totalEntries
+) {
     // If duplicates were skipped (resume mode), recalculate statistics from DB for accuracy.
     // The in-memory counts only reflect newly processed certificates, not previously processed ones.
     bool hasSkippedDuplicates = (enhancedStats.duplicateCount > 0);
@@ -161,7 +212,11 @@ void AutoProcessingStrategy::processLdifEntries(
     int totalItems = counts.cscaCount + counts.dscCount + counts.dscNcCount + counts.crlCount + counts.mlCount;
     common::updateUploadStatistics(uploadId, "COMPLETED",
                           counts.cscaCount, counts.dscCount, counts.dscNcCount, counts.crlCount,
-                          entries.size(), entries.size(), "");
+                          totalEntries, totalEntries, "");
+    if (counts.cscaCount > 0 || counts.crlCount > 0 || counts.mlCount > 0) {
+        icao::trust::notifyTrustSnapshotChanged("LDIF upload " + uploadId);
+    }
+    icao::search::notifySearchSummaryChanged("LDIF upload " + uploadId);
 
     // Update validation statistics via ValidationRepository
     if (g_uploadServices->validationRepository()) {
@@ -291,6 +346,10 @@ void AutoProcessingStrategy::processMasterListContent(
     // Update uploaded_file table with final statistics
     common::updateUploadStatistics(uploadId, "COMPLETED",
                           stats.cscaNewCount, 0, 0, 0, 0, 0, "");
+    if (stats.cscaNewCount > 0) {
+        icao::trust::notifyTrustSnapshotChanged("Master List upload " + uploadId);
+        icao::search::notifySearchSummaryChanged("Master List upload " + uploadId);
+    }
 
     // Update all statistics via repository
     if (g_uploadServices->uploadRepository()) {
@@ -18,6 +18,8 @@
 #include <memory>
 #include <ldap.h>
 #include "upload/common/ldif_types.h"
+#include "upload/common/ldif_stream_reader.h"
+#include "upload/ldif_processor.h"
 
 /**
  * @brief AUTO mode processing strategy
@@ -44,6 +46,24 @@ public:
         LDAP* ld
     );
 
+    /**
+     * @brief Stream LDIF entries from a reader (bounded memory, v2.42.0)
+     *
+     * Entries are parsed and processed one at a time; only the current entry
+     * is materialized.
+     *
+     * @param uploadId Upload record UUID
+     * @param reader Streaming reader over the uploaded temp file
+     * @param summary Totals from reader.preScan() (progress display)
+     * @param ld LDAP connection (can be nullptr for DB-only mode)
+     */
+    void processLdifFile(
+        const std::string& uploadId,
+        LdifStreamReader& reader,
+        const LdifStreamReader::ScanSummary& summary,
+        LDAP* ld
+    );
+
     /**
      * @brief Process Master List content (CMS parse → validate → save to DB + LDAP)
      * @param uploadId Upload record UUID
@@ -55,4 +75,17 @@ public:
         const std::vector<uint8_t>& content,
         LDAP* ld
     );
+
+private:
+    /**
+     * @brief Shared tail of LDIF processing: resume-mode recount, statistics,
+     *        PENDING DSC re-validation, completion progress
+     */
+    void completeLdifProcessing(
+        const std::string& uploadId,
+        LdifProcessor::ProcessingCounts& counts,
+        ValidationStats& stats,
+        common::ValidationStatistics& enhancedStats,
+        int totalEntries
+    );
 };
@@ -42,6 +42,61 @@ static std::string generateUuid() {
     return ss.str();
 }
 
+/**
+ * @brief Certificate INSERT used for staged bulk writes
+ *
+ * Same columns as the direct insert plus stored_in_ldap/ldap_dn ($30/$31),
+ * which are patched in the staged row once the LDAP write succeeded.
+ * The id ($1) is always generated client-side. Rows whose (certificate_type,
+ * fingerprint_sha256) another upload inserted since the fingerprint cache was
+ * loaded are skipped (ON CONFLICT DO NOTHING / MERGE) and reconciled by
+ * flushStaged().
+ */
+static std::string stagedCertificateInsertSql(const std::string& dbType) {
+    const std::string columns =
+        "id, upload_id, certificate_type, country_code, "
+        "subject_dn, issuer_dn, serial_number, fingerprint_sha256, "
+        "not_before, not_after, certificate_data, "
+        "validation_status, validation_message, "
+        "duplicate_count, first_upload_id, created_at, source_type, "
+        "version, signature_algorithm, signature_hash_algorithm, "
+        "public_key_algorithm, public_key_size, public_key_curve, "
+        "key_usage, extended_key_usage, "
+        "is_ca, path_len_constraint, "
+        "subject_key_identifier, authority_key_identifier, "
+        "crl_distribution_points, ocsp_responder_url, is_self_signed, "
+        "stored_in_ldap, ldap_dn";
+    if (dbType == "oracle") {
+        return
+            "MERGE INTO certificate c USING (SELECT $3 AS cert_type, $8 AS fp FROM DUAL) src "
+            "ON (c.certificate_type = src.cert_type AND c.fingerprint_sha256 = src.fp) "
+            "WHEN NOT MATCHED THEN INSERT (" + columns + ") VALUES ("
+            "$1, $2, $3, $4, $5, $6, $7, $8, "
+            "CASE WHEN $9 IS NULL OR $9 = '' THEN NULL ELSE TO_TIMESTAMP($9, 'YYYY-MM-DD HH24:MI:SS') END, "
+            "CASE WHEN $10 IS NULL OR $10 = '' THEN NULL ELSE TO_TIMESTAMP($10, 'YYYY-MM-DD HH24:MI:SS') END, "
+            "$11, $12, $13, 0, $2, SYSTIMESTAMP, $29, "
+            "TO_NUMBER(NULLIF($14, '')), $15, $16, "
+            "$17, TO_NUMBER(NULLIF($18, '')), $19, "
+            "$20, $21, "
+            "TO_NUMBER(NULLIF($22, '')), TO_NUMBER(NULLIF($23, '')), "
+            "$24, $25, "
+            "$26, $27, TO_NUMBER(NULLIF($28, '')), "
+            "TO_NUMBER(NULLIF($30, '')), $31"
+            ")";
+    }
+    return
+        "INSERT INTO certificate (" + columns + ") VALUES ("
+        "$1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, 0, $2, CURRENT_TIMESTAMP, $29, "
+        "$14, $15, $16, "
+        "$17, NULLIF($18, '')::INTEGER, $19, "
+        "$20, $21, "
+        "$22, NULLIF($23, '')::INTEGER, "
+        "$24, $25, "
+        "$26, $27, $28, "
+        "$30, NULLIF($31, '')"
+        ") ON CONFLICT (certificate_type, fingerprint_sha256) DO NOTHING";
+}
+
 /**
  * @brief Convert certificate date to Oracle-safe ISO 8601 format (no timezone suffix)
  *
@@ -588,45 +643,27 @@ std::vector<std::pair<std::string, std::vector<uint8_t>>> CertificateRepository:
     std::vector<std::pair<std::string, std::vector<uint8_t>>> result;
 
     try {
+        // Binary row cursor: DER bytes arrive as stored (no JSON rows, no hex round-trip)
         std::string query = "SELECT subject_dn, certificate_data FROM certificate "
                            "WHERE certificate_type = 'CSCA'";
 
-        Json::Value rows = queryExecutor_->executeQuery(query, {});
+        queryExecutor_->executeQueryRows(query, {}, [&](common::RowCursor& rows) {
+            int dnCol = rows.columnIndex("subject_dn");
+            int dataCol = rows.columnIndex("certificate_data");
 
-        // Helper: decode hex string (with \x prefix) to bytes
-        auto decodeHex = [](const std::string& hex, size_t start) -> std::vector<uint8_t> {
-            std::vector<uint8_t> bytes;
-            bytes.reserve((hex.size() - start) / 2);
-            for (size_t i = start; i + 1 < hex.size(); i += 2) {
-                char h[3] = {hex[i], hex[i + 1], 0};
-                bytes.push_back(static_cast<uint8_t>(strtol(h, nullptr, 16)));
-            }
-            return bytes;
-        };
-
-        for (Json::ArrayIndex i = 0; i < rows.size(); i++) {
-            std::string subjectDn = rows[i].get("subject_dn", "").asString();
-            std::string certDataHex = rows[i].get("certificate_data", "").asString();
+            while (rows.next()) {
+                std::string_view subjectDn = rows.getStringView(dnCol);
+                common::ByteSpan der = rows.getBytes(dataCol);
+                if (subjectDn.empty() || der.empty()) continue;
 
-            if (subjectDn.empty() || certDataHex.empty()) continue;
-
-            // Parse hex to DER bytes (same logic as parseCertificateDataFromHex)
-            std::vector<uint8_t> derBytes;
-            if (certDataHex.size() > 2 && certDataHex[0] == '\\' && certDataHex[1] == 'x') {
-                derBytes = decodeHex(certDataHex, 2);
                 // Handle double-encoded BYTEA
-                if (derBytes.size() > 2 && derBytes[0] == 0x5C && derBytes[1] == 0x78) {
-                    std::string innerHex(derBytes.begin(), derBytes.end());
-                    derBytes = decodeHex(innerHex, 2);
+                std::vector<uint8_t> derBytes = common::unwrapDoubleEncodedBytea(der);
+                if (derBytes.empty()) {
+                    derBytes.assign(der.begin(), der.end());
                 }
-            } else if (!certDataHex.empty() && static_cast<unsigned char>(certDataHex[0]) == 0x30) {
-                derBytes.assign(certDataHex.begin(), certDataHex.end());
-            }
-
-            if (!derBytes.empty()) {
-                result.emplace_back(subjectDn, std::move(derBytes));
+                result.emplace_back(std::string(subjectDn), std::move(derBytes));
             }
-        }
+        });
 
         spdlog::info("[CertificateRepository] Loaded {} CSCA certificates", result.size());
         return result;
@@ -1124,6 +1161,15 @@ bool CertificateRepository::updateCertificateLdapStatus(
     spdlog::debug("[CertificateRepository] Updating LDAP status: cert_id={}, ldap_dn={}",
                   certificateId.substr(0, 8) + "...", ldapDn.substr(0, 40) + "...");
 
+    // Certificate not written yet: record the status in its staged row
+    auto staged = stagedCertificateRows_.find(certificateId);
+    if (staged != stagedCertificateRows_.end() && stagedCertificates_) {
+        auto& row = stagedCertificates_->row(staged->second);
+        row[29] = common::db::boolLiteral(queryExecutor_->getDatabaseType(), true);  // $30
+        row[30] = ldapDn;                                                            // $31
+        return true;
+    }
+
     try {
         const char* query =
             "UPDATE certificate "
@@ -1237,8 +1283,31 @@ std::pair<std::string, bool> CertificateRepository::saveCertificateWithDuplicate
     const std::string& sourceType
 )
 {
-    spdlog::debug("[CertificateRepository] Saving certificate: type={}, country={}, fingerprint={}",
-                  certType, countryCode, fingerprint.substr(0, 16) + "...");
+    return insertCertificate(uploadId, certType, countryCode, subjectDn, issuerDn, serialNumber,
+                             fingerprint, notBefore, notAfter, certData, validationStatus,
+                             validationMessage, preExtractedMetadata, sourceType, false);
+}
+
+std::pair<std::string, bool> CertificateRepository::insertCertificate(
+    const std::string& uploadId,
+    const std::string& certType,
+    const std::string& countryCode,
+    const std::string& subjectDn,
+    const std::string& issuerDn,
+    const std::string& serialNumber,
+    const std::string& fingerprint,
+    const std::string& notBefore,
+    const std::string& notAfter,
+    const std::vector<uint8_t>& certData,
+    const std::string& validationStatus,
+    const std::string& validationMessage,
+    const x509::CertificateMetadata* preExtractedMetadata,
+    const std::string& sourceType,
+    bool staged
+)
+{
+    spdlog::debug("[CertificateRepository] {} certificate: type={}, country={}, fingerprint={}",
+                  staged ? "Staging" : "Saving", certType, countryCode, fingerprint.substr(0, 16) + "...");
 
     try {
         // Step 0: Check fingerprint cache (O(1) hash lookup, skips X.509 parsing entirely)
@@ -1367,11 +1436,69 @@ std::pair<std::string, bool> CertificateRepository::saveCertificateWithDuplicate
         }
         std::string certDataHex = hexStream.str();
 
+        // Oracle parameter order ($1 = id); PostgreSQL direct insert drops $1 and uses RETURNING id
+        // Oracle TIMESTAMP columns need ISO dates without timezone suffix
+        std::string notBeforeParam = notBefore;
+        std::string notAfterParam = notAfter;
+        if (dbType == "oracle") {
+            notBeforeParam = convertDateToIso(notBefore);
+            notAfterParam = convertDateToIso(notAfter);
+            spdlog::debug("[CertificateRepository] Oracle date conversion: '{}' → '{}', '{}' → '{}'",
+                notBefore, notBeforeParam, notAfter, notAfterParam);
+        }
+
+        std::vector<std::string> insertParams = {
+            "",                                      // $1 (id, filled below)
+            uploadId,                                // $2
+            certType,                                // $3
+            countryCode,                             // $4
+            subjectDn,                               // $5
+            issuerDn,                                // $6
+            serialNumber,                            // $7
+            fingerprint,                             // $8
+            notBeforeParam,                          // $9
+            notAfterParam,                           // $10
+            certDataHex,                             // $11
+            validationStatus,                        // $12
+            validationMessage,                       // $13
+            versionStr,                              // $14
+            sigAlg.empty() ? "" : sigAlg,            // $15
+            sigHashAlg.empty() ? "" : sigHashAlg,    // $16
+            pubKeyAlg.empty() ? "" : pubKeyAlg,      // $17
+            pubKeySizeStr == "0" ? "" : pubKeySizeStr, // $18
+            pubKeyCurve,                             // $19
+            keyUsageStr,                             // $20
+            extKeyUsageStr,                          // $21
+            isCaStr,                                 // $22
+            pathLenStr,                              // $23
+            ski,                                     // $24
+            aki,                                     // $25
+            crlDpStr,                                // $26
+            ocspUrl,                                 // $27
+            isSelfSignedStr,                         // $28
+            sourceType                               // $29
+        };
+
         std::string newId;
 
-        if (dbType == "oracle") {
+        if (staged) {
+            // Generate UUID in C++ so dependent rows (validation_result, LDAP status)
+            // can reference the certificate before it is written
+            newId = generateUuid();
+            insertParams[0] = newId;
+            insertParams.push_back(common::db::boolLiteral(dbType, false));  // $30 stored_in_ldap
+            insertParams.push_back("");                                     // $31 ldap_dn
+
+            if (!stagedCertificates_) {
+                stagedCertificates_ = std::make_unique<common::BulkWriter>(
+                    queryExecutor_, stagedCertificateInsertSql(dbType));
+            }
+            stagedCertificateRows_[newId] = stagedCertificates_->add(std::move(insertParams));
+
+        } else if (dbType == "oracle") {
             // Oracle: Generate UUID in C++ (uuid_generate_v4 is PostgreSQL-only)
             newId = generateUuid();
+            insertParams[0] = newId;
 
             std::string insertQuery =
                 "INSERT INTO certificate ("
@@ -1399,44 +1526,6 @@ std::pair<std::string, bool> CertificateRepository::saveCertificateWithDuplicate
                 "$26, $27, TO_NUMBER(NULLIF($28, ''))"
                 ")";
 
-            // Convert OpenSSL date format to ISO for Oracle TIMESTAMP columns
-            std::string notBeforeIso = convertDateToIso(notBefore);
-            std::string notAfterIso = convertDateToIso(notAfter);
-            spdlog::debug("[CertificateRepository] Oracle date conversion: '{}' → '{}', '{}' → '{}'",
-                notBefore, notBeforeIso, notAfter, notAfterIso);
-
-            std::vector<std::string> insertParams = {
-                newId,                                   // $1 (pre-generated id)
-                uploadId,                                // $2
-                certType,                                // $3
-                countryCode,                             // $4
-                subjectDn,                               // $5
-                issuerDn,                                // $6
-                serialNumber,                            // $7
-                fingerprint,                             // $8
-                notBeforeIso,                            // $9  (ISO format for Oracle)
-                notAfterIso,                             // $10 (ISO format for Oracle)
-                certDataHex,                             // $11
-                validationStatus,                        // $12
-                validationMessage,                       // $13
-                versionStr,                              // $14
-                sigAlg.empty() ? "" : sigAlg,            // $15
-                sigHashAlg.empty() ? "" : sigHashAlg,    // $16
-                pubKeyAlg.empty() ? "" : pubKeyAlg,      // $17
-                pubKeySizeStr == "0" ? "" : pubKeySizeStr, // $18
-                pubKeyCurve,                             // $19
-                keyUsageStr,                             // $20
-                extKeyUsageStr,                          // $21
-                isCaStr,                                 // $22
-                pathLenStr,                              // $23
-                ski,                                     // $24
-                aki,                                     // $25
-                crlDpStr,                                // $26
-                ocspUrl,                                 // $27
-                isSelfSignedStr,                         // $28
-                sourceType                               // $29
-            };
-
             queryExecutor_->executeCommand(insertQuery, insertParams);
 
         } else {
@@ -1464,36 +1553,7 @@ std::pair<std::string, bool> CertificateRepository::saveCertificateWithDuplicate
                 "$25, $26, $27"
                 ") RETURNING id";
 
-            std::vector<std::string> insertParams = {
-                uploadId,                                // $1
-                certType,                                // $2
-                countryCode,                             // $3
-                subjectDn,                               // $4
-                issuerDn,                                // $5
-                serialNumber,                            // $6
-                fingerprint,                             // $7
-                notBefore,                               // $8
-                notAfter,                                // $9
-                certDataHex,                             // $10
-                validationStatus,                        // $11
-                validationMessage,                       // $12
-                versionStr,                              // $13
-                sigAlg.empty() ? "" : sigAlg,            // $14
-                sigHashAlg.empty() ? "" : sigHashAlg,    // $15
-                pubKeyAlg.empty() ? "" : pubKeyAlg,      // $16
-                pubKeySizeStr == "0" ? "" : pubKeySizeStr, // $17
-                pubKeyCurve,                             // $18
-                keyUsageStr,                             // $19
-                extKeyUsageStr,                          // $20
-                isCaStr,                                 // $21
-                pathLenStr,                              // $22
-                ski,                                     // $23
-                aki,                                     // $24
-                crlDpStr,                                // $25
-                ocspUrl,                                 // $26
-                isSelfSignedStr,                         // $27
-                sourceType                               // $28
-            };
+            insertParams.erase(insertParams.begin());
 
             Json::Value insertResult = queryExecutor_->executeQuery(insertQuery, insertParams);
 
@@ -1544,6 +1604,177 @@ std::pair<std::string, bool> CertificateRepository::saveCertificateWithDuplicate
     }
 }
 
+std::pair<std::string, bool> CertificateRepository::stageCertificateWithDuplicateCheck(
+    const std::string& uploadId,
+    const std::string& certType,
+    const std::string& countryCode,
+    const std::string& subjectDn,
+    const std::string& issuerDn,
+    const std::string& serialNumber,
+    const std::string& fingerprint,
+    const std::string& notBefore,
+    const std::string& notAfter,
+    const std::vector<uint8_t>& certData,
+    const std::string& validationStatus,
+    const std::string& validationMessage,
+    const x509::CertificateMetadata* preExtractedMetadata,
+    const std::string& sourceType
+)
+{
+    return insertCertificate(uploadId, certType, countryCode, subjectDn, issuerDn, serialNumber,
+                             fingerprint, notBefore, notAfter, certData, validationStatus,
+                             validationMessage, preExtractedMetadata, sourceType, true);
+}
+
+void CertificateRepository::stageCertificateDuplicate(
+    const std::string& certificateId,
+    const std::string& uploadId,
+    const std::string& sourceType,
+    const std::string& sourceCountry,
+    const std::string& sourceEntryDn,
+    const std::string& sourceFileName
+)
+{
+    if (!stagedDuplicates_) {
+        // Oracle drops ON CONFLICT; MERGE keeps uq_cert_dup_source from rejecting the batch
+        std::string query = queryExecutor_->getDatabaseType() == "oracle"
+            ? "MERGE INTO certificate_duplicates d USING ("
+              "SELECT $1 AS cert_id, $2 AS upl_id, $3 AS src_type FROM DUAL) src "
+              "ON (d.certificate_id = src.cert_id AND d.upload_id = src.upl_id AND d.source_type = src.src_type) "
+              "WHEN NOT MATCHED THEN INSERT ("
+              "certificate_id, upload_id, source_type, source_country, "
+              "source_entry_dn, source_file_name, detected_at"
+              ") VALUES ("
+              "$1, $2, $3, $4, $5, $6, SYSTIMESTAMP)"
+            : "INSERT INTO certificate_duplicates ("
+              "certificate_id, upload_id, source_type, source_country, "
+              "source_entry_dn, source_file_name, detected_at"
+              ") VALUES ("
+              "$1, $2, $3, $4, $5, $6, CURRENT_TIMESTAMP"
+              ") ON CONFLICT (certificate_id, upload_id, source_type) DO NOTHING";
+        stagedDuplicates_ = std::make_unique<common::BulkWriter>(queryExecutor_, std::move(query));
+    }
+    stagedDuplicates_->add({certificateId, uploadId, sourceType,
+                            sourceCountry, sourceEntryDn, sourceFileName});
+}
+
+size_t CertificateRepository::flushStaged(CertificateIdRemap* reassigned) {
+    size_t written = 0;
+    // Certificates first: duplicate rows may reference certificates staged in this batch
+    if (stagedCertificates_ && stagedCertificates_->pending() > 0) {
+        size_t pending = stagedCertificates_->pending();
+        // Keys only (not the DER): enough to reconcile rows the insert skips
+        std::vector<StagedCertificateKey> staged;
+        staged.reserve(pending);
+        for (size_t i = 0; i < pending; ++i) {
+            const auto& params = stagedCertificates_->row(i);
+            staged.push_back({params[0], params[1], params[2], params[3], params[7], params[28]});
+        }
+
+        written = stagedCertificates_->flush();
+        spdlog::debug("[CertificateRepository] Flushed {}/{} staged certificates", written, pending);
+        if (written < pending) {
+            reconcileSkippedCertificates(staged, reassigned);
+        }
+    }
+    stagedCertificateRows_.clear();
+
+    if (stagedDuplicates_) {
+        stagedDuplicates_->flush();
+    }
+    return written;
+}
+
+void CertificateRepository::reconcileSkippedCertificates(
+    const std::vector<StagedCertificateKey>& staged,
+    CertificateIdRemap* reassigned)
+{
+    std::unordered_map<std::string, std::string> existingIds;  // type + fingerprint → id
+    size_t first = 0;
+    try {
+        for (size_t count : common::db::bucketedChunkSizes(staged.size(), kReconcileChunk)) {
+            std::vector<std::string> params;
+            params.reserve(count);
+            std::string query =
+                "SELECT id, certificate_type, fingerprint_sha256 FROM certificate WHERE fingerprint_sha256 IN (";
+            for (size_t i = first; i < first + count; ++i) {
+                params.push_back(staged[i].fingerprint);
+                query += (i > first ? ", $" : "$") + std::to_string(params.size());
+            }
+            Json::Value rows = queryExecutor_->executeQuery(query + ")", params);
+            for (const auto& row : rows) {
+                existingIds[row["certificate_type"].asString() + "|" + row["fingerprint_sha256"].asString()] =
+                    row["id"].asString();
+            }
+            first += count;
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("[CertificateRepository] Reconciling skipped certificates failed: {}", e.what());
+        return;
+    }
+
+    CertificateIdRemap remap;
+    for (const auto& key : staged) {
+        auto it = existingIds.find(key.certType + "|" + key.fingerprint);
+        // Not found: the row was rejected (already logged by BulkWriter)
+        if (it == existingIds.end() || it->second == key.id) continue;
+
+        const std::string& existingId = it->second;
+        spdlog::debug("[CertificateRepository] Concurrent duplicate detected: type={}, fingerprint={}",
+                     key.certType, key.fingerprint.substr(0, 16) + "...");
+        remap[key.id] = existingId;
+        auto cached = fingerprintCache_.find(key.fingerprint);
+        if (cached != fingerprintCache_.end()) {
+            cached->second.id = existingId;
+        }
+        stageCertificateDuplicate(existingId, key.uploadId, key.sourceType, key.countryCode);
+    }
+    if (remap.empty()) return;
+
+    // Duplicate rows staged against the skipped ids now point at the existing rows
+    for (size_t i = 0; stagedDuplicates_ && i < stagedDuplicates_->pending(); ++i) {
+        auto& row = stagedDuplicates_->row(i);
+        auto it = remap.find(row[0]);
+        if (it != remap.end()) row[0] = it->second;
+    }
+    spdlog::info("[CertificateRepository] {} staged certificates already existed; recorded as duplicates",
+                 remap.size());
+    if (reassigned) reassigned->insert(remap.begin(), remap.end());
+}
+
+size_t CertificateRepository::stagedCount() const {
+    return (stagedCertificates_ ? stagedCertificates_->pending() : 0) +
+           (stagedDuplicates_ ? stagedDuplicates_->pending() : 0);
+}
+
+CertificateRepository::StageMark CertificateRepository::stageMark() const {
+    StageMark mark;
+    mark.certificates = stagedCertificates_ ? stagedCertificates_->pending() : 0;
+    mark.duplicates = stagedDuplicates_ ? stagedDuplicates_->pending() : 0;
+    return mark;
+}
+
+void CertificateRepository::rollbackStaged(const StageMark& mark) {
+    if (stagedCertificates_ && stagedCertificates_->pending() > mark.certificates) {
+        for (auto it = stagedCertificateRows_.begin(); it != stagedCertificateRows_.end(); ) {
+            if (it->second < mark.certificates) {
+                ++it;
+                continue;
+            }
+            const std::string& fingerprint = stagedCertificates_->row(it->second)[7];  // $8
+            auto cached = fingerprintCache_.find(fingerprint);
+            if (cached != fingerprintCache_.end() && cached->second.id == it->first) {
+                fingerprintCache_.erase(cached);
+            }
+            it = stagedCertificateRows_.erase(it);
+        }
+        stagedCertificates_->truncate(mark.certificates);
+    }
+    if (stagedDuplicates_) {
+        stagedDuplicates_->truncate(mark.duplicates);
+    }
+}
+
 // --- LDAP Status Count by Upload ID ---
 
 void CertificateRepository::countLdapStatusByUploadId(const std::string& uploadId, int& outTotal, int& outInLdap) {
@@ -1648,7 +1879,7 @@ Json::Value CertificateRepository::findLinkCertificateById(const std::string& id
 
 // --- Bulk Export (All LDAP-stored certificates) ---
 
-Json::Value CertificateRepository::findAllForExport() {
+size_t CertificateRepository::findAllForExport(const std::function<void(const CertificateExportRow&)>& onRow) {
     std::string dbType = queryExecutor_->getDatabaseType();
     std::string storedFlag = common::db::boolLiteral(dbType, true);
 
@@ -1658,7 +1889,34 @@ Json::Value CertificateRepository::findAllForExport() {
         "FROM certificate WHERE stored_in_ldap = " + storedFlag + " "
         "ORDER BY country_code, certificate_type";
 
-    return queryExecutor_->executeQuery(query);
+    size_t count = 0;
+    queryExecutor_->executeQueryRows(query, {}, [&](common::RowCursor& rows) {
+        int typeCol = rows.columnIndex("certificate_type");
+        int countryCol = rows.columnIndex("country_code");
+        int subjectCol = rows.columnIndex("subject_dn");
+        int fingerprintCol = rows.columnIndex("fingerprint_sha256");
+        int dataCol = rows.columnIndex("certificate_data");
+        int selfSignedCol = rows.columnIndex("is_self_signed");
+
+        while (rows.next()) {
+            CertificateExportRow row;
+            row.certificateType = rows.getStringView(typeCol);
+            row.countryCode = rows.getStringView(countryCol);
+            row.subjectDn = rows.getStringView(subjectCol);
+            row.fingerprint = rows.getStringView(fingerprintCol);
+            row.isSelfSigned = rows.getBool(selfSignedCol, true);
+
+            row.certificateDer = rows.getBytes(dataCol);
+            std::vector<uint8_t> unwrapped = common::unwrapDoubleEncodedBytea(row.certificateDer);
+            if (!unwrapped.empty()) {
+                row.certificateDer = common::ByteSpan{unwrapped.data(), unwrapped.size()};
+            }
+
+            onRow(row);
+            count++;
+        }
+    });
+    return count;
 }
 
 // --- Fingerprint Pre-Cache (v2.26.0) ---
@@ -1716,4 +1974,14 @@ std::optional<CachedFingerprintInfo> CertificateRepository::getCachedFingerprint
     return std::nullopt;
 }
 
+std::unordered_set<std::string> CertificateRepository::cachedFingerprints() const {
+    std::unordered_set<std::string> result;
+    if (!fingerprintCacheLoaded_) return result;
+    result.reserve(fingerprintCache_.size());
+    for (const auto& [fingerprint, info] : fingerprintCache_) {
+        result.insert(fingerprint);
+    }
+    return result;
+}
+
 } // namespace repositories
@@ -5,8 +5,13 @@
 #include <set>
 #include <optional>
 #include <unordered_map>
+#include <functional>
+#include <string_view>
+#include <unordered_set>
+#include <memory>
 #include <json/json.h>
 #include "i_query_executor.h"
+#include "bulk_writer.h"
 #include <openssl/x509.h>
 #include "upload/common/x509_metadata_extractor.h"
 
@@ -31,6 +36,20 @@ struct CachedFingerprintInfo {
     std::string firstUploadId;
 };
 
+/**
+ * @brief Certificate row streamed by CertificateRepository::findAllForExport()
+ *
+ * Views point into the query result and are only valid inside the callback.
+ */
+struct CertificateExportRow {
+    std::string_view certificateType;
+    std::string_view countryCode;
+    std::string_view subjectDn;
+    std::string_view fingerprint;
+    common::ByteSpan certificateDer;  ///< Raw DER (double-encoded bytea already unwrapped)
+    bool isSelfSigned = true;
+};
+
 /**
  * @brief Certificate Search Filter
  */
@@ -357,15 +376,103 @@ public:
     Json::Value getDistinctCountries();
 
     /**
-     * @brief Find all certificates stored in LDAP for bulk export
+     * @brief Stream all certificates stored in LDAP for bulk export
+     *
+     * Rows are read through the binary row cursor and handed to onRow one at a
+     * time, so the full certificate set is never held as JSON/hex in memory.
+     *
+     * @param onRow Called for each certificate with stored_in_ldap = TRUE
+     * @return Number of rows visited
+     * @throws std::runtime_error on query failure
+     */
+    size_t findAllForExport(const std::function<void(const CertificateExportRow&)>& onRow);
+
+    /// @}
+
+    /// @name Staged Bulk Writes
+    /// Bulk pipelines (LDIF) stage certificate and duplicate rows instead of
+    /// writing them per entry; staged rows are sent as one multi-row INSERT /
+    /// OCI array execute by flushStaged() at the pipeline's batch boundary.
+    /// @{
+
+    /**
+     * @brief Stage a certificate insert (same contract as saveCertificateWithDuplicateCheck)
+     *
+     * Duplicates are detected exactly like the direct path. New certificates get
+     * a client-generated UUID, are added to the fingerprint cache and written on
+     * the next flushStaged(). Until then updateCertificateLdapStatus() patches
+     * the staged row instead of issuing an UPDATE.
+     *
+     * @note Staged certificates are not visible to SELECTs before the flush; use
+     *       the direct path for anything read back during processing (CSCAs)
+     */
+    std::pair<std::string, bool> stageCertificateWithDuplicateCheck(
+        const std::string& uploadId,
+        const std::string& certType,
+        const std::string& countryCode,
+        const std::string& subjectDn,
+        const std::string& issuerDn,
+        const std::string& serialNumber,
+        const std::string& fingerprint,
+        const std::string& notBefore,
+        const std::string& notAfter,
+        const std::vector<uint8_t>& certData,
+        const std::string& validationStatus = "UNKNOWN",
+        const std::string& validationMessage = "",
+        const x509::CertificateMetadata* preExtractedMetadata = nullptr,
+        const std::string& sourceType = "FILE_UPLOAD"
+    );
+
+    /**
+     * @brief Stage a certificate_duplicates row (same contract as trackCertificateDuplicate)
+     */
+    void stageCertificateDuplicate(
+        const std::string& certificateId,
+        const std::string& uploadId,
+        const std::string& sourceType,
+        const std::string& sourceCountry = "",
+        const std::string& sourceEntryDn = "",
+        const std::string& sourceFileName = ""
+    );
+
+    /// Staged certificate id → id of the existing row it turned out to duplicate
+    using CertificateIdRemap = std::unordered_map<std::string, std::string>;
+
+    /**
+     * @brief Write staged certificates, then staged duplicate rows
+     *
+     * Certificates another upload inserted after the fingerprint cache was
+     * loaded are skipped by the insert and handled like the direct path's
+     * unique violation: the existing id is looked up, a certificate_duplicates
+     * row is recorded and staged duplicate rows are re-pointed to it.
      *
-     * Returns certificate_type, country_code, subject_dn, serial_number,
-     * fingerprint_sha256, and certificate_data (hex-encoded) for all
-     * certificates with stored_in_ldap = TRUE.
+     * Must run inside the caller's batch transaction (between beginBatch and
+     * endBatch) and outside any per-entry savepoint scope.
+     *
+     * @param reassigned If set, receives the skipped ids so the caller can
+     *        re-point its own staged child rows (ValidationRepository::flushStaged)
+     * @return Number of certificate rows written
+     */
+    size_t flushStaged(CertificateIdRemap* reassigned = nullptr);
+
+    /// Number of staged rows not yet written
+    size_t stagedCount() const;
+
+    /// Staged row counts, taken before a unit of work that may be rolled back
+    struct StageMark {
+        size_t certificates = 0;
+        size_t duplicates = 0;
+    };
+    StageMark stageMark() const;
+
+    /**
+     * @brief Drop rows staged after mark (the entry was rolled back to its savepoint)
      *
-     * @return JSON array of certificate rows
+     * Certificates staged since the mark are also removed from the fingerprint
+     * cache, so a later entry with the same certificate is inserted, not
+     * treated as a duplicate of a row that was never written.
      */
-    Json::Value findAllForExport();
+    void rollbackStaged(const StageMark& mark);
 
     /// @}
 
@@ -439,6 +546,17 @@ public:
      */
     std::optional<CachedFingerprintInfo> getCachedFingerprintInfo(const std::string& fingerprint) const;
 
+    /**
+     * @brief Copy of the cached fingerprint keys
+     *
+     * The live cache is mutated as certificates are inserted, so it must not be
+     * read from other threads. LDIF validation workers use this copy to skip
+     * trust chain work for certificates that already existed before processing.
+     *
+     * @return Fingerprints in cache (empty if cache not loaded)
+     */
+    std::unordered_set<std::string> cachedFingerprints() const;
+
     /// @}
 
 private:
@@ -448,6 +566,36 @@ private:
     std::unordered_map<std::string, CachedFingerprintInfo> fingerprintCache_;
     bool fingerprintCacheLoaded_ = false;
 
+    // Staged bulk writes (created on first use)
+    std::unique_ptr<common::BulkWriter> stagedCertificates_;
+    std::unique_ptr<common::BulkWriter> stagedDuplicates_;
+    std::unordered_map<std::string, size_t> stagedCertificateRows_;  // certificate id → staged row
+
+    /// Fingerprints per lookup when reconciling skipped staged certificates
+    static constexpr size_t kReconcileChunk = 500;
+
+    /// Staged certificate columns needed to reconcile a skipped insert
+    struct StagedCertificateKey {
+        std::string id;
+        std::string uploadId;
+        std::string certType;
+        std::string countryCode;
+        std::string fingerprint;
+        std::string sourceType;
+    };
+
+    /// Map staged rows the insert skipped to the existing certificates (see flushStaged)
+    void reconcileSkippedCertificates(const std::vector<StagedCertificateKey>& staged,
+                                      CertificateIdRemap* reassigned);
+
+    std::pair<std::string, bool> insertCertificate(
+        const std::string& uploadId, const std::string& certType, const std::string& countryCode,
+        const std::string& subjectDn, const std::string& issuerDn, const std::string& serialNumber,
+        const std::string& fingerprint, const std::string& notBefore, const std::string& notAfter,
+        const std::vector<uint8_t>& certData, const std::string& validationStatus,
+        const std::string& validationMessage, const x509::CertificateMetadata* preExtractedMetadata,
+        const std::string& sourceType, bool staged);
+
     // DN normalization helpers (for CSCA lookup)
     std::string extractDnAttribute(const std::string& dn, const std::string& attr);
     std::string normalizeDnForComparison(const std::string& dn);
@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <functional>
+#include <string_view>
 #include <json/json.h>
 #include "i_query_executor.h"
 
@@ -17,6 +19,18 @@
 
 namespace repositories {
 
+/**
+ * @brief CRL row streamed by CrlRepository::findAllForExport()
+ *
+ * Views point into the query result and are only valid inside the callback.
+ */
+struct CrlExportRow {
+    std::string_view countryCode;
+    std::string_view issuerDn;
+    std::string_view fingerprint;
+    common::ByteSpan crlDer;  ///< Raw DER (double-encoded bytea already unwrapped)
+};
+
 class CrlRepository {
 public:
     explicit CrlRepository(common::IQueryExecutor* queryExecutor);
@@ -57,10 +71,12 @@ public:
     Json::Value findByCountryCode(const std::string& countryCode);
 
     /**
-     * @brief Find all CRLs stored in LDAP for bulk export
-     * @return JSON array with country_code, issuer_dn, crl_binary (hex), fingerprint_sha256
+     * @brief Stream all CRLs stored in LDAP for bulk export (binary row cursor)
+     * @param onRow Called for each CRL with stored_in_ldap = TRUE
+     * @return Number of rows visited
+     * @throws std::runtime_error on query failure
      */
-    Json::Value findAllForExport();
+    size_t findAllForExport(const std::function<void(const CrlExportRow&)>& onRow);
 
     /**
      * @brief Find all CRLs with metadata (paginated, filtered)
@@ -74,163 +74,209 @@ bool ValidationRepository::save(const domain::models::ValidationResult& result)
                   result.uploadId.substr(0, 8));
 
     try {
-        std::string dbType = queryExecutor_->getDatabaseType();
+        std::vector<std::string> params;
+        std::string query = buildInsert(result, params);
+        queryExecutor_->executeCommand(query, params);
+        spdlog::debug("[ValidationRepository] Validation result saved successfully");
+        return true;
 
-        // Database-aware boolean formatting
-        auto boolStr = [&dbType](bool val) -> std::string {
-            return common::db::boolLiteral(dbType, val);
-        };
+    } catch (const std::exception& e) {
+        spdlog::error("[ValidationRepository] Exception in save: {}", e.what());
+        return false;
+    }
+}
 
-        // Prepare boolean strings
-        std::string trustChainValidStr = boolStr(result.trustChainValid);
-        std::string signatureVerifiedStr = boolStr(result.signatureVerified);
-        std::string isExpiredStr = boolStr(result.isExpired);
-        std::string cscaFoundStr = boolStr(result.cscaFound);
-        std::string crlCheckedStr = boolStr(result.crlCheckStatus != "NOT_CHECKED");
-        std::string crlRevokedStr = boolStr(result.crlCheckStatus == "REVOKED");
-
-        // Prepare trust_chain_path as JSON
-        std::string trustChainPathJson;
-        if (result.trustChainPath.empty()) {
-            trustChainPathJson = "[]";
-        } else {
-            Json::Value pathArray(Json::arrayValue);
-            pathArray.append(result.trustChainPath);
-            Json::StreamWriterBuilder builder;
-            builder["indentation"] = "";
-            trustChainPathJson = Json::writeString(builder, pathArray);
-        }
+void ValidationRepository::stage(const domain::models::ValidationResult& result)
+{
+    std::vector<std::string> params;
+    std::string query = buildInsert(result, params);
+    if (!stagedResults_) {
+        stagedResults_ = std::make_unique<common::BulkWriter>(queryExecutor_, std::move(query));
+    }
+    stagedResults_->add(std::move(params));
+}
 
-        // Use fingerprint as the identifier
-        std::string fingerprintValue = result.fingerprint;
-        if (fingerprintValue.empty()) {
-            fingerprintValue = result.certificateId;
+size_t ValidationRepository::flushStaged(const std::unordered_map<std::string, std::string>& certificateIds)
+{
+    if (!stagedResults_ || stagedResults_->pending() == 0) return 0;
+    size_t pending = stagedResults_->pending();
+
+    // PostgreSQL rows reference the certificate UUID ($2 in buildInsert); Oracle rows
+    // key on the fingerprint, which the existing certificate shares
+    if (!certificateIds.empty() && queryExecutor_->getDatabaseType() != "oracle") {
+        for (size_t i = 0; i < pending; ++i) {
+            auto& params = stagedResults_->row(i);
+            auto it = certificateIds.find(params[1]);
+            if (it != certificateIds.end()) params[1] = it->second;
         }
+    }
+    size_t written = stagedResults_->flush();
+    spdlog::debug("[ValidationRepository] Flushed {}/{} staged validation results", written, pending);
+    return written;
+}
 
-        // Database-specific INSERT query
-        std::string query;
-        std::vector<std::string> params;
-
-        if (dbType == "oracle") {
-            // Oracle schema: NOT NULL columns: id, certificate_type, subject_dn, issuer_dn, validation_status
-            std::string validityPeriodValidStr = boolStr(!result.isExpired);
-            std::string revocationStatus = result.crlCheckStatus;
-            std::string id = generateUuid();
+size_t ValidationRepository::stagedCount() const
+{
+    return stagedResults_ ? stagedResults_->pending() : 0;
+}
 
-            // Oracle: Use MERGE to handle duplicate (certificate_id, upload_id) gracefully
-            query =
-                "MERGE INTO validation_result vr USING (SELECT $3 AS cert_id, $2 AS upl_id FROM DUAL) src "
-                "ON (vr.certificate_id = src.cert_id AND vr.upload_id = src.upl_id) "
-                "WHEN NOT MATCHED THEN INSERT ("
-                "id, upload_id, certificate_id, certificate_type, country_code, "
-                "subject_dn, issuer_dn, serial_number, "
-                "trust_chain_valid, trust_chain_message, csca_subject_dn, csca_found, "
-                "signature_valid, signature_algorithm, "
-                "validity_period_valid, not_before, not_after, "
-                "crl_checked, revocation_status, "
-                "validation_status, "
-                "icao_compliant, icao_compliance_level, icao_violations, "
-                "icao_key_usage_compliant, icao_algorithm_compliant, "
-                "icao_key_size_compliant, icao_validity_period_compliant, "
-                "icao_extensions_compliant"
-                ") VALUES ("
-                "$1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, $20, "
-                "$21, $22, $23, $24, $25, $26, $27, $28"
-                ")";
-
-            params = {
-                id,
-                result.uploadId,
-                fingerprintValue,
-                result.certificateType,
-                result.countryCode,
-                result.subjectDn.empty() ? "N/A" : result.subjectDn,
-                result.issuerDn.empty() ? "N/A" : result.issuerDn,
-                result.serialNumber,
-                trustChainValidStr,
-                result.trustChainPath.empty() ? "" : result.trustChainPath,
-                result.cscaSubjectDn.empty() ? "" : result.cscaSubjectDn,
-                cscaFoundStr,
-                signatureVerifiedStr,
-                result.signatureAlgorithm,
-                validityPeriodValidStr,
-                result.notBefore,
-                result.notAfter,
-                crlCheckedStr,
-                revocationStatus,
-                result.validationStatus,
-                boolStr(result.icaoCompliant),
-                result.icaoComplianceLevel,
-                result.icaoViolations,
-                boolStr(result.icaoKeyUsageCompliant),
-                boolStr(result.icaoAlgorithmCompliant),
-                boolStr(result.icaoKeySizeCompliant),
-                boolStr(result.icaoValidityPeriodCompliant),
-                boolStr(result.icaoExtensionsCompliant)
-            };
-        } else {
-            // PostgreSQL schema: column names must match actual table definition
-            // certificate_id is UUID FK → use result.certificateId (not fingerprint)
-            std::string validityPeriodValidStr = boolStr(!result.isExpired);
-            std::string revocationStatus = result.crlCheckStatus;
+void ValidationRepository::rollbackStaged(size_t count)
+{
+    if (stagedResults_) stagedResults_->truncate(count);
+}
 
-            query =
-                "INSERT INTO validation_result ("
-                "upload_id, certificate_id, certificate_type, country_code, "
-                "subject_dn, issuer_dn, serial_number, "
-                "trust_chain_valid, trust_chain_message, csca_subject_dn, csca_found, "
-                "signature_valid, signature_algorithm, "
-                "validity_period_valid, not_before, not_after, "
-                "crl_checked, revocation_status, "
-                "validation_status, "
-                "icao_compliant, icao_compliance_level, icao_violations, "
-                "icao_key_usage_compliant, icao_algorithm_compliant, "
-                "icao_key_size_compliant, icao_validity_period_compliant, "
-                "icao_extensions_compliant"
-                ") VALUES ("
-                "$1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, "
-                "$20, $21, $22, $23, $24, $25, $26, $27"
-                ") ON CONFLICT (certificate_id, upload_id) DO NOTHING";
-
-            params = {
-                result.uploadId,                                          // $1
-                result.certificateId,                                     // $2 (UUID FK)
-                result.certificateType,                                   // $3
-                result.countryCode,                                       // $4
-                result.subjectDn.empty() ? "N/A" : result.subjectDn,     // $5 (NOT NULL)
-                result.issuerDn.empty() ? "N/A" : result.issuerDn,       // $6 (NOT NULL)
-                result.serialNumber,                                      // $7
-                trustChainValidStr,                                       // $8
-                result.trustChainMessage.empty() ? "" : result.trustChainMessage, // $9
-                result.cscaSubjectDn.empty() ? "" : result.cscaSubjectDn, // $10
-                cscaFoundStr,                                             // $11
-                signatureVerifiedStr,                                     // $12
-                result.signatureAlgorithm,                                // $13
-                validityPeriodValidStr,                                   // $14
-                result.notBefore,                                         // $15
-                result.notAfter,                                          // $16
-                crlCheckedStr,                                            // $17
-                revocationStatus,                                         // $18
-                result.validationStatus,                                  // $19
-                boolStr(result.icaoCompliant),                            // $20
-                result.icaoComplianceLevel,                               // $21
-                result.icaoViolations,                                    // $22
-                boolStr(result.icaoKeyUsageCompliant),                    // $23
-                boolStr(result.icaoAlgorithmCompliant),                   // $24
-                boolStr(result.icaoKeySizeCompliant),                     // $25
-                boolStr(result.icaoValidityPeriodCompliant),              // $26
-                boolStr(result.icaoExtensionsCompliant)                   // $27
-            };
-        }
+std::string ValidationRepository::buildInsert(const domain::models::ValidationResult& result,
+                                              std::vector<std::string>& params) const
+{
+    std::string dbType = queryExecutor_->getDatabaseType();
+
+    // Database-aware boolean formatting
+    auto boolStr = [&dbType](bool val) -> std::string {
+        return common::db::boolLiteral(dbType, val);
+    };
+
+    // Prepare boolean strings
+    std::string trustChainValidStr = boolStr(result.trustChainValid);
+    std::string signatureVerifiedStr = boolStr(result.signatureVerified);
+    std::string isExpiredStr = boolStr(result.isExpired);
+    std::string cscaFoundStr = boolStr(result.cscaFound);
+    std::string crlCheckedStr = boolStr(result.crlCheckStatus != "NOT_CHECKED");
+    std::string crlRevokedStr = boolStr(result.crlCheckStatus == "REVOKED");
+
+    // Prepare trust_chain_path as JSON
+    std::string trustChainPathJson;
+    if (result.trustChainPath.empty()) {
+        trustChainPathJson = "[]";
+    } else {
+        Json::Value pathArray(Json::arrayValue);
+        pathArray.append(result.trustChainPath);
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "";
+        trustChainPathJson = Json::writeString(builder, pathArray);
+    }
 
-        queryExecutor_->executeCommand(query, params);
-        spdlog::debug("[ValidationRepository] Validation result saved successfully");
-        return true;
+    // Use fingerprint as the identifier
+    std::string fingerprintValue = result.fingerprint;
+    if (fingerprintValue.empty()) {
+        fingerprintValue = result.certificateId;
+    }
 
-    } catch (const std::exception& e) {
-        spdlog::error("[ValidationRepository] Exception in save: {}", e.what());
-        return false;
+    // Database-specific INSERT query
+    std::string query;
+
+    if (dbType == "oracle") {
+        // Oracle schema: NOT NULL columns: id, certificate_type, subject_dn, issuer_dn, validation_status
+        std::string validityPeriodValidStr = boolStr(!result.isExpired);
+        std::string revocationStatus = result.crlCheckStatus;
+        std::string id = generateUuid();
+
+        // Oracle: Use MERGE to handle duplicate (certificate_id, upload_id) gracefully
+        query =
+            "MERGE INTO validation_result vr USING (SELECT $3 AS cert_id, $2 AS upl_id FROM DUAL) src "
+            "ON (vr.certificate_id = src.cert_id AND vr.upload_id = src.upl_id) "
+            "WHEN NOT MATCHED THEN INSERT ("
+            "id, upload_id, certificate_id, certificate_type, country_code, "
+            "subject_dn, issuer_dn, serial_number, "
+            "trust_chain_valid, trust_chain_message, csca_subject_dn, csca_found, "
+            "signature_valid, signature_algorithm, "
+            "validity_period_valid, not_before, not_after, "
+            "crl_checked, revocation_status, "
+            "validation_status, "
+            "icao_compliant, icao_compliance_level, icao_violations, "
+            "icao_key_usage_compliant, icao_algorithm_compliant, "
+            "icao_key_size_compliant, icao_validity_period_compliant, "
+            "icao_extensions_compliant"
+            ") VALUES ("
+            "$1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, $20, "
+            "$21, $22, $23, $24, $25, $26, $27, $28"
+            ")";
+
+        params = {
+            id,
+            result.uploadId,
+            fingerprintValue,
+            result.certificateType,
+            result.countryCode,
+            result.subjectDn.empty() ? "N/A" : result.subjectDn,
+            result.issuerDn.empty() ? "N/A" : result.issuerDn,
+            result.serialNumber,
+            trustChainValidStr,
+            result.trustChainPath.empty() ? "" : result.trustChainPath,
+            result.cscaSubjectDn.empty() ? "" : result.cscaSubjectDn,
+            cscaFoundStr,
+            signatureVerifiedStr,
+            result.signatureAlgorithm,
+            validityPeriodValidStr,
+            result.notBefore,
+            result.notAfter,
+            crlCheckedStr,
+            revocationStatus,
+            result.validationStatus,
+            boolStr(result.icaoCompliant),
+            result.icaoComplianceLevel,
+            result.icaoViolations,
+            boolStr(result.icaoKeyUsageCompliant),
+            boolStr(result.icaoAlgorithmCompliant),
+            boolStr(result.icaoKeySizeCompliant),
+            boolStr(result.icaoValidityPeriodCompliant),
+            boolStr(result.icaoExtensionsCompliant)
+        };
+    } else {
+        // PostgreSQL schema: column names must match actual table definition
+        // certificate_id is UUID FK → use result.certificateId (not fingerprint)
+        std::string validityPeriodValidStr = boolStr(!result.isExpired);
+        std::string revocationStatus = result.crlCheckStatus;
+
+        query =
+            "INSERT INTO validation_result ("
+            "upload_id, certificate_id, certificate_type, country_code, "
+            "subject_dn, issuer_dn, serial_number, "
+            "trust_chain_valid, trust_chain_message, csca_subject_dn, csca_found, "
+            "signature_valid, signature_algorithm, "
+            "validity_period_valid, not_before, not_after, "
+            "crl_checked, revocation_status, "
+            "validation_status, "
+            "icao_compliant, icao_compliance_level, icao_violations, "
+            "icao_key_usage_compliant, icao_algorithm_compliant, "
+            "icao_key_size_compliant, icao_validity_period_compliant, "
+            "icao_extensions_compliant"
+            ") VALUES ("
+            "$1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, "
+            "$20, $21, $22, $23, $24, $25, $26, $27"
+            ") ON CONFLICT (certificate_id, upload_id) DO NOTHING";
+
+        params = {
+            result.uploadId,                                          // $1
+            result.certificateId,                                     // $2 (UUID FK)
+            result.certificateType,                                   // $3
+            result.countryCode,                                       // $4
+            result.subjectDn.empty() ? "N/A" : result.subjectDn,     // $5 (NOT NULL)
+            result.issuerDn.empty() ? "N/A" : result.issuerDn,       // $6 (NOT NULL)
+            result.serialNumber,                                      // $7
+            trustChainValidStr,                                       // $8
+            result.trustChainMessage.empty() ? "" : result.trustChainMessage, // $9
+            result.cscaSubjectDn.empty() ? "" : result.cscaSubjectDn, // $10
+            cscaFoundStr,                                             // $11
+            signatureVerifiedStr,                                     // $12
+            result.signatureAlgorithm,                                // $13
+            validityPeriodValidStr,                                   // $14
+            result.notBefore,                                         // $15
+            result.notAfter,                                          // $16
+            crlCheckedStr,                                            // $17
+            revocationStatus,                                         // $18
+            result.validationStatus,                                  // $19
+            boolStr(result.icaoCompliant),                            // $20
+            result.icaoComplianceLevel,                               // $21
+            result.icaoViolations,                                    // $22
+            boolStr(result.icaoKeyUsageCompliant),                    // $23
+            boolStr(result.icaoAlgorithmCompliant),                   // $24
+            boolStr(result.icaoKeySizeCompliant),                     // $25
+            boolStr(result.icaoValidityPeriodCompliant),              // $26
+            boolStr(result.icaoExtensionsCompliant)                   // $27
+        };
     }
+
+    return query;
 }
 
 bool ValidationRepository::copyForUpload(const std::string& fingerprint, const std::string& newUploadId)
@@ -3,8 +3,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <json/json.h>
 #include "i_query_executor.h"
+#include "bulk_writer.h"
 #include "upload/domain/models/validation_result.h"
 #include "upload/domain/models/validation_statistics.h"
 #include <ldap_connection_pool.h>
@@ -44,6 +46,32 @@ public:
      */
     bool save(const domain::models::ValidationResult& result);
 
+    /**
+     * @brief Stage a validation result for the next flushStaged()
+     *
+     * Used by bulk pipelines (LDIF) so results are written as one multi-row
+     * INSERT / OCI array execute per batch instead of one statement each.
+     */
+    void stage(const domain::models::ValidationResult& result);
+
+    /**
+     * @brief Write staged validation results
+     *
+     * Run after CertificateRepository::flushStaged() (rows reference staged
+     * certificates), inside the batch transaction.
+     *
+     * @param certificateIds Staged certificate ids the certificate flush mapped
+     *        to existing rows; results staged for them are re-pointed first
+     * @return Number of rows written
+     */
+    size_t flushStaged(const std::unordered_map<std::string, std::string>& certificateIds = {});
+
+    /// Number of staged results not yet written
+    size_t stagedCount() const;
+
+    /// Drop results staged after the first count (entry rolled back to its savepoint)
+    void rollbackStaged(size_t count);
+
     /**
      * @brief Update validation statistics for an upload
      * @param uploadId Upload UUID
@@ -165,6 +193,16 @@ private:
     common::IQueryExecutor* queryExecutor_;  // Query executor (non-owning)
     std::shared_ptr<common::LdapConnectionPool> ldapPool_;  // LDAP pool for conformance lookup
     std::string ldapBaseDn_;  // LDAP base DN
+    std::unique_ptr<common::BulkWriter> stagedResults_;  // Staged bulk writes (created on first use)
+
+    /**
+     * @brief Build the database-specific INSERT for a validation result
+     * @param result Validation result
+     * @param params Bind parameters (output)
+     * @return SQL text (identical for every result of the same database type)
+     */
+    std::string buildInsert(const domain::models::ValidationResult& result,
+                            std::vector<std::string>& params) const;
 
     /**
      * @brief Enrich DSC_NC result with conformance data from LDAP
@@ -26,6 +26,7 @@
 #include "der_parser.h"
 #include "cert_type_detector.h"
 #include <icao/x509/certificate_parser.h>
+#include <icao/validation/crl_cache.h>
 #include <dl_parser.h>
 
 // Doc 9303 compliance checklist
@@ -1161,6 +1162,8 @@ void UploadService::processCrlFile(CertificateUploadResult& result,
 
     if (!crlId.empty()) {
         result.crlCount++;
+        // New CRL for this country — drop the parsed copy so checks see it
+        icao::validation::CrlCache::instance().invalidate(countryCode);
 
         // Save revoked certificates
         STACK_OF(X509_REVOKED)* revokedStack = X509_CRL_get_REVOKED(crl);
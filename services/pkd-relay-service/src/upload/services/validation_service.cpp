@@ -8,6 +8,7 @@
 #include "validation_service.h"
 #include "upload/common/openssl_raii.h"
 #include <icao/validation/cert_ops.h>
+#include <icao/validation/signature_cache.h>
 #include <icao/validation/types.h>
 #include <spdlog/spdlog.h>
 #include <chrono>
@@ -44,7 +45,8 @@ ValidationService::ValidationService(
 
     if (crlRepo_) {
         crlProvider_ = std::make_unique<adapters::DbCrlProvider>(crlRepo_);
-        crlChecker_ = std::make_unique<icao::validation::CrlChecker>(crlProvider_.get());
+        crlChecker_ = std::make_unique<icao::validation::CrlChecker>(
+            crlProvider_.get(), &icao::validation::CrlCache::instance());
     }
 
     // Initialize LDAP-based validation components (for real-time PA Lookup)
@@ -148,6 +150,9 @@ ValidationService::RevalidateResult ValidationService::revalidateDscCertificates
 
         spdlog::info("Re-validation complete: processed={}, valid={}, invalid={}, pending={}, error={}",
             result.totalProcessed, result.validCount, result.invalidCount, result.pendingCount, result.errorCount);
+        auto sigStats = icao::validation::SignatureVerificationCache::instance().stats();
+        spdlog::info("Signature verification cache: hits={}, misses={}, entries={}",
+            sigStats.hits, sigStats.misses, sigStats.entries);
 
     } catch (const std::exception& e) {
         spdlog::error("ValidationService::revalidateDscCertificates failed: {}", e.what());
@@ -263,6 +268,9 @@ ValidationService::RevalidateResult ValidationService::revalidatePendingDscForCo
 
         spdlog::info("PENDING DSC re-validation complete: processed={}, valid={}, invalid={}, pending={}, error={}",
             result.totalProcessed, result.validCount, result.invalidCount, result.pendingCount, result.errorCount);
+        auto sigStats = icao::validation::SignatureVerificationCache::instance().stats();
+        spdlog::info("Signature verification cache: hits={}, misses={}, entries={}",
+            sigStats.hits, sigStats.misses, sigStats.entries);
 
     } catch (const std::exception& e) {
         spdlog::error("revalidatePendingDscForCountries failed: {}", e.what());
@@ -3,7 +3,7 @@
  * @brief UploadServiceContainer implementation
  */
 #include "upload/upload_services.h"
-#include "upload/common/thread_pool.h"
+#include "thread_pool.h"
 
 #include "i_query_executor.h"
 #include <ldap_connection_pool.h>
@@ -49,6 +49,8 @@ struct UploadServiceContainer::Impl {
 
     // Thread pool for async upload processing
     std::unique_ptr<common::ThreadPool> threadPool;
+    // Worker pool for parallel certificate validation within one LDIF upload
+    std::unique_ptr<common::ThreadPool> validationPool;
 
     // Handler references (created in main.cpp, just stored here)
     handlers::UploadHandler* uploadHandler = nullptr;
@@ -105,15 +107,28 @@ bool UploadServiceContainer::initialize(common::IQueryExecutor* queryExecutor,
     }
     impl_->threadPool = std::make_unique<common::ThreadPool>(poolSize);
 
+    // Validation workers: parse + trust chain verification fan-out for LDIF uploads.
+    // Kept separate from threadPool — upload tasks block waiting on these workers.
+    int validationWorkers = static_cast<int>(std::thread::hardware_concurrency());
+    if (auto* v = std::getenv("UPLOAD_VALIDATION_WORKERS")) {
+        try { validationWorkers = std::stoi(v); } catch (...) {}
+    }
+    validationWorkers = std::max(0, std::min(32, validationWorkers));
+    if (validationWorkers > 0) {
+        impl_->validationPool = std::make_unique<common::ThreadPool>(validationWorkers);
+    }
+
     // LdapStorageService needs config — will be initialized separately if needed
 
-    spdlog::info("UploadServiceContainer initialized (repos: 6, services: 3, threadPool: {})", poolSize);
+    spdlog::info("UploadServiceContainer initialized (repos: 6, services: 3, threadPool: {}, validationWorkers: {})",
+                 poolSize, validationWorkers);
     return true;
 }
 
 void UploadServiceContainer::shutdown() {
     if (!impl_) return;
     if (impl_->threadPool) impl_->threadPool->shutdown();
+    if (impl_->validationPool) impl_->validationPool->shutdown();
     impl_->ldapStorageService.reset();
     impl_->ldifStructureService.reset();
     impl_->validationService.reset();
@@ -147,6 +162,7 @@ handlers::UploadHandler* UploadServiceContainer::uploadHandler() const { return
 handlers::UploadStatsHandler* UploadServiceContainer::uploadStatsHandler() const { return impl_->uploadStatsHandler; }
 
 common::ThreadPool* UploadServiceContainer::threadPool() const { return impl_->threadPool.get(); }
+common::ThreadPool* UploadServiceContainer::validationPool() const { return impl_->validationPool.get(); }
 
 void UploadServiceContainer::setUploadHandler(handlers::UploadHandler* handler) { impl_->uploadHandler = handler; }
 void UploadServiceContainer::setLdapStorageService(std::shared_ptr<services::LdapStorageService> svc) { impl_->ldapStorageService = std::move(svc); }
@@ -102,6 +102,12 @@ public:
     // --- Thread Pool ---
     common::ThreadPool* threadPool() const;
 
+    /**
+     * @brief Worker pool for the CPU-bound LDIF validation stage
+     * @return nullptr when disabled (UPLOAD_VALIDATION_WORKERS=0) — sequential processing
+     */
+    common::ThreadPool* validationPool() const;
+
     // --- Post-init setters (called after handlers are created in main.cpp) ---
     void setUploadHandler(handlers::UploadHandler* handler);
     void setLdapStorageService(std::shared_ptr<services::LdapStorageService> svc);
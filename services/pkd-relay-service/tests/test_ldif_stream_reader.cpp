@@ -0,0 +1,224 @@
+/**
+ * @file test_ldif_stream_reader.cpp
+ * @brief Unit tests for LdifStreamReader (ldif_stream_reader.h)
+ *
+ * LdifStreamReader must produce exactly the entries LdifProcessor::parseLdifContent()
+ * produced before uploads were streamed. No DB, no LDAP, no OpenSSL.
+ *
+ * Tested:
+ *   - Plain and base64 ("::" → ";binary") attributes
+ *   - Continuation line unfolding
+ *   - Comment lines, "version: 1" header, entries without DN
+ *   - CRLF line endings and missing trailing newline
+ *   - preScan() totals and rewind()
+ *   - File-backed (mmap) mode, including missing file
+ *
+ * Framework: Google Test (GTest)
+ */
+
+#include <gtest/gtest.h>
+#include "upload/common/ldif_stream_reader.h"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+std::vector<LdifEntry> readAll(LdifStreamReader& reader) {
+    std::vector<LdifEntry> entries;
+    LdifEntryView view;
+    while (reader.next(view)) {
+        entries.push_back(view.toEntry());
+    }
+    return entries;
+}
+
+const char* kSampleLdif =
+    "version: 1\n"
+    "\n"
+    "# CSCA entry\n"
+    "dn: cn=abc,o=csca,c=KR,dc=data\n"
+    "objectClass: inetOrgPerson\n"
+    "objectClass: pkdDownload\n"
+    "userCertificate;binary:: MIIBAA==\n"
+    "\n"
+    "dn: cn=crl,o=crl,c=KR,dc=data\n"
+    "certificateRevocationList:: MIIC\n"
+    " REVD\n"
+    " RUY=\n"
+    "\n"
+    "dn: cn=ml,o=ml,c=DE,dc=data\n"
+    "pkdMasterListContent:: MIIM\n"
+    "\n";
+
+} // anonymous namespace
+
+// ---------------------------------------------------------------------------
+// Parsing
+// ---------------------------------------------------------------------------
+
+TEST(LdifStreamReaderTest, ParsesEntriesAndSkipsVersionHeader) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].dn, "cn=abc,o=csca,c=KR,dc=data");
+    EXPECT_EQ(entries[1].dn, "cn=crl,o=crl,c=KR,dc=data");
+    EXPECT_EQ(entries[2].dn, "cn=ml,o=ml,c=DE,dc=data");
+}
+
+TEST(LdifStreamReaderTest, MultiValuedAttributesKeepOrder) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_FALSE(entries.empty());
+    const auto& oc = entries[0].attributes.at("objectClass");
+    ASSERT_EQ(oc.size(), 2u);
+    EXPECT_EQ(oc[0], "inetOrgPerson");
+    EXPECT_EQ(oc[1], "pkdDownload");
+}
+
+TEST(LdifStreamReaderTest, Base64ValuesStoredUnderBinaryName) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_EQ(entries.size(), 3u);
+    // Explicit ";binary" is not doubled
+    EXPECT_EQ(entries[0].getFirstAttribute("userCertificate;binary"), "MIIBAA==");
+    EXPECT_FALSE(entries[0].hasAttribute("userCertificate;binary;binary"));
+    // "::" without ";binary" gets the suffix
+    EXPECT_TRUE(entries[2].hasAttribute("pkdMasterListContent;binary"));
+    EXPECT_FALSE(entries[2].hasAttribute("pkdMasterListContent"));
+}
+
+TEST(LdifStreamReaderTest, UnfoldsContinuationLines) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[1].getFirstAttribute("certificateRevocationList;binary"), "MIICREVDRUY=");
+}
+
+TEST(LdifStreamReaderTest, FoldedDnIsUnfolded) {
+    std::string content =
+        "dn: cn=very-long-name,o=dsc,\n"
+        " c=FR,dc=data\n"
+        "cn: x\n";
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].dn, "cn=very-long-name,o=dsc,c=FR,dc=data");
+    // Same as parseLdifContent(): the "dn" attribute holds the first line only
+    EXPECT_EQ(entries[0].getFirstAttribute("dn"), "cn=very-long-name,o=dsc,");
+}
+
+TEST(LdifStreamReaderTest, HandlesCrlfAndMissingTrailingNewline) {
+    std::string content =
+        "dn: cn=a,dc=data\r\n"
+        "cn: a\r\n"
+        "\r\n"
+        "dn: cn=b,dc=data\r\n"
+        "cn: b";
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0].dn, "cn=a,dc=data");
+    EXPECT_EQ(entries[0].getFirstAttribute("cn"), "a");
+    EXPECT_EQ(entries[1].getFirstAttribute("cn"), "b");
+}
+
+TEST(LdifStreamReaderTest, DropsEntriesWithoutDn) {
+    std::string content =
+        "cn: orphan\n"
+        "\n"
+        "dn: cn=a,dc=data\n"
+        "\n"
+        "\n";
+    LdifStreamReader reader{std::string_view(content)};
+    auto entries = readAll(reader);
+
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].dn, "cn=a,dc=data");
+    EXPECT_FALSE(entries[0].hasAttribute("cn"));
+}
+
+TEST(LdifStreamReaderTest, EmptyInputYieldsNothing) {
+    LdifStreamReader reader{std::string_view()};
+    LdifEntryView view;
+    EXPECT_FALSE(reader.next(view));
+    EXPECT_EQ(reader.preScan().totalEntries, 0);
+}
+
+// ---------------------------------------------------------------------------
+// preScan / rewind
+// ---------------------------------------------------------------------------
+
+TEST(LdifStreamReaderTest, PreScanCountsByType) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    auto summary = reader.preScan();
+
+    EXPECT_EQ(summary.totalEntries, 3);
+    EXPECT_EQ(summary.totalCerts, 1);
+    EXPECT_EQ(summary.totalCrl, 1);
+    EXPECT_EQ(summary.totalMl, 1);
+}
+
+TEST(LdifStreamReaderTest, PreScanDoesNotMoveCursor) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    reader.preScan();
+
+    EXPECT_EQ(reader.position(), 0u);
+    EXPECT_EQ(readAll(reader).size(), 3u);
+}
+
+TEST(LdifStreamReaderTest, RewindRestartsIteration) {
+    std::string content = kSampleLdif;
+    LdifStreamReader reader{std::string_view(content)};
+    EXPECT_EQ(readAll(reader).size(), 3u);
+
+    reader.rewind();
+    auto again = readAll(reader);
+    ASSERT_EQ(again.size(), 3u);
+    EXPECT_EQ(again[0].dn, "cn=abc,o=csca,c=KR,dc=data");
+}
+
+// ---------------------------------------------------------------------------
+// File-backed mode
+// ---------------------------------------------------------------------------
+
+TEST(LdifStreamReaderTest, ReadsMappedFile) {
+    char path[] = "/tmp/ldif_stream_reader_XXXXXX";
+    int fd = ::mkstemp(path);
+    ASSERT_GE(fd, 0);
+    ::close(fd);
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << kSampleLdif;
+    }
+
+    {
+        LdifStreamReader reader{std::string(path)};
+        EXPECT_EQ(reader.size(), std::string(kSampleLdif).size());
+        EXPECT_EQ(reader.preScan().totalEntries, 3);
+        auto entries = readAll(reader);
+        ASSERT_EQ(entries.size(), 3u);
+        EXPECT_EQ(entries[1].getFirstAttribute("certificateRevocationList;binary"), "MIICREVDRUY=");
+    }
+    std::remove(path);
+}
+
+TEST(LdifStreamReaderTest, MissingFileThrows) {
+    EXPECT_THROW(LdifStreamReader{std::string("/nonexistent/upload.ldif")}, std::runtime_error);
+}
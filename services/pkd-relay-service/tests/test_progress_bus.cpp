@@ -0,0 +1,433 @@
+/**
+ * @file test_progress_bus.cpp
+ * @brief Unit tests for ProgressBus (progress_bus.h)
+ *
+ * Sinks are in-memory frame recorders; the background flusher is disabled
+ * and flush() is called explicitly. No Drogon, no DB.
+ *
+ * Tested:
+ *   - Snapshot on subscribe, deltas afterwards, one serialization per frame
+ *   - Several subscribers per topic
+ *   - Coalescing of publishes between flushes, urgent publishes
+ *   - Delta format (nested objects, removed keys, appended log windows)
+ *   - Slow subscriber resync, sink failure, unsubscribe, removeTopic
+ *   - progress-end on removeTopic, empty topic cleanup, heartbeats
+ *   - Holding frames while the connection backlog is over the limit
+ *
+ * Framework: Google Test (GTest)
+ */
+
+#include <gtest/gtest.h>
+#include "upload/common/progress_bus.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using common::ProgressBus;
+
+namespace {
+
+ProgressBus::Config manualConfig(size_t maxQueuedFrames = 16) {
+    ProgressBus::Config config;
+    config.startFlusher = false;
+    config.maxQueuedFrames = maxQueuedFrames;
+    return config;
+}
+
+struct Recorder {
+    std::vector<std::string> frames;
+    bool accept = true;
+
+    ProgressBus::Sink sink() {
+        return [this](const std::string& frame) {
+            if (!accept) return false;
+            frames.push_back(frame);
+            return true;
+        };
+    }
+};
+
+Json::Value progress(int processed, const std::string& stage = "VALIDATION_IN_PROGRESS") {
+    Json::Value v;
+    v["stage"] = stage;
+    v["processedCount"] = processed;
+    v["statistics"]["validCount"] = processed;
+    return v;
+}
+
+ProgressBus::Renderer render(Json::Value value) {
+    return [value]() { return value; };
+}
+
+Json::Value payload(const std::string& frame) {
+    auto pos = frame.find("data: ");
+    Json::Value v;
+    Json::CharReaderBuilder builder;
+    std::string errors;
+    std::string body = frame.substr(pos + 6);
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+    reader->parse(body.data(), body.data() + body.size(), &v, &errors);
+    return v;
+}
+
+bool isSnapshot(const std::string& frame) { return frame.rfind("event: progress\n", 0) == 0; }
+bool isDelta(const std::string& frame) { return frame.rfind("event: progress-delta\n", 0) == 0; }
+
+} // anonymous namespace
+
+// =============================================================================
+// Snapshot / delta
+// =============================================================================
+
+TEST(ProgressBus, Subscribe_SendsSnapshotOfCurrentState) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(5)));
+
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+    ASSERT_EQ(r.frames.size(), 1u);
+    EXPECT_TRUE(isSnapshot(r.frames[0]));
+    EXPECT_EQ(payload(r.frames[0])["processedCount"].asInt(), 5);
+}
+
+TEST(ProgressBus, Subscribe_BeforeFirstPublish_GetsSnapshotOnFlush) {
+    ProgressBus bus(manualConfig());
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+    EXPECT_TRUE(r.frames.empty());
+
+    bus.publish("u1", render(progress(1)));
+    bus.flush();
+    ASSERT_EQ(r.frames.size(), 1u);
+    EXPECT_TRUE(isSnapshot(r.frames[0]));
+}
+
+TEST(ProgressBus, Flush_SendsOnlyChangedFields) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(1)));
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+
+    bus.publish("u1", render(progress(2)));
+    bus.flush();
+    ASSERT_EQ(r.frames.size(), 2u);
+    ASSERT_TRUE(isDelta(r.frames[1]));
+    auto delta = payload(r.frames[1]);
+    EXPECT_FALSE(delta.isMember("stage"));
+    EXPECT_EQ(delta["processedCount"].asInt(), 2);
+    EXPECT_EQ(delta["statistics"]["validCount"].asInt(), 2);
+}
+
+TEST(ProgressBus, Flush_UnchangedState_NoFrame) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(1)));
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+
+    bus.publish("u1", render(progress(1)));
+    bus.flush();
+    EXPECT_EQ(r.frames.size(), 1u);
+}
+
+// =============================================================================
+// Fan-out and coalescing
+// =============================================================================
+
+TEST(ProgressBus, MultipleSubscribers_ShareOneSerializedFrame) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(1)));
+    Recorder a, b, c;
+    bus.subscribe("u1", a.sink());
+    bus.subscribe("u1", b.sink());
+    bus.subscribe("u1", c.sink());
+
+    bus.publish("u1", render(progress(2)));
+    bus.flush();
+    for (auto* r : {&a, &b, &c}) {
+        ASSERT_EQ(r->frames.size(), 2u);
+        EXPECT_EQ(r->frames[1], a.frames[1]);
+    }
+    auto stats = bus.stats();
+    EXPECT_EQ(stats.subscribers, 3u);
+    EXPECT_EQ(stats.snapshotFrames, 1u);
+    EXPECT_EQ(stats.deltaFrames, 1u);
+    EXPECT_EQ(stats.framesSent, 6u);
+}
+
+TEST(ProgressBus, Publish_CoalescedUntilFlush) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(0)));
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+
+    int renders = 0;
+    for (int i = 1; i <= 100; ++i) {
+        bus.publish("u1", [i, &renders]() { ++renders; return progress(i); });
+    }
+    bus.flush();
+    EXPECT_EQ(renders, 1);
+    ASSERT_EQ(r.frames.size(), 2u);
+    EXPECT_EQ(payload(r.frames[1])["processedCount"].asInt(), 100);
+    EXPECT_EQ(bus.stats().published, 101u);
+}
+
+TEST(ProgressBus, Publish_UrgentDeliversImmediately) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(1)));
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+
+    bus.publish("u1", render(progress(1, "COMPLETED")), true);
+    ASSERT_EQ(r.frames.size(), 2u);
+    EXPECT_EQ(payload(r.frames[1])["stage"].asString(), "COMPLETED");
+}
+
+TEST(ProgressBus, Publish_NoSubscribers_NotRendered) {
+    ProgressBus bus(manualConfig());
+    int renders = 0;
+    bus.publish("u1", [&renders]() { ++renders; return progress(1); });
+    bus.flush();
+    EXPECT_EQ(renders, 0);
+}
+
+// =============================================================================
+// Delta format
+// =============================================================================
+
+TEST(ProgressBus, Diff_RemovedKeyIsNull) {
+    Json::Value before = progress(1);
+    before["currentCertificate"]["subjectDn"] = "CN=DS,C=KR";
+    Json::Value after = progress(1);
+
+    auto delta = ProgressBus::diff(before, after);
+    ASSERT_TRUE(delta.isMember("currentCertificate"));
+    EXPECT_TRUE(delta["currentCertificate"].isNull());
+    EXPECT_EQ(delta.size(), 1u);
+}
+
+TEST(ProgressBus, Diff_AppendedLogEntries) {
+    Json::Value before, after;
+    before["logs"] = Json::arrayValue;
+    for (int i = 0; i < 3; ++i) before["logs"].append(i);
+    after["logs"] = before["logs"];
+    after["logs"].append(3);
+    after["logs"].append(4);
+
+    auto delta = ProgressBus::diff(before, after)["logs"];
+    ASSERT_TRUE(delta.isMember("$append"));
+    EXPECT_EQ(delta["$append"].size(), 2u);
+    EXPECT_EQ(delta["$append"][0].asInt(), 3);
+    EXPECT_EQ(delta["$size"].asUInt(), 5u);
+}
+
+TEST(ProgressBus, Diff_SlidingWindow) {
+    Json::Value before, after;
+    before["logs"] = Json::arrayValue;
+    after["logs"] = Json::arrayValue;
+    for (int i = 0; i < 5; ++i) before["logs"].append(i);   // 0..4
+    for (int i = 2; i < 7; ++i) after["logs"].append(i);    // 2..6
+
+    auto delta = ProgressBus::diff(before, after)["logs"];
+    ASSERT_TRUE(delta.isMember("$append"));
+    EXPECT_EQ(delta["$append"].size(), 2u);
+    EXPECT_EQ(delta["$size"].asUInt(), 5u);
+}
+
+TEST(ProgressBus, Diff_RewrittenArraySentWhole) {
+    Json::Value before, after;
+    before["logs"] = Json::arrayValue;
+    after["logs"] = Json::arrayValue;
+    before["logs"].append(1); before["logs"].append(2);
+    after["logs"].append(3); after["logs"].append(2); after["logs"].append(5);
+
+    auto delta = ProgressBus::diff(before, after)["logs"];
+    EXPECT_TRUE(delta.isArray());
+    EXPECT_EQ(delta, after["logs"]);
+}
+
+// =============================================================================
+// Backpressure and lifecycle
+// =============================================================================
+
+TEST(ProgressBus, SlowSubscriber_ResyncsWithSnapshot) {
+    ProgressBus bus(manualConfig(2));
+    bus.publish("u1", render(progress(0)));
+
+    // The sink re-enters the bus while delivering, so frames queue up behind it
+    Recorder r;
+    bool reentered = false;
+    bus.subscribe("u1", [&](const std::string& frame) {
+        r.frames.push_back(frame);
+        if (!reentered) {
+            reentered = true;
+            for (int i = 1; i <= 5; ++i) bus.publish("u1", render(progress(i)), true);
+        }
+        return true;
+    });
+
+    auto stats = bus.stats();
+    EXPECT_GT(stats.resyncs, 0u);
+    EXPECT_GT(stats.framesDropped, 0u);
+    ASSERT_GE(r.frames.size(), 2u);
+    EXPECT_TRUE(isSnapshot(r.frames.back()));
+    EXPECT_EQ(payload(r.frames.back())["processedCount"].asInt(), 5);
+}
+
+TEST(ProgressBus, SinkFailure_Unsubscribes) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(0)));
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+    r.accept = false;
+
+    bus.publish("u1", render(progress(1)), true);
+    EXPECT_EQ(bus.stats().subscribers, 0u);
+}
+
+TEST(ProgressBus, Unsubscribe_StopsDelivery) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(0)));
+    Recorder a, b;
+    auto id = bus.subscribe("u1", a.sink());
+    bus.subscribe("u1", b.sink());
+    bus.unsubscribe("u1", id);
+
+    bus.publish("u1", render(progress(1)), true);
+    EXPECT_EQ(a.frames.size(), 1u);
+    EXPECT_EQ(b.frames.size(), 2u);
+}
+
+TEST(ProgressBus, RemoveTopic_DropsStateAndSubscribers) {
+    ProgressBus bus(manualConfig());
+    bus.publish("u1", render(progress(0)));
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+    Json::Value end;
+    end["status"] = "COMPLETED";
+    bus.removeTopic("u1", end);
+
+    auto stats = bus.stats();
+    EXPECT_EQ(stats.topics, 0u);
+    EXPECT_EQ(stats.subscribers, 0u);
+    ASSERT_EQ(r.frames.size(), 2u);
+    EXPECT_TRUE(ProgressBus::isEndFrame(r.frames[1]));
+    EXPECT_EQ(payload(r.frames[1])["status"].asString(), "COMPLETED");
+
+    Recorder late;
+    auto id = bus.subscribe("u1", late.sink());
+    EXPECT_TRUE(late.frames.empty());
+    bus.unsubscribe("u1", id);
+    EXPECT_EQ(bus.stats().topics, 0u);
+}
+
+TEST(ProgressBus, UnsubscribeLast_DropsEmptyTopic) {
+    ProgressBus bus(manualConfig());
+    Recorder a, b;
+    auto ida = bus.subscribe("u1", a.sink());
+    auto idb = bus.subscribe("u1", b.sink());
+    EXPECT_EQ(bus.stats().topics, 1u);
+
+    bus.unsubscribe("u1", ida);
+    EXPECT_EQ(bus.stats().topics, 1u);
+    bus.unsubscribe("u1", idb);
+    EXPECT_EQ(bus.stats().topics, 0u);
+}
+
+TEST(ProgressBus, Heartbeat_SentToIdleSubscribers) {
+    ProgressBus bus(manualConfig());
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+
+    bus.heartbeat();
+    ASSERT_EQ(r.frames.size(), 1u);
+    EXPECT_EQ(r.frames[0].rfind(":", 0), 0u);  // SSE comment
+    EXPECT_EQ(bus.stats().heartbeats, 1u);
+
+    r.accept = false;  // Dead peer: the heartbeat write fails
+    bus.heartbeat();
+    EXPECT_EQ(bus.stats().subscribers, 0u);
+    EXPECT_EQ(bus.stats().topics, 0u);
+}
+
+// =============================================================================
+// Connection backlog
+// =============================================================================
+
+TEST(ProgressBus, Backlog_HoldsFramesUntilDrained) {
+    ProgressBus::Config config = manualConfig(2);
+    config.maxBufferedBytes = 1024;
+    ProgressBus bus(config);
+    bus.publish("u1", render(progress(0)));
+
+    size_t unsent = 0;
+    Recorder r;
+    bus.subscribe("u1", r.sink(), [&unsent]() { return unsent; });
+    ASSERT_EQ(r.frames.size(), 1u);
+
+    unsent = 4096;
+    for (int i = 1; i <= 5; ++i) {  // 3rd and 5th publish overflow the 2-frame queue
+        bus.publish("u1", render(progress(i)));
+        bus.flush();
+    }
+    EXPECT_EQ(r.frames.size(), 1u);
+    EXPECT_GT(bus.stats().deferred, 0u);
+
+    // Queue overflowed while held: one snapshot with the latest state
+    unsent = 0;
+    bus.flush();
+    ASSERT_EQ(r.frames.size(), 2u);
+    EXPECT_TRUE(isSnapshot(r.frames[1]));
+    EXPECT_EQ(payload(r.frames[1])["processedCount"].asInt(), 5);
+}
+
+TEST(ProgressBus, RemoveTopic_EndFrameIgnoresBacklog) {
+    ProgressBus::Config config = manualConfig();
+    config.maxBufferedBytes = 1024;
+    ProgressBus bus(config);
+    bus.publish("u1", render(progress(0)));
+    Recorder r;
+    bus.subscribe("u1", r.sink(), []() { return size_t{1} << 20; });
+    EXPECT_TRUE(r.frames.empty());
+
+    bus.removeTopic("u1");
+    ASSERT_EQ(r.frames.size(), 1u);
+    EXPECT_TRUE(ProgressBus::isEndFrame(r.frames[0]));
+}
+
+TEST(ProgressBus, Flusher_DeliversWithoutExplicitFlush) {
+    ProgressBus::Config config;
+    config.interval = std::chrono::milliseconds(10);
+    ProgressBus bus(config);
+    bus.publish("u1", render(progress(0)));
+
+    std::mutex m;
+    std::condition_variable cv;
+    size_t count = 0;
+    bus.subscribe("u1", [&](const std::string&) {
+        std::lock_guard<std::mutex> lock(m);
+        ++count;
+        cv.notify_all();
+        return true;
+    });
+    bus.publish("u1", render(progress(1)));
+
+    std::unique_lock<std::mutex> lock(m);
+    EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(2), [&]() { return count >= 2; }));
+}
+
+TEST(ProgressBus, Metrics_ReportsCoalesceRatio) {
+    ProgressBus bus(manualConfig());
+    Recorder r;
+    bus.subscribe("u1", r.sink());
+    for (int i = 0; i < 4; ++i) bus.publish("u1", render(progress(i)));
+    bus.flush();
+
+    auto metrics = common::progressBusMetrics(bus);
+    EXPECT_EQ(metrics["published"].asUInt64(), 4u);
+    EXPECT_EQ(metrics["rendered"].asUInt64(), 1u);
+    EXPECT_DOUBLE_EQ(metrics["coalesceRatio"].asDouble(), 0.25);
+}
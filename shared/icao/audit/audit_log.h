@@ -9,6 +9,7 @@
 #include <spdlog/spdlog.h>
 #include <drogon/HttpRequest.h>
 #include "i_query_executor.h"
+#include "audit_sink.h"
 
 /**
  * @file audit_log.h
@@ -18,8 +19,9 @@
  * pa-service, and pkd-relay services. All database operations are logged
  * to the operation_audit_log table with comprehensive context tracking.
  *
- * Version: 1.0.0
+ * Version: 1.1.0
  * Created: 2026-02-03
+ * Updated: 2026-10-16 — executor-based logging goes through the async sink when installed
  */
 
 namespace icao {
@@ -168,6 +170,21 @@ inline std::string operationTypeToString(OperationType type) {
     }
 }
 
+/**
+ * @brief Serialize metadata as compact JSON
+ *
+ * The builder is shared: Json::writeString() only reads its settings.
+ */
+inline std::string metadataToJson(const std::optional<Json::Value>& metadata) {
+    if (!metadata.has_value()) return "{}";
+    static const Json::StreamWriterBuilder writer = []() {
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "";  // Compact JSON
+        return builder;
+    }();
+    return Json::writeString(writer, metadata.value());
+}
+
 /**
  * @brief Audit log entry structure
  *
@@ -256,14 +273,7 @@ inline bool logOperation(PGconn* conn, const AuditLogEntry& entry) {
 
     try {
         // Build metadata JSON string for parameterized query
-        std::string metadataStr;
-        if (entry.metadata.has_value()) {
-            Json::StreamWriterBuilder writer;
-            writer["indentation"] = "";  // Compact JSON
-            metadataStr = Json::writeString(writer, entry.metadata.value());
-        } else {
-            metadataStr = "{}";  // Empty JSON object
-        }
+        std::string metadataStr = metadataToJson(entry.metadata);
 
         // Convert OperationType to string
         std::string opTypeStr = operationTypeToString(entry.operationType);
@@ -359,6 +369,9 @@ inline bool logOperation(PGconn* conn, const AuditLogEntry& entry) {
  *
  * @note This function never throws exceptions. All errors are logged via spdlog.
  * @note Supports both PostgreSQL and Oracle via IQueryExecutor abstraction.
+ * @note With an AsyncAuditSink installed (setAuditSink), the row is only queued:
+ *       the return value says whether it was accepted, and created_at is the
+ *       time the flusher wrote it (at most the sink's flush interval later).
  */
 inline bool logOperation(common::IQueryExecutor* executor, const AuditLogEntry& entry) {
     if (!executor) {
@@ -370,14 +383,7 @@ inline bool logOperation(common::IQueryExecutor* executor, const AuditLogEntry&
         std::string dbType = executor->getDatabaseType();
 
         // Build metadata JSON string
-        std::string metadataStr;
-        if (entry.metadata.has_value()) {
-            Json::StreamWriterBuilder writer;
-            writer["indentation"] = "";
-            metadataStr = Json::writeString(writer, entry.metadata.value());
-        } else {
-            metadataStr = "{}";
-        }
+        std::string metadataStr = metadataToJson(entry.metadata);
 
         // Convert OperationType to string
         std::string opTypeStr = operationTypeToString(entry.operationType);
@@ -420,6 +426,11 @@ inline bool logOperation(common::IQueryExecutor* executor, const AuditLogEntry&
             metadataStr
         };
 
+        // Async sink: queue the row, the request does not wait for the INSERT
+        if (auto* sink = auditSink()) {
+            return sink->submit(std::move(query), std::move(params));
+        }
+
         executor->executeCommand(query, params);
 
         spdlog::debug("[AuditLog] Operation logged: {} - {} (user: {}, success: {})",
@@ -0,0 +1,404 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <json/json.h>
+#include <spdlog/spdlog.h>
+#include "i_query_executor.h"
+#include "bulk_writer.h"
+
+/**
+ * @file audit_sink.h
+ * @brief Asynchronous, batched writer for audit rows (operation_audit_log, auth_audit_log)
+ *
+ * Audit inserts used to run inline in the request path, one round trip per
+ * event. With a sink installed (setAuditSink), logOperation() and
+ * AuthAuditRepository::insert() only enqueue the row; a single flusher thread
+ * drains the queue and writes each statement's rows through common::BulkWriter
+ * (multi-row INSERT on PostgreSQL, OCI array DML on Oracle, per-row retry if
+ * the batch is rejected). The executor may be shared with an upload in batch
+ * mode; batch mode is thread-affine, so the flusher writes on its own pooled
+ * connection and audit rows never join (or roll back with) that transaction.
+ *
+ * Queue: bounded lock-free MPSC ring (producers never take a lock). When it
+ * is full, a producer waits up to maxEnqueueWait for space and then drops the
+ * event (counted in Stats::dropped). Events are written at most flushInterval
+ * after they are queued, sooner once batchSize rows are waiting. shutdown()
+ * writes everything still queued. Events queued when the process crashes are
+ * lost.
+ *
+ * Version: 1.1.0
+ * Created: 2026-10-16
+ */
+
+namespace icao {
+namespace audit {
+
+/**
+ * @brief Bounded multi-producer / single-consumer queue (Vyukov ring)
+ *
+ * Each cell carries a sequence number; producers claim a slot with one CAS on
+ * the enqueue position, the consumer owns the dequeue position. Capacity is
+ * rounded up to a power of two.
+ */
+template <typename T>
+class BoundedMpscQueue {
+public:
+    explicit BoundedMpscQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    /// @return false if the queue is full (value is left untouched)
+    bool tryPush(T& value) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Single consumer only
+    bool tryPop(T& out) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & mask_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+            return false;
+        }
+        out = std::move(cell.value);
+        cell.value = T();
+        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Approximate number of queued items (exact when producers are idle)
+    size_t size() const {
+        size_t enq = enqueuePos_.load(std::memory_order_relaxed);
+        size_t deq = dequeuePos_.load(std::memory_order_relaxed);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+};
+
+/**
+ * @brief One parameterized INSERT waiting to be written
+ */
+struct AuditRecord {
+    std::string query;
+    std::vector<std::string> params;
+};
+
+/**
+ * @brief Background audit writer
+ *
+ * Thread-safe: submit() may be called from any thread.
+ */
+class AsyncAuditSink {
+public:
+    struct Config {
+        bool enabled = true;                                    ///< false: services keep writing audit rows inline
+        size_t capacity = 8192;                                 ///< Queued events (rounded to a power of two)
+        size_t batchSize = 200;                                 ///< Events per write cycle
+        std::chrono::milliseconds flushInterval{200};           ///< Max delay before a queued event is written
+        std::chrono::milliseconds maxEnqueueWait{5};            ///< Producer wait on a full queue before dropping
+
+        /**
+         * @brief Read AUDIT_SINK_* environment variables
+         *
+         * AUDIT_SINK_ENABLED ("false" disables), AUDIT_SINK_CAPACITY,
+         * AUDIT_SINK_BATCH_SIZE, AUDIT_SINK_FLUSH_MS, AUDIT_SINK_MAX_WAIT_MS.
+         * Invalid values keep the defaults.
+         */
+        static Config fromEnvironment(Config defaults) {
+            Config config = defaults;
+            if (const char* val = std::getenv("AUDIT_SINK_ENABLED")) {
+                config.enabled = std::string(val) != "false";
+            }
+            config.capacity = std::max<size_t>(16, envSize("AUDIT_SINK_CAPACITY", config.capacity));
+            config.batchSize = std::max<size_t>(1, envSize("AUDIT_SINK_BATCH_SIZE", config.batchSize));
+            config.flushInterval = std::chrono::milliseconds(std::max<size_t>(
+                10, envSize("AUDIT_SINK_FLUSH_MS", static_cast<size_t>(config.flushInterval.count()))));
+            config.maxEnqueueWait = std::chrono::milliseconds(
+                envSize("AUDIT_SINK_MAX_WAIT_MS", static_cast<size_t>(config.maxEnqueueWait.count())));
+            return config;
+        }
+
+    private:
+        static size_t envSize(const char* name, size_t fallback) {
+            const char* val = std::getenv(name);
+            if (!val || !*val) return fallback;
+            try {
+                long long v = std::stoll(val);
+                if (v >= 0) return static_cast<size_t>(v);
+            } catch (...) {}
+            spdlog::warn("[AuditSink] Invalid {}='{}', using {}", name, val, fallback);
+            return fallback;
+        }
+    };
+
+    struct Stats {
+        size_t queueDepth = 0;
+        size_t capacity = 0;
+        uint64_t enqueued = 0;
+        uint64_t written = 0;
+        uint64_t dropped = 0;        ///< Queue full after maxEnqueueWait, or sink stopped
+        uint64_t failed = 0;         ///< Rejected by the database
+        uint64_t batches = 0;
+        uint64_t enqueueWaits = 0;   ///< Submits that found the queue full and had to wait
+    };
+
+    /**
+     * @param executor Query executor used by the flusher (non-owning, must outlive the sink)
+     * @throws std::invalid_argument if executor is nullptr
+     */
+    AsyncAuditSink(common::IQueryExecutor* executor, Config config)
+        : executor_(executor)
+        , config_(config)
+        , queue_(std::max<size_t>(16, config.capacity))
+    {
+        if (!executor_) {
+            throw std::invalid_argument("AsyncAuditSink: executor cannot be nullptr");
+        }
+        config_.batchSize = std::max<size_t>(1, config_.batchSize);
+        flusher_ = std::thread([this]() { run(); });
+        spdlog::info("[AuditSink] Started (capacity {}, batch {}, flush {}ms)",
+                     queue_.capacity(), config_.batchSize, config_.flushInterval.count());
+    }
+
+    ~AsyncAuditSink() { shutdown(); }
+
+    AsyncAuditSink(const AsyncAuditSink&) = delete;
+    AsyncAuditSink& operator=(const AsyncAuditSink&) = delete;
+
+    /**
+     * @brief Queue one row for writing
+     * @return false if the event was dropped (queue full or sink stopped)
+     */
+    bool submit(std::string query, std::vector<std::string> params) {
+        if (stopping_.load(std::memory_order_acquire)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        AuditRecord record{std::move(query), std::move(params)};
+        if (!queue_.tryPush(record)) {
+            enqueueWaits_.fetch_add(1, std::memory_order_relaxed);
+            wake();
+            auto deadline = std::chrono::steady_clock::now() + config_.maxEnqueueWait;
+            bool pushed = false;
+            while (!pushed && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                pushed = queue_.tryPush(record);
+            }
+            if (!pushed) {
+                uint64_t dropped = dropped_.fetch_add(1, std::memory_order_relaxed) + 1;
+                if ((dropped & (dropped - 1)) == 0) {  // 1, 2, 4, 8, ... to keep logs bounded
+                    spdlog::warn("[AuditSink] Queue full, {} audit events dropped so far", dropped);
+                }
+                return false;
+            }
+        }
+
+        enqueued_.fetch_add(1, std::memory_order_relaxed);
+        if (queue_.size() >= config_.batchSize) wake();
+        return true;
+    }
+
+    /**
+     * @brief Stop accepting events, write everything queued and join the flusher
+     */
+    void shutdown() {
+        if (stopping_.exchange(true)) return;
+        wake();
+        if (flusher_.joinable()) flusher_.join();
+
+        // Producers that passed the stopping_ check just before it was set
+        std::vector<AuditRecord> batch;
+        for (drain(batch); !batch.empty(); drain(batch)) {
+            write(batch);
+            batch.clear();
+        }
+        auto s = stats();
+        spdlog::info("[AuditSink] Stopped (written {}, failed {}, dropped {})", s.written, s.failed, s.dropped);
+    }
+
+    Stats stats() const {
+        Stats s;
+        s.queueDepth = queue_.size();
+        s.capacity = queue_.capacity();
+        s.enqueued = enqueued_.load(std::memory_order_relaxed);
+        s.written = written_.load(std::memory_order_relaxed);
+        s.dropped = dropped_.load(std::memory_order_relaxed);
+        s.failed = failed_.load(std::memory_order_relaxed);
+        s.batches = batches_.load(std::memory_order_relaxed);
+        s.enqueueWaits = enqueueWaits_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    void wake() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wakePending_ = true;
+        }
+        wakeCv_.notify_one();
+    }
+
+    void run() {
+        std::vector<AuditRecord> batch;
+        batch.reserve(config_.batchSize);
+        for (;;) {
+            drain(batch);
+            if (!batch.empty()) {
+                write(batch);
+                batch.clear();
+                if (queue_.size() > 0) continue;
+            }
+            if (stopping_.load(std::memory_order_acquire)) {
+                if (queue_.size() == 0) break;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wakeCv_.wait_for(lock, config_.flushInterval, [this]() { return wakePending_; });
+            wakePending_ = false;
+        }
+    }
+
+    void drain(std::vector<AuditRecord>& batch) {
+        AuditRecord record;
+        while (batch.size() < config_.batchSize && queue_.tryPop(record)) {
+            batch.push_back(std::move(record));
+        }
+    }
+
+    /// One BulkWriter per statement, in first-seen order
+    void write(std::vector<AuditRecord>& batch) {
+        std::vector<common::BulkWriter> writers;
+        std::map<std::string, size_t> writerIndex;
+        for (auto& record : batch) {
+            auto it = writerIndex.find(record.query);
+            if (it == writerIndex.end()) {
+                it = writerIndex.emplace(record.query, writers.size()).first;
+                writers.emplace_back(executor_, record.query, batch.size());
+            }
+            writers[it->second].add(std::move(record.params));
+        }
+
+        for (auto& writer : writers) {
+            size_t staged = writer.pending();
+            size_t written = 0;
+            try {
+                written = writer.flush();
+            } catch (const std::exception& e) {
+                spdlog::error("[AuditSink] Batch write failed: {}", e.what());
+            }
+            written_.fetch_add(written, std::memory_order_relaxed);
+            failed_.fetch_add(staged - written, std::memory_order_relaxed);
+        }
+        batches_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    common::IQueryExecutor* executor_;
+    Config config_;
+    BoundedMpscQueue<AuditRecord> queue_;
+
+    std::atomic<bool> stopping_{false};
+    std::thread flusher_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    bool wakePending_ = false;
+
+    std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> failed_{0};
+    std::atomic<uint64_t> batches_{0};
+    std::atomic<uint64_t> enqueueWaits_{0};
+};
+
+namespace detail {
+inline std::atomic<AsyncAuditSink*>& auditSinkSlot() {
+    static std::atomic<AsyncAuditSink*> slot{nullptr};
+    return slot;
+}
+} // namespace detail
+
+/**
+ * @brief Install the process-wide sink used by logOperation(executor, ...) and
+ *        repository audit inserts (nullptr = write synchronously)
+ *
+ * Call with nullptr before the sink is destroyed.
+ */
+inline void setAuditSink(AsyncAuditSink* sink) {
+    detail::auditSinkSlot().store(sink, std::memory_order_release);
+}
+
+inline AsyncAuditSink* auditSink() {
+    return detail::auditSinkSlot().load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Sink statistics for /internal/metrics
+ */
+inline Json::Value auditSinkMetrics(const AsyncAuditSink& sink) {
+    auto stats = sink.stats();
+    Json::Value result;
+    result["queueDepth"] = static_cast<Json::UInt>(stats.queueDepth);
+    result["capacity"] = static_cast<Json::UInt>(stats.capacity);
+    result["enqueued"] = static_cast<Json::UInt64>(stats.enqueued);
+    result["written"] = static_cast<Json::UInt64>(stats.written);
+    result["dropped"] = static_cast<Json::UInt64>(stats.dropped);
+    result["failed"] = static_cast<Json::UInt64>(stats.failed);
+    result["batches"] = static_cast<Json::UInt64>(stats.batches);
+    result["enqueueWaits"] = static_cast<Json::UInt64>(stats.enqueueWaits);
+    return result;
+}
+
+} // namespace audit
+} // namespace icao
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <exception>
+#include <string>
+#include <drogon/HttpClient.h>
+#include <spdlog/spdlog.h>
+
+/**
+ * @file internal_signal.h
+ * @brief Fire-and-forget POST to another service's /internal/... endpoint
+ *
+ * Shared by the cross-service change signals (trust snapshot refresh,
+ * certificate search summary invalidation). The request runs on Drogon's
+ * event loop; failures are only logged because every receiver keeps a
+ * periodic/TTL fallback.
+ *
+ * Header-only; the consuming target links Drogon.
+ *
+ * @date 2026-10-16
+ */
+
+namespace icao::internal {
+
+/**
+ * POST to url (no body). Never throws.
+ * @param url Full URL; empty = disabled
+ * @param logTag Log prefix without brackets (e.g. "TrustSnapshot")
+ * @param reason Short label for logs (e.g. "upload 1234")
+ *
+ * 2xx is success; 404 means the receiver has the feature disabled and is
+ * not logged as a failure.
+ */
+inline void postInternalSignal(const std::string& url, const std::string& logTag,
+                               const std::string& reason) {
+    if (url.empty()) {
+        return;
+    }
+
+    size_t schemeEnd = url.find("://");
+    size_t pathStart = url.find('/', schemeEnd == std::string::npos ? 0 : schemeEnd + 3);
+    std::string host = url.substr(0, pathStart);
+    std::string path = (pathStart == std::string::npos) ? "/" : url.substr(pathStart);
+
+    try {
+        auto client = drogon::HttpClient::newHttpClient(host);
+        auto req = drogon::HttpRequest::newHttpRequest();
+        req->setMethod(drogon::Post);
+        req->setPath(path);
+
+        // client is captured so it outlives the in-flight request
+        client->sendRequest(req, [client, logTag, reason](drogon::ReqResult result,
+                                                          const drogon::HttpResponsePtr& resp) {
+            if (result != drogon::ReqResult::Ok || !resp) {
+                spdlog::warn("[{}] Notify after {} failed (result={})",
+                             logTag, reason, static_cast<int>(result));
+                return;
+            }
+            int status = static_cast<int>(resp->getStatusCode());
+            if (status >= 200 && status < 300) {
+                spdlog::debug("[{}] Notified after {}", logTag, reason);
+            } else if (resp->getStatusCode() != drogon::k404NotFound) {
+                spdlog::warn("[{}] Notify after {} rejected (HTTP {})", logTag, reason, status);
+            }
+        }, 5.0);
+    } catch (const std::exception& e) {
+        spdlog::warn("[{}] Notify after {} failed: {}", logTag, reason, e.what());
+    }
+}
+
+} // namespace icao::internal
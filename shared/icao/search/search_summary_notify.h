@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#include <icao/internal/internal_signal.h>
+
+/**
+ * @file search_summary_notify.h
+ * @brief Tell pkd-management that certificate rows changed outside its process
+ *
+ * pkd-management caches certificate search totals/stats per filter for
+ * CERT_SEARCH_COUNT_CACHE_TTL_SEC and clears the cache on its own uploads.
+ * pkd-relay writes and deletes certificate rows too (LDIF/Master List
+ * processing, upload deletion, retry cleanup) and calls
+ * notifySearchSummaryChanged() after each so the totals are not stale
+ * (POST /internal/search-summary/invalidate).
+ *
+ * Fire-and-forget (see internal_signal.h); the TTL remains the fallback.
+ *
+ * Target URL: CERT_SEARCH_SUMMARY_INVALIDATE_URL (empty = disabled).
+ *
+ * Header-only; the consuming target links Drogon.
+ *
+ * @date 2026-10-16
+ */
+
+namespace icao::search {
+
+inline const std::string& searchSummaryInvalidateUrl() {
+    static const std::string url = [] {
+        const char* env = std::getenv("CERT_SEARCH_SUMMARY_INVALIDATE_URL");
+        return std::string(env ? env : "http://pkd-management:8081/internal/search-summary/invalidate");
+    }();
+    return url;
+}
+
+/**
+ * Ask pkd-management to drop its cached search totals. Never throws.
+ * @param reason Short label for logs (e.g. "LDIF upload 1234")
+ */
+inline void notifySearchSummaryChanged(const std::string& reason) {
+    icao::internal::postInternalSignal(searchSummaryInvalidateUrl(), "SearchSummary", reason);
+}
+
+} // namespace icao::search
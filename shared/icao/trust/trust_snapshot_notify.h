@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#include <icao/internal/internal_signal.h>
+
+/**
+ * @file trust_snapshot_notify.h
+ * @brief Tell pa-service that CSCA/CRL content in LDAP has changed
+ *
+ * pa-service verifies against an in-memory CSCA/CRL snapshot that is
+ * otherwise only reloaded every TRUST_SNAPSHOT_REFRESH_SECONDS. Services that
+ * write trust material to LDAP (certificate uploads, LDIF/Master List
+ * processing, reconciliation, ICAO LDAP sync) call
+ * notifyTrustSnapshotChanged() once per completed operation so pa-service
+ * reloads right away (POST /internal/trust-snapshot/refresh).
+ *
+ * Fire-and-forget (see internal_signal.h); the periodic refresh remains the
+ * fallback.
+ *
+ * Target URL: PA_TRUST_SNAPSHOT_REFRESH_URL (empty = disabled).
+ *
+ * Header-only; the consuming target links Drogon.
+ *
+ * @date 2026-10-16
+ */
+
+namespace icao::trust {
+
+inline const std::string& trustSnapshotRefreshUrl() {
+    static const std::string url = [] {
+        const char* env = std::getenv("PA_TRUST_SNAPSHOT_REFRESH_URL");
+        return std::string(env ? env : "http://pa-service:8082/internal/trust-snapshot/refresh");
+    }();
+    return url;
+}
+
+/**
+ * Ask pa-service to reload its trust snapshot. Never throws.
+ * @param reason Short label for logs (e.g. "upload 1234", "reconciliation")
+ */
+inline void notifyTrustSnapshotChanged(const std::string& reason) {
+    icao::internal::postInternalSignal(trustSnapshotRefreshUrl(), "TrustSnapshot", reason);
+}
+
+} // namespace icao::trust
@@ -0,0 +1,238 @@
+/**
+ * @file test_audit_sink.cpp
+ * @brief Unit tests for BoundedMpscQueue and AsyncAuditSink
+ *
+ * No DB connection required: a recording stub executor captures the batches
+ * the flusher writes and can be slowed down or told to reject batches.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "icao/audit/audit_sink.h"
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace icao::audit;
+
+namespace {
+
+class RecordingExecutor : public common::IQueryExecutor {
+public:
+    Json::Value executeQuery(const std::string&, const std::vector<std::string>&) override { return Json::arrayValue; }
+    int executeCommand(const std::string& query, const std::vector<std::string>& params) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!params.empty() && params[0] == rejectFirstParam) {
+            throw std::runtime_error("value too long");
+        }
+        rows.push_back(params);
+        queries.insert(query);
+        return 1;
+    }
+    int executeBatch(const std::string& query, const std::vector<std::vector<std::string>>& paramRows) override {
+        if (delay.count() > 0) std::this_thread::sleep_for(delay);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!rejectFirstParam.empty()) throw std::runtime_error("batch rejected");
+        batchSizes.push_back(paramRows.size());
+        for (const auto& p : paramRows) rows.push_back(p);
+        queries.insert(query);
+        return static_cast<int>(paramRows.size());
+    }
+    Json::Value executeScalar(const std::string&, const std::vector<std::string>&) override { return Json::nullValue; }
+    std::string getDatabaseType() const override { return "postgres"; }
+
+    size_t rowCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return rows.size();
+    }
+
+    std::mutex mutex;
+    std::vector<std::vector<std::string>> rows;
+    std::vector<size_t> batchSizes;
+    std::set<std::string> queries;
+    std::string rejectFirstParam;
+    std::chrono::milliseconds delay{0};
+};
+
+const std::string kOpQuery = "INSERT INTO operation_audit_log (username) VALUES ($1)";
+const std::string kAuthQuery = "INSERT INTO auth_audit_log (username) VALUES ($1)";
+
+} // anonymous namespace
+
+// =============================================================================
+// BoundedMpscQueue
+// =============================================================================
+
+TEST(BoundedMpscQueue, Capacity_RoundedToPowerOfTwo) {
+    BoundedMpscQueue<int> q(100);
+    EXPECT_EQ(q.capacity(), 128u);
+}
+
+TEST(BoundedMpscQueue, PushPop_FifoAndFull) {
+    BoundedMpscQueue<int> q(4);
+    for (int i = 0; i < 4; ++i) {
+        int v = i;
+        EXPECT_TRUE(q.tryPush(v));
+    }
+    int extra = 99;
+    EXPECT_FALSE(q.tryPush(extra));
+    EXPECT_EQ(q.size(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        int out = -1;
+        ASSERT_TRUE(q.tryPop(out));
+        EXPECT_EQ(out, i);
+    }
+    int out;
+    EXPECT_FALSE(q.tryPop(out));
+}
+
+TEST(BoundedMpscQueue, ConcurrentProducers_EveryItemDeliveredOnce) {
+    BoundedMpscQueue<int> q(1024);
+    const int producers = 4;
+    const int perProducer = 20000;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, p]() {
+            for (int i = 0; i < perProducer; ++i) {
+                int v = p * perProducer + i;
+                while (!q.tryPush(v)) std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<bool> seen(producers * perProducer, false);
+    int received = 0;
+    while (received < producers * perProducer) {
+        int v;
+        if (q.tryPop(v)) {
+            ASSERT_FALSE(seen[v]);
+            seen[v] = true;
+            received++;
+        }
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(q.size(), 0u);
+}
+
+// =============================================================================
+// AsyncAuditSink
+// =============================================================================
+
+TEST(AsyncAuditSink, Submit_WrittenInBatchesByStatement) {
+    RecordingExecutor db;
+    {
+        AsyncAuditSink::Config config;
+        config.flushInterval = std::chrono::milliseconds(50);
+        AsyncAuditSink sink(&db, config);
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_TRUE(sink.submit(i % 2 ? kOpQuery : kAuthQuery, {"user" + std::to_string(i)}));
+        }
+    }  // Destructor flushes
+    EXPECT_EQ(db.rows.size(), 10u);
+    EXPECT_EQ(db.queries.size(), 2u);
+    EXPECT_LE(db.batchSizes.size(), 4u);  // Not one write per event
+}
+
+TEST(AsyncAuditSink, Submit_DoesNotWaitForTheDatabase) {
+    RecordingExecutor db;
+    db.delay = std::chrono::milliseconds(200);
+    AsyncAuditSink sink(&db, {});
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 50; ++i) sink.submit(kOpQuery, {"u"});
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(elapsed, std::chrono::milliseconds(100));
+
+    sink.shutdown();
+    EXPECT_EQ(db.rowCount(), 50u);
+    EXPECT_EQ(sink.stats().written, 50u);
+}
+
+TEST(AsyncAuditSink, BatchThreshold_FlushesBeforeInterval) {
+    RecordingExecutor db;
+    AsyncAuditSink::Config config;
+    config.batchSize = 8;
+    config.flushInterval = std::chrono::milliseconds(10000);
+    AsyncAuditSink sink(&db, config);
+
+    for (int i = 0; i < 8; ++i) sink.submit(kOpQuery, {"u"});
+    for (int i = 0; i < 200 && db.rowCount() < 8; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(db.rowCount(), 8u);
+}
+
+TEST(AsyncAuditSink, QueueFull_DropsAfterBoundedWait) {
+    RecordingExecutor db;
+    db.delay = std::chrono::milliseconds(300);
+    AsyncAuditSink::Config config;
+    config.capacity = 16;
+    config.batchSize = 16;
+    config.maxEnqueueWait = std::chrono::milliseconds(1);
+    AsyncAuditSink sink(&db, config);
+
+    int accepted = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (sink.submit(kOpQuery, {"u"})) accepted++;
+    }
+    auto stats = sink.stats();
+    EXPECT_GT(stats.dropped, 0u);
+    EXPECT_EQ(stats.dropped + static_cast<uint64_t>(accepted), 100u);
+    EXPECT_GT(stats.enqueueWaits, 0u);
+
+    sink.shutdown();
+    EXPECT_EQ(db.rowCount(), static_cast<size_t>(accepted));
+}
+
+TEST(AsyncAuditSink, RejectedBatch_OnlyBadRowLost) {
+    RecordingExecutor db;
+    db.rejectFirstParam = "bad";
+    AsyncAuditSink sink(&db, {});
+    sink.submit(kOpQuery, {"good1"});
+    sink.submit(kOpQuery, {"bad"});
+    sink.submit(kOpQuery, {"good2"});
+    sink.shutdown();
+
+    EXPECT_EQ(db.rows.size(), 2u);
+    EXPECT_EQ(sink.stats().written, 2u);
+    EXPECT_EQ(sink.stats().failed, 1u);
+}
+
+TEST(AsyncAuditSink, SubmitAfterShutdown_Dropped) {
+    RecordingExecutor db;
+    AsyncAuditSink sink(&db, {});
+    sink.shutdown();
+    EXPECT_FALSE(sink.submit(kOpQuery, {"late"}));
+    EXPECT_EQ(sink.stats().dropped, 1u);
+}
+
+TEST(AsyncAuditSink, GlobalSlot_InstallAndClear) {
+    RecordingExecutor db;
+    AsyncAuditSink sink(&db, {});
+    EXPECT_EQ(auditSink(), nullptr);
+    setAuditSink(&sink);
+    EXPECT_EQ(auditSink(), &sink);
+    setAuditSink(nullptr);
+    EXPECT_EQ(auditSink(), nullptr);
+}
+
+TEST(AsyncAuditSink, Metrics_ReportsQueueAndCounters) {
+    RecordingExecutor db;
+    AsyncAuditSink sink(&db, {});
+    sink.submit(kOpQuery, {"u"});
+    sink.shutdown();
+    auto metrics = auditSinkMetrics(sink);
+    EXPECT_EQ(metrics["queueDepth"].asUInt(), 0u);
+    EXPECT_EQ(metrics["written"].asUInt64(), 1u);
+    EXPECT_EQ(metrics["dropped"].asUInt64(), 0u);
+}
+
+TEST(AsyncAuditSink, NullExecutor_Throws) {
+    EXPECT_THROW(AsyncAuditSink(nullptr, {}), std::invalid_argument);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file bulk_writer.cpp
+ * @brief BulkWriter implementation
+ */
+
+#include "bulk_writer.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace common {
+
+BulkWriter::BulkWriter(IQueryExecutor* executor, std::string query, size_t flushThreshold)
+    : executor_(executor)
+    , query_(std::move(query))
+    , flushThreshold_(flushThreshold > 0 ? flushThreshold : 1)
+{
+    if (!executor_) {
+        throw std::invalid_argument("BulkWriter: executor cannot be nullptr");
+    }
+}
+
+size_t BulkWriter::add(std::vector<std::string> params) {
+    rows_.push_back(std::move(params));
+    return rows_.size() - 1;
+}
+
+size_t BulkWriter::flush() {
+    if (rows_.empty()) return 0;
+
+    std::vector<std::vector<std::string>> rows;
+    rows.swap(rows_);
+
+    // Savepoint keeps a failed batch from aborting the caller's batch transaction and
+    // undoes the rows it applied before failing (Oracle array DML keeps them)
+    executor_->savepoint("sp_bulk");
+    try {
+        int affected = executor_->executeBatch(query_, rows);
+        return static_cast<size_t>(std::max(affected, 0));
+    } catch (const std::exception& e) {
+        executor_->rollbackToSavepoint("sp_bulk");
+        spdlog::warn("[BulkWriter] Batch of {} rows failed, retrying row by row: {}", rows.size(), e.what());
+    }
+
+    size_t written = 0;
+    for (const auto& params : rows) {
+        executor_->savepoint("sp_bulk");
+        try {
+            written += static_cast<size_t>(std::max(executor_->executeCommand(query_, params), 0));
+        } catch (const std::exception& e) {
+            executor_->rollbackToSavepoint("sp_bulk");
+            failedRows_++;
+            spdlog::error("[BulkWriter] Row rejected: {}", e.what());
+        }
+    }
+    return written;
+}
+
+} // namespace common
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "i_query_executor.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @file bulk_writer.h
+ * @brief Row buffer that flushes one SQL command through IQueryExecutor::executeBatch()
+ *
+ * Repositories stage rows during bulk pipelines (LDIF, Master List, ICAO LDAP
+ * sync) and flush them at batch boundaries:
+ *
+ *   common::BulkWriter writer(executor, "INSERT INTO t (a, b) VALUES ($1, $2)");
+ *   writer.add({a1, b1});
+ *   writer.add({a2, b2});
+ *   writer.flush();   // one multi-row INSERT / OCI array execute
+ *
+ * flush() runs the batch under a savepoint. If it fails, the rows are retried
+ * one by one so a single bad row only loses itself, not the whole batch
+ * transaction. Staged rows can be patched in place until flushed.
+ *
+ * Not thread-safe: owned by the pipeline thread that stages the rows.
+ *
+ * @date 2026-10-15
+ */
+
+namespace common {
+
+class BulkWriter {
+public:
+    /// Rows staged before owners are expected to flush
+    static constexpr size_t kDefaultFlushThreshold = 500;
+
+    BulkWriter(IQueryExecutor* executor, std::string query,
+               size_t flushThreshold = kDefaultFlushThreshold);
+
+    /**
+     * @brief Stage one parameter row
+     * @return Index of the row, valid for row() until the next flush()
+     */
+    size_t add(std::vector<std::string> params);
+
+    /// Staged row for in-place updates before it is written
+    std::vector<std::string>& row(size_t index) { return rows_.at(index); }
+
+    size_t pending() const { return rows_.size(); }
+    bool full() const { return rows_.size() >= flushThreshold_; }
+    const std::string& query() const { return query_; }
+
+    /**
+     * @brief Write all staged rows
+     *
+     * Never throws for row failures: rows the database rejects are logged and
+     * counted in failedRows().
+     *
+     * @return Rows the database reports as written (affected row count), so
+     *         rows skipped by ON CONFLICT DO NOTHING / MERGE are not counted
+     */
+    size_t flush();
+
+    /// Rows rejected by the database since construction
+    size_t failedRows() const { return failedRows_; }
+
+    /// Discard staged rows without writing them
+    void clear() { rows_.clear(); }
+
+    /// Discard rows staged after the first count (undo a rolled-back unit of work)
+    void truncate(size_t count) {
+        if (count < rows_.size()) rows_.resize(count);
+    }
+
+private:
+    IQueryExecutor* executor_;
+    std::string query_;
+    size_t flushThreshold_;
+    std::vector<std::vector<std::string>> rows_;
+    size_t failedRows_ = 0;
+};
+
+} // namespace common
@@ -14,6 +14,7 @@
 #include <string>
 #include <memory>
 #include <chrono>
+#include <cstdint>
 
 namespace common {
 
@@ -81,9 +82,20 @@ public:
      * @brief Get pool statistics
      */
     struct Stats {
-        size_t availableConnections;
-        size_t totalConnections;
-        size_t maxConnections;
+        size_t availableConnections = 0;
+        size_t totalConnections = 0;
+        size_t maxConnections = 0;
+
+        // Acquire/health counters (v2.42.0 — zero for pools that do not track them)
+        uint64_t acquireCount = 0;          ///< Successful acquire() calls
+        uint64_t acquireWaitTotalUs = 0;    ///< Sum of acquire() wait times (microseconds)
+        uint64_t acquireWaitMaxUs = 0;      ///< Longest single acquire() wait (microseconds)
+        uint64_t healthCheckCount = 0;      ///< Round-trip health checks issued (SELECT 1 / ping)
+        uint64_t discardedConnections = 0;  ///< Connections closed as broken or unhealthy
+
+        // Prepared statement cache counters (PostgreSQL only)
+        uint64_t statementPrepares = 0;     ///< PQprepare calls (cache misses and re-prepares)
+        uint64_t statementExecutes = 0;     ///< Statements executed through the cache
     };
 
     virtual Stats getStats() const = 0;
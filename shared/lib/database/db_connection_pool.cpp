@@ -6,6 +6,8 @@
 #include "db_connection_pool.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <algorithm>
+#include <functional>
 
 namespace common {
 
@@ -52,20 +54,33 @@ DbConnectionPool::DbConnectionPool(
     const std::string& connString,
     size_t minSize,
     size_t maxSize,
-    int acquireTimeoutSec)
+    int acquireTimeoutSec,
+    int idleValidationSec,
+    size_t statementCacheSize,
+    size_t shardCount)
     : connString_(connString)
     , minSize_(minSize)
     , maxSize_(maxSize)
     , acquireTimeout_(acquireTimeoutSec)
+    , idleValidationInterval_(idleValidationSec > 0 ? idleValidationSec : 0)
+    , statementCacheSize_(statementCacheSize)
+    , shardCount_(1)
+    , availableCount_(0)
     , totalConnections_(0)
+    , waiters_(0)
     , shutdown_(false)
 {
     if (minSize > maxSize) {
         throw std::invalid_argument("minSize cannot exceed maxSize");
     }
 
-    spdlog::info("DbConnectionPool created: minSize={}, maxSize={}, timeout={}s",
-                 minSize_, maxSize_, acquireTimeoutSec);
+    // One shard per core, but never more shards than connections
+    size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+    shardCount_ = std::max<size_t>(1, std::min(shardCount > 0 ? shardCount : cores, maxSize_));
+    shards_ = std::make_unique<FreeListShard[]>(shardCount_);
+
+    spdlog::info("DbConnectionPool created: minSize={}, maxSize={}, timeout={}s, idleValidation={}s, shards={}",
+                 minSize_, maxSize_, acquireTimeoutSec, idleValidationInterval_.count(), shardCount_);
 }
 
 DbConnectionPool::~DbConnectionPool() {
@@ -75,8 +90,6 @@ DbConnectionPool::~DbConnectionPool() {
 bool DbConnectionPool::initialize() {
     spdlog::info("Initializing DbConnectionPool with {} minimum connections", minSize_);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-
     // Create minimum connections
     for (size_t i = 0; i < minSize_; i++) {
         PGconn* conn = createConnection();
@@ -85,18 +98,28 @@ bool DbConnectionPool::initialize() {
             return false;
         }
 
-        availableConnections_.push(conn);
+        // Spread initial connections across shards
+        FreeListShard& shard = shards_[i % shardCount_];
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.connections.push_back({conn, std::chrono::steady_clock::now()});
+        }
+        availableCount_++;
         totalConnections_++;
     }
 
+    if (idleValidationInterval_.count() > 0 && !reaperThread_.joinable()) {
+        reaperThread_ = std::thread(&DbConnectionPool::reaperLoop, this);
+    }
+
     spdlog::info("DbConnectionPool initialized with {} connections", totalConnections_.load());
     return true;
 }
 
 DbConnection DbConnectionPool::acquire() {
-    std::unique_lock<std::mutex> lock(mutex_);
-
-    auto deadline = std::chrono::steady_clock::now() + acquireTimeout_;
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + acquireTimeout_;
+    const bool checkOnAcquire = idleValidationInterval_.count() == 0;
 
     while (true) {
         // Check if pool is shutdown
@@ -104,41 +127,40 @@ DbConnection DbConnectionPool::acquire() {
             throw std::runtime_error("Connection pool is shutdown");
         }
 
-        // Check if connection is available
-        if (!availableConnections_.empty()) {
-            PGconn* conn = availableConnections_.front();
-            availableConnections_.pop();
-
-            // Verify connection health
-            if (isConnectionHealthy(conn)) {
-                spdlog::debug("Acquired connection from pool (available: {})", availableConnections_.size());
+        // Fast path: take an idle connection from the free list
+        PGconn* conn = nullptr;
+        while (popIdle(conn)) {
+            if (!checkOnAcquire || isConnectionHealthy(conn)) {
+                recordAcquire(start);
+                spdlog::debug("Acquired connection from pool (available: {})", availableCount_.load());
                 return DbConnection(conn, this);
-            } else {
-                spdlog::warn("Connection from pool is unhealthy, closing and retrying");
-                PQfinish(conn);
-                totalConnections_--;
-                continue;  // Try to get another connection
             }
+            spdlog::warn("Connection from pool is unhealthy, closing and retrying");
+            discardConnection(conn);
         }
 
         // No available connections - try to create new one if under max
-        if (totalConnections_ < maxSize_) {
-            lock.unlock();
-            PGconn* conn = createConnection();
-            lock.lock();
-
+        if (reserveSlot()) {
+            conn = createConnection();
             if (conn) {
-                totalConnections_++;
+                recordAcquire(start);
                 spdlog::info("Created new connection (total: {})", totalConnections_.load());
                 return DbConnection(conn, this);
-            } else {
-                spdlog::error("Failed to create new connection");
-                throw std::runtime_error("Failed to create database connection");
             }
+            totalConnections_--;
+            notifyWaiter();
+            spdlog::error("Failed to create new connection");
+            throw std::runtime_error("Failed to create database connection");
         }
 
-        // Wait for connection to become available or timeout
-        if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+        // Slow path: wait for a release or a freed slot
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_++;
+        bool ready = cv_.wait_until(lock, deadline, [this] {
+            return shutdown_ || availableCount_ > 0 || totalConnections_ < maxSize_;
+        });
+        waiters_--;
+        if (!ready) {
             spdlog::warn("Timeout waiting for database connection (timeout: {}s)", acquireTimeout_.count());
             throw std::runtime_error("Timeout acquiring database connection");
         }
@@ -151,38 +173,50 @@ std::unique_ptr<IDbConnection> DbConnectionPool::acquireGeneric() {
 }
 
 DbConnectionPool::Stats DbConnectionPool::getStats() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    return Stats{
-        availableConnections_.size(),
-        totalConnections_.load(),
-        maxSize_
-    };
+    Stats stats;
+    stats.availableConnections = availableCount_.load();
+    stats.totalConnections = totalConnections_.load();
+    stats.maxConnections = maxSize_;
+    stats.acquireCount = acquireCount_.load();
+    stats.acquireWaitTotalUs = acquireWaitTotalUs_.load();
+    stats.acquireWaitMaxUs = acquireWaitMaxUs_.load();
+    stats.healthCheckCount = healthCheckCount_.load();
+    stats.discardedConnections = discardedConnections_.load();
+    stats.statementPrepares = statementPrepares_.load();
+    stats.statementExecutes = statementExecutes_.load();
+    return stats;
 }
 
 void DbConnectionPool::shutdown() {
-    spdlog::info("Shutting down DbConnectionPool");
-
-    std::lock_guard<std::mutex> lock(mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_) {
+            return;
+        }
+        spdlog::info("Shutting down DbConnectionPool");
+        shutdown_ = true;
 
-    if (shutdown_) {
-        return;
+        // Notify all waiting threads (acquirers and reaper)
+        cv_.notify_all();
+        reaperCv_.notify_all();
     }
 
-    shutdown_ = true;
+    if (reaperThread_.joinable() && reaperThread_.get_id() != std::this_thread::get_id()) {
+        reaperThread_.join();
+    }
 
     // Close all available connections
-    while (!availableConnections_.empty()) {
-        PGconn* conn = availableConnections_.front();
-        availableConnections_.pop();
-        PQfinish(conn);
+    for (size_t i = 0; i < shardCount_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        for (auto& idle : shards_[i].connections) {
+            closeConnection(idle.conn);
+        }
+        shards_[i].connections.clear();
     }
 
+    availableCount_ = 0;
     totalConnections_ = 0;
 
-    // Notify all waiting threads
-    cv_.notify_all();
-
     spdlog::info("DbConnectionPool shutdown complete");
 }
 
@@ -202,6 +236,10 @@ PGconn* DbConnectionPool::createConnection() {
     return conn;
 }
 
+void DbConnectionPool::closeConnection(PGconn* conn) {
+    PQfinish(conn);
+}
+
 bool DbConnectionPool::isConnectionHealthy(PGconn* conn) {
     if (!conn) {
         return false;
@@ -214,6 +252,7 @@ bool DbConnectionPool::isConnectionHealthy(PGconn* conn) {
     }
 
     // Send a simple ping query
+    healthCheckCount_++;
     PGresult* res = PQexec(conn, "SELECT 1");
     if (!res || PQresultStatus(res) != PGRES_TUPLES_OK) {
         if (res) {
@@ -228,28 +267,162 @@ bool DbConnectionPool::isConnectionHealthy(PGconn* conn) {
 }
 
 void DbConnectionPool::releaseConnection(PGconn* conn) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (shutdown_) {
         // Pool is shutdown, close connection immediately
-        PQfinish(conn);
-        totalConnections_--;
+        closeConnection(conn);
         return;
     }
 
-    // Verify connection is still healthy before returning to pool
-    if (isConnectionHealthy(conn)) {
-        availableConnections_.push(conn);
-        spdlog::debug("Connection returned to pool (available: {})", availableConnections_.size());
+    bool reusable;
+    if (idleValidationInterval_.count() == 0) {
+        // Legacy mode: verify with a round trip before returning to pool
+        reusable = isConnectionHealthy(conn);
+    } else {
+        // Fast path: judge from the outcome of the caller's real queries
+        reusable = isReusableAfterUse(conn);
+    }
+
+    if (reusable) {
+        pushIdle(conn);
+        spdlog::debug("Connection returned to pool (available: {})", availableCount_.load());
     } else {
-        // Connection is unhealthy, close it
+        // Connection is unhealthy, close it; the next acquire reconnects
         spdlog::warn("Released connection is unhealthy, closing");
-        PQfinish(conn);
-        totalConnections_--;
+        discardConnection(conn);
+    }
+}
+
+bool DbConnectionPool::isReusableAfterUse(PGconn* conn) {
+    return PQstatus(conn) == CONNECTION_OK &&
+           PQtransactionStatus(conn) == PQTRANS_IDLE;
+}
+
+// --- Free list helpers ---
+
+size_t DbConnectionPool::homeShard() const {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) % shardCount_;
+}
+
+bool DbConnectionPool::popIdle(PGconn*& conn) {
+    if (availableCount_ == 0) {
+        return false;
+    }
+
+    // Home shard first, then steal from the others
+    size_t home = homeShard();
+    for (size_t i = 0; i < shardCount_; ++i) {
+        FreeListShard& shard = shards_[(home + i) % shardCount_];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!shard.connections.empty()) {
+            // LIFO: the most recently used connection is the warmest one
+            conn = shard.connections.back().conn;
+            shard.connections.pop_back();
+            availableCount_--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DbConnectionPool::pushIdle(PGconn* conn) {
+    FreeListShard& shard = shards_[homeShard()];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.connections.push_back({conn, std::chrono::steady_clock::now()});
+    }
+    availableCount_++;
+    notifyWaiter();
+}
+
+bool DbConnectionPool::reserveSlot() {
+    size_t current = totalConnections_.load();
+    while (current < maxSize_) {
+        if (totalConnections_.compare_exchange_weak(current, current + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DbConnectionPool::discardConnection(PGconn* conn) {
+    closeConnection(conn);
+    totalConnections_--;
+    discardedConnections_++;
+    notifyWaiter();
+}
+
+void DbConnectionPool::notifyWaiter() {
+    // Only touch the mutex when someone is actually blocked in acquire()
+    if (waiters_ > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_one();
+    }
+}
+
+void DbConnectionPool::recordAcquire(std::chrono::steady_clock::time_point start) {
+    auto waitUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    acquireCount_++;
+    acquireWaitTotalUs_ += waitUs;
+
+    uint64_t prevMax = acquireWaitMaxUs_.load();
+    while (waitUs > prevMax && !acquireWaitMaxUs_.compare_exchange_weak(prevMax, waitUs)) {
+    }
+}
+
+void DbConnectionPool::reaperLoop() {
+    spdlog::info("DbConnectionPool reaper started (interval={}s)", idleValidationInterval_.count());
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            reaperCv_.wait_for(lock, idleValidationInterval_, [this] { return shutdown_.load(); });
+            if (shutdown_) break;
+        }
+
+        // Collect connections that have been idle for a full interval
+        auto cutoff = std::chrono::steady_clock::now() - idleValidationInterval_;
+        std::vector<PGconn*> stale;
+        for (size_t i = 0; i < shardCount_; ++i) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            auto& conns = shards_[i].connections;
+            auto it = std::partition(conns.begin(), conns.end(),
+                [&cutoff](const IdleConnection& c) { return c.idleSince > cutoff; });
+            for (auto s = it; s != conns.end(); ++s) {
+                stale.push_back(s->conn);
+            }
+            availableCount_ -= static_cast<size_t>(std::distance(it, conns.end()));
+            conns.erase(it, conns.end());
+        }
+
+        // Validate outside the shard locks so acquirers are never blocked on I/O
+        size_t dropped = 0;
+        for (PGconn* conn : stale) {
+            if (isConnectionHealthy(conn)) {
+                pushIdle(conn);
+            } else {
+                discardConnection(conn);
+                dropped++;
+            }
+        }
+
+        // Top up to minSize after dropping dead connections
+        while (!shutdown_ && totalConnections_ < minSize_ && reserveSlot()) {
+            PGconn* conn = createConnection();
+            if (!conn) {
+                totalConnections_--;
+                break;
+            }
+            pushIdle(conn);
+        }
+
+        if (!stale.empty()) {
+            spdlog::debug("DbConnectionPool reaper: validated {} idle connections, dropped {}",
+                          stale.size(), dropped);
+        }
     }
 
-    // Notify one waiting thread
-    cv_.notify_one();
+    spdlog::info("DbConnectionPool reaper stopped");
 }
 
 } // namespace common
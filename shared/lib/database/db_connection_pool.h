@@ -9,6 +9,8 @@
  * - Automatic connection health checking
  * - Connection recycling
  * - Thread-safe acquire/release
+ * - Optional fast path (v2.42.0): sharded free list, no per-acquire SELECT 1,
+ *   idle connections validated by a background reaper thread
  *
  * @author SMARTCORE Inc.
  * @date 2026-02-02
@@ -19,12 +21,13 @@
 #include "db_connection_interface.h"
 #include <libpq-fe.h>
 #include <string>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <memory>
 #include <chrono>
 #include <atomic>
+#include <thread>
+#include <vector>
 
 namespace common {
 
@@ -107,17 +110,45 @@ public:
  */
 class DbConnectionPool : public IDbConnectionPool {
 private:
+    /// Idle connection with the time it was returned to the pool
+    struct IdleConnection {
+        PGconn* conn;
+        std::chrono::steady_clock::time_point idleSince;
+    };
+
+    /// One slice of the free list; threads hash to a home shard and steal from others
+    struct alignas(64) FreeListShard {
+        std::mutex mutex;
+        std::vector<IdleConnection> connections;
+    };
+
     std::string connString_;
     size_t minSize_;
     size_t maxSize_;
     std::chrono::seconds acquireTimeout_;
+    std::chrono::seconds idleValidationInterval_;  ///< 0 = legacy mode (health check on every acquire/release)
+    size_t statementCacheSize_;                    ///< Prepared statements per connection (0 = disabled)
 
-    std::queue<PGconn*> availableConnections_;
+    std::unique_ptr<FreeListShard[]> shards_;
+    size_t shardCount_;
+    std::atomic<size_t> availableCount_;
     std::atomic<size_t> totalConnections_;
-    mutable std::mutex mutex_;  // mutable to allow locking in const methods
+    std::atomic<size_t> waiters_;
+    mutable std::mutex mutex_;  // Guards cv_ waits only (slow path)
     std::condition_variable cv_;
 
-    bool shutdown_;
+    std::atomic<bool> shutdown_;
+    std::thread reaperThread_;
+    std::condition_variable reaperCv_;
+
+    // Counters exported via getStats()
+    std::atomic<uint64_t> acquireCount_{0};
+    std::atomic<uint64_t> acquireWaitTotalUs_{0};
+    std::atomic<uint64_t> acquireWaitMaxUs_{0};
+    std::atomic<uint64_t> healthCheckCount_{0};
+    std::atomic<uint64_t> discardedConnections_{0};
+    std::atomic<uint64_t> statementPrepares_{0};
+    std::atomic<uint64_t> statementExecutes_{0};
 
     friend class DbConnection;
 
@@ -128,18 +159,31 @@ public:
      * @param minSize Minimum number of connections to maintain
      * @param maxSize Maximum number of connections allowed
      * @param acquireTimeoutSec Timeout for acquiring connection (seconds)
+     * @param idleValidationSec Background validation interval for idle connections (seconds).
+     *        0 keeps the legacy behaviour (SELECT 1 on every acquire and release);
+     *        > 0 enables the fast path where acquire/release never touch the network
+     *        and broken connections are detected from libpq status after real queries.
+     * @param statementCacheSize Server-side prepared statements cached per connection
+     *        by PostgreSQLQueryExecutor (0 disables the cache)
+     * @param shardCount Free list shards (0 = one per core, capped at maxSize)
      */
     explicit DbConnectionPool(
         const std::string& connString,
         size_t minSize = 2,
         size_t maxSize = 10,
-        int acquireTimeoutSec = 5
+        int acquireTimeoutSec = 5,
+        int idleValidationSec = 0,
+        size_t statementCacheSize = 256,
+        size_t shardCount = 0
     );
 
     /**
      * @brief Destructor - closes all connections
+     *
+     * Subclasses that override closeConnection() must call shutdown() in
+     * their own destructor (virtual calls do not reach them from here).
      */
-    ~DbConnectionPool();
+    ~DbConnectionPool() override;
 
     // Delete copy constructor and assignment
     DbConnectionPool(const DbConnectionPool&) = delete;
@@ -180,21 +224,75 @@ public:
         return "postgres";
     }
 
-private:
+    /**
+     * @brief Prepared statements cached per connection (0 = cache disabled)
+     */
+    size_t statementCacheSize() const { return statementCacheSize_; }
+
+    /**
+     * @brief Record one statement executed through the prepared statement cache
+     * @param prepared true if the execution had to PQprepare first
+     */
+    void recordStatementExecution(bool prepared) {
+        statementExecutes_.fetch_add(1, std::memory_order_relaxed);
+        if (prepared) statementPrepares_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of free list shards
+     */
+    size_t shardCount() const { return shardCount_; }
+
+protected:
+    /// @name Connection lifecycle (virtual so tests can run without a server)
+
     /**
      * @brief Create new PostgreSQL connection
      */
-    PGconn* createConnection();
+    virtual PGconn* createConnection();
 
     /**
-     * @brief Check if connection is healthy
+     * @brief Close a connection (PQfinish)
      */
-    bool isConnectionHealthy(PGconn* conn);
+    virtual void closeConnection(PGconn* conn);
 
+    /**
+     * @brief Check if connection is healthy (SELECT 1 round trip)
+     */
+    virtual bool isConnectionHealthy(PGconn* conn);
+
+    /**
+     * @brief Fast path release check from libpq state only (no round trip)
+     *
+     * CONNECTION_BAD means the socket is gone; a connection still inside a
+     * (possibly aborted) transaction must not leak into the next caller.
+     */
+    virtual bool isReusableAfterUse(PGconn* conn);
+
+    /**
+     * @brief Free list shard of the calling thread (hash of the thread id)
+     */
+    virtual size_t homeShard() const;
+
+private:
     /**
      * @brief Return connection to pool (called by DbConnection)
      */
     void releaseConnection(PGconn* conn);
+
+    /// @name Free list helpers (v2.42.0)
+    bool popIdle(PGconn*& conn);
+    void pushIdle(PGconn* conn);
+    bool reserveSlot();
+    void discardConnection(PGconn* conn);
+    void notifyWaiter();
+    void recordAcquire(std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Background loop: validate connections idle longer than the
+     *        validation interval and top the pool back up to minSize
+     */
+    void reaperLoop();
 };
 
 } // namespace common
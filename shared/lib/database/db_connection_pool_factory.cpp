@@ -49,6 +49,8 @@ DbPoolConfig DbPoolConfig::fromEnvironment() {
     if (auto* v = std::getenv("DB_POOL_MIN")) config.minSize = std::stoul(v);
     if (auto* v = std::getenv("DB_POOL_MAX")) config.maxSize = std::stoul(v);
     if (auto* v = std::getenv("DB_POOL_TIMEOUT")) config.acquireTimeoutSec = std::stoi(v);
+    if (auto* v = std::getenv("DB_POOL_IDLE_VALIDATION_SEC")) config.idleValidationSec = std::stoi(v);
+    if (auto* v = std::getenv("DB_STATEMENT_CACHE_SIZE")) config.statementCacheSize = std::stoul(v);
 
     // PostgreSQL settings
     const char* pgHost = std::getenv("DB_HOST");
@@ -96,7 +98,9 @@ std::shared_ptr<IDbConnectionPool> DbConnectionPoolFactory::create(const DbPoolC
             connStr,
             config.minSize,
             config.maxSize,
-            config.acquireTimeoutSec
+            config.acquireTimeoutSec,
+            config.idleValidationSec,
+            config.statementCacheSize
         );
     }
 #ifdef ENABLE_ORACLE
@@ -28,6 +28,8 @@ struct DbPoolConfig {
     size_t minSize = 2;
     size_t maxSize = 10;
     int acquireTimeoutSec = 5;
+    int idleValidationSec = 0;    // > 0 enables background idle validation (PostgreSQL fast path)
+    size_t statementCacheSize = 256;  // Prepared statements cached per PostgreSQL connection (0 = disabled)
 
     // PostgreSQL settings
     std::string pgHost;
@@ -59,6 +61,8 @@ struct DbPoolConfig {
      * Reads:
      * - DB_TYPE (postgres/oracle)
      * - DB_POOL_MIN, DB_POOL_MAX, DB_POOL_TIMEOUT (connection pool size)
+     * - DB_POOL_IDLE_VALIDATION_SEC (0 = health check per acquire, > 0 = background reaper)
+     * - DB_STATEMENT_CACHE_SIZE (prepared statements per PostgreSQL connection, 0 = disabled)
      * - DB_HOST, DB_PORT, DB_NAME, DB_USER, DB_PASSWORD (PostgreSQL)
      * - ORACLE_HOST, ORACLE_PORT, ORACLE_SERVICE_NAME, ORACLE_USER, ORACLE_PASSWORD (Oracle)
      */
@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory>
 #include <json/json.h>
+#include "row_cursor.h"
 
 /**
  * @file i_query_executor.h
@@ -86,6 +87,83 @@ public:
         const std::vector<std::string>& params = {}
     ) = 0;
 
+    /**
+     * @brief Execute SELECT query and stream rows through a typed cursor
+     *
+     * Zero-JSON alternative to executeQuery() for bulk reads: binary columns
+     * are returned as raw bytes and no per-row Json::Value is built. The
+     * cursor (and any views obtained from it) is only valid inside consumer.
+     *
+     * Default implementation wraps executeQuery() in a JsonRowCursor, so
+     * executors without a native implementation return the same values.
+     *
+     * @param query SQL query string (same placeholder rules as executeQuery)
+     * @param params Query parameters
+     * @param consumer Called once with the cursor positioned before the first row
+     *
+     * @throws std::runtime_error on query execution failure
+     */
+    virtual void executeQueryRows(
+        const std::string& query,
+        const std::vector<std::string>& params,
+        const RowConsumer& consumer
+    );
+
+    /**
+     * @brief Execute SELECT query and fetch rows incrementally
+     *
+     * Same contract as executeQueryRows(), but backends that support it read
+     * the result in chunks of fetchRows so memory stays bounded for result
+     * sets of any size (bulk exports). The connection is held for the whole
+     * consumer call; views stay valid until the next call to next().
+     *
+     * Default implementation calls executeQueryRows().
+     *
+     * @param query SQL query string (same placeholder rules as executeQuery)
+     * @param params Query parameters
+     * @param consumer Called once with the cursor positioned before the first row
+     * @param fetchRows Rows per server round trip
+     *
+     * @throws std::runtime_error on query execution failure
+     */
+    virtual void executeQueryStream(
+        const std::string& query,
+        const std::vector<std::string>& params,
+        const RowConsumer& consumer,
+        size_t fetchRows = 500
+    );
+
+    /**
+     * @brief Execute one INSERT/UPDATE/DELETE for each parameter row
+     *
+     * Bulk counterpart of executeCommand() that sends the rows in as few round
+     * trips as the backend allows:
+     * - PostgreSQL: single-tuple INSERT ... VALUES is rewritten to multi-row VALUES
+     * - Oracle: OCI array bind (one execute per chunk of rows)
+     *
+     * Uses the pinned batch connection/session when batch mode is active.
+     * Any failing row fails the whole call and, outside batch mode, leaves no
+     * row applied; in batch mode wrap the call in a savepoint (BulkWriter does
+     * both and retries per row). Default implementation calls executeCommand()
+     * once per row and is not atomic.
+     *
+     * @param query SQL command (same placeholder rules as executeCommand)
+     * @param paramRows One parameter vector per row, all of the same length
+     * @return Total number of affected rows
+     *
+     * @throws std::runtime_error on execution failure
+     */
+    virtual int executeBatch(
+        const std::string& query,
+        const std::vector<std::vector<std::string>>& paramRows
+    ) {
+        int affected = 0;
+        for (const auto& params : paramRows) {
+            affected += executeCommand(query, params);
+        }
+        return affected;
+    }
+
     /**
      * @brief Get database type (for diagnostic purposes)
      * @return "postgres" or "oracle"
@@ -100,6 +178,9 @@ public:
      * - PostgreSQL: Starting a transaction (BEGIN), pinning a connection
      *
      * Call endBatch() when done. Safe to call multiple times (for mid-batch commits).
+     * Batch mode belongs to the calling thread: statements from other threads
+     * sharing this executor (e.g. the audit sink flusher) keep using pooled
+     * connections in autocommit, and their savepoint/endBatch calls are no-ops.
      * Default implementation is empty (backward compatible).
      */
     virtual void beginBatch() {}
@@ -122,7 +203,10 @@ public:
      * enters "aborted" state and all subsequent queries fail. SAVEPOINT allows
      * rolling back to a clean state without losing the entire batch.
      *
-     * Oracle: No-op (Oracle transactions don't abort on individual statement failure).
+     * Oracle: SAVEPOINT on the pinned batch session. Oracle transactions don't
+     * abort on a failed statement, but a failed array execute keeps the rows
+     * before the failing one, so BulkWriter needs the rollback.
+     * Outside batch mode (both backends) statements autocommit and this is a no-op.
      *
      * @param name Savepoint name (e.g., "sp_entry")
      */
@@ -132,7 +216,7 @@ public:
      * @brief Rollback to a previously created savepoint
      *
      * PostgreSQL: Restores transaction to clean state after a query failure.
-     * Oracle: No-op.
+     * Oracle: Discards the work done since the savepoint on the pinned session.
      *
      * @param name Savepoint name to rollback to
      */
@@ -7,26 +7,306 @@
 
 #include <spdlog/spdlog.h>
 #include <stdexcept>
-#include <regex>
 #include <sstream>
 #include <algorithm>
 #include <cctype>
-
-// Pre-compiled regex patterns for PostgreSQL→Oracle query transformation
-// Compiled once at static init instead of per-query (~150K compilations eliminated during bulk upload)
-static const std::regex s_pgPlaceholder(R"(\$(\d+))");
-static const std::regex s_nullifInteger(R"(NULLIF\(([^,]+),\s*''\s*\)::INTEGER)", std::regex::icase);
-static const std::regex s_limitOffset(R"(\s+LIMIT\s+(\d+|:\d+)\s+OFFSET\s+(\d+|:\d+)\s*$)", std::regex::icase);
-static const std::regex s_limitOnly(R"(\s+LIMIT\s+(\d+|:\d+)\s*$)", std::regex::icase);
-static const std::regex s_returningClause(R"(\s+RETURNING\s+\w+(\s+INTO\s+:\d+)?\s*$)", std::regex::icase);
-// DML command additional patterns (used in executeCommand)
-static const std::regex s_nowFunc(R"(NOW\(\))", std::regex::icase);
-static const std::regex s_currentTimestamp(R"(CURRENT_TIMESTAMP)", std::regex::icase);
-static const std::regex s_typecast(R"(::[a-zA-Z_][a-zA-Z0-9_]*)", std::regex::icase);
-static const std::regex s_onConflict(R"(\s+ON\s+CONFLICT\s*\([^)]*\)\s+DO\s+(NOTHING|UPDATE\s+SET\s+.*)$)", std::regex::icase);
+#include <cstring>
 
 namespace common {
 
+namespace {
+
+/// Upper bound on rows per OCIStmtFetch2 round trip (array fetch)
+constexpr ub4 kFetchRows = 256;
+/// Upper bound on define buffer memory per cursor; wide rows get fewer rows per fetch
+constexpr size_t kFetchBufferBytes = 4 * 1024 * 1024;
+/// LOB bytes shipped inline with each fetched row. Certificates and most CRLs
+/// fit, so their LOB reads need no extra round trip. Master lists and large
+/// CRLs (typically hundreds of KB) do not and read the remainder from the
+/// server; raising this would grow every array fetch by up to that much per row.
+constexpr ub4 kLobPrefetchBytes = 64 * 1024;
+
+/// SQLT_STR buffer width (including terminator) for a non-LOB column
+size_t textColumnWidth(OCIParam* param, ub2 type, OCIError* err) {
+    switch (type) {
+        case SQLT_NUM: case SQLT_INT: case SQLT_FLT: case SQLT_BFLOAT: case SQLT_BDOUBLE:
+        case SQLT_IBFLOAT: case SQLT_IBDOUBLE: case SQLT_DAT: case SQLT_DATE:
+        case SQLT_TIMESTAMP: case SQLT_TIMESTAMP_TZ: case SQLT_TIMESTAMP_LTZ:
+        case SQLT_INTERVAL_YM: case SQLT_INTERVAL_DS:
+            return 128;
+        case SQLT_CHR: case SQLT_AFC: case SQLT_VCS: case SQLT_AVC: {
+            ub2 dataSize = 0;
+            OCIAttrGet(param, OCI_DTYPE_PARAM, &dataSize, nullptr, OCI_ATTR_DATA_SIZE, err);
+            if (dataSize == 0) return 4001;
+            // Allow for client charset expansion, capped at the VARCHAR2 limit
+            return std::min<size_t>(static_cast<size_t>(dataSize) * 4, 4000) + 1;
+        }
+        default:
+            return 4001;
+    }
+}
+
+/// Set OCI_ATTR_PREFETCH_ROWS before OCIStmtExecute so the execute round trip
+/// already carries the first batch of rows.
+void setRowPrefetch(OCIStmt* stmt, OCIError* err) {
+    ub4 prefetchRows = kFetchRows;
+    OCIAttrSet(stmt, OCI_HTYPE_STMT, &prefetchRows, 0, OCI_ATTR_PREFETCH_ROWS, err);
+}
+
+/**
+ * @brief RowCursor over an executed OCI SELECT statement
+ *
+ * Columns are defined as arrays and fetched up to kFetchRows rows per
+ * OCIStmtFetch2 call. Non-LOB columns use SQLT_STR buffers sized from the
+ * column metadata; BLOB/CLOB columns use one locator per array slot with LOB
+ * prefetch enabled, and are read in a single OCI_ONE_PIECE call per row
+ * (served from the prefetched data when the LOB fits in kLobPrefetchBytes).
+ *
+ * A cursor that is destroyed before the result set is exhausted cancels it,
+ * so the session goes back to the pool with no operation in flight.
+ */
+class OciRowCursor : public RowCursor {
+public:
+    OciRowCursor(OCIEnv* env, OCIStmt* stmt, OCISvcCtx* svcCtx, OCIError* err)
+        : stmt_(stmt), svcCtx_(svcCtx), err_(err)
+    {
+        ub4 colCount = 0;
+        OCIAttrGet(stmt_, OCI_HTYPE_STMT, &colCount, nullptr, OCI_ATTR_PARAM_COUNT, err_);
+        columns_.resize(colCount);
+
+        std::vector<OCIParam*> params(colCount, nullptr);
+        size_t rowBytes = 0;
+        for (ub4 i = 0; i < colCount; ++i) {
+            Column& column = columns_[i];
+            OCIParamGet(stmt_, OCI_HTYPE_STMT, err_, reinterpret_cast<void**>(&params[i]), i + 1);
+
+            OraText* colName = nullptr;
+            ub4 colNameLen = 0;
+            OCIAttrGet(params[i], OCI_DTYPE_PARAM, &colName, &colNameLen, OCI_ATTR_NAME, err_);
+            column.name.assign(reinterpret_cast<char*>(colName), colNameLen);
+            OCIAttrGet(params[i], OCI_DTYPE_PARAM, &column.type, nullptr, OCI_ATTR_DATA_TYPE, err_);
+
+            column.isLob = (column.type == SQLT_BLOB || column.type == SQLT_CLOB);
+            column.width = column.isLob ? sizeof(OCILobLocator*)
+                                        : textColumnWidth(params[i], column.type, err_);
+            rowBytes += column.width + sizeof(sb2);
+        }
+
+        fetchRows_ = static_cast<ub4>(std::clamp<size_t>(
+            kFetchBufferBytes / std::max<size_t>(rowBytes, 1), 1, kFetchRows));
+
+        for (ub4 i = 0; i < colCount; ++i) {
+            Column& column = columns_[i];
+            column.indicators.assign(fetchRows_, 0);
+
+            OCIDefine* def = nullptr;
+            sword status;
+            if (column.isLob) {
+                column.lobs.assign(fetchRows_, nullptr);
+                for (OCILobLocator*& lob : column.lobs) {
+                    if (OCIDescriptorAlloc(env, reinterpret_cast<void**>(&lob), OCI_DTYPE_LOB, 0, nullptr) != OCI_SUCCESS) {
+                        lob = nullptr;
+                        freeLobs();
+                        throw std::runtime_error("Failed to allocate OCI LOB locator");
+                    }
+                }
+                status = OCIDefineByPos(stmt_, &def, err_, i + 1,
+                                        column.lobs.data(), sizeof(OCILobLocator*), column.type,
+                                        column.indicators.data(), nullptr, nullptr, OCI_DEFAULT);
+                if (status == OCI_SUCCESS) {
+                    ub4 prefetchSize = kLobPrefetchBytes;
+                    boolean prefetchLength = TRUE;
+                    OCIAttrSet(def, OCI_HTYPE_DEFINE, &prefetchSize, 0, OCI_ATTR_LOBPREFETCH_SIZE, err_);
+                    OCIAttrSet(def, OCI_HTYPE_DEFINE, &prefetchLength, 0, OCI_ATTR_LOBPREFETCH_LENGTH, err_);
+                }
+            } else {
+                column.text.assign(column.width * fetchRows_, '\0');
+                status = OCIDefineByPos(stmt_, &def, err_, i + 1,
+                                        column.text.data(), static_cast<sb4>(column.width), SQLT_STR,
+                                        column.indicators.data(), nullptr, nullptr, OCI_DEFAULT);
+            }
+            if (status != OCI_SUCCESS) {
+                freeLobs();
+                throw std::runtime_error("Failed to define OCI column " + std::to_string(i + 1));
+            }
+        }
+    }
+
+    ~OciRowCursor() override {
+        // Cancel an unfinished result set (fetch of 0 rows closes the cursor)
+        if (!exhausted_) {
+            OCIStmtFetch2(stmt_, err_, 0, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
+        }
+        freeLobs();
+    }
+
+    OciRowCursor(const OciRowCursor&) = delete;
+    OciRowCursor& operator=(const OciRowCursor&) = delete;
+
+    bool next() override {
+        if (row_ + 1 < rowsInBatch_) {
+            ++row_;
+        } else {
+            if (exhausted_) {
+                rowsInBatch_ = 0;
+                return false;
+            }
+            fetchBatch();
+            if (rowsInBatch_ == 0) return false;
+        }
+
+        for (Column& column : columns_) {
+            if (!column.isLob) continue;
+            column.lobData.clear();
+            if (column.indicators[row_] != -1) {
+                readLob(column);
+            }
+        }
+        return true;
+    }
+
+    int columnIndex(std::string_view name) override {
+        for (size_t i = 0; i < columns_.size(); ++i) {
+            const std::string& colName = columns_[i].name;
+            if (colName.size() == name.size() &&
+                std::equal(colName.begin(), colName.end(), name.begin(), [](char a, char b) {
+                    return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                })) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    bool isNull(int col) const override {
+        return col < 0 || static_cast<size_t>(col) >= columns_.size() || rowsInBatch_ == 0 ||
+               columns_[col].indicators[row_] == -1;
+    }
+
+    std::string_view getStringView(int col) const override {
+        if (isNull(col)) return {};
+        const Column& column = columns_[col];
+        if (column.isLob) {
+            return std::string_view(reinterpret_cast<const char*>(column.lobData.data()), column.lobData.size());
+        }
+        return std::string_view(column.text.data() + row_ * column.width);
+    }
+
+    int64_t getInt(int col, int64_t defaultValue = 0) const override {
+        std::string_view text = getStringView(col);
+        if (text.empty()) return defaultValue;
+        std::string value(text);
+        char* end = nullptr;
+        long long parsed = std::strtoll(value.c_str(), &end, 10);
+        return (end != value.c_str()) ? static_cast<int64_t>(parsed) : defaultValue;
+    }
+
+    bool getBool(int col, bool defaultValue = false) const override {
+        if (isNull(col)) return defaultValue;
+        std::string_view text = getStringView(col);
+        return text == "1" || text == "t" || text == "true" || text == "TRUE";
+    }
+
+    ByteSpan getBytes(int col) const override {
+        std::string_view value = getStringView(col);
+        return ByteSpan{reinterpret_cast<const uint8_t*>(value.data()), value.size()};
+    }
+
+    size_t columnCount() const { return columns_.size(); }
+    const std::string& columnName(size_t col) const { return columns_[col].name; }
+    ub2 columnType(size_t col) const { return columns_[col].type; }
+
+private:
+    struct Column {
+        std::string name;
+        ub2 type = 0;
+        bool isLob = false;
+        size_t width = 0;                   ///< Bytes per array slot
+        std::vector<sb2> indicators;        ///< One per array slot
+        std::string text;                   ///< SQLT_STR array buffer (width × fetchRows_)
+        std::vector<OCILobLocator*> lobs;   ///< BLOB/CLOB locators, one per array slot
+        std::vector<uint8_t> lobData;       ///< Current row's LOB content
+    };
+
+    void fetchBatch() {
+        row_ = 0;
+        rowsInBatch_ = 0;
+
+        sword status = OCIStmtFetch2(stmt_, err_, fetchRows_, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
+        if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO && status != OCI_NO_DATA) {
+            exhausted_ = true;
+            char errbuf[512] = {0};
+            sb4 errcode = 0;
+            OCIErrorGet(err_, 1, nullptr, &errcode, reinterpret_cast<OraText*>(errbuf), sizeof(errbuf), OCI_HTYPE_ERROR);
+            throw std::runtime_error(std::string("OCI fetch failed (code ") + std::to_string(errcode) + "): " + errbuf);
+        }
+
+        // OCI_NO_DATA still delivers a final partial batch
+        ub4 fetched = 0;
+        OCIAttrGet(stmt_, OCI_HTYPE_STMT, &fetched, nullptr, OCI_ATTR_ROWS_FETCHED, err_);
+        rowsInBatch_ = fetched;
+        exhausted_ = (status == OCI_NO_DATA) || fetched < fetchRows_;
+    }
+
+    void readLob(Column& column) {
+        OCILobLocator* lob = column.lobs[row_];
+        oraub8 lobLen = 0;
+        if (OCILobGetLength2(svcCtx_, err_, lob, &lobLen) != OCI_SUCCESS) {
+            throw std::runtime_error("OCI LOB length failed for column " + column.name);
+        }
+        if (lobLen == 0) return;
+
+        // CLOB length is in characters; allow up to 4 bytes per character (AL32UTF8).
+        // The buffer always holds the whole LOB, so OCI_ONE_PIECE never returns
+        // OCI_NEED_DATA and no LOB operation is left open on the session.
+        oraub8 bufLen = (column.type == SQLT_CLOB) ? lobLen * 4 : lobLen;
+        column.lobData.resize(static_cast<size_t>(bufLen));
+
+        oraub8 byteAmt = (column.type == SQLT_BLOB) ? lobLen : 0;
+        oraub8 charAmt = (column.type == SQLT_CLOB) ? lobLen : 0;
+        sword status = OCILobRead2(svcCtx_, err_, lob, &byteAmt, &charAmt, 1,
+                                   column.lobData.data(), bufLen, OCI_ONE_PIECE,
+                                   nullptr, nullptr, 0, SQLCS_IMPLICIT);
+        if (status != OCI_SUCCESS) {
+            throw std::runtime_error("OCI LOB read failed for column " + column.name);
+        }
+        column.lobData.resize(static_cast<size_t>(byteAmt));
+    }
+
+    void freeLobs() {
+        for (Column& column : columns_) {
+            for (OCILobLocator*& lob : column.lobs) {
+                if (lob) OCIDescriptorFree(lob, OCI_DTYPE_LOB);
+                lob = nullptr;
+            }
+        }
+    }
+
+    OCIStmt* stmt_;
+    OCISvcCtx* svcCtx_;
+    OCIError* err_;
+    std::vector<Column> columns_;
+    ub4 fetchRows_ = 1;
+    ub4 rowsInBatch_ = 0;
+    ub4 row_ = 0;
+    bool exhausted_ = false;
+};
+
+/// PostgreSQL bytea hex text (\x...) for the Json::Value result contract
+std::string toByteaHex(ByteSpan bytes) {
+    static const char hexChars[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(2 + bytes.size() * 2);
+    hex += "\\x";
+    for (uint8_t byte : bytes) {
+        hex += hexChars[byte >> 4];
+        hex += hexChars[byte & 0x0f];
+    }
+    return hex;
+}
+
+} // anonymous namespace
+
 // --- Constructor & Destructor ---
 
 OracleQueryExecutor::OracleQueryExecutor(OracleConnectionPool* pool)
@@ -89,31 +369,19 @@ Json::Value OracleQueryExecutor::executeQuery(
     spdlog::debug("[OracleQueryExecutor] Executing SELECT query via session pool");
 
     PooledSession session;
-    std::vector<char*> colBuffers;       // Declared outside try for cleanup in catch
-    std::vector<OCILobLocator*> lobLocators;  // Declared outside try for cleanup in catch
+    OCIStmt* stmt = nullptr;             // Declared outside try for cleanup in catch
 
     try {
         // Acquire pre-authenticated session from pool (1 round-trip vs 8-10)
         session = acquirePooledSession();
 
-        // Convert PostgreSQL placeholders to OCI positional binding format
-        // Uses pre-compiled static regex patterns (see file top) for performance
-        std::string oracleQuery = query;
-        oracleQuery = std::regex_replace(oracleQuery, s_pgPlaceholder, ":$1");
-
-        // Convert PostgreSQL-specific NULLIF()::INTEGER to Oracle CASE expression
-        oracleQuery = std::regex_replace(oracleQuery, s_nullifInteger, "CASE WHEN $1 IS NULL OR $1 = '' THEN NULL ELSE TO_NUMBER($1) END");
-
-        // Convert LIMIT/OFFSET syntax (handles both literal numbers and :N bind variables)
-        oracleQuery = std::regex_replace(oracleQuery, s_limitOffset, " OFFSET $2 ROWS FETCH NEXT $1 ROWS ONLY");
-        oracleQuery = std::regex_replace(oracleQuery, s_limitOnly, " FETCH FIRST $1 ROWS ONLY");
+        auto translation = toOracleSelect(query);
+        const std::string& oracleQuery = translation->sql;
 
-        // Handle DML with RETURNING clause
-        bool isDmlReturning = false;
-        if (std::regex_search(oracleQuery, s_returningClause)) {
-            isDmlReturning = true;
-            oracleQuery = std::regex_replace(oracleQuery, s_returningClause, "");
-            spdlog::info("[OracleQueryExecutor] Stripped RETURNING clause for Oracle DML");
+        // Handle DML with RETURNING clause (stripped during translation)
+        bool isDmlReturning = translation->returningStripped;
+        if (isDmlReturning) {
+            spdlog::debug("[OracleQueryExecutor] Stripped RETURNING clause for Oracle DML");
         }
 
         // Log full query for debugging (split into chunks if too long)
@@ -128,10 +396,10 @@ Json::Value OracleQueryExecutor::executeQuery(
         }
 
         // Allocate statement handle from pool environment
-        OCIStmt* stmt = nullptr;
         sword status = OCIHandleAlloc(poolEnv_, reinterpret_cast<void**>(&stmt),
                                       OCI_HTYPE_STMT, 0, nullptr);
         if (status != OCI_SUCCESS) {
+            stmt = nullptr;
             throw std::runtime_error("Failed to allocate OCI statement handle");
         }
 
@@ -140,90 +408,21 @@ Json::Value OracleQueryExecutor::executeQuery(
                                reinterpret_cast<const OraText*>(oracleQuery.c_str()),
                                oracleQuery.length(), OCI_NTV_SYNTAX, OCI_DEFAULT);
         if (status != OCI_SUCCESS) {
-            OCIHandleFree(stmt, OCI_HTYPE_STMT);
             throw std::runtime_error("Failed to prepare OCI statement");
         }
 
         // Bind parameters using OCIBindByName (handles duplicate named binds correctly)
-        // RAII: paramStringBuffers and binaryBuffers own the memory; no manual delete needed
-        std::vector<std::string> paramStringBuffers;
-        std::vector<std::vector<uint8_t>> binaryBuffers;
-        std::vector<std::string> bindNames;
-        paramStringBuffers.reserve(params.size());
-        binaryBuffers.reserve(params.size());
-        bindNames.reserve(params.size());
-
-        for (size_t i = 0; i < params.size(); ++i) {
-            OCIBind* bind = nullptr;
-
-            bindNames.push_back(":" + std::to_string(i + 1));
-            const std::string& bindName = bindNames.back();
-
-            // Detect PostgreSQL bytea hex format (\\x...) for BLOB columns
-            bool isBinary = false;
-            size_t hexStart = 0;
-            if (params[i].size() > 3 && params[i][0] == '\\' && params[i][1] == '\\' && params[i][2] == 'x') {
-                isBinary = true;
-                hexStart = 3;
-            } else if (params[i].size() > 2 && params[i][0] == '\\' && params[i][1] == 'x') {
-                isBinary = true;
-                hexStart = 2;
-            }
-
-            if (isBinary) {
-                std::vector<uint8_t> rawBytes;
-                rawBytes.reserve((params[i].size() - hexStart) / 2);
-                for (size_t j = hexStart; j + 1 < params[i].size(); j += 2) {
-                    char hex[3] = { params[i][j], params[i][j + 1], '\0' };
-                    rawBytes.push_back(static_cast<uint8_t>(strtol(hex, nullptr, 16)));
-                }
-
-                binaryBuffers.push_back(std::move(rawBytes));
-                auto& buf = binaryBuffers.back();
-
-                spdlog::debug("[OracleQueryExecutor] Param {} ({}) bound as BLOB ({} bytes)",
-                             i + 1, bindName, buf.size());
-
-                status = OCIBindByName(stmt, &bind, session.err,
-                                      reinterpret_cast<const OraText*>(bindName.c_str()),
-                                      static_cast<sb4>(bindName.length()),
-                                      buf.data(), static_cast<sb4>(buf.size()),
-                                      SQLT_LBI, nullptr, nullptr, nullptr,
-                                      0, nullptr, OCI_DEFAULT);
-            } else {
-                paramStringBuffers.push_back(params[i]);
-                std::string& strBuf = paramStringBuffers.back();
-
-                status = OCIBindByName(stmt, &bind, session.err,
-                                      reinterpret_cast<const OraText*>(bindName.c_str()),
-                                      static_cast<sb4>(bindName.length()),
-                                      strBuf.data(), static_cast<sb4>(strBuf.size() + 1),
-                                      SQLT_STR, nullptr, nullptr, nullptr,
-                                      0, nullptr, OCI_DEFAULT);
-            }
-
-            if (status != OCI_SUCCESS) {
-                OCIHandleFree(stmt, OCI_HTYPE_STMT);
-                throw std::runtime_error("Failed to bind parameter " + std::to_string(i + 1));
-            }
-        }
+        // RAII: bindBuffers owns the memory; no manual delete needed
+        BindBuffers bindBuffers;
+        bindParams(stmt, session.err, params, bindBuffers, translation.get());
 
         // Execute statement
         // DML (INSERT/UPDATE/DELETE/MERGE) requires iters=1; SELECT uses iters=0
-        bool isDml = false;
-        {
-            // Find first non-whitespace keyword
-            size_t pos = oracleQuery.find_first_not_of(" \t\n\r");
-            if (pos != std::string::npos) {
-                std::string prefix = oracleQuery.substr(pos, 6);
-                for (auto& c : prefix) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
-                isDml = (prefix.substr(0,6) == "INSERT" || prefix.substr(0,6) == "UPDATE" ||
-                         prefix.substr(0,6) == "DELETE" || prefix.substr(0,5) == "MERGE");
-            }
-        }
+        bool isDml = translation->isDml;
         ub4 iters = (isDml || isDmlReturning) ? 1 : 0;
-        // DML: auto-commit on success; SELECT: default (cursor open)
+        // DML: auto-commit on success; SELECT: default (cursor open, first rows prefetched)
         ub4 execMode = isDml ? OCI_COMMIT_ON_SUCCESS : OCI_DEFAULT;
+        if (iters == 0) setRowPrefetch(stmt, session.err);
         status = OCIStmtExecute(session.svcCtx, stmt, session.err, iters, 0,
                                nullptr, nullptr, execMode);
         if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO) {
@@ -231,8 +430,6 @@ Json::Value OracleQueryExecutor::executeQuery(
             sb4 errcode = 0;
             OCIErrorGet(session.err, 1, nullptr, &errcode,
                        reinterpret_cast<OraText*>(errbuf), sizeof(errbuf), OCI_HTYPE_ERROR);
-
-            OCIHandleFree(stmt, OCI_HTYPE_STMT);
             throw std::runtime_error(std::string("OCI statement execution failed (code ") +
                                    std::to_string(errcode) + "): " + errbuf);
         }
@@ -246,155 +443,119 @@ Json::Value OracleQueryExecutor::executeQuery(
             return Json::arrayValue;
         }
 
-        // Get column count
-        ub4 colCount = 0;
-        OCIAttrGet(stmt, OCI_HTYPE_STMT, &colCount, nullptr,
-                  OCI_ATTR_PARAM_COUNT, session.err);
-
-        // Build JSON result
+        // Build JSON result from the array-fetching cursor
         Json::Value result = Json::arrayValue;
-
-        // Define output buffers for each column (with BLOB/CLOB LOB locator support)
-        colBuffers.assign(colCount, nullptr);
-        std::vector<sb2> indicators(colCount);
-        std::vector<std::string> colNames(colCount);
-        std::vector<ub2> colTypes(colCount, 0);
-        lobLocators.assign(colCount, nullptr);
-
-        for (ub4 i = 0; i < colCount; ++i) {
-            OCIParam* col = nullptr;
-            OCIParamGet(stmt, OCI_HTYPE_STMT, session.err, reinterpret_cast<void**>(&col), i + 1);
-
-            OraText* colName = nullptr;
-            ub4 colNameLen = 0;
-            OCIAttrGet(col, OCI_DTYPE_PARAM, &colName, &colNameLen,
-                      OCI_ATTR_NAME, session.err);
-            std::string columnName(reinterpret_cast<char*>(colName), colNameLen);
+        {
+            OciRowCursor cursor(poolEnv_, stmt, session.svcCtx, session.err);
 
             // Convert Oracle's UPPERCASE column names to lowercase for consistency
-            std::transform(columnName.begin(), columnName.end(), columnName.begin(),
-                          [](unsigned char c){ return std::tolower(c); });
-            colNames[i] = columnName;
-
-            // Detect column data type for BLOB/CLOB handling
-            ub2 dataType = 0;
-            OCIAttrGet(col, OCI_DTYPE_PARAM, &dataType, nullptr,
-                      OCI_ATTR_DATA_TYPE, session.err);
-            colTypes[i] = dataType;
-
-            OCIDefine* def = nullptr;
-
-            if (dataType == SQLT_BLOB || dataType == SQLT_CLOB) {
-                // BLOB/CLOB: use LOB locator for proper large data reading
-                OCIDescriptorAlloc(poolEnv_, reinterpret_cast<void**>(&lobLocators[i]),
-                                  OCI_DTYPE_LOB, 0, nullptr);
-                OCIDefineByPos(stmt, &def, session.err, i + 1,
-                              &lobLocators[i], sizeof(OCILobLocator*),
-                              dataType,
-                              &indicators[i], nullptr, nullptr, OCI_DEFAULT);
-                spdlog::debug("[OracleQueryExecutor] Column {} ({}) defined as LOB type {}",
-                             i + 1, columnName, dataType);
-            } else {
-                // Regular columns: use string buffer
-                colBuffers[i] = new char[4001];
-                memset(colBuffers[i], 0, 4001);
-                OCIDefineByPos(stmt, &def, session.err, i + 1,
-                              colBuffers[i], 4000, SQLT_STR,
-                              &indicators[i], nullptr, nullptr, OCI_DEFAULT);
+            std::vector<std::string> colNames(cursor.columnCount());
+            for (size_t i = 0; i < colNames.size(); ++i) {
+                colNames[i] = cursor.columnName(i);
+                std::transform(colNames[i].begin(), colNames[i].end(), colNames[i].begin(),
+                              [](unsigned char c){ return std::tolower(c); });
             }
-        }
 
-        // Fetch all rows
-        while (true) {
-            status = OCIStmtFetch2(stmt, session.err, 1, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
-            if (status == OCI_NO_DATA) break;
-            if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO) break;
-
-            Json::Value row;
-            for (ub4 i = 0; i < colCount; ++i) {
-                if (indicators[i] == -1) {
-                    row[colNames[i]] = Json::nullValue;
-                } else if (colTypes[i] == SQLT_BLOB) {
-                    // Read BLOB binary data via LOB locator, convert to PostgreSQL hex format
-                    ub4 lobLen = 0;
-                    OCILobGetLength(session.svcCtx, session.err, lobLocators[i], &lobLen);
-
-                    if (lobLen > 0) {
-                        std::vector<uint8_t> lobBuf(lobLen);
-                        ub4 amtp = lobLen;
-                        OCILobRead(session.svcCtx, session.err, lobLocators[i],
-                                  &amtp, 1, lobBuf.data(), lobLen,
-                                  nullptr, nullptr, 0, SQLCS_IMPLICIT);
-
-                        // Convert to PostgreSQL bytea hex format (\x...) for parseCertificateDataFromHex()
-                        std::string hexStr = "\\x";
-                        hexStr.reserve(2 + amtp * 2);
-                        static const char hexChars[] = "0123456789abcdef";
-                        for (ub4 j = 0; j < amtp; ++j) {
-                            hexStr += hexChars[lobBuf[j] >> 4];
-                            hexStr += hexChars[lobBuf[j] & 0x0f];
-                        }
-                        row[colNames[i]] = hexStr;
-                    } else {
-                        row[colNames[i]] = "";
-                    }
-                } else if (colTypes[i] == SQLT_CLOB) {
-                    // Read CLOB text data via LOB locator
-                    ub4 lobLen = 0;
-                    OCILobGetLength(session.svcCtx, session.err, lobLocators[i], &lobLen);
-
-                    if (lobLen > 0) {
-                        std::vector<char> lobBuf(lobLen + 1, 0);
-                        ub4 amtp = lobLen;
-                        OCILobRead(session.svcCtx, session.err, lobLocators[i],
-                                  &amtp, 1, lobBuf.data(), lobLen,
-                                  nullptr, nullptr, 0, SQLCS_IMPLICIT);
-                        row[colNames[i]] = std::string(lobBuf.data(), amtp);
+            while (cursor.next()) {
+                Json::Value row;
+                for (size_t i = 0; i < colNames.size(); ++i) {
+                    int col = static_cast<int>(i);
+                    if (cursor.isNull(col)) {
+                        row[colNames[i]] = Json::nullValue;
+                    } else if (cursor.columnType(i) == SQLT_BLOB) {
+                        // PostgreSQL bytea hex format (\x...) for parseCertificateDataFromHex();
+                        // executeQueryRows() + RowCursor::getBytes() return the raw bytes
+                        ByteSpan bytes = cursor.getBytes(col);
+                        row[colNames[i]] = bytes.empty() ? std::string() : toByteaHex(bytes);
                     } else {
-                        row[colNames[i]] = "";
+                        row[colNames[i]] = std::string(cursor.getStringView(col));
                     }
-                } else {
-                    row[colNames[i]] = Json::Value(colBuffers[i]);
                 }
-            }
-            result.append(row);
-        }
-
-        // Cleanup buffers and LOB locators, track whether LOBs were used
-        bool hadLobs = false;
-        for (ub4 i = 0; i < colCount; ++i) {
-            if (colBuffers[i]) delete[] colBuffers[i];
-            if (lobLocators[i]) {
-                hadLobs = true;
-                OCIDescriptorFree(lobLocators[i], OCI_DTYPE_LOB);
+                result.append(std::move(row));
             }
         }
         OCIHandleFree(stmt, OCI_HTYPE_STMT);
 
-        // Release session back to pool. If LOB operations occurred, drop the session
-        // to prevent ORA-03127 on reuse (Oracle retains internal LOB state on the
-        // session even after locator descriptors are freed).
-        releasePooledSession(session, hadLobs);
+        // Result set fully consumed and every LOB read completed in one piece:
+        // the session is clean and goes back to the pool
+        releasePooledSession(session);
 
-        spdlog::debug("[OracleQueryExecutor] OCI query returned {} rows{}", result.size(),
-                     hadLobs ? " (session dropped after LOB)" : "");
+        spdlog::debug("[OracleQueryExecutor] OCI query returned {} rows", result.size());
         return result;
 
     } catch (const std::exception& e) {
         spdlog::error("[OracleQueryExecutor] OCI exception: {}", e.what());
-        // Cleanup allocated column buffers and LOB locators to prevent memory leak
-        for (ub4 i = 0; i < colBuffers.size(); ++i) {
-            if (colBuffers[i]) delete[] colBuffers[i];
-            if (i < lobLocators.size() && lobLocators[i]) {
-                OCIDescriptorFree(lobLocators[i], OCI_DTYPE_LOB);
-            }
-        }
+        if (stmt) OCIHandleFree(stmt, OCI_HTYPE_STMT);
         // Ensure session is released back to pool on exception (drop to be safe)
         releasePooledSession(session, true);
         throw;
     }
 }
 
+void OracleQueryExecutor::executeQueryRows(
+    const std::string& query,
+    const std::vector<std::string>& params,
+    const RowConsumer& consumer
+)
+{
+    if (!sessionPoolReady_) {
+        throw std::runtime_error("OCI session pool is not available");
+    }
+
+    spdlog::debug("[OracleQueryExecutor] Executing SELECT query via session pool (row cursor)");
+
+    auto translation = toOracleSelect(query);
+    const std::string& oracleQuery = translation->sql;
+    PooledSession session = acquirePooledSession();
+    OCIStmt* stmt = nullptr;
+
+    try {
+        sword status = OCIHandleAlloc(poolEnv_, reinterpret_cast<void**>(&stmt),
+                                      OCI_HTYPE_STMT, 0, nullptr);
+        if (status != OCI_SUCCESS) {
+            stmt = nullptr;
+            throw std::runtime_error("Failed to allocate OCI statement handle");
+        }
+
+        status = OCIStmtPrepare(stmt, session.err,
+                               reinterpret_cast<const OraText*>(oracleQuery.c_str()),
+                               oracleQuery.length(), OCI_NTV_SYNTAX, OCI_DEFAULT);
+        if (status != OCI_SUCCESS) {
+            throw std::runtime_error("Failed to prepare OCI statement");
+        }
+
+        BindBuffers bindBuffers;
+        bindParams(stmt, session.err, params, bindBuffers, translation.get());
+
+        setRowPrefetch(stmt, session.err);
+        status = OCIStmtExecute(session.svcCtx, stmt, session.err, 0, 0,
+                               nullptr, nullptr, OCI_DEFAULT);
+        if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO) {
+            char errbuf[512];
+            sb4 errcode = 0;
+            OCIErrorGet(session.err, 1, nullptr, &errcode,
+                       reinterpret_cast<OraText*>(errbuf), sizeof(errbuf), OCI_HTYPE_ERROR);
+            throw std::runtime_error(std::string("OCI statement execution failed (code ") +
+                                   std::to_string(errcode) + "): " + errbuf);
+        }
+
+        {
+            // The cursor cancels the result set on destruction if the consumer stops early
+            OciRowCursor cursor(poolEnv_, stmt, session.svcCtx, session.err);
+            consumer(cursor);
+        }
+
+        OCIHandleFree(stmt, OCI_HTYPE_STMT);
+        releasePooledSession(session);
+
+    } catch (const std::exception& e) {
+        spdlog::error("[OracleQueryExecutor] OCI exception: {}", e.what());
+        if (stmt) OCIHandleFree(stmt, OCI_HTYPE_STMT);
+        releasePooledSession(session, true);
+        throw;
+    }
+}
+
 int OracleQueryExecutor::executeCommand(
     const std::string& query,
     const std::vector<std::string>& params
@@ -405,19 +566,11 @@ int OracleQueryExecutor::executeCommand(
     }
 
     // Convert PostgreSQL syntax to Oracle syntax
-    // Uses pre-compiled static regex patterns (see file top) for performance
-    std::string oracleQuery = query;
-    oracleQuery = std::regex_replace(oracleQuery, s_pgPlaceholder, ":$1");
-    oracleQuery = std::regex_replace(oracleQuery, s_nullifInteger, "CASE WHEN $1 IS NULL OR $1 = '' THEN NULL ELSE TO_NUMBER($1) END");
-    oracleQuery = std::regex_replace(oracleQuery, s_currentTimestamp, "SYSTIMESTAMP");
-    oracleQuery = std::regex_replace(oracleQuery, s_nowFunc, "SYSDATE");
-    oracleQuery = std::regex_replace(oracleQuery, s_typecast, "");
-
-    // Handle PostgreSQL ON CONFLICT clause (not supported in Oracle)
-    oracleQuery = std::regex_replace(oracleQuery, s_onConflict, "");
+    auto translation = toOracleCommand(query);
+    const std::string& oracleQuery = translation->sql;
 
     // ── Batch mode: pinned session + cached statement + deferred commit ──
-    if (batchMode_) {
+    if (inBatchOnThisThread()) {
         try {
             // Look up cached statement or prepare new one
             OCIStmt* stmt = nullptr;
@@ -648,10 +801,314 @@ int OracleQueryExecutor::executeCommand(
     }
 }
 
+int OracleQueryExecutor::executeBatch(
+    const std::string& query,
+    const std::vector<std::vector<std::string>>& paramRows
+)
+{
+    if (paramRows.empty()) return 0;
+    if (!sessionPoolReady_) {
+        throw std::runtime_error("OCI session pool is not available");
+    }
+
+    const size_t paramCount = paramRows.front().size();
+    for (const auto& params : paramRows) {
+        if (params.size() != paramCount) {
+            throw std::invalid_argument("[OracleQueryExecutor] executeBatch: rows have different parameter counts");
+        }
+    }
+
+    // One contiguous slot array per bind position (OCI array DML).
+    // "\x"-prefixed hex columns are bound as binary, like executeCommand().
+    struct ArrayColumn {
+        bool binary = false;
+        size_t width = 1;                   ///< Bytes per slot
+        std::vector<char> data;
+        std::vector<ub4> lengths;
+        std::vector<sb2> indicators;        ///< -1 = NULL (empty string, as in executeCommand)
+    };
+    auto hexStart = [](const std::string& v) -> size_t {
+        if (v.size() > 3 && v[0] == '\\' && v[1] == '\\' && v[2] == 'x') return 3;
+        if (v.size() > 2 && v[0] == '\\' && v[1] == 'x') return 2;
+        return 0;
+    };
+
+    std::vector<ArrayColumn> columns(paramCount);
+    bool mixedTypes = false;
+    for (size_t col = 0; col < paramCount; ++col) {
+        bool hasBinary = false;
+        bool hasText = false;
+        for (const auto& params : paramRows) {
+            const std::string& v = params[col];
+            if (v.empty()) continue;
+            size_t start = hexStart(v);
+            if (start > 0) {
+                hasBinary = true;
+                columns[col].width = std::max(columns[col].width, (v.size() - start) / 2);
+            } else {
+                hasText = true;
+                columns[col].width = std::max(columns[col].width, v.size() + 1);
+            }
+        }
+        if (hasBinary && hasText) {
+            // Mixed binary/text values in one position cannot share a bind type:
+            // execute one row per iteration, still in this call's transaction
+            spdlog::debug("[OracleQueryExecutor] executeBatch: mixed bind types in :{}, one row per execute", col + 1);
+            mixedTypes = true;
+        }
+    }
+
+    // Bound slot memory per execute (large BLOB columns shrink the chunk)
+    size_t rowBytes = 0;
+    for (const auto& column : columns) rowBytes += column.width;
+    const size_t chunkRows = mixedTypes ? 1 : std::max<size_t>(1, std::min(kMaxArrayBindRows,
+        kMaxArrayBindBytes / std::max<size_t>(rowBytes, 1)));
+
+    auto translation = toOracleCommand(query);
+    const std::string& oracleQuery = translation->sql;
+    bool pinned = inBatchOnThisThread();
+    PooledSession session;
+    OCIStmt* stmt = nullptr;
+
+    try {
+        if (!pinned) {
+            session = acquirePooledSession();
+        }
+        OCISvcCtx* svcCtx = pinned ? batchSession_.svcCtx : session.svcCtx;
+        OCIError* err = pinned ? batchSession_.err : session.err;
+
+        sword status = OCIHandleAlloc(poolEnv_, reinterpret_cast<void**>(&stmt),
+                                      OCI_HTYPE_STMT, 0, nullptr);
+        if (status != OCI_SUCCESS) {
+            stmt = nullptr;
+            throw std::runtime_error("Failed to allocate OCI statement handle (array DML)");
+        }
+        status = OCIStmtPrepare(stmt, err,
+                                reinterpret_cast<const OraText*>(oracleQuery.c_str()),
+                                oracleQuery.length(), OCI_NTV_SYNTAX, OCI_DEFAULT);
+        if (status != OCI_SUCCESS) {
+            throw std::runtime_error("Failed to prepare OCI statement (array DML)");
+        }
+
+        std::vector<std::string> bindNames(paramCount);
+        for (size_t col = 0; col < paramCount; ++col) {
+            bindNames[col] = ":" + std::to_string(col + 1);
+        }
+
+        ub4 totalAffected = 0;
+        for (size_t first = 0; first < paramRows.size(); first += chunkRows) {
+            size_t count = std::min(chunkRows, paramRows.size() - first);
+
+            for (size_t col = 0; col < paramCount; ++col) {
+                ArrayColumn& column = columns[col];
+                column.binary = false;
+                for (size_t r = 0; r < count && !column.binary; ++r) {
+                    column.binary = hexStart(paramRows[first + r][col]) > 0;
+                }
+                column.data.assign(count * column.width, 0);
+                column.lengths.assign(count, 0);
+                column.indicators.assign(count, -1);
+
+                for (size_t r = 0; r < count; ++r) {
+                    const std::string& v = paramRows[first + r][col];
+                    if (v.empty()) continue;
+                    char* slot = column.data.data() + r * column.width;
+                    if (column.binary) {
+                        size_t n = 0;
+                        for (size_t j = hexStart(v); j + 1 < v.size(); j += 2) {
+                            char hex[3] = { v[j], v[j + 1], '\0' };
+                            slot[n++] = static_cast<char>(strtol(hex, nullptr, 16));
+                        }
+                        column.lengths[r] = static_cast<ub4>(n);
+                    } else {
+                        std::memcpy(slot, v.data(), v.size());
+                        column.lengths[r] = static_cast<ub4>(v.size() + 1);
+                    }
+                    column.indicators[r] = 0;
+                }
+
+                OCIBind* bind = nullptr;
+                status = OCIBindByName2(stmt, &bind, err,
+                                        reinterpret_cast<const OraText*>(bindNames[col].c_str()),
+                                        static_cast<sb4>(bindNames[col].length()),
+                                        column.data.data(), static_cast<sb8>(column.width),
+                                        column.binary ? SQLT_LBI : SQLT_STR,
+                                        column.indicators.data(), column.lengths.data(), nullptr,
+                                        0, nullptr, OCI_DEFAULT);
+                if (status != OCI_SUCCESS) {
+                    throw std::runtime_error("Failed to bind array parameter " + std::to_string(col + 1));
+                }
+            }
+
+            // iters = rows in this chunk. A failed array execute keeps the rows before
+            // the failing iteration, so nothing is committed until every chunk succeeded.
+            status = OCIStmtExecute(svcCtx, stmt, err, static_cast<ub4>(count), 0, nullptr, nullptr,
+                                    OCI_DEFAULT);
+            if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO) {
+                char errbuf[512];
+                sb4 errcode = 0;
+                OCIErrorGet(err, 1, nullptr, &errcode,
+                           reinterpret_cast<OraText*>(errbuf), sizeof(errbuf), OCI_HTYPE_ERROR);
+                throw std::runtime_error(std::string("OCI array execution failed: ") + errbuf);
+            }
+
+            ub4 affectedRows = 0;
+            OCIAttrGet(stmt, OCI_HTYPE_STMT, &affectedRows, nullptr, OCI_ATTR_ROW_COUNT, err);
+            totalAffected += affectedRows;
+        }
+
+        OCIHandleFree(stmt, OCI_HTYPE_STMT);
+        stmt = nullptr;
+        if (!pinned) {
+            // All or nothing: on failure releasePooledSession() rolls back every chunk
+            status = OCITransCommit(svcCtx, err, OCI_DEFAULT);
+            if (status != OCI_SUCCESS) {
+                throw std::runtime_error("OCI commit failed (array DML)");
+            }
+            releasePooledSession(session);
+        }
+
+        spdlog::debug("[OracleQueryExecutor] Array DML executed: {} rows, affected {}",
+                      paramRows.size(), totalAffected);
+        return static_cast<int>(totalAffected);
+
+    } catch (const std::exception& e) {
+        spdlog::error("[OracleQueryExecutor] Array DML exception: {}", e.what());
+        if (stmt) OCIHandleFree(stmt, OCI_HTYPE_STMT);
+        if (!pinned) {
+            releasePooledSession(session);
+        }
+        throw;
+    }
+}
+
+// --- Query preparation helpers ---
+
+std::shared_ptr<const OracleSqlTranslation> OracleQueryExecutor::toOracleCommand(const std::string& query)
+{
+    return OracleSqlTranslator::instance().translate(query, OracleSqlTranslator::Kind::Command);
+}
+
+std::shared_ptr<const OracleSqlTranslation> OracleQueryExecutor::toOracleSelect(const std::string& query)
+{
+    return OracleSqlTranslator::instance().translate(query, OracleSqlTranslator::Kind::Query);
+}
+
+void OracleQueryExecutor::bindParams(
+    OCIStmt* stmt,
+    OCIError* err,
+    const std::vector<std::string>& params,
+    BindBuffers& buffers,
+    const OracleSqlTranslation* translation
+)
+{
+    // Reserve up front: binds keep pointers into these buffers
+    buffers.strings.reserve(params.size());
+    buffers.binaries.reserve(params.size());
+    buffers.names.reserve(params.size());
+
+    // Translated statements carry their bind names; otherwise build them here
+    const bool cachedNames = translation && translation->bindNames.size() >= params.size();
+
+    for (size_t i = 0; i < params.size(); ++i) {
+        OCIBind* bind = nullptr;
+
+        if (!cachedNames) buffers.names.push_back(":" + std::to_string(i + 1));
+        const std::string& bindName = cachedNames ? translation->bindNames[i] : buffers.names.back();
+
+        // Detect PostgreSQL bytea hex format (\\x...) for BLOB columns
+        bool isBinary = false;
+        size_t hexStart = 0;
+        if (params[i].size() > 3 && params[i][0] == '\\' && params[i][1] == '\\' && params[i][2] == 'x') {
+            isBinary = true;
+            hexStart = 3;
+        } else if (params[i].size() > 2 && params[i][0] == '\\' && params[i][1] == 'x') {
+            isBinary = true;
+            hexStart = 2;
+        }
+
+        sword status;
+        if (isBinary) {
+            std::vector<uint8_t> rawBytes;
+            rawBytes.reserve((params[i].size() - hexStart) / 2);
+            for (size_t j = hexStart; j + 1 < params[i].size(); j += 2) {
+                char hex[3] = { params[i][j], params[i][j + 1], '\0' };
+                rawBytes.push_back(static_cast<uint8_t>(strtol(hex, nullptr, 16)));
+            }
+
+            buffers.binaries.push_back(std::move(rawBytes));
+            auto& buf = buffers.binaries.back();
+
+            spdlog::debug("[OracleQueryExecutor] Param {} ({}) bound as BLOB ({} bytes)",
+                         i + 1, bindName, buf.size());
+
+            status = OCIBindByName(stmt, &bind, err,
+                                  reinterpret_cast<const OraText*>(bindName.c_str()),
+                                  static_cast<sb4>(bindName.length()),
+                                  buf.data(), static_cast<sb4>(buf.size()),
+                                  SQLT_LBI, nullptr, nullptr, nullptr,
+                                  0, nullptr, OCI_DEFAULT);
+        } else {
+            buffers.strings.push_back(params[i]);
+            std::string& strBuf = buffers.strings.back();
+
+            status = OCIBindByName(stmt, &bind, err,
+                                  reinterpret_cast<const OraText*>(bindName.c_str()),
+                                  static_cast<sb4>(bindName.length()),
+                                  strBuf.data(), static_cast<sb4>(strBuf.size() + 1),
+                                  SQLT_STR, nullptr, nullptr, nullptr,
+                                  0, nullptr, OCI_DEFAULT);
+        }
+
+        if (status != OCI_SUCCESS) {
+            throw std::runtime_error("Failed to bind parameter " + std::to_string(i + 1));
+        }
+    }
+}
+
 // ── Batch mode lifecycle ──
 
+void OracleQueryExecutor::executeOnBatchSession(const std::string& sql) {
+    OCIStmt* stmt = nullptr;
+    sword status = OCIHandleAlloc(poolEnv_, reinterpret_cast<void**>(&stmt),
+                                  OCI_HTYPE_STMT, 0, nullptr);
+    if (status != OCI_SUCCESS) {
+        throw std::runtime_error("Failed to allocate OCI statement handle (" + sql + ")");
+    }
+    status = OCIStmtPrepare(stmt, batchSession_.err,
+                            reinterpret_cast<const OraText*>(sql.c_str()),
+                            sql.length(), OCI_NTV_SYNTAX, OCI_DEFAULT);
+    if (status == OCI_SUCCESS) {
+        status = OCIStmtExecute(batchSession_.svcCtx, stmt, batchSession_.err, 1, 0,
+                                nullptr, nullptr, OCI_DEFAULT);
+    }
+    OCIHandleFree(stmt, OCI_HTYPE_STMT);
+    if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO) {
+        char errbuf[512];
+        sb4 errcode = 0;
+        OCIErrorGet(batchSession_.err, 1, nullptr, &errcode,
+                   reinterpret_cast<OraText*>(errbuf), sizeof(errbuf), OCI_HTYPE_ERROR);
+        throw std::runtime_error(sql + " failed: " + errbuf);
+    }
+}
+
+void OracleQueryExecutor::savepoint(const std::string& name) {
+    // Outside batch mode every call commits or rolls back on its own
+    if (!inBatchOnThisThread()) return;
+    executeOnBatchSession("SAVEPOINT " + name);
+}
+
+void OracleQueryExecutor::rollbackToSavepoint(const std::string& name) {
+    if (!inBatchOnThisThread()) return;
+    try {
+        executeOnBatchSession("ROLLBACK TO SAVEPOINT " + name);
+    } catch (const std::exception& e) {
+        spdlog::warn("[OracleQueryExecutor] {}", e.what());
+    }
+}
+
 void OracleQueryExecutor::beginBatch() {
-    if (batchMode_) {
+    if (batchThread_.load() != std::thread::id()) {
         spdlog::debug("[OracleQueryExecutor] beginBatch called but already in batch mode — ignoring");
         return;
     }
@@ -661,12 +1118,12 @@ void OracleQueryExecutor::beginBatch() {
     }
 
     batchSession_ = acquirePooledSession();
-    batchMode_ = true;
+    batchThread_ = std::this_thread::get_id();
     spdlog::info("[OracleQueryExecutor] Batch mode started (session pinned, commit deferred)");
 }
 
 void OracleQueryExecutor::endBatch() {
-    if (!batchMode_) return;
+    if (!inBatchOnThisThread()) return;
 
     // Commit all pending operations
     if (batchSession_.svcCtx && batchSession_.err) {
@@ -681,7 +1138,7 @@ void OracleQueryExecutor::endBatch() {
 
     // Release pinned session
     releasePooledSession(batchSession_);
-    batchMode_ = false;
+    batchThread_ = std::thread::id();
     spdlog::info("[OracleQueryExecutor] Batch mode ended (committed + session released)");
 }
 
@@ -1051,6 +1508,15 @@ OracleQueryExecutor::PooledSession OracleQueryExecutor::acquirePooledSession()
         }
     }
 
+    // Default LOB prefetch for locators fetched on this session (client-side attribute)
+    OCISession* userSession = nullptr;
+    OCIAttrGet(session.svcCtx, OCI_HTYPE_SVCCTX, &userSession, nullptr, OCI_ATTR_SESSION, session.err);
+    if (userSession) {
+        ub4 lobPrefetch = kLobPrefetchBytes;
+        OCIAttrSet(userSession, OCI_HTYPE_SESSION, &lobPrefetch, 0,
+                  OCI_ATTR_DEFAULT_LOBPREFETCH_SIZE, session.err);
+    }
+
     return session;
 }
 
@@ -1060,11 +1526,12 @@ void OracleQueryExecutor::releasePooledSession(PooledSession& session, bool drop
         // Rollback any pending transaction state before returning session to pool.
         OCITransRollback(session.svcCtx, session.err, OCI_DEFAULT);
 
-        // After LOB operations (BLOB/CLOB reads via OCILobRead), Oracle's OCI session
-        // retains internal LOB state that isn't cleared by OCIDescriptorFree() or
-        // OCITransRollback(). Reusing such a session causes ORA-03127 ("no new operations
-        // allowed until the active operation ends"). The fix: destroy the session instead
-        // of returning it to the pool when LOB operations occurred.
+        // ORA-03127 ("no new operations allowed until the active operation ends") on
+        // reuse comes from an operation still open on the session: a partially read
+        // LOB (OCILobRead returning OCI_NEED_DATA) or an unfinished fetch. OciRowCursor
+        // reads each LOB in one piece into a buffer sized for the whole value and
+        // cancels unconsumed result sets, so sessions that read LOBs are returned to
+        // the pool normally. Only error paths drop the session.
         ub4 mode = dropSession ? OCI_SESSRLS_DROPSESS : OCI_DEFAULT;
 
         OCISessionRelease(session.svcCtx, session.err,
@@ -1074,7 +1541,7 @@ void OracleQueryExecutor::releasePooledSession(PooledSession& session, bool drop
         session.svcCtx = nullptr;
 
         if (dropSession) {
-            spdlog::debug("[SessionPool] Session dropped after LOB operation (prevents ORA-03127)");
+            spdlog::debug("[SessionPool] Session dropped after error");
         }
     }
     if (session.err) {
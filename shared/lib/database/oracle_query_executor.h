@@ -13,9 +13,13 @@
 
 #include "i_query_executor.h"
 #include "oracle_connection_pool.h"
+#include "oracle_sql_translator.h"
 
 // OCI (Oracle Call Interface) headers
 #include <oci.h>
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 
 namespace common {
@@ -24,7 +28,8 @@ namespace common {
  * @brief Oracle-specific query executor
  *
  * Uses OCI Session Pool for high-performance connection reuse.
- * Converts PostgreSQL-style $1, $2 placeholders to Oracle :1, :2 format.
+ * Converts PostgreSQL-style $1, $2 placeholders to Oracle :1, :2 format
+ * (translations are memoized per SQL text by OracleSqlTranslator).
  * Results are returned as Json::Value for database-agnostic Repository code.
  */
 class OracleQueryExecutor : public IQueryExecutor {
@@ -45,7 +50,9 @@ public:
      * @brief Execute SELECT query with parameterized binding
      *
      * Converts PostgreSQL-style $1, $2 placeholders to Oracle :1, :2 format.
-     * Uses OCI Session Pool for query execution and result parsing.
+     * Uses OCI Session Pool for query execution and result parsing. Rows are
+     * array-fetched with row and LOB prefetch; BLOB columns are returned as
+     * PostgreSQL bytea hex text (\x...) to match the PostgreSQL executor.
      *
      * @param query SQL query (PostgreSQL $1 syntax, auto-converted to Oracle :1)
      * @param params Query parameters
@@ -57,6 +64,25 @@ public:
         const std::vector<std::string>& params = {}
     ) override;
 
+    /**
+     * @brief Execute SELECT query and stream rows through OCI defines
+     *
+     * Columns are defined directly on the statement as fetch arrays: BLOB/CLOB
+     * values are read through prefetched LOB locators into per-column buffers
+     * and returned as raw bytes, other columns as strings. No Json::Value rows
+     * or hex strings are built. Prefer this for bulk reads of binary columns.
+     *
+     * @param query SQL query (PostgreSQL $1 syntax, auto-converted to Oracle :1)
+     * @param params Query parameters
+     * @param consumer Called once with the cursor over the result
+     * @throws std::runtime_error on execution or fetch failure
+     */
+    void executeQueryRows(
+        const std::string& query,
+        const std::vector<std::string>& params,
+        const RowConsumer& consumer
+    ) override;
+
     /**
      * @brief Execute INSERT/UPDATE/DELETE command
      *
@@ -70,6 +96,25 @@ public:
         const std::vector<std::string>& params
     ) override;
 
+    /**
+     * @brief Execute a command once per parameter row using OCI array DML
+     *
+     * Binds each position as a contiguous slot array and executes with
+     * iters = rows (chunked by kMaxArrayBindRows / kMaxArrayBindBytes), so a
+     * chunk costs one round trip. Uses the pinned session in batch mode
+     * (callers wrap it in a savepoint), otherwise commits once after the last
+     * chunk and rolls every chunk back on failure.
+     *
+     * @param query SQL command (PostgreSQL $1 syntax, auto-converted)
+     * @param paramRows One parameter vector per row
+     * @return Total affected rows
+     * @throws std::runtime_error on execution failure
+     */
+    int executeBatch(
+        const std::string& query,
+        const std::vector<std::vector<std::string>>& paramRows
+    ) override;
+
     /**
      * @brief Execute scalar query (single value)
      *
@@ -99,6 +144,16 @@ public:
      */
     void endBatch() override;
 
+    /**
+     * @brief SAVEPOINT on the pinned batch session (no-op outside batch mode)
+     */
+    void savepoint(const std::string& name) override;
+
+    /**
+     * @brief ROLLBACK TO SAVEPOINT on the pinned batch session (no-op outside batch mode)
+     */
+    void rollbackToSavepoint(const std::string& name) override;
+
 private:
     OracleConnectionPool* pool_;  ///< Oracle connection pool
 
@@ -156,11 +211,53 @@ private:
      * @brief Release a session back to the OCI Session Pool
      * @param session Session to release (handles are nulled after release)
      * @param dropSession If true, destroy session instead of returning to pool
-     *        (used after LOB operations to prevent ORA-03127 on session reuse)
+     *        (used on error paths, where an operation may still be open)
      */
     void releasePooledSession(PooledSession& session, bool dropSession = false);
 
 
+    /// @name Query preparation helpers
+
+    /**
+     * @brief Bind buffers that must outlive statement execution
+     */
+    struct BindBuffers {
+        std::vector<std::string> strings;
+        std::vector<std::vector<uint8_t>> binaries;
+        std::vector<std::string> names;
+    };
+
+    /// @name Array DML limits for executeBatch()
+    static constexpr size_t kMaxArrayBindRows = 500;
+    static constexpr size_t kMaxArrayBindBytes = 16 * 1024 * 1024;
+
+    /**
+     * @brief Convert PostgreSQL DML syntax ($N, NULLIF()::INTEGER, NOW(), casts, ON CONFLICT) to Oracle
+     *
+     * Memoized per SQL text (see OracleSqlTranslator).
+     */
+    static std::shared_ptr<const OracleSqlTranslation> toOracleCommand(const std::string& query);
+
+    /**
+     * @brief Convert PostgreSQL SELECT syntax ($N, NULLIF()::INTEGER, LIMIT/OFFSET, RETURNING) to Oracle
+     *
+     * Memoized per SQL text (see OracleSqlTranslator).
+     */
+    static std::shared_ptr<const OracleSqlTranslation> toOracleSelect(const std::string& query);
+
+    /**
+     * @brief Bind positional parameters by name (:1, :2, ...)
+     *
+     * "\x"-prefixed hex values are bound as binary (SQLT_LBI), others as strings.
+     * Bind names come from the translation when it covers every parameter.
+     *
+     * @throws std::runtime_error if a bind fails (statement is not freed)
+     */
+    void bindParams(OCIStmt* stmt, OCIError* err,
+                    const std::vector<std::string>& params, BindBuffers& buffers,
+                    const OracleSqlTranslation* translation = nullptr);
+
+
     /// @name OCI lifecycle and helpers
 
     /** @brief Initialize OCI environment and connect to Oracle */
@@ -171,9 +268,15 @@ private:
 
     /// @name Batch mode (v2.26.1 — session pinning + statement cache + deferred commit)
 
-    bool batchMode_ = false;                              ///< Whether batch mode is active
-    PooledSession batchSession_;                           ///< Pinned session for batch mode
-    std::unordered_map<std::string, OCIStmt*> stmtCache_;  ///< Cached prepared statements (SQL → stmt)
+    std::atomic<std::thread::id> batchThread_{};           ///< Thread that called beginBatch (default id = off)
+    PooledSession batchSession_;                           ///< Pinned session (batch thread only)
+    std::unordered_map<std::string, OCIStmt*> stmtCache_;  ///< Cached prepared statements (batch thread only)
+
+    /// Run a parameterless statement (SAVEPOINT, ROLLBACK TO) on the pinned session
+    void executeOnBatchSession(const std::string& sql);
+
+    /// Batch mode is active and was started by the calling thread
+    bool inBatchOnThisThread() const { return batchThread_.load() == std::this_thread::get_id(); }
 };
 
 } // namespace common
@@ -0,0 +1,149 @@
+/**
+ * @file oracle_sql_translator.cpp
+ * @brief Memoized PostgreSQL → Oracle SQL translation implementation
+ */
+
+#include "oracle_sql_translator.h"
+
+#include <spdlog/spdlog.h>
+#include <cctype>
+#include <mutex>
+#include <regex>
+
+namespace common {
+
+namespace {
+
+// Pre-compiled regex patterns for PostgreSQL→Oracle query transformation
+const std::regex s_pgPlaceholder(R"(\$(\d+))");
+const std::regex s_nullifInteger(R"(NULLIF\(([^,]+),\s*''\s*\)::INTEGER)", std::regex::icase);
+const std::regex s_limitOffset(R"(\s+LIMIT\s+(\d+|:\d+)\s+OFFSET\s+(\d+|:\d+)\s*$)", std::regex::icase);
+const std::regex s_limitOnly(R"(\s+LIMIT\s+(\d+|:\d+)\s*$)", std::regex::icase);
+const std::regex s_returningClause(R"(\s+RETURNING\s+\w+(\s+INTO\s+:\d+)?\s*$)", std::regex::icase);
+// DML command additional patterns
+const std::regex s_nowFunc(R"(NOW\(\))", std::regex::icase);
+const std::regex s_currentTimestamp(R"(CURRENT_TIMESTAMP)", std::regex::icase);
+const std::regex s_typecast(R"(::[a-zA-Z_][a-zA-Z0-9_]*)", std::regex::icase);
+const std::regex s_onConflict(R"(\s+ON\s+CONFLICT\s*\([^)]*\)\s+DO\s+(NOTHING|UPDATE\s+SET\s+.*)$)", std::regex::icase);
+
+/// Highest $N placeholder number in the PostgreSQL text
+size_t maxPlaceholder(const std::string& sql) {
+    size_t maxIndex = 0;
+    for (size_t i = 0; i < sql.size(); ++i) {
+        if (sql[i] != '$') continue;
+        size_t n = 0;
+        size_t j = i + 1;
+        while (j < sql.size() && std::isdigit(static_cast<unsigned char>(sql[j]))) {
+            n = n * 10 + static_cast<size_t>(sql[j] - '0');
+            ++j;
+        }
+        if (n > maxIndex) maxIndex = n;
+        i = j - 1;
+    }
+    return maxIndex;
+}
+
+/// INSERT/UPDATE/DELETE/MERGE by first keyword
+bool startsWithDml(const std::string& sql) {
+    size_t pos = sql.find_first_not_of(" \t\n\r");
+    if (pos == std::string::npos) return false;
+    std::string prefix = sql.substr(pos, 6);
+    for (auto& c : prefix) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    return prefix == "INSERT" || prefix == "UPDATE" || prefix == "DELETE" || prefix.substr(0, 5) == "MERGE";
+}
+
+} // anonymous namespace
+
+OracleSqlTranslator::OracleSqlTranslator(size_t capacity)
+    : capacity_(capacity > 0 ? capacity : 1) {}
+
+OracleSqlTranslator& OracleSqlTranslator::instance() {
+    static OracleSqlTranslator translator;
+    return translator;
+}
+
+OracleSqlTranslation OracleSqlTranslator::translateUncached(const std::string& sql, Kind kind) {
+    OracleSqlTranslation result;
+
+    // Convert PostgreSQL placeholders to OCI positional binding format
+    std::string oracleQuery = std::regex_replace(sql, s_pgPlaceholder, ":$1");
+
+    // Convert PostgreSQL-specific NULLIF()::INTEGER to Oracle CASE expression
+    oracleQuery = std::regex_replace(oracleQuery, s_nullifInteger, "CASE WHEN $1 IS NULL OR $1 = '' THEN NULL ELSE TO_NUMBER($1) END");
+
+    if (kind == Kind::Command) {
+        oracleQuery = std::regex_replace(oracleQuery, s_currentTimestamp, "SYSTIMESTAMP");
+        oracleQuery = std::regex_replace(oracleQuery, s_nowFunc, "SYSDATE");
+        oracleQuery = std::regex_replace(oracleQuery, s_typecast, "");
+
+        // Handle PostgreSQL ON CONFLICT clause (not supported in Oracle)
+        oracleQuery = std::regex_replace(oracleQuery, s_onConflict, "");
+    } else {
+        // Convert LIMIT/OFFSET syntax (handles both literal numbers and :N bind variables)
+        oracleQuery = std::regex_replace(oracleQuery, s_limitOffset, " OFFSET $2 ROWS FETCH NEXT $1 ROWS ONLY");
+        oracleQuery = std::regex_replace(oracleQuery, s_limitOnly, " FETCH FIRST $1 ROWS ONLY");
+
+        // DML with RETURNING: executed as plain DML, no rows returned
+        if (std::regex_search(oracleQuery, s_returningClause)) {
+            result.returningStripped = true;
+            oracleQuery = std::regex_replace(oracleQuery, s_returningClause, "");
+        }
+    }
+
+    size_t binds = maxPlaceholder(sql);
+    result.bindNames.reserve(binds);
+    for (size_t i = 1; i <= binds; ++i) {
+        result.bindNames.push_back(":" + std::to_string(i));
+    }
+    result.isDml = startsWithDml(oracleQuery);
+    result.sql = std::move(oracleQuery);
+    return result;
+}
+
+std::shared_ptr<const OracleSqlTranslation> OracleSqlTranslator::translate(const std::string& sql, Kind kind) {
+    auto& entries = (kind == Kind::Query) ? queries_ : commands_;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = entries.find(sql);
+        if (it != entries.end()) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+    }
+
+    // Translate outside the lock; a concurrent miss on the same text keeps the first result
+    auto translated = std::make_shared<const OracleSqlTranslation>(translateUncached(sql, kind));
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (queries_.size() + commands_.size() >= capacity_) {
+        queries_.clear();
+        commands_.clear();
+        resets_.fetch_add(1, std::memory_order_relaxed);
+        spdlog::debug("[OracleSqlTranslator] Cache reached {} entries, cleared", capacity_);
+    }
+    return entries.emplace(sql, std::move(translated)).first->second;
+}
+
+void OracleSqlTranslator::prewarm(const std::vector<std::string>& statements, Kind kind) {
+    for (const auto& sql : statements) translate(sql, kind);
+}
+
+OracleSqlTranslator::Stats OracleSqlTranslator::stats() const {
+    Stats result;
+    result.hits = hits_.load(std::memory_order_relaxed);
+    result.misses = misses_.load(std::memory_order_relaxed);
+    result.resets = resets_.load(std::memory_order_relaxed);
+    result.capacity = capacity_;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    result.entries = queries_.size() + commands_.size();
+    return result;
+}
+
+void OracleSqlTranslator::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    queries_.clear();
+    commands_.clear();
+}
+
+} // namespace common
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <json/json.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file oracle_sql_translator.h
+ * @brief Memoized PostgreSQL → Oracle SQL dialect translation
+ *
+ * OracleQueryExecutor accepts PostgreSQL-style SQL ($1 placeholders,
+ * LIMIT/OFFSET, NOW(), ::casts, RETURNING, ON CONFLICT) and rewrites it with a
+ * chain of std::regex passes. The set of distinct statements is small and
+ * static, so each SQL text is translated once per process and the result
+ * (Oracle text, bind names, DML/RETURNING classification) is shared by all
+ * later calls. Lookups take a shared lock; only first use of a text takes the
+ * exclusive lock.
+ *
+ * Statements that embed literals can make the text set unbounded: when the
+ * cache reaches its capacity it is cleared and refilled from live traffic.
+ *
+ * @date 2026-10-16
+ */
+
+namespace common {
+
+/**
+ * @brief Result of translating one PostgreSQL statement to Oracle
+ */
+struct OracleSqlTranslation {
+    std::string sql;                      ///< Oracle SQL text
+    std::vector<std::string> bindNames;   ///< ":1" .. ":N" for the highest $N in the input
+    bool isDml = false;                   ///< INSERT/UPDATE/DELETE/MERGE (needs iters=1)
+    bool returningStripped = false;       ///< Trailing RETURNING clause removed (Query kind only)
+};
+
+class OracleSqlTranslator {
+public:
+    /// Query: SELECT rules + LIMIT/OFFSET + RETURNING strip; Command: DML rules (NOW(), casts, ON CONFLICT)
+    enum class Kind { Query, Command };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t resets = 0;     ///< Times the cache was cleared at capacity
+        size_t entries = 0;
+        size_t capacity = 0;
+    };
+
+    static constexpr size_t kDefaultCapacity = 4096;
+
+    explicit OracleSqlTranslator(size_t capacity = kDefaultCapacity);
+
+    OracleSqlTranslator(const OracleSqlTranslator&) = delete;
+    OracleSqlTranslator& operator=(const OracleSqlTranslator&) = delete;
+
+    /** @brief Process-wide translator used by OracleQueryExecutor */
+    static OracleSqlTranslator& instance();
+
+    /**
+     * @brief Translated statement, computed on first use
+     * @return Shared, immutable translation (safe to hold while the statement runs)
+     */
+    std::shared_ptr<const OracleSqlTranslation> translate(const std::string& sql, Kind kind);
+
+    /** @brief Translate statements ahead of the first request (e.g. at startup) */
+    void prewarm(const std::vector<std::string>& statements, Kind kind);
+
+    /** @brief Translation without the cache */
+    static OracleSqlTranslation translateUncached(const std::string& sql, Kind kind);
+
+    Stats stats() const;
+
+    /** Drop all cached translations (counters are kept) */
+    void clear();
+
+private:
+    size_t capacity_;
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const OracleSqlTranslation>> queries_;
+    std::unordered_map<std::string, std::shared_ptr<const OracleSqlTranslation>> commands_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> resets_{0};
+};
+
+/**
+ * Translator statistics for /internal/metrics.
+ */
+inline Json::Value oracleSqlTranslationMetrics(const OracleSqlTranslator& translator) {
+    auto stats = translator.stats();
+    Json::Value result;
+    result["entries"] = static_cast<Json::UInt>(stats.entries);
+    result["capacity"] = static_cast<Json::UInt>(stats.capacity);
+    result["hits"] = static_cast<Json::UInt64>(stats.hits);
+    result["misses"] = static_cast<Json::UInt64>(stats.misses);
+    result["resets"] = static_cast<Json::UInt64>(stats.resets);
+    uint64_t lookups = stats.hits + stats.misses;
+    result["hitRate"] = lookups > 0 ? static_cast<double>(stats.hits) / static_cast<double>(lookups) : 0.0;
+    return result;
+}
+
+} // namespace common
@@ -0,0 +1,150 @@
+/**
+ * @file pg_statement_cache.cpp
+ * @brief Per-connection prepared statement cache implementation
+ */
+
+#include "pg_statement_cache.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <functional>
+
+namespace common {
+
+namespace {
+
+constexpr const char* kEventProcName = "icao_pg_statement_cache";
+
+/// SQLSTATEs after which a cached statement is dropped and re-prepared
+bool isStaleStatementError(const PGresult* res) {
+    if (!res || PQresultStatus(res) != PGRES_FATAL_ERROR) return false;
+    const char* state = PQresultErrorField(res, PG_DIAG_SQLSTATE);
+    // 26000 invalid_sql_statement_name: statement missing on the server
+    // 0A000 feature_not_supported: "cached plan must not change result type" after DDL
+    return state && (std::strcmp(state, "26000") == 0 || std::strcmp(state, "0A000") == 0);
+}
+
+} // anonymous namespace
+
+PgStatementCache::PgStatementCache(size_t capacity)
+    : capacity_(capacity > 0 ? capacity : 1) {}
+
+PgStatementCache* PgStatementCache::forConnection(PGconn* conn, size_t capacity) {
+    if (!conn) return nullptr;
+
+    auto* cache = static_cast<PgStatementCache*>(PQinstanceData(conn, &PgStatementCache::eventProc));
+    if (cache) return cache;
+
+    if (!PQregisterEventProc(conn, &PgStatementCache::eventProc, kEventProcName, nullptr)) {
+        spdlog::warn("[PgStatementCache] Failed to register event procedure; prepared statements disabled for connection");
+        return nullptr;
+    }
+    cache = new PgStatementCache(capacity);
+    if (!PQsetInstanceData(conn, &PgStatementCache::eventProc, cache)) {
+        delete cache;
+        return nullptr;
+    }
+    return cache;
+}
+
+int PgStatementCache::eventProc(PGEventId id, void* eventInfo, void* /*passThrough*/) {
+    switch (id) {
+        case PGEVT_CONNRESET: {
+            auto* info = static_cast<PGEventConnReset*>(eventInfo);
+            if (auto* cache = static_cast<PgStatementCache*>(PQinstanceData(info->conn, &PgStatementCache::eventProc))) {
+                cache->clear();
+            }
+            break;
+        }
+        case PGEVT_CONNDESTROY: {
+            auto* info = static_cast<PGEventConnDestroy*>(eventInfo);
+            delete static_cast<PgStatementCache*>(PQinstanceData(info->conn, &PgStatementCache::eventProc));
+            break;
+        }
+        default:
+            break;
+    }
+    return 1;
+}
+
+PGresult* PgStatementCache::execute(PGconn* conn, const std::string& sql, int nParams,
+                                    const char* const* values, int resultFormat, bool& prepared) {
+    prepared = false;
+    bool stale = false;
+    PGresult* res = executeOnce(conn, sql, nParams, values, resultFormat, prepared, stale);
+
+    // A failed statement aborts an open transaction, so only retry outside one
+    if (stale && PQtransactionStatus(conn) == PQTRANS_IDLE) {
+        spdlog::debug("[PgStatementCache] Re-preparing stale statement");
+        PQclear(res);
+        res = executeOnce(conn, sql, nParams, values, resultFormat, prepared, stale);
+    }
+    return res;
+}
+
+PGresult* PgStatementCache::executeOnce(PGconn* conn, const std::string& sql, int nParams,
+                                        const char* const* values, int resultFormat,
+                                        bool& prepared, bool& stale) {
+    stale = false;
+    size_t hash = std::hash<std::string>()(sql);
+    auto it = entries_.find(hash);
+
+    if (it != entries_.end() && it->second.sql != sql) {
+        // Hash collision with a different statement: run it unnamed
+        return PQexecParams(conn, sql.c_str(), nParams, nullptr, values, nullptr, nullptr, resultFormat);
+    }
+
+    if (it == entries_.end()) {
+        if (entries_.size() >= capacity_) {
+            evictOldest(conn);
+        }
+
+        std::string name = "icao_ps_" + std::to_string(nextId_++);
+        PGresult* prep = PQprepare(conn, name.c_str(), sql.c_str(), nParams, nullptr);
+        if (!prep || PQresultStatus(prep) != PGRES_COMMAND_OK) {
+            return prep;  // Caller reports the prepare error like an execution error
+        }
+        PQclear(prep);
+        prepared = true;
+
+        lru_.push_front(hash);
+        it = entries_.emplace(hash, Entry{sql, std::move(name), lru_.begin()}).first;
+    } else {
+        lru_.splice(lru_.begin(), lru_, it->second.lruPos);
+    }
+
+    PGresult* res = PQexecPrepared(conn, it->second.name.c_str(), nParams, values,
+                                   nullptr, nullptr, resultFormat);
+    if (isStaleStatementError(res)) {
+        stale = true;
+        erase(hash);
+    }
+    return res;
+}
+
+void PgStatementCache::evictOldest(PGconn* conn) {
+    if (lru_.empty()) return;
+    size_t hash = lru_.back();
+    auto it = entries_.find(hash);
+    if (it != entries_.end()) {
+        // Best effort: fails inside an aborted transaction, and the statement then
+        // simply lives until the session ends (names are never reused)
+        std::string sql = "DEALLOCATE " + it->second.name;
+        PGresult* res = PQexec(conn, sql.c_str());
+        if (res) PQclear(res);
+    }
+    erase(hash);
+}
+
+void PgStatementCache::erase(size_t hash) {
+    auto it = entries_.find(hash);
+    if (it == entries_.end()) return;
+    lru_.erase(it->second.lruPos);
+    entries_.erase(it);
+}
+
+void PgStatementCache::clear() {
+    entries_.clear();
+    lru_.clear();
+}
+
+} // namespace common
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <libpq-fe.h>
+#include <libpq-events.h>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @file pg_statement_cache.h
+ * @brief Per-connection server-side prepared statement cache (PostgreSQL)
+ *
+ * PQexecParams sends the full SQL text on every call, so the server parses
+ * and plans the same INSERT tens of thousands of times during an import.
+ * PgStatementCache prepares each distinct SQL text once per connection
+ * (PQprepare) and executes it by name afterwards (PQexecPrepared).
+ *
+ * The cache is attached to the PGconn through a libpq event procedure:
+ * - PGEVT_CONNRESET clears it (server-side statements die with the backend,
+ *   so statements are transparently re-prepared after PQreset)
+ * - PGEVT_CONNDESTROY frees it when the connection is PQfinish()ed
+ *
+ * A PGconn is only used by one thread at a time (connection pool), so the
+ * cache itself is not synchronized.
+ *
+ * @date 2026-10-15
+ */
+
+namespace common {
+
+class PgStatementCache {
+public:
+    static constexpr size_t kDefaultCapacity = 256;
+
+    /**
+     * @brief Cache attached to a connection, created on first use
+     * @param conn Open PostgreSQL connection
+     * @param capacity Maximum statements kept per connection (LRU eviction)
+     * @return Cache, or nullptr if the event procedure could not be registered
+     */
+    static PgStatementCache* forConnection(PGconn* conn, size_t capacity = kDefaultCapacity);
+
+    /**
+     * @brief Execute SQL through a named prepared statement
+     *
+     * Prepares on first use (evicting the least recently used statement when
+     * full). If the server no longer knows the statement (SQLSTATE 26000) or
+     * its cached plan became invalid (0A000), the statement is re-prepared and
+     * retried once when no transaction is open.
+     *
+     * @param conn Connection this cache belongs to
+     * @param sql SQL text with $1, $2 placeholders
+     * @param nParams Number of parameters
+     * @param values Text-format parameter values (nullptr = SQL NULL)
+     * @param resultFormat 0 = text, 1 = binary
+     * @param prepared Set to true if this call issued a PQprepare
+     * @return PGresult (caller must PQclear); on prepare failure, the failed prepare result
+     */
+    PGresult* execute(PGconn* conn, const std::string& sql, int nParams,
+                      const char* const* values, int resultFormat, bool& prepared);
+
+    size_t size() const { return entries_.size(); }
+
+    /// Forget all statements (client side only; used after a connection reset)
+    void clear();
+
+private:
+    explicit PgStatementCache(size_t capacity);
+
+    struct Entry {
+        std::string sql;                       ///< Full text (guards against hash collisions)
+        std::string name;                      ///< Server-side statement name
+        std::list<size_t>::iterator lruPos;
+    };
+
+    static int eventProc(PGEventId id, void* eventInfo, void* passThrough);
+
+    PGresult* executeOnce(PGconn* conn, const std::string& sql, int nParams,
+                          const char* const* values, int resultFormat, bool& prepared, bool& stale);
+    void evictOldest(PGconn* conn);
+    void erase(size_t hash);
+
+    size_t capacity_;
+    uint64_t nextId_ = 0;
+    std::unordered_map<size_t, Entry> entries_;  ///< SQL text hash -> statement
+    std::list<size_t> lru_;                      ///< Most recently used first
+};
+
+} // namespace common
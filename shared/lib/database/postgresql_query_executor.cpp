@@ -4,12 +4,256 @@
  */
 
 #include "postgresql_query_executor.h"
+#include "pg_statement_cache.h"
+#include "query_helpers.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <strings.h>
 
 namespace common {
 
+namespace {
+
+// PostgreSQL type OIDs used by the binary row cursor (pg_type.dat)
+constexpr Oid kOidBool = 16;
+constexpr Oid kOidBytea = 17;
+constexpr Oid kOidChar = 18;
+constexpr Oid kOidName = 19;
+constexpr Oid kOidInt8 = 20;
+constexpr Oid kOidInt2 = 21;
+constexpr Oid kOidInt4 = 23;
+constexpr Oid kOidText = 25;
+constexpr Oid kOidOid = 26;
+constexpr Oid kOidJson = 114;
+constexpr Oid kOidXml = 142;
+constexpr Oid kOidFloat4 = 700;
+constexpr Oid kOidFloat8 = 701;
+constexpr Oid kOidUnknown = 705;
+constexpr Oid kOidBpchar = 1042;
+constexpr Oid kOidVarchar = 1043;
+constexpr Oid kOidUuid = 2950;
+constexpr Oid kOidJsonb = 3802;
+
+uint64_t readBigEndian(const char* data, int len) {
+    uint64_t value = 0;
+    for (int i = 0; i < len; ++i) {
+        value = (value << 8) | static_cast<unsigned char>(data[i]);
+    }
+    return value;
+}
+
+bool isTextType(Oid type) {
+    return type == kOidText || type == kOidVarchar || type == kOidBpchar || type == kOidName ||
+           type == kOidChar || type == kOidJson || type == kOidXml || type == kOidUnknown ||
+           type == kOidBytea;
+}
+
+struct PgResultDeleter {
+    void operator()(PGresult* res) const { PQclear(res); }
+};
+
+/**
+ * @brief RowCursor over a binary-format (resultFormat=1) PGresult
+ */
+class PgBinaryRowCursor : public RowCursor {
+public:
+    explicit PgBinaryRowCursor(PGresult* res)
+        : res_(res), rows_(PQntuples(res)), cols_(PQnfields(res)),
+          types_(static_cast<size_t>(cols_)), scratch_(static_cast<size_t>(cols_))
+    {
+        for (int j = 0; j < cols_; ++j) {
+            types_[j] = PQftype(res_, j);
+        }
+    }
+
+    bool next() override { return ++row_ < rows_; }
+
+    /// Continue on the next chunk of the same query (same columns)
+    void reset(PGresult* res) {
+        res_ = res;
+        rows_ = PQntuples(res);
+        row_ = -1;
+    }
+
+    int rowCount() const { return rows_; }
+
+    int columnIndex(std::string_view name) override {
+        for (int j = 0; j < cols_; ++j) {
+            const char* fieldName = PQfname(res_, j);
+            if (std::strlen(fieldName) == name.size() &&
+                strncasecmp(fieldName, name.data(), name.size()) == 0) {
+                return j;
+            }
+        }
+        return -1;
+    }
+
+    bool isNull(int col) const override {
+        return !valid(col) || PQgetisnull(res_, row_, col);
+    }
+
+    std::string_view getStringView(int col) const override {
+        if (isNull(col)) return {};
+        const char* data = PQgetvalue(res_, row_, col);
+        int len = PQgetlength(res_, row_, col);
+        Oid type = types_[col];
+
+        if (isTextType(type)) return std::string_view(data, static_cast<size_t>(len));
+        if (type == kOidJsonb && len > 0) return std::string_view(data + 1, static_cast<size_t>(len - 1));  // Version byte
+
+        std::string& out = scratch_[col];
+        if (type == kOidBool) {
+            out = (len > 0 && data[0]) ? "t" : "f";
+        } else if (type == kOidInt2 || type == kOidInt4 || type == kOidInt8 || type == kOidOid) {
+            out = std::to_string(getInt(col));
+        } else if (type == kOidFloat4 || type == kOidFloat8) {
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "%.17g", readFloat(data, len));
+            out = buf;
+        } else if (type == kOidUuid && len == 16) {
+            static const char hexChars[] = "0123456789abcdef";
+            out.clear();
+            for (int i = 0; i < 16; ++i) {
+                if (i == 4 || i == 6 || i == 8 || i == 10) out += '-';
+                out += hexChars[(static_cast<unsigned char>(data[i]) >> 4) & 0x0f];
+                out += hexChars[static_cast<unsigned char>(data[i]) & 0x0f];
+            }
+        } else {
+            throw std::runtime_error(std::string("[PostgreSQLQueryExecutor] Column '") + PQfname(res_, col) +
+                                     "' (type OID " + std::to_string(type) +
+                                     ") has no binary text conversion; cast it to text in the query");
+        }
+        return out;
+    }
+
+    int64_t getInt(int col, int64_t defaultValue = 0) const override {
+        if (isNull(col)) return defaultValue;
+        const char* data = PQgetvalue(res_, row_, col);
+        int len = PQgetlength(res_, row_, col);
+
+        switch (types_[col]) {
+            case kOidInt2: return static_cast<int16_t>(readBigEndian(data, 2));
+            case kOidInt4: return static_cast<int32_t>(readBigEndian(data, 4));
+            case kOidOid:  return static_cast<uint32_t>(readBigEndian(data, 4));
+            case kOidInt8: return static_cast<int64_t>(readBigEndian(data, 8));
+            case kOidBool: return (len > 0 && data[0]) ? 1 : 0;
+            case kOidFloat4:
+            case kOidFloat8: return static_cast<int64_t>(readFloat(data, len));
+            default: break;
+        }
+        if (!isTextType(types_[col])) return defaultValue;
+
+        std::string text(data, static_cast<size_t>(len));
+        char* end = nullptr;
+        long long parsed = std::strtoll(text.c_str(), &end, 10);
+        return (end != text.c_str()) ? static_cast<int64_t>(parsed) : defaultValue;
+    }
+
+    bool getBool(int col, bool defaultValue = false) const override {
+        if (isNull(col)) return defaultValue;
+        Oid type = types_[col];
+        if (type == kOidBool || type == kOidInt2 || type == kOidInt4 || type == kOidInt8) {
+            return getInt(col) != 0;
+        }
+        std::string_view text = getStringView(col);
+        return text == "1" || text == "t" || text == "true" || text == "TRUE";
+    }
+
+    ByteSpan getBytes(int col) const override {
+        if (isNull(col)) return {};
+        return ByteSpan{reinterpret_cast<const uint8_t*>(PQgetvalue(res_, row_, col)),
+                        static_cast<size_t>(PQgetlength(res_, row_, col))};
+    }
+
+private:
+    bool valid(int col) const {
+        return row_ >= 0 && row_ < rows_ && col >= 0 && col < cols_;
+    }
+
+    static double readFloat(const char* data, int len) {
+        if (len == 4) {
+            uint32_t bits = static_cast<uint32_t>(readBigEndian(data, 4));
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        uint64_t bits = readBigEndian(data, 8);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    PGresult* res_;
+    int rows_;
+    int cols_;
+    int row_ = -1;
+    std::vector<Oid> types_;
+    mutable std::vector<std::string> scratch_;  ///< Per-column formatted text
+};
+
+/**
+ * @brief RowCursor over a server-side cursor, FETCHing one chunk at a time
+ *
+ * Owns the current chunk; the previous chunk is released when the next one
+ * arrives, which matches the "views valid until next()" contract.
+ */
+class PgFetchRowCursor : public RowCursor {
+public:
+    PgFetchRowCursor(PGconn* conn, const std::string& cursorName, size_t fetchRows)
+        : conn_(conn),
+          fetchSql_("FETCH FORWARD " + std::to_string(fetchRows) + " FROM " + cursorName),
+          fetchRows_(static_cast<int>(fetchRows)),
+          chunk_(fetch()),
+          rows_(chunk_.get())
+    {
+    }
+
+    bool next() override {
+        if (rows_.next()) return true;
+        if (rows_.rowCount() < fetchRows_) return false;  // Short chunk was the last one
+        chunk_ = fetch();
+        rows_.reset(chunk_.get());
+        return rows_.next();
+    }
+
+    int columnIndex(std::string_view name) override { return rows_.columnIndex(name); }
+    bool isNull(int col) const override { return rows_.isNull(col); }
+    std::string_view getStringView(int col) const override { return rows_.getStringView(col); }
+    int64_t getInt(int col, int64_t defaultValue = 0) const override { return rows_.getInt(col, defaultValue); }
+    bool getBool(int col, bool defaultValue = false) const override { return rows_.getBool(col, defaultValue); }
+    ByteSpan getBytes(int col) const override { return rows_.getBytes(col); }
+
+private:
+    std::unique_ptr<PGresult, PgResultDeleter> fetch() {
+        std::unique_ptr<PGresult, PgResultDeleter> res(
+            PQexecParams(conn_, fetchSql_.c_str(), 0, nullptr, nullptr, nullptr, nullptr, 1));
+        if (!res || PQresultStatus(res.get()) != PGRES_TUPLES_OK) {
+            throw std::runtime_error("[PostgreSQLQueryExecutor] FETCH failed: " + std::string(PQerrorMessage(conn_)));
+        }
+        return res;
+    }
+
+    PGconn* conn_;
+    std::string fetchSql_;
+    int fetchRows_;
+    std::unique_ptr<PGresult, PgResultDeleter> chunk_;
+    PgBinaryRowCursor rows_;
+};
+
+/// Run a transaction-control statement, throwing on failure
+void execControl(PGconn* conn, const char* sql) {
+    std::unique_ptr<PGresult, PgResultDeleter> res(PQexec(conn, sql));
+    if (!res || PQresultStatus(res.get()) != PGRES_COMMAND_OK) {
+        throw std::runtime_error(std::string("[PostgreSQLQueryExecutor] ") + sql + " failed: " + PQerrorMessage(conn));
+    }
+}
+
+} // anonymous namespace
+
 // --- Constructor ---
 
 PostgreSQLQueryExecutor::PostgreSQLQueryExecutor(DbConnectionPool* pool)
@@ -48,16 +292,7 @@ Json::Value PostgreSQLQueryExecutor::executeQuery(
     }
 
     // Execute parameterized query
-    PGresult* res = PQexecParams(
-        conn.get(),
-        query.c_str(),
-        params.size(),
-        nullptr,
-        paramValues.data(),
-        nullptr,
-        nullptr,
-        0
-    );
+    PGresult* res = execParams(conn.get(), query, paramValues, 0);
 
     if (!res) {
         throw std::runtime_error("[PostgreSQLQueryExecutor] Query execution failed: null result");
@@ -79,6 +314,84 @@ Json::Value PostgreSQLQueryExecutor::executeQuery(
     return result;
 }
 
+void PostgreSQLQueryExecutor::executeQueryRows(
+    const std::string& query,
+    const std::vector<std::string>& params,
+    const RowConsumer& consumer
+)
+{
+    spdlog::debug("[PostgreSQLQueryExecutor] Executing SELECT query (binary rows)");
+    spdlog::debug("[PostgreSQLQueryExecutor] Query: {}", query);
+
+    // Acquire connection from pool (RAII - held until function returns)
+    auto conn = pool_->acquire();
+    if (!conn.isValid()) {
+        throw std::runtime_error("[PostgreSQLQueryExecutor] Failed to acquire connection from pool");
+    }
+
+    std::vector<const char*> paramValues;
+    for (const auto& param : params) {
+        paramValues.push_back(param.empty() ? nullptr : param.c_str());
+    }
+
+    // Text parameters, binary results
+    std::unique_ptr<PGresult, PgResultDeleter> res(execParams(conn.get(), query, paramValues, 1));
+
+    if (!res) {
+        throw std::runtime_error("[PostgreSQLQueryExecutor] Query execution failed: null result");
+    }
+
+    ExecStatusType status = PQresultStatus(res.get());
+    if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK) {
+        throw std::runtime_error("[PostgreSQLQueryExecutor] Query failed: " + std::string(PQerrorMessage(conn.get())));
+    }
+
+    PgBinaryRowCursor cursor(res.get());
+    consumer(cursor);
+}
+
+void PostgreSQLQueryExecutor::executeQueryStream(
+    const std::string& query,
+    const std::vector<std::string>& params,
+    const RowConsumer& consumer,
+    size_t fetchRows
+)
+{
+    spdlog::debug("[PostgreSQLQueryExecutor] Executing SELECT query (cursor, {} rows/fetch)", fetchRows);
+    spdlog::debug("[PostgreSQLQueryExecutor] Query: {}", query);
+
+    auto conn = pool_->acquire();
+    if (!conn.isValid()) {
+        throw std::runtime_error("[PostgreSQLQueryExecutor] Failed to acquire connection from pool");
+    }
+    PGconn* pgconn = conn.get();
+
+    std::vector<const char*> paramValues;
+    for (const auto& param : params) {
+        paramValues.push_back(param.empty() ? nullptr : param.c_str());
+    }
+
+    // Cursors only live inside a transaction; ROLLBACK closes it on every exit path
+    execControl(pgconn, "BEGIN READ ONLY");
+    struct TransactionGuard {
+        PGconn* conn;
+        ~TransactionGuard() { PQclear(PQexec(conn, "ROLLBACK")); }
+    } guard{pgconn};
+
+    // DECLARE cannot be PREPAREd, so it bypasses the statement cache
+    const std::string cursorName = "icao_stream_cursor";
+    std::string declareSql = "DECLARE " + cursorName + " NO SCROLL BINARY CURSOR FOR " + query;
+    std::unique_ptr<PGresult, PgResultDeleter> declared(PQexecParams(
+        pgconn, declareSql.c_str(), static_cast<int>(paramValues.size()), nullptr,
+        paramValues.data(), nullptr, nullptr, 1));
+    if (!declared || PQresultStatus(declared.get()) != PGRES_COMMAND_OK) {
+        throw std::runtime_error("[PostgreSQLQueryExecutor] DECLARE CURSOR failed: " + std::string(PQerrorMessage(pgconn)));
+    }
+
+    PgFetchRowCursor cursor(pgconn, cursorName, std::max<size_t>(fetchRows, 1));
+    consumer(cursor);
+}
+
 int PostgreSQLQueryExecutor::executeCommand(
     const std::string& query,
     const std::vector<std::string>& params
@@ -86,12 +399,12 @@ int PostgreSQLQueryExecutor::executeCommand(
 {
     // Determine which connection to use
     PGconn* pgconn = nullptr;
-    DbConnection* normalConn = nullptr;
     std::unique_ptr<DbConnection> connHolder;
 
-    if (batchMode_ && batchConn_ && batchConn_->isValid()) {
+    if (inBatchOnThisThread() && batchConn_ && batchConn_->isValid()) {
         // Batch mode: use pinned connection (no acquire/release per call)
         pgconn = batchConn_->get();
+        issuePendingSavepoint();
     } else {
         // Normal mode: acquire from pool (RAII - released when connHolder destructs)
         connHolder = std::make_unique<DbConnection>(pool_->acquire());
@@ -108,48 +421,98 @@ int PostgreSQLQueryExecutor::executeCommand(
         paramValues.push_back(param.empty() ? nullptr : param.c_str());
     }
 
-    // Execute parameterized query
-    PGresult* res = PQexecParams(
-        pgconn,
-        query.c_str(),
-        params.size(),
-        nullptr,
-        paramValues.data(),
-        nullptr,
-        nullptr,
-        0
-    );
+    int affectedRows = runCommand(pgconn, query, paramValues);
+    // In normal mode, connHolder destructs here and returns connection to pool
 
-    if (!res) {
-        throw std::runtime_error("[PostgreSQLQueryExecutor] Query execution failed: null result");
+    spdlog::debug("[PostgreSQLQueryExecutor] Command executed, affected rows: {}", affectedRows);
+    return affectedRows;
+}
+
+int PostgreSQLQueryExecutor::executeBatch(
+    const std::string& query,
+    const std::vector<std::vector<std::string>>& paramRows
+)
+{
+    if (paramRows.empty()) return 0;
+
+    const size_t paramsPerRow = paramRows.front().size();
+    for (const auto& params : paramRows) {
+        if (params.size() != paramsPerRow) {
+            throw std::invalid_argument("[PostgreSQLQueryExecutor] executeBatch: rows have different parameter counts");
+        }
     }
 
-    // Check execution status
-    ExecStatusType status = PQresultStatus(res);
-    if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK) {
-        std::string error = PQerrorMessage(pgconn);
-        PQclear(res);
-        throw std::runtime_error("[PostgreSQLQueryExecutor] Query failed: " + error);
+    PGconn* pgconn = nullptr;
+    std::unique_ptr<DbConnection> connHolder;
+    if (inBatchOnThisThread() && batchConn_ && batchConn_->isValid()) {
+        pgconn = batchConn_->get();
+        issuePendingSavepoint();
+    } else {
+        connHolder = std::make_unique<DbConnection>(pool_->acquire());
+        if (!connHolder->isValid()) {
+            throw std::runtime_error("[PostgreSQLQueryExecutor] Failed to acquire connection from pool");
+        }
+        pgconn = connHolder->get();
     }
 
-    // Get number of affected rows
-    const char* affectedRowsStr = PQcmdTuples(res);
+    // libpq binds at most 65535 parameters per statement
+    const size_t rowsPerStatement = std::max<size_t>(1,
+        std::min(kMaxBatchRowsPerStatement, 65535 / std::max<size_t>(paramsPerRow, 1)));
+    const bool rewritable = !common::db::multiRowInsert(query, paramsPerRow, 1).empty();
+
+    // Fixed chunk sizes keep the multi-row statements few and cacheable
+    const std::vector<size_t> counts = rewritable
+        ? common::db::bucketedChunkSizes(paramRows.size(), rowsPerStatement)
+        : std::vector<size_t>(paramRows.size(), 1);
+
+    // Outside batch mode, several statements share one transaction so a failure
+    // leaves no earlier chunk committed (BulkWriter retries the rows one by one)
+    const bool ownTransaction = connHolder && counts.size() > 1;
+    auto exec = [pgconn](const char* sql) {
+        PGresult* res = PQexec(pgconn, sql);
+        bool ok = PQresultStatus(res) == PGRES_COMMAND_OK;
+        PQclear(res);
+        if (!ok) {
+            throw std::runtime_error(std::string("[PostgreSQLQueryExecutor] ") + sql + " failed: " + PQerrorMessage(pgconn));
+        }
+    };
+    if (ownTransaction) exec("BEGIN");
+
     int affectedRows = 0;
-    if (affectedRowsStr && affectedRowsStr[0] != '\0') {
-        affectedRows = std::atoi(affectedRowsStr);
-    }
+    std::vector<const char*> paramValues;
+    size_t first = 0;
+    try {
+        for (size_t count : counts) {
+            paramValues.clear();
+            for (size_t r = first; r < first + count; ++r) {
+                for (const auto& param : paramRows[r]) {
+                    paramValues.push_back(param.empty() ? nullptr : param.c_str());
+                }
+            }
 
-    PQclear(res);
-    // In normal mode, connHolder destructs here and returns connection to pool
+            affectedRows += rewritable
+                ? runCommand(pgconn, common::db::multiRowInsert(query, paramsPerRow, count), paramValues)
+                : runCommand(pgconn, query, paramValues);
+            first += count;
+        }
+        if (ownTransaction) exec("COMMIT");
+    } catch (...) {
+        if (ownTransaction) {
+            PGresult* res = PQexec(pgconn, "ROLLBACK");
+            PQclear(res);
+        }
+        throw;
+    }
 
-    spdlog::debug("[PostgreSQLQueryExecutor] Command executed, affected rows: {}", affectedRows);
+    spdlog::debug("[PostgreSQLQueryExecutor] Batch of {} rows executed ({}), affected rows: {}",
+                  paramRows.size(), rewritable ? "multi-row VALUES" : "row by row", affectedRows);
     return affectedRows;
 }
 
 // ── Batch mode lifecycle ──
 
 void PostgreSQLQueryExecutor::beginBatch() {
-    if (batchMode_) {
+    if (batchThread_.load() != std::thread::id()) {
         spdlog::debug("[PostgreSQLQueryExecutor] beginBatch called but already in batch mode — ignoring");
         return;
     }
@@ -171,15 +534,15 @@ void PostgreSQLQueryExecutor::beginBatch() {
     }
     PQclear(res);
 
-    batchMode_ = true;
+    batchThread_ = std::this_thread::get_id();
     spdlog::info("[PostgreSQLQueryExecutor] Batch mode started (connection pinned, transaction BEGIN)");
 }
 
 void PostgreSQLQueryExecutor::endBatch() {
-    if (!batchMode_) return;
+    if (!inBatchOnThisThread()) return;
 
     // Reset state first so re-entry is safe even if we throw
-    batchMode_ = false;
+    pendingSavepoint_.clear();
 
     if (batchConn_ && batchConn_->isValid()) {
         PGresult* res = PQexec(batchConn_->get(), "COMMIT");
@@ -187,29 +550,36 @@ void PostgreSQLQueryExecutor::endBatch() {
         std::string error = (status != PGRES_COMMAND_OK) ? PQerrorMessage(batchConn_->get()) : "";
         PQclear(res);
         batchConn_.reset();  // Release connection back to pool
+        batchThread_ = std::thread::id();
 
         if (status != PGRES_COMMAND_OK) {
             throw std::runtime_error("[PostgreSQLQueryExecutor] COMMIT failed: " + error);
         }
     } else {
         batchConn_.reset();
+        batchThread_ = std::thread::id();
     }
 
     spdlog::info("[PostgreSQLQueryExecutor] Batch mode ended (committed + connection released)");
 }
 
 void PostgreSQLQueryExecutor::savepoint(const std::string& name) {
-    if (!batchMode_ || !batchConn_ || !batchConn_->isValid()) return;
+    if (!inBatchOnThisThread() || !batchConn_ || !batchConn_->isValid()) return;
 
-    PGresult* res = PQexec(batchConn_->get(), ("SAVEPOINT " + name).c_str());
-    if (PQresultStatus(res) != PGRES_COMMAND_OK) {
-        spdlog::warn("[PostgreSQLQueryExecutor] SAVEPOINT {} failed: {}", name, PQerrorMessage(batchConn_->get()));
-    }
-    PQclear(res);
+    // Deferred until the next statement on the batch connection: entries that only
+    // stage rows (BulkWriter) or read through other connections cost no round trip
+    pendingSavepoint_ = name;
 }
 
 void PostgreSQLQueryExecutor::rollbackToSavepoint(const std::string& name) {
-    if (!batchMode_ || !batchConn_ || !batchConn_->isValid()) return;
+    if (!inBatchOnThisThread() || !batchConn_ || !batchConn_->isValid()) return;
+
+    if (pendingSavepoint_ == name) {
+        // Never issued: nothing ran on the batch connection since, nothing to undo
+        pendingSavepoint_.clear();
+        return;
+    }
+    pendingSavepoint_.clear();
 
     PGresult* res = PQexec(batchConn_->get(), ("ROLLBACK TO SAVEPOINT " + name).c_str());
     if (PQresultStatus(res) != PGRES_COMMAND_OK) {
@@ -218,6 +588,18 @@ void PostgreSQLQueryExecutor::rollbackToSavepoint(const std::string& name) {
     PQclear(res);
 }
 
+void PostgreSQLQueryExecutor::issuePendingSavepoint() {
+    if (pendingSavepoint_.empty()) return;
+
+    std::string name;
+    name.swap(pendingSavepoint_);
+    PGresult* res = PQexec(batchConn_->get(), ("SAVEPOINT " + name).c_str());
+    if (PQresultStatus(res) != PGRES_COMMAND_OK) {
+        spdlog::warn("[PostgreSQLQueryExecutor] SAVEPOINT {} failed: {}", name, PQerrorMessage(batchConn_->get()));
+    }
+    PQclear(res);
+}
+
 Json::Value PostgreSQLQueryExecutor::executeScalar(
     const std::string& query,
     const std::vector<std::string>& params
@@ -238,16 +620,7 @@ Json::Value PostgreSQLQueryExecutor::executeScalar(
     }
 
     // Execute parameterized query
-    PGresult* res = PQexecParams(
-        conn.get(),
-        query.c_str(),
-        params.size(),
-        nullptr,
-        paramValues.data(),
-        nullptr,
-        nullptr,
-        0
-    );
+    PGresult* res = execParams(conn.get(), query, paramValues, 0);
 
     if (!res) {
         throw std::runtime_error("[PostgreSQLQueryExecutor] Query execution failed: null result");
@@ -298,6 +671,61 @@ Json::Value PostgreSQLQueryExecutor::executeScalar(
 
 // --- Private Implementation ---
 
+int PostgreSQLQueryExecutor::runCommand(
+    PGconn* conn,
+    const std::string& query,
+    const std::vector<const char*>& paramValues
+)
+{
+    PGresult* res = execParams(conn, query, paramValues, 0);
+
+    if (!res) {
+        throw std::runtime_error("[PostgreSQLQueryExecutor] Query execution failed: null result");
+    }
+
+    // Check execution status
+    ExecStatusType status = PQresultStatus(res);
+    if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK) {
+        std::string error = PQerrorMessage(conn);
+        PQclear(res);
+        throw std::runtime_error("[PostgreSQLQueryExecutor] Query failed: " + error);
+    }
+
+    // Get number of affected rows
+    const char* affectedRowsStr = PQcmdTuples(res);
+    int affectedRows = 0;
+    if (affectedRowsStr && affectedRowsStr[0] != '\0') {
+        affectedRows = std::atoi(affectedRowsStr);
+    }
+
+    PQclear(res);
+    return affectedRows;
+}
+
+PGresult* PostgreSQLQueryExecutor::execParams(
+    PGconn* conn,
+    const std::string& query,
+    const std::vector<const char*>& paramValues,
+    int resultFormat
+)
+{
+    // Parameterless SQL is usually DDL or built with inline literals: preparing it
+    // would only churn the LRU, so it keeps the one-shot unnamed statement
+    size_t cacheSize = pool_->statementCacheSize();
+    PgStatementCache* cache = (cacheSize > 0 && !paramValues.empty())
+        ? PgStatementCache::forConnection(conn, cacheSize) : nullptr;
+    if (!cache) {
+        return PQexecParams(conn, query.c_str(), static_cast<int>(paramValues.size()), nullptr,
+                            paramValues.data(), nullptr, nullptr, resultFormat);
+    }
+
+    bool prepared = false;
+    PGresult* res = cache->execute(conn, query, static_cast<int>(paramValues.size()),
+                                   paramValues.data(), resultFormat, prepared);
+    pool_->recordStatementExecution(prepared);
+    return res;
+}
+
 PGresult* PostgreSQLQueryExecutor::executeRawQuery(
     const std::string& query,
     const std::vector<std::string>& params
@@ -317,16 +745,7 @@ PGresult* PostgreSQLQueryExecutor::executeRawQuery(
     }
 
     // Execute parameterized query
-    PGresult* res = PQexecParams(
-        conn.get(),                    // Connection
-        query.c_str(),                 // Query string
-        params.size(),                 // Number of parameters
-        nullptr,                       // Parameter types (nullptr = infer)
-        paramValues.data(),            // Parameter values
-        nullptr,                       // Parameter lengths (nullptr = text)
-        nullptr,                       // Parameter formats (nullptr = text)
-        0                              // Result format (0 = text)
-    );
+    PGresult* res = execParams(conn.get(), query, paramValues, 0);
 
     if (!res) {
         throw std::runtime_error("[PostgreSQLQueryExecutor] Query execution failed: null result");
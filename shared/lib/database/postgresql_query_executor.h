@@ -3,7 +3,9 @@
 #include "i_query_executor.h"
 #include "db_connection_pool.h"
 #include <libpq-fe.h>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 /**
  * @file postgresql_query_executor.h
@@ -13,6 +15,10 @@
  * Handles connection acquisition from pool, query execution,
  * result parsing, and JSON conversion.
  *
+ * Parameterized statements are prepared once per pooled connection and
+ * re-executed by name (see PgStatementCache); DB_STATEMENT_CACHE_SIZE=0
+ * restores plain PQexecParams.
+ *
  * @date 2026-02-04
  */
 
@@ -51,6 +57,49 @@ public:
         const std::vector<std::string>& params = {}
     ) override;
 
+    /**
+     * @brief Execute SELECT query with binary result format
+     *
+     * Uses PQexecParams with resultFormat=1: bytea arrives as raw bytes and
+     * integers in network byte order, read in place by the cursor without
+     * building Json::Value rows. Supports text-like, bytea, bool, integer,
+     * float and uuid columns; other types (e.g. timestamps) must be cast to
+     * text in the query.
+     *
+     * @param query SQL query with $1, $2 placeholders
+     * @param params Query parameters
+     * @param consumer Called once with the cursor over the result
+     * @throws std::runtime_error on execution failure or unsupported column type
+     */
+    void executeQueryRows(
+        const std::string& query,
+        const std::vector<std::string>& params,
+        const RowConsumer& consumer
+    ) override;
+
+    /**
+     * @brief Execute SELECT query through a server-side binary cursor
+     *
+     * Opens a read-only transaction on a pooled connection, declares a
+     * NO SCROLL BINARY cursor for the query and FETCHes fetchRows at a time
+     * as the consumer advances, so only one chunk is resident. The cursor is
+     * closed (ROLLBACK) when the consumer returns or throws.
+     *
+     * Column types as for executeQueryRows(). Ignores batch mode.
+     *
+     * @param query SQL query with $1, $2 placeholders
+     * @param params Query parameters
+     * @param consumer Called once with the cursor
+     * @param fetchRows Rows per FETCH
+     * @throws std::runtime_error on execution failure
+     */
+    void executeQueryStream(
+        const std::string& query,
+        const std::vector<std::string>& params,
+        const RowConsumer& consumer,
+        size_t fetchRows = 500
+    ) override;
+
     /**
      * @brief Execute INSERT/UPDATE/DELETE command
      *
@@ -64,6 +113,26 @@ public:
         const std::vector<std::string>& params
     ) override;
 
+    /**
+     * @brief Execute a command once per parameter row
+     *
+     * Single-tuple INSERT ... VALUES statements are rewritten to multi-row
+     * VALUES (up to kMaxBatchRowsPerStatement rows, 65535 parameters per
+     * statement; smaller chunks use bucketedChunkSizes() so only a few
+     * statement shapes reach the statement cache); other commands run row by
+     * row on one connection. Outside batch mode the statements run in one
+     * transaction, so the call either applies every row or none.
+     *
+     * @param query SQL command with $1, $2 placeholders
+     * @param paramRows One parameter vector per row
+     * @return Total affected rows
+     * @throws std::runtime_error on execution failure
+     */
+    int executeBatch(
+        const std::string& query,
+        const std::vector<std::vector<std::string>>& paramRows
+    ) override;
+
     /**
      * @brief Execute scalar query (single value)
      *
@@ -95,6 +164,8 @@ public:
 
     /**
      * @brief Create SAVEPOINT within batch transaction for error recovery
+     *
+     * Sent lazily, just before the next command on the batch connection.
      */
     void savepoint(const std::string& name) override;
 
@@ -103,6 +174,9 @@ public:
      */
     void rollbackToSavepoint(const std::string& name) override;
 
+    /// Rows per multi-row INSERT sent by executeBatch()
+    static constexpr size_t kMaxBatchRowsPerStatement = 500;
+
 private:
     DbConnectionPool* pool_;  ///< PostgreSQL connection pool
 
@@ -137,10 +211,46 @@ private:
         const std::vector<std::string>& params
     );
 
+    /**
+     * @brief Run a parameterized statement on a connection
+     *
+     * Goes through the connection's PgStatementCache (PQprepare once, then
+     * PQexecPrepared) unless the pool's statement cache is disabled.
+     *
+     * @param conn Connection to run on
+     * @param query SQL query
+     * @param paramValues Text parameter values (nullptr = NULL)
+     * @param resultFormat 0 = text, 1 = binary
+     * @return PGresult* (caller owns, must clear; nullptr only on libpq failure)
+     */
+    PGresult* execParams(
+        PGconn* conn,
+        const std::string& query,
+        const std::vector<const char*>& paramValues,
+        int resultFormat
+    );
+
+    /**
+     * @brief Run a command and return PQcmdTuples
+     * @throws std::runtime_error on execution failure
+     */
+    int runCommand(
+        PGconn* conn,
+        const std::string& query,
+        const std::vector<const char*>& paramValues
+    );
+
+    /// Send the SAVEPOINT deferred by savepoint(), if any
+    void issuePendingSavepoint();
+
+    /// Batch mode is active and was started by the calling thread
+    bool inBatchOnThisThread() const { return batchThread_.load() == std::this_thread::get_id(); }
+
     /// @name Batch mode (v2.26.1 — connection pinning + transaction wrapping)
 
-    bool batchMode_ = false;                                    ///< Whether batch mode is active
-    std::unique_ptr<DbConnection> batchConn_;                   ///< Pinned connection for batch mode
+    std::atomic<std::thread::id> batchThread_{};                ///< Thread that called beginBatch (default id = off)
+    std::unique_ptr<DbConnection> batchConn_;                   ///< Pinned connection (batch thread only)
+    std::string pendingSavepoint_;                              ///< SAVEPOINT not yet sent (batch thread only)
 };
 
 } // namespace common
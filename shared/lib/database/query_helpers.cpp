@@ -5,8 +5,12 @@
  */
 
 #include "query_helpers.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 namespace common::db {
 
@@ -125,4 +129,128 @@ std::string intervalHours(const std::string& dbType, int hours) {
     return ss.str();
 }
 
+// ============================================================================
+// Bulk INSERT rewriting
+// ============================================================================
+
+namespace {
+
+/// Index just past a quoted literal or identifier starting at pos
+size_t skipQuoted(const std::string& sql, size_t pos) {
+    char quote = sql[pos];
+    for (size_t i = pos + 1; i < sql.size(); ++i) {
+        if (sql[i] == quote) {
+            if (i + 1 < sql.size() && sql[i + 1] == quote) { ++i; continue; }  // escaped
+            return i + 1;
+        }
+    }
+    return sql.size();
+}
+
+bool matchKeyword(const std::string& sql, size_t pos, const char* keyword) {
+    size_t len = std::strlen(keyword);
+    if (pos + len > sql.size()) return false;
+    for (size_t i = 0; i < len; ++i) {
+        if (std::toupper(static_cast<unsigned char>(sql[pos + i])) != keyword[i]) return false;
+    }
+    auto isWordChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+    if (pos > 0 && isWordChar(sql[pos - 1])) return false;
+    return pos + len == sql.size() || !isWordChar(sql[pos + len]);
+}
+
+} // anonymous namespace
+
+std::string multiRowInsert(const std::string& insertSql, size_t paramsPerRow, size_t rowCount) {
+    if (rowCount == 0 || paramsPerRow == 0) return "";
+
+    size_t start = insertSql.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos || !matchKeyword(insertSql, start, "INSERT")) return "";
+
+    // Locate the top-level VALUES keyword (outside literals and parentheses)
+    size_t valuesPos = std::string::npos;
+    int depth = 0;
+    for (size_t i = start; i < insertSql.size(); ++i) {
+        char c = insertSql[i];
+        if (c == '\'' || c == '"') { i = skipQuoted(insertSql, i) - 1; continue; }
+        if (c == '(') depth++;
+        else if (c == ')') depth--;
+        else if (depth == 0 && matchKeyword(insertSql, i, "VALUES")) { valuesPos = i; break; }
+    }
+    if (valuesPos == std::string::npos) return "";
+
+    size_t tupleStart = insertSql.find_first_not_of(" \t\r\n", valuesPos + 6);
+    if (tupleStart == std::string::npos || insertSql[tupleStart] != '(') return "";
+
+    // Split the tuple into literal text and placeholder numbers
+    std::vector<std::string> chunks(1);
+    std::vector<size_t> placeholders;
+    size_t tupleEnd = std::string::npos;
+    depth = 0;
+    for (size_t i = tupleStart; i < insertSql.size(); ++i) {
+        char c = insertSql[i];
+        if (c == '\'' || c == '"') {
+            size_t end = skipQuoted(insertSql, i);
+            chunks.back().append(insertSql, i, end - i);
+            i = end - 1;
+            continue;
+        }
+        if (c == '$' && i + 1 < insertSql.size() && std::isdigit(static_cast<unsigned char>(insertSql[i + 1]))) {
+            size_t j = i + 1;
+            size_t n = 0;
+            while (j < insertSql.size() && std::isdigit(static_cast<unsigned char>(insertSql[j]))) {
+                n = n * 10 + static_cast<size_t>(insertSql[j] - '0');
+                j++;
+            }
+            if (n == 0 || n > paramsPerRow) return "";
+            placeholders.push_back(n);
+            chunks.emplace_back();
+            i = j - 1;
+            continue;
+        }
+        chunks.back() += c;
+        if (c == '(') depth++;
+        else if (c == ')' && --depth == 0) { tupleEnd = i + 1; break; }
+    }
+    if (tupleEnd == std::string::npos) return "";
+
+    // A second tuple or a parameter in the tail cannot be repeated safely
+    std::string tail = insertSql.substr(tupleEnd);
+    size_t tailStart = tail.find_first_not_of(" \t\r\n");
+    if (tailStart != std::string::npos && tail[tailStart] == ',') return "";
+    for (size_t i = 0; i < tail.size(); ++i) {
+        if (tail[i] == '\'' || tail[i] == '"') { i = skipQuoted(tail, i) - 1; continue; }
+        if (tail[i] == '$') return "";
+    }
+
+    std::string sql = insertSql.substr(0, tupleStart);
+    sql.reserve(sql.size() + rowCount * (tupleEnd - tupleStart + 8) + tail.size());
+    for (size_t row = 0; row < rowCount; ++row) {
+        if (row > 0) sql += ", ";
+        size_t offset = row * paramsPerRow;
+        for (size_t k = 0; k < placeholders.size(); ++k) {
+            sql += chunks[k];
+            sql += '$';
+            sql += std::to_string(placeholders[k] + offset);
+        }
+        sql += chunks.back();
+    }
+    sql += tail;
+    return sql;
+}
+
+std::vector<size_t> bucketedChunkSizes(size_t totalRows, size_t maxRows) {
+    std::vector<size_t> sizes;
+    maxRows = std::max<size_t>(maxRows, 1);
+    for (; totalRows >= maxRows; totalRows -= maxRows) {
+        sizes.push_back(maxRows);
+    }
+    for (size_t bucket = size_t{1} << 62; totalRows > 0; bucket >>= 1) {
+        if (totalRows >= bucket) {
+            sizes.push_back(bucket);
+            totalRows -= bucket;
+        }
+    }
+    return sizes;
+}
+
 } // namespace common::db
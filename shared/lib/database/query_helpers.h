@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <json/json.h>
 
 /**
@@ -155,4 +156,33 @@ std::string hexPrefix(const std::string& dbType);
  */
 std::string intervalHours(const std::string& dbType, int hours);
 
+/**
+ * @brief Expand a single-row INSERT into a multi-row VALUES statement
+ *
+ * Repeats the VALUES tuple rowCount times, renumbering $N placeholders so row
+ * k uses $(N + k * paramsPerRow). Text after the tuple (ON CONFLICT ...,
+ * RETURNING ...) is kept once. Used by PostgreSQLQueryExecutor::executeBatch().
+ *
+ * @param insertSql "INSERT INTO t (a, b) VALUES ($1, $2) [tail]"
+ * @param paramsPerRow Parameters bound per row
+ * @param rowCount Number of rows (>= 1)
+ * @return Multi-row statement, or "" if the statement is not a single-tuple
+ *         INSERT ... VALUES or its tail references parameters
+ */
+std::string multiRowInsert(const std::string& insertSql, size_t paramsPerRow, size_t rowCount);
+
+/**
+ * @brief Split a row count into statement sizes from a fixed set
+ *
+ * Full chunks of maxRows, then the remainder as descending powers of two.
+ * Statements whose SQL grows with the row count (multi-row VALUES) then take
+ * at most ~log2(maxRows) + 1 shapes, so they stay reusable in the per-connection
+ * statement cache instead of preparing every distinct tail size once.
+ *
+ * @param totalRows Rows to write
+ * @param maxRows Largest statement size (>= 1)
+ * @return Statement sizes in order; they sum to totalRows
+ */
+std::vector<size_t> bucketedChunkSizes(size_t totalRows, size_t maxRows);
+
 } // namespace common::db
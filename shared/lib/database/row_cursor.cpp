@@ -0,0 +1,171 @@
+/**
+ * @file row_cursor.cpp
+ * @brief JSON-backed RowCursor and bytea hex helpers
+ */
+
+#include "row_cursor.h"
+#include "i_query_executor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+namespace common {
+
+namespace {
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+std::string toLower(std::string_view s) {
+    std::string out(s);
+    std::transform(out.begin(), out.end(), out.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return out;
+}
+
+} // anonymous namespace
+
+// --- Hex helpers ---
+
+std::vector<uint8_t> decodeByteaHex(std::string_view hex) {
+    if (hex.size() >= 2 && hex[0] == '\\' && hex[1] == 'x') {
+        hex.remove_prefix(2);
+    }
+
+    std::vector<uint8_t> bytes;
+    bytes.reserve(hex.size() / 2);
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+        int hi = hexValue(hex[i]);
+        int lo = hexValue(hex[i + 1]);
+        if (hi < 0 || lo < 0) break;
+        bytes.push_back(static_cast<uint8_t>((hi << 4) | lo));
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> unwrapDoubleEncodedBytea(ByteSpan value) {
+    if (value.size() > 2 && value.data()[0] == '\\' && value.data()[1] == 'x') {
+        return decodeByteaHex(std::string_view(reinterpret_cast<const char*>(value.data()), value.size()));
+    }
+    return {};
+}
+
+// --- JsonRowCursor ---
+
+JsonRowCursor::JsonRowCursor(const Json::Value& rows) : rows_(rows) {}
+
+bool JsonRowCursor::next() {
+    if (!rows_.isArray() || nextRow_ >= rows_.size()) {
+        row_ = nullptr;
+        return false;
+    }
+    row_ = &rows_[nextRow_++];
+    return true;
+}
+
+int JsonRowCursor::columnIndex(std::string_view name) {
+    std::string key = toLower(name);
+    if (rows_.isArray() && !rows_.empty() && !rows_[0].isMember(key)) {
+        return -1;
+    }
+
+    auto it = std::find(columns_.begin(), columns_.end(), key);
+    if (it != columns_.end()) {
+        return static_cast<int>(it - columns_.begin());
+    }
+    columns_.push_back(std::move(key));
+    scratch_.resize(columns_.size());
+    bytes_.resize(columns_.size());
+    return static_cast<int>(columns_.size() - 1);
+}
+
+const Json::Value* JsonRowCursor::field(int col) const {
+    if (!row_ || col < 0 || static_cast<size_t>(col) >= columns_.size()) return nullptr;
+    const Json::Value* value = row_->find(columns_[col].data(), columns_[col].data() + columns_[col].size());
+    return (value && !value->isNull()) ? value : nullptr;
+}
+
+bool JsonRowCursor::isNull(int col) const {
+    return field(col) == nullptr;
+}
+
+std::string_view JsonRowCursor::getStringView(int col) const {
+    const Json::Value* value = field(col);
+    if (!value) return {};
+
+    if (value->isString()) {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        value->getString(&begin, &end);
+        return std::string_view(begin, static_cast<size_t>(end - begin));
+    }
+    if (value->isBool()) {
+        scratch_[col] = value->asBool() ? "t" : "f";
+    } else {
+        scratch_[col] = value->asString();
+    }
+    return scratch_[col];
+}
+
+int64_t JsonRowCursor::getInt(int col, int64_t defaultValue) const {
+    const Json::Value* value = field(col);
+    if (!value) return defaultValue;
+    if (value->isIntegral()) return value->asInt64();
+    if (value->isDouble()) return static_cast<int64_t>(value->asDouble());
+    if (value->isString()) {
+        std::string text = value->asString();
+        char* end = nullptr;
+        long long parsed = std::strtoll(text.c_str(), &end, 10);
+        return (end != text.c_str()) ? static_cast<int64_t>(parsed) : defaultValue;
+    }
+    return defaultValue;
+}
+
+bool JsonRowCursor::getBool(int col, bool defaultValue) const {
+    const Json::Value* value = field(col);
+    if (!value) return defaultValue;
+    if (value->isBool()) return value->asBool();
+    if (value->isIntegral()) return value->asInt64() != 0;
+    if (value->isString()) {
+        std::string text = value->asString();
+        return text == "1" || text == "t" || text == "true" || text == "TRUE";
+    }
+    return defaultValue;
+}
+
+ByteSpan JsonRowCursor::getBytes(int col) const {
+    std::string_view text = getStringView(col);
+    if (text.size() >= 2 && text[0] == '\\' && text[1] == 'x') {
+        bytes_[col] = decodeByteaHex(text);
+        return ByteSpan{bytes_[col].data(), bytes_[col].size()};
+    }
+    return ByteSpan{reinterpret_cast<const uint8_t*>(text.data()), text.size()};
+}
+
+// --- IQueryExecutor default ---
+
+void IQueryExecutor::executeQueryRows(
+    const std::string& query,
+    const std::vector<std::string>& params,
+    const RowConsumer& consumer)
+{
+    Json::Value rows = executeQuery(query, params);
+    JsonRowCursor cursor(rows);
+    consumer(cursor);
+}
+
+void IQueryExecutor::executeQueryStream(
+    const std::string& query,
+    const std::vector<std::string>& params,
+    const RowConsumer& consumer,
+    size_t /*fetchRows*/)
+{
+    executeQueryRows(query, params, consumer);
+}
+
+} // namespace common
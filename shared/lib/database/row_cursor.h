@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <json/json.h>
+
+/**
+ * @file row_cursor.h
+ * @brief Typed, zero-copy row access for bulk SELECT results
+ *
+ * IQueryExecutor::executeQuery() materializes every row as a Json::Value and
+ * returns binary columns as "\x..." hex strings that callers decode again.
+ * RowCursor lets bulk readers consume rows in place instead:
+ *
+ *   queryExecutor_->executeQueryRows(query, params, [&](common::RowCursor& rows) {
+ *       int dnCol = rows.columnIndex("subject_dn");
+ *       int derCol = rows.columnIndex("certificate_data");
+ *       while (rows.next()) {
+ *           std::string_view dn = rows.getStringView(dnCol);
+ *           common::ByteSpan der = rows.getBytes(derCol);  // raw DER, no hex
+ *       }
+ *   });
+ *
+ * Views returned by the getters stay valid until the next call to next().
+ *
+ * @date 2026-10-15
+ */
+
+namespace common {
+
+/**
+ * @brief Non-owning view of a binary column value
+ */
+struct ByteSpan {
+    const uint8_t* ptr = nullptr;
+    size_t len = 0;
+
+    const uint8_t* data() const { return ptr; }
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    const uint8_t* begin() const { return ptr; }
+    const uint8_t* end() const { return ptr + len; }
+};
+
+/**
+ * @brief Forward-only cursor over a query result
+ *
+ * Columns are addressed by position; resolve positions once with
+ * columnIndex() before the row loop. Getters on an out-of-range column or a
+ * NULL value return an empty view / the default value.
+ */
+class RowCursor {
+public:
+    virtual ~RowCursor() = default;
+
+    /**
+     * @brief Advance to the next row (call once before reading the first row)
+     * @return false when the result is exhausted
+     */
+    virtual bool next() = 0;
+
+    /**
+     * @brief Column position by name (case-insensitive)
+     * @return Column index, or -1 if the result has no such column
+     */
+    virtual int columnIndex(std::string_view name) = 0;
+
+    virtual bool isNull(int col) const = 0;
+
+    /// Text value of the column (integers, booleans and UUIDs are formatted)
+    virtual std::string_view getStringView(int col) const = 0;
+
+    virtual int64_t getInt(int col, int64_t defaultValue = 0) const = 0;
+
+    /// Handles PostgreSQL boolean and Oracle NUMBER(1) "1"/"0"
+    virtual bool getBool(int col, bool defaultValue = false) const = 0;
+
+    /// Raw column bytes; bytea/BLOB values arrive as stored, with no hex round-trip
+    virtual ByteSpan getBytes(int col) const = 0;
+
+    std::string getString(int col) const { return std::string(getStringView(col)); }
+};
+
+/**
+ * @brief Consumer invoked once with the cursor for the whole result
+ */
+using RowConsumer = std::function<void(RowCursor&)>;
+
+/**
+ * @brief RowCursor over an executeQuery() JSON result
+ *
+ * Backs the default IQueryExecutor::executeQueryRows() so executors and test
+ * doubles without a native implementation keep working. "\x"-prefixed hex
+ * strings are decoded for getBytes().
+ */
+class JsonRowCursor : public RowCursor {
+public:
+    explicit JsonRowCursor(const Json::Value& rows);
+
+    bool next() override;
+    int columnIndex(std::string_view name) override;
+    bool isNull(int col) const override;
+    std::string_view getStringView(int col) const override;
+    int64_t getInt(int col, int64_t defaultValue = 0) const override;
+    bool getBool(int col, bool defaultValue = false) const override;
+    ByteSpan getBytes(int col) const override;
+
+private:
+    const Json::Value* field(int col) const;
+
+    const Json::Value& rows_;
+    Json::ArrayIndex nextRow_ = 0;
+    const Json::Value* row_ = nullptr;
+    std::vector<std::string> columns_;                ///< Names registered by columnIndex()
+    mutable std::vector<std::string> scratch_;        ///< Per-column formatted text
+    mutable std::vector<std::vector<uint8_t>> bytes_; ///< Per-column decoded bytes
+};
+
+/**
+ * @brief Decode a PostgreSQL bytea hex value ("\x3082...") to bytes
+ *
+ * Values without the "\x" prefix (Oracle RAWTOHEX output) are decoded from
+ * plain hex. Decoding stops at the first invalid hex pair.
+ */
+std::vector<uint8_t> decodeByteaHex(std::string_view hex);
+
+/**
+ * @brief Unwrap a double-encoded bytea value
+ *
+ * Some legacy rows were stored as the bytes of a "\x..." string rather than
+ * the DER itself. Returns the decoded inner DER for such values and an empty
+ * vector otherwise.
+ */
+std::vector<uint8_t> unwrapDoubleEncodedBytea(ByteSpan value);
+
+} // namespace common
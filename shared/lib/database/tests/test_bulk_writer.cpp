@@ -0,0 +1,150 @@
+/**
+ * @file test_bulk_writer.cpp
+ * @brief Unit tests for BulkWriter and the default IQueryExecutor::executeBatch()
+ *
+ * No DB connection required: a recording stub executor stands in for
+ * PostgreSQL/Oracle and can be told to reject batches or single rows.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "bulk_writer.h"
+
+#include <stdexcept>
+
+using namespace common;
+
+namespace {
+
+class RecordingExecutor : public IQueryExecutor {
+public:
+    std::vector<std::string> calls;            ///< "batch:N", "cmd:<first param>", "sp", "rollback"
+    bool failBatch = false;
+    int batchAffected = -1;                    ///< Affected count reported by executeBatch (-1 = all rows)
+    std::string rejectFirstParam;              ///< executeCommand throws for this row
+
+    Json::Value executeQuery(const std::string&, const std::vector<std::string>&) override { return Json::arrayValue; }
+    int executeCommand(const std::string&, const std::vector<std::string>& params) override {
+        calls.push_back("cmd:" + (params.empty() ? std::string() : params[0]));
+        if (!params.empty() && params[0] == rejectFirstParam) {
+            throw std::runtime_error("duplicate key");
+        }
+        return 1;
+    }
+    int executeBatch(const std::string&, const std::vector<std::vector<std::string>>& rows) override {
+        if (failBatch) {
+            calls.push_back("batch-failed");
+            throw std::runtime_error("batch rejected");
+        }
+        calls.push_back("batch:" + std::to_string(rows.size()));
+        return batchAffected >= 0 ? batchAffected : static_cast<int>(rows.size());
+    }
+    Json::Value executeScalar(const std::string&, const std::vector<std::string>&) override { return Json::nullValue; }
+    std::string getDatabaseType() const override { return "postgres"; }
+    void savepoint(const std::string&) override { calls.push_back("sp"); }
+    void rollbackToSavepoint(const std::string&) override { calls.push_back("rollback"); }
+};
+
+/// Only implements executeCommand, so executeBatch() uses the interface default
+class CommandOnlyExecutor : public IQueryExecutor {
+public:
+    std::vector<std::vector<std::string>> commands;
+
+    Json::Value executeQuery(const std::string&, const std::vector<std::string>&) override { return Json::arrayValue; }
+    int executeCommand(const std::string&, const std::vector<std::string>& params) override {
+        commands.push_back(params);
+        return 2;
+    }
+    Json::Value executeScalar(const std::string&, const std::vector<std::string>&) override { return Json::nullValue; }
+    std::string getDatabaseType() const override { return "oracle"; }
+};
+
+} // anonymous namespace
+
+TEST(ExecuteBatch, Default_RunsCommandPerRowAndSumsAffected) {
+    CommandOnlyExecutor executor;
+    int affected = executor.executeBatch("INSERT INTO t (a) VALUES ($1)", {{"x"}, {"y"}, {"z"}});
+    EXPECT_EQ(affected, 6);
+    ASSERT_EQ(executor.commands.size(), 3u);
+    EXPECT_EQ(executor.commands[2], std::vector<std::string>{"z"});
+}
+
+TEST(BulkWriter, Flush_SendsOneBatchUnderSavepoint) {
+    RecordingExecutor executor;
+    BulkWriter writer(&executor, "INSERT INTO t (a) VALUES ($1)");
+    writer.add({"a"});
+    writer.add({"b"});
+
+    EXPECT_EQ(writer.flush(), 2u);
+    EXPECT_EQ(executor.calls, (std::vector<std::string>{"sp", "batch:2"}));
+    EXPECT_EQ(writer.pending(), 0u);
+}
+
+TEST(BulkWriter, Flush_RowsSkippedOnConflict_NotCounted) {
+    RecordingExecutor executor;
+    executor.batchAffected = 1;
+    BulkWriter writer(&executor, "INSERT INTO t (a) VALUES ($1) ON CONFLICT (a) DO NOTHING");
+    writer.add({"new"});
+    writer.add({"existing"});
+
+    EXPECT_EQ(writer.flush(), 1u);
+    EXPECT_EQ(writer.failedRows(), 0u);
+}
+
+TEST(BulkWriter, Flush_Empty_NoCalls) {
+    RecordingExecutor executor;
+    BulkWriter writer(&executor, "INSERT INTO t (a) VALUES ($1)");
+    EXPECT_EQ(writer.flush(), 0u);
+    EXPECT_TRUE(executor.calls.empty());
+}
+
+TEST(BulkWriter, Flush_BatchFails_RetriesRowsAndSkipsRejected) {
+    RecordingExecutor executor;
+    executor.failBatch = true;
+    executor.rejectFirstParam = "bad";
+    BulkWriter writer(&executor, "INSERT INTO t (a) VALUES ($1)");
+    writer.add({"ok1"});
+    writer.add({"bad"});
+    writer.add({"ok2"});
+
+    EXPECT_EQ(writer.flush(), 2u);
+    EXPECT_EQ(writer.failedRows(), 1u);
+    EXPECT_EQ(executor.calls, (std::vector<std::string>{
+        "sp", "batch-failed", "rollback",
+        "sp", "cmd:ok1",
+        "sp", "cmd:bad", "rollback",
+        "sp", "cmd:ok2"}));
+}
+
+TEST(BulkWriter, Row_PatchBeforeFlush) {
+    RecordingExecutor executor;
+    BulkWriter writer(&executor, "INSERT INTO t (a, b) VALUES ($1, $2)", 2);
+    size_t index = writer.add({"id", ""});
+    EXPECT_FALSE(writer.full());
+    writer.row(index)[1] = "patched";
+    EXPECT_EQ(writer.row(index)[1], "patched");
+
+    writer.add({"id2", ""});
+    EXPECT_TRUE(writer.full());
+}
+
+TEST(BulkWriter, Truncate_DropsRowsStagedAfterMark) {
+    RecordingExecutor executor;
+    BulkWriter writer(&executor, "INSERT INTO t (a) VALUES ($1)");
+    writer.add({"kept"});
+    size_t mark = writer.pending();
+    writer.add({"undone1"});
+    writer.add({"undone2"});
+
+    writer.truncate(mark);
+    EXPECT_EQ(writer.pending(), 1u);
+    writer.truncate(5);  // past the end: no-op
+    EXPECT_EQ(writer.pending(), 1u);
+    EXPECT_EQ(writer.flush(), 1u);
+    EXPECT_EQ(executor.calls, (std::vector<std::string>{"sp", "batch:1"}));
+}
+
+TEST(BulkWriter, NullExecutor_Throws) {
+    EXPECT_THROW(BulkWriter(nullptr, "INSERT INTO t (a) VALUES ($1)"), std::invalid_argument);
+}
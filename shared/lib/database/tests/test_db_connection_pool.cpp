@@ -0,0 +1,195 @@
+/**
+ * @file test_db_connection_pool.cpp
+ * @brief Unit tests for the DbConnectionPool free list and fast path
+ *
+ * FakePool overrides the connection lifecycle hooks with opaque fake
+ * handles, so no PostgreSQL server is required. The calling thread's home
+ * shard is set explicitly through a thread-local.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "db_connection_pool.h"
+
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using common::DbConnectionPool;
+
+namespace {
+
+thread_local size_t t_homeShard = 0;
+
+class FakePool : public DbConnectionPool {
+public:
+    FakePool(size_t minSize, size_t maxSize, int idleValidationSec, size_t shards)
+        : DbConnectionPool("fake", minSize, maxSize, 1, idleValidationSec, 0, shards) {}
+
+    ~FakePool() override { shutdown(); }
+
+    PGconn* handle(size_t i) const { return created.at(i); }
+    void breakConnection(PGconn* conn) { broken.insert(conn); }
+
+    std::vector<PGconn*> created;
+    std::set<PGconn*> broken;
+    std::set<PGconn*> closed;
+    int healthChecks = 0;
+
+protected:
+    PGconn* createConnection() override {
+        storage_.push_back(std::make_unique<char>());
+        auto* conn = reinterpret_cast<PGconn*>(storage_.back().get());
+        created.push_back(conn);
+        return conn;
+    }
+
+    void closeConnection(PGconn* conn) override { closed.insert(conn); }
+
+    bool isConnectionHealthy(PGconn* conn) override {
+        ++healthChecks;
+        return broken.count(conn) == 0;
+    }
+
+    bool isReusableAfterUse(PGconn* conn) override { return broken.count(conn) == 0; }
+
+    size_t homeShard() const override { return t_homeShard % shardCount(); }
+
+private:
+    std::vector<std::unique_ptr<char>> storage_;
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// Shard selection
+// =============================================================================
+
+TEST(DbConnectionPool, Acquire_TakesFromHomeShard) {
+    FakePool pool(2, 4, 60, 2);  // initialize(): handle 0 → shard 0, handle 1 → shard 1
+    ASSERT_TRUE(pool.initialize());
+
+    t_homeShard = 1;
+    auto conn = pool.acquire();
+    EXPECT_EQ(conn.get(), pool.handle(1));
+}
+
+TEST(DbConnectionPool, Release_ReturnsToHomeShard) {
+    FakePool pool(2, 4, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+
+    t_homeShard = 0;
+    auto first = pool.acquire();
+    PGconn* mine = first.get();
+    first.release();
+
+    // Same thread gets its own (warmest) connection back
+    auto second = pool.acquire();
+    EXPECT_EQ(second.get(), mine);
+    EXPECT_EQ(pool.getStats().totalConnections, 2u);
+}
+
+TEST(DbConnectionPool, Acquire_EmptyHomeShard_StealsFromOtherShard) {
+    FakePool pool(1, 4, 60, 2);  // the only idle connection sits in shard 0
+    ASSERT_TRUE(pool.initialize());
+
+    t_homeShard = 1;
+    auto conn = pool.acquire();
+    EXPECT_EQ(conn.get(), pool.handle(0));
+    EXPECT_EQ(pool.created.size(), 1u);  // stolen, not newly created
+}
+
+TEST(DbConnectionPool, Acquire_AllShardsEmpty_CreatesUpToMax) {
+    FakePool pool(0, 2, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+
+    auto a = pool.acquire();
+    auto b = pool.acquire();
+    EXPECT_NE(a.get(), b.get());
+    EXPECT_EQ(pool.getStats().totalConnections, 2u);
+    EXPECT_THROW(pool.acquire(), std::runtime_error);  // max reached, 1s timeout
+}
+
+TEST(DbConnectionPool, Acquire_WaiterWokenByRelease) {
+    FakePool pool(1, 1, 60, 1);
+    ASSERT_TRUE(pool.initialize());
+
+    auto held = pool.acquire();
+    PGconn* handle = held.get();
+    std::thread releaser([&held]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        held.release();
+    });
+    auto conn = pool.acquire();
+    releaser.join();
+    EXPECT_EQ(conn.get(), handle);
+}
+
+// =============================================================================
+// Fast path vs legacy health checks
+// =============================================================================
+
+TEST(DbConnectionPool, FastPath_NoHealthCheckOnAcquireOrRelease) {
+    FakePool pool(2, 4, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+
+    for (int i = 0; i < 10; ++i) {
+        auto conn = pool.acquire();
+    }
+    EXPECT_EQ(pool.healthChecks, 0);
+    EXPECT_EQ(pool.getStats().acquireCount, 10u);
+}
+
+TEST(DbConnectionPool, Legacy_HealthCheckedOnAcquireAndRelease) {
+    FakePool pool(1, 4, 0, 1);
+    ASSERT_TRUE(pool.initialize());
+
+    { auto conn = pool.acquire(); }
+    EXPECT_EQ(pool.healthChecks, 2);
+}
+
+// =============================================================================
+// Broken connections
+// =============================================================================
+
+TEST(DbConnectionPool, FastPath_BrokenOnRelease_Discarded) {
+    FakePool pool(1, 4, 60, 1);
+    ASSERT_TRUE(pool.initialize());
+
+    PGconn* handle = nullptr;
+    {
+        auto conn = pool.acquire();
+        handle = conn.get();
+        pool.breakConnection(handle);
+    }
+    auto stats = pool.getStats();
+    EXPECT_EQ(stats.discardedConnections, 1u);
+    EXPECT_EQ(stats.availableConnections, 0u);
+    EXPECT_EQ(stats.totalConnections, 0u);
+    EXPECT_EQ(pool.closed.count(handle), 1u);
+
+    // Next acquire reconnects instead of handing out the dead handle
+    auto fresh = pool.acquire();
+    EXPECT_NE(fresh.get(), handle);
+}
+
+TEST(DbConnectionPool, Legacy_UnhealthyIdle_DiscardedOnAcquire) {
+    FakePool pool(1, 4, 0, 1);
+    ASSERT_TRUE(pool.initialize());
+    pool.breakConnection(pool.handle(0));
+
+    auto conn = pool.acquire();
+    EXPECT_NE(conn.get(), pool.handle(0));
+    EXPECT_EQ(pool.closed.count(pool.handle(0)), 1u);
+    EXPECT_EQ(pool.getStats().discardedConnections, 1u);
+}
+
+TEST(DbConnectionPool, Shutdown_ClosesIdleConnections) {
+    FakePool pool(3, 4, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+    pool.shutdown();
+    EXPECT_EQ(pool.closed.size(), 3u);
+    EXPECT_THROW(pool.acquire(), std::runtime_error);
+}
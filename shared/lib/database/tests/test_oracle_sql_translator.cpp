@@ -0,0 +1,142 @@
+/**
+ * @file test_oracle_sql_translator.cpp
+ * @brief Unit tests for OracleSqlTranslator (memoized PostgreSQL → Oracle rewrite)
+ *
+ * Pure string translation; no OCI or DB connection required.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "oracle_sql_translator.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace common;
+using Kind = OracleSqlTranslator::Kind;
+
+// =============================================================================
+// Translation rules
+// =============================================================================
+
+TEST(OracleSqlTranslator, Query_PlaceholdersAndLimitOffset) {
+    auto t = OracleSqlTranslator::translateUncached(
+        "SELECT id FROM certificate WHERE country_code = $1 LIMIT $2 OFFSET $3", Kind::Query);
+    EXPECT_EQ(t.sql, "SELECT id FROM certificate WHERE country_code = :1 OFFSET :3 ROWS FETCH NEXT :2 ROWS ONLY");
+    EXPECT_EQ(t.bindNames, (std::vector<std::string>{":1", ":2", ":3"}));
+    EXPECT_FALSE(t.isDml);
+    EXPECT_FALSE(t.returningStripped);
+}
+
+TEST(OracleSqlTranslator, Query_LimitOnly) {
+    auto t = OracleSqlTranslator::translateUncached("SELECT id FROM crl LIMIT 10", Kind::Query);
+    EXPECT_EQ(t.sql, "SELECT id FROM crl FETCH FIRST 10 ROWS ONLY");
+    EXPECT_TRUE(t.bindNames.empty());
+}
+
+TEST(OracleSqlTranslator, Query_ReturningStrippedAndClassifiedAsDml) {
+    auto t = OracleSqlTranslator::translateUncached(
+        "INSERT INTO certificate (id, subject_dn) VALUES ($1, $2) RETURNING id", Kind::Query);
+    EXPECT_EQ(t.sql, "INSERT INTO certificate (id, subject_dn) VALUES (:1, :2)");
+    EXPECT_TRUE(t.returningStripped);
+    EXPECT_TRUE(t.isDml);
+}
+
+TEST(OracleSqlTranslator, Command_NowCastsAndOnConflict) {
+    auto t = OracleSqlTranslator::translateUncached(
+        "INSERT INTO sync_status (id, status, checked_at) VALUES ($1, $2::VARCHAR, NOW()) "
+        "ON CONFLICT (id) DO NOTHING", Kind::Command);
+    EXPECT_EQ(t.sql, "INSERT INTO sync_status (id, status, checked_at) VALUES (:1, :2, SYSDATE)");
+    EXPECT_TRUE(t.isDml);
+}
+
+TEST(OracleSqlTranslator, Command_NullifIntegerAndCurrentTimestamp) {
+    auto t = OracleSqlTranslator::translateUncached(
+        "UPDATE uploaded_file SET total = NULLIF($1, '')::INTEGER, updated_at = CURRENT_TIMESTAMP WHERE id = $2",
+        Kind::Command);
+    EXPECT_EQ(t.sql,
+        "UPDATE uploaded_file SET total = CASE WHEN :1 IS NULL OR :1 = '' THEN NULL ELSE TO_NUMBER(:1) END, "
+        "updated_at = SYSTIMESTAMP WHERE id = :2");
+}
+
+TEST(OracleSqlTranslator, BindNames_RepeatedPlaceholderCountedOnce) {
+    auto t = OracleSqlTranslator::translateUncached(
+        "SELECT id FROM certificate WHERE subject_dn LIKE $1 OR serial_number LIKE $1", Kind::Query);
+    EXPECT_EQ(t.bindNames, (std::vector<std::string>{":1"}));
+}
+
+// =============================================================================
+// Cache
+// =============================================================================
+
+TEST(OracleSqlTranslator, Translate_SecondLookupIsHitAndShared) {
+    OracleSqlTranslator translator;
+    auto first = translator.translate("SELECT 1 FROM dual WHERE x = $1", Kind::Query);
+    auto second = translator.translate("SELECT 1 FROM dual WHERE x = $1", Kind::Query);
+    EXPECT_EQ(first.get(), second.get());
+
+    auto stats = translator.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST(OracleSqlTranslator, Translate_KindsCachedSeparately) {
+    OracleSqlTranslator translator;
+    const std::string sql = "UPDATE t SET ts = NOW() WHERE id = $1";
+    auto asQuery = translator.translate(sql, Kind::Query);
+    auto asCommand = translator.translate(sql, Kind::Command);
+    EXPECT_NE(asQuery->sql, asCommand->sql);
+    EXPECT_EQ(translator.stats().entries, 2u);
+}
+
+TEST(OracleSqlTranslator, Capacity_ClearsAndKeepsWorking) {
+    OracleSqlTranslator translator(4);
+    for (int i = 0; i < 10; ++i) {
+        translator.translate("SELECT " + std::to_string(i) + " FROM dual", Kind::Query);
+    }
+    auto stats = translator.stats();
+    EXPECT_LE(stats.entries, 4u);
+    EXPECT_GT(stats.resets, 0u);
+    EXPECT_EQ(translator.translate("SELECT 9 FROM dual", Kind::Query)->sql, "SELECT 9 FROM dual");
+}
+
+TEST(OracleSqlTranslator, Prewarm_FirstRequestIsHit) {
+    OracleSqlTranslator translator;
+    translator.prewarm({"SELECT a FROM t WHERE id = $1", "SELECT b FROM t LIMIT 5"}, Kind::Query);
+    translator.translate("SELECT b FROM t LIMIT 5", Kind::Query);
+    auto stats = translator.stats();
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+}
+
+TEST(OracleSqlTranslator, ConcurrentLookups_ConsistentResult) {
+    OracleSqlTranslator translator;
+    const std::string sql = "SELECT id FROM certificate WHERE fingerprint_sha256 = $1 LIMIT 1";
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&translator, &sql]() {
+            for (int i = 0; i < 1000; ++i) {
+                auto r = translator.translate(sql, Kind::Query);
+                ASSERT_EQ(r->sql, "SELECT id FROM certificate WHERE fingerprint_sha256 = :1 FETCH FIRST 1 ROWS ONLY");
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    auto stats = translator.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 8000u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST(OracleSqlTranslator, Metrics_ReportsHitRate) {
+    OracleSqlTranslator translator;
+    translator.translate("SELECT 1 FROM dual", Kind::Query);
+    translator.translate("SELECT 1 FROM dual", Kind::Query);
+    translator.translate("SELECT 1 FROM dual", Kind::Query);
+    translator.translate("SELECT 1 FROM dual", Kind::Query);
+    auto metrics = oracleSqlTranslationMetrics(translator);
+    EXPECT_DOUBLE_EQ(metrics["hitRate"].asDouble(), 0.75);
+    EXPECT_EQ(metrics["entries"].asUInt(), 1u);
+}
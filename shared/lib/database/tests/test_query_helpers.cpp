@@ -796,6 +796,59 @@ TEST_F(IntervalHoursTest, Idempotent_Oracle) {
 }
 
 
+// ============================================================================
+// multiRowInsert
+// ============================================================================
+
+TEST(MultiRowInsertTest, RenumbersPlaceholdersPerRow) {
+    std::string sql = multiRowInsert("INSERT INTO t (a, b) VALUES ($1, $2)", 2, 3);
+    EXPECT_EQ(sql, "INSERT INTO t (a, b) VALUES ($1, $2), ($3, $4), ($5, $6)");
+}
+
+TEST(MultiRowInsertTest, KeepsTailOnceAndRepeatedPlaceholders) {
+    std::string sql = multiRowInsert(
+        "insert into t (a, b, c) values ($1, NULLIF($2, '')::INTEGER, $1) ON CONFLICT (a) DO NOTHING", 2, 2);
+    EXPECT_EQ(sql, "insert into t (a, b, c) values ($1, NULLIF($2, '')::INTEGER, $1), "
+                   "($3, NULLIF($4, '')::INTEGER, $3) ON CONFLICT (a) DO NOTHING");
+}
+
+TEST(MultiRowInsertTest, IgnoresDollarInsideLiteral) {
+    std::string sql = multiRowInsert("INSERT INTO t (a, b) VALUES ($1, '$9 ''x''')", 1, 2);
+    EXPECT_EQ(sql, "INSERT INTO t (a, b) VALUES ($1, '$9 ''x'''), ($2, '$9 ''x''')");
+}
+
+TEST(MultiRowInsertTest, SingleRow_Unchanged) {
+    const std::string sql = "INSERT INTO t (a) VALUES ($1) RETURNING id";
+    EXPECT_EQ(multiRowInsert(sql, 1, 1), sql);
+}
+
+TEST(MultiRowInsertTest, NotRewritable_ReturnsEmpty) {
+    EXPECT_EQ(multiRowInsert("UPDATE t SET a = $1 WHERE id = $2", 2, 2), "");
+    EXPECT_EQ(multiRowInsert("INSERT INTO t (a) SELECT $1 FROM dual", 1, 2), "");
+    EXPECT_EQ(multiRowInsert("INSERT INTO t (a) VALUES ($1), ($2)", 1, 2), "");
+    EXPECT_EQ(multiRowInsert("INSERT INTO t (a) VALUES ($1) ON CONFLICT (a) DO UPDATE SET b = $2", 2, 2), "");
+    EXPECT_EQ(multiRowInsert("INSERT INTO t (a) VALUES ($3)", 2, 2), "");
+    EXPECT_EQ(multiRowInsert("INSERT INTO t (a) VALUES ($1)", 1, 0), "");
+}
+
+// ============================================================================
+// bucketedChunkSizes
+// ============================================================================
+
+TEST(BucketedChunkSizesTest, FullChunksThenPowersOfTwo) {
+    EXPECT_EQ(bucketedChunkSizes(1237, 500), (std::vector<size_t>{500, 500, 128, 64, 32, 8, 4, 1}));
+}
+
+TEST(BucketedChunkSizesTest, ExactMultipleAndEmpty) {
+    EXPECT_EQ(bucketedChunkSizes(1000, 500), (std::vector<size_t>{500, 500}));
+    EXPECT_TRUE(bucketedChunkSizes(0, 500).empty());
+}
+
+TEST(BucketedChunkSizesTest, ZeroMax_TreatedAsOne) {
+    EXPECT_EQ(bucketedChunkSizes(3, 0), (std::vector<size_t>{1, 1, 1}));
+}
+
+
 // ============================================================================
 // Cross-function consistency — same inputs, same outputs
 // ============================================================================
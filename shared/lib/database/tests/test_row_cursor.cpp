@@ -0,0 +1,202 @@
+/**
+ * @file test_row_cursor.cpp
+ * @brief Unit tests for JsonRowCursor, the default executeQueryRows() and bytea hex helpers
+ *
+ * No DB connection required: the default IQueryExecutor::executeQueryRows()
+ * is exercised through a stub executor returning canned JSON rows.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "i_query_executor.h"
+#include "row_cursor.h"
+
+#include <json/json.h>
+
+using namespace common;
+
+namespace {
+
+/// Rows shaped like PostgreSQLQueryExecutor::executeQuery() output
+Json::Value makeRows() {
+    Json::Value rows(Json::arrayValue);
+
+    Json::Value first(Json::objectValue);
+    first["subject_dn"] = "CN=CSCA KR,C=KR";
+    first["certificate_data"] = "\\x3082010a";
+    first["is_self_signed"] = true;
+    first["version"] = 3;
+    rows.append(first);
+
+    Json::Value second(Json::objectValue);
+    second["subject_dn"] = "CN=CSCA JP,C=JP";
+    second["certificate_data"] = Json::nullValue;
+    second["is_self_signed"] = "0";  // Oracle NUMBER(1)
+    second["version"] = "2";
+    rows.append(second);
+
+    return rows;
+}
+
+class StubExecutor : public IQueryExecutor {
+public:
+    Json::Value rows;
+    std::string lastQuery;
+    std::vector<std::string> lastParams;
+
+    Json::Value executeQuery(const std::string& query, const std::vector<std::string>& params) override {
+        lastQuery = query;
+        lastParams = params;
+        return rows;
+    }
+    int executeCommand(const std::string&, const std::vector<std::string>&) override { return 0; }
+    Json::Value executeScalar(const std::string&, const std::vector<std::string>&) override { return Json::nullValue; }
+    std::string getDatabaseType() const override { return "postgres"; }
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// decodeByteaHex / unwrapDoubleEncodedBytea
+// ============================================================================
+
+TEST(DecodeByteaHex, Prefixed_DecodesBytes) {
+    auto bytes = decodeByteaHex("\\x30820aFF");
+    EXPECT_EQ(bytes, (std::vector<uint8_t>{0x30, 0x82, 0x0a, 0xff}));
+}
+
+TEST(DecodeByteaHex, PlainHex_DecodesBytes) {
+    auto bytes = decodeByteaHex("3082");
+    EXPECT_EQ(bytes, (std::vector<uint8_t>{0x30, 0x82}));
+}
+
+TEST(DecodeByteaHex, InvalidPair_StopsDecoding) {
+    auto bytes = decodeByteaHex("\\x30zz82");
+    EXPECT_EQ(bytes, (std::vector<uint8_t>{0x30}));
+}
+
+TEST(UnwrapDoubleEncodedBytea, HexText_ReturnsInnerBytes) {
+    std::string stored = "\\x3082";
+    ByteSpan value{reinterpret_cast<const uint8_t*>(stored.data()), stored.size()};
+    EXPECT_EQ(unwrapDoubleEncodedBytea(value), (std::vector<uint8_t>{0x30, 0x82}));
+}
+
+TEST(UnwrapDoubleEncodedBytea, Der_ReturnsEmpty) {
+    const uint8_t der[] = {0x30, 0x82, 0x01};
+    EXPECT_TRUE(unwrapDoubleEncodedBytea(ByteSpan{der, sizeof(der)}).empty());
+}
+
+// ============================================================================
+// JsonRowCursor
+// ============================================================================
+
+TEST(JsonRowCursor, Iterate_VisitsAllRowsInOrder) {
+    Json::Value rows = makeRows();
+    JsonRowCursor cursor(rows);
+    int dn = cursor.columnIndex("subject_dn");
+
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.getStringView(dn), "CN=CSCA KR,C=KR");
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.getString(dn), "CN=CSCA JP,C=JP");
+    EXPECT_FALSE(cursor.next());
+}
+
+TEST(JsonRowCursor, ColumnIndex_CaseInsensitiveAndUnknown) {
+    Json::Value rows = makeRows();
+    JsonRowCursor cursor(rows);
+
+    int dn = cursor.columnIndex("SUBJECT_DN");
+    EXPECT_GE(dn, 0);
+    EXPECT_EQ(cursor.columnIndex("subject_dn"), dn);
+    EXPECT_EQ(cursor.columnIndex("no_such_column"), -1);
+}
+
+TEST(JsonRowCursor, GetBytes_DecodesHexAndHandlesNull) {
+    Json::Value rows = makeRows();
+    JsonRowCursor cursor(rows);
+    int data = cursor.columnIndex("certificate_data");
+
+    ASSERT_TRUE(cursor.next());
+    ByteSpan bytes = cursor.getBytes(data);
+    EXPECT_EQ(std::vector<uint8_t>(bytes.begin(), bytes.end()),
+              (std::vector<uint8_t>{0x30, 0x82, 0x01, 0x0a}));
+
+    ASSERT_TRUE(cursor.next());
+    EXPECT_TRUE(cursor.isNull(data));
+    EXPECT_TRUE(cursor.getBytes(data).empty());
+}
+
+TEST(JsonRowCursor, TypedGetters_PostgresAndOracleShapes) {
+    Json::Value rows = makeRows();
+    JsonRowCursor cursor(rows);
+    int selfSigned = cursor.columnIndex("is_self_signed");
+    int version = cursor.columnIndex("version");
+
+    ASSERT_TRUE(cursor.next());
+    EXPECT_TRUE(cursor.getBool(selfSigned));
+    EXPECT_EQ(cursor.getStringView(selfSigned), "t");
+    EXPECT_EQ(cursor.getInt(version), 3);
+    EXPECT_EQ(cursor.getStringView(version), "3");
+
+    ASSERT_TRUE(cursor.next());
+    EXPECT_FALSE(cursor.getBool(selfSigned, true));
+    EXPECT_EQ(cursor.getInt(version), 2);
+}
+
+TEST(JsonRowCursor, OutOfRangeColumn_ReturnsDefaults) {
+    Json::Value rows = makeRows();
+    JsonRowCursor cursor(rows);
+    ASSERT_TRUE(cursor.next());
+
+    EXPECT_TRUE(cursor.isNull(7));
+    EXPECT_TRUE(cursor.getStringView(-1).empty());
+    EXPECT_EQ(cursor.getInt(7, 42), 42);
+    EXPECT_TRUE(cursor.getBool(7, true));
+}
+
+TEST(JsonRowCursor, EmptyResult_NoRows) {
+    Json::Value rows(Json::arrayValue);
+    JsonRowCursor cursor(rows);
+    EXPECT_GE(cursor.columnIndex("anything"), 0);  // Unknown until a row exists
+    EXPECT_FALSE(cursor.next());
+}
+
+// ============================================================================
+// IQueryExecutor::executeQueryRows (default implementation)
+// ============================================================================
+
+TEST(ExecuteQueryRows, Default_DelegatesToExecuteQuery) {
+    StubExecutor executor;
+    executor.rows = makeRows();
+
+    std::vector<std::string> dns;
+    executor.executeQueryRows("SELECT subject_dn FROM certificate WHERE certificate_type = $1", {"CSCA"},
+        [&](RowCursor& cursor) {
+            int dn = cursor.columnIndex("subject_dn");
+            while (cursor.next()) {
+                dns.push_back(cursor.getString(dn));
+            }
+        });
+
+    EXPECT_EQ(executor.lastParams, (std::vector<std::string>{"CSCA"}));
+    EXPECT_EQ(dns, (std::vector<std::string>{"CN=CSCA KR,C=KR", "CN=CSCA JP,C=JP"}));
+}
+
+TEST(ExecuteQueryStream, Default_DelegatesToExecuteQueryRows) {
+    StubExecutor executor;
+    executor.rows = makeRows();
+
+    std::vector<std::string> dns;
+    executor.executeQueryStream("SELECT subject_dn FROM certificate WHERE certificate_type = $1", {"CSCA"},
+        [&](RowCursor& cursor) {
+            int dn = cursor.columnIndex("subject_dn");
+            while (cursor.next()) {
+                dns.push_back(cursor.getString(dn));
+            }
+        }, 1);
+
+    EXPECT_EQ(executor.lastParams, (std::vector<std::string>{"CSCA"}));
+    EXPECT_EQ(dns, (std::vector<std::string>{"CN=CSCA KR,C=KR", "CN=CSCA JP,C=JP"}));
+}
@@ -0,0 +1,192 @@
+/**
+ * @file blocking_executor.cpp
+ * @brief BlockingExecutor implementation
+ */
+
+#include "blocking_executor.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+namespace common {
+
+namespace {
+
+/// Positive integer from an environment variable, or fallback
+size_t envSize(const char* name, size_t fallback) {
+    const char* val = std::getenv(name);
+    if (!val || !*val) return fallback;
+    try {
+        long long v = std::stoll(val);
+        if (v >= 0) return static_cast<size_t>(v);
+    } catch (...) {}
+    spdlog::warn("[BlockingExecutor] Invalid {}='{}', using {}", name, val, fallback);
+    return fallback;
+}
+
+std::string trim(const std::string& s) {
+    auto begin = s.find_first_not_of(" \t");
+    if (begin == std::string::npos) return "";
+    auto end = s.find_last_not_of(" \t");
+    return s.substr(begin, end - begin + 1);
+}
+
+} // anonymous namespace
+
+// --- Config ---
+
+BlockingExecutor::Config BlockingExecutor::Config::fromEnvironment(Config defaults) {
+    Config config = std::move(defaults);
+    config.workers = std::max<size_t>(1, envSize("BLOCKING_EXECUTOR_WORKERS", config.workers));
+    config.maxQueueDepth = envSize("BLOCKING_EXECUTOR_QUEUE_DEPTH", config.maxQueueDepth);
+    config.defaultRouteLimit = envSize("BLOCKING_EXECUTOR_ROUTE_LIMIT", config.defaultRouteLimit);
+    config.retryAfterSeconds = static_cast<int>(std::clamp<size_t>(
+        envSize("BLOCKING_EXECUTOR_RETRY_AFTER_SECONDS", static_cast<size_t>(config.retryAfterSeconds)), 1, 3600));
+    if (const char* spec = std::getenv("BLOCKING_EXECUTOR_ROUTE_LIMITS")) {
+        for (auto& [route, limit] : parseRouteLimits(spec)) {
+            config.routeLimits[route] = limit;
+        }
+    }
+    return config;
+}
+
+std::map<std::string, size_t> BlockingExecutor::Config::parseRouteLimits(const std::string& spec) {
+    std::map<std::string, size_t> limits;
+    std::istringstream entries(spec);
+    std::string entry;
+    while (std::getline(entries, entry, ',')) {
+        auto eq = entry.find('=');
+        if (eq == std::string::npos) continue;
+        std::string route = trim(entry.substr(0, eq));
+        std::string value = trim(entry.substr(eq + 1));
+        if (route.empty() || value.empty()) continue;
+        try {
+            long long v = std::stoll(value);
+            if (v >= 0) limits[route] = static_cast<size_t>(v);
+        } catch (...) {
+            spdlog::warn("[BlockingExecutor] Ignoring route limit '{}'", entry);
+        }
+    }
+    return limits;
+}
+
+// --- BlockingExecutor ---
+
+BlockingExecutor::BlockingExecutor(Config config)
+    : config_(std::move(config))
+{
+    config_.workers = std::max<size_t>(1, config_.workers);
+    workers_.reserve(config_.workers);
+    for (size_t i = 0; i < config_.workers; i++) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+    spdlog::info("[BlockingExecutor] Started ({} workers, queue depth {}, {} route limits)",
+                 config_.workers, config_.maxQueueDepth, config_.routeLimits.size());
+}
+
+BlockingExecutor::~BlockingExecutor() {
+    shutdown();
+}
+
+size_t BlockingExecutor::routeLimit(const std::string& route) const {
+    auto it = config_.routeLimits.find(route);
+    return it != config_.routeLimits.end() ? it->second : config_.defaultRouteLimit;
+}
+
+BlockingExecutor::Admission BlockingExecutor::submit(const std::string& route, std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& routeStats = routes_[route];
+        routeStats.limit = routeLimit(route);
+
+        if (stopping_) {
+            rejectedShutDown_++;
+            routeStats.rejected++;
+            return Admission::ShutDown;
+        }
+        if (queue_.size() >= config_.maxQueueDepth) {
+            rejectedQueueFull_++;
+            routeStats.rejected++;
+            return Admission::QueueFull;
+        }
+        if (routeStats.limit > 0 && routeStats.inFlight >= routeStats.limit) {
+            rejectedRouteLimit_++;
+            routeStats.rejected++;
+            return Admission::RouteLimit;
+        }
+
+        routeStats.inFlight++;
+        routeStats.submitted++;
+        submitted_++;
+        queue_.push_back(Task{route, std::move(task), std::chrono::steady_clock::now()});
+    }
+    cv_.notify_one();
+    return Admission::Accepted;
+}
+
+void BlockingExecutor::workerLoop() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) return;  // stopping_ and drained
+
+            task = std::move(queue_.front());
+            queue_.pop_front();
+            running_++;
+
+            auto waitUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - task.enqueuedAt).count());
+            waitTotalUs_ += waitUs;
+            waitMaxUs_ = std::max(waitMaxUs_, waitUs);
+        }
+
+        try {
+            task.fn();
+        } catch (const std::exception& e) {
+            spdlog::error("[BlockingExecutor] Task for {} failed: {}", task.route, e.what());
+        } catch (...) {
+            spdlog::error("[BlockingExecutor] Task for {} failed with unknown exception", task.route);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_--;
+        completed_++;
+        routes_[task.route].inFlight--;
+    }
+}
+
+void BlockingExecutor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) return;
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    spdlog::info("[BlockingExecutor] Stopped");
+}
+
+BlockingExecutor::Stats BlockingExecutor::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.workers = config_.workers;
+    stats.queueDepth = queue_.size();
+    stats.maxQueueDepth = config_.maxQueueDepth;
+    stats.running = running_;
+    stats.submitted = submitted_;
+    stats.completed = completed_;
+    stats.rejectedQueueFull = rejectedQueueFull_;
+    stats.rejectedRouteLimit = rejectedRouteLimit_;
+    stats.rejected = rejectedQueueFull_ + rejectedRouteLimit_ + rejectedShutDown_;
+    stats.waitTotalUs = waitTotalUs_;
+    stats.waitMaxUs = waitMaxUs_;
+    stats.routes = routes_;
+    return stats;
+}
+
+} // namespace common
@@ -0,0 +1,136 @@
+/**
+ * @file blocking_executor.h
+ * @brief Bounded executor for blocking DB/LDAP work submitted by HTTP handlers
+ *
+ * Drogon runs every connection of an event loop on that loop's thread, so a
+ * handler that waits on a slow query or an LDAP timeout stalls all other
+ * connections on the loop. Handlers submit such work here instead and resume
+ * on their loop when it completes (see blocking_offload.h).
+ *
+ * Admission is fail-fast:
+ * - at most maxQueueDepth tasks wait for a worker (queue full → rejected)
+ * - a route may be capped to N in-flight tasks (queued + running) so one
+ *   slow endpoint cannot occupy every worker
+ * Rejected work is answered with 503 + Retry-After by the caller.
+ *
+ * Thread-safe.
+ *
+ * @author SMARTCORE Inc.
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common {
+
+class BlockingExecutor {
+public:
+    struct Config {
+        size_t workers = 16;
+        size_t maxQueueDepth = 256;                  ///< Waiting (not yet running) tasks
+        size_t defaultRouteLimit = 0;                ///< Per-route in-flight cap, 0 = unlimited
+        std::map<std::string, size_t> routeLimits;   ///< Route → in-flight cap (overrides default)
+        int retryAfterSeconds = 1;                   ///< Retry-After sent with 503 rejections
+
+        /**
+         * @brief Read BLOCKING_EXECUTOR_* environment variables
+         *
+         * BLOCKING_EXECUTOR_WORKERS, BLOCKING_EXECUTOR_QUEUE_DEPTH,
+         * BLOCKING_EXECUTOR_ROUTE_LIMIT (default cap),
+         * BLOCKING_EXECUTOR_ROUTE_LIMITS ("route=N,route=N"),
+         * BLOCKING_EXECUTOR_RETRY_AFTER_SECONDS. Invalid values keep the defaults.
+         */
+        static Config fromEnvironment(Config defaults);
+
+        /// Parse "route=N,route=N" (whitespace ignored, malformed entries skipped)
+        static std::map<std::string, size_t> parseRouteLimits(const std::string& spec);
+    };
+
+    struct RouteStats {
+        uint64_t submitted = 0;
+        uint64_t rejected = 0;
+        size_t inFlight = 0;
+        size_t limit = 0;   ///< 0 = unlimited
+    };
+
+    struct Stats {
+        size_t workers = 0;
+        size_t queueDepth = 0;
+        size_t maxQueueDepth = 0;
+        size_t running = 0;
+        uint64_t submitted = 0;       ///< Accepted tasks
+        uint64_t completed = 0;
+        uint64_t rejected = 0;        ///< Queue full + route limit + shut down
+        uint64_t rejectedQueueFull = 0;
+        uint64_t rejectedRouteLimit = 0;
+        uint64_t waitTotalUs = 0;     ///< Queue wait of started tasks
+        uint64_t waitMaxUs = 0;
+        std::map<std::string, RouteStats> routes;
+    };
+
+    enum class Admission { Accepted, QueueFull, RouteLimit, ShutDown };
+
+    explicit BlockingExecutor(Config config);
+    ~BlockingExecutor();
+
+    BlockingExecutor(const BlockingExecutor&) = delete;
+    BlockingExecutor& operator=(const BlockingExecutor&) = delete;
+
+    /**
+     * @brief Queue a task, or reject it immediately
+     * @param route Route name used for the concurrency cap and metrics
+     * @param task Blocking work (exceptions are caught and logged)
+     * @return Accepted, or why the task was rejected (task is not run)
+     */
+    Admission submit(const std::string& route, std::function<void()> task);
+
+    /** @brief Stop accepting work, finish queued tasks and join the workers */
+    void shutdown();
+
+    Stats stats() const;
+
+    int retryAfterSeconds() const { return config_.retryAfterSeconds; }
+
+private:
+    struct Task {
+        std::string route;
+        std::function<void()> fn;
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+
+    void workerLoop();
+    size_t routeLimit(const std::string& route) const;
+
+    Config config_;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Task> queue_;
+    bool stopping_ = false;
+
+    // Guarded by mutex_
+    size_t running_ = 0;
+    uint64_t submitted_ = 0;
+    uint64_t completed_ = 0;
+    uint64_t rejectedQueueFull_ = 0;
+    uint64_t rejectedRouteLimit_ = 0;
+    uint64_t rejectedShutDown_ = 0;
+    uint64_t waitTotalUs_ = 0;
+    uint64_t waitMaxUs_ = 0;
+    std::map<std::string, RouteStats> routes_;
+};
+
+} // namespace common
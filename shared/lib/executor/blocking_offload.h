@@ -0,0 +1,137 @@
+/**
+ * @file blocking_offload.h
+ * @brief Run Drogon handlers on a BlockingExecutor and resume on the event loop
+ *
+ * Usage in route registration (the handler itself is unchanged):
+ *
+ *   app.registerHandler("/api/x",
+ *       [this](const drogon::HttpRequestPtr& req, Callback&& callback) {
+ *           common::handler::runBlocking(executor_, "x.search", std::move(callback),
+ *               [this, req](Callback cb) { handleSearch(req, std::move(cb)); });
+ *       });
+ *
+ * The response callback handed to the handler posts back to the event loop
+ * the request arrived on. Without an executor (nullptr) the handler runs inline.
+ *
+ * Header-only; the consuming target links Drogon.
+ *
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "blocking_executor.h"
+#include <drogon/HttpResponse.h>
+#include <json/json.h>
+#include <spdlog/spdlog.h>
+#include <trantor/net/EventLoop.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace common::handler {
+
+using ResponseCallback = std::function<void(const drogon::HttpResponsePtr&)>;
+
+/**
+ * Create 503 Service Unavailable response for rejected blocking work.
+ */
+inline drogon::HttpResponsePtr serviceUnavailable(int retryAfterSeconds) {
+    Json::Value body;
+    body["success"] = false;
+    body["error"] = "Server busy, retry later";
+    auto resp = drogon::HttpResponse::newHttpJsonResponse(body);
+    resp->setStatusCode(drogon::k503ServiceUnavailable);
+    resp->addHeader("Retry-After", std::to_string(retryAfterSeconds));
+    return resp;
+}
+
+/**
+ * Wrap a response callback so it is invoked on the current thread's event loop,
+ * whichever thread calls it. Call on the loop thread (before offloading).
+ */
+inline ResponseCallback resumeOnLoop(ResponseCallback callback) {
+    trantor::EventLoop* loop = trantor::EventLoop::getEventLoopOfCurrentThread();
+    auto shared = std::make_shared<ResponseCallback>(std::move(callback));
+    return [loop, shared](const drogon::HttpResponsePtr& resp) {
+        if (loop && !loop->isInLoopThread()) {
+            loop->queueInLoop([shared, resp]() { (*shared)(resp); });
+        } else {
+            (*shared)(resp);
+        }
+    };
+}
+
+/**
+ * Run a callback-style handler on the executor.
+ *
+ * @param executor Executor (nullptr = run inline)
+ * @param route Route name for the per-route cap and metrics
+ * @param callback Drogon response callback
+ * @param handler Callable taking the (loop-resuming) response callback
+ *
+ * Responds 503 + Retry-After immediately when the executor rejects the work.
+ */
+template <typename Handler>
+void runBlocking(BlockingExecutor* executor, const std::string& route,
+                 ResponseCallback&& callback, Handler&& handler) {
+    if (!executor) {
+        handler(std::move(callback));
+        return;
+    }
+
+    ResponseCallback resume = resumeOnLoop(std::move(callback));
+    auto admission = executor->submit(route,
+        [route, resume, handler = std::forward<Handler>(handler)]() mutable {
+            try {
+                handler(resume);
+            } catch (const std::exception& e) {
+                spdlog::error("[{}] {}", route, e.what());
+                Json::Value body;
+                body["success"] = false;
+                body["error"] = "Internal server error";
+                auto resp = drogon::HttpResponse::newHttpJsonResponse(body);
+                resp->setStatusCode(drogon::k500InternalServerError);
+                resume(resp);
+            }
+        });
+
+    if (admission != BlockingExecutor::Admission::Accepted) {
+        spdlog::warn("[BlockingExecutor] Rejected {} ({})", route,
+                     admission == BlockingExecutor::Admission::RouteLimit ? "route limit" :
+                     admission == BlockingExecutor::Admission::QueueFull ? "queue full" : "shutting down");
+        resume(serviceUnavailable(executor->retryAfterSeconds()));
+    }
+}
+
+/**
+ * Executor statistics for /internal/metrics.
+ */
+inline Json::Value blockingExecutorMetrics(const BlockingExecutor& executor) {
+    auto stats = executor.stats();
+    Json::Value result;
+    result["workers"] = static_cast<Json::UInt>(stats.workers);
+    result["queueDepth"] = static_cast<Json::UInt>(stats.queueDepth);
+    result["maxQueueDepth"] = static_cast<Json::UInt>(stats.maxQueueDepth);
+    result["running"] = static_cast<Json::UInt>(stats.running);
+    result["submitted"] = static_cast<Json::UInt64>(stats.submitted);
+    result["completed"] = static_cast<Json::UInt64>(stats.completed);
+    result["rejected"] = static_cast<Json::UInt64>(stats.rejected);
+    result["rejectedQueueFull"] = static_cast<Json::UInt64>(stats.rejectedQueueFull);
+    result["rejectedRouteLimit"] = static_cast<Json::UInt64>(stats.rejectedRouteLimit);
+    result["waitTotalUs"] = static_cast<Json::UInt64>(stats.waitTotalUs);
+    result["waitMaxUs"] = static_cast<Json::UInt64>(stats.waitMaxUs);
+    result["routes"] = Json::objectValue;
+    for (const auto& [route, r] : stats.routes) {
+        Json::Value entry;
+        entry["submitted"] = static_cast<Json::UInt64>(r.submitted);
+        entry["rejected"] = static_cast<Json::UInt64>(r.rejected);
+        entry["inFlight"] = static_cast<Json::UInt>(r.inFlight);
+        entry["limit"] = static_cast<Json::UInt>(r.limit);
+        result["routes"][route] = entry;
+    }
+    return result;
+}
+
+} // namespace common::handler
@@ -0,0 +1,185 @@
+/**
+ * @file test_blocking_executor.cpp
+ * @brief Unit tests for BlockingExecutor admission control and metrics
+ *
+ * Tasks block on a gate so queue and in-flight counts are deterministic.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "blocking_executor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <future>
+#include <mutex>
+
+using namespace common;
+
+namespace {
+
+/// Holds tasks until opened
+class Gate {
+public:
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        entered_++;
+        enteredCv_.notify_all();
+        cv_.wait(lock, [this]() { return open_; });
+    }
+    void open() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+    void waitEntered(int n) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        enteredCv_.wait(lock, [this, n]() { return entered_ >= n; });
+    }
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable enteredCv_;
+    bool open_ = false;
+    int entered_ = 0;
+};
+
+BlockingExecutor::Config config(size_t workers, size_t depth) {
+    BlockingExecutor::Config c;
+    c.workers = workers;
+    c.maxQueueDepth = depth;
+    return c;
+}
+
+} // anonymous namespace
+
+TEST(BlockingExecutor, Submit_RunsTaskOnWorker) {
+    BlockingExecutor executor(config(2, 4));
+    std::promise<std::thread::id> ran;
+    auto ranFuture = ran.get_future();
+
+    EXPECT_EQ(executor.submit("r", [&ran]() { ran.set_value(std::this_thread::get_id()); }),
+              BlockingExecutor::Admission::Accepted);
+
+    EXPECT_NE(ranFuture.get(), std::this_thread::get_id());
+    executor.shutdown();
+    EXPECT_EQ(executor.stats().completed, 1u);
+}
+
+TEST(BlockingExecutor, Submit_QueueFull_RejectsImmediately) {
+    BlockingExecutor executor(config(1, 2));
+    Gate gate;
+
+    ASSERT_EQ(executor.submit("r", [&gate]() { gate.wait(); }), BlockingExecutor::Admission::Accepted);
+    gate.waitEntered(1);  // worker busy, queue empty
+    EXPECT_EQ(executor.submit("r", []() {}), BlockingExecutor::Admission::Accepted);
+    EXPECT_EQ(executor.submit("r", []() {}), BlockingExecutor::Admission::Accepted);
+    EXPECT_EQ(executor.submit("r", []() {}), BlockingExecutor::Admission::QueueFull);
+
+    auto stats = executor.stats();
+    EXPECT_EQ(stats.queueDepth, 2u);
+    EXPECT_EQ(stats.running, 1u);
+    EXPECT_EQ(stats.rejectedQueueFull, 1u);
+    EXPECT_EQ(stats.rejected, 1u);
+
+    gate.open();
+    executor.shutdown();
+    EXPECT_EQ(executor.stats().completed, 3u);
+}
+
+TEST(BlockingExecutor, Submit_RouteLimit_CapsOnlyThatRoute) {
+    auto c = config(4, 16);
+    c.routeLimits["slow"] = 1;
+    BlockingExecutor executor(c);
+    Gate gate;
+
+    ASSERT_EQ(executor.submit("slow", [&gate]() { gate.wait(); }), BlockingExecutor::Admission::Accepted);
+    EXPECT_EQ(executor.submit("slow", []() {}), BlockingExecutor::Admission::RouteLimit);
+    EXPECT_EQ(executor.submit("fast", []() {}), BlockingExecutor::Admission::Accepted);
+
+    auto stats = executor.stats();
+    EXPECT_EQ(stats.rejectedRouteLimit, 1u);
+    EXPECT_EQ(stats.routes["slow"].inFlight, 1u);
+    EXPECT_EQ(stats.routes["slow"].limit, 1u);
+    EXPECT_EQ(stats.routes["slow"].rejected, 1u);
+
+    gate.open();
+    executor.shutdown();
+    EXPECT_EQ(executor.stats().routes["slow"].inFlight, 0u);
+}
+
+TEST(BlockingExecutor, Submit_DefaultRouteLimit_AppliesToUnlistedRoutes) {
+    auto c = config(4, 16);
+    c.defaultRouteLimit = 1;
+    c.routeLimits["wide"] = 0;  // explicit 0 = unlimited
+    BlockingExecutor executor(c);
+    Gate gate;
+
+    ASSERT_EQ(executor.submit("a", [&gate]() { gate.wait(); }), BlockingExecutor::Admission::Accepted);
+    EXPECT_EQ(executor.submit("a", []() {}), BlockingExecutor::Admission::RouteLimit);
+    ASSERT_EQ(executor.submit("wide", [&gate]() { gate.wait(); }), BlockingExecutor::Admission::Accepted);
+    EXPECT_EQ(executor.submit("wide", []() {}), BlockingExecutor::Admission::Accepted);
+
+    gate.open();
+}
+
+TEST(BlockingExecutor, Submit_AfterShutdown_Rejected) {
+    BlockingExecutor executor(config(1, 4));
+    executor.shutdown();
+    EXPECT_EQ(executor.submit("r", []() {}), BlockingExecutor::Admission::ShutDown);
+    EXPECT_EQ(executor.stats().rejected, 1u);
+}
+
+TEST(BlockingExecutor, Task_Throws_WorkerKeepsRunning) {
+    BlockingExecutor executor(config(1, 4));
+    std::atomic<bool> ran{false};
+    executor.submit("r", []() { throw std::runtime_error("boom"); });
+    executor.submit("r", [&ran]() { ran = true; });
+    executor.shutdown();
+    EXPECT_TRUE(ran);
+    EXPECT_EQ(executor.stats().completed, 2u);
+}
+
+TEST(BlockingExecutor, Stats_RecordsQueueWait) {
+    BlockingExecutor executor(config(1, 4));
+    Gate gate;
+    executor.submit("r", [&gate]() { gate.wait(); });
+    gate.waitEntered(1);
+    executor.submit("r", []() {});
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    gate.open();
+    executor.shutdown();
+
+    auto stats = executor.stats();
+    EXPECT_GE(stats.waitMaxUs, 15000u);
+    EXPECT_GE(stats.waitTotalUs, stats.waitMaxUs);
+}
+
+TEST(BlockingExecutorConfig, ParseRouteLimits_SkipsMalformedEntries) {
+    auto limits = BlockingExecutor::Config::parseRouteLimits(" pa.verify=4, cert.search = 8,bad,=3,x=abc,y=");
+    ASSERT_EQ(limits.size(), 2u);
+    EXPECT_EQ(limits["pa.verify"], 4u);
+    EXPECT_EQ(limits["cert.search"], 8u);
+}
+
+TEST(BlockingExecutorConfig, FromEnvironment_OverridesDefaults) {
+    setenv("BLOCKING_EXECUTOR_WORKERS", "3", 1);
+    setenv("BLOCKING_EXECUTOR_QUEUE_DEPTH", "not-a-number", 1);
+    setenv("BLOCKING_EXECUTOR_ROUTE_LIMITS", "a=2", 1);
+
+    BlockingExecutor::Config defaults;
+    defaults.maxQueueDepth = 42;
+    defaults.routeLimits["b"] = 5;
+    auto c = BlockingExecutor::Config::fromEnvironment(defaults);
+
+    EXPECT_EQ(c.workers, 3u);
+    EXPECT_EQ(c.maxQueueDepth, 42u);
+    EXPECT_EQ(c.routeLimits["a"], 2u);
+    EXPECT_EQ(c.routeLimits["b"], 5u);
+
+    unsetenv("BLOCKING_EXECUTOR_WORKERS");
+    unsetenv("BLOCKING_EXECUTOR_QUEUE_DEPTH");
+    unsetenv("BLOCKING_EXECUTOR_ROUTE_LIMITS");
+}
@@ -1,10 +1,13 @@
 #pragma once
 /**
  * @file thread_pool.h
- * @brief Simple thread pool for async upload/sync processing
+ * @brief Simple thread pool for background and CPU-bound work
  *
  * Replaces detached std::thread with managed pool that supports
  * graceful shutdown (waits for running tasks to complete).
+ * Used by pkd-relay (async upload/sync processing) and pa-service
+ * (batch verification). Unlike BlockingExecutor there is no queue bound
+ * or per-route limit; callers size the work they submit.
  * Thread-safe task queue with configurable pool size.
  */
 
@@ -86,6 +89,10 @@ public:
         spdlog::info("[ThreadPool] Shut down");
     }
 
+    size_t workerCount() const {
+        return workers_.size();
+    }
+
     size_t pendingTasks() const {
         std::lock_guard<std::mutex> lock(mutex_);
         return tasks_.size();
@@ -16,6 +16,7 @@
 #include <string>
 #include <openssl/x509.h>
 #include <openssl/asn1.h>
+#include <openssl/evp.h>
 
 namespace icao::validation {
 
@@ -33,6 +34,18 @@ namespace icao::validation {
  */
 bool verifyCertificateSignature(X509* cert, X509* issuerCert);
 
+/**
+ * @brief Verify certificate signature with an already-extracted issuer public key
+ *
+ * Avoids the per-call X509_get_pubkey() of verifyCertificateSignature() when the issuer
+ * key is held long-term (e.g. CscaTrustStore).
+ *
+ * @param cert Certificate to verify (non-owning)
+ * @param issuerKey Issuer public key (non-owning)
+ * @return true if signature is cryptographically valid
+ */
+bool verifyCertificateSignatureWithKey(X509* cert, EVP_PKEY* issuerKey);
+
 /// @}
 
 /// @name Certificate Status Checks
@@ -0,0 +1,141 @@
+/**
+ * @file crl_cache.h
+ * @brief Per-country parsed CRL cache with revoked-serial index
+ *
+ * CrlChecker used to fetch and decode the country CRL for every certificate it
+ * checked. CrlCache keeps one ParsedCrl per country: the CRL is decoded once,
+ * its revoked serials are indexed in a hash map with their reason codes, and
+ * serial lookups are O(1) without allocating.
+ *
+ * An entry is refetched from the provider when:
+ *   - invalidate(countryCode) is called (CRL uploaded/synced), or
+ *   - the CRL's nextUpdate passes, or
+ *   - the entry is older than the TTL (bounds staleness for CRLs stored by
+ *     other processes; also applies to "no CRL" results).
+ * A refetched CRL with an unchanged fingerprint reuses the existing index.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <openssl/x509.h>
+#include "providers.h"
+
+namespace icao::validation {
+
+/**
+ * @brief Immutable decoded CRL with a revoked-serial hash index
+ */
+class ParsedCrl {
+public:
+    /// Reason code recorded when the CRL entry has no reasonCode extension
+    static constexpr int kNoReason = -1;
+
+    /**
+     * @brief Decode and index a CRL (non-owning; crl is not freed)
+     * @return nullptr if crl is null
+     */
+    static std::shared_ptr<const ParsedCrl> parse(X509_CRL* crl);
+
+    /**
+     * @brief Look up a certificate serial number
+     * @param serial Certificate serial (non-owning)
+     * @param reasonCode Set to the RFC 5280 CRLReason, or kNoReason, when revoked
+     * @return true if the serial is revoked (removeFromCRL entries are not)
+     */
+    bool isRevoked(const ASN1_INTEGER* serial, int& reasonCode) const;
+
+    const std::string& fingerprint() const { return fingerprint_; }  ///< SHA-256 of the CRL DER (lowercase hex)
+    const std::string& thisUpdate() const { return thisUpdate_; }    ///< ISO 8601
+    const std::string& nextUpdate() const { return nextUpdate_; }    ///< ISO 8601, empty if absent
+
+    /// True if nextUpdate is present and before now
+    bool isExpired(time_t now) const { return hasNextUpdate_ && nextUpdateTime_ < now; }
+    bool hasNextUpdate() const { return hasNextUpdate_; }
+    time_t nextUpdateTime() const { return nextUpdateTime_; }
+
+    size_t revokedCount() const { return positive_.size() + negative_.size(); }
+
+private:
+    struct SerialHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view bytes) const { return std::hash<std::string_view>()(bytes); }
+    };
+    /// Serial magnitude bytes (normalized ASN.1 INTEGER content) -> reason code
+    using SerialIndex = std::unordered_map<std::string, int, SerialHash, std::equal_to<>>;
+
+    std::string fingerprint_;
+    std::string thisUpdate_;
+    std::string nextUpdate_;
+    time_t nextUpdateTime_ = 0;
+    bool hasNextUpdate_ = false;
+    SerialIndex positive_;
+    SerialIndex negative_;  ///< Non-conforming negative serials, kept apart to match ASN1_INTEGER_cmp
+};
+
+/**
+ * @brief Thread-safe country → ParsedCrl cache in front of an ICrlProvider
+ */
+class CrlCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;   ///< Provider fetches
+        uint64_t reparses = 0; ///< Fetches whose fingerprint changed (index rebuilt)
+        size_t countries = 0;
+    };
+
+    /**
+     * @param ttl Maximum age of an entry before the provider is consulted again
+     */
+    explicit CrlCache(std::chrono::seconds ttl = std::chrono::seconds(300));
+
+    CrlCache(const CrlCache&) = delete;
+    CrlCache& operator=(const CrlCache&) = delete;
+
+    /**
+     * @brief Process-wide instance shared by the service's CrlCheckers
+     */
+    static CrlCache& instance();
+
+    /**
+     * @brief Parsed CRL for a country, fetching from provider on miss or expiry
+     * @return nullptr if the provider has no CRL for the country
+     */
+    std::shared_ptr<const ParsedCrl> get(const std::string& countryCode, ICrlProvider& provider);
+
+    /// Drop a country's entry (call after storing a new CRL for it)
+    void invalidate(const std::string& countryCode);
+    void clear();
+
+    /// Change the entry TTL (services set it from CRL_CACHE_TTL_SECONDS); applies to later fetches
+    void setTtl(std::chrono::seconds ttl);
+    std::chrono::seconds ttl() const;
+
+    Stats stats() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<const ParsedCrl> crl;  ///< nullptr = provider had no CRL
+        time_t validUntil = 0;
+    };
+
+    std::chrono::seconds ttl_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t reparses_ = 0;
+};
+
+} // namespace icao::validation
@@ -4,6 +4,7 @@
  *
  * Uses ICrlProvider interface for infrastructure abstraction.
  * Checks certificate serial number against CRL and extracts revocation reason.
+ * With a CrlCache, each country CRL is decoded and indexed once instead of per check.
  */
 
 #pragma once
@@ -11,6 +12,7 @@
 #include <openssl/x509.h>
 #include "types.h"
 #include "providers.h"
+#include "crl_cache.h"
 
 namespace icao::validation {
 
@@ -29,9 +31,10 @@ public:
     /**
      * @brief Constructor
      * @param crlProvider CRL lookup provider (non-owning)
+     * @param crlCache Parsed CRL cache (non-owning); nullptr fetches the CRL on every check
      * @throws std::invalid_argument if crlProvider is nullptr
      */
-    explicit CrlChecker(ICrlProvider* crlProvider);
+    explicit CrlChecker(ICrlProvider* crlProvider, CrlCache* crlCache = nullptr);
 
     /**
      * @brief Check certificate revocation status via CRL
@@ -49,7 +52,15 @@ public:
     CrlCheckResult check(X509* cert, const std::string& countryCode);
 
 private:
+    CrlCheckResult checkCached(X509* cert, const std::string& countryCode);
+
     ICrlProvider* crlProvider_;
+    CrlCache* crlCache_;
 };
 
+/**
+ * @brief RFC 5280 CRLReason code to name (e.g. 1 → "keyCompromise")
+ */
+std::string revocationReasonToString(long reasonCode);
+
 } // namespace icao::validation
@@ -0,0 +1,135 @@
+/**
+ * @file csca_trust_store.h
+ * @brief Immutable, pre-parsed CSCA trust store shared across trust chain builds
+ *
+ * Providers historically kept CSCAs as DER and ran d2i_X509 for every DSC lookup,
+ * handing out fresh X509* copies that TrustChainBuilder freed again. A
+ * CscaTrustStore parses each CSCA once, keeps up-ref'd X509* with their public
+ * keys and derived attributes, and is never modified after construction, so any
+ * number of threads can borrow from it without locking.
+ *
+ * New CSCAs are handled by building a new store and publishing it through a
+ * CscaTrustStoreHolder (RCU-style): readers keep the snapshot they loaded alive
+ * via shared_ptr while new readers see the new one.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+namespace icao::validation {
+
+/**
+ * @brief One pre-parsed CSCA held by a CscaTrustStore
+ *
+ * Pointers are owned by the store and valid for the store's lifetime.
+ */
+struct TrustAnchor {
+    X509* cert = nullptr;             ///< Up-ref'd certificate
+    EVP_PKEY* publicKey = nullptr;    ///< Pre-extracted public key
+    std::string subjectDn;            ///< getSubjectDn() format
+    std::string normalizedSubjectDn;  ///< normalizeDnForComparison(subjectDn)
+    std::string ski;                  ///< Subject Key Identifier (lowercase hex), empty if absent
+    std::string fingerprint;          ///< SHA-256 (lowercase hex)
+    std::array<unsigned char, 32> spkiDigest{};  ///< SHA-256 of the SubjectPublicKey (signature cache key)
+    bool hasSpkiDigest = false;
+    bool selfSigned = false;
+    bool linkCertificate = false;
+};
+
+/**
+ * @brief Immutable CSCA index by normalized subject DN and by SKI
+ */
+class CscaTrustStore {
+public:
+    /**
+     * @brief Build a store from parsed certificates
+     * @param cscas Certificates to index (non-owning; the store up-refs each)
+     */
+    static std::shared_ptr<const CscaTrustStore> create(const std::vector<X509*>& cscas);
+
+    /**
+     * @brief Build a store from DER-encoded certificates (unparseable entries are skipped)
+     */
+    static std::shared_ptr<const CscaTrustStore> fromDer(const std::vector<std::vector<uint8_t>>& derCerts);
+
+    ~CscaTrustStore();
+
+    CscaTrustStore(const CscaTrustStore&) = delete;
+    CscaTrustStore& operator=(const CscaTrustStore&) = delete;
+
+    /**
+     * @brief CSCAs whose subject matches a DN (any format, compared normalized)
+     * @return Borrowed anchors, in insertion order (empty if none)
+     */
+    const std::vector<const TrustAnchor*>& findBySubjectDn(const std::string& dn) const;
+
+    /**
+     * @brief CSCAs with the given Subject Key Identifier (lowercase hex)
+     */
+    const std::vector<const TrustAnchor*>& findBySki(const std::string& skiHex) const;
+
+    /**
+     * @brief Anchor owning this certificate pointer, or nullptr if not from this store
+     */
+    const TrustAnchor* find(const X509* cert) const;
+
+    /**
+     * @brief Up-ref'd copies for copy-based ICscaProvider callers (caller frees each)
+     */
+    std::vector<X509*> copyBySubjectDn(const std::string& dn) const;
+
+    const std::vector<TrustAnchor>& anchors() const { return anchors_; }
+    size_t size() const { return anchors_.size(); }
+
+    /**
+     * @brief Process-wide unique, increasing store version
+     *
+     * Results derived from a store (e.g. verified root self-signatures) may be
+     * cached per generation.
+     */
+    uint64_t generation() const { return generation_; }
+
+private:
+    CscaTrustStore();
+
+    std::vector<TrustAnchor> anchors_;
+    std::unordered_map<std::string, std::vector<const TrustAnchor*>> byDn_;
+    std::unordered_map<std::string, std::vector<const TrustAnchor*>> bySki_;
+    std::unordered_map<const X509*, const TrustAnchor*> byCert_;
+    uint64_t generation_;
+};
+
+/**
+ * @brief Atomically swappable CscaTrustStore reference (RCU-style publication)
+ *
+ * load() and publish() are safe from any thread. A loaded snapshot stays valid
+ * for as long as the caller holds it, regardless of later publications.
+ */
+class CscaTrustStoreHolder {
+public:
+    std::shared_ptr<const CscaTrustStore> load() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    void publish(std::shared_ptr<const CscaTrustStore> store) {
+        current_.store(std::move(store), std::memory_order_release);
+    }
+
+    void reset() { publish(nullptr); }
+
+private:
+    std::atomic<std::shared_ptr<const CscaTrustStore>> current_;
+};
+
+} // namespace icao::validation
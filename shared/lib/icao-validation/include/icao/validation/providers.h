@@ -10,12 +10,15 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <openssl/x509.h>
 
 namespace icao::validation {
 
+class CscaTrustStore;
+
 /**
  * @brief CSCA certificate lookup interface
  *
@@ -49,6 +52,18 @@ public:
     virtual X509* findCscaByIssuerDn(
         const std::string& issuerDn,
         const std::string& countryCode = "") = 0;
+
+    /**
+     * @brief Borrow-based lookup: current pre-parsed CSCA snapshot
+     *
+     * Providers that publish a CscaTrustStore return it here. TrustChainBuilder
+     * then borrows certificates and public keys from the store instead of calling
+     * findAllCscasByIssuerDn() and freeing the copies. The returned shared_ptr
+     * keeps the snapshot alive even if the provider publishes a new one.
+     *
+     * @return Current trust store, or nullptr to use the copy-based lookups
+     */
+    virtual std::shared_ptr<const CscaTrustStore> trustStore() { return nullptr; }
 };
 
 /**
@@ -0,0 +1,135 @@
+/**
+ * @file signature_cache.h
+ * @brief Memoized certificate signature verification
+ *
+ * X509_verify() outcome depends only on the signed certificate's encoding and the
+ * issuer public key, so results can be remembered across trust chain builds.
+ * Entries are keyed by (SHA-256 of the child certificate DER, SHA-256 of the
+ * issuer SubjectPublicKey) and both positive and negative outcomes are kept.
+ * The child key covers the whole certificate (TBS, algorithm and signature
+ * value) so a re-signed or tampered certificate never hits an existing entry.
+ *
+ * Root CSCA self-signatures are additionally remembered per CscaTrustStore
+ * generation, skipping even the digest computation for borrowed anchors.
+ *
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+namespace icao::validation {
+
+struct TrustAnchor;
+
+/**
+ * @brief Bounded, thread-safe signature verification memo
+ *
+ * The map is split into independently locked shards. A shard that reaches its
+ * share of maxEntries is cleared (cheap epoch eviction); results are always
+ * recomputable, so eviction only costs a repeated verify.
+ */
+class SignatureVerificationCache {
+public:
+    using Digest = std::array<unsigned char, 32>;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t entries = 0;
+    };
+
+    /**
+     * @param maxEntries Approximate upper bound on remembered (cert, issuer) pairs
+     */
+    explicit SignatureVerificationCache(size_t maxEntries = 65536);
+
+    SignatureVerificationCache(const SignatureVerificationCache&) = delete;
+    SignatureVerificationCache& operator=(const SignatureVerificationCache&) = delete;
+
+    /**
+     * @brief Process-wide instance used by TrustChainBuilder by default
+     */
+    static SignatureVerificationCache& instance();
+
+    /**
+     * @brief Cached verifyCertificateSignature(cert, issuerCert)
+     */
+    bool verify(X509* cert, X509* issuerCert);
+
+    /**
+     * @brief Cached verify against a CscaTrustStore anchor (uses its pre-extracted key and SPKI hash)
+     */
+    bool verify(X509* cert, const TrustAnchor& issuer);
+
+    /**
+     * @brief Cached root self-signature check, valid for one trust store generation
+     *
+     * Anchors are immutable within a store, so (generation, anchor) identifies the
+     * result without hashing. A new store generation starts fresh.
+     */
+    bool verifySelfSignature(const TrustAnchor& root, uint64_t generation);
+
+    Stats stats() const;
+    void clear();
+
+    /**
+     * @brief SHA-256 over the DER-encoded SubjectPublicKeyInfo of a certificate
+     *
+     * Covers the algorithm identifier and its parameters, not only the key bits.
+     * @return false if the digest cannot be computed
+     */
+    static bool spkiDigest(X509* cert, Digest& out);
+
+private:
+    struct Key {
+        Digest cert;
+        Digest issuerKey;
+        bool operator==(const Key& other) const {
+            return cert == other.cert && issuerKey == other.issuerKey;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct RootKey {
+        uint64_t generation;
+        const TrustAnchor* anchor;
+        bool operator==(const RootKey& other) const {
+            return generation == other.generation && anchor == other.anchor;
+        }
+    };
+    struct RootKeyHash {
+        size_t operator()(const RootKey& key) const;
+    };
+
+    static constexpr size_t kShardCount = 16;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, bool, KeyHash> entries;
+    };
+
+    /// Lookup-or-verify; issuerKey is the key X509_verify() runs with on a miss
+    bool verifyWithKey(X509* cert, const Digest& issuerDigest, EVP_PKEY* issuerKey);
+
+    size_t maxPerShard_;
+    std::array<Shard, kShardCount> shards_;
+
+    mutable std::mutex rootMutex_;
+    std::unordered_map<RootKey, bool, RootKeyHash> roots_;
+
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace icao::validation
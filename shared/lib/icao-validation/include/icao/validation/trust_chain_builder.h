@@ -3,7 +3,11 @@
  * @brief ICAO Doc 9303 Part 12 Trust Chain Builder
  *
  * Builds and validates DSC -> (Link) -> Root CSCA trust chains.
- * Uses ICscaProvider interface for infrastructure abstraction.
+ * Uses ICscaProvider interface for infrastructure abstraction. When the provider
+ * publishes a CscaTrustStore, CSCAs and their public keys are borrowed from it
+ * instead of being copied and freed per build. Signature checks go through a
+ * SignatureVerificationCache, so repeated (certificate, issuer) pairs across
+ * builds and the Step 6 re-validation cost one X509_verify() in total.
  *
  * ICAO hybrid chain model:
  *   - Signature verification: HARD requirement (must pass)
@@ -15,6 +19,7 @@
 #include <openssl/x509.h>
 #include "types.h"
 #include "providers.h"
+#include "signature_cache.h"
 
 namespace icao::validation {
 
@@ -33,9 +38,12 @@ public:
     /**
      * @brief Constructor
      * @param cscaProvider CSCA lookup provider (non-owning)
+     * @param sigCache Signature verification cache (non-owning);
+     *                 nullptr uses SignatureVerificationCache::instance()
      * @throws std::invalid_argument if cscaProvider is nullptr
      */
-    explicit TrustChainBuilder(ICscaProvider* cscaProvider);
+    explicit TrustChainBuilder(ICscaProvider* cscaProvider,
+                               SignatureVerificationCache* sigCache = nullptr);
 
     /**
      * @brief Build and validate trust chain from leaf certificate to root CSCA
@@ -57,6 +65,7 @@ public:
 
 private:
     ICscaProvider* cscaProvider_;
+    SignatureVerificationCache* sigCache_;
 };
 
 } // namespace icao::validation
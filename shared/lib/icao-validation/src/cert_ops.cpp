@@ -42,6 +42,19 @@ bool verifyCertificateSignature(X509* cert, X509* issuerCert) {
     return (result == 1);
 }
 
+bool verifyCertificateSignatureWithKey(X509* cert, EVP_PKEY* issuerKey) {
+    if (!cert || !issuerKey) return false;
+
+    int result = X509_verify(cert, issuerKey);
+
+    // Clear OpenSSL error queue to prevent stale errors from leaking
+    if (result != 1) {
+        ERR_clear_error();
+    }
+
+    return (result == 1);
+}
+
 // --- Certificate Status Checks ---
 
 bool isCertificateExpired(X509* cert) {
@@ -0,0 +1,189 @@
+/**
+ * @file crl_cache.cpp
+ * @brief Per-country parsed CRL cache implementation
+ */
+
+#include "icao/validation/crl_cache.h"
+#include "icao/validation/cert_ops.h"
+
+#include <algorithm>
+#include <openssl/x509v3.h>
+
+namespace icao::validation {
+
+namespace {
+
+/// RFC 5280 CRLReason removeFromCRL (delta CRLs): entry no longer revoked
+constexpr int kReasonRemoveFromCrl = 8;
+
+std::string_view serialBytes(const ASN1_INTEGER* serial) {
+    return std::string_view(reinterpret_cast<const char*>(ASN1_STRING_get0_data(serial)),
+                            static_cast<size_t>(ASN1_STRING_length(serial)));
+}
+
+int revocationReasonCode(X509_REVOKED* entry) {
+    int reasonIdx = X509_REVOKED_get_ext_by_NID(entry, NID_crl_reason, -1);
+    if (reasonIdx < 0) return ParsedCrl::kNoReason;
+
+    X509_EXTENSION* ext = X509_REVOKED_get_ext(entry, reasonIdx);
+    if (!ext) return ParsedCrl::kNoReason;
+
+    auto* reasonEnum = static_cast<ASN1_ENUMERATED*>(X509V3_EXT_d2i(ext));
+    if (!reasonEnum) return ParsedCrl::kNoReason;
+    int code = static_cast<int>(ASN1_ENUMERATED_get(reasonEnum));
+    ASN1_ENUMERATED_free(reasonEnum);
+    return code;
+}
+
+std::string crlFingerprint(X509_CRL* crl) {
+    unsigned char md[EVP_MAX_MD_SIZE];
+    unsigned int len = 0;
+    if (X509_CRL_digest(crl, EVP_sha256(), md, &len) != 1) return {};
+
+    static const char hex[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(len * 2);
+    for (unsigned int i = 0; i < len; i++) {
+        out += hex[(md[i] >> 4) & 0x0F];
+        out += hex[md[i] & 0x0F];
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+// --- ParsedCrl ---
+
+std::shared_ptr<const ParsedCrl> ParsedCrl::parse(X509_CRL* crl) {
+    if (!crl) return nullptr;
+
+    auto parsed = std::make_shared<ParsedCrl>();
+    parsed->fingerprint_ = crlFingerprint(crl);
+    parsed->thisUpdate_ = asn1TimeToIso8601(X509_CRL_get0_lastUpdate(crl));
+    parsed->nextUpdate_ = asn1TimeToIso8601(X509_CRL_get0_nextUpdate(crl));
+
+    if (const ASN1_TIME* nextUpdate = X509_CRL_get0_nextUpdate(crl)) {
+        struct tm tm = {};
+        if (ASN1_TIME_to_tm(nextUpdate, &tm) == 1) {
+            parsed->nextUpdateTime_ = timegm(&tm);
+            parsed->hasNextUpdate_ = true;
+        }
+    }
+
+    STACK_OF(X509_REVOKED)* revoked = X509_CRL_get_REVOKED(crl);
+    int count = revoked ? sk_X509_REVOKED_num(revoked) : 0;
+    parsed->positive_.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; i++) {
+        X509_REVOKED* entry = sk_X509_REVOKED_value(revoked, i);
+        const ASN1_INTEGER* serial = X509_REVOKED_get0_serialNumber(entry);
+        if (!serial) continue;
+
+        int reason = revocationReasonCode(entry);
+        if (reason == kReasonRemoveFromCrl) continue;  // X509_CRL_get0_by_serial returns 2 (not revoked)
+
+        SerialIndex& index = ASN1_STRING_type(serial) == V_ASN1_NEG_INTEGER ? parsed->negative_ : parsed->positive_;
+        index.emplace(std::string(serialBytes(serial)), reason);
+    }
+    return parsed;
+}
+
+bool ParsedCrl::isRevoked(const ASN1_INTEGER* serial, int& reasonCode) const {
+    if (!serial) return false;
+
+    const SerialIndex& index = ASN1_STRING_type(serial) == V_ASN1_NEG_INTEGER ? negative_ : positive_;
+    auto it = index.find(serialBytes(serial));
+    if (it == index.end()) return false;
+    reasonCode = it->second;
+    return true;
+}
+
+// --- CrlCache ---
+
+CrlCache::CrlCache(std::chrono::seconds ttl) : ttl_(ttl) {}
+
+CrlCache& CrlCache::instance() {
+    static CrlCache cache;
+    return cache;
+}
+
+std::shared_ptr<const ParsedCrl> CrlCache::get(const std::string& countryCode, ICrlProvider& provider) {
+    time_t now = time(nullptr);
+    std::shared_ptr<const ParsedCrl> previous;
+    std::chrono::seconds ttl;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ttl = ttl_;
+        auto it = entries_.find(countryCode);
+        if (it != entries_.end()) {
+            if (now < it->second.validUntil) {
+                hits_++;
+                return it->second.crl;
+            }
+            previous = it->second.crl;
+        }
+        misses_++;
+    }
+
+    // Fetch outside the lock; a concurrent miss for the same country just fetches twice
+    X509_CRL* crl = provider.findCrlByCountry(countryCode);
+    std::shared_ptr<const ParsedCrl> parsed;
+    bool reparsed = false;
+    if (crl) {
+        if (previous && !previous->fingerprint().empty() && previous->fingerprint() == crlFingerprint(crl)) {
+            parsed = previous;  // Same CRL content — keep the existing index
+        } else {
+            parsed = ParsedCrl::parse(crl);
+            reparsed = true;
+        }
+        X509_CRL_free(crl);
+    }
+
+    Entry entry;
+    entry.crl = parsed;
+    entry.validUntil = now + static_cast<time_t>(ttl.count());
+    if (parsed && parsed->hasNextUpdate() && !parsed->isExpired(now)) {
+        // Refetch as soon as the CRL expires; an already-expired CRL waits for the TTL
+        entry.validUntil = std::min(entry.validUntil, parsed->nextUpdateTime() + 1);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (reparsed) reparses_++;
+    entries_[countryCode] = std::move(entry);
+    return parsed;
+}
+
+void CrlCache::invalidate(const std::string& countryCode) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(countryCode);
+    if (it != entries_.end()) {
+        it->second.validUntil = 0;  // Keep the parsed CRL for fingerprint reuse
+    }
+}
+
+void CrlCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    hits_ = misses_ = reparses_ = 0;
+}
+
+void CrlCache::setTtl(std::chrono::seconds ttl) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ttl_ = ttl;
+}
+
+std::chrono::seconds CrlCache::ttl() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ttl_;
+}
+
+CrlCache::Stats CrlCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.reparses = reparses_;
+    stats.countries = entries_.size();
+    return stats;
+}
+
+} // namespace icao::validation
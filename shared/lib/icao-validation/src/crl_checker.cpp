@@ -16,8 +16,24 @@
 
 namespace icao::validation {
 
-CrlChecker::CrlChecker(ICrlProvider* crlProvider)
-    : crlProvider_(crlProvider)
+std::string revocationReasonToString(long reasonCode) {
+    switch (reasonCode) {
+        case 0:  return "unspecified";
+        case 1:  return "keyCompromise";
+        case 2:  return "cACompromise";
+        case 3:  return "affiliationChanged";
+        case 4:  return "superseded";
+        case 5:  return "cessationOfOperation";
+        case 6:  return "certificateHold";
+        case 8:  return "removeFromCRL";
+        case 9:  return "privilegeWithdrawn";
+        case 10: return "aACompromise";
+        default: return "unknown(" + std::to_string(reasonCode) + ")";
+    }
+}
+
+CrlChecker::CrlChecker(ICrlProvider* crlProvider, CrlCache* crlCache)
+    : crlProvider_(crlProvider), crlCache_(crlCache)
 {
     if (!crlProvider_) {
         throw std::invalid_argument("CrlChecker: crlProvider cannot be nullptr");
@@ -39,6 +55,10 @@ CrlCheckResult CrlChecker::check(X509* cert, const std::string& countryCode) {
         return result;
     }
 
+    if (crlCache_) {
+        return checkCached(cert, countryCode);
+    }
+
     // Step 1: Fetch CRL for the country
     X509_CRL* crl = crlProvider_->findCrlByCountry(countryCode);
     if (!crl) {
@@ -87,20 +107,7 @@ CrlCheckResult CrlChecker::check(X509* cert, const std::string& countryCode) {
                 ASN1_ENUMERATED* reasonEnum = static_cast<ASN1_ENUMERATED*>(
                     X509V3_EXT_d2i(ext));
                 if (reasonEnum) {
-                    long reasonCode = ASN1_ENUMERATED_get(reasonEnum);
-                    switch (reasonCode) {
-                        case 0:  result.revocationReason = "unspecified"; break;
-                        case 1:  result.revocationReason = "keyCompromise"; break;
-                        case 2:  result.revocationReason = "cACompromise"; break;
-                        case 3:  result.revocationReason = "affiliationChanged"; break;
-                        case 4:  result.revocationReason = "superseded"; break;
-                        case 5:  result.revocationReason = "cessationOfOperation"; break;
-                        case 6:  result.revocationReason = "certificateHold"; break;
-                        case 8:  result.revocationReason = "removeFromCRL"; break;
-                        case 9:  result.revocationReason = "privilegeWithdrawn"; break;
-                        case 10: result.revocationReason = "aACompromise"; break;
-                        default: result.revocationReason = "unknown(" + std::to_string(reasonCode) + ")"; break;
-                    }
+                    result.revocationReason = revocationReasonToString(ASN1_ENUMERATED_get(reasonEnum));
                     ASN1_ENUMERATED_free(reasonEnum);
                 }
             }
@@ -114,4 +121,48 @@ CrlCheckResult CrlChecker::check(X509* cert, const std::string& countryCode) {
     return result;
 }
 
+CrlCheckResult CrlChecker::checkCached(X509* cert, const std::string& countryCode) {
+    CrlCheckResult result;
+
+    // Step 1: Parsed CRL for the country (decoded once per CRL, see CrlCache)
+    std::shared_ptr<const ParsedCrl> crl = crlCache_->get(countryCode, *crlProvider_);
+    if (!crl) {
+        result.status = CrlCheckStatus::CRL_UNAVAILABLE;
+        result.message = "No CRL found for country " + countryCode;
+        return result;
+    }
+
+    // Steps 2-3: CRL dates and expiration
+    result.thisUpdate = crl->thisUpdate();
+    result.nextUpdate = crl->nextUpdate();
+    if (crl->isExpired(time(nullptr))) {
+        result.status = CrlCheckStatus::CRL_EXPIRED;
+        result.message = "CRL expired for country " + countryCode;
+        return result;
+    }
+
+    // Step 4: Serial lookup in the revoked-serial index
+    ASN1_INTEGER* certSerial = X509_get_serialNumber(cert);
+    if (!certSerial) {
+        result.status = CrlCheckStatus::VALID;
+        result.message = "Could not extract certificate serial number";
+        return result;
+    }
+
+    int reasonCode = ParsedCrl::kNoReason;
+    if (crl->isRevoked(certSerial, reasonCode)) {
+        result.status = CrlCheckStatus::REVOKED;
+        result.message = "Certificate is revoked (country: " + countryCode + ")";
+        // Step 5: Revocation reason (RFC 5280 Section 5.3.1)
+        if (reasonCode != ParsedCrl::kNoReason) {
+            result.revocationReason = revocationReasonToString(reasonCode);
+        }
+    } else {
+        result.status = CrlCheckStatus::VALID;
+        result.message = "Certificate not revoked (country: " + countryCode + ")";
+    }
+
+    return result;
+}
+
 } // namespace icao::validation
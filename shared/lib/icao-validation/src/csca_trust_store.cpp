@@ -0,0 +1,126 @@
+/**
+ * @file csca_trust_store.cpp
+ * @brief Immutable pre-parsed CSCA trust store implementation
+ */
+
+#include "icao/validation/csca_trust_store.h"
+#include "icao/validation/cert_ops.h"
+#include "icao/validation/signature_cache.h"
+
+#include <openssl/x509v3.h>
+
+namespace icao::validation {
+
+namespace {
+
+const std::vector<const TrustAnchor*> kNoAnchors;
+
+std::atomic<uint64_t> g_nextGeneration{1};
+
+std::string toLowerHex(const unsigned char* data, int len) {
+    static const char hex[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(static_cast<size_t>(len) * 2);
+    for (int i = 0; i < len; i++) {
+        out += hex[(data[i] >> 4) & 0x0F];
+        out += hex[data[i] & 0x0F];
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+CscaTrustStore::CscaTrustStore()
+    : generation_(g_nextGeneration.fetch_add(1, std::memory_order_relaxed)) {}
+
+CscaTrustStore::~CscaTrustStore() {
+    for (auto& anchor : anchors_) {
+        EVP_PKEY_free(anchor.publicKey);
+        X509_free(anchor.cert);
+    }
+}
+
+std::shared_ptr<const CscaTrustStore> CscaTrustStore::create(const std::vector<X509*>& cscas) {
+    std::shared_ptr<CscaTrustStore> store(new CscaTrustStore());
+    store->anchors_.reserve(cscas.size());
+
+    for (X509* cert : cscas) {
+        if (!cert) continue;
+
+        // Populate OpenSSL's cached extension data now, so later concurrent
+        // reads of this certificate never trigger lazy initialization
+        X509_check_purpose(cert, -1, 0);
+
+        TrustAnchor anchor;
+        X509_up_ref(cert);
+        anchor.cert = cert;
+        anchor.publicKey = X509_get_pubkey(cert);
+        anchor.subjectDn = getSubjectDn(cert);
+        anchor.normalizedSubjectDn = normalizeDnForComparison(anchor.subjectDn);
+        if (const ASN1_OCTET_STRING* ski = X509_get0_subject_key_id(cert)) {
+            anchor.ski = toLowerHex(ASN1_STRING_get0_data(ski), ASN1_STRING_length(ski));
+        }
+        anchor.fingerprint = getCertificateFingerprint(cert);
+        anchor.hasSpkiDigest = SignatureVerificationCache::spkiDigest(cert, anchor.spkiDigest);
+        anchor.selfSigned = isSelfSigned(cert);
+        anchor.linkCertificate = !anchor.selfSigned && isLinkCertificate(cert);
+        store->anchors_.push_back(std::move(anchor));
+    }
+
+    // Index after all anchors are in place (vector no longer reallocates)
+    for (const TrustAnchor& anchor : store->anchors_) {
+        store->byDn_[anchor.normalizedSubjectDn].push_back(&anchor);
+        if (!anchor.ski.empty()) {
+            store->bySki_[anchor.ski].push_back(&anchor);
+        }
+        store->byCert_[anchor.cert] = &anchor;
+    }
+
+    return store;
+}
+
+std::shared_ptr<const CscaTrustStore> CscaTrustStore::fromDer(
+    const std::vector<std::vector<uint8_t>>& derCerts)
+{
+    std::vector<X509*> parsed;
+    parsed.reserve(derCerts.size());
+    for (const auto& der : derCerts) {
+        const unsigned char* p = der.data();
+        X509* cert = d2i_X509(nullptr, &p, static_cast<long>(der.size()));
+        if (cert) {
+            parsed.push_back(cert);
+        }
+    }
+
+    auto store = create(parsed);
+    for (X509* cert : parsed) {
+        X509_free(cert);  // Store holds its own reference
+    }
+    return store;
+}
+
+const std::vector<const TrustAnchor*>& CscaTrustStore::findBySubjectDn(const std::string& dn) const {
+    auto it = byDn_.find(normalizeDnForComparison(dn));
+    return it != byDn_.end() ? it->second : kNoAnchors;
+}
+
+const std::vector<const TrustAnchor*>& CscaTrustStore::findBySki(const std::string& skiHex) const {
+    auto it = bySki_.find(skiHex);
+    return it != bySki_.end() ? it->second : kNoAnchors;
+}
+
+const TrustAnchor* CscaTrustStore::find(const X509* cert) const {
+    auto it = byCert_.find(cert);
+    return it != byCert_.end() ? it->second : nullptr;
+}
+
+std::vector<X509*> CscaTrustStore::copyBySubjectDn(const std::string& dn) const {
+    std::vector<X509*> result;
+    for (const TrustAnchor* anchor : findBySubjectDn(dn)) {
+        X509_up_ref(anchor->cert);
+        result.push_back(anchor->cert);
+    }
+    return result;
+}
+
+} // namespace icao::validation
@@ -0,0 +1,163 @@
+/**
+ * @file signature_cache.cpp
+ * @brief Memoized certificate signature verification implementation
+ */
+
+#include "icao/validation/signature_cache.h"
+#include "icao/validation/cert_ops.h"
+#include "icao/validation/csca_trust_store.h"
+
+#include <cstring>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+namespace icao::validation {
+
+namespace {
+
+size_t digestPrefix(const SignatureVerificationCache::Digest& digest) {
+    size_t value = 0;
+    std::memcpy(&value, digest.data(), sizeof(value));
+    return value;
+}
+
+bool certDigest(X509* cert, SignatureVerificationCache::Digest& out) {
+    unsigned int len = 0;
+    return X509_digest(cert, EVP_sha256(), out.data(), &len) == 1 && len == out.size();
+}
+
+} // anonymous namespace
+
+size_t SignatureVerificationCache::KeyHash::operator()(const Key& key) const {
+    // SHA-256 output is uniformly distributed; a prefix of each half is enough
+    return digestPrefix(key.cert) ^ (digestPrefix(key.issuerKey) * 31);
+}
+
+size_t SignatureVerificationCache::RootKeyHash::operator()(const RootKey& key) const {
+    return std::hash<const void*>()(key.anchor) ^ (std::hash<uint64_t>()(key.generation) << 1);
+}
+
+SignatureVerificationCache::SignatureVerificationCache(size_t maxEntries)
+    : maxPerShard_(maxEntries / kShardCount > 0 ? maxEntries / kShardCount : 1) {}
+
+SignatureVerificationCache& SignatureVerificationCache::instance() {
+    static SignatureVerificationCache cache;
+    return cache;
+}
+
+bool SignatureVerificationCache::spkiDigest(X509* cert, Digest& out) {
+    // Full SubjectPublicKeyInfo, so keys differing only in algorithm
+    // parameters (EC curve, RSA-PSS params) never share an entry
+    X509_PUBKEY* pubkey = cert ? X509_get_X509_PUBKEY(cert) : nullptr;
+    if (!pubkey) return false;
+    unsigned char* der = nullptr;
+    int derLen = i2d_X509_PUBKEY(pubkey, &der);
+    if (derLen <= 0) return false;
+    unsigned int len = 0;
+    bool ok = EVP_Digest(der, static_cast<size_t>(derLen), out.data(), &len, EVP_sha256(), nullptr) == 1 &&
+              len == out.size();
+    OPENSSL_free(der);
+    return ok;
+}
+
+bool SignatureVerificationCache::verifyWithKey(X509* cert, const Digest& issuerDigest, EVP_PKEY* issuerKey) {
+    Key key;
+    key.issuerKey = issuerDigest;
+    if (!certDigest(cert, key.cert)) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return verifyCertificateSignatureWithKey(cert, issuerKey);
+    }
+
+    Shard& shard = shards_[KeyHash()(key) % kShardCount];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end()) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+    }
+
+    // Verify outside the lock; concurrent misses for the same pair agree on the result
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    bool valid = verifyCertificateSignatureWithKey(cert, issuerKey);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.entries.size() >= maxPerShard_) {
+        shard.entries.clear();
+    }
+    shard.entries.emplace(key, valid);
+    return valid;
+}
+
+bool SignatureVerificationCache::verify(X509* cert, X509* issuerCert) {
+    if (!cert || !issuerCert) return false;
+
+    Digest issuerDigest;
+    if (!spkiDigest(issuerCert, issuerDigest)) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return verifyCertificateSignature(cert, issuerCert);
+    }
+
+    EVP_PKEY* issuerKey = X509_get_pubkey(issuerCert);
+    if (!issuerKey) return false;
+    bool valid = verifyWithKey(cert, issuerDigest, issuerKey);
+    EVP_PKEY_free(issuerKey);
+    return valid;
+}
+
+bool SignatureVerificationCache::verify(X509* cert, const TrustAnchor& issuer) {
+    if (!cert || !issuer.publicKey) return false;
+    if (!issuer.hasSpkiDigest) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return verifyCertificateSignatureWithKey(cert, issuer.publicKey);
+    }
+    return verifyWithKey(cert, issuer.spkiDigest, issuer.publicKey);
+}
+
+bool SignatureVerificationCache::verifySelfSignature(const TrustAnchor& root, uint64_t generation) {
+    RootKey key{generation, &root};
+    {
+        std::lock_guard<std::mutex> lock(rootMutex_);
+        auto it = roots_.find(key);
+        if (it != roots_.end()) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second;
+        }
+    }
+
+    bool valid = verify(root.cert, root);
+
+    std::lock_guard<std::mutex> lock(rootMutex_);
+    if (roots_.size() >= maxPerShard_ * kShardCount) {
+        roots_.clear();
+    }
+    roots_.emplace(key, valid);
+    return valid;
+}
+
+SignatureVerificationCache::Stats SignatureVerificationCache::stats() const {
+    Stats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    for (const Shard& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.entries += shard.entries.size();
+    }
+    return stats;
+}
+
+void SignatureVerificationCache::clear() {
+    for (Shard& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(rootMutex_);
+        roots_.clear();
+    }
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace icao::validation
@@ -13,6 +13,7 @@
 
 #include "icao/validation/trust_chain_builder.h"
 #include "icao/validation/cert_ops.h"
+#include "icao/validation/csca_trust_store.h"
 
 #include <set>
 #include <stdexcept>
@@ -21,8 +22,9 @@
 
 namespace icao::validation {
 
-TrustChainBuilder::TrustChainBuilder(ICscaProvider* cscaProvider)
-    : cscaProvider_(cscaProvider)
+TrustChainBuilder::TrustChainBuilder(ICscaProvider* cscaProvider, SignatureVerificationCache* sigCache)
+    : cscaProvider_(cscaProvider),
+      sigCache_(sigCache ? sigCache : &SignatureVerificationCache::instance())
 {
     if (!cscaProvider_) {
         throw std::invalid_argument("TrustChainBuilder: cscaProvider cannot be nullptr");
@@ -47,21 +49,51 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
     // Check DSC expiration (informational per ICAO hybrid model)
     result.dscExpired = isCertificateExpired(leafCert);
 
+    // CSCA lookups: borrowed from the provider's trust store when it publishes one,
+    // otherwise copies from findAllCscasByIssuerDn() that this call owns and frees.
+    // The store snapshot stays alive until build() returns.
+    std::shared_ptr<const CscaTrustStore> store = cscaProvider_->trustStore();
+    std::vector<X509*> ownedCscas;
+    struct OwnedCscaGuard {
+        std::vector<X509*>& certs;
+        ~OwnedCscaGuard() { for (X509* cert : certs) X509_free(cert); }
+    } ownedGuard{ownedCscas};
+
+    auto findCscas = [&](const std::string& issuerDn) {
+        std::vector<X509*> found;
+        if (store) {
+            for (const TrustAnchor* anchor : store->findBySubjectDn(issuerDn)) {
+                found.push_back(anchor->cert);
+            }
+        } else {
+            found = cscaProvider_->findAllCscasByIssuerDn(issuerDn);
+            ownedCscas.insert(ownedCscas.end(), found.begin(), found.end());
+        }
+        return found;
+    };
+
+    // Memoized signature check; borrowed issuers use the store's pre-extracted key,
+    // and borrowed roots remember their self-signature per store generation
+    auto verifySignature = [&](X509* cert, X509* issuerCert) {
+        if (store) {
+            if (const TrustAnchor* anchor = store->find(issuerCert)) {
+                return cert == issuerCert ? sigCache_->verifySelfSignature(*anchor, store->generation())
+                                          : sigCache_->verify(cert, *anchor);
+            }
+        }
+        return sigCache_->verify(cert, issuerCert);
+    };
+
     // Step 2: Find ALL CSCAs matching the issuer DN (key rollover support)
-    std::vector<X509*> allCscas = cscaProvider_->findAllCscasByIssuerDn(leafIssuerDn);
+    std::vector<X509*> allCscas = findCscas(leafIssuerDn);
     if (allCscas.empty()) {
         result.message = "No CSCA found for issuer: " + leafIssuerDn.substr(0, 80);
         return result;
     }
 
-    // Step 3: Build chain iteratively
-    // certificates tracks the chain path; we don't own leafCert but we own CSCA pointers
-    struct ChainEntry {
-        X509* cert;
-        bool owned;  // true if we need to free this (CSCA from provider)
-    };
-    std::vector<ChainEntry> chain;
-    chain.push_back({leafCert, false});
+    // Step 3: Build chain iteratively (chain[0] is the caller's leaf certificate)
+    std::vector<X509*> chain;
+    chain.push_back(leafCert);
 
     X509* current = leafCert;
     std::set<std::string> visitedDns;
@@ -73,25 +105,14 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
         // Check if current certificate is self-signed (root)
         if (isSelfSigned(current)) {
             // Verify self-signature (RFC 5280 Section 6.1)
-            if (!verifyCertificateSignature(current, current)) {
+            if (!verifySignature(current, current)) {
                 result.message = "Root CSCA self-signature verification failed at depth " + std::to_string(depth);
-                // Cleanup owned certs
-                for (auto& entry : chain) {
-                    if (entry.owned) X509_free(entry.cert);
-                }
-                // Free remaining allCscas not in chain
-                for (X509* csca : allCscas) {
-                    bool inChain = false;
-                    for (auto& entry : chain) {
-                        if (entry.cert == csca) { inChain = true; break; }
-                    }
-                    if (!inChain) X509_free(csca);
-                }
                 return result;
             }
             result.valid = true;
             result.cscaSubjectDn = getSubjectDn(current);
-            result.cscaFingerprint = getCertificateFingerprint(current);
+            const TrustAnchor* anchor = store ? store->find(current) : nullptr;
+            result.cscaFingerprint = anchor ? anchor->fingerprint : getCertificateFingerprint(current);
             break;
         }
 
@@ -119,7 +140,7 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
             if (strcasecmp(currentIssuerDn.c_str(), cscaSubjectDn.c_str()) == 0) {
                 dnMatched = true;
                 // DN matches — verify signature to confirm correct key pair
-                if (verifyCertificateSignature(current, csca)) {
+                if (verifySignature(current, csca)) {
                     issuer = csca;
                     break;
                 }
@@ -129,16 +150,14 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
 
         if (!issuer) {
             // Try fetching from provider with the new issuer DN (for link cert chains)
-            std::vector<X509*> moreCscas = cscaProvider_->findAllCscasByIssuerDn(currentIssuerDn);
+            std::vector<X509*> moreCscas = findCscas(currentIssuerDn);
             for (X509* csca : moreCscas) {
-                if (verifyCertificateSignature(current, csca)) {
+                allCscas.push_back(csca);
+                if (verifySignature(current, csca)) {
                     issuer = csca;
-                    allCscas.push_back(csca);  // Track for cleanup
                     break;
-                } else {
-                    dnMatched = true;  // DN matched even if signature failed
-                    allCscas.push_back(csca);
                 }
+                dnMatched = true;  // DN matched even if signature failed
             }
         }
 
@@ -155,7 +174,7 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
             break;
         }
 
-        chain.push_back({issuer, true});
+        chain.push_back(issuer);
         current = issuer;
     }
 
@@ -168,11 +187,8 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
         time_t now = time(nullptr);
 
         for (size_t i = 0; i + 1 < chain.size(); i++) {
-            X509* cert = chain[i].cert;
-            X509* issuerCert = chain[i + 1].cert;
-
             // Verify signature (HARD requirement)
-            if (!verifyCertificateSignature(cert, issuerCert)) {
+            if (!verifySignature(chain[i], chain[i + 1])) {
                 result.valid = false;
                 result.message = "Signature verification failed at depth " + std::to_string(i);
                 break;
@@ -181,7 +197,7 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
 
         // Check CSCA expiration (informational)
         for (size_t i = 1; i < chain.size(); i++) {
-            if (X509_cmp_time(X509_get0_notAfter(chain[i].cert), &now) < 0) {
+            if (X509_cmp_time(X509_get0_notAfter(chain[i]), &now) < 0) {
                 result.cscaExpired = true;
             }
         }
@@ -191,29 +207,18 @@ TrustChainResult TrustChainBuilder::build(X509* leafCert, int maxDepth) {
     result.depth = static_cast<int>(chain.size());
     result.path = "DSC";
     for (size_t i = 1; i < chain.size(); i++) {
-        if (isSelfSigned(chain[i].cert)) {
+        const TrustAnchor* anchor = store ? store->find(chain[i]) : nullptr;
+        bool selfSigned = anchor ? anchor->selfSigned : isSelfSigned(chain[i]);
+        bool link = anchor ? anchor->linkCertificate : isLinkCertificate(chain[i]);
+        if (selfSigned) {
             result.path += " -> Root";
-        } else if (isLinkCertificate(chain[i].cert)) {
+        } else if (link) {
             result.path += " -> Link";
         } else {
             result.path += " -> CSCA";
         }
     }
 
-    // Cleanup: free CSCAs not in the chain
-    for (X509* csca : allCscas) {
-        bool inChain = false;
-        for (auto& entry : chain) {
-            if (entry.cert == csca) { inChain = true; break; }
-        }
-        if (!inChain) X509_free(csca);
-    }
-
-    // Free owned chain entries (CSCAs we got from provider)
-    for (auto& entry : chain) {
-        if (entry.owned) X509_free(entry.cert);
-    }
-
     return result;
 }
 
@@ -0,0 +1,272 @@
+/**
+ * @file test_crl_cache.cpp
+ * @brief Unit tests for ParsedCrl / CrlCache and cached CrlChecker
+ */
+
+#include <gtest/gtest.h>
+#include <icao/validation/crl_cache.h>
+#include <icao/validation/crl_checker.h>
+#include <openssl/x509v3.h>
+#include "test_helpers.h"
+
+using namespace icao::validation;
+using namespace test_helpers;
+
+namespace {
+
+struct Asn1IntegerDeleter {
+    void operator()(ASN1_INTEGER* p) const { ASN1_INTEGER_free(p); }
+};
+using UniqueIntegerSerial = std::unique_ptr<ASN1_INTEGER, Asn1IntegerDeleter>;
+
+class CountingCrlProvider : public ICrlProvider {
+public:
+    X509_CRL* crl = nullptr;  // Non-owning
+    int calls = 0;
+
+    X509_CRL* findCrlByCountry(const std::string&) override {
+        calls++;
+        return crl ? X509_CRL_dup(crl) : nullptr;
+    }
+};
+
+/// CRL with (serial, reason) entries; reason < 0 omits the reasonCode extension
+UniqueCrl createCrlWithReasons(EVP_PKEY* key, X509* issuer, const std::vector<std::pair<long, int>>& entries) {
+    auto crl = createCrl(key, issuer, {});
+    for (const auto& [serial, reason] : entries) {
+        X509_REVOKED* rev = X509_REVOKED_new();
+        ASN1_INTEGER* serialAsn1 = ASN1_INTEGER_new();
+        ASN1_INTEGER_set(serialAsn1, serial);
+        X509_REVOKED_set_serialNumber(rev, serialAsn1);
+        ASN1_INTEGER_free(serialAsn1);
+
+        ASN1_TIME* revDate = ASN1_TIME_new();
+        ASN1_TIME_set(revDate, time(nullptr) - 86400L);
+        X509_REVOKED_set_revocationDate(rev, revDate);
+        ASN1_TIME_free(revDate);
+
+        if (reason >= 0) {
+            ASN1_ENUMERATED* reasonEnum = ASN1_ENUMERATED_new();
+            ASN1_ENUMERATED_set(reasonEnum, reason);
+            X509_REVOKED_add1_ext_i2d(rev, NID_crl_reason, reasonEnum, 0, 0);
+            ASN1_ENUMERATED_free(reasonEnum);
+        }
+        X509_CRL_add0_revoked(crl.get(), rev);
+    }
+    X509_CRL_sort(crl.get());
+    X509_CRL_sign(crl.get(), key, EVP_sha256());
+    return crl;
+}
+
+UniqueIntegerSerial makeSerial(long value) {
+    ASN1_INTEGER* serial = ASN1_INTEGER_new();
+    ASN1_INTEGER_set(serial, value);
+    return UniqueIntegerSerial(serial);
+}
+
+} // anonymous namespace
+
+class CrlCacheTest : public ::testing::Test {
+protected:
+    UniqueKey caKey_;
+    UniqueKey dscKey_;
+    UniqueCert rootCa_;
+    UniqueCert dsc_;  // serial 100
+
+    void SetUp() override {
+        caKey_ = generateRsaKey(2048);
+        dscKey_ = generateRsaKey(2048);
+        rootCa_ = createRootCa(caKey_.get(), "CRL Cache CSCA");
+        dsc_ = createDsc(dscKey_.get(), caKey_.get(), rootCa_.get(), "CRL Cache DSC");
+    }
+};
+
+// ============================================================================
+// ParsedCrl
+// ============================================================================
+
+TEST_F(CrlCacheTest, Parse_IndexesRevokedSerialsWithReasons) {
+    auto crl = createCrlWithReasons(caKey_.get(), rootCa_.get(), {{100, 1}, {200, -1}, {300, 8}});
+    auto parsed = ParsedCrl::parse(crl.get());
+    ASSERT_NE(parsed, nullptr);
+
+    int reason = 0;
+    EXPECT_TRUE(parsed->isRevoked(makeSerial(100).get(), reason));
+    EXPECT_EQ(reason, 1);
+    EXPECT_TRUE(parsed->isRevoked(makeSerial(200).get(), reason));
+    EXPECT_EQ(reason, ParsedCrl::kNoReason);
+    EXPECT_FALSE(parsed->isRevoked(makeSerial(300).get(), reason));  // removeFromCRL
+    EXPECT_FALSE(parsed->isRevoked(makeSerial(400).get(), reason));
+    EXPECT_EQ(parsed->revokedCount(), 2u);
+}
+
+TEST_F(CrlCacheTest, Parse_DatesAndFingerprint) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {});
+    auto parsed = ParsedCrl::parse(crl.get());
+
+    EXPECT_FALSE(parsed->thisUpdate().empty());
+    EXPECT_FALSE(parsed->nextUpdate().empty());
+    EXPECT_TRUE(parsed->hasNextUpdate());
+    EXPECT_FALSE(parsed->isExpired(time(nullptr)));
+    EXPECT_TRUE(parsed->isExpired(time(nullptr) + 31 * 86400L));
+    EXPECT_EQ(parsed->fingerprint().size(), 64u);
+}
+
+TEST_F(CrlCacheTest, Parse_Null) {
+    EXPECT_EQ(ParsedCrl::parse(nullptr), nullptr);
+}
+
+// ============================================================================
+// CrlCache
+// ============================================================================
+
+TEST_F(CrlCacheTest, Get_FetchesOncePerCountry) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {100});
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache;
+
+    auto first = cache.get("KR", provider);
+    auto second = cache.get("KR", provider);
+    cache.get("JP", provider);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(provider.calls, 2);
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().countries, 2u);
+}
+
+TEST_F(CrlCacheTest, Get_CachesMissingCrl) {
+    CountingCrlProvider provider;
+    CrlCache cache;
+
+    EXPECT_EQ(cache.get("KR", provider), nullptr);
+    EXPECT_EQ(cache.get("KR", provider), nullptr);
+    EXPECT_EQ(provider.calls, 1);
+}
+
+TEST_F(CrlCacheTest, Invalidate_SameContentReusesIndex) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {100});
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache;
+
+    auto first = cache.get("KR", provider);
+    cache.invalidate("KR");
+    auto second = cache.get("KR", provider);
+
+    EXPECT_EQ(provider.calls, 2);
+    EXPECT_EQ(first, second);  // Same fingerprint → not re-parsed
+    EXPECT_EQ(cache.stats().reparses, 1u);
+}
+
+TEST_F(CrlCacheTest, Invalidate_NewCrlIsPickedUp) {
+    auto oldCrl = createCrl(caKey_.get(), rootCa_.get(), {});
+    auto newCrl = createCrl(caKey_.get(), rootCa_.get(), {100});
+    CountingCrlProvider provider;
+    provider.crl = oldCrl.get();
+    CrlCache cache;
+
+    int reason = 0;
+    EXPECT_FALSE(cache.get("KR", provider)->isRevoked(X509_get_serialNumber(dsc_.get()), reason));
+
+    provider.crl = newCrl.get();
+    EXPECT_FALSE(cache.get("KR", provider)->isRevoked(X509_get_serialNumber(dsc_.get()), reason));  // Still cached
+
+    cache.invalidate("KR");
+    EXPECT_TRUE(cache.get("KR", provider)->isRevoked(X509_get_serialNumber(dsc_.get()), reason));
+}
+
+TEST_F(CrlCacheTest, ZeroTtl_AlwaysRefetches) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {});
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache(std::chrono::seconds(0));
+
+    cache.get("KR", provider);
+    cache.get("KR", provider);
+    EXPECT_EQ(provider.calls, 2);
+    EXPECT_EQ(cache.stats().reparses, 1u);
+}
+
+TEST_F(CrlCacheTest, SetTtl_AppliesToLaterFetches) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {});
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache;
+
+    cache.setTtl(std::chrono::seconds(0));
+    EXPECT_EQ(cache.ttl(), std::chrono::seconds(0));
+    cache.get("KR", provider);
+    cache.get("KR", provider);
+    EXPECT_EQ(provider.calls, 2);
+
+    cache.setTtl(std::chrono::seconds(300));
+    cache.get("KR", provider);
+    cache.get("KR", provider);
+    EXPECT_EQ(provider.calls, 3);
+}
+
+// ============================================================================
+// CrlChecker with cache (same results as uncached)
+// ============================================================================
+
+TEST_F(CrlCacheTest, Checker_RevokedWithReason) {
+    auto crl = createCrlWithReasons(caKey_.get(), rootCa_.get(), {{100, 1}});
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache;
+
+    CrlChecker cached(&provider, &cache);
+    CrlChecker uncached(&provider);
+    auto a = cached.check(dsc_.get(), "KR");
+    auto b = uncached.check(dsc_.get(), "KR");
+
+    EXPECT_EQ(a.status, CrlCheckStatus::REVOKED);
+    EXPECT_EQ(a.revocationReason, "keyCompromise");
+    EXPECT_EQ(a.revocationReason, b.revocationReason);
+    EXPECT_EQ(a.message, b.message);
+    EXPECT_EQ(a.thisUpdate, b.thisUpdate);
+    EXPECT_EQ(a.nextUpdate, b.nextUpdate);
+}
+
+TEST_F(CrlCacheTest, Checker_NotRevokedAndRepeatedChecksHitCache) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {500});
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache;
+    CrlChecker checker(&provider, &cache);
+
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(checker.check(dsc_.get(), "KR").status, CrlCheckStatus::VALID);
+    }
+    EXPECT_EQ(provider.calls, 1);
+}
+
+TEST_F(CrlCacheTest, Checker_ExpiredCrl) {
+    auto crl = createCrl(caKey_.get(), rootCa_.get(), {}, 30, true);
+    CountingCrlProvider provider;
+    provider.crl = crl.get();
+    CrlCache cache;
+    CrlChecker checker(&provider, &cache);
+
+    auto result = checker.check(dsc_.get(), "KR");
+    EXPECT_EQ(result.status, CrlCheckStatus::CRL_EXPIRED);
+    EXPECT_FALSE(result.nextUpdate.empty());
+}
+
+TEST_F(CrlCacheTest, Checker_Unavailable) {
+    CountingCrlProvider provider;
+    CrlCache cache;
+    CrlChecker checker(&provider, &cache);
+
+    EXPECT_EQ(checker.check(dsc_.get(), "KR").status, CrlCheckStatus::CRL_UNAVAILABLE);
+    EXPECT_EQ(checker.check(nullptr, "KR").status, CrlCheckStatus::NOT_CHECKED);
+    EXPECT_EQ(checker.check(dsc_.get(), "").status, CrlCheckStatus::NOT_CHECKED);
+}
+
+TEST(RevocationReasonTest, Names) {
+    EXPECT_EQ(revocationReasonToString(0), "unspecified");
+    EXPECT_EQ(revocationReasonToString(10), "aACompromise");
+    EXPECT_EQ(revocationReasonToString(7), "unknown(7)");
+}
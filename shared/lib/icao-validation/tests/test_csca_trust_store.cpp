@@ -0,0 +1,240 @@
+/**
+ * @file test_csca_trust_store.cpp
+ * @brief Unit tests for CscaTrustStore and trust-store-backed TrustChainBuilder
+ */
+
+#include <gtest/gtest.h>
+#include <icao/validation/csca_trust_store.h>
+#include <icao/validation/trust_chain_builder.h>
+#include <icao/validation/cert_ops.h>
+#include <openssl/x509v3.h>
+#include <thread>
+#include "test_helpers.h"
+
+using namespace icao::validation;
+using namespace test_helpers;
+
+// ============================================================================
+// Providers
+// ============================================================================
+
+// Publishes a trust store; copy-based lookups must not be used by the builder
+class StoreCscaProvider : public ICscaProvider {
+public:
+    CscaTrustStoreHolder holder;
+    int copyLookups = 0;
+
+    std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override {
+        copyLookups++;
+        auto store = holder.load();
+        return store ? store->copyBySubjectDn(issuerDn) : std::vector<X509*>{};
+    }
+
+    X509* findCscaByIssuerDn(const std::string& issuerDn, const std::string&) override {
+        auto cscas = findAllCscasByIssuerDn(issuerDn);
+        for (size_t i = 1; i < cscas.size(); i++) X509_free(cscas[i]);
+        return cscas.empty() ? nullptr : cscas[0];
+    }
+
+    std::shared_ptr<const CscaTrustStore> trustStore() override { return holder.load(); }
+};
+
+namespace {
+
+void addSki(X509* cert, EVP_PKEY* key) {
+    X509V3_CTX ctx;
+    X509V3_set_ctx_nodb(&ctx);
+    X509V3_set_ctx(&ctx, cert, cert, nullptr, nullptr, 0);
+    X509_EXTENSION* ext = X509V3_EXT_conf_nid(nullptr, &ctx, NID_subject_key_identifier, const_cast<char*>("hash"));
+    X509_add_ext(cert, ext, -1);
+    X509_EXTENSION_free(ext);
+    X509_sign(cert, key, EVP_sha256());
+}
+
+std::vector<uint8_t> toDer(X509* cert) {
+    int len = i2d_X509(cert, nullptr);
+    std::vector<uint8_t> der(static_cast<size_t>(len));
+    unsigned char* p = der.data();
+    i2d_X509(cert, &p);
+    return der;
+}
+
+} // anonymous namespace
+
+class CscaTrustStoreTest : public ::testing::Test {
+protected:
+    UniqueKey caKey_;
+    UniqueKey dscKey_;
+    UniqueCert rootCa_;
+    UniqueCert dsc_;
+
+    void SetUp() override {
+        caKey_ = generateRsaKey(2048);
+        dscKey_ = generateRsaKey(2048);
+        rootCa_ = createRootCa(caKey_.get(), "Store Root CSCA");
+        addSki(rootCa_.get(), caKey_.get());
+        dsc_ = createDsc(dscKey_.get(), caKey_.get(), rootCa_.get(), "Store DSC");
+    }
+};
+
+// ============================================================================
+// Store construction and lookups
+// ============================================================================
+
+TEST_F(CscaTrustStoreTest, Create_IndexesBySubjectDn) {
+    auto store = CscaTrustStore::create({rootCa_.get()});
+    ASSERT_EQ(store->size(), 1u);
+
+    // Lookup is format-independent (normalized DN)
+    const auto& bySlash = store->findBySubjectDn(getSubjectDn(rootCa_.get()));
+    const auto& byComma = store->findBySubjectDn("CN=Store Root CSCA,O=Test CA,C=KR");
+    ASSERT_EQ(bySlash.size(), 1u);
+    ASSERT_EQ(byComma.size(), 1u);
+    EXPECT_EQ(bySlash[0], byComma[0]);
+    EXPECT_TRUE(store->findBySubjectDn("CN=Unknown,C=XX").empty());
+}
+
+TEST_F(CscaTrustStoreTest, Create_PreExtractsAttributes) {
+    auto store = CscaTrustStore::create({rootCa_.get()});
+    const TrustAnchor& anchor = store->anchors().at(0);
+
+    EXPECT_NE(anchor.publicKey, nullptr);
+    EXPECT_TRUE(anchor.selfSigned);
+    EXPECT_FALSE(anchor.linkCertificate);
+    EXPECT_EQ(anchor.fingerprint, getCertificateFingerprint(rootCa_.get()));
+    EXPECT_EQ(anchor.ski.size(), 40u);  // SHA-1 hash method
+    EXPECT_TRUE(verifyCertificateSignatureWithKey(dsc_.get(), anchor.publicKey));
+}
+
+TEST_F(CscaTrustStoreTest, FindBySki) {
+    auto store = CscaTrustStore::create({rootCa_.get()});
+    const std::string& ski = store->anchors().at(0).ski;
+
+    const auto& found = store->findBySki(ski);
+    ASSERT_EQ(found.size(), 1u);
+    EXPECT_EQ(found[0]->cert, store->anchors().at(0).cert);
+    EXPECT_TRUE(store->findBySki("00").empty());
+}
+
+TEST_F(CscaTrustStoreTest, FindByCertPointer) {
+    auto store = CscaTrustStore::create({rootCa_.get()});
+    EXPECT_NE(store->find(rootCa_.get()), nullptr);  // Store up-refs, same object
+    EXPECT_EQ(store->find(dsc_.get()), nullptr);
+}
+
+TEST_F(CscaTrustStoreTest, Create_UpRefsCertificates) {
+    X509* dup = X509_dup(rootCa_.get());
+    auto store = CscaTrustStore::create({dup});
+    X509_free(dup);  // Store keeps its own reference
+
+    ASSERT_EQ(store->size(), 1u);
+    EXPECT_EQ(getSubjectDn(store->anchors()[0].cert), getSubjectDn(rootCa_.get()));
+}
+
+TEST_F(CscaTrustStoreTest, FromDer_SkipsUnparseable) {
+    std::vector<std::vector<uint8_t>> ders = {toDer(rootCa_.get()), {0x01, 0x02, 0x03}};
+    auto store = CscaTrustStore::fromDer(ders);
+    EXPECT_EQ(store->size(), 1u);
+}
+
+TEST_F(CscaTrustStoreTest, CopyBySubjectDn_ReturnsOwnedReferences) {
+    auto store = CscaTrustStore::create({rootCa_.get()});
+    auto copies = store->copyBySubjectDn(getSubjectDn(rootCa_.get()));
+    ASSERT_EQ(copies.size(), 1u);
+    for (X509* cert : copies) X509_free(cert);
+    // Store's own reference still valid
+    EXPECT_FALSE(getSubjectDn(store->anchors()[0].cert).empty());
+}
+
+TEST_F(CscaTrustStoreTest, Generation_IncreasesPerStore) {
+    auto first = CscaTrustStore::create({rootCa_.get()});
+    auto second = CscaTrustStore::create({rootCa_.get()});
+    EXPECT_GT(second->generation(), first->generation());
+}
+
+// ============================================================================
+// Holder (RCU-style publication)
+// ============================================================================
+
+TEST_F(CscaTrustStoreTest, Holder_SnapshotSurvivesPublish) {
+    CscaTrustStoreHolder holder;
+    EXPECT_EQ(holder.load(), nullptr);
+
+    holder.publish(CscaTrustStore::create({rootCa_.get()}));
+    auto snapshot = holder.load();
+    ASSERT_NE(snapshot, nullptr);
+
+    holder.publish(CscaTrustStore::create({}));
+    EXPECT_EQ(holder.load()->size(), 0u);
+    EXPECT_EQ(snapshot->size(), 1u);  // Old readers unaffected
+
+    holder.reset();
+    EXPECT_EQ(holder.load(), nullptr);
+}
+
+// ============================================================================
+// TrustChainBuilder with borrowed lookups
+// ============================================================================
+
+TEST_F(CscaTrustStoreTest, Builder_UsesStoreWithoutCopies) {
+    StoreCscaProvider provider;
+    provider.holder.publish(CscaTrustStore::create({rootCa_.get()}));
+
+    TrustChainBuilder builder(&provider);
+    auto result = builder.build(dsc_.get());
+
+    EXPECT_TRUE(result.valid) << result.message;
+    EXPECT_EQ(result.path, "DSC -> Root");
+    EXPECT_EQ(result.depth, 2);
+    EXPECT_EQ(result.cscaFingerprint, getCertificateFingerprint(rootCa_.get()));
+    EXPECT_EQ(provider.copyLookups, 0);
+}
+
+TEST_F(CscaTrustStoreTest, Builder_LinkChainViaStore) {
+    auto linkKey = generateRsaKey(2048);
+    auto linkCert = createLinkCert(linkKey.get(), caKey_.get(), rootCa_.get(), "Store Link CSCA");
+    auto dscKey = generateRsaKey(2048);
+    auto dsc = createDsc(dscKey.get(), linkKey.get(), linkCert.get(), "Link DSC");
+
+    StoreCscaProvider provider;
+    provider.holder.publish(CscaTrustStore::create({rootCa_.get(), linkCert.get()}));
+
+    TrustChainBuilder builder(&provider);
+    auto result = builder.build(dsc.get());
+
+    EXPECT_TRUE(result.valid) << result.message;
+    EXPECT_EQ(result.path, "DSC -> Link -> Root");
+}
+
+TEST_F(CscaTrustStoreTest, Builder_WrongKeyFailsViaStore) {
+    auto otherKey = generateRsaKey(2048);
+    auto otherRoot = createRootCa(otherKey.get(), "Store Root CSCA");  // Same DN, different key
+
+    StoreCscaProvider provider;
+    provider.holder.publish(CscaTrustStore::create({otherRoot.get()}));
+
+    TrustChainBuilder builder(&provider);
+    auto result = builder.build(dsc_.get());
+
+    EXPECT_FALSE(result.valid);
+    EXPECT_NE(result.message.find("Signature verification failed"), std::string::npos);
+}
+
+TEST_F(CscaTrustStoreTest, Builder_ConcurrentBuildsShareStore) {
+    StoreCscaProvider provider;
+    provider.holder.publish(CscaTrustStore::create({rootCa_.get()}));
+
+    std::atomic<int> validCount{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            TrustChainBuilder builder(&provider);
+            for (int i = 0; i < 10; i++) {
+                if (builder.build(dsc_.get()).valid) validCount++;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(validCount.load(), 40);
+}
@@ -0,0 +1,224 @@
+/**
+ * @file test_signature_cache.cpp
+ * @brief Unit tests for SignatureVerificationCache and its use by TrustChainBuilder
+ */
+
+#include <gtest/gtest.h>
+#include <icao/validation/signature_cache.h>
+#include <icao/validation/csca_trust_store.h>
+#include <icao/validation/trust_chain_builder.h>
+#include <icao/validation/cert_ops.h>
+#include <thread>
+#include "test_helpers.h"
+
+using namespace icao::validation;
+using namespace test_helpers;
+
+namespace {
+
+class StoreProvider : public ICscaProvider {
+public:
+    std::shared_ptr<const CscaTrustStore> store;
+
+    std::vector<X509*> findAllCscasByIssuerDn(const std::string& issuerDn) override {
+        return store ? store->copyBySubjectDn(issuerDn) : std::vector<X509*>{};
+    }
+    X509* findCscaByIssuerDn(const std::string&, const std::string&) override { return nullptr; }
+    std::shared_ptr<const CscaTrustStore> trustStore() override { return store; }
+};
+
+} // anonymous namespace
+
+class SignatureCacheTest : public ::testing::Test {
+protected:
+    UniqueKey caKey_;
+    UniqueKey dscKey_;
+    UniqueCert rootCa_;
+    UniqueCert dsc_;
+
+    void SetUp() override {
+        caKey_ = generateRsaKey(2048);
+        dscKey_ = generateRsaKey(2048);
+        rootCa_ = createRootCa(caKey_.get(), "Cache Root CSCA");
+        dsc_ = createDsc(dscKey_.get(), caKey_.get(), rootCa_.get(), "Cache DSC");
+    }
+};
+
+// ============================================================================
+// Direct verification
+// ============================================================================
+
+TEST_F(SignatureCacheTest, Verify_SecondCallIsHit) {
+    SignatureVerificationCache cache;
+
+    EXPECT_TRUE(cache.verify(dsc_.get(), rootCa_.get()));
+    EXPECT_TRUE(cache.verify(dsc_.get(), rootCa_.get()));
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST_F(SignatureCacheTest, Verify_NegativeOutcomeCached) {
+    SignatureVerificationCache cache;
+    auto otherKey = generateRsaKey(2048);
+    auto otherCa = createRootCa(otherKey.get(), "Cache Root CSCA");
+
+    EXPECT_FALSE(cache.verify(dsc_.get(), otherCa.get()));
+    EXPECT_FALSE(cache.verify(dsc_.get(), otherCa.get()));
+    EXPECT_EQ(cache.stats().misses, 1u);
+
+    // Same child against the right issuer key is a separate entry
+    EXPECT_TRUE(cache.verify(dsc_.get(), rootCa_.get()));
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
+
+TEST_F(SignatureCacheTest, Verify_KeyedByIssuerPublicKeyNotCertificate) {
+    SignatureVerificationCache cache;
+    EXPECT_TRUE(cache.verify(dsc_.get(), rootCa_.get()));
+
+    // Another certificate carrying the same public key shares the entry
+    auto reissued = createRootCa(caKey_.get(), "Cache Root CSCA Reissued");
+    EXPECT_TRUE(cache.verify(dsc_.get(), reissued.get()));
+    EXPECT_EQ(cache.stats().hits, 1u);
+}
+
+TEST_F(SignatureCacheTest, SpkiDigest_HashesFullSubjectPublicKeyInfo) {
+    SignatureVerificationCache::Digest digest{};
+    ASSERT_TRUE(SignatureVerificationCache::spkiDigest(rootCa_.get(), digest));
+
+    unsigned char* der = nullptr;
+    int derLen = i2d_X509_PUBKEY(X509_get_X509_PUBKEY(rootCa_.get()), &der);
+    ASSERT_GT(derLen, 0);
+    SignatureVerificationCache::Digest expected{};
+    unsigned int len = 0;
+    ASSERT_EQ(EVP_Digest(der, static_cast<size_t>(derLen), expected.data(), &len, EVP_sha256(), nullptr), 1);
+    OPENSSL_free(der);
+    EXPECT_EQ(digest, expected);
+
+    // The key-bits-only digest ignores the AlgorithmIdentifier and must differ
+    SignatureVerificationCache::Digest bitsOnly{};
+    ASSERT_EQ(X509_pubkey_digest(rootCa_.get(), EVP_sha256(), bitsOnly.data(), &len), 1);
+    EXPECT_NE(digest, bitsOnly);
+
+    EXPECT_FALSE(SignatureVerificationCache::spkiDigest(nullptr, digest));
+}
+
+TEST_F(SignatureCacheTest, Verify_NullInputs) {
+    SignatureVerificationCache cache;
+    EXPECT_FALSE(cache.verify(nullptr, rootCa_.get()));
+    EXPECT_FALSE(cache.verify(dsc_.get(), static_cast<X509*>(nullptr)));
+}
+
+TEST_F(SignatureCacheTest, Bounded) {
+    SignatureVerificationCache cache(16);
+    std::vector<UniqueCert> dscs;
+    for (int i = 0; i < 40; i++) {
+        auto key = generateEcKey();
+        dscs.push_back(createDsc(key.get(), caKey_.get(), rootCa_.get(), "DSC " + std::to_string(i)));
+        EXPECT_TRUE(cache.verify(dscs.back().get(), rootCa_.get()));
+    }
+    EXPECT_LE(cache.stats().entries, 16u);
+}
+
+TEST_F(SignatureCacheTest, Clear_ResetsEntriesAndCounters) {
+    SignatureVerificationCache cache;
+    cache.verify(dsc_.get(), rootCa_.get());
+    cache.clear();
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.entries, 0u);
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.misses, 0u);
+}
+
+// ============================================================================
+// Trust store anchors
+// ============================================================================
+
+TEST_F(SignatureCacheTest, AnchorVerify_SharesEntriesWithCertVerify) {
+    SignatureVerificationCache cache;
+    auto store = CscaTrustStore::create({rootCa_.get()});
+
+    EXPECT_TRUE(cache.verify(dsc_.get(), rootCa_.get()));
+    EXPECT_TRUE(cache.verify(dsc_.get(), store->anchors()[0]));
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+TEST_F(SignatureCacheTest, SelfSignature_CachedPerGeneration) {
+    SignatureVerificationCache cache;
+    auto store = CscaTrustStore::create({rootCa_.get()});
+    const TrustAnchor& root = store->anchors()[0];
+
+    EXPECT_TRUE(cache.verifySelfSignature(root, store->generation()));
+    EXPECT_TRUE(cache.verifySelfSignature(root, store->generation()));
+    EXPECT_EQ(cache.stats().misses, 1u);
+    EXPECT_EQ(cache.stats().hits, 1u);
+
+    // New generation: generation entry misses, but no second X509_verify
+    auto reloaded = CscaTrustStore::create({rootCa_.get()});
+    EXPECT_TRUE(cache.verifySelfSignature(reloaded->anchors()[0], reloaded->generation()));
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+// ============================================================================
+// TrustChainBuilder integration
+// ============================================================================
+
+TEST_F(SignatureCacheTest, Builder_RepeatedBuildsDoNotReverify) {
+    SignatureVerificationCache cache;
+    StoreProvider provider;
+    provider.store = CscaTrustStore::create({rootCa_.get()});
+    TrustChainBuilder builder(&provider, &cache);
+
+    ASSERT_TRUE(builder.build(dsc_.get()).valid);
+    // DSC -> Root and Root self-signature, each verified once
+    // (Step 6 re-validation of DSC -> Root is already a hit)
+    EXPECT_EQ(cache.stats().misses, 2u);
+
+    ASSERT_TRUE(builder.build(dsc_.get()).valid);
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
+
+TEST_F(SignatureCacheTest, Builder_CopyProviderAlsoCached) {
+    SignatureVerificationCache cache;
+    StoreProvider storeProvider;
+    storeProvider.store = CscaTrustStore::create({rootCa_.get()});
+
+    // Copy-based provider wrapper without trustStore()
+    class CopyProvider : public ICscaProvider {
+    public:
+        StoreProvider* inner;
+        std::vector<X509*> findAllCscasByIssuerDn(const std::string& dn) override {
+            return inner->findAllCscasByIssuerDn(dn);
+        }
+        X509* findCscaByIssuerDn(const std::string&, const std::string&) override { return nullptr; }
+    } provider;
+    provider.inner = &storeProvider;
+
+    TrustChainBuilder builder(&provider, &cache);
+    ASSERT_TRUE(builder.build(dsc_.get()).valid);
+    uint64_t misses = cache.stats().misses;
+    ASSERT_TRUE(builder.build(dsc_.get()).valid);
+    EXPECT_EQ(cache.stats().misses, misses);
+}
+
+TEST_F(SignatureCacheTest, ConcurrentVerify) {
+    SignatureVerificationCache cache;
+    std::atomic<int> validCount{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 50; i++) {
+                if (cache.verify(dsc_.get(), rootCa_.get())) validCount++;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(validCount.load(), 200);
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 200u);
+    EXPECT_EQ(stats.entries, 1u);
+}
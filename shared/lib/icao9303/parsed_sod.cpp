@@ -0,0 +1,353 @@
+/**
+ * @file parsed_sod.cpp
+ * @brief ParsedSod implementation — single CMS decode with memoized field views
+ */
+
+#include "parsed_sod.h"
+#include "sod_parser.h"
+#include <spdlog/spdlog.h>
+#include <cstdio>
+#include <ctime>
+#include <stdexcept>
+#include <utility>
+#include <openssl/asn1.h>
+#include <openssl/bio.h>
+#include <openssl/objects.h>
+
+namespace icao {
+
+namespace {
+
+std::string algorithmOid(const X509_ALGOR* alg) {
+    if (!alg) return "";
+    const ASN1_OBJECT* obj = nullptr;
+    X509_ALGOR_get0(&obj, nullptr, nullptr, alg);
+    char oidBuf[80];
+    OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
+    return oidBuf;
+}
+
+} // anonymous namespace
+
+// ============================================================
+// Construction
+// ============================================================
+
+ParsedSod::ParsedSod(const std::vector<uint8_t>& sodBytes)
+    : sodSize_(sodBytes.size())
+    , hasIcaoWrapper_(!sodBytes.empty() && sodBytes[0] == 0x77)
+{
+    size_t offset = cmsOffset(sodBytes);
+    const unsigned char* p = sodBytes.data() + offset;
+    cms_ = d2i_CMS_ContentInfo(nullptr, &p, static_cast<long>(sodBytes.size() - offset));
+    if (!cms_) {
+        throw std::runtime_error("Failed to parse CMS structure");
+    }
+}
+
+ParsedSod::~ParsedSod() {
+    if (dsc_) X509_free(dsc_);
+    if (cms_) CMS_ContentInfo_free(cms_);
+}
+
+ParsedSod::ParsedSod(ParsedSod&& other) noexcept
+    : cms_(std::exchange(other.cms_, nullptr))
+    , sodSize_(other.sodSize_)
+    , hasIcaoWrapper_(other.hasIcaoWrapper_)
+    , signerAlgorithmsLoaded_(other.signerAlgorithmsLoaded_)
+    , signatureAlgorithmOid_(std::move(other.signatureAlgorithmOid_))
+    , cmsDigestAlgorithmOid_(std::move(other.cmsDigestAlgorithmOid_))
+    , ldsLoaded_(other.ldsLoaded_)
+    , lds_(std::move(other.lds_))
+    , dscLoaded_(other.dscLoaded_)
+    , dsc_(std::exchange(other.dsc_, nullptr))
+    , signingTime_(std::move(other.signingTime_))
+{
+}
+
+ParsedSod& ParsedSod::operator=(ParsedSod&& other) noexcept {
+    if (this != &other) {
+        if (dsc_) X509_free(dsc_);
+        if (cms_) CMS_ContentInfo_free(cms_);
+        cms_ = std::exchange(other.cms_, nullptr);
+        sodSize_ = other.sodSize_;
+        hasIcaoWrapper_ = other.hasIcaoWrapper_;
+        signerAlgorithmsLoaded_ = other.signerAlgorithmsLoaded_;
+        signatureAlgorithmOid_ = std::move(other.signatureAlgorithmOid_);
+        cmsDigestAlgorithmOid_ = std::move(other.cmsDigestAlgorithmOid_);
+        ldsLoaded_ = other.ldsLoaded_;
+        lds_ = std::move(other.lds_);
+        dscLoaded_ = other.dscLoaded_;
+        dsc_ = std::exchange(other.dsc_, nullptr);
+        signingTime_ = std::move(other.signingTime_);
+    }
+    return *this;
+}
+
+size_t ParsedSod::cmsOffset(const std::vector<uint8_t>& sodBytes) {
+    // Check if SOD has ICAO wrapper tag (0x77)
+    if (sodBytes.size() <= 4 || sodBytes[0] != 0x77) return 0;
+
+    // Skip tag and length bytes (length can be short or long form)
+    size_t offset = 1;
+    if (sodBytes[offset] & 0x80) {
+        size_t numLengthBytes = sodBytes[offset] & 0x7F;
+        if (offset + numLengthBytes + 1 > sodBytes.size()) {
+            spdlog::error("SOD unwrap: length bytes exceed buffer");
+            return 0;
+        }
+        offset += numLengthBytes + 1;
+    } else {
+        offset += 1;
+    }
+
+    if (offset >= sodBytes.size()) {
+        spdlog::error("SOD unwrap: offset exceeds buffer after length parse");
+        return 0;
+    }
+    return offset;
+}
+
+// ============================================================
+// Memoized views
+// ============================================================
+
+CMS_SignerInfo* ParsedSod::signerInfo() const {
+    STACK_OF(CMS_SignerInfo)* signerInfos = CMS_get0_SignerInfos(cms_);
+    if (!signerInfos || sk_CMS_SignerInfo_num(signerInfos) == 0) return nullptr;
+    return sk_CMS_SignerInfo_value(signerInfos, 0);
+}
+
+void ParsedSod::loadSignerAlgorithms() const {
+    if (signerAlgorithmsLoaded_) return;
+    signerAlgorithmsLoaded_ = true;
+
+    CMS_SignerInfo* si = signerInfo();
+    if (!si) return;
+
+    // 3rd param: CMS digest algorithm (NOT the DG hash algorithm), 4th: signature algorithm
+    X509_ALGOR* digestAlg = nullptr;
+    X509_ALGOR* signatureAlg = nullptr;
+    CMS_SignerInfo_get0_algs(si, nullptr, nullptr, &digestAlg, &signatureAlg);
+    cmsDigestAlgorithmOid_ = algorithmOid(digestAlg);
+    signatureAlgorithmOid_ = algorithmOid(signatureAlg);
+}
+
+const std::string& ParsedSod::signatureAlgorithmOid() const {
+    loadSignerAlgorithms();
+    return signatureAlgorithmOid_;
+}
+
+const std::string& ParsedSod::cmsDigestAlgorithmOid() const {
+    loadSignerAlgorithms();
+    return cmsDigestAlgorithmOid_;
+}
+
+const ParsedSod::LdsSecurityObject* ParsedSod::ldsSecurityObject() const {
+    if (!ldsLoaded_) {
+        ldsLoaded_ = true;
+        lds_ = parseLdsSecurityObject(cms_);
+    }
+    return lds_ ? &*lds_ : nullptr;
+}
+
+X509* ParsedSod::dscCertificate() const {
+    if (!dscLoaded_) {
+        dscLoaded_ = true;
+        STACK_OF(X509)* certs = CMS_get1_certs(cms_);
+        if (certs && sk_X509_num(certs) > 0) {
+            // Take first certificate (DSC)
+            dsc_ = X509_dup(sk_X509_value(certs, 0));
+        }
+        if (certs) sk_X509_pop_free(certs, X509_free);
+    }
+    return dsc_;
+}
+
+const std::string& ParsedSod::signingTime() const {
+    if (signingTime_) return *signingTime_;
+    signingTime_.emplace();
+
+    CMS_SignerInfo* si = signerInfo();
+    if (!si) return *signingTime_;
+
+    // Get signing time from signed attributes (NID_pkcs9_signingTime)
+    int idx = CMS_signed_get_attr_by_NID(si, NID_pkcs9_signingTime, -1);
+    if (idx < 0) {
+        spdlog::debug("No signingTime attribute found in SOD CMS signed attributes");
+        return *signingTime_;
+    }
+
+    X509_ATTRIBUTE* attr = CMS_signed_get_attr(si, idx);
+    ASN1_TYPE* attrVal = attr ? X509_ATTRIBUTE_get0_type(attr, 0) : nullptr;
+    if (!attrVal) return *signingTime_;
+
+    ASN1_TIME* sigTime = nullptr;
+    if (attrVal->type == V_ASN1_UTCTIME) {
+        sigTime = attrVal->value.utctime;
+    } else if (attrVal->type == V_ASN1_GENERALIZEDTIME) {
+        sigTime = attrVal->value.generalizedtime;
+    }
+
+    struct tm tmResult = {};
+    if (sigTime && ASN1_TIME_to_tm(sigTime, &tmResult) == 1) {
+        char buf[64];  // Headroom over the 20-char timestamp for -Wformat-truncation
+        snprintf(buf, sizeof(buf), "%04d-%02d-%02dT%02d:%02d:%02dZ",
+                 tmResult.tm_year + 1900,
+                 tmResult.tm_mon + 1,
+                 tmResult.tm_mday,
+                 tmResult.tm_hour,
+                 tmResult.tm_min,
+                 tmResult.tm_sec);
+        *signingTime_ = buf;
+    }
+    return *signingTime_;
+}
+
+// ============================================================
+// LDSSecurityObject parser
+// ============================================================
+
+std::optional<ParsedSod::LdsSecurityObject> ParsedSod::parseLdsSecurityObject(CMS_ContentInfo* cms) {
+    if (!cms) return std::nullopt;
+
+    // Get encapsulated content
+    ASN1_OCTET_STRING** contentPtr = CMS_get0_content(cms);
+    if (!contentPtr || !*contentPtr) {
+        spdlog::error("No encapsulated content in CMS");
+        return std::nullopt;
+    }
+
+    const unsigned char* p = ASN1_STRING_get0_data(*contentPtr);
+    long dataLen = ASN1_STRING_length(*contentPtr);
+    const unsigned char* end = p + dataLen;
+
+    LdsSecurityObject result;
+
+    // LDSSecurityObject ::= SEQUENCE {
+    //   version INTEGER,
+    //   hashAlgorithm AlgorithmIdentifier,
+    //   dataGroupHashValues SEQUENCE OF DataGroupHash,
+    //   ldsVersionInfo LDSVersionInfo OPTIONAL  -- only if version == 1
+    // }
+
+    // Outer SEQUENCE
+    if (p >= end || *p != 0x30) {
+        spdlog::error("Expected SEQUENCE tag for LDSSecurityObject");
+        return std::nullopt;
+    }
+    p++;
+    size_t seqLen = 0;
+    if (!SodParser::parseAsn1Length(p, end, seqLen)) return std::nullopt;
+
+    // --- version INTEGER ---
+    if (p < end && *p == 0x02) {
+        p++;  // skip tag
+        size_t vLen = 0;
+        if (!SodParser::parseAsn1Length(p, end, vLen)) return std::nullopt;
+        if (p + vLen > end) return std::nullopt;
+
+        // Parse version value (typically 0 or 1)
+        result.version = 0;
+        for (size_t i = 0; i < vLen; i++) {
+            result.version = (result.version << 8) | *p++;
+        }
+        spdlog::debug("LDSSecurityObject version: {}", result.version);
+    }
+
+    // --- hashAlgorithm AlgorithmIdentifier SEQUENCE ---
+    if (p >= end || *p != 0x30) {
+        spdlog::error("Expected AlgorithmIdentifier SEQUENCE in LDSSecurityObject");
+        return std::nullopt;
+    }
+    p++;  // skip SEQUENCE tag
+    size_t algIdLen = 0;
+    if (!SodParser::parseAsn1Length(p, end, algIdLen)) return std::nullopt;
+    if (p + algIdLen > end) return std::nullopt;
+
+    const unsigned char* algIdEnd = p + algIdLen;
+
+    // First element inside AlgorithmIdentifier is the OID
+    if (p < algIdEnd && *p == 0x06) {
+        const unsigned char* oidTlvStart = p;
+        p++;  // skip tag
+        size_t oidLen = 0;
+        if (!SodParser::parseAsn1Length(p, algIdEnd, oidLen)) return std::nullopt;
+
+        // Build OID TLV for d2i_ASN1_OBJECT
+        long oidTlvLen = static_cast<long>((p - oidTlvStart) + oidLen);
+        if (oidTlvStart + oidTlvLen > end) return std::nullopt;
+
+        const unsigned char* bp = oidTlvStart;
+        ASN1_OBJECT* obj = d2i_ASN1_OBJECT(nullptr, &bp, oidTlvLen);
+        if (obj) {
+            char oidBuf[80];
+            OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
+            result.hashAlgorithmOid = oidBuf;
+            ASN1_OBJECT_free(obj);
+            spdlog::debug("LDSSecurityObject hashAlgorithm OID: {}", result.hashAlgorithmOid);
+        }
+    }
+
+    // Skip to end of AlgorithmIdentifier (may have optional parameters)
+    p = algIdEnd;
+
+    // --- dataGroupHashValues SEQUENCE OF DataGroupHash ---
+    if (p >= end || *p != 0x30) {
+        spdlog::error("Expected SEQUENCE OF DataGroupHash in LDSSecurityObject");
+        return std::nullopt;
+    }
+    p++;  // skip tag
+    size_t dgHashesLen = 0;
+    if (!SodParser::parseAsn1Length(p, end, dgHashesLen)) return std::nullopt;
+
+    const unsigned char* dgHashesEnd = p + dgHashesLen;
+    if (dgHashesEnd > end) dgHashesEnd = end;
+
+    // Parse each DataGroupHash ::= SEQUENCE { dataGroupNumber INTEGER, dataGroupHashValue OCTET STRING }
+    while (p < dgHashesEnd) {
+        if (*p != 0x30) break;
+        p++;
+        size_t dgHashLen = 0;
+        if (!SodParser::parseAsn1Length(p, dgHashesEnd, dgHashLen)) break;
+
+        const unsigned char* dgHashEnd = p + dgHashLen;
+        if (dgHashEnd > dgHashesEnd) break;
+
+        // dataGroupNumber INTEGER
+        int dgNumber = 0;
+        if (p < dgHashEnd && *p == 0x02) {
+            p++;
+            size_t intLen = 0;
+            if (!SodParser::parseAsn1Length(p, dgHashEnd, intLen) || p + intLen > dgHashEnd) {
+                p = dgHashEnd;
+                continue;
+            }
+            for (size_t i = 0; i < intLen; i++) {
+                dgNumber = (dgNumber << 8) | *p++;
+            }
+        }
+
+        // dataGroupHashValue OCTET STRING
+        if (p < dgHashEnd && *p == 0x04) {
+            p++;
+            size_t hashLen = 0;
+            if (!SodParser::parseAsn1Length(p, dgHashEnd, hashLen) || p + hashLen > dgHashEnd) {
+                p = dgHashEnd;
+                continue;
+            }
+            result.dgHashes[dgNumber] = std::vector<uint8_t>(p, p + hashLen);
+            p += hashLen;
+            spdlog::debug("Parsed DG{} hash: {} bytes", dgNumber, hashLen);
+        }
+
+        p = dgHashEnd;
+    }
+
+    spdlog::info("Parsed LDSSecurityObject: version={}, hashAlg={}, {} DG hashes",
+        result.version, result.hashAlgorithmOid, result.dgHashes.size());
+
+    return result;
+}
+
+} // namespace icao
@@ -0,0 +1,107 @@
+/**
+ * @file parsed_sod.h
+ * @brief Decoded SOD handle: one CMS parse shared by all field extractions
+ *
+ * The SOD is unwrapped and decoded (d2i_CMS_bio) once in the constructor.
+ * Every other field — SignerInfo algorithms, LDSSecurityObject, DSC,
+ * signing time — is computed on first access from the owned CMS_ContentInfo
+ * and memoized, so parseSod(), parseSodForApi() and verifySodSignature() can
+ * share a single decode per request.
+ *
+ * Not thread-safe: a ParsedSod belongs to the request that created it.
+ *
+ * @author SMARTCORE Inc.
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include <openssl/cms.h>
+#include <openssl/x509.h>
+
+namespace icao {
+
+class ParsedSod {
+public:
+    /**
+     * @brief Parsed LDSSecurityObject fields (CMS encapsulated content)
+     */
+    struct LdsSecurityObject {
+        int version = 0;                                 // 0 = V0, 1 = V1
+        std::string hashAlgorithmOid;                    // Hash algorithm OID for DG hashes
+        std::map<int, std::vector<uint8_t>> dgHashes;    // DG number → hash bytes
+    };
+
+    /**
+     * @brief Decode SOD bytes (with or without the ICAO 0x77 wrapper)
+     * @param sodBytes SOD data bytes
+     * @throws std::runtime_error if the bytes are not a CMS structure
+     */
+    explicit ParsedSod(const std::vector<uint8_t>& sodBytes);
+    ~ParsedSod();
+
+    ParsedSod(ParsedSod&& other) noexcept;
+    ParsedSod& operator=(ParsedSod&& other) noexcept;
+    ParsedSod(const ParsedSod&) = delete;
+    ParsedSod& operator=(const ParsedSod&) = delete;
+
+    /// @name Input metadata
+
+    size_t sodSize() const { return sodSize_; }
+    bool hasIcaoWrapper() const { return hasIcaoWrapper_; }
+
+    /**
+     * @brief Offset of the CMS structure inside SOD bytes (0 if no 0x77 wrapper)
+     */
+    static size_t cmsOffset(const std::vector<uint8_t>& sodBytes);
+
+    /// @name Memoized views (computed on first access)
+
+    /// Decoded CMS (owned by this handle)
+    CMS_ContentInfo* cms() const { return cms_; }
+
+    /// First SignerInfo, or nullptr if the SOD has none
+    CMS_SignerInfo* signerInfo() const;
+
+    /// CMS SignerInfo signature algorithm OID (empty if absent)
+    const std::string& signatureAlgorithmOid() const;
+
+    /// CMS SignerInfo digest algorithm OID (empty if absent; may differ from the LDS hash)
+    const std::string& cmsDigestAlgorithmOid() const;
+
+    /// LDSSecurityObject, or nullptr if the encapsulated content does not parse
+    const LdsSecurityObject* ldsSecurityObject() const;
+
+    /// DSC certificate (first embedded certificate, owned by this handle) or nullptr
+    X509* dscCertificate() const;
+
+    /// Signing time from the signed attributes ("YYYY-MM-DDTHH:MM:SSZ") or empty
+    const std::string& signingTime() const;
+
+private:
+    void loadSignerAlgorithms() const;
+
+    static std::optional<LdsSecurityObject> parseLdsSecurityObject(CMS_ContentInfo* cms);
+
+    CMS_ContentInfo* cms_ = nullptr;
+    size_t sodSize_ = 0;
+    bool hasIcaoWrapper_ = false;
+
+    // Memoized fields
+    mutable bool signerAlgorithmsLoaded_ = false;
+    mutable std::string signatureAlgorithmOid_;
+    mutable std::string cmsDigestAlgorithmOid_;
+    mutable bool ldsLoaded_ = false;
+    mutable std::optional<LdsSecurityObject> lds_;
+    mutable bool dscLoaded_ = false;
+    mutable X509* dsc_ = nullptr;
+    mutable std::optional<std::string> signingTime_;
+};
+
+} // namespace icao
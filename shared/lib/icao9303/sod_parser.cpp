@@ -8,7 +8,8 @@
  *   Example: NL Specimen uses SHA-256 for DG hashes, SHA-512 for CMS signature.
  * - Unknown algorithm OIDs are returned as-is with a warning log,
  *   never silently replaced with a wrong fallback.
- * - LDSSecurityObject parsing is consolidated into a single helper method.
+ * - The SOD is decoded once into a ParsedSod (parsed_sod.h); LDSSecurityObject
+ *   parsing and all other field extraction live there and are memoized.
  */
 
 #include "sod_parser.h"
@@ -96,140 +97,94 @@ SodParser::SodParser() {
 models::SodData SodParser::parseSod(const std::vector<uint8_t>& sodBytes) {
     spdlog::debug("Parsing SOD ({} bytes)", sodBytes.size());
 
-    models::SodData sodData;
-
     try {
-        // Parse CMS once, extract all information from it
-        std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-        BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-        if (!bio) throw std::runtime_error("Failed to create BIO for SOD parsing");
-
-        CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-        BIO_free(bio);
-        if (!cms) throw std::runtime_error("Failed to parse CMS structure");
-
-        // --- Extract CMS-level algorithms (SignerInfo) ---
-        STACK_OF(CMS_SignerInfo)* signerInfos = CMS_get0_SignerInfos(cms);
-        if (signerInfos && sk_CMS_SignerInfo_num(signerInfos) > 0) {
-            CMS_SignerInfo* si = sk_CMS_SignerInfo_value(signerInfos, 0);
-
-            // Signature algorithm (4th param)
-            X509_ALGOR* signatureAlg = nullptr;
-            CMS_SignerInfo_get0_algs(si, nullptr, nullptr, nullptr, &signatureAlg);
-            if (signatureAlg) {
-                const ASN1_OBJECT* obj = nullptr;
-                X509_ALGOR_get0(&obj, nullptr, nullptr, signatureAlg);
-                char oidBuf[80];
-                OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
-                sodData.signatureAlgorithmOid = oidBuf;
-                sodData.signatureAlgorithm = getAlgorithmName(oidBuf, false);
-            }
-
-            // CMS digest algorithm (3rd param) — NOT the DG hash algorithm
-            X509_ALGOR* digestAlg = nullptr;
-            CMS_SignerInfo_get0_algs(si, nullptr, nullptr, &digestAlg, nullptr);
-            if (digestAlg) {
-                const ASN1_OBJECT* obj = nullptr;
-                X509_ALGOR_get0(&obj, nullptr, nullptr, digestAlg);
-                char oidBuf[80];
-                OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
-                sodData.cmsDigestAlgorithmOid = oidBuf;
-                sodData.cmsDigestAlgorithm = getAlgorithmName(oidBuf, true);
-            }
-        }
-
-        // --- Extract LDSSecurityObject fields ---
-        auto ldsOpt = parseLdsSecurityObject(cms);
-        if (ldsOpt) {
-            auto& lds = *ldsOpt;
+        ParsedSod sod(sodBytes);
+        return parseSod(sod);
+    } catch (const std::exception& e) {
+        spdlog::error("SOD parsing failed: {}", e.what());
+        models::SodData sodData;
+        sodData.parsingSuccess = false;
+        sodData.parsingErrors = e.what();
+        return sodData;
+    }
+}
 
-            // LDS hash algorithm (for DG hashes)
-            sodData.hashAlgorithmOid = lds.hashAlgorithmOid;
-            sodData.hashAlgorithm = getAlgorithmName(lds.hashAlgorithmOid, true);
+models::SodData SodParser::parseSod(const ParsedSod& sod) {
+    models::SodData sodData;
 
-            // LDS version
-            sodData.ldsSecurityObjectVersion = (lds.version == 1) ? "V1" : "V0";
+    // --- Extract CMS-level algorithms (SignerInfo) ---
+    if (sod.signerInfo()) {
+        if (!sod.signatureAlgorithmOid().empty()) {
+            sodData.signatureAlgorithmOid = sod.signatureAlgorithmOid();
+            sodData.signatureAlgorithm = getAlgorithmName(sodData.signatureAlgorithmOid, false);
+        }
+        // CMS digest algorithm — NOT the DG hash algorithm
+        if (!sod.cmsDigestAlgorithmOid().empty()) {
+            sodData.cmsDigestAlgorithmOid = sod.cmsDigestAlgorithmOid();
+            sodData.cmsDigestAlgorithm = getAlgorithmName(sodData.cmsDigestAlgorithmOid, true);
+        }
+    }
 
-            // Data group hashes
-            for (const auto& [dgNum, hashBytes] : lds.dgHashes) {
-                sodData.dataGroupHashes[std::to_string(dgNum)] = hashToHexString(hashBytes);
-            }
+    // --- Extract LDSSecurityObject fields ---
+    if (const auto* lds = sod.ldsSecurityObject()) {
+        // LDS hash algorithm (for DG hashes)
+        sodData.hashAlgorithmOid = lds->hashAlgorithmOid;
+        sodData.hashAlgorithm = getAlgorithmName(lds->hashAlgorithmOid, true);
 
-            // Log if CMS digest and LDS hash algorithms differ
-            if (!sodData.cmsDigestAlgorithmOid.empty() &&
-                sodData.cmsDigestAlgorithmOid != sodData.hashAlgorithmOid) {
-                spdlog::info("SOD uses different algorithms: LDS hash={} ({}), CMS digest={} ({})",
-                    sodData.hashAlgorithm, sodData.hashAlgorithmOid,
-                    sodData.cmsDigestAlgorithm, sodData.cmsDigestAlgorithmOid);
-            }
-        } else {
-            spdlog::warn("Failed to parse LDSSecurityObject from SOD");
-        }
+        // LDS version
+        sodData.ldsSecurityObjectVersion = (lds->version == 1) ? "V1" : "V0";
 
-        // --- Extract DSC certificate ---
-        STACK_OF(X509)* certs = CMS_get1_certs(cms);
-        if (certs && sk_X509_num(certs) > 0) {
-            sodData.dscCertificate = X509_dup(sk_X509_value(certs, 0));
+        // Data group hashes
+        for (const auto& [dgNum, hashBytes] : lds->dgHashes) {
+            sodData.dataGroupHashes[std::to_string(dgNum)] = hashToHexString(hashBytes);
         }
-        if (certs) sk_X509_pop_free(certs, X509_free);
 
-        // --- Extract signing time ---
-        sodData.signingTime = extractSigningTime(sodBytes);
-        if (!sodData.signingTime.empty()) {
-            spdlog::info("SOD signing time: {}", sodData.signingTime);
+        // Log if CMS digest and LDS hash algorithms differ
+        if (!sodData.cmsDigestAlgorithmOid.empty() &&
+            sodData.cmsDigestAlgorithmOid != sodData.hashAlgorithmOid) {
+            spdlog::info("SOD uses different algorithms: LDS hash={} ({}), CMS digest={} ({})",
+                sodData.hashAlgorithm, sodData.hashAlgorithmOid,
+                sodData.cmsDigestAlgorithm, sodData.cmsDigestAlgorithmOid);
         }
+    } else {
+        spdlog::warn("Failed to parse LDSSecurityObject from SOD");
+    }
 
-        CMS_ContentInfo_free(cms);
-
-        sodData.parsingSuccess = true;
-        spdlog::info("SOD parsing successful: {} data groups, LDS hash={}, CMS sig={}, LDS version={}",
-            sodData.dataGroupHashes.size(), sodData.hashAlgorithm,
-            sodData.signatureAlgorithm, sodData.ldsSecurityObjectVersion);
+    // --- Extract DSC certificate (SodData owns its own copy) ---
+    if (X509* dsc = sod.dscCertificate()) {
+        sodData.dscCertificate = X509_dup(dsc);
+    }
 
-    } catch (const std::exception& e) {
-        spdlog::error("SOD parsing failed: {}", e.what());
-        sodData.parsingSuccess = false;
-        sodData.parsingErrors = e.what();
+    // --- Extract signing time ---
+    sodData.signingTime = sod.signingTime();
+    if (!sodData.signingTime.empty()) {
+        spdlog::info("SOD signing time: {}", sodData.signingTime);
     }
 
+    sodData.parsingSuccess = true;
+    spdlog::info("SOD parsing successful: {} data groups, LDS hash={}, CMS sig={}, LDS version={}",
+        sodData.dataGroupHashes.size(), sodData.hashAlgorithm,
+        sodData.signatureAlgorithm, sodData.ldsSecurityObjectVersion);
+
     return sodData;
 }
 
 X509* SodParser::extractDscCertificate(const std::vector<uint8_t>& sodBytes) {
     spdlog::debug("Extracting DSC certificate from SOD");
 
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) {
-        spdlog::error("Failed to create BIO for DSC extraction");
-        return nullptr;
-    }
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
-
-    if (!cms) {
-        spdlog::error("Failed to parse CMS structure");
-        return nullptr;
-    }
-
-    // Get signer certificates
-    STACK_OF(X509)* certs = CMS_get1_certs(cms);
-    X509* dscCert = nullptr;
-
-    if (certs && sk_X509_num(certs) > 0) {
-        // Take first certificate (DSC)
-        dscCert = X509_dup(sk_X509_value(certs, 0));
+    try {
+        ParsedSod sod(sodBytes);
+        X509* dsc = sod.dscCertificate();
+        if (!dsc) {
+            spdlog::warn("No certificates found in SOD");
+            return nullptr;
+        }
         spdlog::debug("Extracted DSC certificate from SOD");
-    } else {
-        spdlog::warn("No certificates found in SOD");
+        return X509_dup(dsc);
+    } catch (const std::exception& e) {
+        spdlog::error("DSC extraction failed: {}", e.what());
+        return nullptr;
     }
-
-    if (certs) sk_X509_pop_free(certs, X509_free);
-    CMS_ContentInfo_free(cms);
-
-    return dscCert;
 }
 
 std::map<std::string, std::string> SodParser::extractDataGroupHashes(
@@ -258,41 +213,39 @@ bool SodParser::verifySodSignature(
         return false;
     }
 
-    spdlog::debug("Verifying SOD signature");
-
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) {
-        spdlog::error("Failed to create BIO for signature verification");
+    try {
+        ParsedSod sod(sodBytes);
+        return verifySodSignature(sod, dscCert);
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to parse CMS for signature verification: {}", e.what());
         return false;
     }
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
+}
 
-    if (!cms) {
-        spdlog::error("Failed to parse CMS for signature verification");
+bool SodParser::verifySodSignature(const ParsedSod& sod, X509* dscCert) {
+    if (!dscCert) {
+        spdlog::error("DSC certificate is null, cannot verify SOD signature");
         return false;
     }
 
+    spdlog::debug("Verifying SOD signature");
+
     // Create certificate store with DSC
     X509_STORE* store = X509_STORE_new();
     if (!store) {
         spdlog::error("Failed to create X509 store");
-        CMS_ContentInfo_free(cms);
         return false;
     }
     STACK_OF(X509)* certs = sk_X509_new_null();
     if (!certs) {
         spdlog::error("Failed to create certificate stack");
         X509_STORE_free(store);
-        CMS_ContentInfo_free(cms);
         return false;
     }
     sk_X509_push(certs, dscCert);
 
     // Verify signature
-    int verifyResult = CMS_verify(cms, certs, store, nullptr, nullptr,
+    int verifyResult = CMS_verify(sod.cms(), certs, store, nullptr, nullptr,
                                    CMS_NO_SIGNER_CERT_VERIFY | CMS_NO_ATTR_VERIFY);
 
     bool valid = (verifyResult == 1);
@@ -308,7 +261,6 @@ bool SodParser::verifySodSignature(
 
     sk_X509_free(certs);
     X509_STORE_free(store);
-    CMS_ContentInfo_free(cms);
 
     return valid;
 }
@@ -328,33 +280,11 @@ std::string SodParser::extractHashAlgorithm(const std::vector<uint8_t>& sodBytes
 }
 
 std::string SodParser::extractSignatureAlgorithmOid(const std::vector<uint8_t>& sodBytes) {
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) return "";
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
-
-    if (!cms) return "";
-
-    STACK_OF(CMS_SignerInfo)* signerInfos = CMS_get0_SignerInfos(cms);
-    if (signerInfos && sk_CMS_SignerInfo_num(signerInfos) > 0) {
-        CMS_SignerInfo* si = sk_CMS_SignerInfo_value(signerInfos, 0);
-        X509_ALGOR* signatureAlg = nullptr;
-        CMS_SignerInfo_get0_algs(si, nullptr, nullptr, nullptr, &signatureAlg);
-
-        if (signatureAlg) {
-            const ASN1_OBJECT* obj = nullptr;
-            X509_ALGOR_get0(&obj, nullptr, nullptr, signatureAlg);
-            char oidBuf[80];
-            OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
-            CMS_ContentInfo_free(cms);
-            return std::string(oidBuf);
-        }
+    try {
+        return ParsedSod(sodBytes).signatureAlgorithmOid();
+    } catch (const std::exception&) {
+        return "";
     }
-
-    CMS_ContentInfo_free(cms);
-    return "";
 }
 
 std::string SodParser::extractHashAlgorithmOid(const std::vector<uint8_t>& sodBytes) {
@@ -362,267 +292,29 @@ std::string SodParser::extractHashAlgorithmOid(const std::vector<uint8_t>& sodBy
     // NOT from CMS SignerInfo digestAlgorithm.
     // CMS digestAlgorithm is for SOD signature (e.g., SHA-512),
     // while LDSSecurityObject hashAlgorithm is for DG hashes (e.g., SHA-256).
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) return "";
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
-
-    if (!cms) return "";
-
-    auto ldsOpt = parseLdsSecurityObject(cms);
-    CMS_ContentInfo_free(cms);
-
-    if (ldsOpt) {
-        return ldsOpt->hashAlgorithmOid;
+    try {
+        ParsedSod sod(sodBytes);
+        const auto* lds = sod.ldsSecurityObject();
+        return lds ? lds->hashAlgorithmOid : "";
+    } catch (const std::exception&) {
+        return "";
     }
-    return "";
 }
 
 std::string SodParser::extractCmsDigestAlgorithmOid(const std::vector<uint8_t>& sodBytes) {
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) return "";
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
-
-    if (!cms) return "";
-
-    STACK_OF(CMS_SignerInfo)* signerInfos = CMS_get0_SignerInfos(cms);
-    if (signerInfos && sk_CMS_SignerInfo_num(signerInfos) > 0) {
-        CMS_SignerInfo* si = sk_CMS_SignerInfo_value(signerInfos, 0);
-        X509_ALGOR* digestAlg = nullptr;
-        CMS_SignerInfo_get0_algs(si, nullptr, nullptr, &digestAlg, nullptr);
-
-        if (digestAlg) {
-            const ASN1_OBJECT* obj = nullptr;
-            X509_ALGOR_get0(&obj, nullptr, nullptr, digestAlg);
-            char oidBuf[80];
-            OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
-            CMS_ContentInfo_free(cms);
-            return std::string(oidBuf);
-        }
+    try {
+        return ParsedSod(sodBytes).cmsDigestAlgorithmOid();
+    } catch (const std::exception&) {
+        return "";
     }
-
-    CMS_ContentInfo_free(cms);
-    return "";
 }
 
 std::string SodParser::extractSigningTime(const std::vector<uint8_t>& sodBytes) {
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) return "";
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
-
-    if (!cms) return "";
-
-    STACK_OF(CMS_SignerInfo)* signerInfos = CMS_get0_SignerInfos(cms);
-    if (!signerInfos || sk_CMS_SignerInfo_num(signerInfos) == 0) {
-        CMS_ContentInfo_free(cms);
-        return "";
-    }
-
-    CMS_SignerInfo* si = sk_CMS_SignerInfo_value(signerInfos, 0);
-    if (!si) {
-        CMS_ContentInfo_free(cms);
-        return "";
-    }
-
-    // Get signing time from signed attributes (NID_pkcs9_signingTime)
-    int idx = CMS_signed_get_attr_by_NID(si, NID_pkcs9_signingTime, -1);
-    if (idx < 0) {
-        spdlog::debug("No signingTime attribute found in SOD CMS signed attributes");
-        CMS_ContentInfo_free(cms);
-        return "";
-    }
-
-    X509_ATTRIBUTE* attr = CMS_signed_get_attr(si, idx);
-    if (!attr) {
-        CMS_ContentInfo_free(cms);
-        return "";
-    }
-
-    ASN1_TYPE* attrVal = X509_ATTRIBUTE_get0_type(attr, 0);
-    if (!attrVal) {
-        CMS_ContentInfo_free(cms);
+    try {
+        return ParsedSod(sodBytes).signingTime();
+    } catch (const std::exception&) {
         return "";
     }
-
-    ASN1_TIME* sigTime = nullptr;
-    if (attrVal->type == V_ASN1_UTCTIME) {
-        sigTime = attrVal->value.utctime;
-    } else if (attrVal->type == V_ASN1_GENERALIZEDTIME) {
-        sigTime = attrVal->value.generalizedtime;
-    }
-
-    std::string result;
-    if (sigTime) {
-        struct tm tmResult = {};
-        if (ASN1_TIME_to_tm(sigTime, &tmResult) == 1) {
-            char buf[32];
-            snprintf(buf, sizeof(buf), "%04d-%02d-%02dT%02d:%02d:%02dZ",
-                     tmResult.tm_year + 1900,
-                     tmResult.tm_mon + 1,
-                     tmResult.tm_mday,
-                     tmResult.tm_hour,
-                     tmResult.tm_min,
-                     tmResult.tm_sec);
-            result = std::string(buf);
-        }
-    }
-
-    CMS_ContentInfo_free(cms);
-    return result;
-}
-
-// ============================================================
-// LDSSecurityObject consolidated parser
-// ============================================================
-
-std::optional<SodParser::LdsSecurityObject> SodParser::parseLdsSecurityObject(CMS_ContentInfo* cms) {
-    if (!cms) return std::nullopt;
-
-    // Get encapsulated content
-    ASN1_OCTET_STRING** contentPtr = CMS_get0_content(cms);
-    if (!contentPtr || !*contentPtr) {
-        spdlog::error("No encapsulated content in CMS");
-        return std::nullopt;
-    }
-
-    const unsigned char* p = ASN1_STRING_get0_data(*contentPtr);
-    long dataLen = ASN1_STRING_length(*contentPtr);
-    const unsigned char* end = p + dataLen;
-
-    LdsSecurityObject result;
-
-    // LDSSecurityObject ::= SEQUENCE {
-    //   version INTEGER,
-    //   hashAlgorithm AlgorithmIdentifier,
-    //   dataGroupHashValues SEQUENCE OF DataGroupHash,
-    //   ldsVersionInfo LDSVersionInfo OPTIONAL  -- only if version == 1
-    // }
-
-    // Outer SEQUENCE
-    if (p >= end || *p != 0x30) {
-        spdlog::error("Expected SEQUENCE tag for LDSSecurityObject");
-        return std::nullopt;
-    }
-    p++;
-    size_t seqLen = 0;
-    if (!parseAsn1Length(p, end, seqLen)) return std::nullopt;
-
-    // --- version INTEGER ---
-    if (p < end && *p == 0x02) {
-        p++;  // skip tag
-        size_t vLen = 0;
-        if (!parseAsn1Length(p, end, vLen)) return std::nullopt;
-        if (p + vLen > end) return std::nullopt;
-
-        // Parse version value (typically 0 or 1)
-        result.version = 0;
-        for (size_t i = 0; i < vLen; i++) {
-            result.version = (result.version << 8) | *p++;
-        }
-        spdlog::debug("LDSSecurityObject version: {}", result.version);
-    }
-
-    // --- hashAlgorithm AlgorithmIdentifier SEQUENCE ---
-    if (p >= end || *p != 0x30) {
-        spdlog::error("Expected AlgorithmIdentifier SEQUENCE in LDSSecurityObject");
-        return std::nullopt;
-    }
-    p++;  // skip SEQUENCE tag
-    size_t algIdLen = 0;
-    if (!parseAsn1Length(p, end, algIdLen)) return std::nullopt;
-    if (p + algIdLen > end) return std::nullopt;
-
-    const unsigned char* algIdEnd = p + algIdLen;
-
-    // First element inside AlgorithmIdentifier is the OID
-    if (p < algIdEnd && *p == 0x06) {
-        const unsigned char* oidTlvStart = p;
-        p++;  // skip tag
-        size_t oidLen = 0;
-        if (!parseAsn1Length(p, algIdEnd, oidLen)) return std::nullopt;
-
-        // Build OID TLV for d2i_ASN1_OBJECT
-        long oidTlvLen = static_cast<long>((p - oidTlvStart) + oidLen);
-        if (oidTlvStart + oidTlvLen > end) return std::nullopt;
-
-        const unsigned char* bp = oidTlvStart;
-        ASN1_OBJECT* obj = d2i_ASN1_OBJECT(nullptr, &bp, oidTlvLen);
-        if (obj) {
-            char oidBuf[80];
-            OBJ_obj2txt(oidBuf, sizeof(oidBuf), obj, 1);
-            result.hashAlgorithmOid = oidBuf;
-            ASN1_OBJECT_free(obj);
-            spdlog::debug("LDSSecurityObject hashAlgorithm OID: {}", result.hashAlgorithmOid);
-        }
-    }
-
-    // Skip to end of AlgorithmIdentifier (may have optional parameters)
-    p = algIdEnd;
-
-    // --- dataGroupHashValues SEQUENCE OF DataGroupHash ---
-    if (p >= end || *p != 0x30) {
-        spdlog::error("Expected SEQUENCE OF DataGroupHash in LDSSecurityObject");
-        return std::nullopt;
-    }
-    p++;  // skip tag
-    size_t dgHashesLen = 0;
-    if (!parseAsn1Length(p, end, dgHashesLen)) return std::nullopt;
-
-    const unsigned char* dgHashesEnd = p + dgHashesLen;
-    if (dgHashesEnd > end) dgHashesEnd = end;
-
-    // Parse each DataGroupHash ::= SEQUENCE { dataGroupNumber INTEGER, dataGroupHashValue OCTET STRING }
-    while (p < dgHashesEnd) {
-        if (*p != 0x30) break;
-        p++;
-        size_t dgHashLen = 0;
-        if (!parseAsn1Length(p, dgHashesEnd, dgHashLen)) break;
-
-        const unsigned char* dgHashEnd = p + dgHashLen;
-        if (dgHashEnd > dgHashesEnd) break;
-
-        // dataGroupNumber INTEGER
-        int dgNumber = 0;
-        if (p < dgHashEnd && *p == 0x02) {
-            p++;
-            size_t intLen = 0;
-            if (!parseAsn1Length(p, dgHashEnd, intLen) || p + intLen > dgHashEnd) {
-                p = dgHashEnd;
-                continue;
-            }
-            for (size_t i = 0; i < intLen; i++) {
-                dgNumber = (dgNumber << 8) | *p++;
-            }
-        }
-
-        // dataGroupHashValue OCTET STRING
-        if (p < dgHashEnd && *p == 0x04) {
-            p++;
-            size_t hashLen = 0;
-            if (!parseAsn1Length(p, dgHashEnd, hashLen) || p + hashLen > dgHashEnd) {
-                p = dgHashEnd;
-                continue;
-            }
-            result.dgHashes[dgNumber] = std::vector<uint8_t>(p, p + hashLen);
-            p += hashLen;
-            spdlog::debug("Parsed DG{} hash: {} bytes", dgNumber, hashLen);
-        }
-
-        p = dgHashEnd;
-    }
-
-    spdlog::info("Parsed LDSSecurityObject: version={}, hashAlg={}, {} DG hashes",
-        result.version, result.hashAlgorithmOid, result.dgHashes.size());
-
-    return result;
 }
 
 // ============================================================
@@ -630,62 +322,25 @@ std::optional<SodParser::LdsSecurityObject> SodParser::parseLdsSecurityObject(CM
 // ============================================================
 
 std::vector<uint8_t> SodParser::unwrapIcaoSod(const std::vector<uint8_t>& sodBytes) {
-    // Check if SOD has ICAO wrapper tag (0x77)
-    if (sodBytes.size() > 4 && sodBytes[0] == 0x77) {
-        // Skip tag and length bytes
-        size_t offset = 1;
-
-        // Parse length (can be short or long form)
-        if (offset >= sodBytes.size()) return sodBytes;
-        if (sodBytes[offset] & 0x80) {
-            int numLengthBytes = sodBytes[offset] & 0x7F;
-            if (offset + numLengthBytes + 1 > sodBytes.size()) {
-                spdlog::error("SOD unwrap: length bytes exceed buffer");
-                return sodBytes;
-            }
-            offset += numLengthBytes + 1;
-        } else {
-            offset += 1;
-        }
-
-        if (offset >= sodBytes.size()) {
-            spdlog::error("SOD unwrap: offset exceeds buffer after length parse");
-            return sodBytes;
-        }
-
-        // Return unwrapped content
-        return std::vector<uint8_t>(sodBytes.begin() + offset, sodBytes.end());
+    size_t offset = ParsedSod::cmsOffset(sodBytes);
+    if (offset == 0) {
+        // No wrapper (or malformed wrapper), return as-is
+        return sodBytes;
     }
-
-    // No wrapper, return as-is
-    return sodBytes;
+    return std::vector<uint8_t>(sodBytes.begin() + offset, sodBytes.end());
 }
 
 std::map<int, std::vector<uint8_t>> SodParser::parseDataGroupHashesRaw(
     const std::vector<uint8_t>& sodBytes)
 {
-    std::vector<uint8_t> cmsBytes = unwrapIcaoSod(sodBytes);
-
-    BIO* bio = BIO_new_mem_buf(cmsBytes.data(), static_cast<int>(cmsBytes.size()));
-    if (!bio) {
-        spdlog::error("Failed to create BIO for DG hash parsing");
-        return {};
-    }
-    CMS_ContentInfo* cms = d2i_CMS_bio(bio, nullptr);
-    BIO_free(bio);
-
-    if (!cms) {
-        spdlog::error("Failed to parse CMS for DG hashes");
+    try {
+        ParsedSod sod(sodBytes);
+        const auto* lds = sod.ldsSecurityObject();
+        return lds ? lds->dgHashes : std::map<int, std::vector<uint8_t>>{};
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to parse CMS for DG hashes: {}", e.what());
         return {};
     }
-
-    auto ldsOpt = parseLdsSecurityObject(cms);
-    CMS_ContentInfo_free(cms);
-
-    if (ldsOpt) {
-        return ldsOpt->dgHashes;
-    }
-    return {};
 }
 
 std::string SodParser::hashToHexString(const std::vector<uint8_t>& hashBytes) {
@@ -732,27 +387,29 @@ Json::Value SodParser::parseSodForApi(const std::vector<uint8_t>& sodBytes) {
     result["sodSize"] = static_cast<int>(sodBytes.size());
 
     try {
+        // Decode once; every field below reads from the same CMS
+        ParsedSod sod(sodBytes);
+        const auto* lds = sod.ldsSecurityObject();
+
         // Extract hash algorithm (from LDSSecurityObject)
-        std::string hashAlgorithm = extractHashAlgorithm(sodBytes);
-        std::string hashAlgorithmOid = extractHashAlgorithmOid(sodBytes);
-        result["hashAlgorithm"] = hashAlgorithm;
+        std::string hashAlgorithmOid = lds ? lds->hashAlgorithmOid : "";
+        result["hashAlgorithm"] = getAlgorithmName(hashAlgorithmOid, true);
         result["hashAlgorithmOid"] = hashAlgorithmOid;
 
         // Extract signature algorithm (from CMS SignerInfo)
-        std::string signatureAlgorithm = extractSignatureAlgorithm(sodBytes);
-        std::string signatureAlgorithmOid = extractSignatureAlgorithmOid(sodBytes);
-        result["signatureAlgorithm"] = signatureAlgorithm;
+        const std::string& signatureAlgorithmOid = sod.signatureAlgorithmOid();
+        result["signatureAlgorithm"] = getAlgorithmName(signatureAlgorithmOid, false);
         result["signatureAlgorithmOid"] = signatureAlgorithmOid;
 
         // Extract CMS digest algorithm (may differ from LDS hash algorithm)
-        std::string cmsDigestOid = extractCmsDigestAlgorithmOid(sodBytes);
+        const std::string& cmsDigestOid = sod.cmsDigestAlgorithmOid();
         if (!cmsDigestOid.empty()) {
             result["cmsDigestAlgorithm"] = getAlgorithmName(cmsDigestOid, true);
             result["cmsDigestAlgorithmOid"] = cmsDigestOid;
         }
 
-        // Extract DSC certificate info
-        X509* dscCert = extractDscCertificate(sodBytes);
+        // Extract DSC certificate info (owned by sod)
+        X509* dscCert = sod.dscCertificate();
         if (dscCert) {
             Json::Value dscInfo;
 
@@ -835,14 +492,14 @@ Json::Value SodParser::parseSodForApi(const std::vector<uint8_t>& sodBytes) {
             }
 
             result["dscCertificate"] = dscInfo;
-            X509_free(dscCert);
         } else {
             result["dscCertificate"] = Json::nullValue;
             result["warning"] = "Failed to extract DSC certificate from SOD";
         }
 
         // Extract contained data groups
-        std::map<int, std::vector<uint8_t>> dgHashes = parseDataGroupHashesRaw(sodBytes);
+        static const std::map<int, std::vector<uint8_t>> kNoHashes;
+        const auto& dgHashes = lds ? lds->dgHashes : kNoHashes;
         Json::Value containedDgs(Json::arrayValue);
         for (const auto& [dgNum, hash] : dgHashes) {
             Json::Value dgInfo;
@@ -856,8 +513,12 @@ Json::Value SodParser::parseSodForApi(const std::vector<uint8_t>& sodBytes) {
         result["dataGroupCount"] = static_cast<int>(dgHashes.size());
 
         // Check if ICAO wrapper (Tag 0x77) was present
-        bool hasIcaoWrapper = (sodBytes.size() > 0 && sodBytes[0] == 0x77);
-        result["hasIcaoWrapper"] = hasIcaoWrapper;
+        result["hasIcaoWrapper"] = sod.hasIcaoWrapper();
+
+        // Signing time from CMS signed attributes (if present)
+        if (!sod.signingTime().empty()) {
+            result["signingTime"] = sod.signingTime();
+        }
 
         // Check for DG14 (Active Authentication) and DG15 (Extended Access Control)
         if (!dgHashes.empty()) {
@@ -18,6 +18,7 @@
 #include <openssl/x509.h>
 #include <openssl/cms.h>
 #include "models/sod_data.h"
+#include "parsed_sod.h"
 
 namespace icao {
 
@@ -30,6 +31,10 @@ namespace icao {
  * - Extract data group hashes
  * - Verify SOD signature
  * - Extract algorithm information
+ *
+ * The byte-based methods decode the SOD on every call. Callers that need
+ * several fields should decode once into a ParsedSod and use the ParsedSod
+ * overloads (parseSod, verifySodSignature).
  */
 class SodParser {
 public:
@@ -53,6 +58,13 @@ public:
      */
     models::SodData parseSod(const std::vector<uint8_t>& sodBytes);
 
+    /**
+     * @brief Build SodData from an already decoded SOD
+     * @param sod Decoded SOD (fields are memoized on it)
+     * @return SodData with parsingSuccess = true (owns its own DSC copy)
+     */
+    models::SodData parseSod(const ParsedSod& sod);
+
     /**
      * @brief Extract DSC certificate from SOD
      * @param sodBytes SOD data bytes
@@ -75,6 +87,14 @@ public:
      */
     bool verifySodSignature(const std::vector<uint8_t>& sodBytes, X509* dscCert);
 
+    /**
+     * @brief Verify SOD signature on an already decoded SOD
+     * @param sod Decoded SOD
+     * @param dscCert DSC certificate extracted from SOD
+     * @return true if signature is valid
+     */
+    bool verifySodSignature(const ParsedSod& sod, X509* dscCert);
+
     /// @name Algorithm Extraction
 
     /**
@@ -163,12 +183,17 @@ public:
 
     /**
      * @brief Parse SOD for API response (includes detailed metadata)
+     *
+     * Decodes the SOD once; success is false if the bytes are not a CMS structure.
+     *
      * @param sodBytes SOD data bytes
      * @return JSON object with all SOD metadata for API response
      */
     Json::Value parseSodForApi(const std::vector<uint8_t>& sodBytes);
 
 private:
+    friend class ParsedSod;  // LDSSecurityObject parsing uses parseAsn1Length()
+
     /**
      * @brief Parse CMS ContentInfo from bytes
      * @param cmsBytes CMS data
@@ -183,26 +208,6 @@ private:
      */
     std::vector<uint8_t> extractEncapsulatedContent(CMS_ContentInfo* cms);
 
-    /**
-     * @brief Parsed LDSSecurityObject fields
-     */
-    struct LdsSecurityObject {
-        int version = 0;                                 // 0 = V0, 1 = V1
-        std::string hashAlgorithmOid;                    // Hash algorithm OID for DG hashes
-        std::map<int, std::vector<uint8_t>> dgHashes;    // DG number → hash bytes
-    };
-
-    /**
-     * @brief Parse LDSSecurityObject from CMS encapsulated content
-     *
-     * Consolidated parser for LDSSecurityObject ASN.1 structure.
-     * Used by extractHashAlgorithmOid(), parseDataGroupHashesRaw(), and parseSod().
-     *
-     * @param cms CMS_ContentInfo (must not be null)
-     * @return Parsed LdsSecurityObject or nullopt on parse failure
-     */
-    std::optional<LdsSecurityObject> parseLdsSecurityObject(CMS_ContentInfo* cms);
-
     // Algorithm OID mappings
     static const std::map<std::string, std::string>& getHashAlgorithmNames();
     static const std::map<std::string, std::string>& getSignatureAlgorithmNames();
@@ -12,6 +12,7 @@
  *   7. EmptyAndInvalidInputs — defensive behaviour on garbage/empty data
  *   8. VerifySignature       — null-cert guard
  *   9. Idempotency           — repeated calls on same input
+ *  10. ParsedSod             — single-decode handle and memoized views
  *
  * NOTE: Tests that require a fully-formed CMS / SOD binary are not included
  * here because no real passport SOD fixture is available in the repository.
@@ -980,3 +981,85 @@ TEST_F(IdempotencyTest, UnwrapIcaoSod_NoWrapper_SameInputAlwaysSameOutput) {
             << "Changed at iteration " << i;
     }
 }
+
+// ============================================================================
+// 10. ParsedSod — single decode, memoized views
+// ============================================================================
+
+class ParsedSodTest : public ::testing::Test {
+protected:
+    SodParser parser_;
+    std::vector<uint8_t> cmsBytes_ = buildMinimalCms();
+
+    void SetUp() override {
+        ASSERT_FALSE(cmsBytes_.empty()) << "Failed to build CMS fixture";
+    }
+};
+
+TEST_F(ParsedSodTest, Garbage_Throws) {
+    EXPECT_THROW(ParsedSod(std::vector<uint8_t>(64, 0x55)), std::runtime_error);
+    EXPECT_THROW(ParsedSod(std::vector<uint8_t>{}), std::runtime_error);
+}
+
+TEST_F(ParsedSodTest, MinimalCms_SignerFieldsAndDsc) {
+    ParsedSod sod(cmsBytes_);
+    EXPECT_FALSE(sod.hasIcaoWrapper());
+    EXPECT_EQ(sod.sodSize(), cmsBytes_.size());
+    EXPECT_NE(sod.signerInfo(), nullptr);
+    EXPECT_EQ(sod.cmsDigestAlgorithmOid(), "2.16.840.1.101.3.4.2.1");  // SHA-256
+    EXPECT_FALSE(sod.signatureAlgorithmOid().empty());
+    EXPECT_EQ(sod.signingTime(), "");            // CMS_NOATTR: no signed attributes
+    EXPECT_EQ(sod.ldsSecurityObject(), nullptr); // Content is not an LDSSecurityObject
+}
+
+TEST_F(ParsedSodTest, DscCertificate_MemoizedAndOwned) {
+    ParsedSod sod(cmsBytes_);
+    X509* first = sod.dscCertificate();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(sod.dscCertificate(), first);
+}
+
+TEST_F(ParsedSodTest, IcaoWrapper_DecodesSameCms) {
+    std::vector<uint8_t> wrapped = {0x77, 0x82,
+        static_cast<uint8_t>(cmsBytes_.size() >> 8), static_cast<uint8_t>(cmsBytes_.size() & 0xFF)};
+    wrapped.insert(wrapped.end(), cmsBytes_.begin(), cmsBytes_.end());
+
+    ParsedSod sod(wrapped);
+    EXPECT_TRUE(sod.hasIcaoWrapper());
+    EXPECT_EQ(ParsedSod::cmsOffset(wrapped), 4u);
+    EXPECT_EQ(sod.cmsDigestAlgorithmOid(), ParsedSod(cmsBytes_).cmsDigestAlgorithmOid());
+}
+
+TEST_F(ParsedSodTest, MoveConstructor_TransfersOwnership) {
+    ParsedSod sod(cmsBytes_);
+    X509* dsc = sod.dscCertificate();
+    ParsedSod moved(std::move(sod));
+    EXPECT_NE(moved.cms(), nullptr);
+    EXPECT_EQ(moved.dscCertificate(), dsc);
+}
+
+TEST_F(ParsedSodTest, ParseSod_FromParsedSod_MatchesByteOverload) {
+    ParsedSod parsed(cmsBytes_);
+    SodData fromHandle = parser_.parseSod(parsed);
+    SodData fromBytes = parser_.parseSod(cmsBytes_);
+
+    EXPECT_TRUE(fromHandle.parsingSuccess);
+    EXPECT_EQ(fromHandle.cmsDigestAlgorithmOid, fromBytes.cmsDigestAlgorithmOid);
+    EXPECT_EQ(fromHandle.signatureAlgorithmOid, fromBytes.signatureAlgorithmOid);
+    ASSERT_NE(fromHandle.dscCertificate, nullptr);
+    EXPECT_NE(fromHandle.dscCertificate, parsed.dscCertificate());  // SodData owns a copy
+}
+
+TEST_F(ParsedSodTest, VerifySodSignature_FromParsedSod) {
+    ParsedSod parsed(cmsBytes_);
+    EXPECT_TRUE(parser_.verifySodSignature(parsed, parsed.dscCertificate()));
+    EXPECT_FALSE(parser_.verifySodSignature(parsed, nullptr));
+}
+
+TEST_F(ParsedSodTest, ParseSodForApi_DecodesFixture) {
+    Json::Value result = parser_.parseSodForApi(cmsBytes_);
+    EXPECT_TRUE(result["success"].asBool());
+    EXPECT_EQ(result["cmsDigestAlgorithm"].asString(), "SHA-256");
+    EXPECT_TRUE(result["dscCertificate"].isObject());
+    EXPECT_FALSE(result["hasIcaoWrapper"].asBool());
+}
@@ -7,6 +7,8 @@
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <thread>
+#include <algorithm>
+#include <functional>
 
 namespace common {
 
@@ -36,7 +38,9 @@ LdapConnectionPool::LdapConnectionPool(
     size_t maxSize,
     int acquireTimeoutSec,
     int networkTimeoutSec,
-    int healthCheckTimeoutSec)
+    int healthCheckTimeoutSec,
+    int idleValidationSec,
+    size_t shardCount)
     : ldapUri_(ldapUri),
       bindDn_(bindDn),
       bindPassword_(bindPassword),
@@ -45,11 +49,21 @@ LdapConnectionPool::LdapConnectionPool(
       acquireTimeout_(acquireTimeoutSec),
       networkTimeout_(networkTimeoutSec),
       healthCheckTimeout_(healthCheckTimeoutSec),
+      idleValidationInterval_(idleValidationSec > 0 ? idleValidationSec : 0),
+      shardCount_(1),
+      availableCount_(0),
       totalConnections_(0),
+      waiters_(0),
       shutdown_(false)
 {
-    spdlog::info("LdapConnectionPool created: uri={}, minSize={}, maxSize={}, timeout={}s, networkTimeout={}s, healthCheckTimeout={}s",
-                 ldapUri_, minSize_, maxSize_, acquireTimeoutSec, networkTimeoutSec, healthCheckTimeoutSec);
+    // One shard per core, but never more shards than connections
+    size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+    shardCount_ = std::max<size_t>(1, std::min(shardCount > 0 ? shardCount : cores, maxSize_));
+    shards_ = std::make_unique<FreeListShard[]>(shardCount_);
+
+    spdlog::info("LdapConnectionPool created: uri={}, minSize={}, maxSize={}, timeout={}s, networkTimeout={}s, healthCheckTimeout={}s, idleValidation={}s",
+                 ldapUri_, minSize_, maxSize_, acquireTimeoutSec, networkTimeoutSec, healthCheckTimeoutSec,
+                 idleValidationInterval_.count());
 }
 
 LdapConnectionPool::~LdapConnectionPool() {
@@ -59,13 +73,17 @@ LdapConnectionPool::~LdapConnectionPool() {
 bool LdapConnectionPool::initialize() {
     spdlog::info("Initializing LDAP connection pool (min={}, max={})", minSize_, maxSize_);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-
     // Create minimum connections
     for (size_t i = 0; i < minSize_; ++i) {
         LDAP* ld = createConnection();
         if (ld) {
-            availableConnections_.push(ld);
+            // Spread initial connections across shards
+            FreeListShard& shard = shards_[i % shardCount_];
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.connections.push_back({ld, std::chrono::steady_clock::now()});
+            }
+            availableCount_++;
             totalConnections_++;
         } else {
             spdlog::error("Failed to create initial LDAP connection {}/{}", i + 1, minSize_);
@@ -73,64 +91,61 @@ bool LdapConnectionPool::initialize() {
         }
     }
 
+    if (idleValidationInterval_.count() > 0 && !reaperThread_.joinable()) {
+        reaperThread_ = std::thread(&LdapConnectionPool::reaperLoop, this);
+    }
+
     spdlog::info("LDAP connection pool initialized with {} connections", totalConnections_.load());
     return true;
 }
 
 LdapConnection LdapConnectionPool::acquire() {
-    std::unique_lock<std::mutex> lock(mutex_);
-
-    auto deadline = std::chrono::steady_clock::now() + acquireTimeout_;
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + acquireTimeout_;
+    const bool checkOnAcquire = idleValidationInterval_.count() == 0;
 
     while (true) {
         if (shutdown_) {
             throw std::runtime_error("LDAP pool is shutting down");
         }
 
-        // Try to get connection from pool
-        if (!availableConnections_.empty()) {
-            LDAP* ld = availableConnections_.front();
-            availableConnections_.pop();
-
-            // Check if connection is still healthy
-            if (isConnectionHealthy(ld)) {
+        // Fast path: take an idle connection from the free list
+        LDAP* ld = nullptr;
+        while (popIdle(ld)) {
+            if (!checkOnAcquire || isConnectionHealthy(ld)) {
+                recordAcquire(start);
                 spdlog::debug("Acquired LDAP connection from pool (available={}, total={})",
-                             availableConnections_.size(), totalConnections_.load());
+                             availableCount_.load(), totalConnections_.load());
                 return LdapConnection(ld, this);
-            } else {
-                spdlog::warn("Unhealthy LDAP connection detected, creating new one");
-                ldap_unbind_ext_s(ld, nullptr, nullptr);
-                totalConnections_--;
             }
+            spdlog::warn("Unhealthy LDAP connection detected, creating new one");
+            discardConnection(ld);
         }
 
         // Try to create new connection if under max limit
-        if (totalConnections_ < maxSize_) {
-            lock.unlock();
-            LDAP* ld = createConnection();
-            lock.lock();
-
+        if (reserveSlot()) {
+            ld = createConnection();
             if (ld) {
-                // Re-check after re-acquiring lock — another thread may have filled the pool
-                if (totalConnections_ < maxSize_) {
-                    totalConnections_++;
-                    spdlog::info("Created new LDAP connection (total={})", totalConnections_.load());
-                    return LdapConnection(ld, this);
-                } else {
-                    // Pool was filled by another thread while we were creating — discard
-                    spdlog::debug("LDAP pool filled by another thread, discarding new connection");
-                    ldap_unbind_ext_s(ld, nullptr, nullptr);
-                }
-            } else {
-                spdlog::error("Failed to create new LDAP connection");
+                recordAcquire(start);
+                spdlog::info("Created new LDAP connection (total={})", totalConnections_.load());
+                return LdapConnection(ld, this);
             }
+            totalConnections_--;
+            notifyWaiter();
+            spdlog::error("Failed to create new LDAP connection");
         }
 
         // Wait for connection to become available
         spdlog::debug("Waiting for LDAP connection (available={}, total={}, max={})",
-                     availableConnections_.size(), totalConnections_.load(), maxSize_);
-
-        if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+                     availableCount_.load(), totalConnections_.load(), maxSize_);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_++;
+        bool ready = cv_.wait_until(lock, deadline, [this] {
+            return shutdown_ || availableCount_ > 0 || totalConnections_ < maxSize_;
+        });
+        waiters_--;
+        if (!ready) {
             spdlog::error("Timeout waiting for LDAP connection");
             return LdapConnection(nullptr, this);
         }
@@ -138,29 +153,47 @@ LdapConnection LdapConnectionPool::acquire() {
 }
 
 LdapConnectionPool::Stats LdapConnectionPool::getStats() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return Stats{
-        availableConnections_.size(),
-        totalConnections_.load(),
-        maxSize_
-    };
+    Stats stats;
+    stats.availableConnections = availableCount_.load();
+    stats.totalConnections = totalConnections_.load();
+    stats.maxConnections = maxSize_;
+    stats.acquireCount = acquireCount_.load();
+    stats.acquireWaitTotalUs = acquireWaitTotalUs_.load();
+    stats.acquireWaitMaxUs = acquireWaitMaxUs_.load();
+    stats.healthCheckCount = healthCheckCount_.load();
+    stats.discardedConnections = discardedConnections_.load();
+    return stats;
 }
 
 void LdapConnectionPool::shutdown() {
-    spdlog::info("Shutting down LDAP connection pool");
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_) {
+            return;
+        }
+        spdlog::info("Shutting down LDAP connection pool");
+        shutdown_ = true;
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    shutdown_ = true;
+        // Wake acquirers and the reaper
+        cv_.notify_all();
+        reaperCv_.notify_all();
+    }
+
+    if (reaperThread_.joinable() && reaperThread_.get_id() != std::this_thread::get_id()) {
+        reaperThread_.join();
+    }
 
     // Close all available connections
-    while (!availableConnections_.empty()) {
-        LDAP* ld = availableConnections_.front();
-        availableConnections_.pop();
-        ldap_unbind_ext_s(ld, nullptr, nullptr);
-        totalConnections_--;
+    for (size_t i = 0; i < shardCount_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        for (auto& idle : shards_[i].connections) {
+            closeConnection(idle.ld);
+            totalConnections_--;
+        }
+        shards_[i].connections.clear();
     }
+    availableCount_ = 0;
 
-    cv_.notify_all();
     spdlog::info("LDAP connection pool shutdown complete");
 }
 
@@ -217,6 +250,10 @@ LDAP* LdapConnectionPool::createConnection() {
     return ld;
 }
 
+void LdapConnectionPool::closeConnection(LDAP* ld) {
+    ldap_unbind_ext_s(ld, nullptr, nullptr);
+}
+
 bool LdapConnectionPool::isConnectionHealthy(LDAP* ld) {
     if (!ld) return false;
 
@@ -224,6 +261,7 @@ bool LdapConnectionPool::isConnectionHealthy(LDAP* ld) {
     // Search for root DSE (empty base DN, scope base, filter objectClass=*)
     LDAPMessage* result = nullptr;
     struct timeval timeout = {healthCheckTimeout_, 0};
+    healthCheckCount_++;
 
     int rc = ldap_search_ext_s(ld, "", LDAP_SCOPE_BASE, "(objectClass=*)",
                                 nullptr, 0, nullptr, nullptr, &timeout, 1, &result);
@@ -240,22 +278,163 @@ bool LdapConnectionPool::isConnectionHealthy(LDAP* ld) {
     }
 }
 
+bool LdapConnectionPool::isConnectionBroken(LDAP* ld) {
+    int rc = LDAP_SUCCESS;
+    if (ldap_get_option(ld, LDAP_OPT_RESULT_CODE, &rc) != LDAP_OPT_SUCCESS) {
+        return true;
+    }
+    return rc == LDAP_SERVER_DOWN || rc == LDAP_CONNECT_ERROR ||
+           rc == LDAP_UNAVAILABLE || rc == LDAP_TIMEOUT;
+}
+
 void LdapConnectionPool::releaseConnection(LDAP* ld) {
     if (!ld) return;
 
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (shutdown_) {
-        ldap_unbind_ext_s(ld, nullptr, nullptr);
+        closeConnection(ld);
         totalConnections_--;
         return;
     }
 
+    // Fast path: the caller's real operations already told us whether the
+    // socket is alive. Legacy mode validates on the next acquire instead.
+    if (idleValidationInterval_.count() > 0 && isConnectionBroken(ld)) {
+        spdlog::warn("Released LDAP connection reported server down, closing");
+        discardConnection(ld);
+        return;
+    }
+
     // Return connection to pool
-    availableConnections_.push(ld);
+    pushIdle(ld);
     spdlog::debug("Released LDAP connection to pool (available={}, total={})",
-                 availableConnections_.size(), totalConnections_.load());
-    cv_.notify_one();
+                 availableCount_.load(), totalConnections_.load());
+}
+
+// --- Free list helpers ---
+
+size_t LdapConnectionPool::homeShard() const {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) % shardCount_;
+}
+
+bool LdapConnectionPool::popIdle(LDAP*& ld) {
+    if (availableCount_ == 0) {
+        return false;
+    }
+
+    // Home shard first, then steal from the others
+    size_t home = homeShard();
+    for (size_t i = 0; i < shardCount_; ++i) {
+        FreeListShard& shard = shards_[(home + i) % shardCount_];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!shard.connections.empty()) {
+            ld = shard.connections.back().ld;
+            shard.connections.pop_back();
+            availableCount_--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void LdapConnectionPool::pushIdle(LDAP* ld) {
+    FreeListShard& shard = shards_[homeShard()];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.connections.push_back({ld, std::chrono::steady_clock::now()});
+    }
+    availableCount_++;
+    notifyWaiter();
+}
+
+bool LdapConnectionPool::reserveSlot() {
+    size_t current = totalConnections_.load();
+    while (current < maxSize_) {
+        if (totalConnections_.compare_exchange_weak(current, current + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LdapConnectionPool::discardConnection(LDAP* ld) {
+    closeConnection(ld);
+    totalConnections_--;
+    discardedConnections_++;
+    notifyWaiter();
+}
+
+void LdapConnectionPool::notifyWaiter() {
+    // Only touch the mutex when someone is actually blocked in acquire()
+    if (waiters_ > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_one();
+    }
+}
+
+void LdapConnectionPool::recordAcquire(std::chrono::steady_clock::time_point start) {
+    auto waitUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    acquireCount_++;
+    acquireWaitTotalUs_ += waitUs;
+
+    uint64_t prevMax = acquireWaitMaxUs_.load();
+    while (waitUs > prevMax && !acquireWaitMaxUs_.compare_exchange_weak(prevMax, waitUs)) {
+    }
+}
+
+void LdapConnectionPool::reaperLoop() {
+    spdlog::info("LDAP pool reaper started (interval={}s)", idleValidationInterval_.count());
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            reaperCv_.wait_for(lock, idleValidationInterval_, [this] { return shutdown_.load(); });
+            if (shutdown_) break;
+        }
+
+        // Collect connections that have been idle for a full interval
+        auto cutoff = std::chrono::steady_clock::now() - idleValidationInterval_;
+        std::vector<LDAP*> stale;
+        for (size_t i = 0; i < shardCount_; ++i) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            auto& conns = shards_[i].connections;
+            auto it = std::partition(conns.begin(), conns.end(),
+                [&cutoff](const IdleConnection& c) { return c.idleSince > cutoff; });
+            for (auto s = it; s != conns.end(); ++s) {
+                stale.push_back(s->ld);
+            }
+            availableCount_ -= static_cast<size_t>(std::distance(it, conns.end()));
+            conns.erase(it, conns.end());
+        }
+
+        // Validate outside the shard locks so acquirers are never blocked on I/O
+        size_t dropped = 0;
+        for (LDAP* ld : stale) {
+            if (isConnectionHealthy(ld)) {
+                pushIdle(ld);
+            } else {
+                discardConnection(ld);
+                dropped++;
+            }
+        }
+
+        // Top up to minSize after dropping dead connections
+        while (!shutdown_ && totalConnections_ < minSize_ && reserveSlot()) {
+            LDAP* ld = createConnection();
+            if (!ld) {
+                totalConnections_--;
+                break;
+            }
+            pushIdle(ld);
+        }
+
+        if (!stale.empty()) {
+            spdlog::debug("LDAP pool reaper: validated {} idle connections, dropped {}",
+                          stale.size(), dropped);
+        }
+    }
+
+    spdlog::info("LDAP pool reaper stopped");
 }
 
 } // namespace common
@@ -9,6 +9,8 @@
  * - Automatic connection health checking
  * - Connection recycling
  * - Thread-safe acquire/release
+ * - Optional fast path (v2.42.0): sharded free list, no root-DSE search per
+ *   acquire, idle connections validated by a background reaper thread
  *
  * @author SMARTCORE Inc.
  * @date 2026-02-04
@@ -18,12 +20,14 @@
 
 #include <ldap.h>
 #include <string>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <memory>
 #include <chrono>
 #include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
 
 namespace common {
 
@@ -94,6 +98,18 @@ public:
  */
 class LdapConnectionPool {
 private:
+    /// Idle connection with the time it was returned to the pool
+    struct IdleConnection {
+        LDAP* ld;
+        std::chrono::steady_clock::time_point idleSince;
+    };
+
+    /// One slice of the free list; threads hash to a home shard and steal from others
+    struct alignas(64) FreeListShard {
+        std::mutex mutex;
+        std::vector<IdleConnection> connections;
+    };
+
     std::string ldapUri_;
     std::string bindDn_;
     std::string bindPassword_;
@@ -102,13 +118,26 @@ private:
     std::chrono::seconds acquireTimeout_;
     int networkTimeout_;
     int healthCheckTimeout_;
+    std::chrono::seconds idleValidationInterval_;  ///< 0 = legacy mode (root DSE search on every acquire)
 
-    std::queue<LDAP*> availableConnections_;
+    std::unique_ptr<FreeListShard[]> shards_;
+    size_t shardCount_;
+    std::atomic<size_t> availableCount_;
     std::atomic<size_t> totalConnections_;
-    mutable std::mutex mutex_;  // mutable to allow locking in const methods
+    std::atomic<size_t> waiters_;
+    mutable std::mutex mutex_;  // Guards cv_ waits only (slow path)
     std::condition_variable cv_;
 
-    bool shutdown_;
+    std::atomic<bool> shutdown_;
+    std::thread reaperThread_;
+    std::condition_variable reaperCv_;
+
+    // Counters exported via getStats()
+    std::atomic<uint64_t> acquireCount_{0};
+    std::atomic<uint64_t> acquireWaitTotalUs_{0};
+    std::atomic<uint64_t> acquireWaitMaxUs_{0};
+    std::atomic<uint64_t> healthCheckCount_{0};
+    std::atomic<uint64_t> discardedConnections_{0};
 
     friend class LdapConnection;
 
@@ -123,6 +152,11 @@ public:
      * @param acquireTimeoutSec Timeout for acquiring connection (seconds)
      * @param networkTimeoutSec LDAP network operation timeout (seconds)
      * @param healthCheckTimeoutSec Health check query timeout (seconds)
+     * @param idleValidationSec Background validation interval for idle connections (seconds).
+     *        0 keeps the legacy behaviour (root DSE search on every acquire);
+     *        > 0 enables the fast path where acquire/release never touch the network
+     *        and broken connections are detected from the last operation's result code.
+     * @param shardCount Free list shards (0 = one per core, capped at maxSize)
      */
     explicit LdapConnectionPool(
         const std::string& ldapUri,
@@ -132,13 +166,18 @@ public:
         size_t maxSize = 10,
         int acquireTimeoutSec = 5,
         int networkTimeoutSec = 5,
-        int healthCheckTimeoutSec = 2
+        int healthCheckTimeoutSec = 2,
+        int idleValidationSec = 0,
+        size_t shardCount = 0
     );
 
     /**
      * @brief Destructor - closes all connections
+     *
+     * Subclasses that override closeConnection() must call shutdown() in
+     * their own destructor (virtual calls do not reach them from here).
      */
-    ~LdapConnectionPool();
+    virtual ~LdapConnectionPool();
 
     // Delete copy constructor and assignment
     LdapConnectionPool(const LdapConnectionPool&) = delete;
@@ -161,9 +200,14 @@ public:
      * @brief Get pool statistics
      */
     struct Stats {
-        size_t availableConnections;
-        size_t totalConnections;
-        size_t maxConnections;
+        size_t availableConnections = 0;
+        size_t totalConnections = 0;
+        size_t maxConnections = 0;
+        uint64_t acquireCount = 0;          ///< Successful acquire() calls
+        uint64_t acquireWaitTotalUs = 0;    ///< Sum of acquire() wait times (microseconds)
+        uint64_t acquireWaitMaxUs = 0;      ///< Longest single acquire() wait (microseconds)
+        uint64_t healthCheckCount = 0;      ///< Root DSE health searches issued
+        uint64_t discardedConnections = 0;  ///< Connections closed as broken or unhealthy
     };
 
     Stats getStats() const;
@@ -173,21 +217,63 @@ public:
      */
     void shutdown();
 
-private:
+    /**
+     * @brief Number of free list shards
+     */
+    size_t shardCount() const { return shardCount_; }
+
+protected:
+    /// @name Connection lifecycle (virtual so tests can run without a server)
+
     /**
      * @brief Create new LDAP connection
      */
-    LDAP* createConnection();
+    virtual LDAP* createConnection();
+
+    /**
+     * @brief Close a connection (ldap_unbind_ext_s)
+     */
+    virtual void closeConnection(LDAP* ld);
+
+    /**
+     * @brief Check if connection is healthy (root DSE search)
+     */
+    virtual bool isConnectionHealthy(LDAP* ld);
+
+    /**
+     * @brief Check the result code of the last operation on the handle
+     *
+     * LDAP_SERVER_DOWN / LDAP_CONNECT_ERROR / LDAP_UNAVAILABLE mean the
+     * socket is unusable; LDAP_TIMEOUT leaves a request possibly still in
+     * flight on it, so it is treated the same. Anything else (including
+     * NO_SUCH_OBJECT etc.) leaves the connection reusable.
+     */
+    virtual bool isConnectionBroken(LDAP* ld);
 
     /**
-     * @brief Check if connection is healthy
+     * @brief Free list shard of the calling thread (hash of the thread id)
      */
-    bool isConnectionHealthy(LDAP* ld);
+    virtual size_t homeShard() const;
 
+private:
     /**
      * @brief Return connection to pool (called by LdapConnection)
      */
     void releaseConnection(LDAP* ld);
+
+    /// @name Free list helpers (v2.42.0)
+    bool popIdle(LDAP*& ld);
+    void pushIdle(LDAP* ld);
+    bool reserveSlot();
+    void discardConnection(LDAP* ld);
+    void notifyWaiter();
+    void recordAcquire(std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Background loop: validate connections idle longer than the
+     *        validation interval and top the pool back up to minSize
+     */
+    void reaperLoop();
 };
 
 } // namespace common
@@ -0,0 +1,179 @@
+/**
+ * @file test_ldap_connection_pool.cpp
+ * @brief Unit tests for the LdapConnectionPool free list and fast path
+ *
+ * FakePool overrides the connection lifecycle hooks with opaque fake
+ * handles, so no LDAP server is required. The calling thread's home shard
+ * is set explicitly through a thread-local.
+ *
+ * Naming convention: <Function>_<Scenario>_<ExpectedBehaviour>
+ */
+
+#include <gtest/gtest.h>
+#include "ldap_connection_pool.h"
+
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using common::LdapConnectionPool;
+
+namespace {
+
+thread_local size_t t_homeShard = 0;
+
+class FakePool : public LdapConnectionPool {
+public:
+    FakePool(size_t minSize, size_t maxSize, int idleValidationSec, size_t shards)
+        : LdapConnectionPool("ldap://fake", "cn=admin", "secret",
+                             minSize, maxSize, 1, 1, 1, idleValidationSec, shards) {}
+
+    ~FakePool() override { shutdown(); }
+
+    LDAP* handle(size_t i) const { return created.at(i); }
+    void breakConnection(LDAP* ld) { broken.insert(ld); }
+
+    std::vector<LDAP*> created;
+    std::set<LDAP*> broken;
+    std::set<LDAP*> closed;
+    int healthChecks = 0;
+
+protected:
+    LDAP* createConnection() override {
+        storage_.push_back(std::make_unique<char>());
+        auto* ld = reinterpret_cast<LDAP*>(storage_.back().get());
+        created.push_back(ld);
+        return ld;
+    }
+
+    void closeConnection(LDAP* ld) override { closed.insert(ld); }
+
+    bool isConnectionHealthy(LDAP* ld) override {
+        ++healthChecks;
+        return broken.count(ld) == 0;
+    }
+
+    bool isConnectionBroken(LDAP* ld) override { return broken.count(ld) > 0; }
+
+    size_t homeShard() const override { return t_homeShard % shardCount(); }
+
+private:
+    std::vector<std::unique_ptr<char>> storage_;
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// Shard selection
+// =============================================================================
+
+TEST(LdapConnectionPool, Acquire_TakesFromHomeShard) {
+    FakePool pool(2, 4, 60, 2);  // initialize(): handle 0 → shard 0, handle 1 → shard 1
+    ASSERT_TRUE(pool.initialize());
+
+    t_homeShard = 1;
+    auto conn = pool.acquire();
+    EXPECT_EQ(conn.get(), pool.handle(1));
+}
+
+TEST(LdapConnectionPool, Release_ReturnsToHomeShard) {
+    FakePool pool(2, 4, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+
+    t_homeShard = 0;
+    auto first = pool.acquire();
+    LDAP* mine = first.get();
+    first.release();
+
+    auto second = pool.acquire();
+    EXPECT_EQ(second.get(), mine);
+    EXPECT_EQ(pool.getStats().totalConnections, 2u);
+}
+
+TEST(LdapConnectionPool, Acquire_EmptyHomeShard_StealsFromOtherShard) {
+    FakePool pool(1, 4, 60, 2);  // the only idle connection sits in shard 0
+    ASSERT_TRUE(pool.initialize());
+
+    t_homeShard = 1;
+    auto conn = pool.acquire();
+    EXPECT_EQ(conn.get(), pool.handle(0));
+    EXPECT_EQ(pool.created.size(), 1u);
+}
+
+TEST(LdapConnectionPool, Acquire_AllShardsEmpty_CreatesUpToMax) {
+    FakePool pool(0, 2, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+
+    auto a = pool.acquire();
+    auto b = pool.acquire();
+    EXPECT_NE(a.get(), b.get());
+    EXPECT_EQ(pool.getStats().totalConnections, 2u);
+    EXPECT_FALSE(pool.acquire().isValid());  // max reached: invalid handle after the 1s timeout
+}
+
+// =============================================================================
+// Fast path vs legacy health checks
+// =============================================================================
+
+TEST(LdapConnectionPool, FastPath_NoHealthCheckOnAcquire) {
+    FakePool pool(2, 4, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+
+    for (int i = 0; i < 10; ++i) {
+        auto conn = pool.acquire();
+    }
+    EXPECT_EQ(pool.healthChecks, 0);
+    EXPECT_EQ(pool.getStats().acquireCount, 10u);
+}
+
+TEST(LdapConnectionPool, Legacy_HealthCheckedOnAcquire) {
+    FakePool pool(1, 4, 0, 1);
+    ASSERT_TRUE(pool.initialize());
+
+    { auto conn = pool.acquire(); }
+    EXPECT_EQ(pool.healthChecks, 1);
+}
+
+// =============================================================================
+// Broken connections
+// =============================================================================
+
+TEST(LdapConnectionPool, FastPath_BrokenOnRelease_Discarded) {
+    FakePool pool(1, 4, 60, 1);
+    ASSERT_TRUE(pool.initialize());
+
+    LDAP* handle = nullptr;
+    {
+        auto conn = pool.acquire();
+        handle = conn.get();
+        pool.breakConnection(handle);
+    }
+    auto stats = pool.getStats();
+    EXPECT_EQ(stats.discardedConnections, 1u);
+    EXPECT_EQ(stats.availableConnections, 0u);
+    EXPECT_EQ(stats.totalConnections, 0u);
+    EXPECT_EQ(pool.closed.count(handle), 1u);
+
+    auto fresh = pool.acquire();
+    EXPECT_NE(fresh.get(), handle);
+}
+
+TEST(LdapConnectionPool, Legacy_UnhealthyIdle_DiscardedOnAcquire) {
+    FakePool pool(1, 4, 0, 1);
+    ASSERT_TRUE(pool.initialize());
+    pool.breakConnection(pool.handle(0));
+
+    auto conn = pool.acquire();
+    EXPECT_NE(conn.get(), pool.handle(0));
+    EXPECT_EQ(pool.closed.count(pool.handle(0)), 1u);
+    EXPECT_EQ(pool.getStats().discardedConnections, 1u);
+}
+
+TEST(LdapConnectionPool, Shutdown_ClosesIdleConnections) {
+    FakePool pool(3, 4, 60, 2);
+    ASSERT_TRUE(pool.initialize());
+    pool.shutdown();
+    EXPECT_EQ(pool.closed.size(), 3u);
+    EXPECT_THROW(pool.acquire(), std::runtime_error);
+}